@@ -0,0 +1,189 @@
+
+#include "HeaderCreator.hpp"
+#ifdef _MSC_VER
+#include <io.h>
+#define isatty(x) _isatty(x)
+#define YY_NO_UNISTD_H
+#endif
+
+
+#include <cstdio>
+#include <string>
+#include <regex>
+#include <vector>
+#define YY_FLUSH_BUFFER
+static FILE *yyin = stdin;
+static void yyrestart(FILE *f) { yyin = f; }
+static const char *yytext = "";
+static int yylex(void)
+{
+  std::string text; char buf[4096]; size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), yyin)) > 0) text.append(buf, n);
+  std::vector<std::regex> rx;
+  rx.push_back(std::regex("GLAPI(?:[ \\t]+)+(?:(?:(?:const(?:[ \\t\\n])+)(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)(?:[ \\t\\n])*\\*)))|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)(?:[ \\t\\n])*\\*))|GLDEBUGPROC|GLDEBUGPROCARB|GLVULKANPROCNV)(?:[ \\t]+)*APIENTRY(?:[ \\t]+)+gl[^\\n]*\\n"));
+  rx.push_back(std::regex("GL_APICALL(?:[ \\t]+)+(?:(?:(?:const(?:[ \\t\\n])+)(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)(?:[ \\t\\n])*\\*)))|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)|(?:(?:(?:GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV)|(?:GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync)|(?:GLbyte|GLubyte)|(?:GLshort|GLushort)|(?:GLint|GLuint|int)|(?:GLfloat|GLdouble|GLclampf|GLclampd|float|double)|void|wchar_t)(?:[ \\t\\n])*\\*))|GLDEBUGPROC|GLDEBUGPROCARB|GLVULKANPROCNV)(?:[ \\t]+)*GL_APIENTRY(?:[ \\t]+)+gl[^\\n]*\\n"));
+  rx.push_back(std::regex("EGLAPI(?:[ \\t]+)+(?:(?:(?:(?:EGLint|EGLNativeDisplayType|EGLNativePixmapType|EGLNativeWindowType)|(?:void|EGLBoolean|EGLDisplay|EGLConfig|EGLSurface|EGLContext|EGLenum|EGLClientBuffer|EGLSync|EGLAttrib|EGLTime|EGLImage)|(?:EGLSyncKHR|EGLAttribKHR|EGLLabelKHR|EGLObjectKHR|EGLTimeKHR|EGLImageKHR|EGLStreamKHR|EGLuint64KHR|EGLNativeFileDescriptorKHR)|(?:EGLsizeiANDROID|EGLSetBlobFuncANDROID|EGLsizeiANDROID|EGLnsecsANDROID)|(?:EGLDeviceEXT|EGLOutputLayerEXT|EGLOutputPortEXT|EGLSyncNV|EGLTimeNV|EGLuint64NV|struct(?:[ \\t]+)EGLClientPixmapHI))|(?:(?:(?:EGLint|EGLNativeDisplayType|EGLNativePixmapType|EGLNativeWindowType)|(?:void|EGLBoolean|EGLDisplay|EGLConfig|EGLSurface|EGLContext|EGLenum|EGLClientBuffer|EGLSync|EGLAttrib|EGLTime|EGLImage)|(?:EGLSyncKHR|EGLAttribKHR|EGLLabelKHR|EGLObjectKHR|EGLTimeKHR|EGLImageKHR|EGLStreamKHR|EGLuint64KHR|EGLNativeFileDescriptorKHR)|(?:EGLsizeiANDROID|EGLSetBlobFuncANDROID|EGLsizeiANDROID|EGLnsecsANDROID)|(?:EGLDeviceEXT|EGLOutputLayerEXT|EGLOutputPortEXT|EGLSyncNV|EGLTimeNV|EGLuint64NV|struct(?:[ \\t]+)EGLClientPixmapHI))(?:[ \\t\\n])*\\*))|(?:(?:const(?:[ \\t\\n])+)(?:(?:(?:EGLint|EGLNativeDisplayType|EGLNativePixmapType|EGLNativeWindowType)|(?:void|EGLBoolean|EGLDisplay|EGLConfig|EGLSurface|EGLContext|EGLenum|EGLClientBuffer|EGLSync|EGLAttrib|EGLTime|EGLImage)|(?:EGLSyncKHR|EGLAttribKHR|EGLLabelKHR|EGLObjectKHR|EGLTimeKHR|EGLImageKHR|EGLStreamKHR|EGLuint64KHR|EGLNativeFileDescriptorKHR)|(?:EGLsizeiANDROID|EGLSetBlobFuncANDROID|EGLsizeiANDROID|EGLnsecsANDROID)|(?:EGLDeviceEXT|EGLOutputLayerEXT|EGLOutputPortEXT|EGLSyncNV|EGLTimeNV|EGLuint64NV|struct(?:[ \\t]+)EGLClientPixmapHI))|(?:(?:(?:EGLint|EGLNativeDisplayType|EGLNativePixmapType|EGLNativeWindowType)|(?:void|EGLBoolean|EGLDisplay|EGLConfig|EGLSurface|EGLContext|EGLenum|EGLClientBuffer|EGLSync|EGLAttrib|EGLTime|EGLImage)|(?:EGLSyncKHR|EGLAttribKHR|EGLLabelKHR|EGLObjectKHR|EGLTimeKHR|EGLImageKHR|EGLStreamKHR|EGLuint64KHR|EGLNativeFileDescriptorKHR)|(?:EGLsizeiANDROID|EGLSetBlobFuncANDROID|EGLsizeiANDROID|EGLnsecsANDROID)|(?:EGLDeviceEXT|EGLOutputLayerEXT|EGLOutputPortEXT|EGLSyncNV|EGLTimeNV|EGLuint64NV|struct(?:[ \\t]+)EGLClientPixmapHI))(?:[ \\t\\n])*\\*))))(?:[ \\t]+)*EGLAPIENTRY(?:[ \\t]+)+egl[^\\n]*\\n"));
+  rx.push_back(std::regex("FUNCTIONPOINTERMODE"));
+  rx.push_back(std::regex("FUNCTIONPOINTERMODE_PTR_TYPE_NOTDECLARED"));
+  rx.push_back(std::regex("NOFUNCTIONPOINTERMODE_PTR_TYPE_DECLARED"));
+  rx.push_back(std::regex("NOFUNCTIONPOINTERMODE_PTR_TYPE_NOTDECLARED"));
+  rx.push_back(std::regex("[ \\t\\n]+"));
+  rx.push_back(std::regex("."));
+  std::string match;
+  for(size_t p = 0; p < text.size(); )
+    {
+      int best = -1; size_t best_len = 0;
+      for(size_t r = 0; r < rx.size(); ++r)
+        {
+          std::smatch m;
+          if (std::regex_search(text.cbegin() + p, text.cend(), m, rx[r], std::regex_constants::match_continuous)
+              && (best < 0 || size_t(m.length(0)) > best_len))
+            { best = r; best_len = m.length(0); }
+        }
+      if (best < 0 || best_len == 0) { ++p; continue; }
+      match = text.substr(p, best_len); yytext = match.c_str(); p += best_len;
+      switch(best)
+        {
+        case 0: {
+  openGL_function_info *ptr;
+  ptr=new openGL_function_info(yytext, "GLAPI", "APIENTRY");
+  openGL_function_info::openGL_functionList().push_back(ptr);
+} break;
+        case 1: {
+  openGL_function_info *ptr;
+  ptr=new openGL_function_info(yytext,"GL_APICALL", "GL_APIENTRY");
+  openGL_function_info::openGL_functionList().push_back(ptr);
+} break;
+        case 2: {
+  openGL_function_info *ptr;
+  ptr=new openGL_function_info(yytext,"EGLAPI", "EGLAPIENTRY", "egl");
+  /* disclude if function name is eglGetProcAddress */
+  if (ptr->function_name() != "eglGetProcAddress")
+    {
+      openGL_function_info::openGL_functionList().push_back(ptr);
+    }
+  else
+    {
+      delete ptr;
+    }
+} break;
+        case 3: {
+  openGL_function_info::use_function_pointer_mode()=use_function_pointer_type_declared;
+} break;
+        case 4: {
+  openGL_function_info::use_function_pointer_mode()=use_function_pointer_type_undeclared;
+} break;
+        case 5: {
+  openGL_function_info::use_function_pointer_mode()=dont_use_function_pointer_type_declared;
+} break;
+        case 6: {
+  openGL_function_info::use_function_pointer_mode()=dont_use_function_pointer_type_undeclared;
+} break;
+        case 7: { /* do nothing */  } break;
+        case 8: { /* do nothing */  } break;
+        }
+    }
+  return 0;
+}
+
+/*code*/
+
+
+int main(int argc, char **argv)
+{
+  //read input from stdin!
+  //arguments affect behavior.
+
+  string headerName, sourceName, current;
+  string macroPrefix(""), function_prefix(""), namespaceName;
+  string path, output_cpp("kgl.cpp"), output_hpp("kgl.hpp");
+  ofstream sourceFile, headerFile;
+  list<string> fileNames;
+  int num;
+  map<string,openGL_function_info*>::iterator gg;
+
+  for(int i=1;i<argc;++i)
+    {
+      string::iterator iter;
+
+      current=argv[i];
+      iter=find(current.begin(), current.end(), '=');
+      if (iter!=current.end() && iter+1!=current.end())
+        {
+          if (string(current.begin(),iter)==string("macro_prefix"))
+            {
+              macroPrefix=string(iter+1,current.end());
+            }
+
+          if (string(current.begin(),iter)==string("function_prefix"))
+            {
+              function_prefix=string(iter+1,current.end());
+            }
+
+          if (string(current.begin(),iter)==string("namespace"))
+            {
+              namespaceName=string(iter+1,current.end());
+            }
+
+          if (string(current.begin(),iter)==string("path"))
+            {
+              path=string(iter+1,current.end());
+            }
+
+          if (string(current.begin(),iter)==string("output_cpp"))
+            {
+              output_cpp=string(iter+1,current.end());
+            }
+
+          if (string(current.begin(),iter)==string("output_hpp"))
+            {
+              output_hpp=string(iter+1,current.end());
+            }
+        }
+      else //not a command parameter, then is a file.
+        {
+          fileNames.push_back(current);
+        }
+    }
+
+  headerName=output_hpp;
+  sourceName=output_cpp;
+
+  sourceFile.open(sourceName.c_str());
+  headerFile.open(headerName.c_str());
+  if (!sourceFile || !headerFile)
+    {
+      cerr << "Failed to open one file for writing!\n";
+      exit(-1);
+    }
+
+  openGL_function_info::SetMacroPrefix(macroPrefix);
+  openGL_function_info::SetFunctionPrefix(function_prefix);
+  openGL_function_info::SetNamespace(namespaceName);
+
+  //read from stdin the function prototypes
+  YY_FLUSH_BUFFER;
+  yyrestart(stdin);
+  yylex();
+
+  openGL_function_info::HeaderStart(headerFile, fileNames);
+  openGL_function_info::SourceStart(sourceFile, fileNames);
+
+  for(num=0,gg=openGL_function_info::lookUp().begin(); gg!=openGL_function_info::lookUp().end(); ++gg, ++num)
+    {
+
+      gg->second->output_to_header(headerFile);
+      gg->second->output_to_source(sourceFile);
+
+      //gg->second->GetInfo(std::cout);
+      //std::cout << gg->second->function_name() << "\n";
+
+    }
+
+  openGL_function_info::HeaderEnd(headerFile, fileNames);
+  openGL_function_info::SourceEnd(sourceFile, fileNames);
+
+  //  cout << "\nGL functions counted=" << openGL_function_info::numberFunctions()
+  //   << "\n";
+
+}
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,117,114,118,101,112,97,105,114,95,103,108,121,112,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,99,117,114,118,101,112,97,105,114,95,103,108,121,112,104,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,65,100,97,112,116,101,100,32,102,114,111,109,32,102,111,110,116,95,99,117,114,118,101,95,97,110,97,108,121,116,105,99,95,98,97,115,101,46,102,114,97,103,46,119,114,97,116,104,45,115,104,97,100,101,114,46,103,108,115,108,32,111,102,32,87,82,65,84,72,58,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,51,32,98,121,32,78,111,109,111,118,111,107,32,76,116,100,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,105,110,102,111,64,110,111,109,111,118,111,107,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,110,111,109,111,118,111,107,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,47,42,10,32,32,77,117,115,116,32,104,97,118,101,32,100,101,102,105,110,101,100,58,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,85,82,86,69,80,65,73,82,95,67,79,77,80,85,84,69,95,78,65,77,69,32,110,97,109,101,32,111,102,32,102,117,110,99,116,105,111,110,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,76,79,65,68,95,67,85,82,86,69,95,71,69,79,77,69,84,82,89,40,88,44,32,89,41,32,104,111,114,114,105,98,108,101,32,109,97,99,114,111,32,116,111,32,108,111,97,100,32,99,117,114,118,101,32,100,97,116,97,10,32,32,77,117,115,116,32,104,97,118,101,32,100,101,99,108,97,114,101,100,58,10,32,32,32,45,32,115,97,109,112,108,101,114,66,117,102,102,101,114,32,111,102,32,110,97,109,101,32,117,115,101,100,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,76,79,65,68,95,67,85,82,86,69,95,71,69,79,77,69,84,82,89,10,32,42,47,10,102,108,111,97,116,10,70,65,83,84,85,73,68,82,65,87,95,67,85,82,86,69,80,65,73,82,95,67,79,77,80,85,84,69,95,78,65,77,69,40,105,110,32,117,105,110,116,32,116,101,120,101,108,95,118,97,108,117,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,50,32,103,108,121,112,104,95,112,111,115,105,116,105,111,110,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,103,101,111,109,101,116,114,121,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,103,114,97,100,41,10,123,10,32,32,47,42,32,103,101,111,109,116,101,116,114,121,32,100,97,116,97,32,111,102,32,99,117,114,118,101,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,122,101,116,97,44,32,99,111,109,98,105,110,101,95,114,117,108,101,59,10,32,32,118,101,99,52,32,65,48,95,66,48,95,65,49,95,66,49,59,10,32,32,118,101,99,52,32,81,97,95,81,98,59,10,32,32,118,101,99,52,32,112,50,95,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,59,10,10,32,32,47,42,32,119,111,114,107,32,114,111,111,109,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,111,109,101,103,97,44,32,115,105,103,109,97,44,32,115,105,103,109,97,95,109,105,110,44,32,115,105,103,109,97,95,109,97,120,59,10,32,32,118,101,99,50,32,112,112,44,32,115,97,95,115,98,44,32,116,97,95,116,98,44,32,115,105,103,109,97,95,97,98,44,32,111,109,101,103,97,95,97,98,59,10,32,32,118,101,99,52,32,112,97,95,112,98,44,32,103,114,97,100,95,116,97,95,116,98,44,32,103,114,97,100,95,115,97,95,115,98,44,32,103,114,97,100,95,115,105,103,109,97,95,97,98,44,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,95,109,97,120,59,10,10,35,100,101,102,105,110,101,32,116,97,32,116,97,95,116,98,46,120,10,35,100,101,102,105,110,101,32,116,98,32,116,97,95,116,98,46,121,10,10,35,100,101,102,105,110,101,32,115,97,32,115,97,95,115,98,46,120,10,35,100,101,102,105,110,101,32,115,98,32,115,97,95,115,98,46,121,10,10,10,35,100,101,102,105,110,101,32,103,114,97,100,95,116,97,32,103,114,97,100,95,116,97,95,116,98,46,120,121,10,35,100,101,102,105,110,101,32,103,114,97,100,95,116,98,32,103,114,97,100,95,116,97,95,116,98,46,122,119,10,35,100,101,102,105,110,101,32,103,114,97,100,95,116,97,95,116,98,95,120,32,103,114,97,100,95,116,97,95,116,98,46,120,122,10,35,100,101,102,105,110,101,32,103,114,97,100,95,116,97,95,116,98,95,121,32,103,114,97,100,95,116,97,95,116,98,46,121,119,10,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,97,32,103,114,97,100,95,115,105,103,109,97,95,97,98,46,120,121,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,98,32,103,114,97,100,95,115,105,103,109,97,95,97,98,46,122,119,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,120,32,103,114,97,100,95,115,105,103,109,97,95,97,98,46,120,122,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,121,32,103,114,97,100,95,115,105,103,109,97,95,97,98,46,121,119,10,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,97,32,103,114,97,100,95,115,97,95,115,98,46,120,121,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,98,32,103,114,97,100,95,115,97,95,115,98,46,122,119,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,97,95,115,98,95,120,32,103,114,97,100,95,115,97,95,115,98,46,120,122,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,97,95,115,98,95,121,32,103,114,97,100,95,115,97,95,115,98,46,121,119,10,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,95,109,97,120,46,120,121,10,35,100,101,102,105,110,101,32,103,114,97,100,95,115,105,103,109,97,95,109,97,120,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,95,109,97,120,46,122,119,10,10,35,100,101,102,105,110,101,32,65,48,32,65,48,95,66,48,95,65,49,95,66,49,46,120,10,35,100,101,102,105,110,101,32,66,48,32,65,48,95,66,48,95,65,49,95,66,49,46,121,10,35,100,101,102,105,110,101,32,65,48,95,66,48,32,65,48,95,66,48,95,65,49,95,66,49,46,120,121,10,35,100,101,102,105,110,101,32,65,49,32,65,48,95,66,48,95,65,49,95,66,49,46,122,10,35,100,101,102,105,110,101,32,66,49,32,65,48,95,66,48,95,65,49,95,66,49,46,119,10,35,100,101,102,105,110,101,32,65,49,95,66,49,32,65,48,95,66,48,95,65,49,95,66,49,46,122,119,10,10,35,100,101,102,105,110,101,32,99,117,114,118,101,48,95,109,48,32,65,48,10,35,100,101,102,105,110,101,32,99,117,114,118,101,48,95,109,49,32,65,49,10,10,35,100,101,102,105,110,101,32,99,117,114,118,101,49,95,109,48,32,66,48,10,35,100,101,102,105,110,101,32,99,117,114,118,101,49,95,109,49,32,66,49,10,10,35,100,101,102,105,110,101,32,81,97,32,81,97,95,81,98,46,120,121,10,35,100,101,102,105,110,101,32,81,98,32,81,97,95,81,98,46,122,119,10,35,100,101,102,105,110,101,32,81,97,95,81,98,95,120,32,81,97,95,81,98,46,120,122,10,35,100,101,102,105,110,101,32,81,97,95,81,98,95,121,32,81,97,95,81,98,46,121,119,10,10,35,100,101,102,105,110,101,32,99,117,114,118,101,48,95,113,95,120,32,81,97,46,120,10,35,100,101,102,105,110,101,32,99,117,114,118,101,48,95,113,95,121,32,81,97,46,121,10,10,35,100,101,102,105,110,101,32,99,117,114,118,101,49,95,113,95,120,32,81,98,46,120,10,35,100,101,102,105,110,101,32,99,117,114,118,101,49,95,113,95,121,32,81,98,46,121,10,10,35,100,101,102,105,110,101,32,112,50,32,112,50,95,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,46,120,121,10,35,100,101,102,105,110,101,32,81,97,83,99,97,108,101,32,112,50,95,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,46,122,10,35,100,101,102,105,110,101,32,81,98,83,99,97,108,101,32,112,50,95,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,46,119,10,35,100,101,102,105,110,101,32,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,32,112,50,95,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,46,122,119,10,10,35,100,101,102,105,110,101,32,112,95,120,32,112,50,46,120,10,35,100,101,102,105,110,101,32,112,95,121,32,112,50,46,121,10,35,100,101,102,105,110,101,32,99,117,114,118,101,48,95,113,117,97,100,95,99,111,101,102,102,32,81,97,83,99,97,108,101,10,35,100,101,102,105,110,101,32,99,117,114,118,101,49,95,113,117,97,100,95,99,111,101,102,102,32,81,98,83,99,97,108,101,10,10,35,100,101,102,105,110,101,32,115,105,103,109,97,95,97,32,115,105,103,109,97,95,97,98,46,120,10,35,100,101,102,105,110,101,32,115,105,103,109,97,95,98,32,115,105,103,109,97,95,97,98,46,121,10,35,100,101,102,105,110,101,32,111,109,101,103,97,95,97,32,111,109,101,103,97,95,97,98,46,120,10,35,100,101,102,105,110,101,32,111,109,101,103,97,95,98,32,111,109,101,103,97,95,97,98,46,121,10,35,100,101,102,105,110,101,32,112,97,95,120,32,112,97,95,112,98,46,120,10,35,100,101,102,105,110,101,32,112,97,95,121,32,112,97,95,112,98,46,121,10,35,100,101,102,105,110,101,32,112,98,95,120,32,112,97,95,112,98,46,122,10,35,100,101,102,105,110,101,32,112,98,95,121,32,112,97,95,112,98,46,119,10,35,100,101,102,105,110,101,32,112,97,32,112,97,95,112,98,46,120,121,10,35,100,101,102,105,110,101,32,112,98,32,112,97,95,112,98,46,122,119,10,35,100,101,102,105,110,101,32,112,97,95,112,98,95,120,32,112,97,95,112,98,46,120,122,10,35,100,101,102,105,110,101,32,112,97,95,112,98,95,121,32,112,97,95,112,98,46,121,119,10,10,32,32,103,114,97,100,32,61,32,118,101,99,50,40,48,46,48,44,32,48,46,48,41,59,10,10,32,32,47,42,32,116,101,120,101,108,95,118,97,108,117,101,32,48,32,109,101,97,110,115,32,99,111,109,112,108,101,116,101,108,121,32,101,109,112,116,121,32,116,101,120,101,108,10,32,32,32,42,47,10,32,32,105,102,32,40,116,101,120,101,108,95,118,97,108,117,101,32,61,61,32,117,105,110,116,40,48,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,45,49,46,48,59,10,32,32,32,32,125,10,10,32,32,47,42,32,116,101,120,101,108,95,118,97,108,117,101,32,49,32,109,101,97,110,115,32,99,111,109,112,108,101,116,101,108,121,32,102,117,108,108,32,116,101,120,101,108,10,32,32,32,42,47,10,32,32,105,102,32,40,116,101,120,101,108,95,118,97,108,117,101,32,61,61,32,117,105,110,116,40,49,41,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,49,46,48,59,10,32,32,32,32,125,10,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,79,65,68,95,67,85,82,86,69,95,71,69,79,77,69,84,82,89,40,103,101,111,109,101,116,114,121,95,111,102,102,115,101,116,44,32,116,101,120,101,108,95,118,97,108,117,101,41,59,10,10,10,32,32,112,112,32,61,32,103,108,121,112,104,95,112,111,115,105,116,105,111,110,32,45,32,112,50,59,10,32,32,47,42,10,32,32,32,32,81,97,58,61,32,124,32,81,97,95,120,32,32,81,97,95,121,32,124,10,32,32,32,32,32,32,32,32,32,124,45,81,97,95,121,32,32,81,97,95,120,32,124,10,10,32,32,32,32,81,98,58,61,32,124,32,81,98,95,120,32,32,81,98,95,121,32,124,10,32,32,32,32,32,32,32,32,32,124,45,81,98,95,121,32,32,81,98,95,120,32,124,10,10,32,32,32,32,65,112,112,108,121,32,81,97,32,97,110,100,32,81,98,44,32,116,104,101,32,114,97,119,32,118,97,108,117,101,115,32,97,114,101,58,10,32,32,32,32,112,97,95,120,61,32,32,112,112,46,120,42,81,97,95,120,32,43,32,112,112,46,121,42,81,97,95,121,59,10,32,32,32,32,112,97,95,121,61,32,45,112,112,46,120,42,81,97,95,121,32,43,32,112,112,46,121,42,81,97,95,120,59,10,32,32,32,32,112,98,95,120,61,32,32,112,112,46,120,42,81,98,95,120,32,43,32,112,112,46,121,42,81,98,95,121,59,10,32,32,32,32,112,98,95,121,61,32,45,112,112,46,120,42,81,98,95,121,32,43,32,112,112,46,121,42,81,98,95,120,59,10,32,32,42,47,10,32,32,112,97,95,112,98,95,120,32,61,32,32,112,112,46,120,32,42,32,81,97,95,81,98,95,120,32,43,32,112,112,46,121,32,42,32,81,97,95,81,98,95,121,59,10,32,32,112,97,95,112,98,95,121,32,61,32,45,112,112,46,120,32,42,32,81,97,95,81,98,95,121,32,43,32,112,112,46,121,32,42,32,81,97,95,81,98,95,120,59,10,10,32,32,116,97,95,116,98,32,61,32,112,97,95,112,98,95,120,32,42,32,65,48,95,66,48,59,10,10,32,32,103,114,97,100,95,116,97,95,116,98,95,120,32,61,32,81,97,95,81,98,95,120,32,42,32,65,48,95,66,48,59,10,32,32,103,114,97,100,95,116,97,95,116,98,95,121,32,61,32,81,97,95,81,98,95,121,32,42,32,65,48,95,66,48,59,10,32,32,47,42,10,32,32,32,32,111,109,101,103,97,95,97,33,61,48,32,60,45,45,62,32,116,95,97,62,61,48,10,32,32,32,32,111,109,101,103,97,95,98,33,61,48,32,60,45,45,62,32,116,95,98,62,61,48,10,10,32,32,32,32,115,97,95,115,98,32,105,115,32,117,115,101,100,32,105,110,32,112,108,97,99,101,32,111,102,32,116,97,95,116,98,42,116,97,95,116,98,46,10,10,32,32,32,32,105,102,32,116,60,48,44,32,116,104,101,110,32,109,97,107,105,110,103,32,115,61,48,10,32,32,32,32,105,115,32,101,113,117,105,118,97,108,101,110,116,32,116,111,32,101,120,116,101,110,100,105,110,103,32,98,101,102,111,114,101,32,116,61,48,32,97,115,32,97,32,108,105,110,101,46,10,10,32,32,32,32,105,102,32,116,62,49,44,32,116,104,101,110,32,109,97,107,105,110,103,32,115,61,50,42,116,45,49,32,105,115,10,32,32,32,32,101,113,117,105,118,97,108,101,110,116,32,116,111,32,101,120,116,101,110,100,105,110,103,32,97,102,116,101,114,32,116,61,49,32,97,115,32,97,32,108,105,110,101,46,10,32,32,42,47,10,32,32,111,109,101,103,97,95,97,98,32,61,32,115,116,101,112,40,48,46,48,44,32,116,97,95,116,98,41,59,10,32,32,115,97,95,115,98,32,61,32,111,109,101,103,97,95,97,98,32,42,32,109,105,120,40,116,97,95,116,98,32,42,32,116,97,95,116,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,50,46,48,32,42,32,116,97,95,116,98,32,45,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,101,112,40,49,46,48,44,32,116,97,41,32,41,59,10,10,32,32,47,42,32,115,32,61,32,116,94,50,44,32,100,115,32,61,32,50,32,42,32,116,32,42,32,100,116,10,32,32,32,32,32,111,114,10,32,32,32,32,32,115,32,61,32,50,46,48,32,42,32,116,32,45,32,49,44,32,100,115,32,61,32,50,32,42,32,100,116,10,32,32,32,42,47,10,32,32,103,114,97,100,95,115,97,32,61,32,111,109,101,103,97,95,97,32,42,32,109,105,120,40,50,46,48,32,42,32,116,97,32,42,32,103,114,97,100,95,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,50,46,48,32,42,32,103,114,97,100,95,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,101,112,40,49,46,48,44,32,116,97,41,41,59,10,10,32,32,103,114,97,100,95,115,98,32,61,32,111,109,101,103,97,95,98,32,42,32,109,105,120,40,50,46,48,32,42,32,116,98,32,42,32,103,114,97,100,95,116,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,50,46,48,32,42,32,103,114,97,100,95,116,98,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,101,112,40,49,46,48,44,32,116,98,41,41,59,10,10,10,32,32,47,42,10,32,32,32,32,111,109,101,103,97,33,61,48,32,60,45,45,62,32,111,110,101,32,111,102,32,116,95,97,44,32,116,95,98,32,112,111,115,105,116,105,118,101,10,10,32,32,32,32,73,102,32,102,114,97,103,109,101,110,116,32,105,115,32,110,111,116,32,119,105,116,104,105,110,32,116,104,101,32,115,104,97,100,111,119,10,32,32,32,32,111,102,32,101,105,116,104,101,114,32,99,117,114,118,101,44,32,116,104,101,110,32,119,101,32,101,120,116,101,110,100,10,32,32,32,32,66,79,84,72,32,99,117,114,118,101,115,32,97,115,32,108,105,110,101,115,32,105,110,32,97,32,67,49,32,102,97,115,104,105,111,110,10,32,32,32,32,97,110,100,32,117,115,101,32,116,104,97,116,32,97,115,32,116,104,101,32,114,101,115,117,108,116,46,10,32,32,42,47,10,32,32,111,109,101,103,97,32,61,32,109,97,120,40,111,109,101,103,97,95,97,44,32,111,109,101,103,97,95,98,41,59,10,10,32,32,111,109,101,103,97,95,97,98,32,61,32,40,111,109,101,103,97,32,60,32,48,46,53,41,32,63,10,32,32,32,32,118,101,99,50,40,49,46,48,44,32,49,46,48,41,32,58,10,32,32,32,32,111,109,101,103,97,95,97,98,59,10,10,32,32,47,42,10,32,32,32,32,77,97,107,101,58,10,32,32,32,32,32,115,105,103,109,97,95,97,61,45,40,65,49,42,116,97,32,43,32,116,97,42,116,97,42,81,97,83,99,97,108,101,32,45,32,112,97,95,121,41,42,115,105,103,110,40,65,48,41,59,10,32,32,32,32,32,115,105,103,109,97,95,98,61,32,40,66,49,42,116,98,32,43,32,116,98,42,116,98,42,81,98,83,99,97,108,101,32,45,32,112,98,95,121,41,42,115,105,103,110,40,66,48,41,59,10,32,32,42,47,10,32,32,65,48,32,61,32,45,65,48,59,10,32,32,115,105,103,109,97,95,97,98,32,61,32,40,65,49,95,66,49,32,42,32,116,97,95,116,98,32,43,32,115,97,95,115,98,32,42,32,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,32,45,32,112,97,95,112,98,95,121,41,32,42,32,115,105,103,110,40,65,48,95,66,48,41,59,10,32,32,115,105,103,109,97,95,97,32,61,32,40,111,109,101,103,97,95,97,32,62,32,48,46,53,41,32,63,32,115,105,103,109,97,95,97,32,58,32,122,101,116,97,59,10,32,32,115,105,103,109,97,95,98,32,61,32,40,111,109,101,103,97,95,98,32,62,32,48,46,53,41,32,63,32,115,105,103,109,97,95,98,32,58,32,122,101,116,97,59,10,10,32,32,47,42,32,114,101,99,97,108,108,58,10,32,32,32,32,32,32,32,112,97,95,112,98,95,121,32,61,32,45,112,112,46,120,32,42,32,81,97,95,81,98,95,121,32,43,32,112,112,46,121,32,42,32,81,97,95,81,98,95,120,59,10,32,32,32,42,47,10,32,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,120,32,61,32,40,65,49,95,66,49,32,42,32,103,114,97,100,95,116,97,95,116,98,95,120,32,43,32,103,114,97,100,95,115,97,95,115,98,95,120,32,42,32,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,32,43,32,81,97,95,81,98,95,121,41,32,42,32,115,105,103,110,40,65,48,95,66,48,41,59,10,32,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,121,32,61,32,40,65,49,95,66,49,32,42,32,103,114,97,100,95,116,97,95,116,98,95,121,32,43,32,103,114,97,100,95,115,97,95,115,98,95,121,32,42,32,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,32,45,32,81,97,95,81,98,95,120,41,32,42,32,115,105,103,110,40,65,48,95,66,48,41,59,10,10,32,32,103,114,97,100,95,115,105,103,109,97,95,97,32,42,61,32,111,109,101,103,97,95,97,59,10,32,32,103,114,97,100,95,115,105,103,109,97,95,98,32,42,61,32,111,109,101,103,97,95,98,59,10,10,32,32,115,105,103,109,97,95,109,105,110,32,61,32,109,105,110,40,115,105,103,109,97,95,97,44,32,115,105,103,109,97,95,98,41,59,10,32,32,115,105,103,109,97,95,109,97,120,32,61,32,109,97,120,40,115,105,103,109,97,95,97,44,32,115,105,103,109,97,95,98,41,59,10,10,10,32,32,105,102,32,40,115,105,103,109,97,95,97,32,60,32,115,105,103,109,97,95,98,41,10,32,32,32,32,123,10,32,32,32,32,32,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,32,61,32,103,114,97,100,95,115,105,103,109,97,95,97,59,10,32,32,32,32,32,32,103,114,97,100,95,115,105,103,109,97,95,109,97,120,32,61,32,103,114,97,100,95,115,105,103,109,97,95,98,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,32,61,32,103,114,97,100,95,115,105,103,109,97,95,98,59,10,32,32,32,32,32,32,103,114,97,100,95,115,105,103,109,97,95,109,97,120,32,61,32,103,114,97,100,95,115,105,103,109,97,95,97,59,10,32,32,32,32,125,10,10,32,32,47,42,10,32,32,32,32,114,117,108,101,58,10,32,32,32,32,32,32,48,32,60,45,45,45,62,32,79,82,32,114,117,108,101,32,32,60,45,45,62,32,109,97,120,10,32,32,32,32,32,32,49,32,60,45,45,45,62,32,65,78,68,32,114,117,108,101,32,60,45,45,62,32,109,105,110,10,32,32,32,42,47,10,32,32,105,102,32,40,99,111,109,98,105,110,101,95,114,117,108,101,32,60,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,115,105,103,109,97,32,61,32,115,105,103,109,97,95,109,97,120,59,10,32,32,32,32,32,32,103,114,97,100,32,61,32,103,114,97,100,95,115,105,103,109,97,95,109,97,120,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,115,105,103,109,97,32,61,32,115,105,103,109,97,95,109,105,110,59,10,32,32,32,32,32,32,103,114,97,100,32,61,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,115,105,103,109,97,59,10,10,125,10,10,35,117,110,100,101,102,32,116,97,10,35,117,110,100,101,102,32,116,98,10,35,117,110,100,101,102,32,115,97,10,35,117,110,100,101,102,32,115,98,10,10,35,117,110,100,101,102,32,103,114,97,100,95,116,97,10,35,117,110,100,101,102,32,103,114,97,100,95,116,98,10,35,117,110,100,101,102,32,103,114,97,100,95,116,97,95,116,98,95,120,10,35,117,110,100,101,102,32,103,114,97,100,95,116,97,95,116,98,95,121,10,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,97,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,98,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,120,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,97,95,98,95,121,10,10,35,117,110,100,101,102,32,103,114,97,100,95,115,97,10,35,117,110,100,101,102,32,103,114,97,100,95,115,98,10,35,117,110,100,101,102,32,103,114,97,100,95,115,97,95,115,98,95,120,10,35,117,110,100,101,102,32,103,114,97,100,95,115,97,95,115,98,95,121,10,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,109,105,110,10,35,117,110,100,101,102,32,103,114,97,100,95,115,105,103,109,97,95,109,97,120,10,10,35,117,110,100,101,102,32,65,48,10,35,117,110,100,101,102,32,66,48,10,35,117,110,100,101,102,32,65,49,10,35,117,110,100,101,102,32,66,49,10,35,117,110,100,101,102,32,65,48,95,66,48,10,35,117,110,100,101,102,32,65,49,95,66,49,10,10,35,117,110,100,101,102,32,99,117,114,118,101,48,95,109,48,10,35,117,110,100,101,102,32,99,117,114,118,101,49,95,109,48,10,35,117,110,100,101,102,32,99,117,114,118,101,48,95,109,49,10,35,117,110,100,101,102,32,99,117,114,118,101,49,95,109,49,10,10,35,117,110,100,101,102,32,81,97,10,35,117,110,100,101,102,32,81,98,10,35,117,110,100,101,102,32,81,97,95,81,98,95,120,10,35,117,110,100,101,102,32,81,97,95,81,98,95,121,10,10,35,117,110,100,101,102,32,99,117,114,118,101,48,95,113,95,120,10,35,117,110,100,101,102,32,99,117,114,118,101,48,95,113,95,121,10,35,117,110,100,101,102,32,99,117,114,118,101,49,95,113,95,120,10,35,117,110,100,101,102,32,99,117,114,118,101,49,95,113,95,121,10,10,35,117,110,100,101,102,32,112,50,10,35,117,110,100,101,102,32,81,97,83,99,97,108,101,10,35,117,110,100,101,102,32,81,98,83,99,97,108,101,10,35,117,110,100,101,102,32,81,97,83,99,97,108,101,95,81,98,83,99,97,108,101,10,10,35,117,110,100,101,102,32,112,95,120,10,35,117,110,100,101,102,32,112,95,121,10,35,117,110,100,101,102,32,99,117,114,118,101,48,95,113,117,97,100,95,99,111,101,102,102,10,35,117,110,100,101,102,32,99,117,114,118,101,49,95,113,117,97,100,95,99,111,101,102,102,10,10,35,117,110,100,101,102,32,115,105,103,109,97,95,97,10,35,117,110,100,101,102,32,115,105,103,109,97,95,98,10,35,117,110,100,101,102,32,111,109,101,103,97,95,97,10,35,117,110,100,101,102,32,111,109,101,103,97,95,98,10,35,117,110,100,101,102,32,112,97,95,120,10,35,117,110,100,101,102,32,112,97,95,121,10,35,117,110,100,101,102,32,112,98,95,120,10,35,117,110,100,101,102,32,112,98,95,121,10,35,117,110,100,101,102,32,112,97,10,35,117,110,100,101,102,32,112,98,10,35,117,110,100,101,102,32,112,97,95,112,98,95,120,10,35,117,110,100,101,102,32,112,97,95,112,98,95,121,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_curvepair_glyph_derivative.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
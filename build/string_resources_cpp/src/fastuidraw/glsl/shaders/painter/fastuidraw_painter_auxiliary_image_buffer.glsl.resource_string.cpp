@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,117,120,105,108,105,97,114,121,95,105,109,97,103,101,95,98,117,102,102,101,114,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,117,120,105,108,105,97,114,121,95,105,109,97,103,101,95,98,117,102,102,101,114,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,35,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,73,78,84,69,82,76,79,67,75,41,32,124,124,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,73,78,84,69,82,76,79,67,75,95,77,65,73,78,95,79,78,76,89,41,10,10,32,32,108,97,121,111,117,116,40,98,105,110,100,105,110,103,32,61,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,66,73,78,68,73,78,71,44,32,114,56,41,32,114,101,115,116,114,105,99,116,32,108,111,119,112,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,59,10,10,32,32,35,105,102,32,33,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,73,78,84,69,82,76,79,67,75,95,77,65,73,78,95,79,78,76,89,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,98,101,103,105,110,95,105,110,116,101,114,108,111,99,107,40,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,101,110,100,95,105,110,116,101,114,108,111,99,107,40,41,10,32,32,35,101,108,115,101,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,35,101,110,100,105,102,10,10,32,32,102,108,111,97,116,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,101,97,114,95,97,117,120,105,108,105,97,114,121,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,102,108,111,97,116,32,114,59,10,32,32,32,32,105,118,101,99,50,32,112,111,115,32,61,32,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,59,10,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,59,10,32,32,32,32,114,32,61,32,105,109,97,103,101,76,111,97,100,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,41,46,120,59,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,44,32,118,101,99,52,40,48,46,48,44,32,48,46,48,44,32,48,46,48,44,32,48,46,48,41,41,59,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,59,10,32,32,32,32,114,101,116,117,114,110,32,114,59,10,32,32,125,10,10,32,32,118,111,105,100,10,32,32,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,97,117,120,105,108,105,97,114,121,40,105,110,32,102,108,111,97,116,32,102,41,10,32,32,123,10,32,32,32,32,105,118,101,99,50,32,112,111,115,32,61,32,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,59,10,10,32,32,32,32,102,32,61,32,99,108,97,109,112,40,102,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,59,10,32,32,32,32,102,32,61,32,109,97,120,40,105,109,97,103,101,76,111,97,100,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,41,46,120,44,32,102,41,59,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,44,32,118,101,99,52,40,102,44,32,48,46,48,44,32,48,46,48,44,32,48,46,48,41,41,59,10,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,59,10,32,32,125,10,10,32,32,47,47,110,111,119,32,100,101,102,105,110,101,32,105,110,116,101,114,108,111,99,107,32,102,117,110,99,116,105,111,110,115,32,111,112,112,111,115,105,116,101,32,102,111,114,32,116,104,101,32,109,97,105,110,46,10,32,32,35,117,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,10,32,32,35,117,110,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,10,32,32,35,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,73,78,84,69,82,76,79,67,75,95,77,65,73,78,95,79,78,76,89,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,98,101,103,105,110,95,105,110,116,101,114,108,111,99,107,40,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,101,110,100,95,105,110,116,101,114,108,111,99,107,40,41,10,32,32,35,101,108,115,101,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,35,101,110,100,105,102,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,65,84,79,77,73,67,41,10,10,32,32,108,97,121,111,117,116,40,98,105,110,100,105,110,103,32,61,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,66,73,78,68,73,78,71,44,32,114,51,50,117,105,41,32,104,105,103,104,112,32,114,101,115,116,114,105,99,116,32,117,110,105,102,111,114,109,32,117,105,109,97,103,101,50,68,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,59,10,10,32,32,102,108,111,97,116,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,101,97,114,95,97,117,120,105,108,105,97,114,121,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,117,105,110,116,32,114,59,10,32,32,32,32,105,118,101,99,50,32,112,111,115,32,61,32,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,59,10,32,32,32,32,114,32,61,32,105,109,97,103,101,65,116,111,109,105,99,69,120,99,104,97,110,103,101,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,44,32,48,117,41,59,10,32,32,32,32,114,101,116,117,114,110,32,102,108,111,97,116,40,114,41,32,47,32,50,53,53,46,48,59,10,32,32,125,10,10,32,32,118,111,105,100,10,32,32,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,97,117,120,105,108,105,97,114,121,40,105,110,32,102,108,111,97,116,32,102,41,10,32,32,123,10,32,32,32,32,105,118,101,99,50,32,112,111,115,32,61,32,105,118,101,99,50,40,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,41,59,10,32,32,32,32,117,105,110,116,32,114,59,10,10,32,32,32,32,114,32,61,32,117,105,110,116,40,50,53,53,46,48,32,42,32,99,108,97,109,112,40,102,44,32,48,46,48,44,32,49,46,48,41,41,59,10,32,32,32,32,105,109,97,103,101,65,116,111,109,105,99,77,97,120,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,44,32,112,111,115,44,32,114,41,59,10,32,32,125,10,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,65,85,88,73,76,73,65,82,89,95,66,85,70,70,69,82,95,70,82,65,77,69,66,85,70,70,69,82,95,70,69,84,67,72,41,10,10,32,32,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,49,41,32,105,110,111,117,116,32,102,108,111,97,116,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,105,110,111,117,116,59,10,32,32,102,108,111,97,116,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,59,10,10,32,32,118,111,105,100,10,32,32,102,97,115,116,117,105,100,114,97,119,95,103,101,116,95,97,117,120,105,108,105,97,114,121,95,102,114,111,109,95,102,98,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,105,110,111,117,116,59,10,32,32,125,10,10,32,32,118,111,105,100,10,32,32,102,97,115,116,117,105,100,114,97,119,95,119,114,105,116,101,95,97,117,120,105,108,105,97,114,121,95,116,111,95,102,98,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,105,110,111,117,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,59,10,32,32,125,10,10,32,32,102,108,111,97,116,10,32,32,102,97,115,116,117,105,100,114,97,119,95,99,108,101,97,114,95,97,117,120,105,108,105,97,114,121,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,102,108,111,97,116,32,114,59,10,32,32,32,32,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,59,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,32,61,32,48,46,48,59,10,32,32,32,32,114,101,116,117,114,110,32,114,59,10,32,32,125,10,10,32,32,118,111,105,100,10,32,32,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,97,117,120,105,108,105,97,114,121,40,105,110,32,102,108,111,97,116,32,102,41,10,32,32,123,10,32,32,32,32,102,32,61,32,99,108,97,109,112,40,102,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,32,61,32,109,97,120,40,102,97,115,116,117,105,100,114,97,119,95,97,117,120,105,108,105,97,114,121,95,98,117,102,102,101,114,95,116,109,112,44,32,102,41,59,10,32,32,125,10,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,102,97,115,116,117,105,100,114,97,119,95,103,101,116,95,97,117,120,105,108,105,97,114,121,95,102,114,111,109,95,102,98,40,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,102,97,115,116,117,105,100,114,97,119,95,119,114,105,116,101,95,97,117,120,105,108,105,97,114,121,95,116,111,95,102,98,40,41,10,10,35,101,108,115,101,10,10,32,32,102,108,111,97,116,32,102,97,115,116,117,105,100,114,97,119,95,99,108,101,97,114,95,97,117,120,105,108,105,97,114,121,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,114,101,116,117,114,110,32,48,46,48,59,10,32,32,125,10,10,32,32,118,111,105,100,32,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,97,117,120,105,108,105,97,114,121,40,105,110,32,102,108,111,97,116,32,102,41,10,32,32,123,10,32,32,125,10,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,32,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,111,95,110,111,116,104,105,110,103,40,41,10,10,35,101,110,100,105,102,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_auxiliary_image_buffer.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
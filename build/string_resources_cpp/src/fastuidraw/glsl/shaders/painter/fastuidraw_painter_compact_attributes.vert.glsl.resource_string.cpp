@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,111,109,112,97,99,116,95,97,116,116,114,105,98,117,116,101,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,99,111,109,112,97,99,116,95,97,116,116,114,105,98,117,116,101,115,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,79,77,80,65,67,84,95,65,84,84,82,73,66,85,84,69,83,10,10,47,42,32,83,101,116,115,32,116,104,101,32,103,108,111,98,97,108,115,32,102,97,115,116,117,105,100,114,97,119,95,112,114,105,109,97,114,121,95,97,116,116,114,105,98,117,116,101,44,10,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,117,116,101,44,32,102,97,115,116,117,105,100,114,97,119,95,117,105,110,116,95,97,116,116,114,105,98,117,116,101,10,32,32,32,97,110,100,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,32,116,111,32,116,104,101,32,118,97,108,117,101,115,32,116,104,97,116,32,116,104,101,10,32,32,32,80,97,105,110,116,101,114,65,116,116,114,105,98,117,116,101,32,97,110,100,32,104,101,97,100,101,114,32,108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,32,118,101,114,116,101,120,32,104,97,118,101,46,10,32,32,32,73,102,32,116,104,101,32,99,111,109,112,97,99,116,32,98,105,116,32,111,102,32,116,104,101,32,104,101,97,100,101,114,32,105,115,32,117,112,44,32,116,104,101,32,118,101,114,116,101,120,32,99,111,109,101,115,10,32,32,32,102,114,111,109,32,80,97,105,110,116,101,114,68,114,97,119,58,58,109,95,99,111,109,112,97,99,116,95,97,116,116,114,105,98,117,116,101,115,32,97,110,100,32,116,104,101,32,118,97,108,117,101,115,32,97,114,101,10,32,32,32,117,110,112,97,99,107,101,100,32,102,114,111,109,32,116,104,101,32,80,97,105,110,116,101,114,67,111,109,112,97,99,116,65,116,116,114,105,98,117,116,101,32,97,115,32,100,101,115,99,114,105,98,101,100,32,98,121,10,32,32,32,80,97,105,110,116,101,114,67,111,109,112,97,99,116,65,116,116,114,105,98,117,116,101,58,58,108,97,121,111,117,116,95,116,46,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,117,110,112,97,99,107,95,99,111,109,112,97,99,116,95,97,116,116,114,105,98,117,116,101,115,40,118,111,105,100,41,10,123,10,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,95,105,110,32,38,32,40,49,117,32,60,60,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,65,67,84,95,66,73,84,41,41,41,32,61,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,105,109,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,112,114,105,109,97,114,121,95,97,116,116,114,105,98,117,116,101,95,105,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,117,116,101,95,105,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,117,105,110,116,95,97,116,116,114,105,98,117,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,117,105,110,116,95,97,116,116,114,105,98,117,116,101,95,105,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,95,105,110,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,112,59,10,10,32,32,32,32,32,32,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,97,99,116,95,112,111,115,105,116,105,111,110,32,47,32,102,108,111,97,116,40,49,117,32,60,60,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,65,67,84,95,80,79,83,73,84,73,79,78,95,70,82,65,67,84,73,79,78,95,66,73,84,83,41,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,48,44,32,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,65,67,84,95,72,69,65,68,69,82,95,76,79,67,65,84,73,79,78,95,78,85,77,95,66,73,84,83,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,95,105,110,41,59,10,10,32,32,32,32,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,97,116,116,114,105,98,117,116,101,95,105,110,32,38,32,40,49,117,32,60,60,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,67,79,77,80,65,67,84,95,71,76,89,80,72,95,76,65,89,79,85,84,95,66,73,84,41,41,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,105,109,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,102,108,111,97,116,66,105,116,115,84,111,85,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,97,99,116,95,116,101,120,101,108,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,102,108,111,97,116,66,105,116,115,84,111,85,105,110,116,40,118,101,99,52,40,112,44,32,48,46,48,44,32,48,46,48,41,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,117,105,110,116,95,97,116,116,114,105,98,117,116,101,32,61,32,117,118,101,99,52,40,48,117,44,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,97,99,116,95,100,97,116,97,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,66,105,116,115,84,111,85,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,97,99,116,95,108,97,121,101,114,41,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,112,114,105,109,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,102,108,111,97,116,66,105,116,115,84,111,85,105,110,116,40,118,101,99,52,40,112,44,32,48,46,48,44,32,48,46,48,41,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,117,116,101,32,61,32,117,118,101,99,52,40,48,117,44,32,48,117,44,32,48,117,44,32,48,117,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,117,105,110,116,95,97,116,116,114,105,98,117,116,101,32,61,32,117,118,101,99,52,40,48,117,44,32,48,117,44,32,48,117,44,32,48,117,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,125,10,10,35,101,110,100,105,102,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_compact_attributes.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
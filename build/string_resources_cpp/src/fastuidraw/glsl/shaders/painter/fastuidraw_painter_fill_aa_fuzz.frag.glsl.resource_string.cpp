@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,105,108,108,95,97,97,95,102,117,122,122,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,102,105,108,108,95,97,97,95,102,117,122,122,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,41,10,123,10,32,32,47,42,32,116,104,101,32,118,101,114,116,101,120,32,115,104,97,100,101,114,32,109,97,100,101,32,116,104,101,32,113,117,97,100,32,101,120,97,99,116,108,121,32,116,119,111,45,112,105,120,101,108,115,10,32,32,32,32,32,119,105,100,101,32,97,110,100,32,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,32,103,111,101,115,32,102,114,111,109,32,45,49,32,116,111,32,49,44,32,116,104,117,115,10,32,32,32,32,32,49,32,45,32,97,98,115,40,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,41,32,105,115,32,116,104,101,32,101,120,97,99,116,32,118,97,108,117,101,10,32,32,32,32,32,110,101,101,100,101,100,32,102,111,114,32,99,111,118,101,114,97,103,101,32,97,110,100,32,119,101,32,104,97,118,101,32,110,111,32,110,101,101,100,32,116,111,32,100,105,118,105,100,101,10,32,32,32,32,32,98,121,32,100,101,114,105,118,97,116,105,118,101,32,109,97,103,110,105,116,117,100,101,115,32,116,111,32,110,111,114,109,97,108,105,122,101,32,99,111,114,114,101,99,116,108,121,46,10,32,32,32,42,47,10,32,32,102,108,111,97,116,32,97,108,112,104,97,59,10,32,32,97,108,112,104,97,32,61,32,49,46,48,32,45,32,97,98,115,40,102,97,115,116,117,105,100,114,97,119,95,97,97,95,102,117,122,122,41,59,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,97,108,112,104,97,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_fill_aa_fuzz.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
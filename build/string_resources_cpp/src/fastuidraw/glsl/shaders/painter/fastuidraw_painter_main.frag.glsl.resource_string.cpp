@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,109,97,105,110,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,78,80,65,67,75,95,65,84,95,70,82,65,71,77,69,78,84,95,83,72,65,68,69,82,10,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,59,10,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,59,10,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,68,85,65,76,95,83,82,67,95,66,76,69,78,68,10,32,32,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,48,44,32,105,110,100,101,120,32,61,32,48,41,32,111,117,116,32,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,48,59,10,32,32,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,48,44,32,105,110,100,101,120,32,61,32,49,41,32,111,117,116,32,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,49,59,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,83,73,78,71,76,69,95,83,82,67,95,66,76,69,78,68,41,10,32,32,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,111,117,116,32,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,59,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,70,82,65,77,69,66,85,70,70,69,82,95,70,69,84,67,72,41,10,32,32,108,97,121,111,117,116,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,105,110,111,117,116,32,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,59,10,35,101,110,100,105,102,10,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,72,87,95,67,76,73,80,95,80,76,65,78,69,83,10,10,32,32,118,111,105,100,10,32,32,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,118,111,105,100,41,10,32,32,123,125,10,10,35,101,108,115,101,10,10,32,32,118,111,105,100,10,32,32,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,118,111,105,100,41,10,32,32,123,10,32,32,32,32,47,42,32,104,97,114,100,119,97,114,101,32,99,108,105,112,112,105,110,103,32,105,115,32,115,108,105,103,104,116,108,121,32,100,105,102,102,101,114,101,110,116,32,105,110,32,111,117,116,112,117,116,32,40,111,110,32,71,69,78,32,97,116,108,101,97,115,116,41,10,32,32,32,32,32,32,32,116,104,97,116,32,117,115,105,110,103,32,100,105,115,99,97,114,100,32,115,116,121,108,101,32,99,108,105,112,112,105,110,103,46,32,84,104,101,32,99,97,117,115,101,32,105,115,32,98,101,99,97,117,115,101,32,104,97,114,100,119,97,114,101,10,32,32,32,32,32,32,32,99,108,105,112,112,105,110,103,32,99,104,97,110,103,101,115,32,119,104,97,116,32,103,101,111,109,101,116,114,121,32,105,115,32,114,97,115,116,101,114,105,122,101,100,32,116,111,32,116,104,101,32,99,108,105,112,32,112,108,97,110,101,115,10,32,32,32,32,32,32,32,119,104,101,114,101,32,97,115,32,100,105,115,99,97,114,100,32,115,116,121,108,101,32,101,118,97,108,117,97,116,101,115,32,116,104,101,32,118,97,108,117,101,32,97,116,32,97,32,115,97,109,112,108,101,32,112,111,105,110,116,10,32,32,32,32,32,32,32,97,110,100,32,116,104,101,32,118,97,108,117,101,32,105,115,32,105,110,116,101,114,112,111,108,97,116,101,100,32,102,114,111,109,32,116,104,101,32,118,101,114,116,105,99,101,115,46,32,73,110,32,101,120,97,99,116,32,97,114,105,116,104,101,109,97,116,105,99,10,32,32,32,32,32,32,32,116,104,101,121,32,97,114,101,32,116,104,101,32,115,97,109,101,44,32,98,117,116,32,119,101,32,100,111,32,110,111,116,32,104,97,118,101,32,101,120,97,99,116,32,97,114,105,116,104,109,97,116,105,99,46,32,87,101,32,102,117,100,103,101,10,32,32,32,32,32,32,32,116,104,101,32,99,108,105,112,32,118,97,108,117,101,32,98,121,32,101,112,115,105,108,111,110,32,119,104,105,99,104,32,105,115,32,115,101,116,32,116,111,32,116,104,101,32,119,105,100,116,104,32,111,102,32,104,97,108,102,32,97,10,32,32,32,32,32,32,32,112,105,120,101,108,32,40,114,101,99,97,108,108,32,116,104,101,32,99,108,105,112,112,105,110,103,32,101,113,117,97,116,105,111,110,115,32,97,114,101,32,97,108,114,101,97,100,121,32,105,110,32,99,108,105,112,32,99,111,111,114,100,105,110,97,116,101,115,41,46,10,32,32,32,32,32,42,47,10,32,32,32,32,102,108,111,97,116,32,101,112,115,105,108,111,110,32,61,32,48,46,53,32,42,32,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,114,101,99,105,112,95,112,105,120,101,108,115,95,109,97,103,110,105,116,117,100,101,59,10,32,32,32,32,105,102,32,40,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,48,32,60,32,101,112,115,105,108,111,110,32,124,124,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,49,32,60,32,101,112,115,105,108,111,110,10,32,32,32,32,32,32,32,124,124,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,50,32,60,32,101,112,115,105,108,111,110,32,32,124,124,32,102,97,115,116,117,105,100,114,97,119,95,99,108,105,112,95,112,108,97,110,101,51,32,60,32,101,112,115,105,108,111,110,41,10,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,125,10,32,32,125,10,10,35,101,110,100,105,102,10,10,118,111,105,100,10,109,97,105,110,40,118,111,105,100,41,10,123,10,32,32,118,101,99,52,32,99,44,32,98,44,32,118,59,10,10,32,32,97,112,112,108,121,95,99,108,105,112,112,105,110,103,40,41,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,78,80,65,67,75,95,65,84,95,70,82,65,71,77,69,78,84,95,83,72,65,68,69,82,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,104,97,100,101,114,95,104,101,97,100,101,114,32,104,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,104,101,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,104,101,97,100,101,114,95,118,97,114,121,105,110,103,44,32,104,41,59,10,10,32,32,32,32,32,32,104,46,105,116,101,109,95,115,104,97,100,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,115,104,97,100,101,114,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,115,104,97,100,101,114,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,104,46,105,116,101,109,95,98,108,101,110,100,95,115,104,97,100,101,114,95,112,97,99,107,101,100,41,59,10,10,32,32,32,32,32,32,104,46,98,108,101,110,100,95,115,104,97,100,101,114,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,104,46,105,116,101,109,95,98,108,101,110,100,95,115,104,97,100,101,114,95,112,97,99,107,101,100,41,59,10,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,32,61,32,104,46,105,116,101,109,95,115,104,97,100,101,114,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,61,32,104,46,105,116,101,109,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,32,61,32,104,46,98,108,101,110,100,95,115,104,97,100,101,114,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,32,61,32,104,46,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,10,32,32,32,32,32,32,117,105,110,116,32,98,114,117,115,104,95,100,97,116,97,95,108,111,99,59,10,32,32,32,32,32,32,98,114,117,115,104,95,100,97,116,97,95,108,111,99,32,61,32,104,46,98,114,117,115,104,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,98,114,117,115,104,95,117,110,112,97,99,107,95,118,97,108,117,101,115,40,104,46,98,114,117,115,104,95,115,104,97,100,101,114,44,32,98,114,117,115,104,95,100,97,116,97,95,108,111,99,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,111,115,105,116,105,111,110,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,98,114,117,115,104,95,112,95,121,41,59,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,66,69,71,73,78,95,65,85,88,95,76,79,67,75,59,10,32,32,99,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,102,114,97,103,95,115,104,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,44,32,102,97,115,116,117,105,100,114,97,119,95,102,114,97,103,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,69,78,68,95,65,85,88,95,76,79,67,75,59,10,10,32,32,98,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,98,114,117,115,104,95,99,111,108,111,114,40,41,59,10,32,32,118,32,61,32,98,32,42,32,99,59,10,32,32,118,46,114,103,98,32,42,61,32,118,46,97,59,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,68,85,65,76,95,83,82,67,95,66,76,69,78,68,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,44,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,118,44,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,48,44,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,49,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,83,73,78,71,76,69,95,83,82,67,95,66,76,69,78,68,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,44,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,118,44,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,66,76,69,78,68,95,70,82,65,77,69,66,85,70,70,69,82,95,70,69,84,67,72,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,52,32,105,110,95,102,98,44,32,111,117,116,95,102,98,59,10,32,32,32,32,32,32,105,110,95,102,98,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,117,110,95,98,108,101,110,100,95,115,104,97,100,101,114,40,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,44,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,115,104,97,100,101,114,95,100,97,116,97,95,108,111,99,97,116,105,111,110,44,32,118,44,32,105,110,95,102,98,44,32,111,117,116,95,102,98,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,102,105,110,97,108,95,99,111,108,111,114,32,61,32,111,117,116,95,102,98,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_main.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,114,111,117,110,100,101,100,95,114,101,99,116,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,114,111,117,110,100,101,100,95,114,101,99,116,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,47,42,32,84,104,101,32,115,97,109,101,32,115,111,117,114,99,101,32,105,115,32,117,115,101,100,32,98,121,32,98,111,116,104,32,116,104,101,32,105,116,101,109,32,115,104,97,100,101,114,32,97,110,100,10,32,42,32,116,104,101,32,99,108,105,112,32,115,104,97,100,101,114,32,111,102,32,80,97,105,110,116,101,114,82,111,117,110,100,101,100,82,101,99,116,83,104,97,100,101,114,44,32,116,104,117,115,32,97,108,108,10,32,42,32,99,111,100,101,32,105,115,32,119,105,116,104,105,110,32,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,41,32,115,111,32,116,104,97,116,32,116,104,101,10,32,42,32,117,98,101,114,45,115,104,97,100,101,114,32,100,111,101,115,32,110,111,116,32,103,101,116,32,100,117,112,108,105,99,97,116,101,32,102,117,110,99,116,105,111,110,32,100,101,102,105,110,105,116,105,111,110,115,46,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,41,10,123,10,32,32,118,101,99,50,32,112,44,32,104,97,108,102,95,115,105,122,101,44,32,114,97,100,105,105,44,32,113,59,10,32,32,102,108,111,97,116,32,100,59,10,10,32,32,112,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,121,41,59,10,32,32,104,97,108,102,95,115,105,122,101,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,104,97,108,102,95,119,105,100,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,104,97,108,102,95,104,101,105,103,104,116,41,59,10,10,32,32,105,102,32,40,112,46,121,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,97,100,105,105,32,61,32,40,112,46,120,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,105,110,120,95,109,105,110,121,95,114,120,44,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,105,110,120,95,109,105,110,121,95,114,121,41,32,58,10,32,32,32,32,32,32,32,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,97,120,120,95,109,105,110,121,95,114,120,44,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,97,120,120,95,109,105,110,121,95,114,121,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,97,100,105,105,32,61,32,40,112,46,120,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,105,110,120,95,109,97,120,121,95,114,120,44,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,105,110,120,95,109,97,120,121,95,114,121,41,32,58,10,32,32,32,32,32,32,32,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,97,120,120,95,109,97,120,121,95,114,120,44,32,102,97,115,116,117,105,100,114,97,119,95,114,111,117,110,100,101,100,95,114,101,99,116,95,109,97,120,120,95,109,97,120,121,95,114,121,41,59,10,32,32,32,32,125,10,10,32,32,47,42,32,100,32,105,115,32,97,110,32,97,112,112,114,111,120,105,109,97,116,105,111,110,32,111,102,32,116,104,101,32,115,105,103,110,101,100,32,100,105,115,116,97,110,99,101,44,32,105,110,32,105,116,101,109,10,32,32,32,42,32,99,111,111,114,100,105,110,97,116,101,115,44,32,116,111,32,116,104,101,32,98,111,117,110,100,97,114,121,32,111,102,32,116,104,101,32,114,111,117,110,100,101,100,32,114,101,99,116,32,119,105,116,104,10,32,32,32,42,32,110,101,103,97,116,105,118,101,32,118,97,108,117,101,115,32,105,110,115,105,100,101,59,32,113,32,105,115,32,116,104,101,32,100,105,115,116,97,110,99,101,32,116,111,32,116,104,101,32,115,105,100,101,115,10,32,32,32,42,32,111,102,32,116,104,101,32,114,101,99,116,44,32,112,111,115,105,116,105,118,101,32,105,110,115,105,100,101,46,10,32,32,32,42,47,10,32,32,113,32,61,32,104,97,108,102,95,115,105,122,101,32,45,32,97,98,115,40,112,41,59,10,32,32,105,102,32,40,114,97,100,105,105,46,120,32,62,32,48,46,48,32,38,38,32,114,97,100,105,105,46,121,32,62,32,48,46,48,32,38,38,32,113,46,120,32,60,32,114,97,100,105,105,46,120,32,38,38,32,113,46,121,32,60,32,114,97,100,105,105,46,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,101,44,32,103,114,97,100,59,10,32,32,32,32,32,32,102,108,111,97,116,32,76,59,10,10,32,32,32,32,32,32,47,42,32,105,110,32,116,104,101,32,99,111,114,110,101,114,32,114,101,103,105,111,110,59,32,116,104,101,32,98,111,117,110,100,97,114,121,32,105,115,32,116,104,101,32,101,108,108,105,112,115,101,10,32,32,32,32,32,32,32,42,32,124,124,101,124,124,32,61,32,49,32,119,104,101,114,101,32,101,32,61,32,40,114,97,100,105,105,32,45,32,113,41,32,47,32,114,97,100,105,105,46,32,84,104,101,32,100,105,115,116,97,110,99,101,10,32,32,32,32,32,32,32,42,32,105,115,32,97,112,112,114,111,120,105,109,97,116,101,100,32,98,121,32,116,104,101,32,102,105,114,115,116,32,111,114,100,101,114,32,101,115,116,105,109,97,116,101,10,32,32,32,32,32,32,32,42,32,40,124,124,101,124,124,32,45,32,49,41,32,47,32,124,124,103,114,97,100,32,124,124,101,124,124,32,124,124,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,101,32,61,32,40,114,97,100,105,105,32,45,32,113,41,32,47,32,114,97,100,105,105,59,10,32,32,32,32,32,32,76,32,61,32,108,101,110,103,116,104,40,101,41,59,10,32,32,32,32,32,32,103,114,97,100,32,61,32,101,32,47,32,40,114,97,100,105,105,32,42,32,109,97,120,40,76,44,32,49,101,45,54,41,41,59,10,32,32,32,32,32,32,100,32,61,32,40,76,32,45,32,49,46,48,41,32,47,32,109,97,120,40,108,101,110,103,116,104,40,103,114,97,100,41,44,32,49,101,45,54,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,100,32,61,32,109,97,120,40,45,113,46,120,44,32,45,113,46,121,41,59,10,32,32,32,32,125,10,10,32,32,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,82,79,85,78,68,69,68,95,82,69,67,84,95,67,76,73,80,10,32,32,32,32,123,10,32,32,32,32,32,32,47,42,32,115,117,98,45,115,104,97,100,101,114,32,48,32,107,101,101,112,115,32,116,104,101,32,105,110,115,105,100,101,44,32,116,104,101,32,115,117,98,45,115,104,97,100,101,114,10,32,32,32,32,32,32,32,42,32,70,65,83,84,85,73,68,82,65,87,95,82,79,85,78,68,69,68,95,82,69,67,84,95,67,76,73,80,95,79,85,84,83,73,68,69,32,107,101,101,112,115,32,116,104,101,32,111,117,116,115,105,100,101,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,105,102,32,40,40,100,32,60,61,32,48,46,48,41,32,61,61,32,40,115,117,98,95,115,104,97,100,101,114,32,61,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,82,79,85,78,68,69,68,95,82,69,67,84,95,67,76,73,80,95,79,85,84,83,73,68,69,41,41,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,32,32,35,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,119,44,32,97,108,112,104,97,59,10,10,32,32,32,32,32,32,47,42,32,100,32,105,115,32,105,110,32,105,116,101,109,32,99,111,111,114,100,105,110,97,116,101,115,44,32,100,105,118,105,100,105,110,103,32,98,121,32,102,119,105,100,116,104,40,100,41,10,32,32,32,32,32,32,32,42,32,99,111,110,118,101,114,116,115,32,105,116,32,116,111,32,112,105,120,101,108,115,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,102,119,32,61,32,102,119,105,100,116,104,40,100,41,59,10,32,32,32,32,32,32,97,108,112,104,97,32,61,32,99,108,97,109,112,40,48,46,53,32,45,32,100,32,47,32,109,97,120,40,102,119,44,32,49,101,45,54,41,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,97,108,112,104,97,41,59,10,32,32,32,32,125,10,32,32,35,101,110,100,105,102,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_rounded_rect.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,115,116,114,111,107,101,95,117,116,105,108,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,98,97,115,101,10,123,10,32,32,102,108,111,97,116,32,100,59,32,47,47,100,105,115,116,97,110,99,101,32,97,116,32,99,117,114,114,101,110,116,32,118,101,114,116,101,120,10,32,32,102,108,111,97,116,32,115,59,32,47,47,110,101,103,97,116,105,118,101,32,105,102,32,99,117,114,114,101,110,116,32,118,101,114,116,101,120,32,105,110,32,115,107,105,112,32,100,97,115,104,32,105,110,116,101,114,118,97,108,44,32,112,111,115,105,116,105,118,101,32,105,102,32,105,110,32,100,114,97,119,32,100,97,115,104,32,105,110,116,101,114,118,97,108,10,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,59,32,47,47,105,110,116,101,114,118,97,108,32,105,100,32,111,102,32,100,97,115,104,32,105,110,116,101,114,102,97,99,101,32,119,104,101,114,101,32,99,117,114,114,101,110,116,32,118,101,114,116,101,120,32,108,111,99,97,116,101,100,10,32,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,105,110,116,101,114,118,97,108,95,101,110,100,59,32,47,47,98,101,103,105,110,32,97,110,100,32,101,110,100,105,110,103,32,111,102,32,105,110,116,101,114,118,97,108,10,32,32,117,105,110,116,32,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,59,10,125,59,10,10,115,116,114,117,99,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,101,100,103,101,95,101,120,116,101,110,100,10,123,10,32,32,98,111,111,108,32,105,115,95,101,110,100,95,111,102,95,101,100,103,101,59,32,32,47,47,116,114,117,101,32,105,102,32,97,110,100,32,111,110,108,121,32,105,102,32,99,117,114,114,101,110,116,32,118,101,114,116,101,120,32,105,115,32,97,116,32,116,104,101,32,101,110,100,32,111,102,32,116,104,101,32,101,100,103,101,10,32,32,102,108,111,97,116,32,101,100,103,101,95,108,101,110,103,116,104,59,32,47,47,108,101,110,103,116,104,32,111,102,32,101,100,103,101,10,32,32,98,111,111,108,32,104,97,115,95,99,97,112,115,59,10,10,32,32,102,108,111,97,116,32,100,50,59,32,47,47,100,105,115,116,97,110,99,101,32,111,102,32,111,116,104,101,114,32,118,101,114,116,101,120,10,32,32,102,108,111,97,116,32,115,50,59,32,47,47,110,101,103,97,116,105,118,101,32,105,102,32,111,116,104,101,114,32,118,101,114,116,101,120,32,105,110,32,115,107,105,112,32,100,97,115,104,32,105,110,116,101,114,118,97,108,44,32,112,111,115,105,116,105,118,101,32,105,102,32,105,110,32,100,114,97,119,32,100,97,115,104,32,105,110,116,101,114,118,97,108,10,32,32,105,110,116,32,105,110,116,101,114,118,97,108,95,105,100,50,59,32,47,47,105,110,116,101,114,118,97,108,32,105,100,32,111,102,32,100,97,115,104,32,105,110,116,101,114,102,97,99,101,32,119,104,101,114,101,32,111,116,104,101,114,32,118,101,114,116,101,120,32,108,111,99,97,116,101,100,10,32,32,102,108,111,97,116,32,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,44,32,105,110,116,101,114,118,97,108,95,101,110,100,50,59,32,47,47,98,101,103,105,110,32,97,110,100,32,101,110,100,105,110,103,32,111,102,32,105,110,116,101,114,118,97,108,10,10,32,32,117,105,110,116,32,115,116,114,111,107,105,110,103,95,98,105,116,115,59,32,47,47,115,116,114,111,107,105,110,103,32,98,105,116,45,109,97,115,107,115,32,116,104,97,116,32,102,114,97,103,32,115,104,97,100,101,114,32,119,105,108,108,32,117,115,101,10,32,32,102,108,111,97,116,32,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,59,32,47,47,115,116,114,111,107,105,110,103,32,100,105,115,116,97,110,99,101,32,118,97,108,117,101,32,116,111,32,112,97,115,115,32,116,111,32,102,114,97,103,45,115,104,97,100,101,114,10,32,32,102,108,111,97,116,32,101,100,103,101,95,100,105,115,116,97,110,99,101,95,115,116,97,114,116,44,32,101,100,103,101,95,100,105,115,116,97,110,99,101,95,101,110,100,59,32,47,47,115,116,114,111,107,105,110,103,32,98,101,103,105,110,47,101,110,100,32,100,105,115,116,97,110,99,101,32,116,111,32,112,97,115,115,32,116,111,32,102,114,97,103,32,115,104,97,100,101,114,10,32,32,98,111,111,108,32,101,120,116,101,110,100,95,101,100,103,101,59,32,47,47,32,116,114,117,101,32,105,102,32,101,100,103,101,32,115,104,111,117,108,100,32,98,101,32,101,120,116,101,110,100,101,100,32,111,110,32,116,104,101,32,99,117,114,114,101,110,116,32,118,101,114,116,101,120,32,115,105,100,101,10,32,32,98,111,111,108,32,101,120,116,101,110,100,95,111,112,112,111,115,105,116,101,95,101,100,103,101,59,32,47,47,116,114,117,101,32,105,102,32,101,100,103,101,32,115,104,111,117,108,100,32,98,101,32,101,120,116,101,110,100,101,100,32,111,110,32,116,104,101,32,111,116,104,101,114,32,118,101,114,116,101,120,32,115,105,100,101,10,32,32,98,111,111,108,32,99,111,108,108,97,112,115,101,59,10,125,59,10,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,101,100,103,101,95,115,116,97,114,116,32,48,10,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,101,100,103,101,95,101,110,100,32,32,32,49,10,10,47,42,10,32,42,32,82,101,116,117,114,110,115,32,102,97,108,115,101,32,105,102,32,116,104,101,32,101,110,116,105,114,101,32,105,115,32,119,105,116,104,105,110,32,97,32,115,107,105,112,32,105,110,116,101,114,118,97,108,46,10,32,42,47,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,104,101,108,112,101,114,95,118,101,114,116,95,98,97,115,101,40,105,110,32,102,108,111,97,116,32,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,115,116,114,111,107,101,95,112,97,114,97,109,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,98,97,115,101,32,111,117,116,95,100,97,116,97,41,10,123,10,32,32,111,117,116,95,100,97,116,97,46,100,32,61,32,100,59,10,32,32,111,117,116,95,100,97,116,97,46,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,32,61,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,32,43,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,95,110,117,109,95,98,108,111,99,107,115,41,59,10,32,32,111,117,116,95,100,97,116,97,46,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,111,117,116,95,100,97,116,97,46,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,95,100,97,116,97,46,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,95,100,97,116,97,46,105,110,116,101,114,118,97,108,95,105,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,95,100,97,116,97,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,44,32,111,117,116,95,100,97,116,97,46,105,110,116,101,114,118,97,108,95,101,110,100,41,59,10,125,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,104,101,108,112,101,114,95,118,101,114,116,95,101,120,116,101,110,100,95,101,100,103,101,40,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,115,116,114,111,107,101,95,112,97,114,97,109,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,105,115,95,101,100,103,101,95,101,110,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,108,111,97,116,32,101,100,103,101,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,98,111,111,108,32,104,97,115,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,98,97,115,101,32,98,97,115,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,101,100,103,101,95,101,120,116,101,110,100,32,101,120,116,101,110,100,95,101,100,103,101,41,10,123,10,32,32,101,120,116,101,110,100,95,101,100,103,101,46,105,115,95,101,110,100,95,111,102,95,101,100,103,101,32,61,32,105,115,95,101,100,103,101,95,101,110,100,59,10,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,108,101,110,103,116,104,32,61,32,101,100,103,101,95,108,101,110,103,116,104,59,10,32,32,101,120,116,101,110,100,95,101,100,103,101,46,104,97,115,95,99,97,112,115,32,61,32,104,97,115,95,99,97,112,115,59,10,10,32,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,32,61,32,40,101,120,116,101,110,100,95,101,100,103,101,46,105,115,95,101,110,100,95,111,102,95,101,100,103,101,41,32,63,10,32,32,32,32,98,97,115,101,46,100,32,45,32,101,100,103,101,95,108,101,110,103,116,104,58,10,32,32,32,32,98,97,115,101,46,100,32,43,32,101,100,103,101,95,108,101,110,103,116,104,59,10,10,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,50,32,61,32,102,97,115,116,117,105,100,114,97,119,95,99,111,109,112,117,116,101,95,105,110,116,101,114,118,97,108,40,98,97,115,101,46,100,97,115,104,95,112,97,116,116,101,114,110,95,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,116,111,116,97,108,95,108,101,110,103,116,104,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,102,105,114,115,116,95,105,110,116,101,114,118,97,108,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,112,97,114,97,109,115,46,110,117,109,98,101,114,95,105,110,116,101,114,118,97,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,105,100,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,44,32,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,101,110,100,50,41,59,10,10,32,32,105,102,32,40,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,105,100,50,32,61,61,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,105,100,32,38,38,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,105,100,32,33,61,32,45,49,41,10,32,32,32,32,123,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,98,105,116,115,32,61,32,117,105,110,116,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,59,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,99,111,108,108,97,112,115,101,32,61,32,40,101,120,116,101,110,100,95,101,100,103,101,46,115,50,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,101,100,103,101,32,61,32,102,97,108,115,101,59,10,10,32,32,32,32,32,32,105,102,32,40,33,105,115,95,101,100,103,101,95,101,110,100,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,115,116,97,114,116,32,61,32,98,97,115,101,46,100,59,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,101,110,100,32,61,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,115,116,97,114,116,32,61,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,59,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,101,110,100,32,61,32,98,97,115,101,46,100,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,98,105,116,115,32,61,32,48,117,59,10,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,99,111,108,108,97,112,115,101,32,61,32,102,97,108,115,101,59,10,32,32,32,32,32,32,105,102,32,40,101,120,116,101,110,100,95,101,100,103,101,46,115,50,32,60,32,48,46,48,32,38,38,32,101,120,116,101,110,100,95,101,100,103,101,46,104,97,115,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,111,112,112,111,115,105,116,101,95,101,100,103,101,32,61,32,116,114,117,101,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,105,102,32,40,33,101,120,116,101,110,100,95,101,100,103,101,46,105,115,95,101,110,100,95,111,102,95,101,100,103,101,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,101,110,100,59,10,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,115,116,97,114,116,32,61,32,40,98,97,115,101,46,115,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,100,59,10,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,101,110,100,32,61,32,40,101,120,116,101,110,100,95,101,100,103,101,46,115,50,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,50,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,98,97,115,101,46,115,32,60,32,48,46,48,32,38,38,32,101,120,116,101,110,100,95,101,100,103,101,46,104,97,115,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,98,97,115,101,46,100,32,45,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,101,100,103,101,32,61,32,116,114,117,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,98,97,115,101,46,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,101,100,103,101,32,61,32,102,97,108,115,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,99,108,97,109,112,95,105,110,116,101,114,118,97,108,95,98,101,103,105,110,59,10,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,115,116,97,114,116,32,61,32,40,101,120,116,101,110,100,95,101,100,103,101,46,115,50,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,105,110,116,101,114,118,97,108,95,101,110,100,50,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,100,50,59,10,10,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,100,103,101,95,100,105,115,116,97,110,99,101,95,101,110,100,32,61,32,40,98,97,115,101,46,115,32,60,32,48,46,48,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,100,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,98,97,115,101,46,115,32,60,32,48,46,48,32,38,38,32,101,120,116,101,110,100,95,101,100,103,101,46,104,97,115,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,98,97,115,101,46,100,32,43,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,101,100,103,101,32,61,32,116,114,117,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,98,97,115,101,46,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,120,116,101,110,100,95,101,100,103,101,46,101,120,116,101,110,100,95,101,100,103,101,32,61,32,102,97,108,115,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_stroke_util.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -25,9 +25,18 @@ include $(dir)/Rules.mk
 dir := $(d)/painter_clippath_test
 include $(dir)/Rules.mk
 
+dir := $(d)/painter_rounded_rect_test
+include $(dir)/Rules.mk
+
 dir := $(d)/painter_cells
 include $(dir)/Rules.mk
 
+dir := $(d)/dash_pattern_test
+include $(dir)/Rules.mk
+
+dir := $(d)/cpu_rasterizer_test
+include $(dir)/Rules.mk
+
 
 
 # Begin standard footer
@@ -628,6 +628,7 @@ init_gl(int w, int h)
         }
     }
 
+  glyph_atlas_options.worker(m_gl_worker);
   m_glyph_atlas = FASTUIDRAWnew gl::GlyphAtlasGL(glyph_atlas_options);
   m_glyph_cache = FASTUIDRAWnew GlyphCache(m_glyph_atlas);
   m_glyph_selector = FASTUIDRAWnew GlyphSelector(m_glyph_cache);
@@ -244,7 +244,8 @@ private:
     params
       .width(m_color_stop_atlas_width.m_value)
       .num_layers(m_color_stop_atlas_layers.m_value)
-      .delayed(false);
+      .delayed(false)
+      .worker(m_gl_worker);
 
     m_atlas = FASTUIDRAWnew gl::ColorStopAtlasGL(params);
 
@@ -442,7 +442,8 @@ private:
       .log2_index_tile_size(m_log2_index_tile_size.m_value)
       .log2_num_index_tiles_per_row_per_col(m_log2_num_index_tiles_per_row_per_col.m_value)
       .num_index_layers(m_num_index_layers.m_value)
-      .delayed(false);
+      .delayed(false)
+      .worker(m_gl_worker);
 
     m_atlas = FASTUIDRAWnew gl::ImageAtlasGL(params);
     m_slack.m_value = std::max(0, m_slack.m_value);
@@ -13,6 +13,8 @@ COMMON_DEMO_SOURCES := $(call filelist, generic_command_line.cpp colorstop_comma
 	PainterWidget.cpp cycle_value.cpp random.cpp read_dash_pattern.cpp \
 	egl_helper.cpp stream_holder.cpp)
 
+CORE_DEMO_SOURCES := $(call filelist, generic_command_line.cpp random.cpp)
+
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
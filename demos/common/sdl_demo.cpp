@@ -163,6 +163,7 @@ post_call(fastuidraw::c_string call_string_values,
 sdl_demo::
 sdl_demo(const std::string &about_text, bool dimensions_must_match_default_value):
   m_handle_events(true),
+  m_gl_worker(FASTUIDRAWnew fastuidraw::gl::GLContextWorker()),
   m_about(command_line_argument::tabs_to_spaces(command_line_argument::format_description_string("", about_text))),
   m_common_label("Screen and Context Option", *this),
   m_red_bits(8, "red_bits",
@@ -233,6 +234,11 @@ sdl_demo::
 {
   if (m_window)
     {
+      /* the GL objects released by the derived class are
+       * queued to be deleted, delete them while the GL
+       * context is still current.
+       */
+      m_gl_worker->execute_actions();
       m_ctx_egl = fastuidraw::reference_counted_ptr<egl_helper>();
       if (m_ctx)
         {
@@ -35,6 +35,7 @@
 #include <fastuidraw/util/math.hpp>
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/gl_binding.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 #include "ostream_utility.hpp"
 #include "generic_command_line.hpp"
@@ -108,6 +109,13 @@ protected:
 protected:
   bool m_handle_events;
 
+  /* GLContextWorker for the GL objects made by the demo,
+   * run by ~sdl_demo() after the derived class and its
+   * members are gone but while the GL context is still
+   * current.
+   */
+  fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_gl_worker;
+
 private:
 
   enum fastuidraw::return_code
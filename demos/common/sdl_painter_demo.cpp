@@ -287,6 +287,20 @@ sdl_painter_demo(const std::string &about_text,
                                *this),
   m_painter_number_pools(m_painter_params.number_pools(), "painter_number_pools",
                          "Number of GL object pools used by the painter", *this),
+  m_painter_use_persistent_mapped_buffers(m_painter_params.use_persistent_mapped_buffers(),
+                                          "painter_use_persistent_mapped_buffers",
+                                          "If true, the buffers of the GL object pools are mapped once "
+                                          "persistently and reused after a fence signals instead of "
+                                          "being mapped for each draw", *this),
+  m_painter_use_16bit_indices(m_painter_params.use_16bit_indices(),
+                              "painter_use_16bit_indices",
+                              "If true, each draw stores its indices as 16-bit values for as "
+                              "long as its attributes number at most 65536", *this),
+  m_painter_use_compact_attributes(m_painter_params.use_compact_attributes(),
+                                   "painter_use_compact_attributes",
+                                   "If true, glyph quads and fill triangles are packed with "
+                                   "positions quantized to 1/8 of a unit in a smaller vertex "
+                                   "format when their values fit", *this),
   m_painter_break_on_shader_change(m_painter_params.break_on_shader_change(),
                                    "painter_break_on_shader_change",
                                    "If true, different shadings are placed into different "
@@ -319,6 +333,11 @@ sdl_painter_demo(const std::string &about_text,
                  "to which the Painter will draw, the value indicates the number of samples "
                  "to use for the backing store",
                  *this),
+  m_painter_program_binary_cache("", "painter_program_binary_cache",
+                                 "If non-empty, directory in which to cache the program "
+                                 "binaries of the uber-shaders of the PainterBackendGL, "
+                                 "the directory must already exist",
+                                 *this),
 
   m_painter_options_affected_by_context("PainterBackendGL Options that can be overridden "
                                         "by version and extension supported by GL/GLES context",
@@ -466,7 +485,8 @@ init_gl(int w, int h)
     .log2_index_tile_size(m_log2_index_tile_size.m_value)
     .log2_num_index_tiles_per_row_per_col(m_log2_num_index_tiles_per_row_per_col.m_value)
     .num_index_layers(m_num_index_layers.m_value)
-    .delayed(m_image_atlas_delayed_upload.m_value);
+    .delayed(m_image_atlas_delayed_upload.m_value)
+    .worker(m_gl_worker);
   m_image_atlas = FASTUIDRAWnew fastuidraw::gl::ImageAtlasGL(m_image_atlas_params);
 
   fastuidraw::ivec3 texel_dims(m_texel_store_width.m_value, m_texel_store_height.m_value, m_texel_store_num_layers.m_value);
@@ -474,7 +494,8 @@ init_gl(int w, int h)
     .texel_store_dimensions(texel_dims)
     .number_floats(m_geometry_store_size.m_value)
     .alignment(m_geometry_store_alignment.m_value)
-    .delayed(m_glyph_atlas_delayed_upload.m_value);
+    .delayed(m_glyph_atlas_delayed_upload.m_value)
+    .worker(m_gl_worker);
 
   switch(m_glyph_geometry_backing_store_type.m_value.m_value)
     {
@@ -513,7 +534,8 @@ init_gl(int w, int h)
   m_colorstop_atlas_params
     .width(m_color_stop_atlas_width.m_value)
     .num_layers(m_color_stop_atlas_layers.m_value)
-    .delayed(m_color_stop_atlas_delayed_upload.m_value);
+    .delayed(m_color_stop_atlas_delayed_upload.m_value)
+    .worker(m_gl_worker);
 
   if (m_color_stop_atlas_use_optimal_width.m_value)
     {
@@ -546,10 +568,14 @@ init_gl(int w, int h)
     .image_atlas(m_image_atlas)
     .glyph_atlas(m_glyph_atlas)
     .colorstop_atlas(m_colorstop_atlas)
+    .worker(m_gl_worker)
     .attributes_per_buffer(m_painter_attributes_per_buffer.m_value)
     .indices_per_buffer(m_painter_indices_per_buffer.m_value)
     .data_blocks_per_store_buffer(m_painter_data_blocks_per_buffer.m_value)
     .number_pools(m_painter_number_pools.m_value)
+    .use_persistent_mapped_buffers(m_painter_use_persistent_mapped_buffers.m_value)
+    .use_16bit_indices(m_painter_use_16bit_indices.m_value)
+    .use_compact_attributes(m_painter_use_compact_attributes.m_value)
     .break_on_shader_change(m_painter_break_on_shader_change.m_value)
     .use_hw_clip_planes(m_use_hw_clip_planes.m_value)
     .vert_shader_use_switch(m_uber_vert_use_switch.m_value)
@@ -567,6 +593,12 @@ init_gl(int w, int h)
                                    fastuidraw::PainterStrokeShader::draws_solid_then_fuzz)
     .blend_type(m_blend_type.m_value.m_value);
 
+  if (!m_painter_program_binary_cache.m_value.empty())
+    {
+      m_painter_params
+        .program_binary_cache(FASTUIDRAWnew fastuidraw::gl::ProgramBinaryCache(m_painter_program_binary_cache.m_value.c_str()));
+    }
+
   m_backend = FASTUIDRAWnew fastuidraw::gl::PainterBackendGL(m_painter_params, m_painter_base_params);
   m_painter = FASTUIDRAWnew fastuidraw::Painter(m_backend);
   m_glyph_cache = FASTUIDRAWnew fastuidraw::GlyphCache(m_painter->glyph_atlas());
@@ -593,6 +625,9 @@ init_gl(int w, int h)
       LAZY(attributes_per_buffer);
       LAZY(indices_per_buffer);
       LAZY(number_pools);
+      LAZY_ENUM(use_persistent_mapped_buffers);
+      LAZY_ENUM(use_16bit_indices);
+      LAZY_ENUM(use_compact_attributes);
       LAZY_ENUM(break_on_shader_change);
       LAZY_ENUM(vert_shader_use_switch);
       LAZY_ENUM(frag_shader_use_switch);
@@ -610,7 +645,23 @@ init_gl(int w, int h)
       LAZY_ENUM(provide_auxiliary_image_buffer);
       std::cout << std::setw(40) << "alignment: " << std::setw(8) << m_backend->configuration_base().alignment()
                 << "  (requested " << m_painter_base_params.alignment()
-                << ")\n\n\n";
+                << ")\n";
+
+      for(unsigned int i = 0; i < fastuidraw::gl::PainterBackendGL::number_program_types; ++i)
+        {
+          enum fastuidraw::gl::PainterBackendGL::program_type_t tp;
+          fastuidraw::reference_counted_ptr<fastuidraw::gl::Program> pr;
+          std::ostringstream label;
+
+          tp = static_cast<enum fastuidraw::gl::PainterBackendGL::program_type_t>(i);
+          pr = m_backend->program(tp);
+          label << "program_build_time[" << i << "]: ";
+          std::cout << std::setw(40) << label.str() << std::setw(8)
+                    << pr->program_build_time()
+                    << ((pr->program_from_binary()) ? "  (from program binary)" : "  (compiled)")
+                    << "\n";
+        }
+      std::cout << "\n\n";
 
       #undef LAZY
       #undef LAZY_ENUM
@@ -96,6 +96,9 @@ private:
   command_line_argument_value<int> m_painter_attributes_per_buffer;
   command_line_argument_value<int> m_painter_indices_per_buffer;
   command_line_argument_value<int> m_painter_number_pools;
+  command_line_argument_value<bool> m_painter_use_persistent_mapped_buffers;
+  command_line_argument_value<bool> m_painter_use_16bit_indices;
+  command_line_argument_value<bool> m_painter_use_compact_attributes;
   command_line_argument_value<bool> m_painter_break_on_shader_change;
   command_line_argument_value<bool> m_uber_vert_use_switch;
   command_line_argument_value<bool> m_uber_frag_use_switch;
@@ -103,6 +106,7 @@ private:
   command_line_argument_value<bool> m_unpack_header_and_brush_in_frag_shader;
   command_line_argument_value<bool> m_separate_program_for_discard;
   command_line_argument_value<unsigned int> m_painter_msaa;
+  command_line_argument_value<std::string> m_painter_program_binary_cache;
 
   /* Painter params that can be overridden by properties of GL context
    */
@@ -0,0 +1,321 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/painter/painter.hpp>
+#include <fastuidraw/painter/painter_stroke_params.hpp>
+#include <fastuidraw/cpu_backend/painter_backend_recorder.hpp>
+#include <fastuidraw/cpu_backend/painter_rasterizer.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+
+using namespace fastuidraw;
+
+/* Records a scene with a cpu::PainterBackendRecorder, draws it
+ * with cpu::PainterRasterizer and checks the pixels of regions
+ * whose color is known from the scene. The image is also drawn
+ * with a single thread and must be identical to the image drawn
+ * with the threads of the rasterizer. Only the core library is
+ * used, so no GPU is needed.
+ */
+
+/* a rectangle of pixels, in the coordinates of the Painter
+ * (i.e. y = 0 is the top), that must all be the same color.
+ */
+class region_check
+{
+public:
+  region_check(const char *label, ivec2 min_pt, ivec2 max_pt, u8vec4 color):
+    m_label(label),
+    m_min(min_pt),
+    m_max(max_pt),
+    m_color(color)
+  {}
+
+  const char *m_label;
+  ivec2 m_min, m_max;
+  u8vec4 m_color;
+};
+
+class cpu_rasterizer_test:public command_line_register
+{
+public:
+  cpu_rasterizer_test(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  void
+  draw_scene(Painter &painter);
+
+  unsigned int
+  check_region(const cpu::PainterRasterizer &R, const region_check &C);
+
+  void
+  write_image(const cpu::PainterRasterizer &R);
+
+  command_line_argument_value<unsigned int> m_number_threads;
+  command_line_argument_value<unsigned int> m_tile_size;
+  command_line_argument_value<unsigned int> m_num_frames;
+  command_line_argument_value<unsigned int> m_tolerance;
+  command_line_argument_value<unsigned int> m_max_reported_failures;
+  command_line_argument_value<std::string> m_image;
+
+  unsigned int m_num_failures;
+};
+
+//////////////////////////////////
+// cpu_rasterizer_test methods
+cpu_rasterizer_test::
+cpu_rasterizer_test(void):
+  m_number_threads(0, "number_threads",
+                   "Number of threads of the rasterizer, 0 means to use "
+                   "std::thread::hardware_concurrency()", *this),
+  m_tile_size(64, "tile_size", "Size in pixels of the screen tiles", *this),
+  m_num_frames(10, "num_frames",
+               "Number of times to rasterize the scene for timing", *this),
+  m_tolerance(2, "tolerance",
+              "Maximum difference allowed per channel between the "
+              "rasterized and the expected colors", *this),
+  m_max_reported_failures(20, "max_reported_failures",
+                          "Maximum number of mismatched pixels to print", *this),
+  m_image("", "image",
+          "If non-empty, write the rasterized image to the named "
+          "file as a binary PPM", *this),
+  m_num_failures(0)
+{
+}
+
+void
+cpu_rasterizer_test::
+draw_scene(Painter &painter)
+{
+  PainterBrush brush;
+  PainterStrokeParams stroke;
+  Path triangle, line;
+
+  /* opaque red square with a half transparent blue square
+   * overlapping its bottom right corner
+   */
+  brush.pen(1.0f, 0.0f, 0.0f, 1.0f);
+  painter.draw_rect(PainterData(&brush), vec2(16.0f, 16.0f), vec2(64.0f, 64.0f));
+  brush.pen(0.0f, 0.0f, 1.0f, 0.5f);
+  painter.draw_rect(PainterData(&brush), vec2(48.0f, 48.0f), vec2(64.0f, 64.0f));
+
+  /* green triangle */
+  triangle << vec2(128.0f, 16.0f)
+           << vec2(240.0f, 16.0f)
+           << vec2(184.0f, 112.0f)
+           << Path::contour_end();
+  brush.pen(0.0f, 1.0f, 0.0f, 1.0f);
+  painter.fill_path(PainterData(&brush), triangle, PainterEnums::nonzero_fill_rule, false);
+
+  /* yellow rect clipped to a square */
+  painter.save();
+  painter.clipInRect(vec2(16.0f, 144.0f), vec2(64.0f, 64.0f));
+  brush.pen(1.0f, 1.0f, 0.0f, 1.0f);
+  painter.draw_rect(PainterData(&brush), vec2(0.0f, 128.0f), vec2(128.0f, 128.0f));
+  painter.restore();
+
+  /* magenta horizontal line stroked with width 8 */
+  line << vec2(144.0f, 176.0f)
+       << vec2(240.0f, 176.0f);
+  stroke.width(8.0f);
+  brush.pen(1.0f, 0.0f, 1.0f, 1.0f);
+  painter.stroke_path(PainterData(&brush, &stroke), line, false,
+                      PainterEnums::flat_caps, PainterEnums::bevel_joins, false);
+}
+
+unsigned int
+cpu_rasterizer_test::
+check_region(const cpu::PainterRasterizer &R, const region_check &C)
+{
+  c_array<const u8vec4> pixels(R.pixels());
+  ivec2 dims(R.dimensions());
+  unsigned int num_bad(0);
+
+  for(int y = C.m_min.y(); y < C.m_max.y(); ++y)
+    {
+      for(int x = C.m_min.x(); x < C.m_max.x(); ++x)
+        {
+          /* the image has y = 0 as the bottom row */
+          u8vec4 p(pixels[x + dims.x() * (dims.y() - 1 - y)]);
+          bool ok(true);
+
+          for(unsigned int c = 0; c < 4; ++c)
+            {
+              ok = ok && std::abs(int(p[c]) - int(C.m_color[c])) <= int(m_tolerance.m_value);
+            }
+
+          if (!ok)
+            {
+              ++num_bad;
+              ++m_num_failures;
+              if (m_num_failures <= m_max_reported_failures.m_value)
+                {
+                  std::cout << "\tMismatch in " << C.m_label << " at (" << x << ", " << y
+                            << "): got (" << int(p[0]) << ", " << int(p[1]) << ", "
+                            << int(p[2]) << ", " << int(p[3]) << ") expected ("
+                            << int(C.m_color[0]) << ", " << int(C.m_color[1]) << ", "
+                            << int(C.m_color[2]) << ", " << int(C.m_color[3]) << ")\n";
+                }
+            }
+        }
+    }
+  return num_bad;
+}
+
+void
+cpu_rasterizer_test::
+write_image(const cpu::PainterRasterizer &R)
+{
+  c_array<const u8vec4> pixels(R.pixels());
+  ivec2 dims(R.dimensions());
+  std::ofstream file(m_image.m_value.c_str(), std::ios::binary);
+
+  file << "P6\n" << dims.x() << " " << dims.y() << "\n255\n";
+  for(int y = dims.y() - 1; y >= 0; --y)
+    {
+      for(int x = 0; x < dims.x(); ++x)
+        {
+          u8vec4 p(pixels[x + dims.x() * y]);
+          file.write(reinterpret_cast<const char*>(&p[0]), 3);
+        }
+    }
+}
+
+int
+cpu_rasterizer_test::
+main(int argc, char **argv)
+{
+  if (argc == 2 && (std::string(argv[1]) == "-help"
+                    || std::string(argv[1]) == "--help"
+                    || std::string(argv[1]) == "-h"))
+    {
+      std::cout << "Rasterizes a recorded scene on the CPU and checks "
+                << "the pixels\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  ivec2 dims(256, 256);
+  cpu::PainterBackendRecorder::ConfigurationRecorder config;
+  reference_counted_ptr<cpu::PainterBackendRecorder> backend;
+  reference_counted_ptr<PainterBackend::Surface> surface;
+  reference_counted_ptr<Painter> painter;
+  cpu::PainterRasterizer::params params;
+
+  config
+    .glyph_atlas(FASTUIDRAWnew cpu::GlyphAtlasCPU(cpu::GlyphAtlasCPU::params()))
+    .image_atlas(FASTUIDRAWnew cpu::ImageAtlasCPU(cpu::ImageAtlasCPU::params()))
+    .colorstop_atlas(FASTUIDRAWnew cpu::ColorStopAtlasCPU(cpu::ColorStopAtlasCPU::params()));
+  backend = FASTUIDRAWnew cpu::PainterBackendRecorder(config, PainterBackend::ConfigurationBase());
+  surface = FASTUIDRAWnew cpu::PainterBackendRecorder::SurfaceRecorder(dims);
+  painter = FASTUIDRAWnew Painter(backend);
+
+  painter->begin(surface, true);
+  painter->transformation(float3x3(float_orthogonal_projection_params(0, dims.x(), dims.y(), 0)));
+  draw_scene(*painter);
+  painter->end();
+
+  params
+    .tile_size(m_tile_size.m_value)
+    .clear_color(vec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+  cpu::PainterRasterizer single(backend, cpu::PainterRasterizer::params(params).number_threads(1));
+  cpu::PainterRasterizer threaded(backend, params.number_threads(m_number_threads.m_value));
+  simple_time timer;
+  int64_t single_us, threaded_us;
+
+  timer.restart_us();
+  for(unsigned int i = 0; i < m_num_frames.m_value; ++i)
+    {
+      single.rasterize();
+    }
+  single_us = timer.restart_us();
+
+  for(unsigned int i = 0; i < m_num_frames.m_value; ++i)
+    {
+      threaded.rasterize();
+    }
+  threaded_us = timer.restart_us();
+
+  if (m_num_frames.m_value == 0)
+    {
+      single.rasterize();
+      threaded.rasterize();
+    }
+
+  if (!m_image.m_value.empty())
+    {
+      write_image(threaded);
+    }
+
+  /* the blue square has alpha 0.5, thus a premultiplied
+   * value of 128 (rounded) for blue and alpha blended
+   * with src-over onto red or white.
+   */
+  const region_check checks[] =
+    {
+      region_check("background", ivec2(0, 0), ivec2(12, 12), u8vec4(255, 255, 255, 255)),
+      region_check("background", ivec2(100, 200), ivec2(140, 256), u8vec4(255, 255, 255, 255)),
+      region_check("red square", ivec2(20, 20), ivec2(44, 44), u8vec4(255, 0, 0, 255)),
+      region_check("blue over red", ivec2(52, 52), ivec2(76, 76), u8vec4(128, 0, 128, 255)),
+      region_check("blue over white", ivec2(84, 84), ivec2(108, 108), u8vec4(128, 128, 255, 255)),
+      region_check("green triangle", ivec2(168, 24), ivec2(200, 56), u8vec4(0, 255, 0, 255)),
+      region_check("inside clip", ivec2(20, 148), ivec2(76, 204), u8vec4(255, 255, 0, 255)),
+      region_check("outside clip", ivec2(84, 132), ivec2(124, 252), u8vec4(255, 255, 255, 255)),
+      region_check("outside clip", ivec2(2, 212), ivec2(84, 252), u8vec4(255, 255, 255, 255)),
+      region_check("stroke", ivec2(148, 174), ivec2(236, 178), u8vec4(255, 0, 255, 255)),
+      region_check("beside stroke", ivec2(148, 184), ivec2(236, 196), u8vec4(255, 255, 255, 255)),
+    };
+
+  for(const region_check &C : checks)
+    {
+      unsigned int num_bad;
+
+      num_bad = check_region(threaded, C);
+      std::cout << C.m_label << ": " << num_bad << " mismatched pixels\n";
+    }
+
+  c_array<const u8vec4> a(single.pixels()), b(threaded.pixels());
+  unsigned int num_different(0);
+
+  for(unsigned int i = 0; i < a.size(); ++i)
+    {
+      if (a[i] != b[i])
+        {
+          ++num_different;
+        }
+    }
+  std::cout << "single thread vs threaded: " << num_different << " pixels differ\n";
+  m_num_failures += num_different;
+
+  if (m_num_frames.m_value > 0)
+    {
+      std::cout << "\nAverage time to rasterize: single thread = "
+                << double(single_us) / double(1000 * m_num_frames.m_value)
+                << " ms, threaded = "
+                << double(threaded_us) / double(1000 * m_num_frames.m_value)
+                << " ms\n";
+    }
+
+  std::cout << "\n" << ((m_num_failures == 0) ? "PASS" : "FAIL") << "\n";
+  return (m_num_failures == 0) ? 0 : -1;
+}
+
+int
+main(int argc, char **argv)
+{
+  cpu_rasterizer_test P;
+  return P.main(argc, argv);
+}
@@ -0,0 +1,465 @@
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cmath>
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_dashed_stroke_params.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+#include "cast_c_array.hpp"
+#include "random.hpp"
+
+using namespace fastuidraw;
+
+/* Checks PainterDashedStrokeParams::compute_interval(), i.e. the
+ * search of the tree built by PainterDashedStrokeParams::pack_data(),
+ * against a linear scan of the dash pattern that is the same search
+ * the shaders did before the dash pattern was packed as a tree. Only
+ * the core library is used, so no GPU is needed.
+ */
+
+class dash_pattern
+{
+public:
+  dash_pattern(unsigned int number_intervals, bool start_with_skip);
+
+  /* returns false if the static data packed disagrees with the pattern */
+  bool
+  pack(unsigned int alignment);
+
+  /* the search as the shaders did before packing as a tree */
+  float
+  linear_compute_interval(float in_distance, int *out_interval_id,
+                          float *out_interval_begin, float *out_interval_end) const;
+
+  float
+  tree_compute_interval(float in_distance, int *out_interval_id,
+                        float *out_interval_begin, float *out_interval_end) const
+  {
+    return PainterDashedStrokeParams::compute_interval(m_alignment, m_intervals,
+                                                       m_total_length, m_first_interval_start,
+                                                       in_distance, m_keys.size(),
+                                                       out_interval_id, out_interval_begin,
+                                                       out_interval_end);
+  }
+
+  float
+  total_length(void) const
+  {
+    return m_total_length;
+  }
+
+  const std::vector<float>&
+  keys(void) const
+  {
+    return m_keys;
+  }
+
+private:
+  PainterDashedStrokeParams m_params;
+  std::vector<float> m_keys;
+  float m_total_length, m_first_interval_start;
+
+  unsigned int m_alignment;
+  std::vector<generic_data> m_packed;
+  c_array<const generic_data> m_intervals;
+};
+
+class dash_pattern_test:public command_line_register
+{
+public:
+  dash_pattern_test(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  void
+  pattern_sizes(unsigned int alignment, std::set<unsigned int> &out_sizes);
+
+  unsigned int
+  check_pattern(unsigned int alignment, unsigned int number_intervals,
+                bool start_with_skip);
+
+  void
+  time_pattern(unsigned int alignment, unsigned int number_intervals);
+
+  bool
+  compare(const dash_pattern &P, float d, unsigned int alignment);
+
+  command_line_argument_value<unsigned int> m_alignment;
+  command_line_argument_value<unsigned int> m_tree_levels;
+  command_line_argument_value<unsigned int> m_num_samples;
+  command_line_argument_value<unsigned int> m_time_num_intervals;
+  command_line_argument_value<unsigned int> m_time_iterations;
+  command_line_argument_value<unsigned int> m_max_reported_failures;
+
+  unsigned int m_num_failures;
+};
+
+//////////////////////////////////
+// dash_pattern methods
+dash_pattern::
+dash_pattern(unsigned int number_intervals, bool start_with_skip):
+  m_total_length(0.0f),
+  m_alignment(0)
+{
+  std::vector<PainterDashedStrokeParams::DashPatternElement> elements;
+
+  /* PainterDashedStrokeParams packs a draw and skip interval for
+   * each element, thus number_intervals is made even.
+   */
+  FASTUIDRAWassert(number_intervals > 0 && (number_intervals & 1u) == 0u);
+  elements.resize(number_intervals / 2);
+  for(PainterDashedStrokeParams::DashPatternElement &E : elements)
+    {
+      /* non-zero lengths so that PainterDashedStrokeParams
+       * does not merge elements.
+       */
+      E.m_draw_length = random_value(0.25f, 4.0f);
+      E.m_space_length = random_value(0.25f, 4.0f);
+    }
+
+  if (start_with_skip)
+    {
+      elements.front().m_draw_length = 0.0f;
+    }
+
+  m_params.dash_pattern(cast_c_array(elements));
+
+  /* same running sum as PainterDashedStrokeParams
+   * so that the keys agree exactly.
+   */
+  for(const PainterDashedStrokeParams::DashPatternElement &E : elements)
+    {
+      m_total_length += E.m_draw_length;
+      m_keys.push_back(m_total_length);
+
+      m_total_length += E.m_space_length;
+      m_keys.push_back(m_total_length);
+    }
+  m_first_interval_start = (start_with_skip) ? 0.0f : -elements.front().m_draw_length;
+}
+
+bool
+dash_pattern::
+pack(unsigned int alignment)
+{
+  unsigned int start;
+
+  m_alignment = alignment;
+  m_packed.resize(m_params.data_size(alignment));
+  m_params.pack_data(alignment, cast_c_array(m_packed));
+
+  start = round_up_to_multiple(PainterDashedStrokeParams::stroke_static_data_size, alignment);
+  m_intervals = cast_c_array(m_packed).sub_array(start);
+
+  return m_packed[PainterDashedStrokeParams::stroke_total_length_offset].f == m_total_length
+    && m_packed[PainterDashedStrokeParams::stroke_first_interval_start_offset].f == m_first_interval_start
+    && m_packed[PainterDashedStrokeParams::stroke_number_intervals_offset].u == m_keys.size();
+}
+
+float
+dash_pattern::
+linear_compute_interval(float in_distance, int *out_interval_id,
+                        float *out_interval_begin, float *out_interval_end) const
+{
+  float fd, ff, d, lastd;
+
+  fd = std::floor(in_distance / m_total_length);
+  ff = m_total_length * fd;
+  d = in_distance - ff;
+  lastd = m_first_interval_start;
+
+  for(unsigned int i = 0, endi = m_keys.size(); i < endi; ++i)
+    {
+      if (d < m_keys[i])
+        {
+          *out_interval_begin = ff + lastd;
+          *out_interval_end = ff + m_keys[i];
+          *out_interval_id = int(i) + int(fd) * int(endi);
+          return (i & 1u) == 0u ? 1.0f : -1.0f;
+        }
+      lastd = m_keys[i];
+    }
+
+  *out_interval_id = -1;
+  *out_interval_begin = 0.0f;
+  *out_interval_end = 0.0f;
+  return -1.0f;
+}
+
+//////////////////////////////////
+// dash_pattern_test methods
+dash_pattern_test::
+dash_pattern_test(void):
+  m_alignment(0, "alignment",
+              "If non-zero, only check the given alignment (1 to 4) "
+              "of the data store, otherwise check alignments 1 to 4", *this),
+  m_tree_levels(4, "tree_levels",
+                "Number of levels of the search tree for which to check "
+                "dash patterns whose size straddle the point where the "
+                "tree becomes full", *this),
+  m_num_samples(2000, "num_samples",
+                "Number of random distances to check per dash pattern, in "
+                "addition to the distances at and next to each interval end", *this),
+  m_time_num_intervals(512, "time_num_intervals",
+                       "Number of intervals of the dash pattern used for timing, "
+                       "0 means to skip timing", *this),
+  m_time_iterations(1000000, "time_iterations",
+                    "Number of look ups to time for each search", *this),
+  m_max_reported_failures(20, "max_reported_failures",
+                          "Maximum number of mismatches to print", *this),
+  m_num_failures(0)
+{
+}
+
+void
+dash_pattern_test::
+pattern_sizes(unsigned int alignment, std::set<unsigned int> &out_sizes)
+{
+  unsigned int full_tree_keys(1);
+
+  /* sizes straddling each multiple of the alignment for the
+   * first few nodes, i.e. where the last node becomes padded
+   */
+  for(unsigned int n = 1; n <= alignment + 2; ++n)
+    {
+      for(int delta = -1; delta <= 1; ++delta)
+        {
+          out_sizes.insert(n * alignment + delta);
+        }
+    }
+
+  /* sizes straddling where each level of the tree becomes
+   * full, a tree with L full levels holds (N + 1)^L - 1 keys
+   */
+  for(unsigned int level = 1; level <= m_tree_levels.m_value; ++level)
+    {
+      full_tree_keys *= (alignment + 1);
+      for(int delta = -2; delta <= 2; ++delta)
+        {
+          out_sizes.insert(full_tree_keys - 1 + delta);
+        }
+    }
+
+  /* PainterDashedStrokeParams always packs an even number of intervals */
+  for(auto iter = out_sizes.begin(); iter != out_sizes.end();)
+    {
+      if (*iter == 0 || (*iter & 1u) != 0u)
+        {
+          iter = out_sizes.erase(iter);
+        }
+      else
+        {
+          ++iter;
+        }
+    }
+}
+
+bool
+dash_pattern_test::
+compare(const dash_pattern &P, float d, unsigned int alignment)
+{
+  float linear_r, tree_r;
+  int linear_id, tree_id;
+  float linear_begin, linear_end, tree_begin, tree_end;
+
+  linear_r = P.linear_compute_interval(d, &linear_id, &linear_begin, &linear_end);
+  tree_r = P.tree_compute_interval(d, &tree_id, &tree_begin, &tree_end);
+  if (linear_r == tree_r && linear_id == tree_id
+      && linear_begin == tree_begin && linear_end == tree_end)
+    {
+      return true;
+    }
+
+  ++m_num_failures;
+  if (m_num_failures <= m_max_reported_failures.m_value)
+    {
+      std::cout << "\tMismatch: alignment = " << alignment
+                << ", number_intervals = " << P.keys().size()
+                << ", distance = " << d
+                << "\n\t\tlinear: " << linear_r << ", id = " << linear_id
+                << ", [" << linear_begin << ", " << linear_end << "]"
+                << "\n\t\ttree:   " << tree_r << ", id = " << tree_id
+                << ", [" << tree_begin << ", " << tree_end << "]\n";
+    }
+  return false;
+}
+
+unsigned int
+dash_pattern_test::
+check_pattern(unsigned int alignment, unsigned int number_intervals,
+              bool start_with_skip)
+{
+  dash_pattern P(number_intervals, start_with_skip);
+  unsigned int num_checked(0);
+  float L;
+
+  if (!P.pack(alignment))
+    {
+      std::cout << "\tStatic data mismatch: alignment = " << alignment
+                << ", number_intervals = " << number_intervals << "\n";
+      ++m_num_failures;
+    }
+  L = P.total_length();
+
+  /* each interval end, where the search must go to the
+   * right child, and just on either side of it.
+   */
+  for(float key : P.keys())
+    {
+      for(int period = -1; period <= 1; ++period)
+        {
+          float d;
+
+          d = key + float(period) * L;
+          compare(P, d, alignment);
+          compare(P, std::nextafter(d, -2.0f * L), alignment);
+          compare(P, std::nextafter(d, 4.0f * L), alignment);
+          num_checked += 3;
+        }
+    }
+
+  compare(P, 0.0f, alignment);
+  ++num_checked;
+
+  for(unsigned int i = 0; i < m_num_samples.m_value; ++i, ++num_checked)
+    {
+      compare(P, random_value(-2.0f * L, 4.0f * L), alignment);
+    }
+
+  return num_checked;
+}
+
+void
+dash_pattern_test::
+time_pattern(unsigned int alignment, unsigned int number_intervals)
+{
+  dash_pattern P(number_intervals, false);
+  std::vector<float> distances(1024);
+  unsigned int mask(distances.size() - 1);
+  float linear_sum(0.0f), tree_sum(0.0f);
+  int64_t linear_us, tree_us;
+  simple_time timer;
+
+  P.pack(alignment);
+  for(float &d : distances)
+    {
+      d = random_value(0.0f, 4.0f * P.total_length());
+    }
+
+  timer.restart_us();
+  for(unsigned int i = 0; i < m_time_iterations.m_value; ++i)
+    {
+      int id;
+      float b, e;
+
+      linear_sum += P.linear_compute_interval(distances[i & mask], &id, &b, &e) * e;
+    }
+  linear_us = timer.restart_us();
+
+  for(unsigned int i = 0; i < m_time_iterations.m_value; ++i)
+    {
+      int id;
+      float b, e;
+
+      tree_sum += P.tree_compute_interval(distances[i & mask], &id, &b, &e) * e;
+    }
+  tree_us = timer.restart_us();
+
+  std::cout << "\talignment = " << alignment
+            << ", number_intervals = " << number_intervals
+            << ": linear = "
+            << 1000.0 * double(linear_us) / double(m_time_iterations.m_value)
+            << " ns, tree = "
+            << 1000.0 * double(tree_us) / double(m_time_iterations.m_value)
+            << " ns per look up";
+
+  /* the sums are printed so the look ups are not optimized away */
+  if (linear_sum != tree_sum)
+    {
+      std::cout << " (checksums differ: " << linear_sum
+                << " vs " << tree_sum << ")";
+      ++m_num_failures;
+    }
+  std::cout << "\n";
+}
+
+int
+dash_pattern_test::
+main(int argc, char **argv)
+{
+  unsigned int alignment_begin(1), alignment_end(5);
+
+  if (argc == 2 && (std::string(argv[1]) == "-help"
+                    || std::string(argv[1]) == "--help"
+                    || std::string(argv[1]) == "-h"))
+    {
+      std::cout << "Checks and times the tree search of dash patterns "
+                << "against a linear search\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  if (m_alignment.m_value != 0)
+    {
+      if (m_alignment.m_value > 4)
+        {
+          std::cout << "alignment must be 0 to 4\n";
+          return -1;
+        }
+      alignment_begin = m_alignment.m_value;
+      alignment_end = m_alignment.m_value + 1;
+    }
+
+  for(unsigned int alignment = alignment_begin; alignment < alignment_end; ++alignment)
+    {
+      std::set<unsigned int> sizes;
+      unsigned int num_checked(0), prev_failures(m_num_failures);
+
+      pattern_sizes(alignment, sizes);
+      for(unsigned int sz : sizes)
+        {
+          num_checked += check_pattern(alignment, sz, false);
+          num_checked += check_pattern(alignment, sz, true);
+        }
+
+      std::cout << "alignment = " << alignment << ": checked "
+                << sizes.size() * 2 << " patterns of sizes {";
+      for(unsigned int sz : sizes)
+        {
+          std::cout << " " << sz;
+        }
+      std::cout << " } with " << num_checked << " look ups, "
+                << m_num_failures - prev_failures << " mismatches\n";
+    }
+
+  if (m_time_num_intervals.m_value > 0)
+    {
+      unsigned int sz;
+
+      sz = std::max(2u, m_time_num_intervals.m_value & ~1u);
+      std::cout << "\nTiming " << m_time_iterations.m_value << " look ups:\n";
+      for(unsigned int alignment = alignment_begin; alignment < alignment_end; ++alignment)
+        {
+          time_pattern(alignment, sz);
+        }
+    }
+
+  std::cout << "\n" << ((m_num_failures == 0) ? "PASS" : "FAIL") << "\n";
+  return (m_num_failures == 0) ? 0 : -1;
+}
+
+int
+main(int argc, char **argv)
+{
+  dash_pattern_test P;
+  return P.main(argc, argv);
+}
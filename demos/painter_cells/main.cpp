@@ -335,10 +335,10 @@ add_single_image(const std::string &filename, std::vector<named_image> &dest)
 
       if (m_use_bindless.m_value)
         {
-          im = gl::ImageAtlasGL::create_bindless(image_data.width(),
-                                                 image_data.height(),
-                                                 image_data.num_mipmap_levels(),
-                                                 image_data);
+          im = m_image_atlas->create_bindless(image_data.width(),
+                                              image_data.height(),
+                                              image_data.num_mipmap_levels(),
+                                              image_data);
         }
 
       if (im)
@@ -592,6 +592,14 @@ draw_frame(void)
            << m_painter->query_stat(PainterPacker::num_generic_datas)
            << "\nHeaders: "
            << m_painter->query_stat(PainterPacker::num_headers)
+           << "\nDrawBreaks: "
+           << m_painter->query_stat(PainterPacker::num_draw_breaks)
+           << "\nAttribBytes: "
+           << m_painter->query_stat(PainterPacker::num_attribute_bytes)
+           << "\nIndexBytes: "
+           << m_painter->query_stat(PainterPacker::num_index_bytes)
+           << "\nCompactAttribs: "
+           << m_painter->query_stat(PainterPacker::num_compact_attributes)
            << "\n";
       if (!m_text_brush)
         {
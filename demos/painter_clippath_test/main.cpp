@@ -1,6 +1,9 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <vector>
+
+#include <fastuidraw/painter/simple_path.hpp>
 
 #include "sdl_painter_demo.hpp"
 #include "simple_time.hpp"
@@ -42,6 +45,29 @@ private:
       number_clip_modes
     };
 
+  /* how path1 and path2 are combined into a single
+   * region, no_combine means to draw them separately.
+   */
+  enum
+    {
+      no_combine,
+      union_combine,
+      intersection_combine,
+      xor_combine,
+      difference_combine,
+
+      number_combine_modes
+    };
+
+  /* how the combined region is made into the clipping */
+  enum
+    {
+      set_clip_route,
+      clip_in_out_route,
+
+      number_clip_routes
+    };
+
   enum
     {
       view_zoomer,
@@ -51,10 +77,48 @@ private:
       number_zoomers
     };
 
+  /* an element of a chain of clipInPath()/clipOutPath() calls */
+  class clip_element
+  {
+  public:
+    clip_element(const Path *path, unsigned int zoomer, bool clip_in):
+      m_path(path),
+      m_zoomer(zoomer),
+      m_clip_in(clip_in)
+    {}
+
+    const Path *m_path;
+    unsigned int m_zoomer;
+    bool m_clip_in;
+  };
+
+  /* The combined region as the union of disjoint pieces
+   * where each piece is a chain of clipInPath() and
+   * clipOutPath() calls.
+   */
+  typedef std::vector<std::vector<clip_element> > clip_pieces;
+
   void
   draw_element(const Path &path, unsigned int clip_mode, const vec4 &pen_color,
                const float3x3 &matrix);
 
+  SimplePath
+  transformed_simple_path(const SimplePath &path, unsigned int zoomer);
+
+  void
+  make_clip_pieces(clip_pieces &out_pieces);
+
+  void
+  make_stripes(const vec2 &p0, const vec2 &p1, Path &out_stripes);
+
+  void
+  fill_clip_pieces(const clip_pieces &pieces, const Path *extra_clip_in,
+                   const float3x3 &view_matrix, const PainterData &data,
+                   const vec2 &p0, const vec2 &p1);
+
+  void
+  draw_combined(const float3x3 &view_matrix);
+
   enum return_code
   load_path(Path &out_path, const std::string &file);
 
@@ -65,11 +129,16 @@ private:
   command_line_argument_value<std::string> m_path2_file;
 
   Path m_path1, m_path2;
+  SimplePath m_simple_path1, m_simple_path2;
 
   unsigned int m_path1_clip_mode, m_path2_clip_mode;
+  unsigned int m_combine_mode, m_clip_route;
+  bool m_nested_clip;
   unsigned int m_active_zoomer;
   vecN<PanZoomTrackerSDLEvent, number_zoomers> m_zoomers;
   vecN<std::string, number_clip_modes> m_clip_labels;
+  vecN<std::string, number_combine_modes> m_combine_labels;
+  vecN<std::string, number_clip_routes> m_clip_route_labels;
   vecN<std::string, number_zoomers> m_zoomer_labels;
 };
 
@@ -85,17 +154,34 @@ painter_clip_test():
                *this),
   m_path1_clip_mode(no_clip),
   m_path2_clip_mode(no_clip),
+  m_combine_mode(no_combine),
+  m_clip_route(set_clip_route),
+  m_nested_clip(false),
   m_active_zoomer(view_zoomer)
 {
   std::cout << "Controls:\n"
             << "\t1: cycle through clip modes for path1\n"
             << "\t2: cycle through clip modes for path2\n"
+            << "\t3: cycle through combining path1 and path2 into one region\n"
+            << "\t4: cycle between clipping to the combined region with setClip() "
+            << "or with clipInPath()/clipOutPath()\n"
+            << "\tn: toggle clipping the combined region further by stripes "
+            << "within a nested save()/restore()\n"
             << "\ts: cycle through active zoomer controls\n";
 
   m_clip_labels[clip_in] = "clip_in";
   m_clip_labels[clip_out] = "clip_out";
   m_clip_labels[no_clip] = "no_clip";
 
+  m_combine_labels[no_combine] = "no_combine";
+  m_combine_labels[union_combine] = "union";
+  m_combine_labels[intersection_combine] = "intersection";
+  m_combine_labels[xor_combine] = "xor";
+  m_combine_labels[difference_combine] = "difference";
+
+  m_clip_route_labels[set_clip_route] = "setClip";
+  m_clip_route_labels[clip_in_out_route] = "clipInPath/clipOutPath";
+
   m_zoomer_labels[view_zoomer] = "view_zoomer";
   m_zoomer_labels[path1_zoomer] = "path1_zoomer";
   m_zoomer_labels[path2_zoomer] = "path2_zoomer";
@@ -143,6 +229,18 @@ handle_event(const SDL_Event &ev)
           cycle_value(m_path2_clip_mode, ev.key.keysym.mod & (KMOD_SHIFT|KMOD_CTRL|KMOD_ALT), number_clip_modes);
           std::cout << "Path2 clip mode set to: " << m_clip_labels[m_path2_clip_mode] << "\n";
           break;
+        case SDLK_3:
+          cycle_value(m_combine_mode, ev.key.keysym.mod & (KMOD_SHIFT|KMOD_CTRL|KMOD_ALT), number_combine_modes);
+          std::cout << "Combine mode set to: " << m_combine_labels[m_combine_mode] << "\n";
+          break;
+        case SDLK_4:
+          cycle_value(m_clip_route, ev.key.keysym.mod & (KMOD_SHIFT|KMOD_CTRL|KMOD_ALT), number_clip_routes);
+          std::cout << "Clip route set to: " << m_clip_route_labels[m_clip_route] << "\n";
+          break;
+        case SDLK_n:
+          m_nested_clip = !m_nested_clip;
+          std::cout << "Nested clipping: " << std::boolalpha << m_nested_clip << "\n";
+          break;
         case SDLK_s:
           cycle_value(m_active_zoomer, ev.key.keysym.mod & (KMOD_SHIFT|KMOD_CTRL|KMOD_ALT), number_zoomers);
           std::cout << "Active zoomer set to: " << m_zoomer_labels[m_active_zoomer] << "\n";
@@ -192,7 +290,8 @@ make_paths(void)
               << Path::contour_end();
     }
 
-
+  m_simple_path1 = SimplePath(m_path1, PainterEnums::nonzero_fill_rule);
+  m_simple_path2 = SimplePath(m_path2, PainterEnums::nonzero_fill_rule);
 }
 
 
@@ -238,6 +337,188 @@ draw_element(const Path &path, unsigned int clip_mode, const vec4 &pen_color,
   m_painter->restore();
 }
 
+SimplePath
+painter_clip_test::
+transformed_simple_path(const SimplePath &path, unsigned int zoomer)
+{
+  const ScaleTranslate<float> &tr(m_zoomers[zoomer].transformation());
+  Path P;
+
+  /* the zoomers only scale by a positive factor and translate,
+   * so the orientation of the contours is unchanged.
+   */
+  for(unsigned int c = 0, endc = path.number_contours(); c < endc; ++c)
+    {
+      c_array<const vec2> pts(path.contour(c));
+      for(const vec2 &p : pts)
+        {
+          P << tr.apply_to_point(p);
+        }
+      P << Path::contour_end();
+    }
+  return SimplePath(P, PainterEnums::nonzero_fill_rule);
+}
+
+void
+painter_clip_test::
+make_clip_pieces(clip_pieces &out_pieces)
+{
+  clip_element in1(&m_path1, path1_zoomer, true), out1(&m_path1, path1_zoomer, false);
+  clip_element in2(&m_path2, path2_zoomer, true), out2(&m_path2, path2_zoomer, false);
+
+  out_pieces.clear();
+  switch(m_combine_mode)
+    {
+    default:
+      break;
+
+    case union_combine:
+      out_pieces.push_back({in1});
+      out_pieces.push_back({in2, out1});
+      break;
+
+    case intersection_combine:
+      out_pieces.push_back({in1, in2});
+      break;
+
+    case xor_combine:
+      out_pieces.push_back({in1, out2});
+      out_pieces.push_back({in2, out1});
+      break;
+
+    case difference_combine:
+      out_pieces.push_back({in1, out2});
+      break;
+    }
+}
+
+void
+painter_clip_test::
+make_stripes(const vec2 &p0, const vec2 &p1, Path &out_stripes)
+{
+  const unsigned int number_stripes(8);
+  float h;
+
+  h = (p1.y() - p0.y()) / float(2 * number_stripes);
+  for(unsigned int i = 0; i < number_stripes; ++i)
+    {
+      float y0(p0.y() + float(2 * i) * h), y1(y0 + h);
+
+      out_stripes << vec2(p0.x(), y0)
+                  << vec2(p1.x(), y0)
+                  << vec2(p1.x(), y1)
+                  << vec2(p0.x(), y1)
+                  << Path::contour_end();
+    }
+}
+
+void
+painter_clip_test::
+fill_clip_pieces(const clip_pieces &pieces, const Path *extra_clip_in,
+                 const float3x3 &view_matrix, const PainterData &data,
+                 const vec2 &p0, const vec2 &p1)
+{
+  /* the pieces are disjoint, so filling each piece
+   * fills the combined region exactly once.
+   */
+  for(const std::vector<clip_element> &piece : pieces)
+    {
+      m_painter->save();
+      for(const clip_element &E : piece)
+        {
+          m_painter->transformation(view_matrix * m_zoomers[E.m_zoomer].transformation().matrix3());
+          if (E.m_clip_in)
+            {
+              m_painter->clipInPath(*E.m_path, PainterEnums::nonzero_fill_rule);
+            }
+          else
+            {
+              m_painter->clipOutPath(*E.m_path, PainterEnums::nonzero_fill_rule);
+            }
+        }
+      m_painter->transformation(view_matrix);
+      if (extra_clip_in)
+        {
+          m_painter->clipInPath(*extra_clip_in, PainterEnums::nonzero_fill_rule);
+        }
+      m_painter->draw_rect(data, p0, p1 - p0);
+      m_painter->restore();
+    }
+}
+
+void
+painter_clip_test::
+draw_combined(const float3x3 &view_matrix)
+{
+  PainterBrush fill_brush, stripe_brush, overlay_brush;
+  vec2 p0, p1;
+
+  fill_brush.pen(0.0f, 0.0f, 1.0f, 1.0f);
+  stripe_brush.pen(1.0f, 1.0f, 1.0f, 1.0f);
+  overlay_brush.pen(1.0f, 1.0f, 0.0f, 0.5f);
+
+  /* bounding box of both paths in the coordinates of the view */
+  vec2 q0, q1;
+  const ScaleTranslate<float> &tr1(m_zoomers[path1_zoomer].transformation());
+  const ScaleTranslate<float> &tr2(m_zoomers[path2_zoomer].transformation());
+
+  p0 = tr1.apply_to_point(m_path1.tessellation()->bounding_box_min());
+  p1 = tr1.apply_to_point(m_path1.tessellation()->bounding_box_max());
+  q0 = tr2.apply_to_point(m_path2.tessellation()->bounding_box_min());
+  q1 = tr2.apply_to_point(m_path2.tessellation()->bounding_box_max());
+  for(unsigned int i = 0; i < 2; ++i)
+    {
+      p0[i] = t_min(p0[i], q0[i]);
+      p1[i] = t_max(p1[i], q1[i]);
+    }
+
+  Path stripes;
+  make_stripes(p0, p1, stripes);
+
+  if (m_clip_route == set_clip_route)
+    {
+      vecN<enum SimplePath::boolean_op_t, number_combine_modes> ops;
+      SimplePath region;
+
+      ops[union_combine] = SimplePath::union_op;
+      ops[intersection_combine] = SimplePath::intersection_op;
+      ops[xor_combine] = SimplePath::xor_op;
+      ops[difference_combine] = SimplePath::difference_op;
+      region = SimplePath(transformed_simple_path(m_simple_path1, path1_zoomer),
+                          transformed_simple_path(m_simple_path2, path2_zoomer),
+                          ops[m_combine_mode]);
+
+      m_painter->save();
+      m_painter->setClip(region);
+      m_painter->draw_rect(PainterData(&fill_brush), p0, p1 - p0);
+      if (m_nested_clip)
+        {
+          /* the nested setClip() is against the clipping at the
+           * last save(), i.e. the combined region, and the
+           * restore() brings the combined region back.
+           */
+          m_painter->save();
+          m_painter->setClip(SimplePath(stripes, PainterEnums::nonzero_fill_rule));
+          m_painter->draw_rect(PainterData(&stripe_brush), p0, p1 - p0);
+          m_painter->restore();
+          m_painter->draw_rect(PainterData(&overlay_brush), p0, p1 - p0);
+        }
+      m_painter->restore();
+    }
+  else
+    {
+      clip_pieces pieces;
+
+      make_clip_pieces(pieces);
+      fill_clip_pieces(pieces, nullptr, view_matrix, PainterData(&fill_brush), p0, p1);
+      if (m_nested_clip)
+        {
+          fill_clip_pieces(pieces, &stripes, view_matrix, PainterData(&stripe_brush), p0, p1);
+          fill_clip_pieces(pieces, nullptr, view_matrix, PainterData(&overlay_brush), p0, p1);
+        }
+    }
+}
+
 void
 painter_clip_test::
 draw_frame(void)
@@ -249,11 +530,18 @@ draw_frame(void)
   m = proj * m_zoomers[view_zoomer].transformation().matrix3();
   m_painter->transformation(m);
 
-  draw_element(m_path1, m_path1_clip_mode, vec4(1.0f, 0.0f, 0.0f, 1.0f),
-               m_zoomers[path1_zoomer].transformation().matrix3());
+  if (m_combine_mode == no_combine)
+    {
+      draw_element(m_path1, m_path1_clip_mode, vec4(1.0f, 0.0f, 0.0f, 1.0f),
+                   m_zoomers[path1_zoomer].transformation().matrix3());
 
-  draw_element(m_path2, m_path2_clip_mode, vec4(0.0f, 1.0f, 0.0f, 1.0f),
-               m_zoomers[path2_zoomer].transformation().matrix3());
+      draw_element(m_path2, m_path2_clip_mode, vec4(0.0f, 1.0f, 0.0f, 1.0f),
+                   m_zoomers[path2_zoomer].transformation().matrix3());
+    }
+  else
+    {
+      draw_combined(m);
+    }
 
   m_painter->end();
   glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/font_freetype.hpp>
 #include <fastuidraw/text/glyph_selector.hpp>
@@ -141,6 +142,9 @@ private:
   void
   init_glyph_draw(unsigned int I, GlyphRender renderer);
 
+  void
+  benchmark_glyph_cache_lookup(unsigned int I, GlyphRender renderer);
+
   float
   update_cts_params(void);
 
@@ -159,6 +163,8 @@ private:
   command_line_argument_value<float> m_render_pixel_size;
   command_line_argument_value<float> m_change_stroke_width_rate;
   command_line_argument_value<int> m_glyphs_per_painter_draw;
+  command_line_argument_value<int> m_glyph_cache_lookup_passes;
+  command_line_argument_value<std::string> m_render_data_cache_file;
 
   reference_counted_ptr<const FontFreeType> m_font;
 
@@ -218,10 +224,15 @@ init(unsigned int num_threads,
   /* Get all the glyphs */
   simple_time timer;
   std::vector<int> cnts;
+  int64_t generate_us;
+
   GlyphSetGenerator::generate(num_threads, renderer, font, face, m_glyphs, glyph_cache, cnts);
-  std::cout << "Took " << timer.elapsed()
-            << " ms to generate glyphs of type "
-            << renderer << "\n";
+  generate_us = std::max(timer.elapsed_us(), int64_t(1));
+  std::cout << "Took " << generate_us / 1000
+            << " ms to generate " << m_glyphs.size()
+            << " glyphs of type " << renderer << " ("
+            << 1e6 * static_cast<double>(m_glyphs.size()) / static_cast<double>(generate_us)
+            << " glyphs/s)\n";
   for(int i = 0; i < num_threads; ++i)
     {
       std::cout << "\tThread #" << i << " generated " << cnts[i] << " glyphs.\n";
@@ -457,6 +468,17 @@ painter_glyph_test(void):
   m_glyphs_per_painter_draw(10000, "glyphs_per_painter_draw",
                             "Number of glyphs to draw per Painter::draw_text call",
                             *this),
+  m_glyph_cache_lookup_passes(0, "glyph_cache_lookup_passes",
+                              "If draw_glyph_set is true and this is positive, "
+                              "time this many passes of looking up every glyph "
+                              "of the font in the GlyphCache, both one at a time "
+                              "and batched, and report the lookups per second",
+                              *this),
+  m_render_data_cache_file("", "render_data_cache_file",
+                           "If non-empty, name of a file in which to keep the "
+                           "generated distance field and curve pair glyph data "
+                           "across runs",
+                           *this),
   m_use_anisotropic_anti_alias(false),
   m_stroke_glyphs(false),
   m_fill_glyphs(false),
@@ -504,6 +526,22 @@ painter_glyph_test::
 create_and_add_font(void)
 {
   reference_counted_ptr<const FontBase> font;
+  FontFreeType::RenderParams render_params;
+
+  render_params
+    .distance_field_max_distance(m_max_distance.m_value)
+    .distance_field_pixel_size(m_distance_pixel_size.m_value)
+    .curve_pair_pixel_size(m_curve_pair_pixel_size.m_value);
+
+  if (!m_render_data_cache_file.m_value.empty())
+    {
+      reference_counted_ptr<GlyphRenderDataFileCache> cache;
+
+      cache = FASTUIDRAWnew GlyphRenderDataFileCache(m_render_data_cache_file.m_value.c_str());
+      std::cout << "Loaded " << cache->number_entries() << " glyphs from "
+                << cache->filename() << "\n";
+      render_params.render_data_file_cache(cache);
+    }
 
   if (!m_font_file.m_value.empty())
     {
@@ -511,20 +549,11 @@ create_and_add_font(void)
       gen = FASTUIDRAWnew FreeTypeFace::GeneratorMemory(m_font_file.m_value.c_str(), 0);
       if (gen->check_creation() == routine_success)
         {
-          font = FASTUIDRAWnew FontFreeType(gen,
-                                            FontFreeType::RenderParams()
-                                            .distance_field_max_distance(m_max_distance.m_value)
-                                            .distance_field_pixel_size(m_distance_pixel_size.m_value)
-                                            .curve_pair_pixel_size(m_curve_pair_pixel_size.m_value),
-                                            m_ft_lib);
+          font = FASTUIDRAWnew FontFreeType(gen, render_params, m_ft_lib);
         }
     }
 
-  add_fonts_from_path(m_font_path.m_value, m_ft_lib, m_glyph_selector,
-                      FontFreeType::RenderParams()
-                      .distance_field_max_distance(m_max_distance.m_value)
-                      .distance_field_pixel_size(m_distance_pixel_size.m_value)
-                      .curve_pair_pixel_size(m_curve_pair_pixel_size.m_value));
+  add_fonts_from_path(m_font_path.m_value, m_ft_lib, m_glyph_selector, render_params);
 
   if (!font)
     {
@@ -583,6 +612,10 @@ init_glyph_draw(unsigned int I, GlyphRender renderer)
                       m_font, m_glyph_cache, m_glyph_selector,
                       m_render_pixel_size.m_value, renderer,
                       m_glyphs_per_painter_draw.m_value);
+      if (m_glyph_cache_lookup_passes.m_value > 0)
+        {
+          benchmark_glyph_cache_lookup(I, renderer);
+        }
     }
   else if (m_use_file.m_value)
     {
@@ -601,6 +634,57 @@ init_glyph_draw(unsigned int I, GlyphRender renderer)
 }
 
 
+void
+painter_glyph_test::
+benchmark_glyph_cache_lookup(unsigned int I, GlyphRender renderer)
+{
+  std::vector<uint32_t> glyph_codes;
+  std::vector<Glyph> glyphs;
+  unsigned int num_passes(m_glyph_cache_lookup_passes.m_value);
+  simple_time timer;
+  int64_t single_us, batch_us;
+  double num_lookups;
+
+  for(const Glyph &g : m_draws[I].glyphs())
+    {
+      if (g.valid())
+        {
+          glyph_codes.push_back(g.layout().m_glyph_code);
+        }
+    }
+
+  if (glyph_codes.empty())
+    {
+      return;
+    }
+
+  glyphs.resize(glyph_codes.size());
+  timer.restart();
+  for(unsigned int pass = 0; pass < num_passes; ++pass)
+    {
+      for(unsigned int i = 0, endi = glyph_codes.size(); i < endi; ++i)
+        {
+          glyphs[i] = m_glyph_cache->fetch_glyph(renderer, m_font, glyph_codes[i]);
+        }
+    }
+  single_us = std::max(timer.restart_us(), int64_t(1));
+
+  for(unsigned int pass = 0; pass < num_passes; ++pass)
+    {
+      m_glyph_cache->fetch_glyphs(renderer, m_font,
+                                  cast_c_array(glyph_codes),
+                                  cast_c_array(glyphs));
+    }
+  batch_us = std::max(timer.restart_us(), int64_t(1));
+
+  num_lookups = static_cast<double>(num_passes) * static_cast<double>(glyph_codes.size());
+  std::cout << "GlyphCache lookup of " << glyph_codes.size() << " glyphs x "
+            << num_passes << " passes:\n"
+            << "\tfetch_glyph: " << 1e6 * num_lookups / static_cast<double>(single_us)
+            << " lookups/s\n"
+            << "\tfetch_glyphs: " << 1e6 * num_lookups / static_cast<double>(batch_us)
+            << " lookups/s\n";
+}
 
 void
 painter_glyph_test::
@@ -222,6 +222,12 @@ private:
   void
   update_cts_params(void);
 
+  void
+  select_edit_point(const vec2 &p);
+
+  void
+  edit_path_point(const vec2 &p);
+
   PanZoomTrackerSDLEvent&
   zoomer(void)
   {
@@ -443,6 +449,12 @@ private:
 
   Path m_clip_window_path;
   bool m_clip_window_path_dirty;
+
+  /* contour and point of the selected path that are dragged
+   * with ctrl-right mouse; m_edit_contour is -1 if none.
+   */
+  int m_edit_contour;
+  unsigned int m_edit_point;
 };
 
 ///////////////////////////////////
@@ -575,7 +587,9 @@ painter_stroke_test(void):
   m_fill_by_clipping(false),
   m_draw_grid(false),
   m_grid_path_dirty(true),
-  m_clip_window_path_dirty(true)
+  m_clip_window_path_dirty(true),
+  m_edit_contour(-1),
+  m_edit_point(0)
 {
   std::cout << "Controls:\n"
             << "\tn: toogle using arc-paths for stroking\n"
@@ -620,6 +634,8 @@ painter_stroke_test(void):
             << "\t3/4 : decrease/increase r1 of gradient(hold left-shift for slower rate and right shift for faster)\n"
             << "\tl: draw Painter stats\n"
             << "\tRight Mouse Draw: set p1(starting position bottom right) {drawn white with black inside} of gradient\n"
+            << "\tctrl-Right Mouse Drag: drag a point of a flat contour of the path, printing the time to\n"
+            << "\t\tupdate the fill of the path against the time to rebuild it\n"
             << "\tLeft Mouse Drag: pan\n"
             << "\tHold Left Mouse, then drag up/down: zoom out/in\n";
 
@@ -988,6 +1004,10 @@ handle_event(const SDL_Event &ev)
           {
             gradient_p0() = brush_item_coordinate(c);
           }
+        else if ((ev.motion.state & SDL_BUTTON(SDL_BUTTON_RIGHT)) && m_edit_contour >= 0)
+          {
+            edit_path_point(item_coordinates(c));
+          }
         else if (ev.motion.state & SDL_BUTTON(SDL_BUTTON_RIGHT))
           {
             gradient_p1() = brush_item_coordinate(c);
@@ -995,6 +1015,20 @@ handle_event(const SDL_Event &ev)
       }
       break;
 
+    case SDL_MOUSEBUTTONDOWN:
+      if (ev.button.button == SDL_BUTTON_RIGHT && (SDL_GetModState() & KMOD_CTRL))
+        {
+          select_edit_point(item_coordinates(ivec2(ev.button.x, ev.button.y)));
+        }
+      break;
+
+    case SDL_MOUSEBUTTONUP:
+      if (ev.button.button == SDL_BUTTON_RIGHT)
+        {
+          m_edit_contour = -1;
+        }
+      break;
+
     case SDL_KEYUP:
       switch(ev.key.keysym.sym)
         {
@@ -1299,6 +1333,99 @@ handle_event(const SDL_Event &ev)
     };
 }
 
+void
+painter_stroke_test::
+select_edit_point(const vec2 &p)
+{
+  float best_distance(-1.0f);
+
+  m_edit_contour = -1;
+  for(unsigned int c = 0, endc = path().number_contours(); c < endc; ++c)
+    {
+      reference_counted_ptr<const PathContour> contour(path().contour(c));
+
+      /* only flat contours can be rebuilt from their points */
+      if (!contour->ended() || !contour->is_flat())
+        {
+          continue;
+        }
+
+      for(unsigned int i = 0, endi = contour->number_points(); i < endi; ++i)
+        {
+          float d;
+
+          d = (contour->point(i) - p).magnitudeSq();
+          if (best_distance < 0.0f || d < best_distance)
+            {
+              best_distance = d;
+              m_edit_contour = c;
+              m_edit_point = i;
+            }
+        }
+    }
+
+  if (m_edit_contour < 0)
+    {
+      std::cout << "Path has no flat contour to edit\n";
+    }
+  else
+    {
+      std::cout << "Dragging point #" << m_edit_point
+                << " of contour #" << m_edit_contour << "\n";
+    }
+}
+
+void
+painter_stroke_test::
+edit_path_point(const vec2 &p)
+{
+  reference_counted_ptr<const PathContour> src;
+  reference_counted_ptr<PathContour> contour;
+  reference_counted_ptr<const TessellatedPath> tess;
+  simple_time timer;
+  uint64_t update_us, full_us, reused;
+
+  FASTUIDRAWassert(m_edit_contour >= 0);
+  src = path().contour(m_edit_contour);
+  contour = FASTUIDRAWnew PathContour();
+  for(unsigned int i = 0, endi = src->number_points(); i < endi; ++i)
+    {
+      vec2 q((i == m_edit_point) ? p : src->point(i));
+      if (i == 0)
+        {
+          contour->start(q);
+        }
+      else
+        {
+          contour->to_point(q);
+        }
+    }
+  contour->end();
+
+  /* Path::replace_contour() makes the next tessellation fill
+   * by sharing the data of the FilledPath of the current one.
+   */
+  m_paths[m_selected_path].m_path.replace_contour(m_edit_contour, contour);
+  m_clip_window_path_dirty = true;
+
+  tess = path().tessellation(-1.0f);
+  if (!tess->filled())
+    {
+      return;
+    }
+
+  update_us = tess->filled()->counter(FilledPath::update_time_us_counter);
+  reused = tess->filled()->counter(FilledPath::reused_subsets_counter);
+
+  timer.restart();
+  FilledPath full(*tess);
+  full_us = timer.elapsed_us();
+
+  std::cout << "Fill update: " << update_us << " us reusing " << reused
+            << " of " << tess->filled()->number_subsets() << " subsets, rebuild: "
+            << full_us << " us\n";
+}
+
 void
 painter_stroke_test::
 construct_paths(int w, int h)
@@ -1981,10 +2108,10 @@ derived_init(int w, int h)
         {
           if (m_use_bindless.m_value)
             {
-              m_image = gl::ImageAtlasGL::create_bindless(image_data.width(),
-                                                          image_data.height(),
-                                                          image_data.num_mipmap_levels(),
-                                                          image_data);
+              m_image = m_image_atlas->create_bindless(image_data.width(),
+                                                       image_data.height(),
+                                                       image_data.num_mipmap_levels(),
+                                                       image_data);
             }
 
           if (!m_image)
@@ -0,0 +1,316 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "sdl_painter_demo.hpp"
+#include "simple_time.hpp"
+#include "PanZoomTracker.hpp"
+#include "cycle_value.hpp"
+
+using namespace fastuidraw;
+
+/* Draws a grid of rounded rects either with the analytic
+ * rounded rect shaders (Painter::fill_rounded_rect(),
+ * Painter::clipInRoundedRect() and Painter::clipOutRoundedRect())
+ * or via an equivalent Path that is filled (or clipped against)
+ * with the tessellation based path filling. Giving num_frames
+ * runs a benchmark of the initial mode and reports the frame times.
+ */
+class painter_rounded_rect_test:public sdl_painter_demo
+{
+public:
+  painter_rounded_rect_test(void);
+
+protected:
+  void
+  derived_init(int, int);
+
+  void
+  draw_frame(void);
+
+  void
+  handle_event(const SDL_Event &ev);
+
+private:
+  enum
+    {
+      draw_fill,
+      draw_clip_in,
+      draw_clip_out,
+
+      number_draw_modes
+    };
+
+  void
+  make_path(void);
+
+  void
+  draw_element(unsigned int i, unsigned int j);
+
+  command_line_argument_value<int> m_count_x, m_count_y;
+  command_line_argument_value<float> m_rect_width, m_rect_height;
+  command_line_argument_value<float> m_radius_x, m_radius_y;
+  command_line_argument_value<float> m_spacing;
+  command_line_argument_value<bool> m_init_use_path;
+  command_line_argument_value<int> m_init_draw_mode;
+  command_line_argument_value<int> m_num_frames;
+  command_line_argument_value<int> m_skip_frames;
+
+  RoundedRect m_rounded_rect;
+  Path m_path;
+  bool m_use_path;
+  unsigned int m_draw_mode;
+  vecN<std::string, number_draw_modes> m_draw_mode_labels;
+
+  PanZoomTrackerSDLEvent m_zoomer;
+  simple_time m_time, m_benchmark_timer;
+  std::vector<uint64_t> m_frame_times;
+  int m_frame;
+};
+
+painter_rounded_rect_test::
+painter_rounded_rect_test(void):
+  m_count_x(20, "count_x", "number of rounded rects in each row", *this),
+  m_count_y(20, "count_y", "number of rounded rects in each column", *this),
+  m_rect_width(40.0f, "rect_width", "width of each rounded rect", *this),
+  m_rect_height(30.0f, "rect_height", "height of each rounded rect", *this),
+  m_radius_x(10.0f, "radius_x", "x-radius of the corners of each rounded rect", *this),
+  m_radius_y(8.0f, "radius_y", "y-radius of the corners of each rounded rect", *this),
+  m_spacing(5.0f, "spacing", "space between adjacent rounded rects", *this),
+  m_init_use_path(false, "init_use_path",
+                  "If true, initialize to draw and clip via a Path "
+                  "instead of the analytic rounded rect shaders",
+                  *this),
+  m_init_draw_mode(draw_fill, "init_draw_mode",
+                   "Initial draw mode: 0 = fill, 1 = clip-in, 2 = clip-out",
+                   *this),
+  m_num_frames(-1, "num_frames",
+               "If positive, then run demo in benchmark mode terminating after the given number of frames",
+               *this),
+  m_skip_frames(1, "num_skip_frames",
+                "If num_frames > 0, then gives the number of frames to ignore in benchmarking",
+                *this),
+  m_use_path(false),
+  m_draw_mode(draw_fill),
+  m_frame(0)
+{
+  std::cout << "Controls:\n"
+            << "\tp: toggle between analytic rounded rects and Path rounded rects\n"
+            << "\tm: cycle through draw modes (fill, clip-in, clip-out)\n";
+
+  m_draw_mode_labels[draw_fill] = "fill";
+  m_draw_mode_labels[draw_clip_in] = "clip_in";
+  m_draw_mode_labels[draw_clip_out] = "clip_out";
+}
+
+void
+painter_rounded_rect_test::
+handle_event(const SDL_Event &ev)
+{
+  m_zoomer.handle_event(ev);
+  switch(ev.type)
+    {
+    case SDL_WINDOWEVENT:
+      if (ev.window.event == SDL_WINDOWEVENT_RESIZED)
+        {
+          on_resize(ev.window.data1, ev.window.data2);
+        }
+      break;
+
+    case SDL_QUIT:
+      end_demo(0);
+      break;
+
+    case SDL_KEYUP:
+      switch(ev.key.keysym.sym)
+        {
+        case SDLK_ESCAPE:
+          end_demo(0);
+          break;
+        case SDLK_p:
+          m_use_path = !m_use_path;
+          std::cout << "Use path set to: " << m_use_path << "\n";
+          break;
+        case SDLK_m:
+          cycle_value(m_draw_mode, ev.key.keysym.mod & (KMOD_SHIFT|KMOD_CTRL|KMOD_ALT), number_draw_modes);
+          std::cout << "Draw mode set to: " << m_draw_mode_labels[m_draw_mode] << "\n";
+          break;
+        }
+      break;
+    };
+}
+
+void
+painter_rounded_rect_test::
+make_path(void)
+{
+  /* the same rounded rect as m_rounded_rect with each corner
+   * realized as a cubic approximating a quarter ellipse.
+   */
+  const float kappa(0.5522847498f);
+  vec2 p0(m_rounded_rect.m_min_point), p1(m_rounded_rect.m_max_point);
+  vec2 r(m_rounded_rect.sanitized().m_corner_radii[RoundedRect::minx_miny_corner]);
+  vec2 k(kappa * r);
+
+  m_path << vec2(p0.x() + r.x(), p0.y())
+         << vec2(p1.x() - r.x(), p0.y())
+         << Path::control_point(p1.x() - r.x() + k.x(), p0.y())
+         << Path::control_point(p1.x(), p0.y() + r.y() - k.y())
+         << vec2(p1.x(), p0.y() + r.y())
+         << vec2(p1.x(), p1.y() - r.y())
+         << Path::control_point(p1.x(), p1.y() - r.y() + k.y())
+         << Path::control_point(p1.x() - r.x() + k.x(), p1.y())
+         << vec2(p1.x() - r.x(), p1.y())
+         << vec2(p0.x() + r.x(), p1.y())
+         << Path::control_point(p0.x() + r.x() - k.x(), p1.y())
+         << Path::control_point(p0.x(), p1.y() - r.y() + k.y())
+         << vec2(p0.x(), p1.y() - r.y())
+         << vec2(p0.x(), p0.y() + r.y())
+         << Path::control_point(p0.x(), p0.y() + r.y() - k.y())
+         << Path::control_point(p0.x() + r.x() - k.x(), p0.y())
+         << Path::contour_end();
+}
+
+void
+painter_rounded_rect_test::
+derived_init(int, int)
+{
+  m_use_path = m_init_use_path.m_value;
+  m_draw_mode = t_min(static_cast<unsigned int>(t_max(0, m_init_draw_mode.m_value)),
+                      static_cast<unsigned int>(number_draw_modes - 1));
+
+  m_rounded_rect = RoundedRect(vec2(0.0f, 0.0f),
+                               vec2(m_rect_width.m_value, m_rect_height.m_value),
+                               vec2(m_radius_x.m_value, m_radius_y.m_value));
+  make_path();
+
+  m_frame = -m_skip_frames.m_value;
+  if (m_num_frames.m_value > 0)
+    {
+      m_frame_times.reserve(m_num_frames.m_value);
+      std::cout << "Benchmarking mode " << m_draw_mode_labels[m_draw_mode]
+                << " via " << ((m_use_path) ? "Path" : "RoundedRect") << "\n";
+    }
+}
+
+void
+painter_rounded_rect_test::
+draw_element(unsigned int i, unsigned int j)
+{
+  PainterBrush brush;
+  vec2 sz(m_rect_width.m_value, m_rect_height.m_value);
+  vec2 p(static_cast<float>(i), static_cast<float>(j));
+
+  brush.pen(p.x() / static_cast<float>(m_count_x.m_value),
+            p.y() / static_cast<float>(m_count_y.m_value),
+            1.0f, 1.0f);
+
+  m_painter->save();
+  m_painter->translate(p * (sz + vec2(m_spacing.m_value)));
+  switch(m_draw_mode)
+    {
+    case draw_fill:
+      if (m_use_path)
+        {
+          m_painter->fill_path(PainterData(&brush), m_path,
+                               PainterEnums::nonzero_fill_rule, true);
+        }
+      else
+        {
+          m_painter->fill_rounded_rect(PainterData(&brush), m_rounded_rect);
+        }
+      break;
+
+    case draw_clip_in:
+      if (m_use_path)
+        {
+          m_painter->clipInPath(m_path, PainterEnums::nonzero_fill_rule);
+        }
+      else
+        {
+          m_painter->clipInRoundedRect(m_rounded_rect);
+        }
+      m_painter->draw_rect(PainterData(&brush), -0.25f * sz, 1.5f * sz);
+      break;
+
+    case draw_clip_out:
+      if (m_use_path)
+        {
+          m_painter->clipOutPath(m_path, PainterEnums::nonzero_fill_rule);
+        }
+      else
+        {
+          m_painter->clipOutRoundedRect(m_rounded_rect);
+        }
+      m_painter->draw_rect(PainterData(&brush), -0.25f * sz, 1.5f * sz);
+      break;
+    }
+  m_painter->restore();
+}
+
+void
+painter_rounded_rect_test::
+draw_frame(void)
+{
+  uint64_t us;
+
+  us = m_time.restart_us();
+  if (m_frame == 0)
+    {
+      m_benchmark_timer.restart();
+    }
+  else if (m_frame > 0)
+    {
+      m_frame_times.push_back(us);
+    }
+
+  if (m_num_frames.m_value > 0 && m_frame == m_num_frames.m_value)
+    {
+      uint64_t benchmark_time_us;
+
+      benchmark_time_us = m_benchmark_timer.elapsed_us();
+      std::cout << "Frame times(in us):\n";
+      for(unsigned int i = 0, endi = m_frame_times.size(); i < endi; ++i)
+        {
+          std::cout << m_frame_times[i] << " us\n";
+        }
+      std::cout << "Did " << m_num_frames.m_value << " frames in "
+                << benchmark_time_us << "us, average time = "
+                << static_cast<float>(benchmark_time_us) / static_cast<float>(m_frame)
+                << "us\n " << 1000.0f * 1000.0f * static_cast<float>(m_frame) / static_cast<float>(benchmark_time_us)
+                << " FPS\n";
+      end_demo(0);
+      return;
+    }
+
+  m_surface->clear_color(vec4(0.5f, 0.5f, 0.5f, 1.0f));
+  m_painter->begin(m_surface);
+
+  ivec2 wh(dimensions());
+  float3x3 proj(float_orthogonal_projection_params(0, wh.x(), wh.y(), 0));
+  m_painter->transformation(proj);
+  m_painter->translate(m_zoomer.transformation().translation());
+  m_painter->scale(m_zoomer.transformation().scale());
+
+  for(int i = 0; i < m_count_x.m_value; ++i)
+    {
+      for(int j = 0; j < m_count_y.m_value; ++j)
+        {
+          draw_element(i, j);
+        }
+    }
+
+  m_painter->end();
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+  m_surface->blit_surface(GL_NEAREST);
+
+  ++m_frame;
+}
+
+int
+main(int argc, char **argv)
+{
+  painter_rounded_rect_test P;
+  return P.main(argc, argv);
+}
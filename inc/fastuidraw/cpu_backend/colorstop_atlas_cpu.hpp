@@ -0,0 +1,134 @@
+/*!
+ * \file colorstop_atlas_cpu.hpp
+ * \brief file colorstop_atlas_cpu.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/colorstop_atlas.hpp>
+
+namespace fastuidraw
+{
+namespace cpu
+{
+/*!\addtogroup CPUBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A ColorStopAtlasCPU is an implementation of \ref ColorStopAtlas
+   * whose backing store is an array in host memory. The texel
+   * values are stored layer by layer, i.e. the texel at (x, l)
+   * is at index x + l * width.
+   */
+  class ColorStopAtlasCPU:public ColorStopAtlas
+  {
+  public:
+    /*!
+     * \brief
+     * Class to hold the construction parameters for creating
+     * a ColorStopAtlasCPU.
+     */
+    class params
+    {
+    public:
+      /*!
+       * Ctor.
+       */
+      params(void);
+
+      /*!
+       * Copy ctor.
+       * \param obj value from which to copy
+       */
+      params(const params &obj);
+
+      ~params();
+
+      /*!
+       * Assignment operator.
+       * \param rhs value from which to copy
+       */
+      params&
+      operator=(const params &rhs);
+
+      /*!
+       * Swap operation
+       * \param obj object with which to swap
+       */
+      void
+      swap(params &obj);
+
+      /*!
+       * width of the backing store, initial value is 1024
+       */
+      int
+      width(void) const;
+
+      /*!
+       * Set the value for width(void) const
+       */
+      params&
+      width(int v);
+
+      /*!
+       * number of layers of the backing store, initial
+       * value is 32
+       */
+      int
+      num_layers(void) const;
+
+      /*!
+       * Set the value for num_layers(void) const
+       */
+      params&
+      num_layers(int v);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param P parameters of construction.
+     */
+    explicit
+    ColorStopAtlasCPU(const params &P);
+
+    ~ColorStopAtlasCPU();
+
+    /*!
+     * Returns the parameters used to construct the object.
+     */
+    const params&
+    param_values(void) const;
+
+    /*!
+     * Returns the texel values of the backing store. The
+     * returned array is invalidated when the backing store
+     * is resized.
+     */
+    c_array<const u8vec4>
+    texels(void) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+} //namespace cpu
+} //namespace fastuidraw
@@ -0,0 +1,163 @@
+/*!
+ * \file glyph_atlas_cpu.hpp
+ * \brief file glyph_atlas_cpu.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/text/glyph_atlas.hpp>
+
+namespace fastuidraw
+{
+namespace cpu
+{
+/*!\addtogroup CPUBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A GlyphAtlasCPU is an implementation of \ref GlyphAtlas
+   * whose texel and geometry backing stores are arrays in
+   * host memory. No graphics API is required to create or
+   * use a GlyphAtlasCPU.
+   */
+  class GlyphAtlasCPU:public GlyphAtlas
+  {
+  public:
+    /*!
+     * \brief
+     * Class to hold the construction parameters for creating
+     * a GlyphAtlasCPU.
+     */
+    class params
+    {
+    public:
+      /*!
+       * Ctor.
+       */
+      params(void);
+
+      /*!
+       * Copy ctor.
+       * \param obj value from which to copy
+       */
+      params(const params &obj);
+
+      ~params();
+
+      /*!
+       * Assignment operator.
+       * \param obj value from which to copy
+       */
+      params&
+      operator=(const params &obj);
+
+      /*!
+       * Swap operation
+       * \param obj object with which to swap
+       */
+      void
+      swap(params &obj);
+
+      /*!
+       * Initial dimension for the texel backing store,
+       * initial value is (1024, 1024, 16)
+       */
+      ivec3
+      texel_store_dimensions(void) const;
+
+      /*!
+       * Set the value for texel_store_dimensions(void) const
+       */
+      params&
+      texel_store_dimensions(ivec3 v);
+
+      /*!
+       * Number floats that can be held in the geometry data
+       * backing store, initial value is 1024 * 1024
+       */
+      unsigned int
+      number_floats(void) const;
+
+      /*!
+       * Set the value for number_floats(void) const
+       */
+      params&
+      number_floats(unsigned int v);
+
+      /*!
+       * The alignment for the GlyphAtlasGeometryBackingStoreBase
+       * of the constructed GlyphAtlasCPU, initial value is 4.
+       */
+      unsigned int
+      alignment(void) const;
+
+      /*!
+       * Set the value for alignment(void) const
+       */
+      params&
+      alignment(unsigned int v);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param P parameters for constrution
+     */
+    explicit
+    GlyphAtlasCPU(const params &P);
+
+    ~GlyphAtlasCPU();
+
+    /*!
+     * Returns the texel values of the texel backing store,
+     * first calling flush().
+     * The value for the texel at (x, y, l) is located at
+     * x + W * y + W * H * l where (W, H) are the width and
+     * height of GlyphAtlasTexelBackingStoreBase::dimensions().
+     * The returned array is invalidated when the backing store
+     * is resized.
+     */
+    c_array<const uint8_t>
+    texels(void) const;
+
+    /*!
+     * Returns the values of the geometry backing store,
+     * first calling flush().
+     * The returned array is invalidated when the backing
+     * store is resized.
+     */
+    c_array<const generic_data>
+    geometry_data(void) const;
+
+    /*!
+     * Returns the params value used to construct
+     * the GlyphAtlasCPU.
+     */
+    const params&
+    param_values(void) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+
+} //namespace cpu
+} //namespace fastuidraw
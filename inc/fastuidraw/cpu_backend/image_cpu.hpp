@@ -0,0 +1,211 @@
+/*!
+ * \file image_cpu.hpp
+ * \brief file image_cpu.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/image.hpp>
+
+namespace fastuidraw
+{
+namespace cpu
+{
+/*!\addtogroup CPUBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * An ImageAtlasCPU is an implementation of \ref ImageAtlas
+   * whose color and index backing stores are arrays in host
+   * memory. The color backing store holds the same number of
+   * mipmap levels as the GL implementation (namely
+   * log2_color_tile_size() levels).
+   */
+  class ImageAtlasCPU:public ImageAtlas
+  {
+  public:
+    /*!
+     * \brief
+     * Class to hold the construction parameters for creating
+     * an ImageAtlasCPU.
+     */
+    class params
+    {
+    public:
+      /*!
+       * Ctor.
+       */
+      params(void);
+
+      /*!
+       * Copy ctor.
+       * \param obj value from which to copy
+       */
+      params(const params &obj);
+
+      ~params();
+
+      /*!
+       * Assignment operator.
+       * \param obj value from which to copy
+       */
+      params&
+      operator=(const params &obj);
+
+      /*!
+       * Swap operation
+       * \param obj object with which to swap
+       */
+      void
+      swap(params &obj);
+
+      /*!
+       * Specifies the log2 of the width and height of each color
+       * tile, initial value is 5.
+       */
+      int
+      log2_color_tile_size(void) const;
+
+      /*!
+       * Set the value for log2_color_tile_size(void) const
+       */
+      params&
+      log2_color_tile_size(int v);
+
+      /*!
+       * Specifies the log2 of the number of color tiles in each
+       * row and column of each layer, initial value is 5.
+       */
+      int
+      log2_num_color_tiles_per_row_per_col(void) const;
+
+      /*!
+       * Set the value for log2_num_color_tiles_per_row_per_col(void) const
+       */
+      params&
+      log2_num_color_tiles_per_row_per_col(int v);
+
+      /*!
+       * Specifies the initial number of layers of the color
+       * backing store, initial value is 1.
+       */
+      int
+      num_color_layers(void) const;
+
+      /*!
+       * Set the value for num_color_layers(void) const
+       */
+      params&
+      num_color_layers(int v);
+
+      /*!
+       * Specifies the log2 of the width and height of each index
+       * tile, initial value is 2.
+       */
+      int
+      log2_index_tile_size(void) const;
+
+      /*!
+       * Set the value for log2_index_tile_size(void) const
+       */
+      params&
+      log2_index_tile_size(int v);
+
+      /*!
+       * Specifies the log2 of the number of index tiles in each
+       * row and column of each layer, initial value is 6.
+       */
+      int
+      log2_num_index_tiles_per_row_per_col(void) const;
+
+      /*!
+       * Set the value for log2_num_index_tiles_per_row_per_col(void) const
+       */
+      params&
+      log2_num_index_tiles_per_row_per_col(int v);
+
+      /*!
+       * Specifies the initial number of layers of the index
+       * backing store, initial value is 4.
+       */
+      int
+      num_index_layers(void) const;
+
+      /*!
+       * Set the value for num_index_layers(void) const
+       */
+      params&
+      num_index_layers(int v);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param P parameters for construction
+     */
+    explicit
+    ImageAtlasCPU(const params &P);
+
+    ~ImageAtlasCPU();
+
+    /*!
+     * Returns the parameters used to construct the object.
+     */
+    const params&
+    param_values(void) const;
+
+    /*!
+     * Returns the number of mipmap levels of the color
+     * backing store.
+     */
+    unsigned int
+    num_color_mipmap_levels(void) const;
+
+    /*!
+     * Returns the texels of a mipmap level of the color
+     * backing store. The texel at (x, y, l) of mipmap level
+     * M is located at x + W * y + W * H * l where W and H are
+     * the width and height of AtlasColorBackingStoreBase::dimensions()
+     * right-shifted by M. The returned array is invalidated
+     * when the backing store is resized.
+     * \param mipmap_level which mipmap level
+     */
+    c_array<const u8vec4>
+    color_texels(unsigned int mipmap_level) const;
+
+    /*!
+     * Returns the values of the index backing store; the
+     * values are exactly those passed to
+     * AtlasIndexBackingStoreBase::set_data(), with the same
+     * addressing as color_texels() at mipmap level 0. The
+     * returned array is invalidated when the backing store
+     * is resized.
+     */
+    c_array<const ivec3>
+    index_texels(void) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+
+} //namespace cpu
+} //namespace fastuidraw
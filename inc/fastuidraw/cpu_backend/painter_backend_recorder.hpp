@@ -0,0 +1,484 @@
+/*!
+ * \file painter_backend_recorder.hpp
+ * \brief file painter_backend_recorder.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/glsl/painter_backend_glsl.hpp>
+#include <fastuidraw/painter/packing/painter_draw.hpp>
+#include <fastuidraw/cpu_backend/glyph_atlas_cpu.hpp>
+#include <fastuidraw/cpu_backend/image_cpu.hpp>
+#include <fastuidraw/cpu_backend/colorstop_atlas_cpu.hpp>
+
+namespace fastuidraw
+{
+namespace cpu
+{
+/*!\addtogroup CPUBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterBackendRecorder is an implementation of PainterBackend
+   * whose PainterDraw objects are backed by host memory. Drawing a
+   * PainterDraw does not issue any graphics API calls; instead
+   * the attributes, headers, indices, data store and draw breaks
+   * of each PainterDraw are recorded so that they can be inspected
+   * (or consumed by a software renderer) after PainterPacker::end().
+   * Because no graphics API is used, a PainterBackendRecorder can
+   * be used to measure (and profile) the cost of the packing done by
+   * PainterPacker and Painter on machines without a GPU.
+   *
+   * Shader registration is handled by glsl::PainterBackendGLSL,
+   * so the shader ID's and groups assigned to shaders are the same
+   * as what a GLSL based backend would assign.
+   */
+  class PainterBackendRecorder:public glsl::PainterBackendGLSL
+  {
+  public:
+    /*!
+     * \brief
+     * Enumeration to query the statistics of what has been
+     * recorded by a PainterBackendRecorder
+     */
+    enum stats_t
+      {
+        /*!
+         * Number of on_pre_draw()/on_post_draw() pairs
+         */
+        num_frames,
+
+        /*!
+         * Number of PainterDraw objects returned by map_draw()
+         */
+        num_draws,
+
+        /*!
+         * Number of attributes written to PainterDraw objects
+         */
+        num_attributes,
+
+        /*!
+         * Number of indices written to PainterDraw objects
+         */
+        num_indices,
+
+        /*!
+         * Number of generic_data values written to the
+         * data store of PainterDraw objects
+         */
+        num_generic_datas,
+
+        /*!
+         * Number of calls to PainterDraw::draw_break()
+         * coming from a change in PainterShaderGroup
+         */
+        num_draw_breaks,
+
+        /*!
+         * Number of calls to PainterDraw::draw_break()
+         * coming from an action
+         */
+        num_action_breaks,
+
+        /*!
+         * Number of stats.
+         */
+        num_stats,
+      };
+
+    /*!
+     * \brief
+     * A DrawBreak records a single call to one of the
+     * PainterDraw::draw_break() methods.
+     */
+    class DrawBreak
+    {
+    public:
+      /*!
+       * Enumeration describing what caused the draw break.
+       */
+      enum type_t
+        {
+          /*!
+           * break is from PainterDraw::draw_break(const PainterShaderGroup&,
+           * const PainterShaderGroup&, unsigned int) const
+           */
+          shader_group_break,
+
+          /*!
+           * break is from PainterDraw::draw_break(const reference_counted_ptr<const Action>&,
+           * unsigned int) const
+           */
+          action_break,
+        };
+
+      /*!
+       * The type of draw break.
+       */
+      enum type_t m_type;
+
+      /*!
+       * The number of indices written before the break.
+       */
+      unsigned int m_indices_written;
+
+      /*!
+       * Value of PainterShaderGroup::item_group() after the
+       * break, only valid if \ref m_type is \ref shader_group_break.
+       */
+      uint32_t m_item_group;
+
+      /*!
+       * Value of PainterShaderGroup::blend_group() after the
+       * break, only valid if \ref m_type is \ref shader_group_break.
+       */
+      uint32_t m_blend_group;
+
+      /*!
+       * Value of PainterShaderGroup::brush() after the
+       * break, only valid if \ref m_type is \ref shader_group_break.
+       */
+      uint32_t m_brush;
+
+      /*!
+       * Value of PainterShaderGroup::packed_blend_mode() after
+       * the break, only valid if \ref m_type is \ref shader_group_break.
+       */
+      BlendMode::packed_value m_packed_blend_mode;
+
+      /*!
+       * The action of the break, only non-nullptr if
+       * \ref m_type is \ref action_break.
+       */
+      reference_counted_ptr<const PainterDraw::Action> m_action;
+    };
+
+    /*!
+     * \brief
+     * A RecordedDraw gives the contents of a PainterDraw
+     * as it was when PainterDraw::draw() was called.
+     */
+    class RecordedDraw
+    {
+    public:
+      /*!
+       * The attributes written, i.e. the range of
+       * PainterDraw::m_attributes written to.
+       */
+      c_array<const PainterAttribute> m_attributes;
+
+      /*!
+       * The header attributes written, i.e. the range of
+       * PainterDraw::m_header_attributes written to.
+       */
+      c_array<const uint32_t> m_header_attributes;
+
+      /*!
+       * The indices written, i.e. the range of
+       * PainterDraw::m_indices written to.
+       */
+      c_array<const PainterIndex> m_indices;
+
+      /*!
+       * The data store values written, i.e. the range of
+       * PainterDraw::m_store written to.
+       */
+      c_array<const generic_data> m_store;
+
+      /*!
+       * The draw breaks in the order they were made.
+       */
+      c_array<const DrawBreak> m_breaks;
+    };
+
+    /*!
+     * \brief
+     * A SurfaceRecorder is a \ref PainterBackend::Surface that
+     * has no backing; it only specifies dimensions and viewport.
+     */
+    class SurfaceRecorder:public Surface
+    {
+    public:
+      /*!
+       * Ctor.
+       * \param dims dimensions of the SurfaceRecorder; the
+       *             viewport is initialized to cover all
+       *             of the surface.
+       */
+      explicit
+      SurfaceRecorder(ivec2 dims);
+
+      ~SurfaceRecorder();
+
+      virtual
+      Viewport
+      viewport(void) const;
+
+      virtual
+      ivec2
+      dimensions(void) const;
+
+      /*!
+       * Set the viewport of the SurfaceRecorder.
+       * \param vwp new viewport value
+       */
+      void
+      viewport(const Viewport &vwp);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * \brief
+     * Specifies the parameters for creating a
+     * PainterBackendRecorder.
+     */
+    class ConfigurationRecorder
+    {
+    public:
+      /*!
+       * Ctor.
+       */
+      ConfigurationRecorder(void);
+
+      /*!
+       * Copy ctor.
+       * \param obj value from which to copy
+       */
+      ConfigurationRecorder(const ConfigurationRecorder &obj);
+
+      ~ConfigurationRecorder();
+
+      /*!
+       * Assignment operator
+       * \param rhs value from which to copy
+       */
+      ConfigurationRecorder&
+      operator=(const ConfigurationRecorder &rhs);
+
+      /*!
+       * Swap operation
+       * \param obj object with which to swap
+       */
+      void
+      swap(ConfigurationRecorder &obj);
+
+      /*!
+       * The ImageAtlasCPU to be used by the painter
+       */
+      const reference_counted_ptr<ImageAtlasCPU>&
+      image_atlas(void) const;
+
+      /*!
+       * Set the value returned by image_atlas(void) const.
+       */
+      ConfigurationRecorder&
+      image_atlas(const reference_counted_ptr<ImageAtlasCPU> &v);
+
+      /*!
+       * The ColorStopAtlasCPU to be used by the painter
+       */
+      const reference_counted_ptr<ColorStopAtlasCPU>&
+      colorstop_atlas(void) const;
+
+      /*!
+       * Set the value returned by colorstop_atlas(void) const.
+       */
+      ConfigurationRecorder&
+      colorstop_atlas(const reference_counted_ptr<ColorStopAtlasCPU> &v);
+
+      /*!
+       * The GlyphAtlasCPU to be used by the painter
+       */
+      const reference_counted_ptr<GlyphAtlasCPU>&
+      glyph_atlas(void) const;
+
+      /*!
+       * Set the value returned by glyph_atlas(void) const.
+       */
+      ConfigurationRecorder&
+      glyph_atlas(const reference_counted_ptr<GlyphAtlasCPU> &v);
+
+      /*!
+       * Specifies the maximum number of attributes
+       * a PainterDraw returned by map_draw() may
+       * store, i.e. the size of PainterDraw::m_attributes.
+       * Initial value is 512 * 512.
+       */
+      unsigned int
+      attributes_per_buffer(void) const;
+
+      /*!
+       * Set the value for attributes_per_buffer(void) const
+       */
+      ConfigurationRecorder&
+      attributes_per_buffer(unsigned int v);
+
+      /*!
+       * Specifies the maximum number of indices
+       * a PainterDraw returned by map_draw() may
+       * store, i.e. the size of PainterDraw::m_indices.
+       * Initial value is 1.5 times the initial value
+       * for attributes_per_buffer(void) const.
+       */
+      unsigned int
+      indices_per_buffer(void) const;
+
+      /*!
+       * Set the value for indices_per_buffer(void) const
+       */
+      ConfigurationRecorder&
+      indices_per_buffer(unsigned int v);
+
+      /*!
+       * Specifies the maximum number of blocks of
+       * data a PainterDraw returned by map_draw()
+       * may store. The size of PainterDraw::m_store
+       * is given by data_blocks_per_store_buffer() *
+       * PainterBackend::ConfigurationBase::alignment(),
+       * Initial value is 1024 * 64.
+       */
+      unsigned int
+      data_blocks_per_store_buffer(void) const;
+
+      /*!
+       * Set the value for data_blocks_per_store_buffer(void) const
+       */
+      ConfigurationRecorder&
+      data_blocks_per_store_buffer(unsigned int v);
+
+      /*!
+       * If true, PainterDraw::draw() of a PainterDraw returned
+       * by map_draw() will call PainterDraw::Action::execute()
+       * (passing nullptr as the PainterDraw::APIBase) for
+       * each action recorded. Initial value is false.
+       */
+      bool
+      execute_actions(void) const;
+
+      /*!
+       * Set the value for execute_actions(void) const
+       */
+      ConfigurationRecorder&
+      execute_actions(bool v);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param config_recorder ConfigurationRecorder providing configuration parameters
+     * \param config_base ConfigurationBase parameters inherited from PainterBackend
+     */
+    PainterBackendRecorder(const ConfigurationRecorder &config_recorder,
+                           const ConfigurationBase &config_base);
+
+    ~PainterBackendRecorder();
+
+    virtual
+    unsigned int
+    attribs_per_mapping(void) const;
+
+    virtual
+    unsigned int
+    indices_per_mapping(void) const;
+
+    virtual
+    void
+    on_pre_draw(const reference_counted_ptr<Surface> &surface,
+                bool clear_color_buffer);
+
+    virtual
+    void
+    on_post_draw(void);
+
+    virtual
+    reference_counted_ptr<const PainterDraw>
+    map_draw(void);
+
+    /*!
+     * Returns the ConfigurationRecorder passed in the ctor.
+     */
+    const ConfigurationRecorder&
+    configuration_recorder(void) const;
+
+    /*!
+     * Returns the number of PainterDraw objects drawn in the
+     * last (or current) on_pre_draw()/on_post_draw() pair.
+     */
+    unsigned int
+    number_recorded_draws(void) const;
+
+    /*!
+     * Returns the contents of a PainterDraw drawn in the last
+     * (or current) on_pre_draw()/on_post_draw() pair. The
+     * returned value is valid until the next call to on_pre_draw().
+     * \param I which draw with 0 <= I < number_recorded_draws()
+     */
+    RecordedDraw
+    recorded_draw(unsigned int I) const;
+
+    /*!
+     * Returns the \ref PainterBackend::Surface passed to the
+     * last call to on_pre_draw().
+     */
+    const reference_counted_ptr<Surface>&
+    recorded_surface(void) const;
+
+    /*!
+     * Returns true if the color buffer was requested to be
+     * cleared in the last call to on_pre_draw().
+     */
+    bool
+    recorded_clear_color_buffer(void) const;
+
+    /*!
+     * Returns a stat of what has been recorded since
+     * construction or the last call to reset_stats().
+     * \param st stat to query
+     */
+    unsigned int
+    query_stat(enum stats_t st) const;
+
+    /*!
+     * Reset all stats to zero.
+     */
+    void
+    reset_stats(void);
+
+    /*!
+     * Walk the recorded draws of the last (or current)
+     * on_pre_draw()/on_post_draw() pair to compute the
+     * stats of that frame alone.
+     * \param dst location to which to write the stats, the
+     *            stat of enumeration st is written to dst[st]
+     */
+    void
+    replay_stats(c_array<unsigned int> dst) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+
+} //namespace cpu
+} //namespace fastuidraw
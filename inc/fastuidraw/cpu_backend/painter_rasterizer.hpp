@@ -0,0 +1,268 @@
+/*!
+ * \file painter_rasterizer.hpp
+ * \brief file painter_rasterizer.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/cpu_backend/painter_backend_recorder.hpp>
+
+namespace fastuidraw
+{
+namespace cpu
+{
+/*!\addtogroup CPUBackend
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterRasterizer is a software renderer that draws the
+   * PainterDraw content recorded by a PainterBackendRecorder
+   * to an RGBA8 image in host memory. The attributes, headers,
+   * indices and data store of each PainterBackendRecorder::RecordedDraw
+   * are consumed exactly as the GLSL uber-shader of a
+   * glsl::PainterBackendGLSL consumes them: the item shader of
+   * each vertex is identified by comparing the shader ID of the
+   * header against the shaders of PainterBackend::default_shaders()
+   * and the vertex and fragment shading of those shaders is
+   * replicated on the CPU. The depth test (with the same depth
+   * values as the GL backend), the clip equations of the header
+   * and the Porter-Duff blend modes are implemented.
+   *
+   * The following item shaders of PainterBackend::default_shaders()
+   * are supported:
+   *  - PainterFillShader::item_shader() and PainterFillShader::aa_fuzz_shader()
+   *  - PainterStrokeShader::non_aa_shader(), PainterStrokeShader::aa_shader_pass1()
+   *    and PainterStrokeShader::aa_shader_pass2() of PainterShaderSet::stroke_shader()
+   *  - the coverage and distance field glyph shaders of PainterShaderSet::glyph_shader()
+   *    and PainterShaderSet::glyph_shader_anisotropic()
+   *  - the shaders of PainterShaderSet::rounded_rect_shader()
+   *
+   * Triangles drawn with any other item shader (for example dashed
+   * stroking, arc stroking, curve-pair glyphs or a custom shader)
+   * are skipped and counted in \ref num_triangles_skipped. Only the
+   * pen color of a PainterBrush is applied, the image and gradient
+   * of a PainterBrush are ignored. Blend modes that are not
+   * Porter-Duff are drawn as PainterEnums::blend_porter_duff_src_over.
+   *
+   * Rasterization is done in screen tiles by a set of threads;
+   * the triangles within a tile are drawn in the order in which
+   * they were packed, thus the result does not depend on the
+   * number of threads used.
+   */
+  class PainterRasterizer:noncopyable
+  {
+  public:
+    /*!
+     * \brief
+     * Enumeration to query the statistics of what
+     * has been rasterized by a PainterRasterizer
+     */
+    enum stats_t
+      {
+        /*!
+         * Number of calls to rasterize()
+         */
+        num_frames,
+
+        /*!
+         * Number of triangles processed, including those
+         * skipped.
+         */
+        num_triangles,
+
+        /*!
+         * Number of triangles skipped because their
+         * item shader is not supported.
+         */
+        num_triangles_skipped,
+
+        /*!
+         * Number of fragments that were shaded, i.e. that
+         * were within a triangle, the viewport and the clip
+         * equations.
+         */
+        num_fragments,
+
+        /*!
+         * Number of fragments that passed the depth test
+         * and were not discarded.
+         */
+        num_fragments_written,
+
+        /*!
+         * Number of stats.
+         */
+        num_stats,
+      };
+
+    /*!
+     * \brief
+     * Class to hold the construction parameters for
+     * creating a PainterRasterizer.
+     */
+    class params
+    {
+    public:
+      /*!
+       * Ctor.
+       */
+      params(void);
+
+      /*!
+       * Copy ctor.
+       * \param obj value from which to copy
+       */
+      params(const params &obj);
+
+      ~params();
+
+      /*!
+       * Assignment operator.
+       * \param obj value from which to copy
+       */
+      params&
+      operator=(const params &obj);
+
+      /*!
+       * Swap operation
+       * \param obj object with which to swap
+       */
+      void
+      swap(params &obj);
+
+      /*!
+       * Number of threads used to rasterize, a value of 0
+       * indicates to use std::thread::hardware_concurrency().
+       * Initial value is 0.
+       */
+      unsigned int
+      number_threads(void) const;
+
+      /*!
+       * Set the value for number_threads(void) const
+       */
+      params&
+      number_threads(unsigned int v);
+
+      /*!
+       * The width and height in pixels of the screen tiles
+       * into which the triangles are binned; each tile is
+       * rasterized by a single thread. Initial value is 64.
+       */
+      unsigned int
+      tile_size(void) const;
+
+      /*!
+       * Set the value for tile_size(void) const
+       */
+      params&
+      tile_size(unsigned int v);
+
+      /*!
+       * The color, non-premultiplied RGBA, to which the image
+       * is cleared when PainterBackendRecorder::recorded_clear_color_buffer()
+       * is true. Initial value is (0, 0, 0, 0).
+       */
+      const vec4&
+      clear_color(void) const;
+
+      /*!
+       * Set the value for clear_color(void) const
+       */
+      params&
+      clear_color(const vec4 &v);
+
+    private:
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param backend PainterBackendRecorder whose recorded draws to
+     *                rasterize; the glyph texels are fetched from
+     *                PainterBackendRecorder::ConfigurationRecorder::glyph_atlas()
+     *                of backend.
+     * \param P parameters for construction
+     */
+    explicit
+    PainterRasterizer(const reference_counted_ptr<PainterBackendRecorder> &backend,
+                      const params &P = params());
+
+    ~PainterRasterizer();
+
+    /*!
+     * Returns the params value used to construct
+     * the PainterRasterizer.
+     */
+    const params&
+    param_values(void) const;
+
+    /*!
+     * Rasterize the draws of the last (or current) on_pre_draw()/on_post_draw()
+     * pair of the PainterBackendRecorder passed in the ctor, i.e.
+     * PainterBackendRecorder::recorded_draw(). The image is resized to
+     * the dimensions of PainterBackendRecorder::recorded_surface(); if
+     * the image is resized or if PainterBackendRecorder::recorded_clear_color_buffer()
+     * is true, the image is first cleared to params::clear_color().
+     * Otherwise the draws are drawn on top of the image as left by the
+     * previous call to rasterize(). The depth buffer is always cleared.
+     */
+    void
+    rasterize(void);
+
+    /*!
+     * Returns the dimensions of the image.
+     */
+    ivec2
+    dimensions(void) const;
+
+    /*!
+     * Returns the pixels of the image as premultiplied RGBA8
+     * values. The pixel at (x, y) is located at x + W * y
+     * where W is the width of dimensions(); as in GL, y = 0
+     * is the bottom row of the image.
+     */
+    c_array<const u8vec4>
+    pixels(void) const;
+
+    /*!
+     * Returns a stat of what has been rasterized since
+     * construction or the last call to reset_stats().
+     * \param st stat to query
+     */
+    unsigned int
+    query_stat(enum stats_t st) const;
+
+    /*!
+     * Reset all stats to zero.
+     */
+    void
+    reset_stats(void);
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+
+} //namespace cpu
+} //namespace fastuidraw
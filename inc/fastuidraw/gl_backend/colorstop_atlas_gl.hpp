@@ -21,6 +21,7 @@
 
 #include <fastuidraw/colorstop_atlas.hpp>
 #include <fastuidraw/gl_backend/gl_program.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 namespace fastuidraw
 {
@@ -131,6 +132,22 @@ namespace gl
       params&
       delayed(bool v);
 
+      /*!
+       * The GLContextWorker to which the ColorStopAtlasGL queues
+       * the deletion of its backing texture, see also
+       * ImageAtlasGL::params::worker(). Initial value is
+       * a newly created GLContextWorker.
+       */
+      const reference_counted_ptr<GLContextWorker>&
+      worker(void) const;
+
+      /*!
+       * Set the value for worker(void) const, value
+       * must not be nullptr.
+       */
+      params&
+      worker(const reference_counted_ptr<GLContextWorker> &v);
+
     private:
       void *m_d;
     };
@@ -0,0 +1,186 @@
+/*!
+ * \file gl_context_worker.hpp
+ * \brief file gl_context_worker.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/gl_backend/gl_header.hpp>
+
+namespace fastuidraw
+{
+  namespace gl
+  {
+
+/*!\addtogroup GLUtility
+ * @{
+ */
+
+    /*!
+     * \brief
+     * A GLContextWorker is a queue of GL work to be done the next
+     * time a GL context is current. The objects of the GL backend
+     * are reference counted and thus their dtors can be called
+     * from any thread at any time, including when no GL context is
+     * current. Instead of issuing GL commands, those dtors add the
+     * deletion of their GL objects to the GLContextWorker they were
+     * given at construction. The GL names in a queue must all come
+     * from one share group, thus an application uses one
+     * GLContextWorker per share group (typically one per
+     * PainterBackendGL) and passes it to the atlases (for example
+     * GlyphAtlasGL::params::worker()), to the PainterBackendGL (via
+     * PainterBackendGL::ConfigurationGL::worker()) and to any Program
+     * it creates. PainterBackendGL runs the queued work of its
+     * GLContextWorker and those of its atlases in
+     * PainterBackendGL::on_pre_draw() and
+     * PainterBackendGL::on_post_draw(). All methods, except
+     * execute_actions(), are thread safe and do not issue any
+     * GL commands.
+     */
+    class GLContextWorker:
+      public reference_counted<GLContextWorker>::default_base
+    {
+    public:
+      /*!
+       * \brief
+       * An Action is a functor to be executed by
+       * GLContextWorker::execute_actions() with a GL
+       * context current.
+       */
+      class Action:
+        public reference_counted<Action>::default_base
+      {
+      public:
+        virtual
+        ~Action()
+        {}
+
+        /*!
+         * To be implemented by a derived class to
+         * perform the GL work of the Action.
+         */
+        virtual
+        void
+        execute(void) = 0;
+      };
+
+      GLContextWorker(void);
+
+      /*!
+       * Dtor; any work still in the queue is NOT
+       * executed and Action objects of the queue
+       * are released.
+       */
+      ~GLContextWorker();
+
+      /*!
+       * Add an Action to the queue, Action objects are
+       * executed in the order they are added.
+       * \param action Action to add
+       */
+      void
+      add_action(const reference_counted_ptr<Action> &action);
+
+      /*!
+       * Add the deletion of a GL texture to the queue.
+       * \param texture name of texture, if 0 nothing is added
+       */
+      void
+      delete_texture(GLuint texture);
+
+      /*!
+       * Add the deletion of a GL buffer object to the queue.
+       * \param buffer name of buffer object, if 0 nothing is added
+       */
+      void
+      delete_buffer(GLuint buffer);
+
+      /*!
+       * Add the deletion of a GL vertex array object to the queue.
+       * \param vao name of vertex array object, if 0 nothing is added
+       */
+      void
+      delete_vertex_array(GLuint vao);
+
+      /*!
+       * Add the deletion of a GL framebuffer object to the queue.
+       * \param fbo name of framebuffer object, if 0 nothing is added
+       */
+      void
+      delete_framebuffer(GLuint fbo);
+
+      /*!
+       * Add the deletion of a GL sampler object to the queue.
+       * \param sampler name of sampler object, if 0 nothing is added
+       */
+      void
+      delete_sampler(GLuint sampler);
+
+      /*!
+       * Add the deletion of a GL program to the queue.
+       * \param program name of program, if 0 nothing is added
+       */
+      void
+      delete_program(GLuint program);
+
+      /*!
+       * Add the deletion of a GL shader to the queue.
+       * \param shader name of shader, if 0 nothing is added
+       */
+      void
+      delete_shader(GLuint shader);
+
+      /*!
+       * Add the deletion of a GL sync object to the queue.
+       * \param sync sync object, if nullptr nothing is added
+       */
+      void
+      delete_sync(GLsync sync);
+
+      /*!
+       * Returns the number of Action objects and GL objects
+       * to delete that are in the queue.
+       */
+      unsigned int
+      number_pending(void) const;
+
+      /*!
+       * Execute the Action objects of the queue and then
+       * delete the GL objects of the queue, the deletions
+       * are batched into one GL call per type of GL object
+       * for those GL objects whose glDelete call takes an array.
+       * The queue is taken before any work is done, thus
+       * work added by an Action or by another thread while
+       * execute_actions() runs is left in the queue for the
+       * next call. Must be called from a thread with a GL
+       * context current whose GL objects are shared with
+       * those of the GL contexts that created the objects.
+       * Returns the number of Action objects and GL objects
+       * processed.
+       */
+      unsigned int
+      execute_actions(void);
+
+    private:
+      void *m_d;
+    };
+/*! @} */
+
+  }
+}
@@ -25,6 +25,7 @@
 #include <fastuidraw/util/reference_counted.hpp>
 #include <fastuidraw/glsl/shader_source.hpp>
 #include <fastuidraw/gl_backend/gl_header.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 #include <fastuidraw/gl_backend/gluniform.hpp>
 
 namespace fastuidraw {
@@ -50,8 +51,8 @@ namespace gl {
  * triggers the GL commands to compile the shader if the shader has
  * not been yet attempeted to be compiled. Hence one may only call
  * these from outside the rendering thread if shader_ready() returns
- * true. Moreover, a Shader may only be deleted from the GL rendering
- * thread.
+ * true. Moreover, a Shader constructed without a GLContextWorker may
+ * only be deleted from the GL rendering thread.
  */
 class Shader:
   public reference_counted<Shader>::default_base
@@ -62,8 +63,14 @@ public:
    * \param src GLSL source code of the shader
    * \param pshader_type type of shader, i.e. GL_VERTEX_SHADER
    *                     for a vertex shader, etc.
+   * \param worker if non-null, the dtor queues the deletion of
+   *               the GL shader to worker instead of deleting it
+   *               directly, so that the Shader can be deleted
+   *               without a GL context current
    */
-  Shader(const glsl::ShaderSource &src, GLenum pshader_type);
+  Shader(const glsl::ShaderSource &src, GLenum pshader_type,
+         const reference_counted_ptr<GLContextWorker> &worker
+         = reference_counted_ptr<GLContextWorker>());
 
   ~Shader();
 
@@ -180,6 +187,23 @@ public:
   virtual
   void
   action(GLuint glsl_program) const = 0;
+
+  /*!
+   * To be optionally implemented by a derived class to return
+   * a string that identifies what action() does, i.e. two
+   * PreLinkAction objects with the same cache_key() must have
+   * the same effect on the linked program. The value is part
+   * of the key with which a ProgramBinaryCache stores the
+   * program binary. Default implementation returns nullptr
+   * which indicates that a Program that uses the action is
+   * not to be stored in or loaded from a ProgramBinaryCache.
+   */
+  virtual
+  c_string
+  cache_key(void) const
+  {
+    return nullptr;
+  }
 };
 
 
@@ -205,6 +229,10 @@ public:
   void
   action(GLuint glsl_program) const;
 
+  virtual
+  c_string
+  cache_key(void) const;
+
 private:
   void *m_d;
 };
@@ -224,6 +252,10 @@ public:
   virtual
   void
   action(GLuint glsl_program) const;
+
+  virtual
+  c_string
+  cache_key(void) const;
 };
 
 /*!
@@ -253,6 +285,10 @@ public:
   void
   action(GLuint glsl_program) const;
 
+  virtual
+  c_string
+  cache_key(void) const;
+
 private:
   void *m_d;
 };
@@ -340,6 +376,13 @@ public:
   void
   execute_actions(GLuint glsl_program) const;
 
+  /*!
+   * Returns the actions added via add(), in the
+   * order in which they were added.
+   */
+  c_array<const reference_counted_ptr<PreLinkAction> >
+  actions(void) const;
+
 private:
   void *m_d;
 };
@@ -743,6 +786,76 @@ private:
   void *m_d;
 };
 
+/*!
+ * \brief
+ * A ProgramBinaryCache stores the program binaries (see
+ * glGetProgramBinary() and glProgramBinary()) of linked
+ * Program objects in files of a directory so that a later
+ * run of the application can skip compiling and linking
+ * the GLSL source code.
+ *
+ * The binary of a Program is keyed by the GLSL source code
+ * and type of each of its shaders together with the strings
+ * of GL_VENDOR, GL_RENDERER and GL_VERSION of the GL context;
+ * a hash of the key names the file and the full key is stored
+ * in the file to detect hash collisions. A Program falls back to compiling and linking
+ * if there is no binary for the key, if the file does not
+ * match the key or if GL rejects the binary (for example
+ * after a driver update that does not change GL_VERSION);
+ * the binary of a Program that successfully compiles and
+ * links is then written to the cache. The key also includes
+ * PreLinkAction::cache_key() of each of the pre-link actions
+ * of the Program; a Program with a pre-link action whose
+ * cache_key() is nullptr does not use the cache. Using
+ * a ProgramBinaryCache requires GL 4.1, GL ES 3.0 or the
+ * extension GL_ARB_get_program_binary and that the GL
+ * implementation supports at least one program binary
+ * format; if not, the Program compiles and links as
+ * if it was not given a ProgramBinaryCache.
+ */
+class ProgramBinaryCache:
+  public reference_counted<ProgramBinaryCache>::default_base
+{
+public:
+  /*!
+   * Ctor.
+   * \param directory directory in which to read and write
+   *                  the files of the program binaries;
+   *                  the directory must already exist
+   */
+  explicit
+  ProgramBinaryCache(c_string directory);
+
+  ~ProgramBinaryCache();
+
+  /*!
+   * Returns the directory of the files of the
+   * program binaries.
+   */
+  c_string
+  directory(void) const;
+
+  /*!
+   * Returns the number of Program objects that were
+   * created from a program binary of this
+   * ProgramBinaryCache.
+   */
+  unsigned int
+  number_hits(void) const;
+
+  /*!
+   * Returns the number of Program objects using this
+   * ProgramBinaryCache that had to compile and link
+   * their GLSL source code.
+   */
+  unsigned int
+  number_misses(void) const;
+
+private:
+  friend class Program;
+  void *m_d;
+};
+
 /*!
  * \brief
  * Class for creating and using GLSL programs.
@@ -1270,10 +1383,19 @@ public:
    * \param action specifies actions to perform before linking of the Program
    * \param initers one-time initialization actions to perform at GLSL
    *                program creation
+   * \param binary_cache if non-null, ProgramBinaryCache from which to
+   *                     load the program binary and to which to save
+   *                     the program binary if it needs to be compiled
+   * \param worker if non-null, the dtor queues the deletion of the
+   *               GL program to worker instead of deleting it directly
    */
   Program(c_array<const reference_counted_ptr<Shader> > pshaders,
           const PreLinkActionArray &action = PreLinkActionArray(),
-          const ProgramInitializerArray &initers = ProgramInitializerArray());
+          const ProgramInitializerArray &initers = ProgramInitializerArray(),
+          const reference_counted_ptr<ProgramBinaryCache> &binary_cache
+          = reference_counted_ptr<ProgramBinaryCache>(),
+          const reference_counted_ptr<GLContextWorker> &worker
+          = reference_counted_ptr<GLContextWorker>());
 
   /*!
    * Ctor.
@@ -1283,11 +1405,20 @@ public:
    *               after linking of the Program.
    * \param initers one-time initialization actions to perform at GLSL
    *                program creation
+   * \param binary_cache if non-null, ProgramBinaryCache from which to
+   *                     load the program binary and to which to save
+   *                     the program binary if it needs to be compiled
+   * \param worker if non-null, the dtor queues the deletion of the
+   *               GL program to worker instead of deleting it directly
    */
   Program(reference_counted_ptr<Shader> vert_shader,
           reference_counted_ptr<Shader> frag_shader,
           const PreLinkActionArray &action = PreLinkActionArray(),
-          const ProgramInitializerArray &initers = ProgramInitializerArray());
+          const ProgramInitializerArray &initers = ProgramInitializerArray(),
+          const reference_counted_ptr<ProgramBinaryCache> &binary_cache
+          = reference_counted_ptr<ProgramBinaryCache>(),
+          const reference_counted_ptr<GLContextWorker> &worker
+          = reference_counted_ptr<GLContextWorker>());
 
   /*!
    * Ctor.
@@ -1297,19 +1428,32 @@ public:
    *               after linking of the Program.
    * \param initers one-time initialization actions to perform at GLSL
    *                program creation
+   * \param binary_cache if non-null, ProgramBinaryCache from which to
+   *                     load the program binary and to which to save
+   *                     the program binary if it needs to be compiled
+   * \param worker if non-null, the dtor queues the deletion of the
+   *               GL program to worker instead of deleting it directly
    */
   Program(const glsl::ShaderSource &vert_shader,
           const glsl::ShaderSource &frag_shader,
           const PreLinkActionArray &action = PreLinkActionArray(),
-          const ProgramInitializerArray &initers = ProgramInitializerArray());
+          const ProgramInitializerArray &initers = ProgramInitializerArray(),
+          const reference_counted_ptr<ProgramBinaryCache> &binary_cache
+          = reference_counted_ptr<ProgramBinaryCache>(),
+          const reference_counted_ptr<GLContextWorker> &worker
+          = reference_counted_ptr<GLContextWorker>());
 
   /*!
    * Ctor. Create a \ref Program from a previously linked GL shader.
    * \param pname GL ID of previously linked shader
    * \param take_ownership if true when dtor is called glDeleteProgram
    *                       is called as well
+   * \param worker if non-null and take_ownership is true, the dtor
+   *               queues the deletion of the GL program to worker
    */
-  Program(GLuint pname, bool take_ownership);
+  Program(GLuint pname, bool take_ownership,
+          const reference_counted_ptr<GLContextWorker> &worker
+          = reference_counted_ptr<GLContextWorker>());
 
   ~Program(void);
 
@@ -1345,11 +1489,22 @@ public:
 
   /*!
    * Returns how many seconds it took for the program
-   * to be assembled and linked.
+   * to be assembled and linked, or to be loaded from
+   * its ProgramBinaryCache if program_from_binary()
+   * returns true.
    */
   float
   program_build_time(void);
 
+  /*!
+   * Returns true if and only if the program was created
+   * from a program binary fetched from the ProgramBinaryCache
+   * passed at construction instead of compiling and linking
+   * its GLSL source code.
+   */
+  bool
+  program_from_binary(void);
+
   /*!
    * Returns true if and only if this Program
    * successfully linked. This function should
@@ -22,6 +22,7 @@
 #include <fastuidraw/text/glyph_atlas.hpp>
 #include <fastuidraw/glsl/painter_backend_glsl.hpp>
 #include <fastuidraw/gl_backend/gl_header.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 namespace fastuidraw
 {
@@ -127,6 +128,22 @@ namespace gl
       params&
       delayed(bool v);
 
+      /*!
+       * The GLContextWorker to which the GlyphAtlasGL queues
+       * the deletion of its backing texture and buffer, see also
+       * ImageAtlasGL::params::worker(). Initial value is
+       * a newly created GLContextWorker.
+       */
+      const reference_counted_ptr<GLContextWorker>&
+      worker(void) const;
+
+      /*!
+       * Set the value for worker(void) const, value
+       * must not be nullptr.
+       */
+      params&
+      worker(const reference_counted_ptr<GLContextWorker> &v);
+
       /*!
        * Returns what kind of GL object is used to back
        * the glyph geometry data. Default value is
@@ -21,6 +21,7 @@
 
 #include <fastuidraw/image.hpp>
 #include <fastuidraw/gl_backend/gl_header.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 namespace fastuidraw
 {
@@ -45,7 +46,10 @@ namespace gl
    * If the ImageAtlasGL was constructed as delayed,
    * then the loading of data to the GL textures is delayed until
    * flush(), otherwise it is done immediately and then must be done
-   * with a GL context current.
+   * with a GL context current. Images created with Image::create_async() are placed by
+   * ImageAtlas::process_async_uploads(); a delayed ImageAtlasGL
+   * allows for an application to call it from any thread and to
+   * leave the GL work to flush().
    */
   class ImageAtlasGL:public ImageAtlas
   {
@@ -186,6 +190,26 @@ namespace gl
       params&
       delayed(bool v);
 
+      /*!
+       * The GLContextWorker to which the ImageAtlasGL
+       * queues the deletion of its GL objects, the GLContextWorker
+       * must be run (GLContextWorker::execute_actions()) with a GL
+       * context current of the share group in which the ImageAtlasGL
+       * is used. A PainterBackendGL runs the GLContextWorker of
+       * each of its atlases. Initial value is a newly created
+       * GLContextWorker, thus by default each ImageAtlasGL has
+       * its own queue.
+       */
+      const reference_counted_ptr<GLContextWorker>&
+      worker(void) const;
+
+      /*!
+       * Set the value for worker(void) const, value
+       * must not be nullptr.
+       */
+      params&
+      worker(const reference_counted_ptr<GLContextWorker> &v);
+
     private:
       void *m_d;
     };
@@ -240,13 +264,14 @@ namespace gl
      *            store (i.e. glTexImage2D or glTexStorage2D). However,
      *            one can change texture parameters (via glTexParameter)
      *            or image data (via glTexSubImage2D) freely.
+     * The deletion of the texture is queued to params::worker()
+     * of the ImageAtlasGL.
      */
-    static
     reference_counted_ptr<Image>
     create_bindless(int w, int h, unsigned int m, const ImageSourceBase &image,
                     GLenum min_filter = GL_LINEAR_MIPMAP_LINEAR,
                     GLenum mag_filter = GL_LINEAR,
-                    GLuint *tex = nullptr);
+                    GLuint *tex = nullptr) const;
 
   private:
     void *m_d;
@@ -0,0 +1,8953 @@
+#pragma once
+
+#include <GLES3/gl3platform.h>
+#include <GLES3/gl3.h>
+#include <GLES3/gl31.h>
+#include <GLES3/gl32.h>
+#include <GLES2/gl2ext.h>
+
+
+namespace fastuidraw {
+namespace gl_binding {
+void* get_proc(const char *name);
+void load_all_functions(bool emit_load_warning);
+
+#define FASTUIDRAWglfunctionExists(name) fastuidraw::gl_binding::exists_function_##name()
+
+#define FASTUIDRAWglfunctionPointer(name) fastuidraw::gl_binding::get_function_ptr_##name()
+
+extern PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC function_ptr_glAcquireKeyedMutexWin32EXT;
+int exists_function_glAcquireKeyedMutexWin32EXT(void);
+PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC get_function_ptr_glAcquireKeyedMutexWin32EXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glAcquireKeyedMutexWin32EXT(GLuint  argument_0, GLuint64  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glAcquireKeyedMutexWin32EXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glAcquireKeyedMutexWin32EXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glAcquireKeyedMutexWin32EXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glAcquireKeyedMutexWin32EXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glAcquireKeyedMutexWin32EXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLACTIVESHADERPROGRAMPROC function_ptr_glActiveShaderProgram;
+int exists_function_glActiveShaderProgram(void);
+PFNGLACTIVESHADERPROGRAMPROC get_function_ptr_glActiveShaderProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glActiveShaderProgram(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glActiveShaderProgram( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glActiveShaderProgram( argument_0, argument_1, __FILE__, __LINE__, "glActiveShaderProgram("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glActiveShaderProgram( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glActiveShaderProgram( argument_0, argument_1)
+#endif
+
+extern PFNGLACTIVESHADERPROGRAMEXTPROC function_ptr_glActiveShaderProgramEXT;
+int exists_function_glActiveShaderProgramEXT(void);
+PFNGLACTIVESHADERPROGRAMEXTPROC get_function_ptr_glActiveShaderProgramEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glActiveShaderProgramEXT(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glActiveShaderProgramEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glActiveShaderProgramEXT( argument_0, argument_1, __FILE__, __LINE__, "glActiveShaderProgramEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glActiveShaderProgramEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glActiveShaderProgramEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLACTIVETEXTUREPROC function_ptr_glActiveTexture;
+int exists_function_glActiveTexture(void);
+PFNGLACTIVETEXTUREPROC get_function_ptr_glActiveTexture(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glActiveTexture(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glActiveTexture( argument_0) fastuidraw::gl_binding::debug_function__glActiveTexture( argument_0, __FILE__, __LINE__, "glActiveTexture("#argument_0")", #argument_0)
+#else
+#define glActiveTexture( argument_0) fastuidraw::gl_binding::function_ptr_glActiveTexture( argument_0)
+#endif
+
+extern PFNGLALPHAFUNCQCOMPROC function_ptr_glAlphaFuncQCOM;
+int exists_function_glAlphaFuncQCOM(void);
+PFNGLALPHAFUNCQCOMPROC get_function_ptr_glAlphaFuncQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glAlphaFuncQCOM(GLenum  argument_0, GLclampf  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glAlphaFuncQCOM( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glAlphaFuncQCOM( argument_0, argument_1, __FILE__, __LINE__, "glAlphaFuncQCOM("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glAlphaFuncQCOM( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glAlphaFuncQCOM( argument_0, argument_1)
+#endif
+
+extern PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC function_ptr_glApplyFramebufferAttachmentCMAAINTEL;
+int exists_function_glApplyFramebufferAttachmentCMAAINTEL(void);
+PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC get_function_ptr_glApplyFramebufferAttachmentCMAAINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glApplyFramebufferAttachmentCMAAINTEL(const char *file, int line, const char *call);
+#define glApplyFramebufferAttachmentCMAAINTEL() fastuidraw::gl_binding::debug_function__glApplyFramebufferAttachmentCMAAINTEL( __FILE__, __LINE__, "glApplyFramebufferAttachmentCMAAINTEL("")")
+#else
+#define glApplyFramebufferAttachmentCMAAINTEL() fastuidraw::gl_binding::function_ptr_glApplyFramebufferAttachmentCMAAINTEL()
+#endif
+
+extern PFNGLATTACHSHADERPROC function_ptr_glAttachShader;
+int exists_function_glAttachShader(void);
+PFNGLATTACHSHADERPROC get_function_ptr_glAttachShader(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glAttachShader(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glAttachShader( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glAttachShader( argument_0, argument_1, __FILE__, __LINE__, "glAttachShader("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glAttachShader( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glAttachShader( argument_0, argument_1)
+#endif
+
+extern PFNGLBEGINCONDITIONALRENDERNVPROC function_ptr_glBeginConditionalRenderNV;
+int exists_function_glBeginConditionalRenderNV(void);
+PFNGLBEGINCONDITIONALRENDERNVPROC get_function_ptr_glBeginConditionalRenderNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginConditionalRenderNV(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBeginConditionalRenderNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBeginConditionalRenderNV( argument_0, argument_1, __FILE__, __LINE__, "glBeginConditionalRenderNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBeginConditionalRenderNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBeginConditionalRenderNV( argument_0, argument_1)
+#endif
+
+extern PFNGLBEGINPERFMONITORAMDPROC function_ptr_glBeginPerfMonitorAMD;
+int exists_function_glBeginPerfMonitorAMD(void);
+PFNGLBEGINPERFMONITORAMDPROC get_function_ptr_glBeginPerfMonitorAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginPerfMonitorAMD(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBeginPerfMonitorAMD( argument_0) fastuidraw::gl_binding::debug_function__glBeginPerfMonitorAMD( argument_0, __FILE__, __LINE__, "glBeginPerfMonitorAMD("#argument_0")", #argument_0)
+#else
+#define glBeginPerfMonitorAMD( argument_0) fastuidraw::gl_binding::function_ptr_glBeginPerfMonitorAMD( argument_0)
+#endif
+
+extern PFNGLBEGINPERFQUERYINTELPROC function_ptr_glBeginPerfQueryINTEL;
+int exists_function_glBeginPerfQueryINTEL(void);
+PFNGLBEGINPERFQUERYINTELPROC get_function_ptr_glBeginPerfQueryINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginPerfQueryINTEL(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBeginPerfQueryINTEL( argument_0) fastuidraw::gl_binding::debug_function__glBeginPerfQueryINTEL( argument_0, __FILE__, __LINE__, "glBeginPerfQueryINTEL("#argument_0")", #argument_0)
+#else
+#define glBeginPerfQueryINTEL( argument_0) fastuidraw::gl_binding::function_ptr_glBeginPerfQueryINTEL( argument_0)
+#endif
+
+extern PFNGLBEGINQUERYPROC function_ptr_glBeginQuery;
+int exists_function_glBeginQuery(void);
+PFNGLBEGINQUERYPROC get_function_ptr_glBeginQuery(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginQuery(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBeginQuery( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBeginQuery( argument_0, argument_1, __FILE__, __LINE__, "glBeginQuery("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBeginQuery( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBeginQuery( argument_0, argument_1)
+#endif
+
+extern PFNGLBEGINQUERYEXTPROC function_ptr_glBeginQueryEXT;
+int exists_function_glBeginQueryEXT(void);
+PFNGLBEGINQUERYEXTPROC get_function_ptr_glBeginQueryEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginQueryEXT(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBeginQueryEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBeginQueryEXT( argument_0, argument_1, __FILE__, __LINE__, "glBeginQueryEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBeginQueryEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBeginQueryEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLBEGINTRANSFORMFEEDBACKPROC function_ptr_glBeginTransformFeedback;
+int exists_function_glBeginTransformFeedback(void);
+PFNGLBEGINTRANSFORMFEEDBACKPROC get_function_ptr_glBeginTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBeginTransformFeedback(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBeginTransformFeedback( argument_0) fastuidraw::gl_binding::debug_function__glBeginTransformFeedback( argument_0, __FILE__, __LINE__, "glBeginTransformFeedback("#argument_0")", #argument_0)
+#else
+#define glBeginTransformFeedback( argument_0) fastuidraw::gl_binding::function_ptr_glBeginTransformFeedback( argument_0)
+#endif
+
+extern PFNGLBINDATTRIBLOCATIONPROC function_ptr_glBindAttribLocation;
+int exists_function_glBindAttribLocation(void);
+PFNGLBINDATTRIBLOCATIONPROC get_function_ptr_glBindAttribLocation(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindAttribLocation(GLuint  argument_0, GLuint  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBindAttribLocation( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBindAttribLocation( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBindAttribLocation("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBindAttribLocation( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBindAttribLocation( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBINDBUFFERPROC function_ptr_glBindBuffer;
+int exists_function_glBindBuffer(void);
+PFNGLBINDBUFFERPROC get_function_ptr_glBindBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindBuffer(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindBuffer( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindBuffer( argument_0, argument_1, __FILE__, __LINE__, "glBindBuffer("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindBuffer( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindBuffer( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDBUFFERBASEPROC function_ptr_glBindBufferBase;
+int exists_function_glBindBufferBase(void);
+PFNGLBINDBUFFERBASEPROC get_function_ptr_glBindBufferBase(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindBufferBase(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBindBufferBase( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBindBufferBase( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBindBufferBase("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBindBufferBase( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBindBufferBase( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBINDBUFFERRANGEPROC function_ptr_glBindBufferRange;
+int exists_function_glBindBufferRange(void);
+PFNGLBINDBUFFERRANGEPROC get_function_ptr_glBindBufferRange(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindBufferRange(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glBindBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glBindBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glBindBufferRange("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glBindBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glBindBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLBINDFRAGDATALOCATIONEXTPROC function_ptr_glBindFragDataLocationEXT;
+int exists_function_glBindFragDataLocationEXT(void);
+PFNGLBINDFRAGDATALOCATIONEXTPROC get_function_ptr_glBindFragDataLocationEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindFragDataLocationEXT(GLuint  argument_0, GLuint  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBindFragDataLocationEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBindFragDataLocationEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBindFragDataLocationEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBindFragDataLocationEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBindFragDataLocationEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC function_ptr_glBindFragDataLocationIndexedEXT;
+int exists_function_glBindFragDataLocationIndexedEXT(void);
+PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC get_function_ptr_glBindFragDataLocationIndexedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindFragDataLocationIndexedEXT(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBindFragDataLocationIndexedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBindFragDataLocationIndexedEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBindFragDataLocationIndexedEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBindFragDataLocationIndexedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBindFragDataLocationIndexedEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBINDFRAMEBUFFERPROC function_ptr_glBindFramebuffer;
+int exists_function_glBindFramebuffer(void);
+PFNGLBINDFRAMEBUFFERPROC get_function_ptr_glBindFramebuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindFramebuffer(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindFramebuffer( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindFramebuffer( argument_0, argument_1, __FILE__, __LINE__, "glBindFramebuffer("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindFramebuffer( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindFramebuffer( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDIMAGETEXTUREPROC function_ptr_glBindImageTexture;
+int exists_function_glBindImageTexture(void);
+PFNGLBINDIMAGETEXTUREPROC get_function_ptr_glBindImageTexture(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindImageTexture(GLuint  argument_0, GLuint  argument_1, GLint  argument_2, GLboolean  argument_3, GLint  argument_4, GLenum  argument_5, GLenum  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glBindImageTexture( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glBindImageTexture( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glBindImageTexture("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glBindImageTexture( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glBindImageTexture( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLBINDPROGRAMPIPELINEPROC function_ptr_glBindProgramPipeline;
+int exists_function_glBindProgramPipeline(void);
+PFNGLBINDPROGRAMPIPELINEPROC get_function_ptr_glBindProgramPipeline(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindProgramPipeline(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBindProgramPipeline( argument_0) fastuidraw::gl_binding::debug_function__glBindProgramPipeline( argument_0, __FILE__, __LINE__, "glBindProgramPipeline("#argument_0")", #argument_0)
+#else
+#define glBindProgramPipeline( argument_0) fastuidraw::gl_binding::function_ptr_glBindProgramPipeline( argument_0)
+#endif
+
+extern PFNGLBINDPROGRAMPIPELINEEXTPROC function_ptr_glBindProgramPipelineEXT;
+int exists_function_glBindProgramPipelineEXT(void);
+PFNGLBINDPROGRAMPIPELINEEXTPROC get_function_ptr_glBindProgramPipelineEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindProgramPipelineEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBindProgramPipelineEXT( argument_0) fastuidraw::gl_binding::debug_function__glBindProgramPipelineEXT( argument_0, __FILE__, __LINE__, "glBindProgramPipelineEXT("#argument_0")", #argument_0)
+#else
+#define glBindProgramPipelineEXT( argument_0) fastuidraw::gl_binding::function_ptr_glBindProgramPipelineEXT( argument_0)
+#endif
+
+extern PFNGLBINDRENDERBUFFERPROC function_ptr_glBindRenderbuffer;
+int exists_function_glBindRenderbuffer(void);
+PFNGLBINDRENDERBUFFERPROC get_function_ptr_glBindRenderbuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindRenderbuffer(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindRenderbuffer( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindRenderbuffer( argument_0, argument_1, __FILE__, __LINE__, "glBindRenderbuffer("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindRenderbuffer( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindRenderbuffer( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDSAMPLERPROC function_ptr_glBindSampler;
+int exists_function_glBindSampler(void);
+PFNGLBINDSAMPLERPROC get_function_ptr_glBindSampler(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindSampler(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindSampler( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindSampler( argument_0, argument_1, __FILE__, __LINE__, "glBindSampler("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindSampler( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindSampler( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDSHADINGRATEIMAGENVPROC function_ptr_glBindShadingRateImageNV;
+int exists_function_glBindShadingRateImageNV(void);
+PFNGLBINDSHADINGRATEIMAGENVPROC get_function_ptr_glBindShadingRateImageNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindShadingRateImageNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBindShadingRateImageNV( argument_0) fastuidraw::gl_binding::debug_function__glBindShadingRateImageNV( argument_0, __FILE__, __LINE__, "glBindShadingRateImageNV("#argument_0")", #argument_0)
+#else
+#define glBindShadingRateImageNV( argument_0) fastuidraw::gl_binding::function_ptr_glBindShadingRateImageNV( argument_0)
+#endif
+
+extern PFNGLBINDTEXTUREPROC function_ptr_glBindTexture;
+int exists_function_glBindTexture(void);
+PFNGLBINDTEXTUREPROC get_function_ptr_glBindTexture(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindTexture(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindTexture( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindTexture( argument_0, argument_1, __FILE__, __LINE__, "glBindTexture("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindTexture( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindTexture( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDTRANSFORMFEEDBACKPROC function_ptr_glBindTransformFeedback;
+int exists_function_glBindTransformFeedback(void);
+PFNGLBINDTRANSFORMFEEDBACKPROC get_function_ptr_glBindTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindTransformFeedback(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBindTransformFeedback( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBindTransformFeedback( argument_0, argument_1, __FILE__, __LINE__, "glBindTransformFeedback("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBindTransformFeedback( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBindTransformFeedback( argument_0, argument_1)
+#endif
+
+extern PFNGLBINDVERTEXARRAYPROC function_ptr_glBindVertexArray;
+int exists_function_glBindVertexArray(void);
+PFNGLBINDVERTEXARRAYPROC get_function_ptr_glBindVertexArray(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindVertexArray(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBindVertexArray( argument_0) fastuidraw::gl_binding::debug_function__glBindVertexArray( argument_0, __FILE__, __LINE__, "glBindVertexArray("#argument_0")", #argument_0)
+#else
+#define glBindVertexArray( argument_0) fastuidraw::gl_binding::function_ptr_glBindVertexArray( argument_0)
+#endif
+
+extern PFNGLBINDVERTEXARRAYOESPROC function_ptr_glBindVertexArrayOES;
+int exists_function_glBindVertexArrayOES(void);
+PFNGLBINDVERTEXARRAYOESPROC get_function_ptr_glBindVertexArrayOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindVertexArrayOES(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBindVertexArrayOES( argument_0) fastuidraw::gl_binding::debug_function__glBindVertexArrayOES( argument_0, __FILE__, __LINE__, "glBindVertexArrayOES("#argument_0")", #argument_0)
+#else
+#define glBindVertexArrayOES( argument_0) fastuidraw::gl_binding::function_ptr_glBindVertexArrayOES( argument_0)
+#endif
+
+extern PFNGLBINDVERTEXBUFFERPROC function_ptr_glBindVertexBuffer;
+int exists_function_glBindVertexBuffer(void);
+PFNGLBINDVERTEXBUFFERPROC get_function_ptr_glBindVertexBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBindVertexBuffer(GLuint  argument_0, GLuint  argument_1, GLintptr  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBindVertexBuffer( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBindVertexBuffer( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBindVertexBuffer("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBindVertexBuffer( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBindVertexBuffer( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBLENDBARRIERPROC function_ptr_glBlendBarrier;
+int exists_function_glBlendBarrier(void);
+PFNGLBLENDBARRIERPROC get_function_ptr_glBlendBarrier(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendBarrier(const char *file, int line, const char *call);
+#define glBlendBarrier() fastuidraw::gl_binding::debug_function__glBlendBarrier( __FILE__, __LINE__, "glBlendBarrier("")")
+#else
+#define glBlendBarrier() fastuidraw::gl_binding::function_ptr_glBlendBarrier()
+#endif
+
+extern PFNGLBLENDBARRIERKHRPROC function_ptr_glBlendBarrierKHR;
+int exists_function_glBlendBarrierKHR(void);
+PFNGLBLENDBARRIERKHRPROC get_function_ptr_glBlendBarrierKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendBarrierKHR(const char *file, int line, const char *call);
+#define glBlendBarrierKHR() fastuidraw::gl_binding::debug_function__glBlendBarrierKHR( __FILE__, __LINE__, "glBlendBarrierKHR("")")
+#else
+#define glBlendBarrierKHR() fastuidraw::gl_binding::function_ptr_glBlendBarrierKHR()
+#endif
+
+extern PFNGLBLENDBARRIERNVPROC function_ptr_glBlendBarrierNV;
+int exists_function_glBlendBarrierNV(void);
+PFNGLBLENDBARRIERNVPROC get_function_ptr_glBlendBarrierNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendBarrierNV(const char *file, int line, const char *call);
+#define glBlendBarrierNV() fastuidraw::gl_binding::debug_function__glBlendBarrierNV( __FILE__, __LINE__, "glBlendBarrierNV("")")
+#else
+#define glBlendBarrierNV() fastuidraw::gl_binding::function_ptr_glBlendBarrierNV()
+#endif
+
+extern PFNGLBLENDCOLORPROC function_ptr_glBlendColor;
+int exists_function_glBlendColor(void);
+PFNGLBLENDCOLORPROC get_function_ptr_glBlendColor(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendColor(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBlendColor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBlendColor( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBlendColor("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBlendColor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBlendColor( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBLENDEQUATIONPROC function_ptr_glBlendEquation;
+int exists_function_glBlendEquation(void);
+PFNGLBLENDEQUATIONPROC get_function_ptr_glBlendEquation(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquation(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glBlendEquation( argument_0) fastuidraw::gl_binding::debug_function__glBlendEquation( argument_0, __FILE__, __LINE__, "glBlendEquation("#argument_0")", #argument_0)
+#else
+#define glBlendEquation( argument_0) fastuidraw::gl_binding::function_ptr_glBlendEquation( argument_0)
+#endif
+
+extern PFNGLBLENDEQUATIONSEPARATEPROC function_ptr_glBlendEquationSeparate;
+int exists_function_glBlendEquationSeparate(void);
+PFNGLBLENDEQUATIONSEPARATEPROC get_function_ptr_glBlendEquationSeparate(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationSeparate(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendEquationSeparate( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendEquationSeparate( argument_0, argument_1, __FILE__, __LINE__, "glBlendEquationSeparate("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendEquationSeparate( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendEquationSeparate( argument_0, argument_1)
+#endif
+
+extern PFNGLBLENDEQUATIONSEPARATEIPROC function_ptr_glBlendEquationSeparatei;
+int exists_function_glBlendEquationSeparatei(void);
+PFNGLBLENDEQUATIONSEPARATEIPROC get_function_ptr_glBlendEquationSeparatei(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationSeparatei(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendEquationSeparatei( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendEquationSeparatei( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendEquationSeparatei("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendEquationSeparatei( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendEquationSeparatei( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDEQUATIONSEPARATEIEXTPROC function_ptr_glBlendEquationSeparateiEXT;
+int exists_function_glBlendEquationSeparateiEXT(void);
+PFNGLBLENDEQUATIONSEPARATEIEXTPROC get_function_ptr_glBlendEquationSeparateiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationSeparateiEXT(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendEquationSeparateiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendEquationSeparateiEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendEquationSeparateiEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendEquationSeparateiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendEquationSeparateiEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDEQUATIONSEPARATEIOESPROC function_ptr_glBlendEquationSeparateiOES;
+int exists_function_glBlendEquationSeparateiOES(void);
+PFNGLBLENDEQUATIONSEPARATEIOESPROC get_function_ptr_glBlendEquationSeparateiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationSeparateiOES(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendEquationSeparateiOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendEquationSeparateiOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendEquationSeparateiOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendEquationSeparateiOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendEquationSeparateiOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDEQUATIONIPROC function_ptr_glBlendEquationi;
+int exists_function_glBlendEquationi(void);
+PFNGLBLENDEQUATIONIPROC get_function_ptr_glBlendEquationi(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationi(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendEquationi( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendEquationi( argument_0, argument_1, __FILE__, __LINE__, "glBlendEquationi("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendEquationi( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendEquationi( argument_0, argument_1)
+#endif
+
+extern PFNGLBLENDEQUATIONIEXTPROC function_ptr_glBlendEquationiEXT;
+int exists_function_glBlendEquationiEXT(void);
+PFNGLBLENDEQUATIONIEXTPROC get_function_ptr_glBlendEquationiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationiEXT(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendEquationiEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendEquationiEXT( argument_0, argument_1, __FILE__, __LINE__, "glBlendEquationiEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendEquationiEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendEquationiEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLBLENDEQUATIONIOESPROC function_ptr_glBlendEquationiOES;
+int exists_function_glBlendEquationiOES(void);
+PFNGLBLENDEQUATIONIOESPROC get_function_ptr_glBlendEquationiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendEquationiOES(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendEquationiOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendEquationiOES( argument_0, argument_1, __FILE__, __LINE__, "glBlendEquationiOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendEquationiOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendEquationiOES( argument_0, argument_1)
+#endif
+
+extern PFNGLBLENDFUNCPROC function_ptr_glBlendFunc;
+int exists_function_glBlendFunc(void);
+PFNGLBLENDFUNCPROC get_function_ptr_glBlendFunc(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFunc(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendFunc( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendFunc( argument_0, argument_1, __FILE__, __LINE__, "glBlendFunc("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendFunc( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendFunc( argument_0, argument_1)
+#endif
+
+extern PFNGLBLENDFUNCSEPARATEPROC function_ptr_glBlendFuncSeparate;
+int exists_function_glBlendFuncSeparate(void);
+PFNGLBLENDFUNCSEPARATEPROC get_function_ptr_glBlendFuncSeparate(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFuncSeparate(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBlendFuncSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBlendFuncSeparate( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBlendFuncSeparate("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBlendFuncSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBlendFuncSeparate( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBLENDFUNCSEPARATEIPROC function_ptr_glBlendFuncSeparatei;
+int exists_function_glBlendFuncSeparatei(void);
+PFNGLBLENDFUNCSEPARATEIPROC get_function_ptr_glBlendFuncSeparatei(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFuncSeparatei(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, GLenum  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glBlendFuncSeparatei( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glBlendFuncSeparatei( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glBlendFuncSeparatei("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glBlendFuncSeparatei( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glBlendFuncSeparatei( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLBLENDFUNCSEPARATEIEXTPROC function_ptr_glBlendFuncSeparateiEXT;
+int exists_function_glBlendFuncSeparateiEXT(void);
+PFNGLBLENDFUNCSEPARATEIEXTPROC get_function_ptr_glBlendFuncSeparateiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFuncSeparateiEXT(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, GLenum  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glBlendFuncSeparateiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glBlendFuncSeparateiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glBlendFuncSeparateiEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glBlendFuncSeparateiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glBlendFuncSeparateiEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLBLENDFUNCSEPARATEIOESPROC function_ptr_glBlendFuncSeparateiOES;
+int exists_function_glBlendFuncSeparateiOES(void);
+PFNGLBLENDFUNCSEPARATEIOESPROC get_function_ptr_glBlendFuncSeparateiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFuncSeparateiOES(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, GLenum  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glBlendFuncSeparateiOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glBlendFuncSeparateiOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glBlendFuncSeparateiOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glBlendFuncSeparateiOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glBlendFuncSeparateiOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLBLENDFUNCIPROC function_ptr_glBlendFunci;
+int exists_function_glBlendFunci(void);
+PFNGLBLENDFUNCIPROC get_function_ptr_glBlendFunci(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFunci(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendFunci( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendFunci( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendFunci("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendFunci( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendFunci( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDFUNCIEXTPROC function_ptr_glBlendFunciEXT;
+int exists_function_glBlendFunciEXT(void);
+PFNGLBLENDFUNCIEXTPROC get_function_ptr_glBlendFunciEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFunciEXT(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendFunciEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendFunciEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendFunciEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendFunciEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendFunciEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDFUNCIOESPROC function_ptr_glBlendFunciOES;
+int exists_function_glBlendFunciOES(void);
+PFNGLBLENDFUNCIOESPROC get_function_ptr_glBlendFunciOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendFunciOES(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBlendFunciOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBlendFunciOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBlendFunciOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBlendFunciOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBlendFunciOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBLENDPARAMETERINVPROC function_ptr_glBlendParameteriNV;
+int exists_function_glBlendParameteriNV(void);
+PFNGLBLENDPARAMETERINVPROC get_function_ptr_glBlendParameteriNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlendParameteriNV(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glBlendParameteriNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glBlendParameteriNV( argument_0, argument_1, __FILE__, __LINE__, "glBlendParameteriNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glBlendParameteriNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glBlendParameteriNV( argument_0, argument_1)
+#endif
+
+extern PFNGLBLITFRAMEBUFFERPROC function_ptr_glBlitFramebuffer;
+int exists_function_glBlitFramebuffer(void);
+PFNGLBLITFRAMEBUFFERPROC get_function_ptr_glBlitFramebuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlitFramebuffer(GLint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, GLint  argument_7, GLbitfield  argument_8, GLenum  argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glBlitFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glBlitFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glBlitFramebuffer("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glBlitFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glBlitFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLBLITFRAMEBUFFERANGLEPROC function_ptr_glBlitFramebufferANGLE;
+int exists_function_glBlitFramebufferANGLE(void);
+PFNGLBLITFRAMEBUFFERANGLEPROC get_function_ptr_glBlitFramebufferANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlitFramebufferANGLE(GLint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, GLint  argument_7, GLbitfield  argument_8, GLenum  argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glBlitFramebufferANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glBlitFramebufferANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glBlitFramebufferANGLE("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glBlitFramebufferANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glBlitFramebufferANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLBLITFRAMEBUFFERNVPROC function_ptr_glBlitFramebufferNV;
+int exists_function_glBlitFramebufferNV(void);
+PFNGLBLITFRAMEBUFFERNVPROC get_function_ptr_glBlitFramebufferNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBlitFramebufferNV(GLint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, GLint  argument_7, GLbitfield  argument_8, GLenum  argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glBlitFramebufferNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glBlitFramebufferNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glBlitFramebufferNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glBlitFramebufferNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glBlitFramebufferNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLBUFFERATTACHMEMORYNVPROC function_ptr_glBufferAttachMemoryNV;
+int exists_function_glBufferAttachMemoryNV(void);
+PFNGLBUFFERATTACHMEMORYNVPROC get_function_ptr_glBufferAttachMemoryNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferAttachMemoryNV(GLenum  argument_0, GLuint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glBufferAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glBufferAttachMemoryNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glBufferAttachMemoryNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glBufferAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glBufferAttachMemoryNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLBUFFERDATAPROC function_ptr_glBufferData;
+int exists_function_glBufferData(void);
+PFNGLBUFFERDATAPROC get_function_ptr_glBufferData(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferData(GLenum  argument_0, GLsizeiptr  argument_1, const void * argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBufferData( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBufferData( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBufferData("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBufferData( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBufferData( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBUFFERPAGECOMMITMENTMEMNVPROC function_ptr_glBufferPageCommitmentMemNV;
+int exists_function_glBufferPageCommitmentMemNV(void);
+PFNGLBUFFERPAGECOMMITMENTMEMNVPROC get_function_ptr_glBufferPageCommitmentMemNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferPageCommitmentMemNV(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLuint  argument_3, GLuint64  argument_4, GLboolean  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glBufferPageCommitmentMemNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLBUFFERSTORAGEEXTPROC function_ptr_glBufferStorageEXT;
+int exists_function_glBufferStorageEXT(void);
+PFNGLBUFFERSTORAGEEXTPROC get_function_ptr_glBufferStorageEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferStorageEXT(GLenum  argument_0, GLsizeiptr  argument_1, const void * argument_2, GLbitfield  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBufferStorageEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBufferStorageEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBufferStorageEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBufferStorageEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBufferStorageEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBUFFERSTORAGEEXTERNALEXTPROC function_ptr_glBufferStorageExternalEXT;
+int exists_function_glBufferStorageExternalEXT(void);
+PFNGLBUFFERSTORAGEEXTERNALEXTPROC get_function_ptr_glBufferStorageExternalEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferStorageExternalEXT(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLeglClientBufferEXT  argument_3, GLbitfield  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glBufferStorageExternalEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLBUFFERSTORAGEMEMEXTPROC function_ptr_glBufferStorageMemEXT;
+int exists_function_glBufferStorageMemEXT(void);
+PFNGLBUFFERSTORAGEMEMEXTPROC get_function_ptr_glBufferStorageMemEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferStorageMemEXT(GLenum  argument_0, GLsizeiptr  argument_1, GLuint  argument_2, GLuint64  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBufferStorageMemEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLBUFFERSUBDATAPROC function_ptr_glBufferSubData;
+int exists_function_glBufferSubData(void);
+PFNGLBUFFERSUBDATAPROC get_function_ptr_glBufferSubData(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glBufferSubData(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, const void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glBufferSubData( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glBufferSubData( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glBufferSubData("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glBufferSubData( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glBufferSubData( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC function_ptr_glCheckFramebufferStatus;
+int exists_function_glCheckFramebufferStatus(void);
+PFNGLCHECKFRAMEBUFFERSTATUSPROC get_function_ptr_glCheckFramebufferStatus(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glCheckFramebufferStatus(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCheckFramebufferStatus( argument_0) fastuidraw::gl_binding::debug_function__glCheckFramebufferStatus( argument_0, __FILE__, __LINE__, "glCheckFramebufferStatus("#argument_0")", #argument_0)
+#else
+#define glCheckFramebufferStatus( argument_0) fastuidraw::gl_binding::function_ptr_glCheckFramebufferStatus( argument_0)
+#endif
+
+extern PFNGLCLEARPROC function_ptr_glClear;
+int exists_function_glClear(void);
+PFNGLCLEARPROC get_function_ptr_glClear(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClear(GLbitfield  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glClear( argument_0) fastuidraw::gl_binding::debug_function__glClear( argument_0, __FILE__, __LINE__, "glClear("#argument_0")", #argument_0)
+#else
+#define glClear( argument_0) fastuidraw::gl_binding::function_ptr_glClear( argument_0)
+#endif
+
+extern PFNGLCLEARBUFFERFIPROC function_ptr_glClearBufferfi;
+int exists_function_glClearBufferfi(void);
+PFNGLCLEARBUFFERFIPROC get_function_ptr_glClearBufferfi(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearBufferfi(GLenum  argument_0, GLint  argument_1, GLfloat  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glClearBufferfi( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glClearBufferfi( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glClearBufferfi("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glClearBufferfi( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glClearBufferfi( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLCLEARBUFFERFVPROC function_ptr_glClearBufferfv;
+int exists_function_glClearBufferfv(void);
+PFNGLCLEARBUFFERFVPROC get_function_ptr_glClearBufferfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearBufferfv(GLenum  argument_0, GLint  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClearBufferfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClearBufferfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClearBufferfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClearBufferfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClearBufferfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLEARBUFFERIVPROC function_ptr_glClearBufferiv;
+int exists_function_glClearBufferiv(void);
+PFNGLCLEARBUFFERIVPROC get_function_ptr_glClearBufferiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearBufferiv(GLenum  argument_0, GLint  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClearBufferiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClearBufferiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClearBufferiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClearBufferiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClearBufferiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLEARBUFFERUIVPROC function_ptr_glClearBufferuiv;
+int exists_function_glClearBufferuiv(void);
+PFNGLCLEARBUFFERUIVPROC get_function_ptr_glClearBufferuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearBufferuiv(GLenum  argument_0, GLint  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClearBufferuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClearBufferuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClearBufferuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClearBufferuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClearBufferuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLEARCOLORPROC function_ptr_glClearColor;
+int exists_function_glClearColor(void);
+PFNGLCLEARCOLORPROC get_function_ptr_glClearColor(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearColor(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glClearColor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glClearColor( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glClearColor("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glClearColor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glClearColor( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLCLEARDEPTHFPROC function_ptr_glClearDepthf;
+int exists_function_glClearDepthf(void);
+PFNGLCLEARDEPTHFPROC get_function_ptr_glClearDepthf(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearDepthf(GLfloat  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glClearDepthf( argument_0) fastuidraw::gl_binding::debug_function__glClearDepthf( argument_0, __FILE__, __LINE__, "glClearDepthf("#argument_0")", #argument_0)
+#else
+#define glClearDepthf( argument_0) fastuidraw::gl_binding::function_ptr_glClearDepthf( argument_0)
+#endif
+
+extern PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC function_ptr_glClearPixelLocalStorageuiEXT;
+int exists_function_glClearPixelLocalStorageuiEXT(void);
+PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC get_function_ptr_glClearPixelLocalStorageuiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearPixelLocalStorageuiEXT(GLsizei  argument_0, GLsizei  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClearPixelLocalStorageuiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClearPixelLocalStorageuiEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClearPixelLocalStorageuiEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClearPixelLocalStorageuiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClearPixelLocalStorageuiEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLEARSTENCILPROC function_ptr_glClearStencil;
+int exists_function_glClearStencil(void);
+PFNGLCLEARSTENCILPROC get_function_ptr_glClearStencil(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearStencil(GLint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glClearStencil( argument_0) fastuidraw::gl_binding::debug_function__glClearStencil( argument_0, __FILE__, __LINE__, "glClearStencil("#argument_0")", #argument_0)
+#else
+#define glClearStencil( argument_0) fastuidraw::gl_binding::function_ptr_glClearStencil( argument_0)
+#endif
+
+extern PFNGLCLEARTEXIMAGEEXTPROC function_ptr_glClearTexImageEXT;
+int exists_function_glClearTexImageEXT(void);
+PFNGLCLEARTEXIMAGEEXTPROC get_function_ptr_glClearTexImageEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearTexImageEXT(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLenum  argument_3, const void * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glClearTexImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glClearTexImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glClearTexImageEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glClearTexImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glClearTexImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCLEARTEXSUBIMAGEEXTPROC function_ptr_glClearTexSubImageEXT;
+int exists_function_glClearTexSubImageEXT(void);
+PFNGLCLEARTEXSUBIMAGEEXTPROC get_function_ptr_glClearTexSubImageEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClearTexSubImageEXT(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLenum  argument_9, const void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glClearTexSubImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glClearTexSubImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glClearTexSubImageEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glClearTexSubImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glClearTexSubImageEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLCLIENTWAITSYNCPROC function_ptr_glClientWaitSync;
+int exists_function_glClientWaitSync(void);
+PFNGLCLIENTWAITSYNCPROC get_function_ptr_glClientWaitSync(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glClientWaitSync(GLsync  argument_0, GLbitfield  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClientWaitSync( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClientWaitSync( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClientWaitSync("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClientWaitSync( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClientWaitSync( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLIENTWAITSYNCAPPLEPROC function_ptr_glClientWaitSyncAPPLE;
+int exists_function_glClientWaitSyncAPPLE(void);
+PFNGLCLIENTWAITSYNCAPPLEPROC get_function_ptr_glClientWaitSyncAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glClientWaitSyncAPPLE(GLsync  argument_0, GLbitfield  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glClientWaitSyncAPPLE( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glClientWaitSyncAPPLE( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glClientWaitSyncAPPLE("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glClientWaitSyncAPPLE( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glClientWaitSyncAPPLE( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCLIPCONTROLEXTPROC function_ptr_glClipControlEXT;
+int exists_function_glClipControlEXT(void);
+PFNGLCLIPCONTROLEXTPROC get_function_ptr_glClipControlEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glClipControlEXT(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glClipControlEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glClipControlEXT( argument_0, argument_1, __FILE__, __LINE__, "glClipControlEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glClipControlEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glClipControlEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLCOLORMASKPROC function_ptr_glColorMask;
+int exists_function_glColorMask(void);
+PFNGLCOLORMASKPROC get_function_ptr_glColorMask(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glColorMask(GLboolean  argument_0, GLboolean  argument_1, GLboolean  argument_2, GLboolean  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glColorMask( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glColorMask( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glColorMask("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glColorMask( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glColorMask( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLCOLORMASKIPROC function_ptr_glColorMaski;
+int exists_function_glColorMaski(void);
+PFNGLCOLORMASKIPROC get_function_ptr_glColorMaski(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glColorMaski(GLuint  argument_0, GLboolean  argument_1, GLboolean  argument_2, GLboolean  argument_3, GLboolean  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glColorMaski( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glColorMaski( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glColorMaski("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glColorMaski( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glColorMaski( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCOLORMASKIEXTPROC function_ptr_glColorMaskiEXT;
+int exists_function_glColorMaskiEXT(void);
+PFNGLCOLORMASKIEXTPROC get_function_ptr_glColorMaskiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glColorMaskiEXT(GLuint  argument_0, GLboolean  argument_1, GLboolean  argument_2, GLboolean  argument_3, GLboolean  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glColorMaskiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glColorMaskiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glColorMaskiEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glColorMaskiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glColorMaskiEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCOLORMASKIOESPROC function_ptr_glColorMaskiOES;
+int exists_function_glColorMaskiOES(void);
+PFNGLCOLORMASKIOESPROC get_function_ptr_glColorMaskiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glColorMaskiOES(GLuint  argument_0, GLboolean  argument_1, GLboolean  argument_2, GLboolean  argument_3, GLboolean  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glColorMaskiOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glColorMaskiOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glColorMaskiOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glColorMaskiOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glColorMaskiOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCOMPILESHADERPROC function_ptr_glCompileShader;
+int exists_function_glCompileShader(void);
+PFNGLCOMPILESHADERPROC get_function_ptr_glCompileShader(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompileShader(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCompileShader( argument_0) fastuidraw::gl_binding::debug_function__glCompileShader( argument_0, __FILE__, __LINE__, "glCompileShader("#argument_0")", #argument_0)
+#else
+#define glCompileShader( argument_0) fastuidraw::gl_binding::function_ptr_glCompileShader( argument_0)
+#endif
+
+extern PFNGLCOMPRESSEDTEXIMAGE2DPROC function_ptr_glCompressedTexImage2D;
+int exists_function_glCompressedTexImage2D(void);
+PFNGLCOMPRESSEDTEXIMAGE2DPROC get_function_ptr_glCompressedTexImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexImage2D(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLint  argument_5, GLsizei  argument_6, const void * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glCompressedTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glCompressedTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glCompressedTexImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glCompressedTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glCompressedTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLCOMPRESSEDTEXIMAGE3DPROC function_ptr_glCompressedTexImage3D;
+int exists_function_glCompressedTexImage3D(void);
+PFNGLCOMPRESSEDTEXIMAGE3DPROC get_function_ptr_glCompressedTexImage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexImage3D(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLint  argument_6, GLsizei  argument_7, const void * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glCompressedTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glCompressedTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glCompressedTexImage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glCompressedTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glCompressedTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLCOMPRESSEDTEXIMAGE3DOESPROC function_ptr_glCompressedTexImage3DOES;
+int exists_function_glCompressedTexImage3DOES(void);
+PFNGLCOMPRESSEDTEXIMAGE3DOESPROC get_function_ptr_glCompressedTexImage3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexImage3DOES(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLint  argument_6, GLsizei  argument_7, const void * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glCompressedTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glCompressedTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glCompressedTexImage3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glCompressedTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glCompressedTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC function_ptr_glCompressedTexSubImage2D;
+int exists_function_glCompressedTexSubImage2D(void);
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC get_function_ptr_glCompressedTexSubImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexSubImage2D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLenum  argument_6, GLsizei  argument_7, const void * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glCompressedTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glCompressedTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glCompressedTexSubImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glCompressedTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glCompressedTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC function_ptr_glCompressedTexSubImage3D;
+int exists_function_glCompressedTexSubImage3D(void);
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC get_function_ptr_glCompressedTexSubImage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexSubImage3D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLsizei  argument_9, const void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glCompressedTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glCompressedTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glCompressedTexSubImage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glCompressedTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glCompressedTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC function_ptr_glCompressedTexSubImage3DOES;
+int exists_function_glCompressedTexSubImage3DOES(void);
+PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC get_function_ptr_glCompressedTexSubImage3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCompressedTexSubImage3DOES(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLsizei  argument_9, const void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glCompressedTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glCompressedTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glCompressedTexSubImage3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glCompressedTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glCompressedTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLCONSERVATIVERASTERPARAMETERINVPROC function_ptr_glConservativeRasterParameteriNV;
+int exists_function_glConservativeRasterParameteriNV(void);
+PFNGLCONSERVATIVERASTERPARAMETERINVPROC get_function_ptr_glConservativeRasterParameteriNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glConservativeRasterParameteriNV(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glConservativeRasterParameteriNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glConservativeRasterParameteriNV( argument_0, argument_1, __FILE__, __LINE__, "glConservativeRasterParameteriNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glConservativeRasterParameteriNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glConservativeRasterParameteriNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCOPYBUFFERSUBDATAPROC function_ptr_glCopyBufferSubData;
+int exists_function_glCopyBufferSubData(void);
+PFNGLCOPYBUFFERSUBDATAPROC get_function_ptr_glCopyBufferSubData(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyBufferSubData(GLenum  argument_0, GLenum  argument_1, GLintptr  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glCopyBufferSubData( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glCopyBufferSubData( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glCopyBufferSubData("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glCopyBufferSubData( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glCopyBufferSubData( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCOPYBUFFERSUBDATANVPROC function_ptr_glCopyBufferSubDataNV;
+int exists_function_glCopyBufferSubDataNV(void);
+PFNGLCOPYBUFFERSUBDATANVPROC get_function_ptr_glCopyBufferSubDataNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyBufferSubDataNV(GLenum  argument_0, GLenum  argument_1, GLintptr  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glCopyBufferSubDataNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glCopyBufferSubDataNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glCopyBufferSubDataNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glCopyBufferSubDataNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glCopyBufferSubDataNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLCOPYIMAGESUBDATAPROC function_ptr_glCopyImageSubData;
+int exists_function_glCopyImageSubData(void);
+PFNGLCOPYIMAGESUBDATAPROC get_function_ptr_glCopyImageSubData(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyImageSubData(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLuint  argument_6, GLenum  argument_7, GLint  argument_8, GLint  argument_9, GLint  argument_10, GLint  argument_11, GLsizei  argument_12, GLsizei  argument_13, GLsizei  argument_14, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10, const char *argumentName_11, const char *argumentName_12, const char *argumentName_13, const char *argumentName_14);
+#define glCopyImageSubData( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::debug_function__glCopyImageSubData( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14, __FILE__, __LINE__, "glCopyImageSubData("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10","#argument_11","#argument_12","#argument_13","#argument_14")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10, #argument_11, #argument_12, #argument_13, #argument_14)
+#else
+#define glCopyImageSubData( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::function_ptr_glCopyImageSubData( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14)
+#endif
+
+extern PFNGLCOPYIMAGESUBDATAEXTPROC function_ptr_glCopyImageSubDataEXT;
+int exists_function_glCopyImageSubDataEXT(void);
+PFNGLCOPYIMAGESUBDATAEXTPROC get_function_ptr_glCopyImageSubDataEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyImageSubDataEXT(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLuint  argument_6, GLenum  argument_7, GLint  argument_8, GLint  argument_9, GLint  argument_10, GLint  argument_11, GLsizei  argument_12, GLsizei  argument_13, GLsizei  argument_14, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10, const char *argumentName_11, const char *argumentName_12, const char *argumentName_13, const char *argumentName_14);
+#define glCopyImageSubDataEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::debug_function__glCopyImageSubDataEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14, __FILE__, __LINE__, "glCopyImageSubDataEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10","#argument_11","#argument_12","#argument_13","#argument_14")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10, #argument_11, #argument_12, #argument_13, #argument_14)
+#else
+#define glCopyImageSubDataEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::function_ptr_glCopyImageSubDataEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14)
+#endif
+
+extern PFNGLCOPYIMAGESUBDATAOESPROC function_ptr_glCopyImageSubDataOES;
+int exists_function_glCopyImageSubDataOES(void);
+PFNGLCOPYIMAGESUBDATAOESPROC get_function_ptr_glCopyImageSubDataOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyImageSubDataOES(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLuint  argument_6, GLenum  argument_7, GLint  argument_8, GLint  argument_9, GLint  argument_10, GLint  argument_11, GLsizei  argument_12, GLsizei  argument_13, GLsizei  argument_14, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10, const char *argumentName_11, const char *argumentName_12, const char *argumentName_13, const char *argumentName_14);
+#define glCopyImageSubDataOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::debug_function__glCopyImageSubDataOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14, __FILE__, __LINE__, "glCopyImageSubDataOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10","#argument_11","#argument_12","#argument_13","#argument_14")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10, #argument_11, #argument_12, #argument_13, #argument_14)
+#else
+#define glCopyImageSubDataOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14) fastuidraw::gl_binding::function_ptr_glCopyImageSubDataOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, argument_12, argument_13, argument_14)
+#endif
+
+extern PFNGLCOPYPATHNVPROC function_ptr_glCopyPathNV;
+int exists_function_glCopyPathNV(void);
+PFNGLCOPYPATHNVPROC get_function_ptr_glCopyPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyPathNV(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCopyPathNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCopyPathNV( argument_0, argument_1, __FILE__, __LINE__, "glCopyPathNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCopyPathNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCopyPathNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCOPYTEXIMAGE2DPROC function_ptr_glCopyTexImage2D;
+int exists_function_glCopyTexImage2D(void);
+PFNGLCOPYTEXIMAGE2DPROC get_function_ptr_glCopyTexImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyTexImage2D(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLint  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glCopyTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glCopyTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glCopyTexImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glCopyTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glCopyTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLCOPYTEXSUBIMAGE2DPROC function_ptr_glCopyTexSubImage2D;
+int exists_function_glCopyTexSubImage2D(void);
+PFNGLCOPYTEXSUBIMAGE2DPROC get_function_ptr_glCopyTexSubImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyTexSubImage2D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLsizei  argument_6, GLsizei  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glCopyTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glCopyTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glCopyTexSubImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glCopyTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glCopyTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLCOPYTEXSUBIMAGE3DPROC function_ptr_glCopyTexSubImage3D;
+int exists_function_glCopyTexSubImage3D(void);
+PFNGLCOPYTEXSUBIMAGE3DPROC get_function_ptr_glCopyTexSubImage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyTexSubImage3D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, GLsizei  argument_7, GLsizei  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glCopyTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glCopyTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glCopyTexSubImage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glCopyTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glCopyTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLCOPYTEXSUBIMAGE3DOESPROC function_ptr_glCopyTexSubImage3DOES;
+int exists_function_glCopyTexSubImage3DOES(void);
+PFNGLCOPYTEXSUBIMAGE3DOESPROC get_function_ptr_glCopyTexSubImage3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyTexSubImage3DOES(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, GLsizei  argument_7, GLsizei  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glCopyTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glCopyTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glCopyTexSubImage3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glCopyTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glCopyTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLCOPYTEXTURELEVELSAPPLEPROC function_ptr_glCopyTextureLevelsAPPLE;
+int exists_function_glCopyTextureLevelsAPPLE(void);
+PFNGLCOPYTEXTURELEVELSAPPLEPROC get_function_ptr_glCopyTextureLevelsAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCopyTextureLevelsAPPLE(GLuint  argument_0, GLuint  argument_1, GLint  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glCopyTextureLevelsAPPLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glCopyTextureLevelsAPPLE( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glCopyTextureLevelsAPPLE("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glCopyTextureLevelsAPPLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glCopyTextureLevelsAPPLE( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLCOVERFILLPATHINSTANCEDNVPROC function_ptr_glCoverFillPathInstancedNV;
+int exists_function_glCoverFillPathInstancedNV(void);
+PFNGLCOVERFILLPATHINSTANCEDNVPROC get_function_ptr_glCoverFillPathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverFillPathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLenum  argument_4, GLenum  argument_5, const GLfloat * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glCoverFillPathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLCOVERFILLPATHNVPROC function_ptr_glCoverFillPathNV;
+int exists_function_glCoverFillPathNV(void);
+PFNGLCOVERFILLPATHNVPROC get_function_ptr_glCoverFillPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverFillPathNV(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCoverFillPathNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCoverFillPathNV( argument_0, argument_1, __FILE__, __LINE__, "glCoverFillPathNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCoverFillPathNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCoverFillPathNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCOVERSTROKEPATHINSTANCEDNVPROC function_ptr_glCoverStrokePathInstancedNV;
+int exists_function_glCoverStrokePathInstancedNV(void);
+PFNGLCOVERSTROKEPATHINSTANCEDNVPROC get_function_ptr_glCoverStrokePathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverStrokePathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLenum  argument_4, GLenum  argument_5, const GLfloat * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glCoverStrokePathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLCOVERSTROKEPATHNVPROC function_ptr_glCoverStrokePathNV;
+int exists_function_glCoverStrokePathNV(void);
+PFNGLCOVERSTROKEPATHNVPROC get_function_ptr_glCoverStrokePathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverStrokePathNV(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCoverStrokePathNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCoverStrokePathNV( argument_0, argument_1, __FILE__, __LINE__, "glCoverStrokePathNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCoverStrokePathNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCoverStrokePathNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCOVERAGEMASKNVPROC function_ptr_glCoverageMaskNV;
+int exists_function_glCoverageMaskNV(void);
+PFNGLCOVERAGEMASKNVPROC get_function_ptr_glCoverageMaskNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverageMaskNV(GLboolean  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCoverageMaskNV( argument_0) fastuidraw::gl_binding::debug_function__glCoverageMaskNV( argument_0, __FILE__, __LINE__, "glCoverageMaskNV("#argument_0")", #argument_0)
+#else
+#define glCoverageMaskNV( argument_0) fastuidraw::gl_binding::function_ptr_glCoverageMaskNV( argument_0)
+#endif
+
+extern PFNGLCOVERAGEMODULATIONNVPROC function_ptr_glCoverageModulationNV;
+int exists_function_glCoverageModulationNV(void);
+PFNGLCOVERAGEMODULATIONNVPROC get_function_ptr_glCoverageModulationNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverageModulationNV(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCoverageModulationNV( argument_0) fastuidraw::gl_binding::debug_function__glCoverageModulationNV( argument_0, __FILE__, __LINE__, "glCoverageModulationNV("#argument_0")", #argument_0)
+#else
+#define glCoverageModulationNV( argument_0) fastuidraw::gl_binding::function_ptr_glCoverageModulationNV( argument_0)
+#endif
+
+extern PFNGLCOVERAGEMODULATIONTABLENVPROC function_ptr_glCoverageModulationTableNV;
+int exists_function_glCoverageModulationTableNV(void);
+PFNGLCOVERAGEMODULATIONTABLENVPROC get_function_ptr_glCoverageModulationTableNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverageModulationTableNV(GLsizei  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCoverageModulationTableNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCoverageModulationTableNV( argument_0, argument_1, __FILE__, __LINE__, "glCoverageModulationTableNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCoverageModulationTableNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCoverageModulationTableNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCOVERAGEOPERATIONNVPROC function_ptr_glCoverageOperationNV;
+int exists_function_glCoverageOperationNV(void);
+PFNGLCOVERAGEOPERATIONNVPROC get_function_ptr_glCoverageOperationNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCoverageOperationNV(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCoverageOperationNV( argument_0) fastuidraw::gl_binding::debug_function__glCoverageOperationNV( argument_0, __FILE__, __LINE__, "glCoverageOperationNV("#argument_0")", #argument_0)
+#else
+#define glCoverageOperationNV( argument_0) fastuidraw::gl_binding::function_ptr_glCoverageOperationNV( argument_0)
+#endif
+
+extern PFNGLCREATEMEMORYOBJECTSEXTPROC function_ptr_glCreateMemoryObjectsEXT;
+int exists_function_glCreateMemoryObjectsEXT(void);
+PFNGLCREATEMEMORYOBJECTSEXTPROC get_function_ptr_glCreateMemoryObjectsEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCreateMemoryObjectsEXT(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCreateMemoryObjectsEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCreateMemoryObjectsEXT( argument_0, argument_1, __FILE__, __LINE__, "glCreateMemoryObjectsEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCreateMemoryObjectsEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCreateMemoryObjectsEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLCREATEPERFQUERYINTELPROC function_ptr_glCreatePerfQueryINTEL;
+int exists_function_glCreatePerfQueryINTEL(void);
+PFNGLCREATEPERFQUERYINTELPROC get_function_ptr_glCreatePerfQueryINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCreatePerfQueryINTEL(GLuint  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCreatePerfQueryINTEL( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCreatePerfQueryINTEL( argument_0, argument_1, __FILE__, __LINE__, "glCreatePerfQueryINTEL("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCreatePerfQueryINTEL( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCreatePerfQueryINTEL( argument_0, argument_1)
+#endif
+
+extern PFNGLCREATEPROGRAMPROC function_ptr_glCreateProgram;
+int exists_function_glCreateProgram(void);
+PFNGLCREATEPROGRAMPROC get_function_ptr_glCreateProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glCreateProgram(const char *file, int line, const char *call);
+#define glCreateProgram() fastuidraw::gl_binding::debug_function__glCreateProgram( __FILE__, __LINE__, "glCreateProgram("")")
+#else
+#define glCreateProgram() fastuidraw::gl_binding::function_ptr_glCreateProgram()
+#endif
+
+extern PFNGLCREATESEMAPHORESNVPROC function_ptr_glCreateSemaphoresNV;
+int exists_function_glCreateSemaphoresNV(void);
+PFNGLCREATESEMAPHORESNVPROC get_function_ptr_glCreateSemaphoresNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCreateSemaphoresNV(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glCreateSemaphoresNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glCreateSemaphoresNV( argument_0, argument_1, __FILE__, __LINE__, "glCreateSemaphoresNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glCreateSemaphoresNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glCreateSemaphoresNV( argument_0, argument_1)
+#endif
+
+extern PFNGLCREATESHADERPROC function_ptr_glCreateShader;
+int exists_function_glCreateShader(void);
+PFNGLCREATESHADERPROC get_function_ptr_glCreateShader(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glCreateShader(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCreateShader( argument_0) fastuidraw::gl_binding::debug_function__glCreateShader( argument_0, __FILE__, __LINE__, "glCreateShader("#argument_0")", #argument_0)
+#else
+#define glCreateShader( argument_0) fastuidraw::gl_binding::function_ptr_glCreateShader( argument_0)
+#endif
+
+extern PFNGLCREATESHADERPROGRAMVPROC function_ptr_glCreateShaderProgramv;
+int exists_function_glCreateShaderProgramv(void);
+PFNGLCREATESHADERPROGRAMVPROC get_function_ptr_glCreateShaderProgramv(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glCreateShaderProgramv(GLenum  argument_0, GLsizei  argument_1, const GLchar *const* argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glCreateShaderProgramv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glCreateShaderProgramv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glCreateShaderProgramv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glCreateShaderProgramv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glCreateShaderProgramv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCREATESHADERPROGRAMVEXTPROC function_ptr_glCreateShaderProgramvEXT;
+int exists_function_glCreateShaderProgramvEXT(void);
+PFNGLCREATESHADERPROGRAMVEXTPROC get_function_ptr_glCreateShaderProgramvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glCreateShaderProgramvEXT(GLenum  argument_0, GLsizei  argument_1, const GLchar ** argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glCreateShaderProgramvEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glCreateShaderProgramvEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glCreateShaderProgramvEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glCreateShaderProgramvEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glCreateShaderProgramvEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLCULLFACEPROC function_ptr_glCullFace;
+int exists_function_glCullFace(void);
+PFNGLCULLFACEPROC get_function_ptr_glCullFace(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glCullFace(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glCullFace( argument_0) fastuidraw::gl_binding::debug_function__glCullFace( argument_0, __FILE__, __LINE__, "glCullFace("#argument_0")", #argument_0)
+#else
+#define glCullFace( argument_0) fastuidraw::gl_binding::function_ptr_glCullFace( argument_0)
+#endif
+
+extern PFNGLDEBUGMESSAGECALLBACKPROC function_ptr_glDebugMessageCallback;
+int exists_function_glDebugMessageCallback(void);
+PFNGLDEBUGMESSAGECALLBACKPROC get_function_ptr_glDebugMessageCallback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageCallback(GLDEBUGPROC  argument_0, const void * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDebugMessageCallback( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDebugMessageCallback( argument_0, argument_1, __FILE__, __LINE__, "glDebugMessageCallback("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDebugMessageCallback( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDebugMessageCallback( argument_0, argument_1)
+#endif
+
+extern PFNGLDEBUGMESSAGECALLBACKKHRPROC function_ptr_glDebugMessageCallbackKHR;
+int exists_function_glDebugMessageCallbackKHR(void);
+PFNGLDEBUGMESSAGECALLBACKKHRPROC get_function_ptr_glDebugMessageCallbackKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageCallbackKHR(GLDEBUGPROCKHR  argument_0, const void * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDebugMessageCallbackKHR( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDebugMessageCallbackKHR( argument_0, argument_1, __FILE__, __LINE__, "glDebugMessageCallbackKHR("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDebugMessageCallbackKHR( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDebugMessageCallbackKHR( argument_0, argument_1)
+#endif
+
+extern PFNGLDEBUGMESSAGECONTROLPROC function_ptr_glDebugMessageControl;
+int exists_function_glDebugMessageControl(void);
+PFNGLDEBUGMESSAGECONTROLPROC get_function_ptr_glDebugMessageControl(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageControl(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLsizei  argument_3, const GLuint * argument_4, GLboolean  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDebugMessageControl( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDebugMessageControl( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDebugMessageControl("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDebugMessageControl( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDebugMessageControl( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDEBUGMESSAGECONTROLKHRPROC function_ptr_glDebugMessageControlKHR;
+int exists_function_glDebugMessageControlKHR(void);
+PFNGLDEBUGMESSAGECONTROLKHRPROC get_function_ptr_glDebugMessageControlKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageControlKHR(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLsizei  argument_3, const GLuint * argument_4, GLboolean  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDebugMessageControlKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDebugMessageControlKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDebugMessageControlKHR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDebugMessageControlKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDebugMessageControlKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDEBUGMESSAGEINSERTPROC function_ptr_glDebugMessageInsert;
+int exists_function_glDebugMessageInsert(void);
+PFNGLDEBUGMESSAGEINSERTPROC get_function_ptr_glDebugMessageInsert(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageInsert(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLenum  argument_3, GLsizei  argument_4, const GLchar * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDebugMessageInsert( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDebugMessageInsert( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDebugMessageInsert("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDebugMessageInsert( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDebugMessageInsert( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDEBUGMESSAGEINSERTKHRPROC function_ptr_glDebugMessageInsertKHR;
+int exists_function_glDebugMessageInsertKHR(void);
+PFNGLDEBUGMESSAGEINSERTKHRPROC get_function_ptr_glDebugMessageInsertKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDebugMessageInsertKHR(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLenum  argument_3, GLsizei  argument_4, const GLchar * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDebugMessageInsertKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDebugMessageInsertKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDebugMessageInsertKHR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDebugMessageInsertKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDebugMessageInsertKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDELETEBUFFERSPROC function_ptr_glDeleteBuffers;
+int exists_function_glDeleteBuffers(void);
+PFNGLDELETEBUFFERSPROC get_function_ptr_glDeleteBuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteBuffers(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteBuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteBuffers( argument_0, argument_1, __FILE__, __LINE__, "glDeleteBuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteBuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteBuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEFENCESNVPROC function_ptr_glDeleteFencesNV;
+int exists_function_glDeleteFencesNV(void);
+PFNGLDELETEFENCESNVPROC get_function_ptr_glDeleteFencesNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteFencesNV(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteFencesNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteFencesNV( argument_0, argument_1, __FILE__, __LINE__, "glDeleteFencesNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteFencesNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteFencesNV( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEFRAMEBUFFERSPROC function_ptr_glDeleteFramebuffers;
+int exists_function_glDeleteFramebuffers(void);
+PFNGLDELETEFRAMEBUFFERSPROC get_function_ptr_glDeleteFramebuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteFramebuffers(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteFramebuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteFramebuffers( argument_0, argument_1, __FILE__, __LINE__, "glDeleteFramebuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteFramebuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteFramebuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEMEMORYOBJECTSEXTPROC function_ptr_glDeleteMemoryObjectsEXT;
+int exists_function_glDeleteMemoryObjectsEXT(void);
+PFNGLDELETEMEMORYOBJECTSEXTPROC get_function_ptr_glDeleteMemoryObjectsEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteMemoryObjectsEXT(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteMemoryObjectsEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteMemoryObjectsEXT( argument_0, argument_1, __FILE__, __LINE__, "glDeleteMemoryObjectsEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteMemoryObjectsEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteMemoryObjectsEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEPATHSNVPROC function_ptr_glDeletePathsNV;
+int exists_function_glDeletePathsNV(void);
+PFNGLDELETEPATHSNVPROC get_function_ptr_glDeletePathsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeletePathsNV(GLuint  argument_0, GLsizei  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeletePathsNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeletePathsNV( argument_0, argument_1, __FILE__, __LINE__, "glDeletePathsNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeletePathsNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeletePathsNV( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEPERFMONITORSAMDPROC function_ptr_glDeletePerfMonitorsAMD;
+int exists_function_glDeletePerfMonitorsAMD(void);
+PFNGLDELETEPERFMONITORSAMDPROC get_function_ptr_glDeletePerfMonitorsAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeletePerfMonitorsAMD(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeletePerfMonitorsAMD( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeletePerfMonitorsAMD( argument_0, argument_1, __FILE__, __LINE__, "glDeletePerfMonitorsAMD("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeletePerfMonitorsAMD( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeletePerfMonitorsAMD( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEPERFQUERYINTELPROC function_ptr_glDeletePerfQueryINTEL;
+int exists_function_glDeletePerfQueryINTEL(void);
+PFNGLDELETEPERFQUERYINTELPROC get_function_ptr_glDeletePerfQueryINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeletePerfQueryINTEL(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDeletePerfQueryINTEL( argument_0) fastuidraw::gl_binding::debug_function__glDeletePerfQueryINTEL( argument_0, __FILE__, __LINE__, "glDeletePerfQueryINTEL("#argument_0")", #argument_0)
+#else
+#define glDeletePerfQueryINTEL( argument_0) fastuidraw::gl_binding::function_ptr_glDeletePerfQueryINTEL( argument_0)
+#endif
+
+extern PFNGLDELETEPROGRAMPROC function_ptr_glDeleteProgram;
+int exists_function_glDeleteProgram(void);
+PFNGLDELETEPROGRAMPROC get_function_ptr_glDeleteProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteProgram(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDeleteProgram( argument_0) fastuidraw::gl_binding::debug_function__glDeleteProgram( argument_0, __FILE__, __LINE__, "glDeleteProgram("#argument_0")", #argument_0)
+#else
+#define glDeleteProgram( argument_0) fastuidraw::gl_binding::function_ptr_glDeleteProgram( argument_0)
+#endif
+
+extern PFNGLDELETEPROGRAMPIPELINESPROC function_ptr_glDeleteProgramPipelines;
+int exists_function_glDeleteProgramPipelines(void);
+PFNGLDELETEPROGRAMPIPELINESPROC get_function_ptr_glDeleteProgramPipelines(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteProgramPipelines(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteProgramPipelines( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteProgramPipelines( argument_0, argument_1, __FILE__, __LINE__, "glDeleteProgramPipelines("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteProgramPipelines( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteProgramPipelines( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEPROGRAMPIPELINESEXTPROC function_ptr_glDeleteProgramPipelinesEXT;
+int exists_function_glDeleteProgramPipelinesEXT(void);
+PFNGLDELETEPROGRAMPIPELINESEXTPROC get_function_ptr_glDeleteProgramPipelinesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteProgramPipelinesEXT(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteProgramPipelinesEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteProgramPipelinesEXT( argument_0, argument_1, __FILE__, __LINE__, "glDeleteProgramPipelinesEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteProgramPipelinesEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteProgramPipelinesEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEQUERIESPROC function_ptr_glDeleteQueries;
+int exists_function_glDeleteQueries(void);
+PFNGLDELETEQUERIESPROC get_function_ptr_glDeleteQueries(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteQueries(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteQueries( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteQueries( argument_0, argument_1, __FILE__, __LINE__, "glDeleteQueries("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteQueries( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteQueries( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEQUERIESEXTPROC function_ptr_glDeleteQueriesEXT;
+int exists_function_glDeleteQueriesEXT(void);
+PFNGLDELETEQUERIESEXTPROC get_function_ptr_glDeleteQueriesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteQueriesEXT(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteQueriesEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteQueriesEXT( argument_0, argument_1, __FILE__, __LINE__, "glDeleteQueriesEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteQueriesEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteQueriesEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETERENDERBUFFERSPROC function_ptr_glDeleteRenderbuffers;
+int exists_function_glDeleteRenderbuffers(void);
+PFNGLDELETERENDERBUFFERSPROC get_function_ptr_glDeleteRenderbuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteRenderbuffers(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteRenderbuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteRenderbuffers( argument_0, argument_1, __FILE__, __LINE__, "glDeleteRenderbuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteRenderbuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteRenderbuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETESAMPLERSPROC function_ptr_glDeleteSamplers;
+int exists_function_glDeleteSamplers(void);
+PFNGLDELETESAMPLERSPROC get_function_ptr_glDeleteSamplers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteSamplers(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteSamplers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteSamplers( argument_0, argument_1, __FILE__, __LINE__, "glDeleteSamplers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteSamplers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteSamplers( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETESEMAPHORESEXTPROC function_ptr_glDeleteSemaphoresEXT;
+int exists_function_glDeleteSemaphoresEXT(void);
+PFNGLDELETESEMAPHORESEXTPROC get_function_ptr_glDeleteSemaphoresEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteSemaphoresEXT(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteSemaphoresEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteSemaphoresEXT( argument_0, argument_1, __FILE__, __LINE__, "glDeleteSemaphoresEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteSemaphoresEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteSemaphoresEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETESHADERPROC function_ptr_glDeleteShader;
+int exists_function_glDeleteShader(void);
+PFNGLDELETESHADERPROC get_function_ptr_glDeleteShader(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteShader(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDeleteShader( argument_0) fastuidraw::gl_binding::debug_function__glDeleteShader( argument_0, __FILE__, __LINE__, "glDeleteShader("#argument_0")", #argument_0)
+#else
+#define glDeleteShader( argument_0) fastuidraw::gl_binding::function_ptr_glDeleteShader( argument_0)
+#endif
+
+extern PFNGLDELETESYNCPROC function_ptr_glDeleteSync;
+int exists_function_glDeleteSync(void);
+PFNGLDELETESYNCPROC get_function_ptr_glDeleteSync(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteSync(GLsync  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDeleteSync( argument_0) fastuidraw::gl_binding::debug_function__glDeleteSync( argument_0, __FILE__, __LINE__, "glDeleteSync("#argument_0")", #argument_0)
+#else
+#define glDeleteSync( argument_0) fastuidraw::gl_binding::function_ptr_glDeleteSync( argument_0)
+#endif
+
+extern PFNGLDELETESYNCAPPLEPROC function_ptr_glDeleteSyncAPPLE;
+int exists_function_glDeleteSyncAPPLE(void);
+PFNGLDELETESYNCAPPLEPROC get_function_ptr_glDeleteSyncAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteSyncAPPLE(GLsync  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDeleteSyncAPPLE( argument_0) fastuidraw::gl_binding::debug_function__glDeleteSyncAPPLE( argument_0, __FILE__, __LINE__, "glDeleteSyncAPPLE("#argument_0")", #argument_0)
+#else
+#define glDeleteSyncAPPLE( argument_0) fastuidraw::gl_binding::function_ptr_glDeleteSyncAPPLE( argument_0)
+#endif
+
+extern PFNGLDELETETEXTURESPROC function_ptr_glDeleteTextures;
+int exists_function_glDeleteTextures(void);
+PFNGLDELETETEXTURESPROC get_function_ptr_glDeleteTextures(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteTextures(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteTextures( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteTextures( argument_0, argument_1, __FILE__, __LINE__, "glDeleteTextures("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteTextures( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteTextures( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETETRANSFORMFEEDBACKSPROC function_ptr_glDeleteTransformFeedbacks;
+int exists_function_glDeleteTransformFeedbacks(void);
+PFNGLDELETETRANSFORMFEEDBACKSPROC get_function_ptr_glDeleteTransformFeedbacks(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteTransformFeedbacks(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteTransformFeedbacks( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteTransformFeedbacks( argument_0, argument_1, __FILE__, __LINE__, "glDeleteTransformFeedbacks("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteTransformFeedbacks( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteTransformFeedbacks( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEVERTEXARRAYSPROC function_ptr_glDeleteVertexArrays;
+int exists_function_glDeleteVertexArrays(void);
+PFNGLDELETEVERTEXARRAYSPROC get_function_ptr_glDeleteVertexArrays(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteVertexArrays(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteVertexArrays( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteVertexArrays( argument_0, argument_1, __FILE__, __LINE__, "glDeleteVertexArrays("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteVertexArrays( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteVertexArrays( argument_0, argument_1)
+#endif
+
+extern PFNGLDELETEVERTEXARRAYSOESPROC function_ptr_glDeleteVertexArraysOES;
+int exists_function_glDeleteVertexArraysOES(void);
+PFNGLDELETEVERTEXARRAYSOESPROC get_function_ptr_glDeleteVertexArraysOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDeleteVertexArraysOES(GLsizei  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDeleteVertexArraysOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDeleteVertexArraysOES( argument_0, argument_1, __FILE__, __LINE__, "glDeleteVertexArraysOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDeleteVertexArraysOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDeleteVertexArraysOES( argument_0, argument_1)
+#endif
+
+extern PFNGLDEPTHFUNCPROC function_ptr_glDepthFunc;
+int exists_function_glDepthFunc(void);
+PFNGLDEPTHFUNCPROC get_function_ptr_glDepthFunc(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthFunc(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDepthFunc( argument_0) fastuidraw::gl_binding::debug_function__glDepthFunc( argument_0, __FILE__, __LINE__, "glDepthFunc("#argument_0")", #argument_0)
+#else
+#define glDepthFunc( argument_0) fastuidraw::gl_binding::function_ptr_glDepthFunc( argument_0)
+#endif
+
+extern PFNGLDEPTHMASKPROC function_ptr_glDepthMask;
+int exists_function_glDepthMask(void);
+PFNGLDEPTHMASKPROC get_function_ptr_glDepthMask(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthMask(GLboolean  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDepthMask( argument_0) fastuidraw::gl_binding::debug_function__glDepthMask( argument_0, __FILE__, __LINE__, "glDepthMask("#argument_0")", #argument_0)
+#else
+#define glDepthMask( argument_0) fastuidraw::gl_binding::function_ptr_glDepthMask( argument_0)
+#endif
+
+extern PFNGLDEPTHRANGEARRAYFVNVPROC function_ptr_glDepthRangeArrayfvNV;
+int exists_function_glDepthRangeArrayfvNV(void);
+PFNGLDEPTHRANGEARRAYFVNVPROC get_function_ptr_glDepthRangeArrayfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthRangeArrayfvNV(GLuint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDepthRangeArrayfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDepthRangeArrayfvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDepthRangeArrayfvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDepthRangeArrayfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDepthRangeArrayfvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDEPTHRANGEARRAYFVOESPROC function_ptr_glDepthRangeArrayfvOES;
+int exists_function_glDepthRangeArrayfvOES(void);
+PFNGLDEPTHRANGEARRAYFVOESPROC get_function_ptr_glDepthRangeArrayfvOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthRangeArrayfvOES(GLuint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDepthRangeArrayfvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDepthRangeArrayfvOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDepthRangeArrayfvOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDepthRangeArrayfvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDepthRangeArrayfvOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDEPTHRANGEINDEXEDFNVPROC function_ptr_glDepthRangeIndexedfNV;
+int exists_function_glDepthRangeIndexedfNV(void);
+PFNGLDEPTHRANGEINDEXEDFNVPROC get_function_ptr_glDepthRangeIndexedfNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthRangeIndexedfNV(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDepthRangeIndexedfNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDepthRangeIndexedfNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDepthRangeIndexedfNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDepthRangeIndexedfNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDepthRangeIndexedfNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDEPTHRANGEINDEXEDFOESPROC function_ptr_glDepthRangeIndexedfOES;
+int exists_function_glDepthRangeIndexedfOES(void);
+PFNGLDEPTHRANGEINDEXEDFOESPROC get_function_ptr_glDepthRangeIndexedfOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthRangeIndexedfOES(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDepthRangeIndexedfOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDepthRangeIndexedfOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDepthRangeIndexedfOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDepthRangeIndexedfOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDepthRangeIndexedfOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDEPTHRANGEFPROC function_ptr_glDepthRangef;
+int exists_function_glDepthRangef(void);
+PFNGLDEPTHRANGEFPROC get_function_ptr_glDepthRangef(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDepthRangef(GLfloat  argument_0, GLfloat  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDepthRangef( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDepthRangef( argument_0, argument_1, __FILE__, __LINE__, "glDepthRangef("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDepthRangef( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDepthRangef( argument_0, argument_1)
+#endif
+
+extern PFNGLDETACHSHADERPROC function_ptr_glDetachShader;
+int exists_function_glDetachShader(void);
+PFNGLDETACHSHADERPROC get_function_ptr_glDetachShader(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDetachShader(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDetachShader( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDetachShader( argument_0, argument_1, __FILE__, __LINE__, "glDetachShader("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDetachShader( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDetachShader( argument_0, argument_1)
+#endif
+
+extern PFNGLDISABLEPROC function_ptr_glDisable;
+int exists_function_glDisable(void);
+PFNGLDISABLEPROC get_function_ptr_glDisable(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisable(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDisable( argument_0) fastuidraw::gl_binding::debug_function__glDisable( argument_0, __FILE__, __LINE__, "glDisable("#argument_0")", #argument_0)
+#else
+#define glDisable( argument_0) fastuidraw::gl_binding::function_ptr_glDisable( argument_0)
+#endif
+
+extern PFNGLDISABLEDRIVERCONTROLQCOMPROC function_ptr_glDisableDriverControlQCOM;
+int exists_function_glDisableDriverControlQCOM(void);
+PFNGLDISABLEDRIVERCONTROLQCOMPROC get_function_ptr_glDisableDriverControlQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisableDriverControlQCOM(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDisableDriverControlQCOM( argument_0) fastuidraw::gl_binding::debug_function__glDisableDriverControlQCOM( argument_0, __FILE__, __LINE__, "glDisableDriverControlQCOM("#argument_0")", #argument_0)
+#else
+#define glDisableDriverControlQCOM( argument_0) fastuidraw::gl_binding::function_ptr_glDisableDriverControlQCOM( argument_0)
+#endif
+
+extern PFNGLDISABLEVERTEXATTRIBARRAYPROC function_ptr_glDisableVertexAttribArray;
+int exists_function_glDisableVertexAttribArray(void);
+PFNGLDISABLEVERTEXATTRIBARRAYPROC get_function_ptr_glDisableVertexAttribArray(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisableVertexAttribArray(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDisableVertexAttribArray( argument_0) fastuidraw::gl_binding::debug_function__glDisableVertexAttribArray( argument_0, __FILE__, __LINE__, "glDisableVertexAttribArray("#argument_0")", #argument_0)
+#else
+#define glDisableVertexAttribArray( argument_0) fastuidraw::gl_binding::function_ptr_glDisableVertexAttribArray( argument_0)
+#endif
+
+extern PFNGLDISABLEIPROC function_ptr_glDisablei;
+int exists_function_glDisablei(void);
+PFNGLDISABLEIPROC get_function_ptr_glDisablei(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisablei(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDisablei( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDisablei( argument_0, argument_1, __FILE__, __LINE__, "glDisablei("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDisablei( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDisablei( argument_0, argument_1)
+#endif
+
+extern PFNGLDISABLEIEXTPROC function_ptr_glDisableiEXT;
+int exists_function_glDisableiEXT(void);
+PFNGLDISABLEIEXTPROC get_function_ptr_glDisableiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisableiEXT(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDisableiEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDisableiEXT( argument_0, argument_1, __FILE__, __LINE__, "glDisableiEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDisableiEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDisableiEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDISABLEINVPROC function_ptr_glDisableiNV;
+int exists_function_glDisableiNV(void);
+PFNGLDISABLEINVPROC get_function_ptr_glDisableiNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisableiNV(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDisableiNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDisableiNV( argument_0, argument_1, __FILE__, __LINE__, "glDisableiNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDisableiNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDisableiNV( argument_0, argument_1)
+#endif
+
+extern PFNGLDISABLEIOESPROC function_ptr_glDisableiOES;
+int exists_function_glDisableiOES(void);
+PFNGLDISABLEIOESPROC get_function_ptr_glDisableiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDisableiOES(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDisableiOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDisableiOES( argument_0, argument_1, __FILE__, __LINE__, "glDisableiOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDisableiOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDisableiOES( argument_0, argument_1)
+#endif
+
+extern PFNGLDISCARDFRAMEBUFFEREXTPROC function_ptr_glDiscardFramebufferEXT;
+int exists_function_glDiscardFramebufferEXT(void);
+PFNGLDISCARDFRAMEBUFFEREXTPROC get_function_ptr_glDiscardFramebufferEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDiscardFramebufferEXT(GLenum  argument_0, GLsizei  argument_1, const GLenum * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDiscardFramebufferEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDiscardFramebufferEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDiscardFramebufferEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDiscardFramebufferEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDiscardFramebufferEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDISPATCHCOMPUTEPROC function_ptr_glDispatchCompute;
+int exists_function_glDispatchCompute(void);
+PFNGLDISPATCHCOMPUTEPROC get_function_ptr_glDispatchCompute(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDispatchCompute(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDispatchCompute( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDispatchCompute( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDispatchCompute("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDispatchCompute( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDispatchCompute( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDISPATCHCOMPUTEINDIRECTPROC function_ptr_glDispatchComputeIndirect;
+int exists_function_glDispatchComputeIndirect(void);
+PFNGLDISPATCHCOMPUTEINDIRECTPROC get_function_ptr_glDispatchComputeIndirect(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDispatchComputeIndirect(GLintptr  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDispatchComputeIndirect( argument_0) fastuidraw::gl_binding::debug_function__glDispatchComputeIndirect( argument_0, __FILE__, __LINE__, "glDispatchComputeIndirect("#argument_0")", #argument_0)
+#else
+#define glDispatchComputeIndirect( argument_0) fastuidraw::gl_binding::function_ptr_glDispatchComputeIndirect( argument_0)
+#endif
+
+extern PFNGLDRAWARRAYSPROC function_ptr_glDrawArrays;
+int exists_function_glDrawArrays(void);
+PFNGLDRAWARRAYSPROC get_function_ptr_glDrawArrays(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArrays(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDrawArrays( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDrawArrays( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDrawArrays("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDrawArrays( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDrawArrays( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDRAWARRAYSINDIRECTPROC function_ptr_glDrawArraysIndirect;
+int exists_function_glDrawArraysIndirect(void);
+PFNGLDRAWARRAYSINDIRECTPROC get_function_ptr_glDrawArraysIndirect(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysIndirect(GLenum  argument_0, const void * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawArraysIndirect( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawArraysIndirect( argument_0, argument_1, __FILE__, __LINE__, "glDrawArraysIndirect("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawArraysIndirect( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawArraysIndirect( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWARRAYSINSTANCEDPROC function_ptr_glDrawArraysInstanced;
+int exists_function_glDrawArraysInstanced(void);
+PFNGLDRAWARRAYSINSTANCEDPROC get_function_ptr_glDrawArraysInstanced(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysInstanced(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glDrawArraysInstanced( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glDrawArraysInstanced( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glDrawArraysInstanced("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glDrawArraysInstanced( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glDrawArraysInstanced( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLDRAWARRAYSINSTANCEDANGLEPROC function_ptr_glDrawArraysInstancedANGLE;
+int exists_function_glDrawArraysInstancedANGLE(void);
+PFNGLDRAWARRAYSINSTANCEDANGLEPROC get_function_ptr_glDrawArraysInstancedANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysInstancedANGLE(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glDrawArraysInstancedANGLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glDrawArraysInstancedANGLE( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glDrawArraysInstancedANGLE("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glDrawArraysInstancedANGLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glDrawArraysInstancedANGLE( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC function_ptr_glDrawArraysInstancedBaseInstanceEXT;
+int exists_function_glDrawArraysInstancedBaseInstanceEXT(void);
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC get_function_ptr_glDrawArraysInstancedBaseInstanceEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysInstancedBaseInstanceEXT(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawArraysInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawArraysInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawArraysInstancedBaseInstanceEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawArraysInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawArraysInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWARRAYSINSTANCEDEXTPROC function_ptr_glDrawArraysInstancedEXT;
+int exists_function_glDrawArraysInstancedEXT(void);
+PFNGLDRAWARRAYSINSTANCEDEXTPROC get_function_ptr_glDrawArraysInstancedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysInstancedEXT(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glDrawArraysInstancedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glDrawArraysInstancedEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glDrawArraysInstancedEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glDrawArraysInstancedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glDrawArraysInstancedEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLDRAWARRAYSINSTANCEDNVPROC function_ptr_glDrawArraysInstancedNV;
+int exists_function_glDrawArraysInstancedNV(void);
+PFNGLDRAWARRAYSINSTANCEDNVPROC get_function_ptr_glDrawArraysInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawArraysInstancedNV(GLenum  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glDrawArraysInstancedNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glDrawArraysInstancedNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glDrawArraysInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glDrawArraysInstancedNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glDrawArraysInstancedNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLDRAWBUFFERSPROC function_ptr_glDrawBuffers;
+int exists_function_glDrawBuffers(void);
+PFNGLDRAWBUFFERSPROC get_function_ptr_glDrawBuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawBuffers(GLsizei  argument_0, const GLenum * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawBuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawBuffers( argument_0, argument_1, __FILE__, __LINE__, "glDrawBuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawBuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawBuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWBUFFERSEXTPROC function_ptr_glDrawBuffersEXT;
+int exists_function_glDrawBuffersEXT(void);
+PFNGLDRAWBUFFERSEXTPROC get_function_ptr_glDrawBuffersEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawBuffersEXT(GLsizei  argument_0, const GLenum * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawBuffersEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawBuffersEXT( argument_0, argument_1, __FILE__, __LINE__, "glDrawBuffersEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawBuffersEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawBuffersEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWBUFFERSINDEXEDEXTPROC function_ptr_glDrawBuffersIndexedEXT;
+int exists_function_glDrawBuffersIndexedEXT(void);
+PFNGLDRAWBUFFERSINDEXEDEXTPROC get_function_ptr_glDrawBuffersIndexedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawBuffersIndexedEXT(GLint  argument_0, const GLenum * argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDrawBuffersIndexedEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDrawBuffersIndexedEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDrawBuffersIndexedEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDrawBuffersIndexedEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDrawBuffersIndexedEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDRAWBUFFERSNVPROC function_ptr_glDrawBuffersNV;
+int exists_function_glDrawBuffersNV(void);
+PFNGLDRAWBUFFERSNVPROC get_function_ptr_glDrawBuffersNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawBuffersNV(GLsizei  argument_0, const GLenum * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawBuffersNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawBuffersNV( argument_0, argument_1, __FILE__, __LINE__, "glDrawBuffersNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawBuffersNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawBuffersNV( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWELEMENTSPROC function_ptr_glDrawElements;
+int exists_function_glDrawElements(void);
+PFNGLDRAWELEMENTSPROC get_function_ptr_glDrawElements(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElements(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glDrawElements( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glDrawElements( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glDrawElements("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glDrawElements( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glDrawElements( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLDRAWELEMENTSBASEVERTEXPROC function_ptr_glDrawElementsBaseVertex;
+int exists_function_glDrawElementsBaseVertex(void);
+PFNGLDRAWELEMENTSBASEVERTEXPROC get_function_ptr_glDrawElementsBaseVertex(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsBaseVertex(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsBaseVertex("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSBASEVERTEXEXTPROC function_ptr_glDrawElementsBaseVertexEXT;
+int exists_function_glDrawElementsBaseVertexEXT(void);
+PFNGLDRAWELEMENTSBASEVERTEXEXTPROC get_function_ptr_glDrawElementsBaseVertexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsBaseVertexEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsBaseVertexEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSBASEVERTEXOESPROC function_ptr_glDrawElementsBaseVertexOES;
+int exists_function_glDrawElementsBaseVertexOES(void);
+PFNGLDRAWELEMENTSBASEVERTEXOESPROC get_function_ptr_glDrawElementsBaseVertexOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsBaseVertexOES(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsBaseVertexOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSINDIRECTPROC function_ptr_glDrawElementsIndirect;
+int exists_function_glDrawElementsIndirect(void);
+PFNGLDRAWELEMENTSINDIRECTPROC get_function_ptr_glDrawElementsIndirect(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsIndirect(GLenum  argument_0, GLenum  argument_1, const void * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDrawElementsIndirect( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDrawElementsIndirect( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDrawElementsIndirect("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDrawElementsIndirect( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDrawElementsIndirect( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDPROC function_ptr_glDrawElementsInstanced;
+int exists_function_glDrawElementsInstanced(void);
+PFNGLDRAWELEMENTSINSTANCEDPROC get_function_ptr_glDrawElementsInstanced(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstanced(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsInstanced( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsInstanced( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsInstanced("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsInstanced( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsInstanced( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDANGLEPROC function_ptr_glDrawElementsInstancedANGLE;
+int exists_function_glDrawElementsInstancedANGLE(void);
+PFNGLDRAWELEMENTSINSTANCEDANGLEPROC get_function_ptr_glDrawElementsInstancedANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedANGLE(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsInstancedANGLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsInstancedANGLE("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsInstancedANGLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedANGLE( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC function_ptr_glDrawElementsInstancedBaseInstanceEXT;
+int exists_function_glDrawElementsInstancedBaseInstanceEXT(void);
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC get_function_ptr_glDrawElementsInstancedBaseInstanceEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedBaseInstanceEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, GLuint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDrawElementsInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDrawElementsInstancedBaseInstanceEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDrawElementsInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC function_ptr_glDrawElementsInstancedBaseVertex;
+int exists_function_glDrawElementsInstancedBaseVertex(void);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC get_function_ptr_glDrawElementsInstancedBaseVertex(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedBaseVertex(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDrawElementsInstancedBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDrawElementsInstancedBaseVertex("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDrawElementsInstancedBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC function_ptr_glDrawElementsInstancedBaseVertexBaseInstanceEXT;
+int exists_function_glDrawElementsInstancedBaseVertexBaseInstanceEXT(void);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC get_function_ptr_glDrawElementsInstancedBaseVertexBaseInstanceEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, GLint  argument_5, GLuint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glDrawElementsInstancedBaseVertexBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedBaseVertexBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glDrawElementsInstancedBaseVertexBaseInstanceEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glDrawElementsInstancedBaseVertexBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedBaseVertexBaseInstanceEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXEXTPROC function_ptr_glDrawElementsInstancedBaseVertexEXT;
+int exists_function_glDrawElementsInstancedBaseVertexEXT(void);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXEXTPROC get_function_ptr_glDrawElementsInstancedBaseVertexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedBaseVertexEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDrawElementsInstancedBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDrawElementsInstancedBaseVertexEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDrawElementsInstancedBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXOESPROC function_ptr_glDrawElementsInstancedBaseVertexOES;
+int exists_function_glDrawElementsInstancedBaseVertexOES(void);
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXOESPROC get_function_ptr_glDrawElementsInstancedBaseVertexOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedBaseVertexOES(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDrawElementsInstancedBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDrawElementsInstancedBaseVertexOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDrawElementsInstancedBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDEXTPROC function_ptr_glDrawElementsInstancedEXT;
+int exists_function_glDrawElementsInstancedEXT(void);
+PFNGLDRAWELEMENTSINSTANCEDEXTPROC get_function_ptr_glDrawElementsInstancedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsInstancedEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsInstancedEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsInstancedEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWELEMENTSINSTANCEDNVPROC function_ptr_glDrawElementsInstancedNV;
+int exists_function_glDrawElementsInstancedNV(void);
+PFNGLDRAWELEMENTSINSTANCEDNVPROC get_function_ptr_glDrawElementsInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawElementsInstancedNV(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glDrawElementsInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glDrawElementsInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glDrawElementsInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glDrawElementsInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glDrawElementsInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLDRAWMESHTASKSINDIRECTNVPROC function_ptr_glDrawMeshTasksIndirectNV;
+int exists_function_glDrawMeshTasksIndirectNV(void);
+PFNGLDRAWMESHTASKSINDIRECTNVPROC get_function_ptr_glDrawMeshTasksIndirectNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawMeshTasksIndirectNV(GLintptr  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glDrawMeshTasksIndirectNV( argument_0) fastuidraw::gl_binding::debug_function__glDrawMeshTasksIndirectNV( argument_0, __FILE__, __LINE__, "glDrawMeshTasksIndirectNV("#argument_0")", #argument_0)
+#else
+#define glDrawMeshTasksIndirectNV( argument_0) fastuidraw::gl_binding::function_ptr_glDrawMeshTasksIndirectNV( argument_0)
+#endif
+
+extern PFNGLDRAWMESHTASKSNVPROC function_ptr_glDrawMeshTasksNV;
+int exists_function_glDrawMeshTasksNV(void);
+PFNGLDRAWMESHTASKSNVPROC get_function_ptr_glDrawMeshTasksNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawMeshTasksNV(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawMeshTasksNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawMeshTasksNV( argument_0, argument_1, __FILE__, __LINE__, "glDrawMeshTasksNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawMeshTasksNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawMeshTasksNV( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWRANGEELEMENTSPROC function_ptr_glDrawRangeElements;
+int exists_function_glDrawRangeElements(void);
+PFNGLDRAWRANGEELEMENTSPROC get_function_ptr_glDrawRangeElements(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawRangeElements(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLsizei  argument_3, GLenum  argument_4, const void * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glDrawRangeElements( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glDrawRangeElements( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glDrawRangeElements("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glDrawRangeElements( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glDrawRangeElements( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC function_ptr_glDrawRangeElementsBaseVertex;
+int exists_function_glDrawRangeElementsBaseVertex(void);
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC get_function_ptr_glDrawRangeElementsBaseVertex(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawRangeElementsBaseVertex(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLsizei  argument_3, GLenum  argument_4, const void * argument_5, GLint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glDrawRangeElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glDrawRangeElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glDrawRangeElementsBaseVertex("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glDrawRangeElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glDrawRangeElementsBaseVertex( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLDRAWRANGEELEMENTSBASEVERTEXEXTPROC function_ptr_glDrawRangeElementsBaseVertexEXT;
+int exists_function_glDrawRangeElementsBaseVertexEXT(void);
+PFNGLDRAWRANGEELEMENTSBASEVERTEXEXTPROC get_function_ptr_glDrawRangeElementsBaseVertexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawRangeElementsBaseVertexEXT(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLsizei  argument_3, GLenum  argument_4, const void * argument_5, GLint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glDrawRangeElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glDrawRangeElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glDrawRangeElementsBaseVertexEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glDrawRangeElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glDrawRangeElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLDRAWRANGEELEMENTSBASEVERTEXOESPROC function_ptr_glDrawRangeElementsBaseVertexOES;
+int exists_function_glDrawRangeElementsBaseVertexOES(void);
+PFNGLDRAWRANGEELEMENTSBASEVERTEXOESPROC get_function_ptr_glDrawRangeElementsBaseVertexOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawRangeElementsBaseVertexOES(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLsizei  argument_3, GLenum  argument_4, const void * argument_5, GLint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glDrawRangeElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glDrawRangeElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glDrawRangeElementsBaseVertexOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glDrawRangeElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glDrawRangeElementsBaseVertexOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLDRAWTRANSFORMFEEDBACKEXTPROC function_ptr_glDrawTransformFeedbackEXT;
+int exists_function_glDrawTransformFeedbackEXT(void);
+PFNGLDRAWTRANSFORMFEEDBACKEXTPROC get_function_ptr_glDrawTransformFeedbackEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawTransformFeedbackEXT(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glDrawTransformFeedbackEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glDrawTransformFeedbackEXT( argument_0, argument_1, __FILE__, __LINE__, "glDrawTransformFeedbackEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glDrawTransformFeedbackEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glDrawTransformFeedbackEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDEXTPROC function_ptr_glDrawTransformFeedbackInstancedEXT;
+int exists_function_glDrawTransformFeedbackInstancedEXT(void);
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDEXTPROC get_function_ptr_glDrawTransformFeedbackInstancedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawTransformFeedbackInstancedEXT(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glDrawTransformFeedbackInstancedEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glDrawTransformFeedbackInstancedEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glDrawTransformFeedbackInstancedEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glDrawTransformFeedbackInstancedEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glDrawTransformFeedbackInstancedEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLDRAWVKIMAGENVPROC function_ptr_glDrawVkImageNV;
+int exists_function_glDrawVkImageNV(void);
+PFNGLDRAWVKIMAGENVPROC get_function_ptr_glDrawVkImageNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glDrawVkImageNV(GLuint64  argument_0, GLuint  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, GLfloat  argument_8, GLfloat  argument_9, GLfloat  argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glDrawVkImageNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glDrawVkImageNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glDrawVkImageNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glDrawVkImageNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glDrawVkImageNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC function_ptr_glEGLImageTargetRenderbufferStorageOES;
+int exists_function_glEGLImageTargetRenderbufferStorageOES(void);
+PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC get_function_ptr_glEGLImageTargetRenderbufferStorageOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEGLImageTargetRenderbufferStorageOES(GLenum  argument_0, GLeglImageOES  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEGLImageTargetRenderbufferStorageOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEGLImageTargetRenderbufferStorageOES( argument_0, argument_1, __FILE__, __LINE__, "glEGLImageTargetRenderbufferStorageOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEGLImageTargetRenderbufferStorageOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEGLImageTargetRenderbufferStorageOES( argument_0, argument_1)
+#endif
+
+extern PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC function_ptr_glEGLImageTargetTexStorageEXT;
+int exists_function_glEGLImageTargetTexStorageEXT(void);
+PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC get_function_ptr_glEGLImageTargetTexStorageEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEGLImageTargetTexStorageEXT(GLenum  argument_0, GLeglImageOES  argument_1, const GLint*  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glEGLImageTargetTexStorageEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glEGLImageTargetTexStorageEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glEGLImageTargetTexStorageEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glEGLImageTargetTexStorageEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glEGLImageTargetTexStorageEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEGLIMAGETARGETTEXTURE2DOESPROC function_ptr_glEGLImageTargetTexture2DOES;
+int exists_function_glEGLImageTargetTexture2DOES(void);
+PFNGLEGLIMAGETARGETTEXTURE2DOESPROC get_function_ptr_glEGLImageTargetTexture2DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEGLImageTargetTexture2DOES(GLenum  argument_0, GLeglImageOES  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEGLImageTargetTexture2DOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEGLImageTargetTexture2DOES( argument_0, argument_1, __FILE__, __LINE__, "glEGLImageTargetTexture2DOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEGLImageTargetTexture2DOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEGLImageTargetTexture2DOES( argument_0, argument_1)
+#endif
+
+extern PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC function_ptr_glEGLImageTargetTextureStorageEXT;
+int exists_function_glEGLImageTargetTextureStorageEXT(void);
+PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC get_function_ptr_glEGLImageTargetTextureStorageEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEGLImageTargetTextureStorageEXT(GLuint  argument_0, GLeglImageOES  argument_1, const GLint*  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glEGLImageTargetTextureStorageEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glEGLImageTargetTextureStorageEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glEGLImageTargetTextureStorageEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glEGLImageTargetTextureStorageEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glEGLImageTargetTextureStorageEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLENABLEPROC function_ptr_glEnable;
+int exists_function_glEnable(void);
+PFNGLENABLEPROC get_function_ptr_glEnable(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnable(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEnable( argument_0) fastuidraw::gl_binding::debug_function__glEnable( argument_0, __FILE__, __LINE__, "glEnable("#argument_0")", #argument_0)
+#else
+#define glEnable( argument_0) fastuidraw::gl_binding::function_ptr_glEnable( argument_0)
+#endif
+
+extern PFNGLENABLEDRIVERCONTROLQCOMPROC function_ptr_glEnableDriverControlQCOM;
+int exists_function_glEnableDriverControlQCOM(void);
+PFNGLENABLEDRIVERCONTROLQCOMPROC get_function_ptr_glEnableDriverControlQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnableDriverControlQCOM(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEnableDriverControlQCOM( argument_0) fastuidraw::gl_binding::debug_function__glEnableDriverControlQCOM( argument_0, __FILE__, __LINE__, "glEnableDriverControlQCOM("#argument_0")", #argument_0)
+#else
+#define glEnableDriverControlQCOM( argument_0) fastuidraw::gl_binding::function_ptr_glEnableDriverControlQCOM( argument_0)
+#endif
+
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC function_ptr_glEnableVertexAttribArray;
+int exists_function_glEnableVertexAttribArray(void);
+PFNGLENABLEVERTEXATTRIBARRAYPROC get_function_ptr_glEnableVertexAttribArray(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnableVertexAttribArray(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEnableVertexAttribArray( argument_0) fastuidraw::gl_binding::debug_function__glEnableVertexAttribArray( argument_0, __FILE__, __LINE__, "glEnableVertexAttribArray("#argument_0")", #argument_0)
+#else
+#define glEnableVertexAttribArray( argument_0) fastuidraw::gl_binding::function_ptr_glEnableVertexAttribArray( argument_0)
+#endif
+
+extern PFNGLENABLEIPROC function_ptr_glEnablei;
+int exists_function_glEnablei(void);
+PFNGLENABLEIPROC get_function_ptr_glEnablei(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnablei(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEnablei( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEnablei( argument_0, argument_1, __FILE__, __LINE__, "glEnablei("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEnablei( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEnablei( argument_0, argument_1)
+#endif
+
+extern PFNGLENABLEIEXTPROC function_ptr_glEnableiEXT;
+int exists_function_glEnableiEXT(void);
+PFNGLENABLEIEXTPROC get_function_ptr_glEnableiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnableiEXT(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEnableiEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEnableiEXT( argument_0, argument_1, __FILE__, __LINE__, "glEnableiEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEnableiEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEnableiEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLENABLEINVPROC function_ptr_glEnableiNV;
+int exists_function_glEnableiNV(void);
+PFNGLENABLEINVPROC get_function_ptr_glEnableiNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnableiNV(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEnableiNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEnableiNV( argument_0, argument_1, __FILE__, __LINE__, "glEnableiNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEnableiNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEnableiNV( argument_0, argument_1)
+#endif
+
+extern PFNGLENABLEIOESPROC function_ptr_glEnableiOES;
+int exists_function_glEnableiOES(void);
+PFNGLENABLEIOESPROC get_function_ptr_glEnableiOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEnableiOES(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glEnableiOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glEnableiOES( argument_0, argument_1, __FILE__, __LINE__, "glEnableiOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glEnableiOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glEnableiOES( argument_0, argument_1)
+#endif
+
+extern PFNGLENDCONDITIONALRENDERNVPROC function_ptr_glEndConditionalRenderNV;
+int exists_function_glEndConditionalRenderNV(void);
+PFNGLENDCONDITIONALRENDERNVPROC get_function_ptr_glEndConditionalRenderNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndConditionalRenderNV(const char *file, int line, const char *call);
+#define glEndConditionalRenderNV() fastuidraw::gl_binding::debug_function__glEndConditionalRenderNV( __FILE__, __LINE__, "glEndConditionalRenderNV("")")
+#else
+#define glEndConditionalRenderNV() fastuidraw::gl_binding::function_ptr_glEndConditionalRenderNV()
+#endif
+
+extern PFNGLENDPERFMONITORAMDPROC function_ptr_glEndPerfMonitorAMD;
+int exists_function_glEndPerfMonitorAMD(void);
+PFNGLENDPERFMONITORAMDPROC get_function_ptr_glEndPerfMonitorAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndPerfMonitorAMD(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEndPerfMonitorAMD( argument_0) fastuidraw::gl_binding::debug_function__glEndPerfMonitorAMD( argument_0, __FILE__, __LINE__, "glEndPerfMonitorAMD("#argument_0")", #argument_0)
+#else
+#define glEndPerfMonitorAMD( argument_0) fastuidraw::gl_binding::function_ptr_glEndPerfMonitorAMD( argument_0)
+#endif
+
+extern PFNGLENDPERFQUERYINTELPROC function_ptr_glEndPerfQueryINTEL;
+int exists_function_glEndPerfQueryINTEL(void);
+PFNGLENDPERFQUERYINTELPROC get_function_ptr_glEndPerfQueryINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndPerfQueryINTEL(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEndPerfQueryINTEL( argument_0) fastuidraw::gl_binding::debug_function__glEndPerfQueryINTEL( argument_0, __FILE__, __LINE__, "glEndPerfQueryINTEL("#argument_0")", #argument_0)
+#else
+#define glEndPerfQueryINTEL( argument_0) fastuidraw::gl_binding::function_ptr_glEndPerfQueryINTEL( argument_0)
+#endif
+
+extern PFNGLENDQUERYPROC function_ptr_glEndQuery;
+int exists_function_glEndQuery(void);
+PFNGLENDQUERYPROC get_function_ptr_glEndQuery(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndQuery(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEndQuery( argument_0) fastuidraw::gl_binding::debug_function__glEndQuery( argument_0, __FILE__, __LINE__, "glEndQuery("#argument_0")", #argument_0)
+#else
+#define glEndQuery( argument_0) fastuidraw::gl_binding::function_ptr_glEndQuery( argument_0)
+#endif
+
+extern PFNGLENDQUERYEXTPROC function_ptr_glEndQueryEXT;
+int exists_function_glEndQueryEXT(void);
+PFNGLENDQUERYEXTPROC get_function_ptr_glEndQueryEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndQueryEXT(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEndQueryEXT( argument_0) fastuidraw::gl_binding::debug_function__glEndQueryEXT( argument_0, __FILE__, __LINE__, "glEndQueryEXT("#argument_0")", #argument_0)
+#else
+#define glEndQueryEXT( argument_0) fastuidraw::gl_binding::function_ptr_glEndQueryEXT( argument_0)
+#endif
+
+extern PFNGLENDTILINGQCOMPROC function_ptr_glEndTilingQCOM;
+int exists_function_glEndTilingQCOM(void);
+PFNGLENDTILINGQCOMPROC get_function_ptr_glEndTilingQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndTilingQCOM(GLbitfield  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glEndTilingQCOM( argument_0) fastuidraw::gl_binding::debug_function__glEndTilingQCOM( argument_0, __FILE__, __LINE__, "glEndTilingQCOM("#argument_0")", #argument_0)
+#else
+#define glEndTilingQCOM( argument_0) fastuidraw::gl_binding::function_ptr_glEndTilingQCOM( argument_0)
+#endif
+
+extern PFNGLENDTRANSFORMFEEDBACKPROC function_ptr_glEndTransformFeedback;
+int exists_function_glEndTransformFeedback(void);
+PFNGLENDTRANSFORMFEEDBACKPROC get_function_ptr_glEndTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glEndTransformFeedback(const char *file, int line, const char *call);
+#define glEndTransformFeedback() fastuidraw::gl_binding::debug_function__glEndTransformFeedback( __FILE__, __LINE__, "glEndTransformFeedback("")")
+#else
+#define glEndTransformFeedback() fastuidraw::gl_binding::function_ptr_glEndTransformFeedback()
+#endif
+
+extern PFNGLEXTGETBUFFERPOINTERVQCOMPROC function_ptr_glExtGetBufferPointervQCOM;
+int exists_function_glExtGetBufferPointervQCOM(void);
+PFNGLEXTGETBUFFERPOINTERVQCOMPROC get_function_ptr_glExtGetBufferPointervQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetBufferPointervQCOM(GLenum  argument_0, void ** argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glExtGetBufferPointervQCOM( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glExtGetBufferPointervQCOM( argument_0, argument_1, __FILE__, __LINE__, "glExtGetBufferPointervQCOM("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glExtGetBufferPointervQCOM( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glExtGetBufferPointervQCOM( argument_0, argument_1)
+#endif
+
+extern PFNGLEXTGETBUFFERSQCOMPROC function_ptr_glExtGetBuffersQCOM;
+int exists_function_glExtGetBuffersQCOM(void);
+PFNGLEXTGETBUFFERSQCOMPROC get_function_ptr_glExtGetBuffersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetBuffersQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetBuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetBuffersQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetBuffersQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetBuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetBuffersQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTGETFRAMEBUFFERSQCOMPROC function_ptr_glExtGetFramebuffersQCOM;
+int exists_function_glExtGetFramebuffersQCOM(void);
+PFNGLEXTGETFRAMEBUFFERSQCOMPROC get_function_ptr_glExtGetFramebuffersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetFramebuffersQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetFramebuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetFramebuffersQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetFramebuffersQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetFramebuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetFramebuffersQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC function_ptr_glExtGetProgramBinarySourceQCOM;
+int exists_function_glExtGetProgramBinarySourceQCOM(void);
+PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC get_function_ptr_glExtGetProgramBinarySourceQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetProgramBinarySourceQCOM(GLuint  argument_0, GLenum  argument_1, GLchar * argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glExtGetProgramBinarySourceQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glExtGetProgramBinarySourceQCOM( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glExtGetProgramBinarySourceQCOM("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glExtGetProgramBinarySourceQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glExtGetProgramBinarySourceQCOM( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLEXTGETPROGRAMSQCOMPROC function_ptr_glExtGetProgramsQCOM;
+int exists_function_glExtGetProgramsQCOM(void);
+PFNGLEXTGETPROGRAMSQCOMPROC get_function_ptr_glExtGetProgramsQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetProgramsQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetProgramsQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetProgramsQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetProgramsQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetProgramsQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetProgramsQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTGETRENDERBUFFERSQCOMPROC function_ptr_glExtGetRenderbuffersQCOM;
+int exists_function_glExtGetRenderbuffersQCOM(void);
+PFNGLEXTGETRENDERBUFFERSQCOMPROC get_function_ptr_glExtGetRenderbuffersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetRenderbuffersQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetRenderbuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetRenderbuffersQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetRenderbuffersQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetRenderbuffersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetRenderbuffersQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTGETSHADERSQCOMPROC function_ptr_glExtGetShadersQCOM;
+int exists_function_glExtGetShadersQCOM(void);
+PFNGLEXTGETSHADERSQCOMPROC get_function_ptr_glExtGetShadersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetShadersQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetShadersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetShadersQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetShadersQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetShadersQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetShadersQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC function_ptr_glExtGetTexLevelParameterivQCOM;
+int exists_function_glExtGetTexLevelParameterivQCOM(void);
+PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC get_function_ptr_glExtGetTexLevelParameterivQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetTexLevelParameterivQCOM(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, GLenum  argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glExtGetTexLevelParameterivQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glExtGetTexLevelParameterivQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glExtGetTexLevelParameterivQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glExtGetTexLevelParameterivQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glExtGetTexLevelParameterivQCOM( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLEXTGETTEXSUBIMAGEQCOMPROC function_ptr_glExtGetTexSubImageQCOM;
+int exists_function_glExtGetTexSubImageQCOM(void);
+PFNGLEXTGETTEXSUBIMAGEQCOMPROC get_function_ptr_glExtGetTexSubImageQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetTexSubImageQCOM(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLenum  argument_9, void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glExtGetTexSubImageQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glExtGetTexSubImageQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glExtGetTexSubImageQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glExtGetTexSubImageQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glExtGetTexSubImageQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLEXTGETTEXTURESQCOMPROC function_ptr_glExtGetTexturesQCOM;
+int exists_function_glExtGetTexturesQCOM(void);
+PFNGLEXTGETTEXTURESQCOMPROC get_function_ptr_glExtGetTexturesQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtGetTexturesQCOM(GLuint * argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtGetTexturesQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtGetTexturesQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtGetTexturesQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtGetTexturesQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtGetTexturesQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTISPROGRAMBINARYQCOMPROC function_ptr_glExtIsProgramBinaryQCOM;
+int exists_function_glExtIsProgramBinaryQCOM(void);
+PFNGLEXTISPROGRAMBINARYQCOMPROC get_function_ptr_glExtIsProgramBinaryQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glExtIsProgramBinaryQCOM(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glExtIsProgramBinaryQCOM( argument_0) fastuidraw::gl_binding::debug_function__glExtIsProgramBinaryQCOM( argument_0, __FILE__, __LINE__, "glExtIsProgramBinaryQCOM("#argument_0")", #argument_0)
+#else
+#define glExtIsProgramBinaryQCOM( argument_0) fastuidraw::gl_binding::function_ptr_glExtIsProgramBinaryQCOM( argument_0)
+#endif
+
+extern PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC function_ptr_glExtTexObjectStateOverrideiQCOM;
+int exists_function_glExtTexObjectStateOverrideiQCOM(void);
+PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC get_function_ptr_glExtTexObjectStateOverrideiQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtTexObjectStateOverrideiQCOM(GLenum  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glExtTexObjectStateOverrideiQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glExtTexObjectStateOverrideiQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glExtTexObjectStateOverrideiQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glExtTexObjectStateOverrideiQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glExtTexObjectStateOverrideiQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLEXTRAPOLATETEX2DQCOMPROC function_ptr_glExtrapolateTex2DQCOM;
+int exists_function_glExtrapolateTex2DQCOM(void);
+PFNGLEXTRAPOLATETEX2DQCOMPROC get_function_ptr_glExtrapolateTex2DQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glExtrapolateTex2DQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glExtrapolateTex2DQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glExtrapolateTex2DQCOM( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glExtrapolateTex2DQCOM("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glExtrapolateTex2DQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glExtrapolateTex2DQCOM( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFENCESYNCPROC function_ptr_glFenceSync;
+int exists_function_glFenceSync(void);
+PFNGLFENCESYNCPROC get_function_ptr_glFenceSync(void);
+#ifdef FASTUIDRAW_DEBUG
+GLsync debug_function__glFenceSync(GLenum  argument_0, GLbitfield  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glFenceSync( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glFenceSync( argument_0, argument_1, __FILE__, __LINE__, "glFenceSync("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glFenceSync( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glFenceSync( argument_0, argument_1)
+#endif
+
+extern PFNGLFENCESYNCAPPLEPROC function_ptr_glFenceSyncAPPLE;
+int exists_function_glFenceSyncAPPLE(void);
+PFNGLFENCESYNCAPPLEPROC get_function_ptr_glFenceSyncAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+GLsync debug_function__glFenceSyncAPPLE(GLenum  argument_0, GLbitfield  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glFenceSyncAPPLE( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glFenceSyncAPPLE( argument_0, argument_1, __FILE__, __LINE__, "glFenceSyncAPPLE("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glFenceSyncAPPLE( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glFenceSyncAPPLE( argument_0, argument_1)
+#endif
+
+extern PFNGLFINISHPROC function_ptr_glFinish;
+int exists_function_glFinish(void);
+PFNGLFINISHPROC get_function_ptr_glFinish(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFinish(const char *file, int line, const char *call);
+#define glFinish() fastuidraw::gl_binding::debug_function__glFinish( __FILE__, __LINE__, "glFinish("")")
+#else
+#define glFinish() fastuidraw::gl_binding::function_ptr_glFinish()
+#endif
+
+extern PFNGLFINISHFENCENVPROC function_ptr_glFinishFenceNV;
+int exists_function_glFinishFenceNV(void);
+PFNGLFINISHFENCENVPROC get_function_ptr_glFinishFenceNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFinishFenceNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glFinishFenceNV( argument_0) fastuidraw::gl_binding::debug_function__glFinishFenceNV( argument_0, __FILE__, __LINE__, "glFinishFenceNV("#argument_0")", #argument_0)
+#else
+#define glFinishFenceNV( argument_0) fastuidraw::gl_binding::function_ptr_glFinishFenceNV( argument_0)
+#endif
+
+extern PFNGLFLUSHPROC function_ptr_glFlush;
+int exists_function_glFlush(void);
+PFNGLFLUSHPROC get_function_ptr_glFlush(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFlush(const char *file, int line, const char *call);
+#define glFlush() fastuidraw::gl_binding::debug_function__glFlush( __FILE__, __LINE__, "glFlush("")")
+#else
+#define glFlush() fastuidraw::gl_binding::function_ptr_glFlush()
+#endif
+
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC function_ptr_glFlushMappedBufferRange;
+int exists_function_glFlushMappedBufferRange(void);
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC get_function_ptr_glFlushMappedBufferRange(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFlushMappedBufferRange(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glFlushMappedBufferRange( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glFlushMappedBufferRange( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glFlushMappedBufferRange("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glFlushMappedBufferRange( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glFlushMappedBufferRange( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC function_ptr_glFlushMappedBufferRangeEXT;
+int exists_function_glFlushMappedBufferRangeEXT(void);
+PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC get_function_ptr_glFlushMappedBufferRangeEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFlushMappedBufferRangeEXT(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glFlushMappedBufferRangeEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glFlushMappedBufferRangeEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glFlushMappedBufferRangeEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glFlushMappedBufferRangeEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glFlushMappedBufferRangeEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLFRAGMENTCOVERAGECOLORNVPROC function_ptr_glFragmentCoverageColorNV;
+int exists_function_glFragmentCoverageColorNV(void);
+PFNGLFRAGMENTCOVERAGECOLORNVPROC get_function_ptr_glFragmentCoverageColorNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFragmentCoverageColorNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glFragmentCoverageColorNV( argument_0) fastuidraw::gl_binding::debug_function__glFragmentCoverageColorNV( argument_0, __FILE__, __LINE__, "glFragmentCoverageColorNV("#argument_0")", #argument_0)
+#else
+#define glFragmentCoverageColorNV( argument_0) fastuidraw::gl_binding::function_ptr_glFragmentCoverageColorNV( argument_0)
+#endif
+
+extern PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC function_ptr_glFramebufferFetchBarrierEXT;
+int exists_function_glFramebufferFetchBarrierEXT(void);
+PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC get_function_ptr_glFramebufferFetchBarrierEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferFetchBarrierEXT(const char *file, int line, const char *call);
+#define glFramebufferFetchBarrierEXT() fastuidraw::gl_binding::debug_function__glFramebufferFetchBarrierEXT( __FILE__, __LINE__, "glFramebufferFetchBarrierEXT("")")
+#else
+#define glFramebufferFetchBarrierEXT() fastuidraw::gl_binding::function_ptr_glFramebufferFetchBarrierEXT()
+#endif
+
+extern PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC function_ptr_glFramebufferFetchBarrierQCOM;
+int exists_function_glFramebufferFetchBarrierQCOM(void);
+PFNGLFRAMEBUFFERFETCHBARRIERQCOMPROC get_function_ptr_glFramebufferFetchBarrierQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferFetchBarrierQCOM(const char *file, int line, const char *call);
+#define glFramebufferFetchBarrierQCOM() fastuidraw::gl_binding::debug_function__glFramebufferFetchBarrierQCOM( __FILE__, __LINE__, "glFramebufferFetchBarrierQCOM("")")
+#else
+#define glFramebufferFetchBarrierQCOM() fastuidraw::gl_binding::function_ptr_glFramebufferFetchBarrierQCOM()
+#endif
+
+extern PFNGLFRAMEBUFFERFOVEATIONCONFIGQCOMPROC function_ptr_glFramebufferFoveationConfigQCOM;
+int exists_function_glFramebufferFoveationConfigQCOM(void);
+PFNGLFRAMEBUFFERFOVEATIONCONFIGQCOMPROC get_function_ptr_glFramebufferFoveationConfigQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferFoveationConfigQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glFramebufferFoveationConfigQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glFramebufferFoveationConfigQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glFramebufferFoveationConfigQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glFramebufferFoveationConfigQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glFramebufferFoveationConfigQCOM( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLFRAMEBUFFERFOVEATIONPARAMETERSQCOMPROC function_ptr_glFramebufferFoveationParametersQCOM;
+int exists_function_glFramebufferFoveationParametersQCOM(void);
+PFNGLFRAMEBUFFERFOVEATIONPARAMETERSQCOMPROC get_function_ptr_glFramebufferFoveationParametersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferFoveationParametersQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glFramebufferFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glFramebufferFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glFramebufferFoveationParametersQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glFramebufferFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glFramebufferFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLFRAMEBUFFERPARAMETERIPROC function_ptr_glFramebufferParameteri;
+int exists_function_glFramebufferParameteri(void);
+PFNGLFRAMEBUFFERPARAMETERIPROC get_function_ptr_glFramebufferParameteri(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferParameteri(GLenum  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glFramebufferParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glFramebufferParameteri( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glFramebufferParameteri("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glFramebufferParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glFramebufferParameteri( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLFRAMEBUFFERPARAMETERIMESAPROC function_ptr_glFramebufferParameteriMESA;
+int exists_function_glFramebufferParameteriMESA(void);
+PFNGLFRAMEBUFFERPARAMETERIMESAPROC get_function_ptr_glFramebufferParameteriMESA(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferParameteriMESA(GLenum  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glFramebufferParameteriMESA( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glFramebufferParameteriMESA( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glFramebufferParameteriMESA("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glFramebufferParameteriMESA( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glFramebufferParameteriMESA( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC function_ptr_glFramebufferPixelLocalStorageSizeEXT;
+int exists_function_glFramebufferPixelLocalStorageSizeEXT(void);
+PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC get_function_ptr_glFramebufferPixelLocalStorageSizeEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferPixelLocalStorageSizeEXT(GLuint  argument_0, GLsizei  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glFramebufferPixelLocalStorageSizeEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glFramebufferPixelLocalStorageSizeEXT( argument_0, argument_1, __FILE__, __LINE__, "glFramebufferPixelLocalStorageSizeEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glFramebufferPixelLocalStorageSizeEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glFramebufferPixelLocalStorageSizeEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLFRAMEBUFFERRENDERBUFFERPROC function_ptr_glFramebufferRenderbuffer;
+int exists_function_glFramebufferRenderbuffer(void);
+PFNGLFRAMEBUFFERRENDERBUFFERPROC get_function_ptr_glFramebufferRenderbuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferRenderbuffer(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glFramebufferRenderbuffer( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glFramebufferRenderbuffer( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glFramebufferRenderbuffer("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glFramebufferRenderbuffer( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glFramebufferRenderbuffer( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC function_ptr_glFramebufferSampleLocationsfvNV;
+int exists_function_glFramebufferSampleLocationsfvNV(void);
+PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC get_function_ptr_glFramebufferSampleLocationsfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferSampleLocationsfvNV(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glFramebufferSampleLocationsfvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFRAMEBUFFERSHADINGRATEEXTPROC function_ptr_glFramebufferShadingRateEXT;
+int exists_function_glFramebufferShadingRateEXT(void);
+PFNGLFRAMEBUFFERSHADINGRATEEXTPROC get_function_ptr_glFramebufferShadingRateEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferShadingRateEXT(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLsizei  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glFramebufferShadingRateEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glFramebufferShadingRateEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glFramebufferShadingRateEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glFramebufferShadingRateEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glFramebufferShadingRateEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTUREPROC function_ptr_glFramebufferTexture;
+int exists_function_glFramebufferTexture(void);
+PFNGLFRAMEBUFFERTEXTUREPROC get_function_ptr_glFramebufferTexture(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glFramebufferTexture( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glFramebufferTexture( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glFramebufferTexture("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glFramebufferTexture( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glFramebufferTexture( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURE2DPROC function_ptr_glFramebufferTexture2D;
+int exists_function_glFramebufferTexture2D(void);
+PFNGLFRAMEBUFFERTEXTURE2DPROC get_function_ptr_glFramebufferTexture2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture2D(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glFramebufferTexture2D( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glFramebufferTexture2D( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glFramebufferTexture2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glFramebufferTexture2D( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glFramebufferTexture2D( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC function_ptr_glFramebufferTexture2DDownsampleIMG;
+int exists_function_glFramebufferTexture2DDownsampleIMG(void);
+PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC get_function_ptr_glFramebufferTexture2DDownsampleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture2DDownsampleIMG(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glFramebufferTexture2DDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glFramebufferTexture2DDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glFramebufferTexture2DDownsampleIMG("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glFramebufferTexture2DDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glFramebufferTexture2DDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC function_ptr_glFramebufferTexture2DMultisampleEXT;
+int exists_function_glFramebufferTexture2DMultisampleEXT(void);
+PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC get_function_ptr_glFramebufferTexture2DMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture2DMultisampleEXT(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, GLint  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glFramebufferTexture2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glFramebufferTexture2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glFramebufferTexture2DMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glFramebufferTexture2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glFramebufferTexture2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC function_ptr_glFramebufferTexture2DMultisampleIMG;
+int exists_function_glFramebufferTexture2DMultisampleIMG(void);
+PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC get_function_ptr_glFramebufferTexture2DMultisampleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture2DMultisampleIMG(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, GLint  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glFramebufferTexture2DMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glFramebufferTexture2DMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glFramebufferTexture2DMultisampleIMG("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glFramebufferTexture2DMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glFramebufferTexture2DMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURE3DOESPROC function_ptr_glFramebufferTexture3DOES;
+int exists_function_glFramebufferTexture3DOES(void);
+PFNGLFRAMEBUFFERTEXTURE3DOESPROC get_function_ptr_glFramebufferTexture3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTexture3DOES(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLuint  argument_3, GLint  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glFramebufferTexture3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glFramebufferTexture3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glFramebufferTexture3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glFramebufferTexture3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glFramebufferTexture3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTUREEXTPROC function_ptr_glFramebufferTextureEXT;
+int exists_function_glFramebufferTextureEXT(void);
+PFNGLFRAMEBUFFERTEXTUREEXTPROC get_function_ptr_glFramebufferTextureEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureEXT(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glFramebufferTextureEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glFramebufferTextureEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glFramebufferTextureEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glFramebufferTextureEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glFramebufferTextureEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURELAYERPROC function_ptr_glFramebufferTextureLayer;
+int exists_function_glFramebufferTextureLayer(void);
+PFNGLFRAMEBUFFERTEXTURELAYERPROC get_function_ptr_glFramebufferTextureLayer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureLayer(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glFramebufferTextureLayer( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glFramebufferTextureLayer( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glFramebufferTextureLayer("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glFramebufferTextureLayer( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glFramebufferTextureLayer( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC function_ptr_glFramebufferTextureLayerDownsampleIMG;
+int exists_function_glFramebufferTextureLayerDownsampleIMG(void);
+PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC get_function_ptr_glFramebufferTextureLayerDownsampleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureLayerDownsampleIMG(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLint  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glFramebufferTextureLayerDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glFramebufferTextureLayerDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glFramebufferTextureLayerDownsampleIMG("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glFramebufferTextureLayerDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glFramebufferTextureLayerDownsampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC function_ptr_glFramebufferTextureMultisampleMultiviewOVR;
+int exists_function_glFramebufferTextureMultisampleMultiviewOVR(void);
+PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC get_function_ptr_glFramebufferTextureMultisampleMultiviewOVR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureMultisampleMultiviewOVR(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, GLsizei  argument_4, GLint  argument_5, GLsizei  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glFramebufferTextureMultisampleMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glFramebufferTextureMultisampleMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glFramebufferTextureMultisampleMultiviewOVR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glFramebufferTextureMultisampleMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glFramebufferTextureMultisampleMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC function_ptr_glFramebufferTextureMultiviewOVR;
+int exists_function_glFramebufferTextureMultiviewOVR(void);
+PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC get_function_ptr_glFramebufferTextureMultiviewOVR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureMultiviewOVR(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glFramebufferTextureMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glFramebufferTextureMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glFramebufferTextureMultiviewOVR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glFramebufferTextureMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glFramebufferTextureMultiviewOVR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLFRAMEBUFFERTEXTUREOESPROC function_ptr_glFramebufferTextureOES;
+int exists_function_glFramebufferTextureOES(void);
+PFNGLFRAMEBUFFERTEXTUREOESPROC get_function_ptr_glFramebufferTextureOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFramebufferTextureOES(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glFramebufferTextureOES( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glFramebufferTextureOES( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glFramebufferTextureOES("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glFramebufferTextureOES( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glFramebufferTextureOES( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLFRONTFACEPROC function_ptr_glFrontFace;
+int exists_function_glFrontFace(void);
+PFNGLFRONTFACEPROC get_function_ptr_glFrontFace(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glFrontFace(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glFrontFace( argument_0) fastuidraw::gl_binding::debug_function__glFrontFace( argument_0, __FILE__, __LINE__, "glFrontFace("#argument_0")", #argument_0)
+#else
+#define glFrontFace( argument_0) fastuidraw::gl_binding::function_ptr_glFrontFace( argument_0)
+#endif
+
+extern PFNGLGENBUFFERSPROC function_ptr_glGenBuffers;
+int exists_function_glGenBuffers(void);
+PFNGLGENBUFFERSPROC get_function_ptr_glGenBuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenBuffers(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenBuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenBuffers( argument_0, argument_1, __FILE__, __LINE__, "glGenBuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenBuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenBuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLGENFENCESNVPROC function_ptr_glGenFencesNV;
+int exists_function_glGenFencesNV(void);
+PFNGLGENFENCESNVPROC get_function_ptr_glGenFencesNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenFencesNV(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenFencesNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenFencesNV( argument_0, argument_1, __FILE__, __LINE__, "glGenFencesNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenFencesNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenFencesNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGENFRAMEBUFFERSPROC function_ptr_glGenFramebuffers;
+int exists_function_glGenFramebuffers(void);
+PFNGLGENFRAMEBUFFERSPROC get_function_ptr_glGenFramebuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenFramebuffers(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenFramebuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenFramebuffers( argument_0, argument_1, __FILE__, __LINE__, "glGenFramebuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenFramebuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenFramebuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLGENPATHSNVPROC function_ptr_glGenPathsNV;
+int exists_function_glGenPathsNV(void);
+PFNGLGENPATHSNVPROC get_function_ptr_glGenPathsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glGenPathsNV(GLsizei  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGenPathsNV( argument_0) fastuidraw::gl_binding::debug_function__glGenPathsNV( argument_0, __FILE__, __LINE__, "glGenPathsNV("#argument_0")", #argument_0)
+#else
+#define glGenPathsNV( argument_0) fastuidraw::gl_binding::function_ptr_glGenPathsNV( argument_0)
+#endif
+
+extern PFNGLGENPERFMONITORSAMDPROC function_ptr_glGenPerfMonitorsAMD;
+int exists_function_glGenPerfMonitorsAMD(void);
+PFNGLGENPERFMONITORSAMDPROC get_function_ptr_glGenPerfMonitorsAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenPerfMonitorsAMD(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenPerfMonitorsAMD( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenPerfMonitorsAMD( argument_0, argument_1, __FILE__, __LINE__, "glGenPerfMonitorsAMD("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenPerfMonitorsAMD( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenPerfMonitorsAMD( argument_0, argument_1)
+#endif
+
+extern PFNGLGENPROGRAMPIPELINESPROC function_ptr_glGenProgramPipelines;
+int exists_function_glGenProgramPipelines(void);
+PFNGLGENPROGRAMPIPELINESPROC get_function_ptr_glGenProgramPipelines(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenProgramPipelines(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenProgramPipelines( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenProgramPipelines( argument_0, argument_1, __FILE__, __LINE__, "glGenProgramPipelines("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenProgramPipelines( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenProgramPipelines( argument_0, argument_1)
+#endif
+
+extern PFNGLGENPROGRAMPIPELINESEXTPROC function_ptr_glGenProgramPipelinesEXT;
+int exists_function_glGenProgramPipelinesEXT(void);
+PFNGLGENPROGRAMPIPELINESEXTPROC get_function_ptr_glGenProgramPipelinesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenProgramPipelinesEXT(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenProgramPipelinesEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenProgramPipelinesEXT( argument_0, argument_1, __FILE__, __LINE__, "glGenProgramPipelinesEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenProgramPipelinesEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenProgramPipelinesEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGENQUERIESPROC function_ptr_glGenQueries;
+int exists_function_glGenQueries(void);
+PFNGLGENQUERIESPROC get_function_ptr_glGenQueries(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenQueries(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenQueries( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenQueries( argument_0, argument_1, __FILE__, __LINE__, "glGenQueries("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenQueries( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenQueries( argument_0, argument_1)
+#endif
+
+extern PFNGLGENQUERIESEXTPROC function_ptr_glGenQueriesEXT;
+int exists_function_glGenQueriesEXT(void);
+PFNGLGENQUERIESEXTPROC get_function_ptr_glGenQueriesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenQueriesEXT(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenQueriesEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenQueriesEXT( argument_0, argument_1, __FILE__, __LINE__, "glGenQueriesEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenQueriesEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenQueriesEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGENRENDERBUFFERSPROC function_ptr_glGenRenderbuffers;
+int exists_function_glGenRenderbuffers(void);
+PFNGLGENRENDERBUFFERSPROC get_function_ptr_glGenRenderbuffers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenRenderbuffers(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenRenderbuffers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenRenderbuffers( argument_0, argument_1, __FILE__, __LINE__, "glGenRenderbuffers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenRenderbuffers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenRenderbuffers( argument_0, argument_1)
+#endif
+
+extern PFNGLGENSAMPLERSPROC function_ptr_glGenSamplers;
+int exists_function_glGenSamplers(void);
+PFNGLGENSAMPLERSPROC get_function_ptr_glGenSamplers(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenSamplers(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenSamplers( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenSamplers( argument_0, argument_1, __FILE__, __LINE__, "glGenSamplers("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenSamplers( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenSamplers( argument_0, argument_1)
+#endif
+
+extern PFNGLGENSEMAPHORESEXTPROC function_ptr_glGenSemaphoresEXT;
+int exists_function_glGenSemaphoresEXT(void);
+PFNGLGENSEMAPHORESEXTPROC get_function_ptr_glGenSemaphoresEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenSemaphoresEXT(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenSemaphoresEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenSemaphoresEXT( argument_0, argument_1, __FILE__, __LINE__, "glGenSemaphoresEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenSemaphoresEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenSemaphoresEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGENTEXTURESPROC function_ptr_glGenTextures;
+int exists_function_glGenTextures(void);
+PFNGLGENTEXTURESPROC get_function_ptr_glGenTextures(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenTextures(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenTextures( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenTextures( argument_0, argument_1, __FILE__, __LINE__, "glGenTextures("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenTextures( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenTextures( argument_0, argument_1)
+#endif
+
+extern PFNGLGENTRANSFORMFEEDBACKSPROC function_ptr_glGenTransformFeedbacks;
+int exists_function_glGenTransformFeedbacks(void);
+PFNGLGENTRANSFORMFEEDBACKSPROC get_function_ptr_glGenTransformFeedbacks(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenTransformFeedbacks(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenTransformFeedbacks( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenTransformFeedbacks( argument_0, argument_1, __FILE__, __LINE__, "glGenTransformFeedbacks("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenTransformFeedbacks( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenTransformFeedbacks( argument_0, argument_1)
+#endif
+
+extern PFNGLGENVERTEXARRAYSPROC function_ptr_glGenVertexArrays;
+int exists_function_glGenVertexArrays(void);
+PFNGLGENVERTEXARRAYSPROC get_function_ptr_glGenVertexArrays(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenVertexArrays(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenVertexArrays( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenVertexArrays( argument_0, argument_1, __FILE__, __LINE__, "glGenVertexArrays("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenVertexArrays( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenVertexArrays( argument_0, argument_1)
+#endif
+
+extern PFNGLGENVERTEXARRAYSOESPROC function_ptr_glGenVertexArraysOES;
+int exists_function_glGenVertexArraysOES(void);
+PFNGLGENVERTEXARRAYSOESPROC get_function_ptr_glGenVertexArraysOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenVertexArraysOES(GLsizei  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGenVertexArraysOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGenVertexArraysOES( argument_0, argument_1, __FILE__, __LINE__, "glGenVertexArraysOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGenVertexArraysOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGenVertexArraysOES( argument_0, argument_1)
+#endif
+
+extern PFNGLGENERATEMIPMAPPROC function_ptr_glGenerateMipmap;
+int exists_function_glGenerateMipmap(void);
+PFNGLGENERATEMIPMAPPROC get_function_ptr_glGenerateMipmap(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGenerateMipmap(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGenerateMipmap( argument_0) fastuidraw::gl_binding::debug_function__glGenerateMipmap( argument_0, __FILE__, __LINE__, "glGenerateMipmap("#argument_0")", #argument_0)
+#else
+#define glGenerateMipmap( argument_0) fastuidraw::gl_binding::function_ptr_glGenerateMipmap( argument_0)
+#endif
+
+extern PFNGLGETACTIVEATTRIBPROC function_ptr_glGetActiveAttrib;
+int exists_function_glGetActiveAttrib(void);
+PFNGLGETACTIVEATTRIBPROC get_function_ptr_glGetActiveAttrib(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetActiveAttrib(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLint * argument_4, GLenum * argument_5, GLchar * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glGetActiveAttrib( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glGetActiveAttrib( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glGetActiveAttrib("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glGetActiveAttrib( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glGetActiveAttrib( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLGETACTIVEUNIFORMPROC function_ptr_glGetActiveUniform;
+int exists_function_glGetActiveUniform(void);
+PFNGLGETACTIVEUNIFORMPROC get_function_ptr_glGetActiveUniform(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetActiveUniform(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLint * argument_4, GLenum * argument_5, GLchar * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glGetActiveUniform( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glGetActiveUniform( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glGetActiveUniform("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glGetActiveUniform( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glGetActiveUniform( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC function_ptr_glGetActiveUniformBlockName;
+int exists_function_glGetActiveUniformBlockName(void);
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC get_function_ptr_glGetActiveUniformBlockName(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetActiveUniformBlockName(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLchar * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetActiveUniformBlockName( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetActiveUniformBlockName( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetActiveUniformBlockName("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetActiveUniformBlockName( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetActiveUniformBlockName( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETACTIVEUNIFORMBLOCKIVPROC function_ptr_glGetActiveUniformBlockiv;
+int exists_function_glGetActiveUniformBlockiv(void);
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC get_function_ptr_glGetActiveUniformBlockiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetActiveUniformBlockiv(GLuint  argument_0, GLuint  argument_1, GLenum  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetActiveUniformBlockiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetActiveUniformBlockiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetActiveUniformBlockiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetActiveUniformBlockiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetActiveUniformBlockiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETACTIVEUNIFORMSIVPROC function_ptr_glGetActiveUniformsiv;
+int exists_function_glGetActiveUniformsiv(void);
+PFNGLGETACTIVEUNIFORMSIVPROC get_function_ptr_glGetActiveUniformsiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetActiveUniformsiv(GLuint  argument_0, GLsizei  argument_1, const GLuint * argument_2, GLenum  argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetActiveUniformsiv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetActiveUniformsiv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetActiveUniformsiv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetActiveUniformsiv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetActiveUniformsiv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETATTACHEDSHADERSPROC function_ptr_glGetAttachedShaders;
+int exists_function_glGetAttachedShaders(void);
+PFNGLGETATTACHEDSHADERSPROC get_function_ptr_glGetAttachedShaders(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetAttachedShaders(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetAttachedShaders( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetAttachedShaders( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetAttachedShaders("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetAttachedShaders( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetAttachedShaders( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETATTRIBLOCATIONPROC function_ptr_glGetAttribLocation;
+int exists_function_glGetAttribLocation(void);
+PFNGLGETATTRIBLOCATIONPROC get_function_ptr_glGetAttribLocation(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetAttribLocation(GLuint  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetAttribLocation( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetAttribLocation( argument_0, argument_1, __FILE__, __LINE__, "glGetAttribLocation("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetAttribLocation( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetAttribLocation( argument_0, argument_1)
+#endif
+
+extern PFNGLGETBOOLEANI_VPROC function_ptr_glGetBooleani_v;
+int exists_function_glGetBooleani_v(void);
+PFNGLGETBOOLEANI_VPROC get_function_ptr_glGetBooleani_v(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBooleani_v(GLenum  argument_0, GLuint  argument_1, GLboolean * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetBooleani_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetBooleani_v( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetBooleani_v("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetBooleani_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetBooleani_v( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETBOOLEANVPROC function_ptr_glGetBooleanv;
+int exists_function_glGetBooleanv(void);
+PFNGLGETBOOLEANVPROC get_function_ptr_glGetBooleanv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBooleanv(GLenum  argument_0, GLboolean * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetBooleanv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetBooleanv( argument_0, argument_1, __FILE__, __LINE__, "glGetBooleanv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetBooleanv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetBooleanv( argument_0, argument_1)
+#endif
+
+extern PFNGLGETBUFFERPARAMETERI64VPROC function_ptr_glGetBufferParameteri64v;
+int exists_function_glGetBufferParameteri64v(void);
+PFNGLGETBUFFERPARAMETERI64VPROC get_function_ptr_glGetBufferParameteri64v(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBufferParameteri64v(GLenum  argument_0, GLenum  argument_1, GLint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetBufferParameteri64v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetBufferParameteri64v( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetBufferParameteri64v("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetBufferParameteri64v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetBufferParameteri64v( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETBUFFERPARAMETERIVPROC function_ptr_glGetBufferParameteriv;
+int exists_function_glGetBufferParameteriv(void);
+PFNGLGETBUFFERPARAMETERIVPROC get_function_ptr_glGetBufferParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBufferParameteriv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetBufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetBufferParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetBufferParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetBufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetBufferParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETBUFFERPOINTERVPROC function_ptr_glGetBufferPointerv;
+int exists_function_glGetBufferPointerv(void);
+PFNGLGETBUFFERPOINTERVPROC get_function_ptr_glGetBufferPointerv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBufferPointerv(GLenum  argument_0, GLenum  argument_1, void ** argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetBufferPointerv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetBufferPointerv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetBufferPointerv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetBufferPointerv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetBufferPointerv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETBUFFERPOINTERVOESPROC function_ptr_glGetBufferPointervOES;
+int exists_function_glGetBufferPointervOES(void);
+PFNGLGETBUFFERPOINTERVOESPROC get_function_ptr_glGetBufferPointervOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetBufferPointervOES(GLenum  argument_0, GLenum  argument_1, void ** argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetBufferPointervOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetBufferPointervOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetBufferPointervOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetBufferPointervOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetBufferPointervOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETCOVERAGEMODULATIONTABLENVPROC function_ptr_glGetCoverageModulationTableNV;
+int exists_function_glGetCoverageModulationTableNV(void);
+PFNGLGETCOVERAGEMODULATIONTABLENVPROC get_function_ptr_glGetCoverageModulationTableNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetCoverageModulationTableNV(GLsizei  argument_0, GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetCoverageModulationTableNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetCoverageModulationTableNV( argument_0, argument_1, __FILE__, __LINE__, "glGetCoverageModulationTableNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetCoverageModulationTableNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetCoverageModulationTableNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGETDEBUGMESSAGELOGPROC function_ptr_glGetDebugMessageLog;
+int exists_function_glGetDebugMessageLog(void);
+PFNGLGETDEBUGMESSAGELOGPROC get_function_ptr_glGetDebugMessageLog(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glGetDebugMessageLog(GLuint  argument_0, GLsizei  argument_1, GLenum * argument_2, GLenum * argument_3, GLuint * argument_4, GLenum * argument_5, GLsizei * argument_6, GLchar * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glGetDebugMessageLog( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glGetDebugMessageLog( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glGetDebugMessageLog("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glGetDebugMessageLog( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glGetDebugMessageLog( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLGETDEBUGMESSAGELOGKHRPROC function_ptr_glGetDebugMessageLogKHR;
+int exists_function_glGetDebugMessageLogKHR(void);
+PFNGLGETDEBUGMESSAGELOGKHRPROC get_function_ptr_glGetDebugMessageLogKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glGetDebugMessageLogKHR(GLuint  argument_0, GLsizei  argument_1, GLenum * argument_2, GLenum * argument_3, GLuint * argument_4, GLenum * argument_5, GLsizei * argument_6, GLchar * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glGetDebugMessageLogKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glGetDebugMessageLogKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glGetDebugMessageLogKHR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glGetDebugMessageLogKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glGetDebugMessageLogKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLGETDRIVERCONTROLSTRINGQCOMPROC function_ptr_glGetDriverControlStringQCOM;
+int exists_function_glGetDriverControlStringQCOM(void);
+PFNGLGETDRIVERCONTROLSTRINGQCOMPROC get_function_ptr_glGetDriverControlStringQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetDriverControlStringQCOM(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetDriverControlStringQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetDriverControlStringQCOM( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetDriverControlStringQCOM("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetDriverControlStringQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetDriverControlStringQCOM( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETDRIVERCONTROLSQCOMPROC function_ptr_glGetDriverControlsQCOM;
+int exists_function_glGetDriverControlsQCOM(void);
+PFNGLGETDRIVERCONTROLSQCOMPROC get_function_ptr_glGetDriverControlsQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetDriverControlsQCOM(GLint * argument_0, GLsizei  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetDriverControlsQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetDriverControlsQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetDriverControlsQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetDriverControlsQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetDriverControlsQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETERRORPROC function_ptr_glGetError;
+int exists_function_glGetError(void);
+PFNGLGETERRORPROC get_function_ptr_glGetError(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glGetError(const char *file, int line, const char *call);
+#define glGetError() fastuidraw::gl_binding::debug_function__glGetError( __FILE__, __LINE__, "glGetError("")")
+#else
+#define glGetError() fastuidraw::gl_binding::function_ptr_glGetError()
+#endif
+
+extern PFNGLGETFENCEIVNVPROC function_ptr_glGetFenceivNV;
+int exists_function_glGetFenceivNV(void);
+PFNGLGETFENCEIVNVPROC get_function_ptr_glGetFenceivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFenceivNV(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetFenceivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetFenceivNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetFenceivNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetFenceivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetFenceivNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETFIRSTPERFQUERYIDINTELPROC function_ptr_glGetFirstPerfQueryIdINTEL;
+int exists_function_glGetFirstPerfQueryIdINTEL(void);
+PFNGLGETFIRSTPERFQUERYIDINTELPROC get_function_ptr_glGetFirstPerfQueryIdINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFirstPerfQueryIdINTEL(GLuint * argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetFirstPerfQueryIdINTEL( argument_0) fastuidraw::gl_binding::debug_function__glGetFirstPerfQueryIdINTEL( argument_0, __FILE__, __LINE__, "glGetFirstPerfQueryIdINTEL("#argument_0")", #argument_0)
+#else
+#define glGetFirstPerfQueryIdINTEL( argument_0) fastuidraw::gl_binding::function_ptr_glGetFirstPerfQueryIdINTEL( argument_0)
+#endif
+
+extern PFNGLGETFLOATI_VNVPROC function_ptr_glGetFloati_vNV;
+int exists_function_glGetFloati_vNV(void);
+PFNGLGETFLOATI_VNVPROC get_function_ptr_glGetFloati_vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFloati_vNV(GLenum  argument_0, GLuint  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetFloati_vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetFloati_vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetFloati_vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetFloati_vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetFloati_vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETFLOATI_VOESPROC function_ptr_glGetFloati_vOES;
+int exists_function_glGetFloati_vOES(void);
+PFNGLGETFLOATI_VOESPROC get_function_ptr_glGetFloati_vOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFloati_vOES(GLenum  argument_0, GLuint  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetFloati_vOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetFloati_vOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetFloati_vOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetFloati_vOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetFloati_vOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETFLOATVPROC function_ptr_glGetFloatv;
+int exists_function_glGetFloatv(void);
+PFNGLGETFLOATVPROC get_function_ptr_glGetFloatv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFloatv(GLenum  argument_0, GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetFloatv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetFloatv( argument_0, argument_1, __FILE__, __LINE__, "glGetFloatv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetFloatv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetFloatv( argument_0, argument_1)
+#endif
+
+extern PFNGLGETFRAGDATAINDEXEXTPROC function_ptr_glGetFragDataIndexEXT;
+int exists_function_glGetFragDataIndexEXT(void);
+PFNGLGETFRAGDATAINDEXEXTPROC get_function_ptr_glGetFragDataIndexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetFragDataIndexEXT(GLuint  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetFragDataIndexEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetFragDataIndexEXT( argument_0, argument_1, __FILE__, __LINE__, "glGetFragDataIndexEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetFragDataIndexEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetFragDataIndexEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGETFRAGDATALOCATIONPROC function_ptr_glGetFragDataLocation;
+int exists_function_glGetFragDataLocation(void);
+PFNGLGETFRAGDATALOCATIONPROC get_function_ptr_glGetFragDataLocation(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetFragDataLocation(GLuint  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetFragDataLocation( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetFragDataLocation( argument_0, argument_1, __FILE__, __LINE__, "glGetFragDataLocation("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetFragDataLocation( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetFragDataLocation( argument_0, argument_1)
+#endif
+
+extern PFNGLGETFRAGMENTSHADINGRATESEXTPROC function_ptr_glGetFragmentShadingRatesEXT;
+int exists_function_glGetFragmentShadingRatesEXT(void);
+PFNGLGETFRAGMENTSHADINGRATESEXTPROC get_function_ptr_glGetFragmentShadingRatesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFragmentShadingRatesEXT(GLsizei  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLenum * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetFragmentShadingRatesEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetFragmentShadingRatesEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetFragmentShadingRatesEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetFragmentShadingRatesEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetFragmentShadingRatesEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC function_ptr_glGetFramebufferAttachmentParameteriv;
+int exists_function_glGetFramebufferAttachmentParameteriv(void);
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC get_function_ptr_glGetFramebufferAttachmentParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFramebufferAttachmentParameteriv(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetFramebufferAttachmentParameteriv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetFramebufferAttachmentParameteriv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetFramebufferAttachmentParameteriv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetFramebufferAttachmentParameteriv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetFramebufferAttachmentParameteriv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC function_ptr_glGetFramebufferParameteriv;
+int exists_function_glGetFramebufferParameteriv(void);
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC get_function_ptr_glGetFramebufferParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFramebufferParameteriv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetFramebufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetFramebufferParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetFramebufferParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetFramebufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetFramebufferParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC function_ptr_glGetFramebufferParameterivMESA;
+int exists_function_glGetFramebufferParameterivMESA(void);
+PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC get_function_ptr_glGetFramebufferParameterivMESA(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetFramebufferParameterivMESA(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetFramebufferParameterivMESA( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetFramebufferParameterivMESA( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetFramebufferParameterivMESA("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetFramebufferParameterivMESA( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetFramebufferParameterivMESA( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC function_ptr_glGetFramebufferPixelLocalStorageSizeEXT;
+int exists_function_glGetFramebufferPixelLocalStorageSizeEXT(void);
+PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC get_function_ptr_glGetFramebufferPixelLocalStorageSizeEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLsizei debug_function__glGetFramebufferPixelLocalStorageSizeEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetFramebufferPixelLocalStorageSizeEXT( argument_0) fastuidraw::gl_binding::debug_function__glGetFramebufferPixelLocalStorageSizeEXT( argument_0, __FILE__, __LINE__, "glGetFramebufferPixelLocalStorageSizeEXT("#argument_0")", #argument_0)
+#else
+#define glGetFramebufferPixelLocalStorageSizeEXT( argument_0) fastuidraw::gl_binding::function_ptr_glGetFramebufferPixelLocalStorageSizeEXT( argument_0)
+#endif
+
+extern PFNGLGETGRAPHICSRESETSTATUSPROC function_ptr_glGetGraphicsResetStatus;
+int exists_function_glGetGraphicsResetStatus(void);
+PFNGLGETGRAPHICSRESETSTATUSPROC get_function_ptr_glGetGraphicsResetStatus(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glGetGraphicsResetStatus(const char *file, int line, const char *call);
+#define glGetGraphicsResetStatus() fastuidraw::gl_binding::debug_function__glGetGraphicsResetStatus( __FILE__, __LINE__, "glGetGraphicsResetStatus("")")
+#else
+#define glGetGraphicsResetStatus() fastuidraw::gl_binding::function_ptr_glGetGraphicsResetStatus()
+#endif
+
+extern PFNGLGETGRAPHICSRESETSTATUSEXTPROC function_ptr_glGetGraphicsResetStatusEXT;
+int exists_function_glGetGraphicsResetStatusEXT(void);
+PFNGLGETGRAPHICSRESETSTATUSEXTPROC get_function_ptr_glGetGraphicsResetStatusEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glGetGraphicsResetStatusEXT(const char *file, int line, const char *call);
+#define glGetGraphicsResetStatusEXT() fastuidraw::gl_binding::debug_function__glGetGraphicsResetStatusEXT( __FILE__, __LINE__, "glGetGraphicsResetStatusEXT("")")
+#else
+#define glGetGraphicsResetStatusEXT() fastuidraw::gl_binding::function_ptr_glGetGraphicsResetStatusEXT()
+#endif
+
+extern PFNGLGETGRAPHICSRESETSTATUSKHRPROC function_ptr_glGetGraphicsResetStatusKHR;
+int exists_function_glGetGraphicsResetStatusKHR(void);
+PFNGLGETGRAPHICSRESETSTATUSKHRPROC get_function_ptr_glGetGraphicsResetStatusKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glGetGraphicsResetStatusKHR(const char *file, int line, const char *call);
+#define glGetGraphicsResetStatusKHR() fastuidraw::gl_binding::debug_function__glGetGraphicsResetStatusKHR( __FILE__, __LINE__, "glGetGraphicsResetStatusKHR("")")
+#else
+#define glGetGraphicsResetStatusKHR() fastuidraw::gl_binding::function_ptr_glGetGraphicsResetStatusKHR()
+#endif
+
+extern PFNGLGETIMAGEHANDLENVPROC function_ptr_glGetImageHandleNV;
+int exists_function_glGetImageHandleNV(void);
+PFNGLGETIMAGEHANDLENVPROC get_function_ptr_glGetImageHandleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint64 debug_function__glGetImageHandleNV(GLuint  argument_0, GLint  argument_1, GLboolean  argument_2, GLint  argument_3, GLenum  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetImageHandleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetImageHandleNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetImageHandleNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetImageHandleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetImageHandleNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETINTEGER64I_VPROC function_ptr_glGetInteger64i_v;
+int exists_function_glGetInteger64i_v(void);
+PFNGLGETINTEGER64I_VPROC get_function_ptr_glGetInteger64i_v(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInteger64i_v(GLenum  argument_0, GLuint  argument_1, GLint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetInteger64i_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetInteger64i_v( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetInteger64i_v("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetInteger64i_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetInteger64i_v( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETINTEGER64VPROC function_ptr_glGetInteger64v;
+int exists_function_glGetInteger64v(void);
+PFNGLGETINTEGER64VPROC get_function_ptr_glGetInteger64v(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInteger64v(GLenum  argument_0, GLint64 * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetInteger64v( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetInteger64v( argument_0, argument_1, __FILE__, __LINE__, "glGetInteger64v("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetInteger64v( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetInteger64v( argument_0, argument_1)
+#endif
+
+extern PFNGLGETINTEGER64VAPPLEPROC function_ptr_glGetInteger64vAPPLE;
+int exists_function_glGetInteger64vAPPLE(void);
+PFNGLGETINTEGER64VAPPLEPROC get_function_ptr_glGetInteger64vAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInteger64vAPPLE(GLenum  argument_0, GLint64 * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetInteger64vAPPLE( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetInteger64vAPPLE( argument_0, argument_1, __FILE__, __LINE__, "glGetInteger64vAPPLE("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetInteger64vAPPLE( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetInteger64vAPPLE( argument_0, argument_1)
+#endif
+
+extern PFNGLGETINTEGER64VEXTPROC function_ptr_glGetInteger64vEXT;
+int exists_function_glGetInteger64vEXT(void);
+PFNGLGETINTEGER64VEXTPROC get_function_ptr_glGetInteger64vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInteger64vEXT(GLenum  argument_0, GLint64 * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetInteger64vEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetInteger64vEXT( argument_0, argument_1, __FILE__, __LINE__, "glGetInteger64vEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetInteger64vEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetInteger64vEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGETINTEGERI_VPROC function_ptr_glGetIntegeri_v;
+int exists_function_glGetIntegeri_v(void);
+PFNGLGETINTEGERI_VPROC get_function_ptr_glGetIntegeri_v(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetIntegeri_v(GLenum  argument_0, GLuint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetIntegeri_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetIntegeri_v( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetIntegeri_v("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetIntegeri_v( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetIntegeri_v( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETINTEGERI_VEXTPROC function_ptr_glGetIntegeri_vEXT;
+int exists_function_glGetIntegeri_vEXT(void);
+PFNGLGETINTEGERI_VEXTPROC get_function_ptr_glGetIntegeri_vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetIntegeri_vEXT(GLenum  argument_0, GLuint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetIntegeri_vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetIntegeri_vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetIntegeri_vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetIntegeri_vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetIntegeri_vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETINTEGERVPROC function_ptr_glGetIntegerv;
+int exists_function_glGetIntegerv(void);
+PFNGLGETINTEGERVPROC get_function_ptr_glGetIntegerv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetIntegerv(GLenum  argument_0, GLint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetIntegerv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetIntegerv( argument_0, argument_1, __FILE__, __LINE__, "glGetIntegerv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetIntegerv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetIntegerv( argument_0, argument_1)
+#endif
+
+extern PFNGLGETINTERNALFORMATSAMPLEIVNVPROC function_ptr_glGetInternalformatSampleivNV;
+int exists_function_glGetInternalformatSampleivNV(void);
+PFNGLGETINTERNALFORMATSAMPLEIVNVPROC get_function_ptr_glGetInternalformatSampleivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInternalformatSampleivNV(GLenum  argument_0, GLenum  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, GLint * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glGetInternalformatSampleivNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glGetInternalformatSampleivNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glGetInternalformatSampleivNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glGetInternalformatSampleivNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glGetInternalformatSampleivNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLGETINTERNALFORMATIVPROC function_ptr_glGetInternalformativ;
+int exists_function_glGetInternalformativ(void);
+PFNGLGETINTERNALFORMATIVPROC get_function_ptr_glGetInternalformativ(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetInternalformativ(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLsizei  argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetInternalformativ( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetInternalformativ( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetInternalformativ("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetInternalformativ( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetInternalformativ( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC function_ptr_glGetMemoryObjectDetachedResourcesuivNV;
+int exists_function_glGetMemoryObjectDetachedResourcesuivNV(void);
+PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC get_function_ptr_glGetMemoryObjectDetachedResourcesuivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetMemoryObjectDetachedResourcesuivNV(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, GLsizei  argument_3, GLuint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetMemoryObjectDetachedResourcesuivNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetMemoryObjectDetachedResourcesuivNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetMemoryObjectDetachedResourcesuivNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetMemoryObjectDetachedResourcesuivNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetMemoryObjectDetachedResourcesuivNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC function_ptr_glGetMemoryObjectParameterivEXT;
+int exists_function_glGetMemoryObjectParameterivEXT(void);
+PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC get_function_ptr_glGetMemoryObjectParameterivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetMemoryObjectParameterivEXT(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetMemoryObjectParameterivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetMemoryObjectParameterivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetMemoryObjectParameterivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetMemoryObjectParameterivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetMemoryObjectParameterivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETMULTISAMPLEFVPROC function_ptr_glGetMultisamplefv;
+int exists_function_glGetMultisamplefv(void);
+PFNGLGETMULTISAMPLEFVPROC get_function_ptr_glGetMultisamplefv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetMultisamplefv(GLenum  argument_0, GLuint  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetMultisamplefv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetMultisamplefv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetMultisamplefv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetMultisamplefv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetMultisamplefv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETNEXTPERFQUERYIDINTELPROC function_ptr_glGetNextPerfQueryIdINTEL;
+int exists_function_glGetNextPerfQueryIdINTEL(void);
+PFNGLGETNEXTPERFQUERYIDINTELPROC get_function_ptr_glGetNextPerfQueryIdINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetNextPerfQueryIdINTEL(GLuint  argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetNextPerfQueryIdINTEL( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetNextPerfQueryIdINTEL( argument_0, argument_1, __FILE__, __LINE__, "glGetNextPerfQueryIdINTEL("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetNextPerfQueryIdINTEL( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetNextPerfQueryIdINTEL( argument_0, argument_1)
+#endif
+
+extern PFNGLGETOBJECTLABELPROC function_ptr_glGetObjectLabel;
+int exists_function_glGetObjectLabel(void);
+PFNGLGETOBJECTLABELPROC get_function_ptr_glGetObjectLabel(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetObjectLabel(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLchar * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetObjectLabel( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetObjectLabel( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetObjectLabel("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetObjectLabel( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetObjectLabel( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETOBJECTLABELEXTPROC function_ptr_glGetObjectLabelEXT;
+int exists_function_glGetObjectLabelEXT(void);
+PFNGLGETOBJECTLABELEXTPROC get_function_ptr_glGetObjectLabelEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetObjectLabelEXT(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLchar * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetObjectLabelEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetObjectLabelEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetObjectLabelEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetObjectLabelEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetObjectLabelEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETOBJECTLABELKHRPROC function_ptr_glGetObjectLabelKHR;
+int exists_function_glGetObjectLabelKHR(void);
+PFNGLGETOBJECTLABELKHRPROC get_function_ptr_glGetObjectLabelKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetObjectLabelKHR(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLchar * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetObjectLabelKHR( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetObjectLabelKHR( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetObjectLabelKHR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetObjectLabelKHR( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetObjectLabelKHR( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETOBJECTPTRLABELPROC function_ptr_glGetObjectPtrLabel;
+int exists_function_glGetObjectPtrLabel(void);
+PFNGLGETOBJECTPTRLABELPROC get_function_ptr_glGetObjectPtrLabel(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetObjectPtrLabel(const void * argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetObjectPtrLabel( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetObjectPtrLabel( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetObjectPtrLabel("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetObjectPtrLabel( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetObjectPtrLabel( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETOBJECTPTRLABELKHRPROC function_ptr_glGetObjectPtrLabelKHR;
+int exists_function_glGetObjectPtrLabelKHR(void);
+PFNGLGETOBJECTPTRLABELKHRPROC get_function_ptr_glGetObjectPtrLabelKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetObjectPtrLabelKHR(const void * argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetObjectPtrLabelKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetObjectPtrLabelKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetObjectPtrLabelKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetObjectPtrLabelKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetObjectPtrLabelKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPATHCOMMANDSNVPROC function_ptr_glGetPathCommandsNV;
+int exists_function_glGetPathCommandsNV(void);
+PFNGLGETPATHCOMMANDSNVPROC get_function_ptr_glGetPathCommandsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathCommandsNV(GLuint  argument_0, GLubyte * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPathCommandsNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPathCommandsNV( argument_0, argument_1, __FILE__, __LINE__, "glGetPathCommandsNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPathCommandsNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPathCommandsNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPATHCOORDSNVPROC function_ptr_glGetPathCoordsNV;
+int exists_function_glGetPathCoordsNV(void);
+PFNGLGETPATHCOORDSNVPROC get_function_ptr_glGetPathCoordsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathCoordsNV(GLuint  argument_0, GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPathCoordsNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPathCoordsNV( argument_0, argument_1, __FILE__, __LINE__, "glGetPathCoordsNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPathCoordsNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPathCoordsNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPATHDASHARRAYNVPROC function_ptr_glGetPathDashArrayNV;
+int exists_function_glGetPathDashArrayNV(void);
+PFNGLGETPATHDASHARRAYNVPROC get_function_ptr_glGetPathDashArrayNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathDashArrayNV(GLuint  argument_0, GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPathDashArrayNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPathDashArrayNV( argument_0, argument_1, __FILE__, __LINE__, "glGetPathDashArrayNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPathDashArrayNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPathDashArrayNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPATHLENGTHNVPROC function_ptr_glGetPathLengthNV;
+int exists_function_glGetPathLengthNV(void);
+PFNGLGETPATHLENGTHNVPROC get_function_ptr_glGetPathLengthNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLfloat debug_function__glGetPathLengthNV(GLuint  argument_0, GLsizei  argument_1, GLsizei  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetPathLengthNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetPathLengthNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetPathLengthNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetPathLengthNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetPathLengthNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPATHMETRICRANGENVPROC function_ptr_glGetPathMetricRangeNV;
+int exists_function_glGetPathMetricRangeNV(void);
+PFNGLGETPATHMETRICRANGENVPROC get_function_ptr_glGetPathMetricRangeNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathMetricRangeNV(GLbitfield  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetPathMetricRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetPathMetricRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetPathMetricRangeNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetPathMetricRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetPathMetricRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPATHMETRICSNVPROC function_ptr_glGetPathMetricsNV;
+int exists_function_glGetPathMetricsNV(void);
+PFNGLGETPATHMETRICSNVPROC get_function_ptr_glGetPathMetricsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathMetricsNV(GLbitfield  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLuint  argument_4, GLsizei  argument_5, GLfloat * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glGetPathMetricsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glGetPathMetricsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glGetPathMetricsNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glGetPathMetricsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glGetPathMetricsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLGETPATHPARAMETERFVNVPROC function_ptr_glGetPathParameterfvNV;
+int exists_function_glGetPathParameterfvNV(void);
+PFNGLGETPATHPARAMETERFVNVPROC get_function_ptr_glGetPathParameterfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathParameterfvNV(GLuint  argument_0, GLenum  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetPathParameterfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetPathParameterfvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetPathParameterfvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetPathParameterfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetPathParameterfvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPATHPARAMETERIVNVPROC function_ptr_glGetPathParameterivNV;
+int exists_function_glGetPathParameterivNV(void);
+PFNGLGETPATHPARAMETERIVNVPROC get_function_ptr_glGetPathParameterivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathParameterivNV(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetPathParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetPathParameterivNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetPathParameterivNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetPathParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetPathParameterivNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPATHSPACINGNVPROC function_ptr_glGetPathSpacingNV;
+int exists_function_glGetPathSpacingNV(void);
+PFNGLGETPATHSPACINGNVPROC get_function_ptr_glGetPathSpacingNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPathSpacingNV(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, GLuint  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLenum  argument_7, GLfloat * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glGetPathSpacingNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glGetPathSpacingNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glGetPathSpacingNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glGetPathSpacingNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glGetPathSpacingNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLGETPERFCOUNTERINFOINTELPROC function_ptr_glGetPerfCounterInfoINTEL;
+int exists_function_glGetPerfCounterInfoINTEL(void);
+PFNGLGETPERFCOUNTERINFOINTELPROC get_function_ptr_glGetPerfCounterInfoINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfCounterInfoINTEL(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLchar * argument_3, GLuint  argument_4, GLchar * argument_5, GLuint * argument_6, GLuint * argument_7, GLuint * argument_8, GLuint * argument_9, GLuint64 * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glGetPerfCounterInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glGetPerfCounterInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glGetPerfCounterInfoINTEL("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glGetPerfCounterInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glGetPerfCounterInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLGETPERFMONITORCOUNTERDATAAMDPROC function_ptr_glGetPerfMonitorCounterDataAMD;
+int exists_function_glGetPerfMonitorCounterDataAMD(void);
+PFNGLGETPERFMONITORCOUNTERDATAAMDPROC get_function_ptr_glGetPerfMonitorCounterDataAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorCounterDataAMD(GLuint  argument_0, GLenum  argument_1, GLsizei  argument_2, GLuint * argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetPerfMonitorCounterDataAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetPerfMonitorCounterDataAMD( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetPerfMonitorCounterDataAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetPerfMonitorCounterDataAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorCounterDataAMD( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPERFMONITORCOUNTERINFOAMDPROC function_ptr_glGetPerfMonitorCounterInfoAMD;
+int exists_function_glGetPerfMonitorCounterInfoAMD(void);
+PFNGLGETPERFMONITORCOUNTERINFOAMDPROC get_function_ptr_glGetPerfMonitorCounterInfoAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorCounterInfoAMD(GLuint  argument_0, GLuint  argument_1, GLenum  argument_2, void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetPerfMonitorCounterInfoAMD( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetPerfMonitorCounterInfoAMD( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetPerfMonitorCounterInfoAMD("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetPerfMonitorCounterInfoAMD( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorCounterInfoAMD( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC function_ptr_glGetPerfMonitorCounterStringAMD;
+int exists_function_glGetPerfMonitorCounterStringAMD(void);
+PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC get_function_ptr_glGetPerfMonitorCounterStringAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorCounterStringAMD(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLchar * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetPerfMonitorCounterStringAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetPerfMonitorCounterStringAMD( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetPerfMonitorCounterStringAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetPerfMonitorCounterStringAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorCounterStringAMD( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPERFMONITORCOUNTERSAMDPROC function_ptr_glGetPerfMonitorCountersAMD;
+int exists_function_glGetPerfMonitorCountersAMD(void);
+PFNGLGETPERFMONITORCOUNTERSAMDPROC get_function_ptr_glGetPerfMonitorCountersAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorCountersAMD(GLuint  argument_0, GLint * argument_1, GLint * argument_2, GLsizei  argument_3, GLuint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetPerfMonitorCountersAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPERFMONITORGROUPSTRINGAMDPROC function_ptr_glGetPerfMonitorGroupStringAMD;
+int exists_function_glGetPerfMonitorGroupStringAMD(void);
+PFNGLGETPERFMONITORGROUPSTRINGAMDPROC get_function_ptr_glGetPerfMonitorGroupStringAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorGroupStringAMD(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetPerfMonitorGroupStringAMD( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetPerfMonitorGroupStringAMD( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetPerfMonitorGroupStringAMD("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetPerfMonitorGroupStringAMD( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorGroupStringAMD( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPERFMONITORGROUPSAMDPROC function_ptr_glGetPerfMonitorGroupsAMD;
+int exists_function_glGetPerfMonitorGroupsAMD(void);
+PFNGLGETPERFMONITORGROUPSAMDPROC get_function_ptr_glGetPerfMonitorGroupsAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfMonitorGroupsAMD(GLint * argument_0, GLsizei  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetPerfMonitorGroupsAMD( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetPerfMonitorGroupsAMD( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetPerfMonitorGroupsAMD("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetPerfMonitorGroupsAMD( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetPerfMonitorGroupsAMD( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPERFQUERYDATAINTELPROC function_ptr_glGetPerfQueryDataINTEL;
+int exists_function_glGetPerfQueryDataINTEL(void);
+PFNGLGETPERFQUERYDATAINTELPROC get_function_ptr_glGetPerfQueryDataINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfQueryDataINTEL(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, void * argument_3, GLuint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetPerfQueryDataINTEL( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetPerfQueryDataINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetPerfQueryDataINTEL("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetPerfQueryDataINTEL( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetPerfQueryDataINTEL( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPERFQUERYIDBYNAMEINTELPROC function_ptr_glGetPerfQueryIdByNameINTEL;
+int exists_function_glGetPerfQueryIdByNameINTEL(void);
+PFNGLGETPERFQUERYIDBYNAMEINTELPROC get_function_ptr_glGetPerfQueryIdByNameINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfQueryIdByNameINTEL(GLchar * argument_0, GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPerfQueryIdByNameINTEL( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPerfQueryIdByNameINTEL( argument_0, argument_1, __FILE__, __LINE__, "glGetPerfQueryIdByNameINTEL("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPerfQueryIdByNameINTEL( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPerfQueryIdByNameINTEL( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPERFQUERYINFOINTELPROC function_ptr_glGetPerfQueryInfoINTEL;
+int exists_function_glGetPerfQueryInfoINTEL(void);
+PFNGLGETPERFQUERYINFOINTELPROC get_function_ptr_glGetPerfQueryInfoINTEL(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPerfQueryInfoINTEL(GLuint  argument_0, GLuint  argument_1, GLchar * argument_2, GLuint * argument_3, GLuint * argument_4, GLuint * argument_5, GLuint * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glGetPerfQueryInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glGetPerfQueryInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glGetPerfQueryInfoINTEL("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glGetPerfQueryInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glGetPerfQueryInfoINTEL( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLGETPOINTERVPROC function_ptr_glGetPointerv;
+int exists_function_glGetPointerv(void);
+PFNGLGETPOINTERVPROC get_function_ptr_glGetPointerv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPointerv(GLenum  argument_0, void ** argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPointerv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPointerv( argument_0, argument_1, __FILE__, __LINE__, "glGetPointerv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPointerv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPointerv( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPOINTERVKHRPROC function_ptr_glGetPointervKHR;
+int exists_function_glGetPointervKHR(void);
+PFNGLGETPOINTERVKHRPROC get_function_ptr_glGetPointervKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetPointervKHR(GLenum  argument_0, void ** argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetPointervKHR( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetPointervKHR( argument_0, argument_1, __FILE__, __LINE__, "glGetPointervKHR("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetPointervKHR( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetPointervKHR( argument_0, argument_1)
+#endif
+
+extern PFNGLGETPROGRAMBINARYPROC function_ptr_glGetProgramBinary;
+int exists_function_glGetProgramBinary(void);
+PFNGLGETPROGRAMBINARYPROC get_function_ptr_glGetProgramBinary(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramBinary(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLenum * argument_3, void * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetProgramBinary( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetProgramBinary( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetProgramBinary("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetProgramBinary( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetProgramBinary( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPROGRAMBINARYOESPROC function_ptr_glGetProgramBinaryOES;
+int exists_function_glGetProgramBinaryOES(void);
+PFNGLGETPROGRAMBINARYOESPROC get_function_ptr_glGetProgramBinaryOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramBinaryOES(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLenum * argument_3, void * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetProgramBinaryOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetProgramBinaryOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetProgramBinaryOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetProgramBinaryOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetProgramBinaryOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETPROGRAMINFOLOGPROC function_ptr_glGetProgramInfoLog;
+int exists_function_glGetProgramInfoLog(void);
+PFNGLGETPROGRAMINFOLOGPROC get_function_ptr_glGetProgramInfoLog(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramInfoLog(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetProgramInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetProgramInfoLog( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetProgramInfoLog("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetProgramInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetProgramInfoLog( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPROGRAMINTERFACEIVPROC function_ptr_glGetProgramInterfaceiv;
+int exists_function_glGetProgramInterfaceiv(void);
+PFNGLGETPROGRAMINTERFACEIVPROC get_function_ptr_glGetProgramInterfaceiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramInterfaceiv(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetProgramInterfaceiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetProgramInterfaceiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetProgramInterfaceiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetProgramInterfaceiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetProgramInterfaceiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC function_ptr_glGetProgramPipelineInfoLog;
+int exists_function_glGetProgramPipelineInfoLog(void);
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC get_function_ptr_glGetProgramPipelineInfoLog(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramPipelineInfoLog(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetProgramPipelineInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetProgramPipelineInfoLog( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetProgramPipelineInfoLog("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetProgramPipelineInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetProgramPipelineInfoLog( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC function_ptr_glGetProgramPipelineInfoLogEXT;
+int exists_function_glGetProgramPipelineInfoLogEXT(void);
+PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC get_function_ptr_glGetProgramPipelineInfoLogEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramPipelineInfoLogEXT(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetProgramPipelineInfoLogEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetProgramPipelineInfoLogEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetProgramPipelineInfoLogEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetProgramPipelineInfoLogEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetProgramPipelineInfoLogEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETPROGRAMPIPELINEIVPROC function_ptr_glGetProgramPipelineiv;
+int exists_function_glGetProgramPipelineiv(void);
+PFNGLGETPROGRAMPIPELINEIVPROC get_function_ptr_glGetProgramPipelineiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramPipelineiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramPipelineiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramPipelineiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramPipelineiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramPipelineiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramPipelineiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPROGRAMPIPELINEIVEXTPROC function_ptr_glGetProgramPipelineivEXT;
+int exists_function_glGetProgramPipelineivEXT(void);
+PFNGLGETPROGRAMPIPELINEIVEXTPROC get_function_ptr_glGetProgramPipelineivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramPipelineivEXT(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramPipelineivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramPipelineivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramPipelineivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramPipelineivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramPipelineivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCEINDEXPROC function_ptr_glGetProgramResourceIndex;
+int exists_function_glGetProgramResourceIndex(void);
+PFNGLGETPROGRAMRESOURCEINDEXPROC get_function_ptr_glGetProgramResourceIndex(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glGetProgramResourceIndex(GLuint  argument_0, GLenum  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramResourceIndex( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramResourceIndex( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramResourceIndex("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramResourceIndex( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramResourceIndex( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCELOCATIONPROC function_ptr_glGetProgramResourceLocation;
+int exists_function_glGetProgramResourceLocation(void);
+PFNGLGETPROGRAMRESOURCELOCATIONPROC get_function_ptr_glGetProgramResourceLocation(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetProgramResourceLocation(GLuint  argument_0, GLenum  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramResourceLocation( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramResourceLocation( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramResourceLocation("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramResourceLocation( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramResourceLocation( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCELOCATIONINDEXEXTPROC function_ptr_glGetProgramResourceLocationIndexEXT;
+int exists_function_glGetProgramResourceLocationIndexEXT(void);
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXEXTPROC get_function_ptr_glGetProgramResourceLocationIndexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetProgramResourceLocationIndexEXT(GLuint  argument_0, GLenum  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramResourceLocationIndexEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramResourceLocationIndexEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramResourceLocationIndexEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramResourceLocationIndexEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramResourceLocationIndexEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCENAMEPROC function_ptr_glGetProgramResourceName;
+int exists_function_glGetProgramResourceName(void);
+PFNGLGETPROGRAMRESOURCENAMEPROC get_function_ptr_glGetProgramResourceName(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramResourceName(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLsizei  argument_3, GLsizei * argument_4, GLchar * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glGetProgramResourceName( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glGetProgramResourceName( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glGetProgramResourceName("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glGetProgramResourceName( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glGetProgramResourceName( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCEFVNVPROC function_ptr_glGetProgramResourcefvNV;
+int exists_function_glGetProgramResourcefvNV(void);
+PFNGLGETPROGRAMRESOURCEFVNVPROC get_function_ptr_glGetProgramResourcefvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramResourcefvNV(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLsizei  argument_3, const GLenum * argument_4, GLsizei  argument_5, GLsizei * argument_6, GLfloat * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glGetProgramResourcefvNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glGetProgramResourcefvNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glGetProgramResourcefvNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glGetProgramResourcefvNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glGetProgramResourcefvNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLGETPROGRAMRESOURCEIVPROC function_ptr_glGetProgramResourceiv;
+int exists_function_glGetProgramResourceiv(void);
+PFNGLGETPROGRAMRESOURCEIVPROC get_function_ptr_glGetProgramResourceiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramResourceiv(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLsizei  argument_3, const GLenum * argument_4, GLsizei  argument_5, GLsizei * argument_6, GLint * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glGetProgramResourceiv( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glGetProgramResourceiv( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glGetProgramResourceiv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glGetProgramResourceiv( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glGetProgramResourceiv( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLGETPROGRAMIVPROC function_ptr_glGetProgramiv;
+int exists_function_glGetProgramiv(void);
+PFNGLGETPROGRAMIVPROC get_function_ptr_glGetProgramiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetProgramiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetProgramiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetProgramiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetProgramiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetProgramiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetProgramiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYOBJECTI64VEXTPROC function_ptr_glGetQueryObjecti64vEXT;
+int exists_function_glGetQueryObjecti64vEXT(void);
+PFNGLGETQUERYOBJECTI64VEXTPROC get_function_ptr_glGetQueryObjecti64vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryObjecti64vEXT(GLuint  argument_0, GLenum  argument_1, GLint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryObjecti64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryObjecti64vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryObjecti64vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryObjecti64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryObjecti64vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYOBJECTIVEXTPROC function_ptr_glGetQueryObjectivEXT;
+int exists_function_glGetQueryObjectivEXT(void);
+PFNGLGETQUERYOBJECTIVEXTPROC get_function_ptr_glGetQueryObjectivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryObjectivEXT(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryObjectivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryObjectivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryObjectivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryObjectivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryObjectivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYOBJECTUI64VEXTPROC function_ptr_glGetQueryObjectui64vEXT;
+int exists_function_glGetQueryObjectui64vEXT(void);
+PFNGLGETQUERYOBJECTUI64VEXTPROC get_function_ptr_glGetQueryObjectui64vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryObjectui64vEXT(GLuint  argument_0, GLenum  argument_1, GLuint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryObjectui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryObjectui64vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryObjectui64vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryObjectui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryObjectui64vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYOBJECTUIVPROC function_ptr_glGetQueryObjectuiv;
+int exists_function_glGetQueryObjectuiv(void);
+PFNGLGETQUERYOBJECTUIVPROC get_function_ptr_glGetQueryObjectuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryObjectuiv(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryObjectuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryObjectuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryObjectuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryObjectuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryObjectuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYOBJECTUIVEXTPROC function_ptr_glGetQueryObjectuivEXT;
+int exists_function_glGetQueryObjectuivEXT(void);
+PFNGLGETQUERYOBJECTUIVEXTPROC get_function_ptr_glGetQueryObjectuivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryObjectuivEXT(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryObjectuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryObjectuivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryObjectuivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryObjectuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryObjectuivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYIVPROC function_ptr_glGetQueryiv;
+int exists_function_glGetQueryiv(void);
+PFNGLGETQUERYIVPROC get_function_ptr_glGetQueryiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryiv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETQUERYIVEXTPROC function_ptr_glGetQueryivEXT;
+int exists_function_glGetQueryivEXT(void);
+PFNGLGETQUERYIVEXTPROC get_function_ptr_glGetQueryivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetQueryivEXT(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetQueryivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetQueryivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetQueryivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetQueryivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetQueryivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETRENDERBUFFERPARAMETERIVPROC function_ptr_glGetRenderbufferParameteriv;
+int exists_function_glGetRenderbufferParameteriv(void);
+PFNGLGETRENDERBUFFERPARAMETERIVPROC get_function_ptr_glGetRenderbufferParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetRenderbufferParameteriv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetRenderbufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetRenderbufferParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetRenderbufferParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetRenderbufferParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetRenderbufferParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIIVPROC function_ptr_glGetSamplerParameterIiv;
+int exists_function_glGetSamplerParameterIiv(void);
+PFNGLGETSAMPLERPARAMETERIIVPROC get_function_ptr_glGetSamplerParameterIiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIIVEXTPROC function_ptr_glGetSamplerParameterIivEXT;
+int exists_function_glGetSamplerParameterIivEXT(void);
+PFNGLGETSAMPLERPARAMETERIIVEXTPROC get_function_ptr_glGetSamplerParameterIivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIivEXT(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIIVOESPROC function_ptr_glGetSamplerParameterIivOES;
+int exists_function_glGetSamplerParameterIivOES(void);
+PFNGLGETSAMPLERPARAMETERIIVOESPROC get_function_ptr_glGetSamplerParameterIivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIivOES(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIUIVPROC function_ptr_glGetSamplerParameterIuiv;
+int exists_function_glGetSamplerParameterIuiv(void);
+PFNGLGETSAMPLERPARAMETERIUIVPROC get_function_ptr_glGetSamplerParameterIuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIuiv(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIUIVEXTPROC function_ptr_glGetSamplerParameterIuivEXT;
+int exists_function_glGetSamplerParameterIuivEXT(void);
+PFNGLGETSAMPLERPARAMETERIUIVEXTPROC get_function_ptr_glGetSamplerParameterIuivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIuivEXT(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIuivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIuivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIuivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIUIVOESPROC function_ptr_glGetSamplerParameterIuivOES;
+int exists_function_glGetSamplerParameterIuivOES(void);
+PFNGLGETSAMPLERPARAMETERIUIVOESPROC get_function_ptr_glGetSamplerParameterIuivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterIuivOES(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterIuivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterIuivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterIuivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERFVPROC function_ptr_glGetSamplerParameterfv;
+int exists_function_glGetSamplerParameterfv(void);
+PFNGLGETSAMPLERPARAMETERFVPROC get_function_ptr_glGetSamplerParameterfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameterfv(GLuint  argument_0, GLenum  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameterfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameterfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameterfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSAMPLERPARAMETERIVPROC function_ptr_glGetSamplerParameteriv;
+int exists_function_glGetSamplerParameteriv(void);
+PFNGLGETSAMPLERPARAMETERIVPROC get_function_ptr_glGetSamplerParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSamplerParameteriv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSamplerParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSamplerParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSamplerParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSamplerParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSamplerParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSEMAPHOREPARAMETERIVNVPROC function_ptr_glGetSemaphoreParameterivNV;
+int exists_function_glGetSemaphoreParameterivNV(void);
+PFNGLGETSEMAPHOREPARAMETERIVNVPROC get_function_ptr_glGetSemaphoreParameterivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSemaphoreParameterivNV(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSemaphoreParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSemaphoreParameterivNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSemaphoreParameterivNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSemaphoreParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSemaphoreParameterivNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC function_ptr_glGetSemaphoreParameterui64vEXT;
+int exists_function_glGetSemaphoreParameterui64vEXT(void);
+PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC get_function_ptr_glGetSemaphoreParameterui64vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSemaphoreParameterui64vEXT(GLuint  argument_0, GLenum  argument_1, GLuint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetSemaphoreParameterui64vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSHADERINFOLOGPROC function_ptr_glGetShaderInfoLog;
+int exists_function_glGetShaderInfoLog(void);
+PFNGLGETSHADERINFOLOGPROC get_function_ptr_glGetShaderInfoLog(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShaderInfoLog(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetShaderInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetShaderInfoLog( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetShaderInfoLog("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetShaderInfoLog( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetShaderInfoLog( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETSHADERPRECISIONFORMATPROC function_ptr_glGetShaderPrecisionFormat;
+int exists_function_glGetShaderPrecisionFormat(void);
+PFNGLGETSHADERPRECISIONFORMATPROC get_function_ptr_glGetShaderPrecisionFormat(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShaderPrecisionFormat(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetShaderPrecisionFormat( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetShaderPrecisionFormat( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetShaderPrecisionFormat("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetShaderPrecisionFormat( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetShaderPrecisionFormat( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETSHADERSOURCEPROC function_ptr_glGetShaderSource;
+int exists_function_glGetShaderSource(void);
+PFNGLGETSHADERSOURCEPROC get_function_ptr_glGetShaderSource(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShaderSource(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetShaderSource( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetShaderSource( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetShaderSource("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetShaderSource( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetShaderSource( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETSHADERIVPROC function_ptr_glGetShaderiv;
+int exists_function_glGetShaderiv(void);
+PFNGLGETSHADERIVPROC get_function_ptr_glGetShaderiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShaderiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetShaderiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetShaderiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetShaderiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetShaderiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetShaderiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSHADINGRATEIMAGEPALETTENVPROC function_ptr_glGetShadingRateImagePaletteNV;
+int exists_function_glGetShadingRateImagePaletteNV(void);
+PFNGLGETSHADINGRATEIMAGEPALETTENVPROC get_function_ptr_glGetShadingRateImagePaletteNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShadingRateImagePaletteNV(GLuint  argument_0, GLuint  argument_1, GLenum * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetShadingRateImagePaletteNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetShadingRateImagePaletteNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetShadingRateImagePaletteNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetShadingRateImagePaletteNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetShadingRateImagePaletteNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC function_ptr_glGetShadingRateSampleLocationivNV;
+int exists_function_glGetShadingRateSampleLocationivNV(void);
+PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC get_function_ptr_glGetShadingRateSampleLocationivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetShadingRateSampleLocationivNV(GLenum  argument_0, GLuint  argument_1, GLuint  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetShadingRateSampleLocationivNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetShadingRateSampleLocationivNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetShadingRateSampleLocationivNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetShadingRateSampleLocationivNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetShadingRateSampleLocationivNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETSTRINGPROC function_ptr_glGetString;
+int exists_function_glGetString(void);
+PFNGLGETSTRINGPROC get_function_ptr_glGetString(void);
+#ifdef FASTUIDRAW_DEBUG
+const GLubyte * debug_function__glGetString(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetString( argument_0) fastuidraw::gl_binding::debug_function__glGetString( argument_0, __FILE__, __LINE__, "glGetString("#argument_0")", #argument_0)
+#else
+#define glGetString( argument_0) fastuidraw::gl_binding::function_ptr_glGetString( argument_0)
+#endif
+
+extern PFNGLGETSTRINGIPROC function_ptr_glGetStringi;
+int exists_function_glGetStringi(void);
+PFNGLGETSTRINGIPROC get_function_ptr_glGetStringi(void);
+#ifdef FASTUIDRAW_DEBUG
+const GLubyte * debug_function__glGetStringi(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetStringi( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetStringi( argument_0, argument_1, __FILE__, __LINE__, "glGetStringi("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetStringi( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetStringi( argument_0, argument_1)
+#endif
+
+extern PFNGLGETSYNCIVPROC function_ptr_glGetSynciv;
+int exists_function_glGetSynciv(void);
+PFNGLGETSYNCIVPROC get_function_ptr_glGetSynciv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSynciv(GLsync  argument_0, GLenum  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetSynciv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetSynciv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetSynciv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetSynciv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetSynciv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETSYNCIVAPPLEPROC function_ptr_glGetSyncivAPPLE;
+int exists_function_glGetSyncivAPPLE(void);
+PFNGLGETSYNCIVAPPLEPROC get_function_ptr_glGetSyncivAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetSyncivAPPLE(GLsync  argument_0, GLenum  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glGetSyncivAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glGetSyncivAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glGetSyncivAPPLE("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glGetSyncivAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glGetSyncivAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLGETTEXLEVELPARAMETERFVPROC function_ptr_glGetTexLevelParameterfv;
+int exists_function_glGetTexLevelParameterfv(void);
+PFNGLGETTEXLEVELPARAMETERFVPROC get_function_ptr_glGetTexLevelParameterfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexLevelParameterfv(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetTexLevelParameterfv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetTexLevelParameterfv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetTexLevelParameterfv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetTexLevelParameterfv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetTexLevelParameterfv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETTEXLEVELPARAMETERIVPROC function_ptr_glGetTexLevelParameteriv;
+int exists_function_glGetTexLevelParameteriv(void);
+PFNGLGETTEXLEVELPARAMETERIVPROC get_function_ptr_glGetTexLevelParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexLevelParameteriv(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetTexLevelParameteriv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetTexLevelParameteriv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetTexLevelParameteriv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetTexLevelParameteriv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetTexLevelParameteriv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETTEXPARAMETERIIVPROC function_ptr_glGetTexParameterIiv;
+int exists_function_glGetTexParameterIiv(void);
+PFNGLGETTEXPARAMETERIIVPROC get_function_ptr_glGetTexParameterIiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIiv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIIVEXTPROC function_ptr_glGetTexParameterIivEXT;
+int exists_function_glGetTexParameterIivEXT(void);
+PFNGLGETTEXPARAMETERIIVEXTPROC get_function_ptr_glGetTexParameterIivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIivEXT(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIIVOESPROC function_ptr_glGetTexParameterIivOES;
+int exists_function_glGetTexParameterIivOES(void);
+PFNGLGETTEXPARAMETERIIVOESPROC get_function_ptr_glGetTexParameterIivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIivOES(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIUIVPROC function_ptr_glGetTexParameterIuiv;
+int exists_function_glGetTexParameterIuiv(void);
+PFNGLGETTEXPARAMETERIUIVPROC get_function_ptr_glGetTexParameterIuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIuiv(GLenum  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIUIVEXTPROC function_ptr_glGetTexParameterIuivEXT;
+int exists_function_glGetTexParameterIuivEXT(void);
+PFNGLGETTEXPARAMETERIUIVEXTPROC get_function_ptr_glGetTexParameterIuivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIuivEXT(GLenum  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIuivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIuivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIuivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIUIVOESPROC function_ptr_glGetTexParameterIuivOES;
+int exists_function_glGetTexParameterIuivOES(void);
+PFNGLGETTEXPARAMETERIUIVOESPROC get_function_ptr_glGetTexParameterIuivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterIuivOES(GLenum  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterIuivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterIuivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterIuivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERFVPROC function_ptr_glGetTexParameterfv;
+int exists_function_glGetTexParameterfv(void);
+PFNGLGETTEXPARAMETERFVPROC get_function_ptr_glGetTexParameterfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameterfv(GLenum  argument_0, GLenum  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameterfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameterfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameterfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXPARAMETERIVPROC function_ptr_glGetTexParameteriv;
+int exists_function_glGetTexParameteriv(void);
+PFNGLGETTEXPARAMETERIVPROC get_function_ptr_glGetTexParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTexParameteriv(GLenum  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetTexParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetTexParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetTexParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetTexParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetTexParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETTEXTUREHANDLEIMGPROC function_ptr_glGetTextureHandleIMG;
+int exists_function_glGetTextureHandleIMG(void);
+PFNGLGETTEXTUREHANDLEIMGPROC get_function_ptr_glGetTextureHandleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint64 debug_function__glGetTextureHandleIMG(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetTextureHandleIMG( argument_0) fastuidraw::gl_binding::debug_function__glGetTextureHandleIMG( argument_0, __FILE__, __LINE__, "glGetTextureHandleIMG("#argument_0")", #argument_0)
+#else
+#define glGetTextureHandleIMG( argument_0) fastuidraw::gl_binding::function_ptr_glGetTextureHandleIMG( argument_0)
+#endif
+
+extern PFNGLGETTEXTUREHANDLENVPROC function_ptr_glGetTextureHandleNV;
+int exists_function_glGetTextureHandleNV(void);
+PFNGLGETTEXTUREHANDLENVPROC get_function_ptr_glGetTextureHandleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint64 debug_function__glGetTextureHandleNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetTextureHandleNV( argument_0) fastuidraw::gl_binding::debug_function__glGetTextureHandleNV( argument_0, __FILE__, __LINE__, "glGetTextureHandleNV("#argument_0")", #argument_0)
+#else
+#define glGetTextureHandleNV( argument_0) fastuidraw::gl_binding::function_ptr_glGetTextureHandleNV( argument_0)
+#endif
+
+extern PFNGLGETTEXTURESAMPLERHANDLEIMGPROC function_ptr_glGetTextureSamplerHandleIMG;
+int exists_function_glGetTextureSamplerHandleIMG(void);
+PFNGLGETTEXTURESAMPLERHANDLEIMGPROC get_function_ptr_glGetTextureSamplerHandleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint64 debug_function__glGetTextureSamplerHandleIMG(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetTextureSamplerHandleIMG( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetTextureSamplerHandleIMG( argument_0, argument_1, __FILE__, __LINE__, "glGetTextureSamplerHandleIMG("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetTextureSamplerHandleIMG( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetTextureSamplerHandleIMG( argument_0, argument_1)
+#endif
+
+extern PFNGLGETTEXTURESAMPLERHANDLENVPROC function_ptr_glGetTextureSamplerHandleNV;
+int exists_function_glGetTextureSamplerHandleNV(void);
+PFNGLGETTEXTURESAMPLERHANDLENVPROC get_function_ptr_glGetTextureSamplerHandleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint64 debug_function__glGetTextureSamplerHandleNV(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetTextureSamplerHandleNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetTextureSamplerHandleNV( argument_0, argument_1, __FILE__, __LINE__, "glGetTextureSamplerHandleNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetTextureSamplerHandleNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetTextureSamplerHandleNV( argument_0, argument_1)
+#endif
+
+extern PFNGLGETTRANSFORMFEEDBACKVARYINGPROC function_ptr_glGetTransformFeedbackVarying;
+int exists_function_glGetTransformFeedbackVarying(void);
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC get_function_ptr_glGetTransformFeedbackVarying(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTransformFeedbackVarying(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, GLsizei * argument_3, GLsizei * argument_4, GLenum * argument_5, GLchar * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glGetTransformFeedbackVarying( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glGetTransformFeedbackVarying( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glGetTransformFeedbackVarying("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glGetTransformFeedbackVarying( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glGetTransformFeedbackVarying( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC function_ptr_glGetTranslatedShaderSourceANGLE;
+int exists_function_glGetTranslatedShaderSourceANGLE(void);
+PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC get_function_ptr_glGetTranslatedShaderSourceANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetTranslatedShaderSourceANGLE(GLuint  argument_0, GLsizei  argument_1, GLsizei * argument_2, GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetTranslatedShaderSourceANGLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetTranslatedShaderSourceANGLE( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetTranslatedShaderSourceANGLE("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetTranslatedShaderSourceANGLE( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetTranslatedShaderSourceANGLE( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETUNIFORMBLOCKINDEXPROC function_ptr_glGetUniformBlockIndex;
+int exists_function_glGetUniformBlockIndex(void);
+PFNGLGETUNIFORMBLOCKINDEXPROC get_function_ptr_glGetUniformBlockIndex(void);
+#ifdef FASTUIDRAW_DEBUG
+GLuint debug_function__glGetUniformBlockIndex(GLuint  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetUniformBlockIndex( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetUniformBlockIndex( argument_0, argument_1, __FILE__, __LINE__, "glGetUniformBlockIndex("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetUniformBlockIndex( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetUniformBlockIndex( argument_0, argument_1)
+#endif
+
+extern PFNGLGETUNIFORMINDICESPROC function_ptr_glGetUniformIndices;
+int exists_function_glGetUniformIndices(void);
+PFNGLGETUNIFORMINDICESPROC get_function_ptr_glGetUniformIndices(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUniformIndices(GLuint  argument_0, GLsizei  argument_1, const GLchar *const* argument_2, GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetUniformIndices( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetUniformIndices( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetUniformIndices("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetUniformIndices( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetUniformIndices( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETUNIFORMLOCATIONPROC function_ptr_glGetUniformLocation;
+int exists_function_glGetUniformLocation(void);
+PFNGLGETUNIFORMLOCATIONPROC get_function_ptr_glGetUniformLocation(void);
+#ifdef FASTUIDRAW_DEBUG
+GLint debug_function__glGetUniformLocation(GLuint  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetUniformLocation( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetUniformLocation( argument_0, argument_1, __FILE__, __LINE__, "glGetUniformLocation("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetUniformLocation( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetUniformLocation( argument_0, argument_1)
+#endif
+
+extern PFNGLGETUNIFORMFVPROC function_ptr_glGetUniformfv;
+int exists_function_glGetUniformfv(void);
+PFNGLGETUNIFORMFVPROC get_function_ptr_glGetUniformfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUniformfv(GLuint  argument_0, GLint  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetUniformfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetUniformfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetUniformfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetUniformfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetUniformfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETUNIFORMI64VNVPROC function_ptr_glGetUniformi64vNV;
+int exists_function_glGetUniformi64vNV(void);
+PFNGLGETUNIFORMI64VNVPROC get_function_ptr_glGetUniformi64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUniformi64vNV(GLuint  argument_0, GLint  argument_1, GLint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetUniformi64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetUniformi64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetUniformi64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetUniformi64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetUniformi64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETUNIFORMIVPROC function_ptr_glGetUniformiv;
+int exists_function_glGetUniformiv(void);
+PFNGLGETUNIFORMIVPROC get_function_ptr_glGetUniformiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUniformiv(GLuint  argument_0, GLint  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetUniformiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetUniformiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetUniformiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetUniformiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetUniformiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETUNIFORMUIVPROC function_ptr_glGetUniformuiv;
+int exists_function_glGetUniformuiv(void);
+PFNGLGETUNIFORMUIVPROC get_function_ptr_glGetUniformuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUniformuiv(GLuint  argument_0, GLint  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetUniformuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetUniformuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetUniformuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetUniformuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetUniformuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETUNSIGNEDBYTEI_VEXTPROC function_ptr_glGetUnsignedBytei_vEXT;
+int exists_function_glGetUnsignedBytei_vEXT(void);
+PFNGLGETUNSIGNEDBYTEI_VEXTPROC get_function_ptr_glGetUnsignedBytei_vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUnsignedBytei_vEXT(GLenum  argument_0, GLuint  argument_1, GLubyte * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetUnsignedBytei_vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetUnsignedBytei_vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetUnsignedBytei_vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetUnsignedBytei_vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetUnsignedBytei_vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETUNSIGNEDBYTEVEXTPROC function_ptr_glGetUnsignedBytevEXT;
+int exists_function_glGetUnsignedBytevEXT(void);
+PFNGLGETUNSIGNEDBYTEVEXTPROC get_function_ptr_glGetUnsignedBytevEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetUnsignedBytevEXT(GLenum  argument_0, GLubyte * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glGetUnsignedBytevEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glGetUnsignedBytevEXT( argument_0, argument_1, __FILE__, __LINE__, "glGetUnsignedBytevEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glGetUnsignedBytevEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glGetUnsignedBytevEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLGETVERTEXATTRIBIIVPROC function_ptr_glGetVertexAttribIiv;
+int exists_function_glGetVertexAttribIiv(void);
+PFNGLGETVERTEXATTRIBIIVPROC get_function_ptr_glGetVertexAttribIiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetVertexAttribIiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetVertexAttribIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetVertexAttribIiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetVertexAttribIiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetVertexAttribIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetVertexAttribIiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETVERTEXATTRIBIUIVPROC function_ptr_glGetVertexAttribIuiv;
+int exists_function_glGetVertexAttribIuiv(void);
+PFNGLGETVERTEXATTRIBIUIVPROC get_function_ptr_glGetVertexAttribIuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetVertexAttribIuiv(GLuint  argument_0, GLenum  argument_1, GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetVertexAttribIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetVertexAttribIuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetVertexAttribIuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetVertexAttribIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetVertexAttribIuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETVERTEXATTRIBPOINTERVPROC function_ptr_glGetVertexAttribPointerv;
+int exists_function_glGetVertexAttribPointerv(void);
+PFNGLGETVERTEXATTRIBPOINTERVPROC get_function_ptr_glGetVertexAttribPointerv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetVertexAttribPointerv(GLuint  argument_0, GLenum  argument_1, void ** argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetVertexAttribPointerv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetVertexAttribPointerv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetVertexAttribPointerv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetVertexAttribPointerv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetVertexAttribPointerv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETVERTEXATTRIBFVPROC function_ptr_glGetVertexAttribfv;
+int exists_function_glGetVertexAttribfv(void);
+PFNGLGETVERTEXATTRIBFVPROC get_function_ptr_glGetVertexAttribfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetVertexAttribfv(GLuint  argument_0, GLenum  argument_1, GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetVertexAttribfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetVertexAttribfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetVertexAttribfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetVertexAttribfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetVertexAttribfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETVERTEXATTRIBIVPROC function_ptr_glGetVertexAttribiv;
+int exists_function_glGetVertexAttribiv(void);
+PFNGLGETVERTEXATTRIBIVPROC get_function_ptr_glGetVertexAttribiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetVertexAttribiv(GLuint  argument_0, GLenum  argument_1, GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glGetVertexAttribiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glGetVertexAttribiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glGetVertexAttribiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glGetVertexAttribiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glGetVertexAttribiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLGETVKPROCADDRNVPROC function_ptr_glGetVkProcAddrNV;
+int exists_function_glGetVkProcAddrNV(void);
+PFNGLGETVKPROCADDRNVPROC get_function_ptr_glGetVkProcAddrNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLVULKANPROCNV debug_function__glGetVkProcAddrNV(const GLchar * argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glGetVkProcAddrNV( argument_0) fastuidraw::gl_binding::debug_function__glGetVkProcAddrNV( argument_0, __FILE__, __LINE__, "glGetVkProcAddrNV("#argument_0")", #argument_0)
+#else
+#define glGetVkProcAddrNV( argument_0) fastuidraw::gl_binding::function_ptr_glGetVkProcAddrNV( argument_0)
+#endif
+
+extern PFNGLGETNUNIFORMFVPROC function_ptr_glGetnUniformfv;
+int exists_function_glGetnUniformfv(void);
+PFNGLGETNUNIFORMFVPROC get_function_ptr_glGetnUniformfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformfv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformfv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformfv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformfv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformfv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformfv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMFVEXTPROC function_ptr_glGetnUniformfvEXT;
+int exists_function_glGetnUniformfvEXT(void);
+PFNGLGETNUNIFORMFVEXTPROC get_function_ptr_glGetnUniformfvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformfvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformfvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformfvEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformfvEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformfvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformfvEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMFVKHRPROC function_ptr_glGetnUniformfvKHR;
+int exists_function_glGetnUniformfvKHR(void);
+PFNGLGETNUNIFORMFVKHRPROC get_function_ptr_glGetnUniformfvKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformfvKHR(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformfvKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformfvKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformfvKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformfvKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformfvKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMIVPROC function_ptr_glGetnUniformiv;
+int exists_function_glGetnUniformiv(void);
+PFNGLGETNUNIFORMIVPROC get_function_ptr_glGetnUniformiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMIVEXTPROC function_ptr_glGetnUniformivEXT;
+int exists_function_glGetnUniformivEXT(void);
+PFNGLGETNUNIFORMIVEXTPROC get_function_ptr_glGetnUniformivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMIVKHRPROC function_ptr_glGetnUniformivKHR;
+int exists_function_glGetnUniformivKHR(void);
+PFNGLGETNUNIFORMIVKHRPROC get_function_ptr_glGetnUniformivKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformivKHR(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformivKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformivKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformivKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformivKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformivKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMUIVPROC function_ptr_glGetnUniformuiv;
+int exists_function_glGetnUniformuiv(void);
+PFNGLGETNUNIFORMUIVPROC get_function_ptr_glGetnUniformuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformuiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformuiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformuiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformuiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformuiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformuiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLGETNUNIFORMUIVKHRPROC function_ptr_glGetnUniformuivKHR;
+int exists_function_glGetnUniformuivKHR(void);
+PFNGLGETNUNIFORMUIVKHRPROC get_function_ptr_glGetnUniformuivKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glGetnUniformuivKHR(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glGetnUniformuivKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glGetnUniformuivKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glGetnUniformuivKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glGetnUniformuivKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glGetnUniformuivKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLHINTPROC function_ptr_glHint;
+int exists_function_glHint(void);
+PFNGLHINTPROC get_function_ptr_glHint(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glHint(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glHint( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glHint( argument_0, argument_1, __FILE__, __LINE__, "glHint("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glHint( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glHint( argument_0, argument_1)
+#endif
+
+extern PFNGLIMPORTMEMORYFDEXTPROC function_ptr_glImportMemoryFdEXT;
+int exists_function_glImportMemoryFdEXT(void);
+PFNGLIMPORTMEMORYFDEXTPROC get_function_ptr_glImportMemoryFdEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportMemoryFdEXT(GLuint  argument_0, GLuint64  argument_1, GLenum  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glImportMemoryFdEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glImportMemoryFdEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glImportMemoryFdEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glImportMemoryFdEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glImportMemoryFdEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC function_ptr_glImportMemoryWin32HandleEXT;
+int exists_function_glImportMemoryWin32HandleEXT(void);
+PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC get_function_ptr_glImportMemoryWin32HandleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportMemoryWin32HandleEXT(GLuint  argument_0, GLuint64  argument_1, GLenum  argument_2, void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glImportMemoryWin32HandleEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glImportMemoryWin32HandleEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glImportMemoryWin32HandleEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glImportMemoryWin32HandleEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glImportMemoryWin32HandleEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLIMPORTMEMORYWIN32NAMEEXTPROC function_ptr_glImportMemoryWin32NameEXT;
+int exists_function_glImportMemoryWin32NameEXT(void);
+PFNGLIMPORTMEMORYWIN32NAMEEXTPROC get_function_ptr_glImportMemoryWin32NameEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportMemoryWin32NameEXT(GLuint  argument_0, GLuint64  argument_1, GLenum  argument_2, const void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glImportMemoryWin32NameEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glImportMemoryWin32NameEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glImportMemoryWin32NameEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glImportMemoryWin32NameEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glImportMemoryWin32NameEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLIMPORTSEMAPHOREFDEXTPROC function_ptr_glImportSemaphoreFdEXT;
+int exists_function_glImportSemaphoreFdEXT(void);
+PFNGLIMPORTSEMAPHOREFDEXTPROC get_function_ptr_glImportSemaphoreFdEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportSemaphoreFdEXT(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glImportSemaphoreFdEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glImportSemaphoreFdEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glImportSemaphoreFdEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glImportSemaphoreFdEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glImportSemaphoreFdEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC function_ptr_glImportSemaphoreWin32HandleEXT;
+int exists_function_glImportSemaphoreWin32HandleEXT(void);
+PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC get_function_ptr_glImportSemaphoreWin32HandleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportSemaphoreWin32HandleEXT(GLuint  argument_0, GLenum  argument_1, void * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glImportSemaphoreWin32HandleEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glImportSemaphoreWin32HandleEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glImportSemaphoreWin32HandleEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glImportSemaphoreWin32HandleEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glImportSemaphoreWin32HandleEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC function_ptr_glImportSemaphoreWin32NameEXT;
+int exists_function_glImportSemaphoreWin32NameEXT(void);
+PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC get_function_ptr_glImportSemaphoreWin32NameEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glImportSemaphoreWin32NameEXT(GLuint  argument_0, GLenum  argument_1, const void * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glImportSemaphoreWin32NameEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glImportSemaphoreWin32NameEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glImportSemaphoreWin32NameEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glImportSemaphoreWin32NameEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glImportSemaphoreWin32NameEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLINSERTEVENTMARKEREXTPROC function_ptr_glInsertEventMarkerEXT;
+int exists_function_glInsertEventMarkerEXT(void);
+PFNGLINSERTEVENTMARKEREXTPROC get_function_ptr_glInsertEventMarkerEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glInsertEventMarkerEXT(GLsizei  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glInsertEventMarkerEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glInsertEventMarkerEXT( argument_0, argument_1, __FILE__, __LINE__, "glInsertEventMarkerEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glInsertEventMarkerEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glInsertEventMarkerEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLINTERPOLATEPATHSNVPROC function_ptr_glInterpolatePathsNV;
+int exists_function_glInterpolatePathsNV(void);
+PFNGLINTERPOLATEPATHSNVPROC get_function_ptr_glInterpolatePathsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glInterpolatePathsNV(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glInterpolatePathsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glInterpolatePathsNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glInterpolatePathsNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glInterpolatePathsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glInterpolatePathsNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLINVALIDATEFRAMEBUFFERPROC function_ptr_glInvalidateFramebuffer;
+int exists_function_glInvalidateFramebuffer(void);
+PFNGLINVALIDATEFRAMEBUFFERPROC get_function_ptr_glInvalidateFramebuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glInvalidateFramebuffer(GLenum  argument_0, GLsizei  argument_1, const GLenum * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glInvalidateFramebuffer( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glInvalidateFramebuffer( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glInvalidateFramebuffer("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glInvalidateFramebuffer( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glInvalidateFramebuffer( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC function_ptr_glInvalidateSubFramebuffer;
+int exists_function_glInvalidateSubFramebuffer(void);
+PFNGLINVALIDATESUBFRAMEBUFFERPROC get_function_ptr_glInvalidateSubFramebuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glInvalidateSubFramebuffer(GLenum  argument_0, GLsizei  argument_1, const GLenum * argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glInvalidateSubFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glInvalidateSubFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glInvalidateSubFramebuffer("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glInvalidateSubFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glInvalidateSubFramebuffer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLISBUFFERPROC function_ptr_glIsBuffer;
+int exists_function_glIsBuffer(void);
+PFNGLISBUFFERPROC get_function_ptr_glIsBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsBuffer(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsBuffer( argument_0) fastuidraw::gl_binding::debug_function__glIsBuffer( argument_0, __FILE__, __LINE__, "glIsBuffer("#argument_0")", #argument_0)
+#else
+#define glIsBuffer( argument_0) fastuidraw::gl_binding::function_ptr_glIsBuffer( argument_0)
+#endif
+
+extern PFNGLISENABLEDPROC function_ptr_glIsEnabled;
+int exists_function_glIsEnabled(void);
+PFNGLISENABLEDPROC get_function_ptr_glIsEnabled(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsEnabled(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsEnabled( argument_0) fastuidraw::gl_binding::debug_function__glIsEnabled( argument_0, __FILE__, __LINE__, "glIsEnabled("#argument_0")", #argument_0)
+#else
+#define glIsEnabled( argument_0) fastuidraw::gl_binding::function_ptr_glIsEnabled( argument_0)
+#endif
+
+extern PFNGLISENABLEDIPROC function_ptr_glIsEnabledi;
+int exists_function_glIsEnabledi(void);
+PFNGLISENABLEDIPROC get_function_ptr_glIsEnabledi(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsEnabledi(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glIsEnabledi( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glIsEnabledi( argument_0, argument_1, __FILE__, __LINE__, "glIsEnabledi("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glIsEnabledi( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glIsEnabledi( argument_0, argument_1)
+#endif
+
+extern PFNGLISENABLEDIEXTPROC function_ptr_glIsEnablediEXT;
+int exists_function_glIsEnablediEXT(void);
+PFNGLISENABLEDIEXTPROC get_function_ptr_glIsEnablediEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsEnablediEXT(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glIsEnablediEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glIsEnablediEXT( argument_0, argument_1, __FILE__, __LINE__, "glIsEnablediEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glIsEnablediEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glIsEnablediEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLISENABLEDINVPROC function_ptr_glIsEnablediNV;
+int exists_function_glIsEnablediNV(void);
+PFNGLISENABLEDINVPROC get_function_ptr_glIsEnablediNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsEnablediNV(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glIsEnablediNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glIsEnablediNV( argument_0, argument_1, __FILE__, __LINE__, "glIsEnablediNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glIsEnablediNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glIsEnablediNV( argument_0, argument_1)
+#endif
+
+extern PFNGLISENABLEDIOESPROC function_ptr_glIsEnablediOES;
+int exists_function_glIsEnablediOES(void);
+PFNGLISENABLEDIOESPROC get_function_ptr_glIsEnablediOES(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsEnablediOES(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glIsEnablediOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glIsEnablediOES( argument_0, argument_1, __FILE__, __LINE__, "glIsEnablediOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glIsEnablediOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glIsEnablediOES( argument_0, argument_1)
+#endif
+
+extern PFNGLISFENCENVPROC function_ptr_glIsFenceNV;
+int exists_function_glIsFenceNV(void);
+PFNGLISFENCENVPROC get_function_ptr_glIsFenceNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsFenceNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsFenceNV( argument_0) fastuidraw::gl_binding::debug_function__glIsFenceNV( argument_0, __FILE__, __LINE__, "glIsFenceNV("#argument_0")", #argument_0)
+#else
+#define glIsFenceNV( argument_0) fastuidraw::gl_binding::function_ptr_glIsFenceNV( argument_0)
+#endif
+
+extern PFNGLISFRAMEBUFFERPROC function_ptr_glIsFramebuffer;
+int exists_function_glIsFramebuffer(void);
+PFNGLISFRAMEBUFFERPROC get_function_ptr_glIsFramebuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsFramebuffer(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsFramebuffer( argument_0) fastuidraw::gl_binding::debug_function__glIsFramebuffer( argument_0, __FILE__, __LINE__, "glIsFramebuffer("#argument_0")", #argument_0)
+#else
+#define glIsFramebuffer( argument_0) fastuidraw::gl_binding::function_ptr_glIsFramebuffer( argument_0)
+#endif
+
+extern PFNGLISIMAGEHANDLERESIDENTNVPROC function_ptr_glIsImageHandleResidentNV;
+int exists_function_glIsImageHandleResidentNV(void);
+PFNGLISIMAGEHANDLERESIDENTNVPROC get_function_ptr_glIsImageHandleResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsImageHandleResidentNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsImageHandleResidentNV( argument_0) fastuidraw::gl_binding::debug_function__glIsImageHandleResidentNV( argument_0, __FILE__, __LINE__, "glIsImageHandleResidentNV("#argument_0")", #argument_0)
+#else
+#define glIsImageHandleResidentNV( argument_0) fastuidraw::gl_binding::function_ptr_glIsImageHandleResidentNV( argument_0)
+#endif
+
+extern PFNGLISMEMORYOBJECTEXTPROC function_ptr_glIsMemoryObjectEXT;
+int exists_function_glIsMemoryObjectEXT(void);
+PFNGLISMEMORYOBJECTEXTPROC get_function_ptr_glIsMemoryObjectEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsMemoryObjectEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsMemoryObjectEXT( argument_0) fastuidraw::gl_binding::debug_function__glIsMemoryObjectEXT( argument_0, __FILE__, __LINE__, "glIsMemoryObjectEXT("#argument_0")", #argument_0)
+#else
+#define glIsMemoryObjectEXT( argument_0) fastuidraw::gl_binding::function_ptr_glIsMemoryObjectEXT( argument_0)
+#endif
+
+extern PFNGLISPATHNVPROC function_ptr_glIsPathNV;
+int exists_function_glIsPathNV(void);
+PFNGLISPATHNVPROC get_function_ptr_glIsPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsPathNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsPathNV( argument_0) fastuidraw::gl_binding::debug_function__glIsPathNV( argument_0, __FILE__, __LINE__, "glIsPathNV("#argument_0")", #argument_0)
+#else
+#define glIsPathNV( argument_0) fastuidraw::gl_binding::function_ptr_glIsPathNV( argument_0)
+#endif
+
+extern PFNGLISPOINTINFILLPATHNVPROC function_ptr_glIsPointInFillPathNV;
+int exists_function_glIsPointInFillPathNV(void);
+PFNGLISPOINTINFILLPATHNVPROC get_function_ptr_glIsPointInFillPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsPointInFillPathNV(GLuint  argument_0, GLuint  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glIsPointInFillPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glIsPointInFillPathNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glIsPointInFillPathNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glIsPointInFillPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glIsPointInFillPathNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLISPOINTINSTROKEPATHNVPROC function_ptr_glIsPointInStrokePathNV;
+int exists_function_glIsPointInStrokePathNV(void);
+PFNGLISPOINTINSTROKEPATHNVPROC get_function_ptr_glIsPointInStrokePathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsPointInStrokePathNV(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glIsPointInStrokePathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glIsPointInStrokePathNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glIsPointInStrokePathNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glIsPointInStrokePathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glIsPointInStrokePathNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLISPROGRAMPROC function_ptr_glIsProgram;
+int exists_function_glIsProgram(void);
+PFNGLISPROGRAMPROC get_function_ptr_glIsProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsProgram(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsProgram( argument_0) fastuidraw::gl_binding::debug_function__glIsProgram( argument_0, __FILE__, __LINE__, "glIsProgram("#argument_0")", #argument_0)
+#else
+#define glIsProgram( argument_0) fastuidraw::gl_binding::function_ptr_glIsProgram( argument_0)
+#endif
+
+extern PFNGLISPROGRAMPIPELINEPROC function_ptr_glIsProgramPipeline;
+int exists_function_glIsProgramPipeline(void);
+PFNGLISPROGRAMPIPELINEPROC get_function_ptr_glIsProgramPipeline(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsProgramPipeline(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsProgramPipeline( argument_0) fastuidraw::gl_binding::debug_function__glIsProgramPipeline( argument_0, __FILE__, __LINE__, "glIsProgramPipeline("#argument_0")", #argument_0)
+#else
+#define glIsProgramPipeline( argument_0) fastuidraw::gl_binding::function_ptr_glIsProgramPipeline( argument_0)
+#endif
+
+extern PFNGLISPROGRAMPIPELINEEXTPROC function_ptr_glIsProgramPipelineEXT;
+int exists_function_glIsProgramPipelineEXT(void);
+PFNGLISPROGRAMPIPELINEEXTPROC get_function_ptr_glIsProgramPipelineEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsProgramPipelineEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsProgramPipelineEXT( argument_0) fastuidraw::gl_binding::debug_function__glIsProgramPipelineEXT( argument_0, __FILE__, __LINE__, "glIsProgramPipelineEXT("#argument_0")", #argument_0)
+#else
+#define glIsProgramPipelineEXT( argument_0) fastuidraw::gl_binding::function_ptr_glIsProgramPipelineEXT( argument_0)
+#endif
+
+extern PFNGLISQUERYPROC function_ptr_glIsQuery;
+int exists_function_glIsQuery(void);
+PFNGLISQUERYPROC get_function_ptr_glIsQuery(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsQuery(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsQuery( argument_0) fastuidraw::gl_binding::debug_function__glIsQuery( argument_0, __FILE__, __LINE__, "glIsQuery("#argument_0")", #argument_0)
+#else
+#define glIsQuery( argument_0) fastuidraw::gl_binding::function_ptr_glIsQuery( argument_0)
+#endif
+
+extern PFNGLISQUERYEXTPROC function_ptr_glIsQueryEXT;
+int exists_function_glIsQueryEXT(void);
+PFNGLISQUERYEXTPROC get_function_ptr_glIsQueryEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsQueryEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsQueryEXT( argument_0) fastuidraw::gl_binding::debug_function__glIsQueryEXT( argument_0, __FILE__, __LINE__, "glIsQueryEXT("#argument_0")", #argument_0)
+#else
+#define glIsQueryEXT( argument_0) fastuidraw::gl_binding::function_ptr_glIsQueryEXT( argument_0)
+#endif
+
+extern PFNGLISRENDERBUFFERPROC function_ptr_glIsRenderbuffer;
+int exists_function_glIsRenderbuffer(void);
+PFNGLISRENDERBUFFERPROC get_function_ptr_glIsRenderbuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsRenderbuffer(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsRenderbuffer( argument_0) fastuidraw::gl_binding::debug_function__glIsRenderbuffer( argument_0, __FILE__, __LINE__, "glIsRenderbuffer("#argument_0")", #argument_0)
+#else
+#define glIsRenderbuffer( argument_0) fastuidraw::gl_binding::function_ptr_glIsRenderbuffer( argument_0)
+#endif
+
+extern PFNGLISSAMPLERPROC function_ptr_glIsSampler;
+int exists_function_glIsSampler(void);
+PFNGLISSAMPLERPROC get_function_ptr_glIsSampler(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsSampler(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsSampler( argument_0) fastuidraw::gl_binding::debug_function__glIsSampler( argument_0, __FILE__, __LINE__, "glIsSampler("#argument_0")", #argument_0)
+#else
+#define glIsSampler( argument_0) fastuidraw::gl_binding::function_ptr_glIsSampler( argument_0)
+#endif
+
+extern PFNGLISSEMAPHOREEXTPROC function_ptr_glIsSemaphoreEXT;
+int exists_function_glIsSemaphoreEXT(void);
+PFNGLISSEMAPHOREEXTPROC get_function_ptr_glIsSemaphoreEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsSemaphoreEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsSemaphoreEXT( argument_0) fastuidraw::gl_binding::debug_function__glIsSemaphoreEXT( argument_0, __FILE__, __LINE__, "glIsSemaphoreEXT("#argument_0")", #argument_0)
+#else
+#define glIsSemaphoreEXT( argument_0) fastuidraw::gl_binding::function_ptr_glIsSemaphoreEXT( argument_0)
+#endif
+
+extern PFNGLISSHADERPROC function_ptr_glIsShader;
+int exists_function_glIsShader(void);
+PFNGLISSHADERPROC get_function_ptr_glIsShader(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsShader(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsShader( argument_0) fastuidraw::gl_binding::debug_function__glIsShader( argument_0, __FILE__, __LINE__, "glIsShader("#argument_0")", #argument_0)
+#else
+#define glIsShader( argument_0) fastuidraw::gl_binding::function_ptr_glIsShader( argument_0)
+#endif
+
+extern PFNGLISSYNCPROC function_ptr_glIsSync;
+int exists_function_glIsSync(void);
+PFNGLISSYNCPROC get_function_ptr_glIsSync(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsSync(GLsync  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsSync( argument_0) fastuidraw::gl_binding::debug_function__glIsSync( argument_0, __FILE__, __LINE__, "glIsSync("#argument_0")", #argument_0)
+#else
+#define glIsSync( argument_0) fastuidraw::gl_binding::function_ptr_glIsSync( argument_0)
+#endif
+
+extern PFNGLISSYNCAPPLEPROC function_ptr_glIsSyncAPPLE;
+int exists_function_glIsSyncAPPLE(void);
+PFNGLISSYNCAPPLEPROC get_function_ptr_glIsSyncAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsSyncAPPLE(GLsync  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsSyncAPPLE( argument_0) fastuidraw::gl_binding::debug_function__glIsSyncAPPLE( argument_0, __FILE__, __LINE__, "glIsSyncAPPLE("#argument_0")", #argument_0)
+#else
+#define glIsSyncAPPLE( argument_0) fastuidraw::gl_binding::function_ptr_glIsSyncAPPLE( argument_0)
+#endif
+
+extern PFNGLISTEXTUREPROC function_ptr_glIsTexture;
+int exists_function_glIsTexture(void);
+PFNGLISTEXTUREPROC get_function_ptr_glIsTexture(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsTexture(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsTexture( argument_0) fastuidraw::gl_binding::debug_function__glIsTexture( argument_0, __FILE__, __LINE__, "glIsTexture("#argument_0")", #argument_0)
+#else
+#define glIsTexture( argument_0) fastuidraw::gl_binding::function_ptr_glIsTexture( argument_0)
+#endif
+
+extern PFNGLISTEXTUREHANDLERESIDENTNVPROC function_ptr_glIsTextureHandleResidentNV;
+int exists_function_glIsTextureHandleResidentNV(void);
+PFNGLISTEXTUREHANDLERESIDENTNVPROC get_function_ptr_glIsTextureHandleResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsTextureHandleResidentNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsTextureHandleResidentNV( argument_0) fastuidraw::gl_binding::debug_function__glIsTextureHandleResidentNV( argument_0, __FILE__, __LINE__, "glIsTextureHandleResidentNV("#argument_0")", #argument_0)
+#else
+#define glIsTextureHandleResidentNV( argument_0) fastuidraw::gl_binding::function_ptr_glIsTextureHandleResidentNV( argument_0)
+#endif
+
+extern PFNGLISTRANSFORMFEEDBACKPROC function_ptr_glIsTransformFeedback;
+int exists_function_glIsTransformFeedback(void);
+PFNGLISTRANSFORMFEEDBACKPROC get_function_ptr_glIsTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsTransformFeedback(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsTransformFeedback( argument_0) fastuidraw::gl_binding::debug_function__glIsTransformFeedback( argument_0, __FILE__, __LINE__, "glIsTransformFeedback("#argument_0")", #argument_0)
+#else
+#define glIsTransformFeedback( argument_0) fastuidraw::gl_binding::function_ptr_glIsTransformFeedback( argument_0)
+#endif
+
+extern PFNGLISVERTEXARRAYPROC function_ptr_glIsVertexArray;
+int exists_function_glIsVertexArray(void);
+PFNGLISVERTEXARRAYPROC get_function_ptr_glIsVertexArray(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsVertexArray(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsVertexArray( argument_0) fastuidraw::gl_binding::debug_function__glIsVertexArray( argument_0, __FILE__, __LINE__, "glIsVertexArray("#argument_0")", #argument_0)
+#else
+#define glIsVertexArray( argument_0) fastuidraw::gl_binding::function_ptr_glIsVertexArray( argument_0)
+#endif
+
+extern PFNGLISVERTEXARRAYOESPROC function_ptr_glIsVertexArrayOES;
+int exists_function_glIsVertexArrayOES(void);
+PFNGLISVERTEXARRAYOESPROC get_function_ptr_glIsVertexArrayOES(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glIsVertexArrayOES(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glIsVertexArrayOES( argument_0) fastuidraw::gl_binding::debug_function__glIsVertexArrayOES( argument_0, __FILE__, __LINE__, "glIsVertexArrayOES("#argument_0")", #argument_0)
+#else
+#define glIsVertexArrayOES( argument_0) fastuidraw::gl_binding::function_ptr_glIsVertexArrayOES( argument_0)
+#endif
+
+extern PFNGLLABELOBJECTEXTPROC function_ptr_glLabelObjectEXT;
+int exists_function_glLabelObjectEXT(void);
+PFNGLLABELOBJECTEXTPROC get_function_ptr_glLabelObjectEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glLabelObjectEXT(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glLabelObjectEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glLabelObjectEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glLabelObjectEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glLabelObjectEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glLabelObjectEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLLINEWIDTHPROC function_ptr_glLineWidth;
+int exists_function_glLineWidth(void);
+PFNGLLINEWIDTHPROC get_function_ptr_glLineWidth(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glLineWidth(GLfloat  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glLineWidth( argument_0) fastuidraw::gl_binding::debug_function__glLineWidth( argument_0, __FILE__, __LINE__, "glLineWidth("#argument_0")", #argument_0)
+#else
+#define glLineWidth( argument_0) fastuidraw::gl_binding::function_ptr_glLineWidth( argument_0)
+#endif
+
+extern PFNGLLINKPROGRAMPROC function_ptr_glLinkProgram;
+int exists_function_glLinkProgram(void);
+PFNGLLINKPROGRAMPROC get_function_ptr_glLinkProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glLinkProgram(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glLinkProgram( argument_0) fastuidraw::gl_binding::debug_function__glLinkProgram( argument_0, __FILE__, __LINE__, "glLinkProgram("#argument_0")", #argument_0)
+#else
+#define glLinkProgram( argument_0) fastuidraw::gl_binding::function_ptr_glLinkProgram( argument_0)
+#endif
+
+extern PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC function_ptr_glMakeImageHandleNonResidentNV;
+int exists_function_glMakeImageHandleNonResidentNV(void);
+PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC get_function_ptr_glMakeImageHandleNonResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMakeImageHandleNonResidentNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMakeImageHandleNonResidentNV( argument_0) fastuidraw::gl_binding::debug_function__glMakeImageHandleNonResidentNV( argument_0, __FILE__, __LINE__, "glMakeImageHandleNonResidentNV("#argument_0")", #argument_0)
+#else
+#define glMakeImageHandleNonResidentNV( argument_0) fastuidraw::gl_binding::function_ptr_glMakeImageHandleNonResidentNV( argument_0)
+#endif
+
+extern PFNGLMAKEIMAGEHANDLERESIDENTNVPROC function_ptr_glMakeImageHandleResidentNV;
+int exists_function_glMakeImageHandleResidentNV(void);
+PFNGLMAKEIMAGEHANDLERESIDENTNVPROC get_function_ptr_glMakeImageHandleResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMakeImageHandleResidentNV(GLuint64  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMakeImageHandleResidentNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMakeImageHandleResidentNV( argument_0, argument_1, __FILE__, __LINE__, "glMakeImageHandleResidentNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMakeImageHandleResidentNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMakeImageHandleResidentNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC function_ptr_glMakeTextureHandleNonResidentNV;
+int exists_function_glMakeTextureHandleNonResidentNV(void);
+PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC get_function_ptr_glMakeTextureHandleNonResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMakeTextureHandleNonResidentNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMakeTextureHandleNonResidentNV( argument_0) fastuidraw::gl_binding::debug_function__glMakeTextureHandleNonResidentNV( argument_0, __FILE__, __LINE__, "glMakeTextureHandleNonResidentNV("#argument_0")", #argument_0)
+#else
+#define glMakeTextureHandleNonResidentNV( argument_0) fastuidraw::gl_binding::function_ptr_glMakeTextureHandleNonResidentNV( argument_0)
+#endif
+
+extern PFNGLMAKETEXTUREHANDLERESIDENTNVPROC function_ptr_glMakeTextureHandleResidentNV;
+int exists_function_glMakeTextureHandleResidentNV(void);
+PFNGLMAKETEXTUREHANDLERESIDENTNVPROC get_function_ptr_glMakeTextureHandleResidentNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMakeTextureHandleResidentNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMakeTextureHandleResidentNV( argument_0) fastuidraw::gl_binding::debug_function__glMakeTextureHandleResidentNV( argument_0, __FILE__, __LINE__, "glMakeTextureHandleResidentNV("#argument_0")", #argument_0)
+#else
+#define glMakeTextureHandleResidentNV( argument_0) fastuidraw::gl_binding::function_ptr_glMakeTextureHandleResidentNV( argument_0)
+#endif
+
+extern PFNGLMAPBUFFEROESPROC function_ptr_glMapBufferOES;
+int exists_function_glMapBufferOES(void);
+PFNGLMAPBUFFEROESPROC get_function_ptr_glMapBufferOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void * debug_function__glMapBufferOES(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMapBufferOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMapBufferOES( argument_0, argument_1, __FILE__, __LINE__, "glMapBufferOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMapBufferOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMapBufferOES( argument_0, argument_1)
+#endif
+
+extern PFNGLMAPBUFFERRANGEPROC function_ptr_glMapBufferRange;
+int exists_function_glMapBufferRange(void);
+PFNGLMAPBUFFERRANGEPROC get_function_ptr_glMapBufferRange(void);
+#ifdef FASTUIDRAW_DEBUG
+void * debug_function__glMapBufferRange(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLbitfield  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMapBufferRange( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMapBufferRange( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMapBufferRange("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMapBufferRange( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMapBufferRange( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMAPBUFFERRANGEEXTPROC function_ptr_glMapBufferRangeEXT;
+int exists_function_glMapBufferRangeEXT(void);
+PFNGLMAPBUFFERRANGEEXTPROC get_function_ptr_glMapBufferRangeEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void * debug_function__glMapBufferRangeEXT(GLenum  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLbitfield  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMapBufferRangeEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMapBufferRangeEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMapBufferRangeEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMapBufferRangeEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMapBufferRangeEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMATRIXFRUSTUMEXTPROC function_ptr_glMatrixFrustumEXT;
+int exists_function_glMatrixFrustumEXT(void);
+PFNGLMATRIXFRUSTUMEXTPROC get_function_ptr_glMatrixFrustumEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixFrustumEXT(GLenum  argument_0, GLdouble  argument_1, GLdouble  argument_2, GLdouble  argument_3, GLdouble  argument_4, GLdouble  argument_5, GLdouble  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glMatrixFrustumEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glMatrixFrustumEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glMatrixFrustumEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glMatrixFrustumEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glMatrixFrustumEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLMATRIXLOAD3X2FNVPROC function_ptr_glMatrixLoad3x2fNV;
+int exists_function_glMatrixLoad3x2fNV(void);
+PFNGLMATRIXLOAD3X2FNVPROC get_function_ptr_glMatrixLoad3x2fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoad3x2fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoad3x2fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoad3x2fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoad3x2fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoad3x2fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoad3x2fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOAD3X3FNVPROC function_ptr_glMatrixLoad3x3fNV;
+int exists_function_glMatrixLoad3x3fNV(void);
+PFNGLMATRIXLOAD3X3FNVPROC get_function_ptr_glMatrixLoad3x3fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoad3x3fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoad3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoad3x3fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoad3x3fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoad3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoad3x3fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOADIDENTITYEXTPROC function_ptr_glMatrixLoadIdentityEXT;
+int exists_function_glMatrixLoadIdentityEXT(void);
+PFNGLMATRIXLOADIDENTITYEXTPROC get_function_ptr_glMatrixLoadIdentityEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoadIdentityEXT(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMatrixLoadIdentityEXT( argument_0) fastuidraw::gl_binding::debug_function__glMatrixLoadIdentityEXT( argument_0, __FILE__, __LINE__, "glMatrixLoadIdentityEXT("#argument_0")", #argument_0)
+#else
+#define glMatrixLoadIdentityEXT( argument_0) fastuidraw::gl_binding::function_ptr_glMatrixLoadIdentityEXT( argument_0)
+#endif
+
+extern PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC function_ptr_glMatrixLoadTranspose3x3fNV;
+int exists_function_glMatrixLoadTranspose3x3fNV(void);
+PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC get_function_ptr_glMatrixLoadTranspose3x3fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoadTranspose3x3fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoadTranspose3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoadTranspose3x3fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoadTranspose3x3fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoadTranspose3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoadTranspose3x3fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOADTRANSPOSEDEXTPROC function_ptr_glMatrixLoadTransposedEXT;
+int exists_function_glMatrixLoadTransposedEXT(void);
+PFNGLMATRIXLOADTRANSPOSEDEXTPROC get_function_ptr_glMatrixLoadTransposedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoadTransposedEXT(GLenum  argument_0, const GLdouble * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoadTransposedEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoadTransposedEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoadTransposedEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoadTransposedEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoadTransposedEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOADTRANSPOSEFEXTPROC function_ptr_glMatrixLoadTransposefEXT;
+int exists_function_glMatrixLoadTransposefEXT(void);
+PFNGLMATRIXLOADTRANSPOSEFEXTPROC get_function_ptr_glMatrixLoadTransposefEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoadTransposefEXT(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoadTransposefEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoadTransposefEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoadTransposefEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoadTransposefEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoadTransposefEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOADDEXTPROC function_ptr_glMatrixLoaddEXT;
+int exists_function_glMatrixLoaddEXT(void);
+PFNGLMATRIXLOADDEXTPROC get_function_ptr_glMatrixLoaddEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoaddEXT(GLenum  argument_0, const GLdouble * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoaddEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoaddEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoaddEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoaddEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoaddEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXLOADFEXTPROC function_ptr_glMatrixLoadfEXT;
+int exists_function_glMatrixLoadfEXT(void);
+PFNGLMATRIXLOADFEXTPROC get_function_ptr_glMatrixLoadfEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixLoadfEXT(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixLoadfEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixLoadfEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixLoadfEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixLoadfEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixLoadfEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULT3X2FNVPROC function_ptr_glMatrixMult3x2fNV;
+int exists_function_glMatrixMult3x2fNV(void);
+PFNGLMATRIXMULT3X2FNVPROC get_function_ptr_glMatrixMult3x2fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMult3x2fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMult3x2fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMult3x2fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMult3x2fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMult3x2fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMult3x2fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULT3X3FNVPROC function_ptr_glMatrixMult3x3fNV;
+int exists_function_glMatrixMult3x3fNV(void);
+PFNGLMATRIXMULT3X3FNVPROC get_function_ptr_glMatrixMult3x3fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMult3x3fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMult3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMult3x3fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMult3x3fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMult3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMult3x3fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC function_ptr_glMatrixMultTranspose3x3fNV;
+int exists_function_glMatrixMultTranspose3x3fNV(void);
+PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC get_function_ptr_glMatrixMultTranspose3x3fNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMultTranspose3x3fNV(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMultTranspose3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMultTranspose3x3fNV( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMultTranspose3x3fNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMultTranspose3x3fNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMultTranspose3x3fNV( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULTTRANSPOSEDEXTPROC function_ptr_glMatrixMultTransposedEXT;
+int exists_function_glMatrixMultTransposedEXT(void);
+PFNGLMATRIXMULTTRANSPOSEDEXTPROC get_function_ptr_glMatrixMultTransposedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMultTransposedEXT(GLenum  argument_0, const GLdouble * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMultTransposedEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMultTransposedEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMultTransposedEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMultTransposedEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMultTransposedEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULTTRANSPOSEFEXTPROC function_ptr_glMatrixMultTransposefEXT;
+int exists_function_glMatrixMultTransposefEXT(void);
+PFNGLMATRIXMULTTRANSPOSEFEXTPROC get_function_ptr_glMatrixMultTransposefEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMultTransposefEXT(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMultTransposefEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMultTransposefEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMultTransposefEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMultTransposefEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMultTransposefEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULTDEXTPROC function_ptr_glMatrixMultdEXT;
+int exists_function_glMatrixMultdEXT(void);
+PFNGLMATRIXMULTDEXTPROC get_function_ptr_glMatrixMultdEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMultdEXT(GLenum  argument_0, const GLdouble * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMultdEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMultdEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMultdEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMultdEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMultdEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXMULTFEXTPROC function_ptr_glMatrixMultfEXT;
+int exists_function_glMatrixMultfEXT(void);
+PFNGLMATRIXMULTFEXTPROC get_function_ptr_glMatrixMultfEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixMultfEXT(GLenum  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glMatrixMultfEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glMatrixMultfEXT( argument_0, argument_1, __FILE__, __LINE__, "glMatrixMultfEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glMatrixMultfEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glMatrixMultfEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLMATRIXORTHOEXTPROC function_ptr_glMatrixOrthoEXT;
+int exists_function_glMatrixOrthoEXT(void);
+PFNGLMATRIXORTHOEXTPROC get_function_ptr_glMatrixOrthoEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixOrthoEXT(GLenum  argument_0, GLdouble  argument_1, GLdouble  argument_2, GLdouble  argument_3, GLdouble  argument_4, GLdouble  argument_5, GLdouble  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glMatrixOrthoEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glMatrixOrthoEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glMatrixOrthoEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glMatrixOrthoEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glMatrixOrthoEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLMATRIXPOPEXTPROC function_ptr_glMatrixPopEXT;
+int exists_function_glMatrixPopEXT(void);
+PFNGLMATRIXPOPEXTPROC get_function_ptr_glMatrixPopEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixPopEXT(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMatrixPopEXT( argument_0) fastuidraw::gl_binding::debug_function__glMatrixPopEXT( argument_0, __FILE__, __LINE__, "glMatrixPopEXT("#argument_0")", #argument_0)
+#else
+#define glMatrixPopEXT( argument_0) fastuidraw::gl_binding::function_ptr_glMatrixPopEXT( argument_0)
+#endif
+
+extern PFNGLMATRIXPUSHEXTPROC function_ptr_glMatrixPushEXT;
+int exists_function_glMatrixPushEXT(void);
+PFNGLMATRIXPUSHEXTPROC get_function_ptr_glMatrixPushEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixPushEXT(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMatrixPushEXT( argument_0) fastuidraw::gl_binding::debug_function__glMatrixPushEXT( argument_0, __FILE__, __LINE__, "glMatrixPushEXT("#argument_0")", #argument_0)
+#else
+#define glMatrixPushEXT( argument_0) fastuidraw::gl_binding::function_ptr_glMatrixPushEXT( argument_0)
+#endif
+
+extern PFNGLMATRIXROTATEDEXTPROC function_ptr_glMatrixRotatedEXT;
+int exists_function_glMatrixRotatedEXT(void);
+PFNGLMATRIXROTATEDEXTPROC get_function_ptr_glMatrixRotatedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixRotatedEXT(GLenum  argument_0, GLdouble  argument_1, GLdouble  argument_2, GLdouble  argument_3, GLdouble  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glMatrixRotatedEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glMatrixRotatedEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glMatrixRotatedEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glMatrixRotatedEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glMatrixRotatedEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLMATRIXROTATEFEXTPROC function_ptr_glMatrixRotatefEXT;
+int exists_function_glMatrixRotatefEXT(void);
+PFNGLMATRIXROTATEFEXTPROC get_function_ptr_glMatrixRotatefEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixRotatefEXT(GLenum  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glMatrixRotatefEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glMatrixRotatefEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glMatrixRotatefEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glMatrixRotatefEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glMatrixRotatefEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLMATRIXSCALEDEXTPROC function_ptr_glMatrixScaledEXT;
+int exists_function_glMatrixScaledEXT(void);
+PFNGLMATRIXSCALEDEXTPROC get_function_ptr_glMatrixScaledEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixScaledEXT(GLenum  argument_0, GLdouble  argument_1, GLdouble  argument_2, GLdouble  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMatrixScaledEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMatrixScaledEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMatrixScaledEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMatrixScaledEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMatrixScaledEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMATRIXSCALEFEXTPROC function_ptr_glMatrixScalefEXT;
+int exists_function_glMatrixScalefEXT(void);
+PFNGLMATRIXSCALEFEXTPROC get_function_ptr_glMatrixScalefEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixScalefEXT(GLenum  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMatrixScalefEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMatrixScalefEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMatrixScalefEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMatrixScalefEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMatrixScalefEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMATRIXTRANSLATEDEXTPROC function_ptr_glMatrixTranslatedEXT;
+int exists_function_glMatrixTranslatedEXT(void);
+PFNGLMATRIXTRANSLATEDEXTPROC get_function_ptr_glMatrixTranslatedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixTranslatedEXT(GLenum  argument_0, GLdouble  argument_1, GLdouble  argument_2, GLdouble  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMatrixTranslatedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMatrixTranslatedEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMatrixTranslatedEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMatrixTranslatedEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMatrixTranslatedEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMATRIXTRANSLATEFEXTPROC function_ptr_glMatrixTranslatefEXT;
+int exists_function_glMatrixTranslatefEXT(void);
+PFNGLMATRIXTRANSLATEFEXTPROC get_function_ptr_glMatrixTranslatefEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMatrixTranslatefEXT(GLenum  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMatrixTranslatefEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMatrixTranslatefEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMatrixTranslatefEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMatrixTranslatefEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMatrixTranslatefEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC function_ptr_glMaxShaderCompilerThreadsKHR;
+int exists_function_glMaxShaderCompilerThreadsKHR(void);
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC get_function_ptr_glMaxShaderCompilerThreadsKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMaxShaderCompilerThreadsKHR(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMaxShaderCompilerThreadsKHR( argument_0) fastuidraw::gl_binding::debug_function__glMaxShaderCompilerThreadsKHR( argument_0, __FILE__, __LINE__, "glMaxShaderCompilerThreadsKHR("#argument_0")", #argument_0)
+#else
+#define glMaxShaderCompilerThreadsKHR( argument_0) fastuidraw::gl_binding::function_ptr_glMaxShaderCompilerThreadsKHR( argument_0)
+#endif
+
+extern PFNGLMEMORYBARRIERPROC function_ptr_glMemoryBarrier;
+int exists_function_glMemoryBarrier(void);
+PFNGLMEMORYBARRIERPROC get_function_ptr_glMemoryBarrier(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMemoryBarrier(GLbitfield  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMemoryBarrier( argument_0) fastuidraw::gl_binding::debug_function__glMemoryBarrier( argument_0, __FILE__, __LINE__, "glMemoryBarrier("#argument_0")", #argument_0)
+#else
+#define glMemoryBarrier( argument_0) fastuidraw::gl_binding::function_ptr_glMemoryBarrier( argument_0)
+#endif
+
+extern PFNGLMEMORYBARRIERBYREGIONPROC function_ptr_glMemoryBarrierByRegion;
+int exists_function_glMemoryBarrierByRegion(void);
+PFNGLMEMORYBARRIERBYREGIONPROC get_function_ptr_glMemoryBarrierByRegion(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMemoryBarrierByRegion(GLbitfield  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMemoryBarrierByRegion( argument_0) fastuidraw::gl_binding::debug_function__glMemoryBarrierByRegion( argument_0, __FILE__, __LINE__, "glMemoryBarrierByRegion("#argument_0")", #argument_0)
+#else
+#define glMemoryBarrierByRegion( argument_0) fastuidraw::gl_binding::function_ptr_glMemoryBarrierByRegion( argument_0)
+#endif
+
+extern PFNGLMEMORYOBJECTPARAMETERIVEXTPROC function_ptr_glMemoryObjectParameterivEXT;
+int exists_function_glMemoryObjectParameterivEXT(void);
+PFNGLMEMORYOBJECTPARAMETERIVEXTPROC get_function_ptr_glMemoryObjectParameterivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMemoryObjectParameterivEXT(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glMemoryObjectParameterivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glMemoryObjectParameterivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glMemoryObjectParameterivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glMemoryObjectParameterivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glMemoryObjectParameterivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLMINSAMPLESHADINGPROC function_ptr_glMinSampleShading;
+int exists_function_glMinSampleShading(void);
+PFNGLMINSAMPLESHADINGPROC get_function_ptr_glMinSampleShading(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMinSampleShading(GLfloat  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMinSampleShading( argument_0) fastuidraw::gl_binding::debug_function__glMinSampleShading( argument_0, __FILE__, __LINE__, "glMinSampleShading("#argument_0")", #argument_0)
+#else
+#define glMinSampleShading( argument_0) fastuidraw::gl_binding::function_ptr_glMinSampleShading( argument_0)
+#endif
+
+extern PFNGLMINSAMPLESHADINGOESPROC function_ptr_glMinSampleShadingOES;
+int exists_function_glMinSampleShadingOES(void);
+PFNGLMINSAMPLESHADINGOESPROC get_function_ptr_glMinSampleShadingOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMinSampleShadingOES(GLfloat  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glMinSampleShadingOES( argument_0) fastuidraw::gl_binding::debug_function__glMinSampleShadingOES( argument_0, __FILE__, __LINE__, "glMinSampleShadingOES("#argument_0")", #argument_0)
+#else
+#define glMinSampleShadingOES( argument_0) fastuidraw::gl_binding::function_ptr_glMinSampleShadingOES( argument_0)
+#endif
+
+extern PFNGLMULTIDRAWARRAYSEXTPROC function_ptr_glMultiDrawArraysEXT;
+int exists_function_glMultiDrawArraysEXT(void);
+PFNGLMULTIDRAWARRAYSEXTPROC get_function_ptr_glMultiDrawArraysEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawArraysEXT(GLenum  argument_0, const GLint * argument_1, const GLsizei * argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMultiDrawArraysEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMultiDrawArraysEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMultiDrawArraysEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMultiDrawArraysEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMultiDrawArraysEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC function_ptr_glMultiDrawArraysIndirectEXT;
+int exists_function_glMultiDrawArraysIndirectEXT(void);
+PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC get_function_ptr_glMultiDrawArraysIndirectEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawArraysIndirectEXT(GLenum  argument_0, const void * argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMultiDrawArraysIndirectEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMultiDrawArraysIndirectEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMultiDrawArraysIndirectEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMultiDrawArraysIndirectEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMultiDrawArraysIndirectEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMULTIDRAWELEMENTSBASEVERTEXEXTPROC function_ptr_glMultiDrawElementsBaseVertexEXT;
+int exists_function_glMultiDrawElementsBaseVertexEXT(void);
+PFNGLMULTIDRAWELEMENTSBASEVERTEXEXTPROC get_function_ptr_glMultiDrawElementsBaseVertexEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawElementsBaseVertexEXT(GLenum  argument_0, const GLsizei * argument_1, GLenum  argument_2, const void *const* argument_3, GLsizei  argument_4, const GLint * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glMultiDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glMultiDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glMultiDrawElementsBaseVertexEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glMultiDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glMultiDrawElementsBaseVertexEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLMULTIDRAWELEMENTSEXTPROC function_ptr_glMultiDrawElementsEXT;
+int exists_function_glMultiDrawElementsEXT(void);
+PFNGLMULTIDRAWELEMENTSEXTPROC get_function_ptr_glMultiDrawElementsEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawElementsEXT(GLenum  argument_0, const GLsizei * argument_1, GLenum  argument_2, const void *const* argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glMultiDrawElementsEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glMultiDrawElementsEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glMultiDrawElementsEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glMultiDrawElementsEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glMultiDrawElementsEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC function_ptr_glMultiDrawElementsIndirectEXT;
+int exists_function_glMultiDrawElementsIndirectEXT(void);
+PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC get_function_ptr_glMultiDrawElementsIndirectEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawElementsIndirectEXT(GLenum  argument_0, GLenum  argument_1, const void * argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glMultiDrawElementsIndirectEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glMultiDrawElementsIndirectEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glMultiDrawElementsIndirectEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glMultiDrawElementsIndirectEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glMultiDrawElementsIndirectEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC function_ptr_glMultiDrawMeshTasksIndirectCountNV;
+int exists_function_glMultiDrawMeshTasksIndirectCountNV(void);
+PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC get_function_ptr_glMultiDrawMeshTasksIndirectCountNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawMeshTasksIndirectCountNV(GLintptr  argument_0, GLintptr  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glMultiDrawMeshTasksIndirectCountNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glMultiDrawMeshTasksIndirectCountNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glMultiDrawMeshTasksIndirectCountNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glMultiDrawMeshTasksIndirectCountNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glMultiDrawMeshTasksIndirectCountNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC function_ptr_glMultiDrawMeshTasksIndirectNV;
+int exists_function_glMultiDrawMeshTasksIndirectNV(void);
+PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC get_function_ptr_glMultiDrawMeshTasksIndirectNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glMultiDrawMeshTasksIndirectNV(GLintptr  argument_0, GLsizei  argument_1, GLsizei  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glMultiDrawMeshTasksIndirectNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glMultiDrawMeshTasksIndirectNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glMultiDrawMeshTasksIndirectNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glMultiDrawMeshTasksIndirectNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glMultiDrawMeshTasksIndirectNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLNAMEDBUFFERATTACHMEMORYNVPROC function_ptr_glNamedBufferAttachMemoryNV;
+int exists_function_glNamedBufferAttachMemoryNV(void);
+PFNGLNAMEDBUFFERATTACHMEMORYNVPROC get_function_ptr_glNamedBufferAttachMemoryNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedBufferAttachMemoryNV(GLuint  argument_0, GLuint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glNamedBufferAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glNamedBufferAttachMemoryNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glNamedBufferAttachMemoryNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glNamedBufferAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glNamedBufferAttachMemoryNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLNAMEDBUFFERPAGECOMMITMENTMEMNVPROC function_ptr_glNamedBufferPageCommitmentMemNV;
+int exists_function_glNamedBufferPageCommitmentMemNV(void);
+PFNGLNAMEDBUFFERPAGECOMMITMENTMEMNVPROC get_function_ptr_glNamedBufferPageCommitmentMemNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedBufferPageCommitmentMemNV(GLuint  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLuint  argument_3, GLuint64  argument_4, GLboolean  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glNamedBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glNamedBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glNamedBufferPageCommitmentMemNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glNamedBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glNamedBufferPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC function_ptr_glNamedBufferStorageExternalEXT;
+int exists_function_glNamedBufferStorageExternalEXT(void);
+PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC get_function_ptr_glNamedBufferStorageExternalEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedBufferStorageExternalEXT(GLuint  argument_0, GLintptr  argument_1, GLsizeiptr  argument_2, GLeglClientBufferEXT  argument_3, GLbitfield  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glNamedBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glNamedBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glNamedBufferStorageExternalEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glNamedBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glNamedBufferStorageExternalEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC function_ptr_glNamedBufferStorageMemEXT;
+int exists_function_glNamedBufferStorageMemEXT(void);
+PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC get_function_ptr_glNamedBufferStorageMemEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedBufferStorageMemEXT(GLuint  argument_0, GLsizeiptr  argument_1, GLuint  argument_2, GLuint64  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glNamedBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glNamedBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glNamedBufferStorageMemEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glNamedBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glNamedBufferStorageMemEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC function_ptr_glNamedFramebufferSampleLocationsfvNV;
+int exists_function_glNamedFramebufferSampleLocationsfvNV(void);
+PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC get_function_ptr_glNamedFramebufferSampleLocationsfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedFramebufferSampleLocationsfvNV(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glNamedFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glNamedFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glNamedFramebufferSampleLocationsfvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glNamedFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glNamedFramebufferSampleLocationsfvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC function_ptr_glNamedRenderbufferStorageMultisampleAdvancedAMD;
+int exists_function_glNamedRenderbufferStorageMultisampleAdvancedAMD(void);
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC get_function_ptr_glNamedRenderbufferStorageMultisampleAdvancedAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glNamedRenderbufferStorageMultisampleAdvancedAMD(GLuint  argument_0, GLsizei  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glNamedRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glNamedRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glNamedRenderbufferStorageMultisampleAdvancedAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glNamedRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glNamedRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLOBJECTLABELPROC function_ptr_glObjectLabel;
+int exists_function_glObjectLabel(void);
+PFNGLOBJECTLABELPROC get_function_ptr_glObjectLabel(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glObjectLabel(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glObjectLabel( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glObjectLabel( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glObjectLabel("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glObjectLabel( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glObjectLabel( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLOBJECTLABELKHRPROC function_ptr_glObjectLabelKHR;
+int exists_function_glObjectLabelKHR(void);
+PFNGLOBJECTLABELKHRPROC get_function_ptr_glObjectLabelKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glObjectLabelKHR(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glObjectLabelKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glObjectLabelKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glObjectLabelKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glObjectLabelKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glObjectLabelKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLOBJECTPTRLABELPROC function_ptr_glObjectPtrLabel;
+int exists_function_glObjectPtrLabel(void);
+PFNGLOBJECTPTRLABELPROC get_function_ptr_glObjectPtrLabel(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glObjectPtrLabel(const void * argument_0, GLsizei  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glObjectPtrLabel( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glObjectPtrLabel( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glObjectPtrLabel("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glObjectPtrLabel( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glObjectPtrLabel( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLOBJECTPTRLABELKHRPROC function_ptr_glObjectPtrLabelKHR;
+int exists_function_glObjectPtrLabelKHR(void);
+PFNGLOBJECTPTRLABELKHRPROC get_function_ptr_glObjectPtrLabelKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glObjectPtrLabelKHR(const void * argument_0, GLsizei  argument_1, const GLchar * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glObjectPtrLabelKHR( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glObjectPtrLabelKHR( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glObjectPtrLabelKHR("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glObjectPtrLabelKHR( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glObjectPtrLabelKHR( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATCHPARAMETERIPROC function_ptr_glPatchParameteri;
+int exists_function_glPatchParameteri(void);
+PFNGLPATCHPARAMETERIPROC get_function_ptr_glPatchParameteri(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPatchParameteri(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPatchParameteri( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPatchParameteri( argument_0, argument_1, __FILE__, __LINE__, "glPatchParameteri("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPatchParameteri( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPatchParameteri( argument_0, argument_1)
+#endif
+
+extern PFNGLPATCHPARAMETERIEXTPROC function_ptr_glPatchParameteriEXT;
+int exists_function_glPatchParameteriEXT(void);
+PFNGLPATCHPARAMETERIEXTPROC get_function_ptr_glPatchParameteriEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPatchParameteriEXT(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPatchParameteriEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPatchParameteriEXT( argument_0, argument_1, __FILE__, __LINE__, "glPatchParameteriEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPatchParameteriEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPatchParameteriEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLPATCHPARAMETERIOESPROC function_ptr_glPatchParameteriOES;
+int exists_function_glPatchParameteriOES(void);
+PFNGLPATCHPARAMETERIOESPROC get_function_ptr_glPatchParameteriOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPatchParameteriOES(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPatchParameteriOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPatchParameteriOES( argument_0, argument_1, __FILE__, __LINE__, "glPatchParameteriOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPatchParameteriOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPatchParameteriOES( argument_0, argument_1)
+#endif
+
+extern PFNGLPATHCOMMANDSNVPROC function_ptr_glPathCommandsNV;
+int exists_function_glPathCommandsNV(void);
+PFNGLPATHCOMMANDSNVPROC get_function_ptr_glPathCommandsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathCommandsNV(GLuint  argument_0, GLsizei  argument_1, const GLubyte * argument_2, GLsizei  argument_3, GLenum  argument_4, const void * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glPathCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glPathCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glPathCommandsNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glPathCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glPathCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPATHCOORDSNVPROC function_ptr_glPathCoordsNV;
+int exists_function_glPathCoordsNV(void);
+PFNGLPATHCOORDSNVPROC get_function_ptr_glPathCoordsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathCoordsNV(GLuint  argument_0, GLsizei  argument_1, GLenum  argument_2, const void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glPathCoordsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glPathCoordsNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glPathCoordsNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glPathCoordsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glPathCoordsNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPATHCOVERDEPTHFUNCNVPROC function_ptr_glPathCoverDepthFuncNV;
+int exists_function_glPathCoverDepthFuncNV(void);
+PFNGLPATHCOVERDEPTHFUNCNVPROC get_function_ptr_glPathCoverDepthFuncNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathCoverDepthFuncNV(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glPathCoverDepthFuncNV( argument_0) fastuidraw::gl_binding::debug_function__glPathCoverDepthFuncNV( argument_0, __FILE__, __LINE__, "glPathCoverDepthFuncNV("#argument_0")", #argument_0)
+#else
+#define glPathCoverDepthFuncNV( argument_0) fastuidraw::gl_binding::function_ptr_glPathCoverDepthFuncNV( argument_0)
+#endif
+
+extern PFNGLPATHDASHARRAYNVPROC function_ptr_glPathDashArrayNV;
+int exists_function_glPathDashArrayNV(void);
+PFNGLPATHDASHARRAYNVPROC get_function_ptr_glPathDashArrayNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathDashArrayNV(GLuint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathDashArrayNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathDashArrayNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathDashArrayNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathDashArrayNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathDashArrayNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHGLYPHINDEXARRAYNVPROC function_ptr_glPathGlyphIndexArrayNV;
+int exists_function_glPathGlyphIndexArrayNV(void);
+PFNGLPATHGLYPHINDEXARRAYNVPROC get_function_ptr_glPathGlyphIndexArrayNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glPathGlyphIndexArrayNV(GLuint  argument_0, GLenum  argument_1, const void * argument_2, GLbitfield  argument_3, GLuint  argument_4, GLsizei  argument_5, GLuint  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPathGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPathGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPathGlyphIndexArrayNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPathGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPathGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPATHGLYPHINDEXRANGENVPROC function_ptr_glPathGlyphIndexRangeNV;
+int exists_function_glPathGlyphIndexRangeNV(void);
+PFNGLPATHGLYPHINDEXRANGENVPROC get_function_ptr_glPathGlyphIndexRangeNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glPathGlyphIndexRangeNV(GLenum  argument_0, const void * argument_1, GLbitfield  argument_2, GLuint  argument_3, GLfloat  argument_4, GLuint * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glPathGlyphIndexRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glPathGlyphIndexRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glPathGlyphIndexRangeNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glPathGlyphIndexRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glPathGlyphIndexRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPATHGLYPHRANGENVPROC function_ptr_glPathGlyphRangeNV;
+int exists_function_glPathGlyphRangeNV(void);
+PFNGLPATHGLYPHRANGENVPROC get_function_ptr_glPathGlyphRangeNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathGlyphRangeNV(GLuint  argument_0, GLenum  argument_1, const void * argument_2, GLbitfield  argument_3, GLuint  argument_4, GLsizei  argument_5, GLenum  argument_6, GLuint  argument_7, GLfloat  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glPathGlyphRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glPathGlyphRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glPathGlyphRangeNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glPathGlyphRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glPathGlyphRangeNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLPATHGLYPHSNVPROC function_ptr_glPathGlyphsNV;
+int exists_function_glPathGlyphsNV(void);
+PFNGLPATHGLYPHSNVPROC get_function_ptr_glPathGlyphsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathGlyphsNV(GLuint  argument_0, GLenum  argument_1, const void * argument_2, GLbitfield  argument_3, GLsizei  argument_4, GLenum  argument_5, const void * argument_6, GLenum  argument_7, GLuint  argument_8, GLfloat  argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glPathGlyphsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glPathGlyphsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glPathGlyphsNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glPathGlyphsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glPathGlyphsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC function_ptr_glPathMemoryGlyphIndexArrayNV;
+int exists_function_glPathMemoryGlyphIndexArrayNV(void);
+PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC get_function_ptr_glPathMemoryGlyphIndexArrayNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLenum debug_function__glPathMemoryGlyphIndexArrayNV(GLuint  argument_0, GLenum  argument_1, GLsizeiptr  argument_2, const void * argument_3, GLsizei  argument_4, GLuint  argument_5, GLsizei  argument_6, GLuint  argument_7, GLfloat  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glPathMemoryGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glPathMemoryGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glPathMemoryGlyphIndexArrayNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glPathMemoryGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glPathMemoryGlyphIndexArrayNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLPATHPARAMETERFNVPROC function_ptr_glPathParameterfNV;
+int exists_function_glPathParameterfNV(void);
+PFNGLPATHPARAMETERFNVPROC get_function_ptr_glPathParameterfNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathParameterfNV(GLuint  argument_0, GLenum  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathParameterfNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathParameterfNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathParameterfNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathParameterfNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathParameterfNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHPARAMETERFVNVPROC function_ptr_glPathParameterfvNV;
+int exists_function_glPathParameterfvNV(void);
+PFNGLPATHPARAMETERFVNVPROC get_function_ptr_glPathParameterfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathParameterfvNV(GLuint  argument_0, GLenum  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathParameterfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathParameterfvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathParameterfvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathParameterfvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathParameterfvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHPARAMETERINVPROC function_ptr_glPathParameteriNV;
+int exists_function_glPathParameteriNV(void);
+PFNGLPATHPARAMETERINVPROC get_function_ptr_glPathParameteriNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathParameteriNV(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathParameteriNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathParameteriNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathParameteriNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathParameteriNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathParameteriNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHPARAMETERIVNVPROC function_ptr_glPathParameterivNV;
+int exists_function_glPathParameterivNV(void);
+PFNGLPATHPARAMETERIVNVPROC get_function_ptr_glPathParameterivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathParameterivNV(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathParameterivNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathParameterivNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathParameterivNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHSTENCILDEPTHOFFSETNVPROC function_ptr_glPathStencilDepthOffsetNV;
+int exists_function_glPathStencilDepthOffsetNV(void);
+PFNGLPATHSTENCILDEPTHOFFSETNVPROC get_function_ptr_glPathStencilDepthOffsetNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathStencilDepthOffsetNV(GLfloat  argument_0, GLfloat  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPathStencilDepthOffsetNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPathStencilDepthOffsetNV( argument_0, argument_1, __FILE__, __LINE__, "glPathStencilDepthOffsetNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPathStencilDepthOffsetNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPathStencilDepthOffsetNV( argument_0, argument_1)
+#endif
+
+extern PFNGLPATHSTENCILFUNCNVPROC function_ptr_glPathStencilFuncNV;
+int exists_function_glPathStencilFuncNV(void);
+PFNGLPATHSTENCILFUNCNVPROC get_function_ptr_glPathStencilFuncNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathStencilFuncNV(GLenum  argument_0, GLint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPathStencilFuncNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPathStencilFuncNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPathStencilFuncNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPathStencilFuncNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPathStencilFuncNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPATHSTRINGNVPROC function_ptr_glPathStringNV;
+int exists_function_glPathStringNV(void);
+PFNGLPATHSTRINGNVPROC get_function_ptr_glPathStringNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathStringNV(GLuint  argument_0, GLenum  argument_1, GLsizei  argument_2, const void * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glPathStringNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glPathStringNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glPathStringNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glPathStringNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glPathStringNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPATHSUBCOMMANDSNVPROC function_ptr_glPathSubCommandsNV;
+int exists_function_glPathSubCommandsNV(void);
+PFNGLPATHSUBCOMMANDSNVPROC get_function_ptr_glPathSubCommandsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathSubCommandsNV(GLuint  argument_0, GLsizei  argument_1, GLsizei  argument_2, GLsizei  argument_3, const GLubyte * argument_4, GLsizei  argument_5, GLenum  argument_6, const void * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPathSubCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPathSubCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPathSubCommandsNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPathSubCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPathSubCommandsNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPATHSUBCOORDSNVPROC function_ptr_glPathSubCoordsNV;
+int exists_function_glPathSubCoordsNV(void);
+PFNGLPATHSUBCOORDSNVPROC get_function_ptr_glPathSubCoordsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPathSubCoordsNV(GLuint  argument_0, GLsizei  argument_1, GLsizei  argument_2, GLenum  argument_3, const void * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glPathSubCoordsNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glPathSubCoordsNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glPathSubCoordsNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glPathSubCoordsNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glPathSubCoordsNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPAUSETRANSFORMFEEDBACKPROC function_ptr_glPauseTransformFeedback;
+int exists_function_glPauseTransformFeedback(void);
+PFNGLPAUSETRANSFORMFEEDBACKPROC get_function_ptr_glPauseTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPauseTransformFeedback(const char *file, int line, const char *call);
+#define glPauseTransformFeedback() fastuidraw::gl_binding::debug_function__glPauseTransformFeedback( __FILE__, __LINE__, "glPauseTransformFeedback("")")
+#else
+#define glPauseTransformFeedback() fastuidraw::gl_binding::function_ptr_glPauseTransformFeedback()
+#endif
+
+extern PFNGLPIXELSTOREIPROC function_ptr_glPixelStorei;
+int exists_function_glPixelStorei(void);
+PFNGLPIXELSTOREIPROC get_function_ptr_glPixelStorei(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPixelStorei(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPixelStorei( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPixelStorei( argument_0, argument_1, __FILE__, __LINE__, "glPixelStorei("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPixelStorei( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPixelStorei( argument_0, argument_1)
+#endif
+
+extern PFNGLPOINTALONGPATHNVPROC function_ptr_glPointAlongPathNV;
+int exists_function_glPointAlongPathNV(void);
+PFNGLPOINTALONGPATHNVPROC get_function_ptr_glPointAlongPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glPointAlongPathNV(GLuint  argument_0, GLsizei  argument_1, GLsizei  argument_2, GLfloat  argument_3, GLfloat * argument_4, GLfloat * argument_5, GLfloat * argument_6, GLfloat * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPointAlongPathNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPointAlongPathNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPointAlongPathNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPointAlongPathNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPointAlongPathNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPOLYGONMODENVPROC function_ptr_glPolygonModeNV;
+int exists_function_glPolygonModeNV(void);
+PFNGLPOLYGONMODENVPROC get_function_ptr_glPolygonModeNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPolygonModeNV(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPolygonModeNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPolygonModeNV( argument_0, argument_1, __FILE__, __LINE__, "glPolygonModeNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPolygonModeNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPolygonModeNV( argument_0, argument_1)
+#endif
+
+extern PFNGLPOLYGONOFFSETPROC function_ptr_glPolygonOffset;
+int exists_function_glPolygonOffset(void);
+PFNGLPOLYGONOFFSETPROC get_function_ptr_glPolygonOffset(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPolygonOffset(GLfloat  argument_0, GLfloat  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPolygonOffset( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPolygonOffset( argument_0, argument_1, __FILE__, __LINE__, "glPolygonOffset("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPolygonOffset( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPolygonOffset( argument_0, argument_1)
+#endif
+
+extern PFNGLPOLYGONOFFSETCLAMPEXTPROC function_ptr_glPolygonOffsetClampEXT;
+int exists_function_glPolygonOffsetClampEXT(void);
+PFNGLPOLYGONOFFSETCLAMPEXTPROC get_function_ptr_glPolygonOffsetClampEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPolygonOffsetClampEXT(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glPolygonOffsetClampEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glPolygonOffsetClampEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glPolygonOffsetClampEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glPolygonOffsetClampEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glPolygonOffsetClampEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPOPDEBUGGROUPPROC function_ptr_glPopDebugGroup;
+int exists_function_glPopDebugGroup(void);
+PFNGLPOPDEBUGGROUPPROC get_function_ptr_glPopDebugGroup(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPopDebugGroup(const char *file, int line, const char *call);
+#define glPopDebugGroup() fastuidraw::gl_binding::debug_function__glPopDebugGroup( __FILE__, __LINE__, "glPopDebugGroup("")")
+#else
+#define glPopDebugGroup() fastuidraw::gl_binding::function_ptr_glPopDebugGroup()
+#endif
+
+extern PFNGLPOPDEBUGGROUPKHRPROC function_ptr_glPopDebugGroupKHR;
+int exists_function_glPopDebugGroupKHR(void);
+PFNGLPOPDEBUGGROUPKHRPROC get_function_ptr_glPopDebugGroupKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPopDebugGroupKHR(const char *file, int line, const char *call);
+#define glPopDebugGroupKHR() fastuidraw::gl_binding::debug_function__glPopDebugGroupKHR( __FILE__, __LINE__, "glPopDebugGroupKHR("")")
+#else
+#define glPopDebugGroupKHR() fastuidraw::gl_binding::function_ptr_glPopDebugGroupKHR()
+#endif
+
+extern PFNGLPOPGROUPMARKEREXTPROC function_ptr_glPopGroupMarkerEXT;
+int exists_function_glPopGroupMarkerEXT(void);
+PFNGLPOPGROUPMARKEREXTPROC get_function_ptr_glPopGroupMarkerEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPopGroupMarkerEXT(const char *file, int line, const char *call);
+#define glPopGroupMarkerEXT() fastuidraw::gl_binding::debug_function__glPopGroupMarkerEXT( __FILE__, __LINE__, "glPopGroupMarkerEXT("")")
+#else
+#define glPopGroupMarkerEXT() fastuidraw::gl_binding::function_ptr_glPopGroupMarkerEXT()
+#endif
+
+extern PFNGLPRIMITIVEBOUNDINGBOXPROC function_ptr_glPrimitiveBoundingBox;
+int exists_function_glPrimitiveBoundingBox(void);
+PFNGLPRIMITIVEBOUNDINGBOXPROC get_function_ptr_glPrimitiveBoundingBox(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPrimitiveBoundingBox(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPrimitiveBoundingBox( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPrimitiveBoundingBox( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPrimitiveBoundingBox("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPrimitiveBoundingBox( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPrimitiveBoundingBox( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPRIMITIVEBOUNDINGBOXEXTPROC function_ptr_glPrimitiveBoundingBoxEXT;
+int exists_function_glPrimitiveBoundingBoxEXT(void);
+PFNGLPRIMITIVEBOUNDINGBOXEXTPROC get_function_ptr_glPrimitiveBoundingBoxEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPrimitiveBoundingBoxEXT(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPrimitiveBoundingBoxEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPrimitiveBoundingBoxEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPrimitiveBoundingBoxEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPrimitiveBoundingBoxEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPrimitiveBoundingBoxEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPRIMITIVEBOUNDINGBOXOESPROC function_ptr_glPrimitiveBoundingBoxOES;
+int exists_function_glPrimitiveBoundingBoxOES(void);
+PFNGLPRIMITIVEBOUNDINGBOXOESPROC get_function_ptr_glPrimitiveBoundingBoxOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPrimitiveBoundingBoxOES(GLfloat  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glPrimitiveBoundingBoxOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glPrimitiveBoundingBoxOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glPrimitiveBoundingBoxOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glPrimitiveBoundingBoxOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glPrimitiveBoundingBoxOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLPROGRAMBINARYPROC function_ptr_glProgramBinary;
+int exists_function_glProgramBinary(void);
+PFNGLPROGRAMBINARYPROC get_function_ptr_glProgramBinary(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramBinary(GLuint  argument_0, GLenum  argument_1, const void * argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramBinary( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramBinary( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramBinary("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramBinary( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramBinary( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMBINARYOESPROC function_ptr_glProgramBinaryOES;
+int exists_function_glProgramBinaryOES(void);
+PFNGLPROGRAMBINARYOESPROC get_function_ptr_glProgramBinaryOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramBinaryOES(GLuint  argument_0, GLenum  argument_1, const void * argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramBinaryOES( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramBinaryOES( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramBinaryOES("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramBinaryOES( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramBinaryOES( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMPARAMETERIPROC function_ptr_glProgramParameteri;
+int exists_function_glProgramParameteri(void);
+PFNGLPROGRAMPARAMETERIPROC get_function_ptr_glProgramParameteri(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramParameteri(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramParameteri( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramParameteri("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramParameteri( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMPARAMETERIEXTPROC function_ptr_glProgramParameteriEXT;
+int exists_function_glProgramParameteriEXT(void);
+PFNGLPROGRAMPARAMETERIEXTPROC get_function_ptr_glProgramParameteriEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramParameteriEXT(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramParameteriEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramParameteriEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramParameteriEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramParameteriEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramParameteriEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC function_ptr_glProgramPathFragmentInputGenNV;
+int exists_function_glProgramPathFragmentInputGenNV(void);
+PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC get_function_ptr_glProgramPathFragmentInputGenNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramPathFragmentInputGenNV(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLint  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramPathFragmentInputGenNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramPathFragmentInputGenNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramPathFragmentInputGenNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramPathFragmentInputGenNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramPathFragmentInputGenNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1FPROC function_ptr_glProgramUniform1f;
+int exists_function_glProgramUniform1f(void);
+PFNGLPROGRAMUNIFORM1FPROC get_function_ptr_glProgramUniform1f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1f(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1f( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1f("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1f( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1FEXTPROC function_ptr_glProgramUniform1fEXT;
+int exists_function_glProgramUniform1fEXT(void);
+PFNGLPROGRAMUNIFORM1FEXTPROC get_function_ptr_glProgramUniform1fEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1fEXT(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1fEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1fEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1fEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1fEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1fEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1FVPROC function_ptr_glProgramUniform1fv;
+int exists_function_glProgramUniform1fv(void);
+PFNGLPROGRAMUNIFORM1FVPROC get_function_ptr_glProgramUniform1fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1FVEXTPROC function_ptr_glProgramUniform1fvEXT;
+int exists_function_glProgramUniform1fvEXT(void);
+PFNGLPROGRAMUNIFORM1FVEXTPROC get_function_ptr_glProgramUniform1fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1fvEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1fvEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1fvEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1IPROC function_ptr_glProgramUniform1i;
+int exists_function_glProgramUniform1i(void);
+PFNGLPROGRAMUNIFORM1IPROC get_function_ptr_glProgramUniform1i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1i(GLuint  argument_0, GLint  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1i( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1i( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1i("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1i( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1i( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1I64NVPROC function_ptr_glProgramUniform1i64NV;
+int exists_function_glProgramUniform1i64NV(void);
+PFNGLPROGRAMUNIFORM1I64NVPROC get_function_ptr_glProgramUniform1i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1i64NV(GLuint  argument_0, GLint  argument_1, GLint64EXT  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1i64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1i64NV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1i64NV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1i64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1i64NV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1I64VNVPROC function_ptr_glProgramUniform1i64vNV;
+int exists_function_glProgramUniform1i64vNV(void);
+PFNGLPROGRAMUNIFORM1I64VNVPROC get_function_ptr_glProgramUniform1i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1i64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1i64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1i64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1i64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1IEXTPROC function_ptr_glProgramUniform1iEXT;
+int exists_function_glProgramUniform1iEXT(void);
+PFNGLPROGRAMUNIFORM1IEXTPROC get_function_ptr_glProgramUniform1iEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1iEXT(GLuint  argument_0, GLint  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1iEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1iEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1iEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1iEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1iEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1IVPROC function_ptr_glProgramUniform1iv;
+int exists_function_glProgramUniform1iv(void);
+PFNGLPROGRAMUNIFORM1IVPROC get_function_ptr_glProgramUniform1iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1iv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1iv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1iv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1iv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1IVEXTPROC function_ptr_glProgramUniform1ivEXT;
+int exists_function_glProgramUniform1ivEXT(void);
+PFNGLPROGRAMUNIFORM1IVEXTPROC get_function_ptr_glProgramUniform1ivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1ivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1ivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1ivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1ivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UIPROC function_ptr_glProgramUniform1ui;
+int exists_function_glProgramUniform1ui(void);
+PFNGLPROGRAMUNIFORM1UIPROC get_function_ptr_glProgramUniform1ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1ui(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1ui( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1ui( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1ui("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1ui( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1ui( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UI64NVPROC function_ptr_glProgramUniform1ui64NV;
+int exists_function_glProgramUniform1ui64NV(void);
+PFNGLPROGRAMUNIFORM1UI64NVPROC get_function_ptr_glProgramUniform1ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1ui64NV(GLuint  argument_0, GLint  argument_1, GLuint64EXT  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1ui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1ui64NV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1ui64NV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1ui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1ui64NV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UI64VNVPROC function_ptr_glProgramUniform1ui64vNV;
+int exists_function_glProgramUniform1ui64vNV(void);
+PFNGLPROGRAMUNIFORM1UI64VNVPROC get_function_ptr_glProgramUniform1ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1ui64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1ui64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1ui64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1ui64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UIEXTPROC function_ptr_glProgramUniform1uiEXT;
+int exists_function_glProgramUniform1uiEXT(void);
+PFNGLPROGRAMUNIFORM1UIEXTPROC get_function_ptr_glProgramUniform1uiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1uiEXT(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniform1uiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniform1uiEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniform1uiEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniform1uiEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniform1uiEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UIVPROC function_ptr_glProgramUniform1uiv;
+int exists_function_glProgramUniform1uiv(void);
+PFNGLPROGRAMUNIFORM1UIVPROC get_function_ptr_glProgramUniform1uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1uiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1uiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1uiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1uiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM1UIVEXTPROC function_ptr_glProgramUniform1uivEXT;
+int exists_function_glProgramUniform1uivEXT(void);
+PFNGLPROGRAMUNIFORM1UIVEXTPROC get_function_ptr_glProgramUniform1uivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform1uivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform1uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform1uivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform1uivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform1uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform1uivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2FPROC function_ptr_glProgramUniform2f;
+int exists_function_glProgramUniform2f(void);
+PFNGLPROGRAMUNIFORM2FPROC get_function_ptr_glProgramUniform2f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2f(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2f( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2f("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2f( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2FEXTPROC function_ptr_glProgramUniform2fEXT;
+int exists_function_glProgramUniform2fEXT(void);
+PFNGLPROGRAMUNIFORM2FEXTPROC get_function_ptr_glProgramUniform2fEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2fEXT(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2fEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2fEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2fEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2fEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2fEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2FVPROC function_ptr_glProgramUniform2fv;
+int exists_function_glProgramUniform2fv(void);
+PFNGLPROGRAMUNIFORM2FVPROC get_function_ptr_glProgramUniform2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2FVEXTPROC function_ptr_glProgramUniform2fvEXT;
+int exists_function_glProgramUniform2fvEXT(void);
+PFNGLPROGRAMUNIFORM2FVEXTPROC get_function_ptr_glProgramUniform2fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2fvEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2fvEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2fvEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2IPROC function_ptr_glProgramUniform2i;
+int exists_function_glProgramUniform2i(void);
+PFNGLPROGRAMUNIFORM2IPROC get_function_ptr_glProgramUniform2i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2i(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2i( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2i( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2i("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2i( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2i( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2I64NVPROC function_ptr_glProgramUniform2i64NV;
+int exists_function_glProgramUniform2i64NV(void);
+PFNGLPROGRAMUNIFORM2I64NVPROC get_function_ptr_glProgramUniform2i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2i64NV(GLuint  argument_0, GLint  argument_1, GLint64EXT  argument_2, GLint64EXT  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2i64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2i64NV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2i64NV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2i64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2i64NV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2I64VNVPROC function_ptr_glProgramUniform2i64vNV;
+int exists_function_glProgramUniform2i64vNV(void);
+PFNGLPROGRAMUNIFORM2I64VNVPROC get_function_ptr_glProgramUniform2i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2i64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2i64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2i64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2i64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2IEXTPROC function_ptr_glProgramUniform2iEXT;
+int exists_function_glProgramUniform2iEXT(void);
+PFNGLPROGRAMUNIFORM2IEXTPROC get_function_ptr_glProgramUniform2iEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2iEXT(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2iEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2iEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2iEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2iEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2iEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2IVPROC function_ptr_glProgramUniform2iv;
+int exists_function_glProgramUniform2iv(void);
+PFNGLPROGRAMUNIFORM2IVPROC get_function_ptr_glProgramUniform2iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2iv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2iv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2iv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2iv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2IVEXTPROC function_ptr_glProgramUniform2ivEXT;
+int exists_function_glProgramUniform2ivEXT(void);
+PFNGLPROGRAMUNIFORM2IVEXTPROC get_function_ptr_glProgramUniform2ivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2ivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2ivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2ivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2ivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UIPROC function_ptr_glProgramUniform2ui;
+int exists_function_glProgramUniform2ui(void);
+PFNGLPROGRAMUNIFORM2UIPROC get_function_ptr_glProgramUniform2ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2ui(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2ui( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2ui( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2ui("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2ui( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2ui( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UI64NVPROC function_ptr_glProgramUniform2ui64NV;
+int exists_function_glProgramUniform2ui64NV(void);
+PFNGLPROGRAMUNIFORM2UI64NVPROC get_function_ptr_glProgramUniform2ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2ui64NV(GLuint  argument_0, GLint  argument_1, GLuint64EXT  argument_2, GLuint64EXT  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2ui64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2ui64NV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2ui64NV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2ui64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2ui64NV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UI64VNVPROC function_ptr_glProgramUniform2ui64vNV;
+int exists_function_glProgramUniform2ui64vNV(void);
+PFNGLPROGRAMUNIFORM2UI64VNVPROC get_function_ptr_glProgramUniform2ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2ui64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2ui64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2ui64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2ui64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UIEXTPROC function_ptr_glProgramUniform2uiEXT;
+int exists_function_glProgramUniform2uiEXT(void);
+PFNGLPROGRAMUNIFORM2UIEXTPROC get_function_ptr_glProgramUniform2uiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2uiEXT(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2uiEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2uiEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2uiEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2uiEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2uiEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UIVPROC function_ptr_glProgramUniform2uiv;
+int exists_function_glProgramUniform2uiv(void);
+PFNGLPROGRAMUNIFORM2UIVPROC get_function_ptr_glProgramUniform2uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2uiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2uiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2uiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2uiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM2UIVEXTPROC function_ptr_glProgramUniform2uivEXT;
+int exists_function_glProgramUniform2uivEXT(void);
+PFNGLPROGRAMUNIFORM2UIVEXTPROC get_function_ptr_glProgramUniform2uivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform2uivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform2uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform2uivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform2uivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform2uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform2uivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3FPROC function_ptr_glProgramUniform3f;
+int exists_function_glProgramUniform3f(void);
+PFNGLPROGRAMUNIFORM3FPROC get_function_ptr_glProgramUniform3f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3f(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3f( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3f("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3f( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3FEXTPROC function_ptr_glProgramUniform3fEXT;
+int exists_function_glProgramUniform3fEXT(void);
+PFNGLPROGRAMUNIFORM3FEXTPROC get_function_ptr_glProgramUniform3fEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3fEXT(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3fEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3fEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3fEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3fEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3fEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3FVPROC function_ptr_glProgramUniform3fv;
+int exists_function_glProgramUniform3fv(void);
+PFNGLPROGRAMUNIFORM3FVPROC get_function_ptr_glProgramUniform3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3FVEXTPROC function_ptr_glProgramUniform3fvEXT;
+int exists_function_glProgramUniform3fvEXT(void);
+PFNGLPROGRAMUNIFORM3FVEXTPROC get_function_ptr_glProgramUniform3fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3fvEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3fvEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3fvEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3IPROC function_ptr_glProgramUniform3i;
+int exists_function_glProgramUniform3i(void);
+PFNGLPROGRAMUNIFORM3IPROC get_function_ptr_glProgramUniform3i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3i(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3i( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3i("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3i( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3I64NVPROC function_ptr_glProgramUniform3i64NV;
+int exists_function_glProgramUniform3i64NV(void);
+PFNGLPROGRAMUNIFORM3I64NVPROC get_function_ptr_glProgramUniform3i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3i64NV(GLuint  argument_0, GLint  argument_1, GLint64EXT  argument_2, GLint64EXT  argument_3, GLint64EXT  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3i64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3i64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3i64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3i64NV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3I64VNVPROC function_ptr_glProgramUniform3i64vNV;
+int exists_function_glProgramUniform3i64vNV(void);
+PFNGLPROGRAMUNIFORM3I64VNVPROC get_function_ptr_glProgramUniform3i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3i64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3i64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3i64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3i64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3IEXTPROC function_ptr_glProgramUniform3iEXT;
+int exists_function_glProgramUniform3iEXT(void);
+PFNGLPROGRAMUNIFORM3IEXTPROC get_function_ptr_glProgramUniform3iEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3iEXT(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3iEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3iEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3iEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3iEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3iEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3IVPROC function_ptr_glProgramUniform3iv;
+int exists_function_glProgramUniform3iv(void);
+PFNGLPROGRAMUNIFORM3IVPROC get_function_ptr_glProgramUniform3iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3iv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3iv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3iv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3iv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3IVEXTPROC function_ptr_glProgramUniform3ivEXT;
+int exists_function_glProgramUniform3ivEXT(void);
+PFNGLPROGRAMUNIFORM3IVEXTPROC get_function_ptr_glProgramUniform3ivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3ivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3ivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3ivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3ivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UIPROC function_ptr_glProgramUniform3ui;
+int exists_function_glProgramUniform3ui(void);
+PFNGLPROGRAMUNIFORM3UIPROC get_function_ptr_glProgramUniform3ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3ui(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3ui( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3ui("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3ui( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UI64NVPROC function_ptr_glProgramUniform3ui64NV;
+int exists_function_glProgramUniform3ui64NV(void);
+PFNGLPROGRAMUNIFORM3UI64NVPROC get_function_ptr_glProgramUniform3ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3ui64NV(GLuint  argument_0, GLint  argument_1, GLuint64EXT  argument_2, GLuint64EXT  argument_3, GLuint64EXT  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3ui64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UI64VNVPROC function_ptr_glProgramUniform3ui64vNV;
+int exists_function_glProgramUniform3ui64vNV(void);
+PFNGLPROGRAMUNIFORM3UI64VNVPROC get_function_ptr_glProgramUniform3ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3ui64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3ui64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3ui64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3ui64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UIEXTPROC function_ptr_glProgramUniform3uiEXT;
+int exists_function_glProgramUniform3uiEXT(void);
+PFNGLPROGRAMUNIFORM3UIEXTPROC get_function_ptr_glProgramUniform3uiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3uiEXT(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniform3uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniform3uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniform3uiEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniform3uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniform3uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UIVPROC function_ptr_glProgramUniform3uiv;
+int exists_function_glProgramUniform3uiv(void);
+PFNGLPROGRAMUNIFORM3UIVPROC get_function_ptr_glProgramUniform3uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3uiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3uiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3uiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3uiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM3UIVEXTPROC function_ptr_glProgramUniform3uivEXT;
+int exists_function_glProgramUniform3uivEXT(void);
+PFNGLPROGRAMUNIFORM3UIVEXTPROC get_function_ptr_glProgramUniform3uivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform3uivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform3uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform3uivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform3uivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform3uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform3uivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4FPROC function_ptr_glProgramUniform4f;
+int exists_function_glProgramUniform4f(void);
+PFNGLPROGRAMUNIFORM4FPROC get_function_ptr_glProgramUniform4f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4f(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4f("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4FEXTPROC function_ptr_glProgramUniform4fEXT;
+int exists_function_glProgramUniform4fEXT(void);
+PFNGLPROGRAMUNIFORM4FEXTPROC get_function_ptr_glProgramUniform4fEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4fEXT(GLuint  argument_0, GLint  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4fEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4fEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4fEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4fEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4fEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4FVPROC function_ptr_glProgramUniform4fv;
+int exists_function_glProgramUniform4fv(void);
+PFNGLPROGRAMUNIFORM4FVPROC get_function_ptr_glProgramUniform4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4FVEXTPROC function_ptr_glProgramUniform4fvEXT;
+int exists_function_glProgramUniform4fvEXT(void);
+PFNGLPROGRAMUNIFORM4FVEXTPROC get_function_ptr_glProgramUniform4fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4fvEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4fvEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4fvEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4fvEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4IPROC function_ptr_glProgramUniform4i;
+int exists_function_glProgramUniform4i(void);
+PFNGLPROGRAMUNIFORM4IPROC get_function_ptr_glProgramUniform4i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4i(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4i("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4I64NVPROC function_ptr_glProgramUniform4i64NV;
+int exists_function_glProgramUniform4i64NV(void);
+PFNGLPROGRAMUNIFORM4I64NVPROC get_function_ptr_glProgramUniform4i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4i64NV(GLuint  argument_0, GLint  argument_1, GLint64EXT  argument_2, GLint64EXT  argument_3, GLint64EXT  argument_4, GLint64EXT  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4i64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4I64VNVPROC function_ptr_glProgramUniform4i64vNV;
+int exists_function_glProgramUniform4i64vNV(void);
+PFNGLPROGRAMUNIFORM4I64VNVPROC get_function_ptr_glProgramUniform4i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4i64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4i64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4i64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4i64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4i64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4IEXTPROC function_ptr_glProgramUniform4iEXT;
+int exists_function_glProgramUniform4iEXT(void);
+PFNGLPROGRAMUNIFORM4IEXTPROC get_function_ptr_glProgramUniform4iEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4iEXT(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4iEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4iEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4iEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4iEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4iEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4IVPROC function_ptr_glProgramUniform4iv;
+int exists_function_glProgramUniform4iv(void);
+PFNGLPROGRAMUNIFORM4IVPROC get_function_ptr_glProgramUniform4iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4iv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4iv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4iv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4iv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4iv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4IVEXTPROC function_ptr_glProgramUniform4ivEXT;
+int exists_function_glProgramUniform4ivEXT(void);
+PFNGLPROGRAMUNIFORM4IVEXTPROC get_function_ptr_glProgramUniform4ivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4ivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4ivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4ivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4ivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4ivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UIPROC function_ptr_glProgramUniform4ui;
+int exists_function_glProgramUniform4ui(void);
+PFNGLPROGRAMUNIFORM4UIPROC get_function_ptr_glProgramUniform4ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4ui(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, GLuint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4ui("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UI64NVPROC function_ptr_glProgramUniform4ui64NV;
+int exists_function_glProgramUniform4ui64NV(void);
+PFNGLPROGRAMUNIFORM4UI64NVPROC get_function_ptr_glProgramUniform4ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4ui64NV(GLuint  argument_0, GLint  argument_1, GLuint64EXT  argument_2, GLuint64EXT  argument_3, GLuint64EXT  argument_4, GLuint64EXT  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4ui64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UI64VNVPROC function_ptr_glProgramUniform4ui64vNV;
+int exists_function_glProgramUniform4ui64vNV(void);
+PFNGLPROGRAMUNIFORM4UI64VNVPROC get_function_ptr_glProgramUniform4ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4ui64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64EXT * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4ui64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4ui64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4ui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4ui64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UIEXTPROC function_ptr_glProgramUniform4uiEXT;
+int exists_function_glProgramUniform4uiEXT(void);
+PFNGLPROGRAMUNIFORM4UIEXTPROC get_function_ptr_glProgramUniform4uiEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4uiEXT(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, GLuint  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glProgramUniform4uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glProgramUniform4uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glProgramUniform4uiEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glProgramUniform4uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glProgramUniform4uiEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UIVPROC function_ptr_glProgramUniform4uiv;
+int exists_function_glProgramUniform4uiv(void);
+PFNGLPROGRAMUNIFORM4UIVPROC get_function_ptr_glProgramUniform4uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4uiv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4uiv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4uiv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4uiv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4uiv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORM4UIVEXTPROC function_ptr_glProgramUniform4uivEXT;
+int exists_function_glProgramUniform4uivEXT(void);
+PFNGLPROGRAMUNIFORM4UIVEXTPROC get_function_ptr_glProgramUniform4uivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniform4uivEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniform4uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniform4uivEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniform4uivEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniform4uivEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniform4uivEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORMHANDLEUI64IMGPROC function_ptr_glProgramUniformHandleui64IMG;
+int exists_function_glProgramUniformHandleui64IMG(void);
+PFNGLPROGRAMUNIFORMHANDLEUI64IMGPROC get_function_ptr_glProgramUniformHandleui64IMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformHandleui64IMG(GLuint  argument_0, GLint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniformHandleui64IMG( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniformHandleui64IMG( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniformHandleui64IMG("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniformHandleui64IMG( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniformHandleui64IMG( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC function_ptr_glProgramUniformHandleui64NV;
+int exists_function_glProgramUniformHandleui64NV(void);
+PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC get_function_ptr_glProgramUniformHandleui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformHandleui64NV(GLuint  argument_0, GLint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glProgramUniformHandleui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glProgramUniformHandleui64NV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glProgramUniformHandleui64NV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glProgramUniformHandleui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glProgramUniformHandleui64NV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLPROGRAMUNIFORMHANDLEUI64VIMGPROC function_ptr_glProgramUniformHandleui64vIMG;
+int exists_function_glProgramUniformHandleui64vIMG(void);
+PFNGLPROGRAMUNIFORMHANDLEUI64VIMGPROC get_function_ptr_glProgramUniformHandleui64vIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformHandleui64vIMG(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64 * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniformHandleui64vIMG( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniformHandleui64vIMG( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniformHandleui64vIMG("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniformHandleui64vIMG( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniformHandleui64vIMG( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC function_ptr_glProgramUniformHandleui64vNV;
+int exists_function_glProgramUniformHandleui64vNV(void);
+PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC get_function_ptr_glProgramUniformHandleui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformHandleui64vNV(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, const GLuint64 * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glProgramUniformHandleui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glProgramUniformHandleui64vNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glProgramUniformHandleui64vNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glProgramUniformHandleui64vNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glProgramUniformHandleui64vNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2FVPROC function_ptr_glProgramUniformMatrix2fv;
+int exists_function_glProgramUniformMatrix2fv(void);
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC get_function_ptr_glProgramUniformMatrix2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC function_ptr_glProgramUniformMatrix2fvEXT;
+int exists_function_glProgramUniformMatrix2fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC get_function_ptr_glProgramUniformMatrix2fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC function_ptr_glProgramUniformMatrix2x3fv;
+int exists_function_glProgramUniformMatrix2x3fv(void);
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC get_function_ptr_glProgramUniformMatrix2x3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2x3fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2x3fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC function_ptr_glProgramUniformMatrix2x3fvEXT;
+int exists_function_glProgramUniformMatrix2x3fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC get_function_ptr_glProgramUniformMatrix2x3fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2x3fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2x3fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC function_ptr_glProgramUniformMatrix2x4fv;
+int exists_function_glProgramUniformMatrix2x4fv(void);
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC get_function_ptr_glProgramUniformMatrix2x4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2x4fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2x4fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC function_ptr_glProgramUniformMatrix2x4fvEXT;
+int exists_function_glProgramUniformMatrix2x4fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC get_function_ptr_glProgramUniformMatrix2x4fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix2x4fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix2x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix2x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix2x4fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix2x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix2x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3FVPROC function_ptr_glProgramUniformMatrix3fv;
+int exists_function_glProgramUniformMatrix3fv(void);
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC get_function_ptr_glProgramUniformMatrix3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC function_ptr_glProgramUniformMatrix3fvEXT;
+int exists_function_glProgramUniformMatrix3fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC get_function_ptr_glProgramUniformMatrix3fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC function_ptr_glProgramUniformMatrix3x2fv;
+int exists_function_glProgramUniformMatrix3x2fv(void);
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC get_function_ptr_glProgramUniformMatrix3x2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3x2fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3x2fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC function_ptr_glProgramUniformMatrix3x2fvEXT;
+int exists_function_glProgramUniformMatrix3x2fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC get_function_ptr_glProgramUniformMatrix3x2fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3x2fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3x2fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC function_ptr_glProgramUniformMatrix3x4fv;
+int exists_function_glProgramUniformMatrix3x4fv(void);
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC get_function_ptr_glProgramUniformMatrix3x4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3x4fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3x4fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC function_ptr_glProgramUniformMatrix3x4fvEXT;
+int exists_function_glProgramUniformMatrix3x4fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC get_function_ptr_glProgramUniformMatrix3x4fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix3x4fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix3x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix3x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix3x4fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix3x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix3x4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC function_ptr_glProgramUniformMatrix4fv;
+int exists_function_glProgramUniformMatrix4fv(void);
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC get_function_ptr_glProgramUniformMatrix4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC function_ptr_glProgramUniformMatrix4fvEXT;
+int exists_function_glProgramUniformMatrix4fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC get_function_ptr_glProgramUniformMatrix4fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC function_ptr_glProgramUniformMatrix4x2fv;
+int exists_function_glProgramUniformMatrix4x2fv(void);
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC get_function_ptr_glProgramUniformMatrix4x2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4x2fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4x2fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC function_ptr_glProgramUniformMatrix4x2fvEXT;
+int exists_function_glProgramUniformMatrix4x2fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC get_function_ptr_glProgramUniformMatrix4x2fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4x2fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4x2fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4x2fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC function_ptr_glProgramUniformMatrix4x3fv;
+int exists_function_glProgramUniformMatrix4x3fv(void);
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC get_function_ptr_glProgramUniformMatrix4x3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4x3fv(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4x3fv("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC function_ptr_glProgramUniformMatrix4x3fvEXT;
+int exists_function_glProgramUniformMatrix4x3fvEXT(void);
+PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC get_function_ptr_glProgramUniformMatrix4x3fvEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glProgramUniformMatrix4x3fvEXT(GLuint  argument_0, GLint  argument_1, GLsizei  argument_2, GLboolean  argument_3, const GLfloat * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glProgramUniformMatrix4x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glProgramUniformMatrix4x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glProgramUniformMatrix4x3fvEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glProgramUniformMatrix4x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glProgramUniformMatrix4x3fvEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLPUSHDEBUGGROUPPROC function_ptr_glPushDebugGroup;
+int exists_function_glPushDebugGroup(void);
+PFNGLPUSHDEBUGGROUPPROC get_function_ptr_glPushDebugGroup(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPushDebugGroup(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glPushDebugGroup( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glPushDebugGroup( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glPushDebugGroup("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glPushDebugGroup( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glPushDebugGroup( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPUSHDEBUGGROUPKHRPROC function_ptr_glPushDebugGroupKHR;
+int exists_function_glPushDebugGroupKHR(void);
+PFNGLPUSHDEBUGGROUPKHRPROC get_function_ptr_glPushDebugGroupKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPushDebugGroupKHR(GLenum  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLchar * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glPushDebugGroupKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glPushDebugGroupKHR( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glPushDebugGroupKHR("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glPushDebugGroupKHR( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glPushDebugGroupKHR( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLPUSHGROUPMARKEREXTPROC function_ptr_glPushGroupMarkerEXT;
+int exists_function_glPushGroupMarkerEXT(void);
+PFNGLPUSHGROUPMARKEREXTPROC get_function_ptr_glPushGroupMarkerEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glPushGroupMarkerEXT(GLsizei  argument_0, const GLchar * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glPushGroupMarkerEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glPushGroupMarkerEXT( argument_0, argument_1, __FILE__, __LINE__, "glPushGroupMarkerEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glPushGroupMarkerEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glPushGroupMarkerEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLQUERYCOUNTEREXTPROC function_ptr_glQueryCounterEXT;
+int exists_function_glQueryCounterEXT(void);
+PFNGLQUERYCOUNTEREXTPROC get_function_ptr_glQueryCounterEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glQueryCounterEXT(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glQueryCounterEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glQueryCounterEXT( argument_0, argument_1, __FILE__, __LINE__, "glQueryCounterEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glQueryCounterEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glQueryCounterEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLRASTERSAMPLESEXTPROC function_ptr_glRasterSamplesEXT;
+int exists_function_glRasterSamplesEXT(void);
+PFNGLRASTERSAMPLESEXTPROC get_function_ptr_glRasterSamplesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRasterSamplesEXT(GLuint  argument_0, GLboolean  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glRasterSamplesEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glRasterSamplesEXT( argument_0, argument_1, __FILE__, __LINE__, "glRasterSamplesEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glRasterSamplesEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glRasterSamplesEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLREADBUFFERPROC function_ptr_glReadBuffer;
+int exists_function_glReadBuffer(void);
+PFNGLREADBUFFERPROC get_function_ptr_glReadBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadBuffer(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glReadBuffer( argument_0) fastuidraw::gl_binding::debug_function__glReadBuffer( argument_0, __FILE__, __LINE__, "glReadBuffer("#argument_0")", #argument_0)
+#else
+#define glReadBuffer( argument_0) fastuidraw::gl_binding::function_ptr_glReadBuffer( argument_0)
+#endif
+
+extern PFNGLREADBUFFERINDEXEDEXTPROC function_ptr_glReadBufferIndexedEXT;
+int exists_function_glReadBufferIndexedEXT(void);
+PFNGLREADBUFFERINDEXEDEXTPROC get_function_ptr_glReadBufferIndexedEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadBufferIndexedEXT(GLenum  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glReadBufferIndexedEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glReadBufferIndexedEXT( argument_0, argument_1, __FILE__, __LINE__, "glReadBufferIndexedEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glReadBufferIndexedEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glReadBufferIndexedEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLREADBUFFERNVPROC function_ptr_glReadBufferNV;
+int exists_function_glReadBufferNV(void);
+PFNGLREADBUFFERNVPROC get_function_ptr_glReadBufferNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadBufferNV(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glReadBufferNV( argument_0) fastuidraw::gl_binding::debug_function__glReadBufferNV( argument_0, __FILE__, __LINE__, "glReadBufferNV("#argument_0")", #argument_0)
+#else
+#define glReadBufferNV( argument_0) fastuidraw::gl_binding::function_ptr_glReadBufferNV( argument_0)
+#endif
+
+extern PFNGLREADPIXELSPROC function_ptr_glReadPixels;
+int exists_function_glReadPixels(void);
+PFNGLREADPIXELSPROC get_function_ptr_glReadPixels(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadPixels(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLenum  argument_4, GLenum  argument_5, void * argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glReadPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glReadPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glReadPixels("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glReadPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glReadPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLREADNPIXELSPROC function_ptr_glReadnPixels;
+int exists_function_glReadnPixels(void);
+PFNGLREADNPIXELSPROC get_function_ptr_glReadnPixels(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadnPixels(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLenum  argument_4, GLenum  argument_5, GLsizei  argument_6, void * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glReadnPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glReadnPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glReadnPixels("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glReadnPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glReadnPixels( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLREADNPIXELSEXTPROC function_ptr_glReadnPixelsEXT;
+int exists_function_glReadnPixelsEXT(void);
+PFNGLREADNPIXELSEXTPROC get_function_ptr_glReadnPixelsEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadnPixelsEXT(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLenum  argument_4, GLenum  argument_5, GLsizei  argument_6, void * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glReadnPixelsEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glReadnPixelsEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glReadnPixelsEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glReadnPixelsEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glReadnPixelsEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLREADNPIXELSKHRPROC function_ptr_glReadnPixelsKHR;
+int exists_function_glReadnPixelsKHR(void);
+PFNGLREADNPIXELSKHRPROC get_function_ptr_glReadnPixelsKHR(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReadnPixelsKHR(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, GLenum  argument_4, GLenum  argument_5, GLsizei  argument_6, void * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glReadnPixelsKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glReadnPixelsKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glReadnPixelsKHR("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glReadnPixelsKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glReadnPixelsKHR( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC function_ptr_glReleaseKeyedMutexWin32EXT;
+int exists_function_glReleaseKeyedMutexWin32EXT(void);
+PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC get_function_ptr_glReleaseKeyedMutexWin32EXT(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glReleaseKeyedMutexWin32EXT(GLuint  argument_0, GLuint64  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glReleaseKeyedMutexWin32EXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glReleaseKeyedMutexWin32EXT( argument_0, argument_1, __FILE__, __LINE__, "glReleaseKeyedMutexWin32EXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glReleaseKeyedMutexWin32EXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glReleaseKeyedMutexWin32EXT( argument_0, argument_1)
+#endif
+
+extern PFNGLRELEASESHADERCOMPILERPROC function_ptr_glReleaseShaderCompiler;
+int exists_function_glReleaseShaderCompiler(void);
+PFNGLRELEASESHADERCOMPILERPROC get_function_ptr_glReleaseShaderCompiler(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glReleaseShaderCompiler(const char *file, int line, const char *call);
+#define glReleaseShaderCompiler() fastuidraw::gl_binding::debug_function__glReleaseShaderCompiler( __FILE__, __LINE__, "glReleaseShaderCompiler("")")
+#else
+#define glReleaseShaderCompiler() fastuidraw::gl_binding::function_ptr_glReleaseShaderCompiler()
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEPROC function_ptr_glRenderbufferStorage;
+int exists_function_glRenderbufferStorage(void);
+PFNGLRENDERBUFFERSTORAGEPROC get_function_ptr_glRenderbufferStorage(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorage(GLenum  argument_0, GLenum  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glRenderbufferStorage( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glRenderbufferStorage( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glRenderbufferStorage("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glRenderbufferStorage( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glRenderbufferStorage( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC function_ptr_glRenderbufferStorageMultisample;
+int exists_function_glRenderbufferStorageMultisample(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC get_function_ptr_glRenderbufferStorageMultisample(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisample(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisample( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisample("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisample( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisample( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC function_ptr_glRenderbufferStorageMultisampleANGLE;
+int exists_function_glRenderbufferStorageMultisampleANGLE(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC get_function_ptr_glRenderbufferStorageMultisampleANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleANGLE(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisampleANGLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleANGLE( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisampleANGLE("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisampleANGLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleANGLE( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC function_ptr_glRenderbufferStorageMultisampleAPPLE;
+int exists_function_glRenderbufferStorageMultisampleAPPLE(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC get_function_ptr_glRenderbufferStorageMultisampleAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleAPPLE(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisampleAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisampleAPPLE("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisampleAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleAPPLE( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC function_ptr_glRenderbufferStorageMultisampleAdvancedAMD;
+int exists_function_glRenderbufferStorageMultisampleAdvancedAMD(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC get_function_ptr_glRenderbufferStorageMultisampleAdvancedAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleAdvancedAMD(GLenum  argument_0, GLsizei  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glRenderbufferStorageMultisampleAdvancedAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleAdvancedAMD( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC function_ptr_glRenderbufferStorageMultisampleEXT;
+int exists_function_glRenderbufferStorageMultisampleEXT(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC get_function_ptr_glRenderbufferStorageMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC function_ptr_glRenderbufferStorageMultisampleIMG;
+int exists_function_glRenderbufferStorageMultisampleIMG(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC get_function_ptr_glRenderbufferStorageMultisampleIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleIMG(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisampleIMG("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleIMG( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC function_ptr_glRenderbufferStorageMultisampleNV;
+int exists_function_glRenderbufferStorageMultisampleNV(void);
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC get_function_ptr_glRenderbufferStorageMultisampleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glRenderbufferStorageMultisampleNV(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glRenderbufferStorageMultisampleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glRenderbufferStorageMultisampleNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glRenderbufferStorageMultisampleNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glRenderbufferStorageMultisampleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glRenderbufferStorageMultisampleNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLRESETMEMORYOBJECTPARAMETERNVPROC function_ptr_glResetMemoryObjectParameterNV;
+int exists_function_glResetMemoryObjectParameterNV(void);
+PFNGLRESETMEMORYOBJECTPARAMETERNVPROC get_function_ptr_glResetMemoryObjectParameterNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glResetMemoryObjectParameterNV(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glResetMemoryObjectParameterNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glResetMemoryObjectParameterNV( argument_0, argument_1, __FILE__, __LINE__, "glResetMemoryObjectParameterNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glResetMemoryObjectParameterNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glResetMemoryObjectParameterNV( argument_0, argument_1)
+#endif
+
+extern PFNGLRESOLVEDEPTHVALUESNVPROC function_ptr_glResolveDepthValuesNV;
+int exists_function_glResolveDepthValuesNV(void);
+PFNGLRESOLVEDEPTHVALUESNVPROC get_function_ptr_glResolveDepthValuesNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glResolveDepthValuesNV(const char *file, int line, const char *call);
+#define glResolveDepthValuesNV() fastuidraw::gl_binding::debug_function__glResolveDepthValuesNV( __FILE__, __LINE__, "glResolveDepthValuesNV("")")
+#else
+#define glResolveDepthValuesNV() fastuidraw::gl_binding::function_ptr_glResolveDepthValuesNV()
+#endif
+
+extern PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC function_ptr_glResolveMultisampleFramebufferAPPLE;
+int exists_function_glResolveMultisampleFramebufferAPPLE(void);
+PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC get_function_ptr_glResolveMultisampleFramebufferAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glResolveMultisampleFramebufferAPPLE(const char *file, int line, const char *call);
+#define glResolveMultisampleFramebufferAPPLE() fastuidraw::gl_binding::debug_function__glResolveMultisampleFramebufferAPPLE( __FILE__, __LINE__, "glResolveMultisampleFramebufferAPPLE("")")
+#else
+#define glResolveMultisampleFramebufferAPPLE() fastuidraw::gl_binding::function_ptr_glResolveMultisampleFramebufferAPPLE()
+#endif
+
+extern PFNGLRESUMETRANSFORMFEEDBACKPROC function_ptr_glResumeTransformFeedback;
+int exists_function_glResumeTransformFeedback(void);
+PFNGLRESUMETRANSFORMFEEDBACKPROC get_function_ptr_glResumeTransformFeedback(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glResumeTransformFeedback(const char *file, int line, const char *call);
+#define glResumeTransformFeedback() fastuidraw::gl_binding::debug_function__glResumeTransformFeedback( __FILE__, __LINE__, "glResumeTransformFeedback("")")
+#else
+#define glResumeTransformFeedback() fastuidraw::gl_binding::function_ptr_glResumeTransformFeedback()
+#endif
+
+extern PFNGLSAMPLECOVERAGEPROC function_ptr_glSampleCoverage;
+int exists_function_glSampleCoverage(void);
+PFNGLSAMPLECOVERAGEPROC get_function_ptr_glSampleCoverage(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSampleCoverage(GLfloat  argument_0, GLboolean  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glSampleCoverage( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glSampleCoverage( argument_0, argument_1, __FILE__, __LINE__, "glSampleCoverage("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glSampleCoverage( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glSampleCoverage( argument_0, argument_1)
+#endif
+
+extern PFNGLSAMPLEMASKIPROC function_ptr_glSampleMaski;
+int exists_function_glSampleMaski(void);
+PFNGLSAMPLEMASKIPROC get_function_ptr_glSampleMaski(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSampleMaski(GLuint  argument_0, GLbitfield  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glSampleMaski( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glSampleMaski( argument_0, argument_1, __FILE__, __LINE__, "glSampleMaski("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glSampleMaski( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glSampleMaski( argument_0, argument_1)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIIVPROC function_ptr_glSamplerParameterIiv;
+int exists_function_glSamplerParameterIiv(void);
+PFNGLSAMPLERPARAMETERIIVPROC get_function_ptr_glSamplerParameterIiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIiv(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIIVEXTPROC function_ptr_glSamplerParameterIivEXT;
+int exists_function_glSamplerParameterIivEXT(void);
+PFNGLSAMPLERPARAMETERIIVEXTPROC get_function_ptr_glSamplerParameterIivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIivEXT(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIIVOESPROC function_ptr_glSamplerParameterIivOES;
+int exists_function_glSamplerParameterIivOES(void);
+PFNGLSAMPLERPARAMETERIIVOESPROC get_function_ptr_glSamplerParameterIivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIivOES(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIUIVPROC function_ptr_glSamplerParameterIuiv;
+int exists_function_glSamplerParameterIuiv(void);
+PFNGLSAMPLERPARAMETERIUIVPROC get_function_ptr_glSamplerParameterIuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIuiv(GLuint  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIUIVEXTPROC function_ptr_glSamplerParameterIuivEXT;
+int exists_function_glSamplerParameterIuivEXT(void);
+PFNGLSAMPLERPARAMETERIUIVEXTPROC get_function_ptr_glSamplerParameterIuivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIuivEXT(GLuint  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIuivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIuivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIuivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIUIVOESPROC function_ptr_glSamplerParameterIuivOES;
+int exists_function_glSamplerParameterIuivOES(void);
+PFNGLSAMPLERPARAMETERIUIVOESPROC get_function_ptr_glSamplerParameterIuivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterIuivOES(GLuint  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterIuivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterIuivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterIuivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERFPROC function_ptr_glSamplerParameterf;
+int exists_function_glSamplerParameterf(void);
+PFNGLSAMPLERPARAMETERFPROC get_function_ptr_glSamplerParameterf(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterf(GLuint  argument_0, GLenum  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterf( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterf( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterf("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterf( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterf( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERFVPROC function_ptr_glSamplerParameterfv;
+int exists_function_glSamplerParameterfv(void);
+PFNGLSAMPLERPARAMETERFVPROC get_function_ptr_glSamplerParameterfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameterfv(GLuint  argument_0, GLenum  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameterfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameterfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameterfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIPROC function_ptr_glSamplerParameteri;
+int exists_function_glSamplerParameteri(void);
+PFNGLSAMPLERPARAMETERIPROC get_function_ptr_glSamplerParameteri(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameteri(GLuint  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameteri( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameteri("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameteri( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSAMPLERPARAMETERIVPROC function_ptr_glSamplerParameteriv;
+int exists_function_glSamplerParameteriv(void);
+PFNGLSAMPLERPARAMETERIVPROC get_function_ptr_glSamplerParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSamplerParameteriv(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSamplerParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSamplerParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSamplerParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSamplerParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSamplerParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSCISSORPROC function_ptr_glScissor;
+int exists_function_glScissor(void);
+PFNGLSCISSORPROC get_function_ptr_glScissor(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissor(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glScissor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glScissor( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glScissor("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glScissor( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glScissor( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSCISSORARRAYVNVPROC function_ptr_glScissorArrayvNV;
+int exists_function_glScissorArrayvNV(void);
+PFNGLSCISSORARRAYVNVPROC get_function_ptr_glScissorArrayvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorArrayvNV(GLuint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glScissorArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glScissorArrayvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glScissorArrayvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glScissorArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glScissorArrayvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSCISSORARRAYVOESPROC function_ptr_glScissorArrayvOES;
+int exists_function_glScissorArrayvOES(void);
+PFNGLSCISSORARRAYVOESPROC get_function_ptr_glScissorArrayvOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorArrayvOES(GLuint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glScissorArrayvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glScissorArrayvOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glScissorArrayvOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glScissorArrayvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glScissorArrayvOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSCISSOREXCLUSIVEARRAYVNVPROC function_ptr_glScissorExclusiveArrayvNV;
+int exists_function_glScissorExclusiveArrayvNV(void);
+PFNGLSCISSOREXCLUSIVEARRAYVNVPROC get_function_ptr_glScissorExclusiveArrayvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorExclusiveArrayvNV(GLuint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glScissorExclusiveArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glScissorExclusiveArrayvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glScissorExclusiveArrayvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glScissorExclusiveArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glScissorExclusiveArrayvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSCISSOREXCLUSIVENVPROC function_ptr_glScissorExclusiveNV;
+int exists_function_glScissorExclusiveNV(void);
+PFNGLSCISSOREXCLUSIVENVPROC get_function_ptr_glScissorExclusiveNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorExclusiveNV(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glScissorExclusiveNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glScissorExclusiveNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glScissorExclusiveNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glScissorExclusiveNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glScissorExclusiveNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSCISSORINDEXEDNVPROC function_ptr_glScissorIndexedNV;
+int exists_function_glScissorIndexedNV(void);
+PFNGLSCISSORINDEXEDNVPROC get_function_ptr_glScissorIndexedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorIndexedNV(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glScissorIndexedNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glScissorIndexedNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glScissorIndexedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glScissorIndexedNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glScissorIndexedNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLSCISSORINDEXEDOESPROC function_ptr_glScissorIndexedOES;
+int exists_function_glScissorIndexedOES(void);
+PFNGLSCISSORINDEXEDOESPROC get_function_ptr_glScissorIndexedOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorIndexedOES(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glScissorIndexedOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glScissorIndexedOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glScissorIndexedOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glScissorIndexedOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glScissorIndexedOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLSCISSORINDEXEDVNVPROC function_ptr_glScissorIndexedvNV;
+int exists_function_glScissorIndexedvNV(void);
+PFNGLSCISSORINDEXEDVNVPROC get_function_ptr_glScissorIndexedvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorIndexedvNV(GLuint  argument_0, const GLint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glScissorIndexedvNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glScissorIndexedvNV( argument_0, argument_1, __FILE__, __LINE__, "glScissorIndexedvNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glScissorIndexedvNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glScissorIndexedvNV( argument_0, argument_1)
+#endif
+
+extern PFNGLSCISSORINDEXEDVOESPROC function_ptr_glScissorIndexedvOES;
+int exists_function_glScissorIndexedvOES(void);
+PFNGLSCISSORINDEXEDVOESPROC get_function_ptr_glScissorIndexedvOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glScissorIndexedvOES(GLuint  argument_0, const GLint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glScissorIndexedvOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glScissorIndexedvOES( argument_0, argument_1, __FILE__, __LINE__, "glScissorIndexedvOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glScissorIndexedvOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glScissorIndexedvOES( argument_0, argument_1)
+#endif
+
+extern PFNGLSELECTPERFMONITORCOUNTERSAMDPROC function_ptr_glSelectPerfMonitorCountersAMD;
+int exists_function_glSelectPerfMonitorCountersAMD(void);
+PFNGLSELECTPERFMONITORCOUNTERSAMDPROC get_function_ptr_glSelectPerfMonitorCountersAMD(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSelectPerfMonitorCountersAMD(GLuint  argument_0, GLboolean  argument_1, GLuint  argument_2, GLint  argument_3, GLuint * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glSelectPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glSelectPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glSelectPerfMonitorCountersAMD("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glSelectPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glSelectPerfMonitorCountersAMD( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLSEMAPHOREPARAMETERIVNVPROC function_ptr_glSemaphoreParameterivNV;
+int exists_function_glSemaphoreParameterivNV(void);
+PFNGLSEMAPHOREPARAMETERIVNVPROC get_function_ptr_glSemaphoreParameterivNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSemaphoreParameterivNV(GLuint  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSemaphoreParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSemaphoreParameterivNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSemaphoreParameterivNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSemaphoreParameterivNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSemaphoreParameterivNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSEMAPHOREPARAMETERUI64VEXTPROC function_ptr_glSemaphoreParameterui64vEXT;
+int exists_function_glSemaphoreParameterui64vEXT(void);
+PFNGLSEMAPHOREPARAMETERUI64VEXTPROC get_function_ptr_glSemaphoreParameterui64vEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSemaphoreParameterui64vEXT(GLuint  argument_0, GLenum  argument_1, const GLuint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glSemaphoreParameterui64vEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glSemaphoreParameterui64vEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSETFENCENVPROC function_ptr_glSetFenceNV;
+int exists_function_glSetFenceNV(void);
+PFNGLSETFENCENVPROC get_function_ptr_glSetFenceNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSetFenceNV(GLuint  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glSetFenceNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glSetFenceNV( argument_0, argument_1, __FILE__, __LINE__, "glSetFenceNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glSetFenceNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glSetFenceNV( argument_0, argument_1)
+#endif
+
+extern PFNGLSHADERBINARYPROC function_ptr_glShaderBinary;
+int exists_function_glShaderBinary(void);
+PFNGLSHADERBINARYPROC get_function_ptr_glShaderBinary(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShaderBinary(GLsizei  argument_0, const GLuint * argument_1, GLenum  argument_2, const void * argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glShaderBinary( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glShaderBinary( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glShaderBinary("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glShaderBinary( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glShaderBinary( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLSHADERSOURCEPROC function_ptr_glShaderSource;
+int exists_function_glShaderSource(void);
+PFNGLSHADERSOURCEPROC get_function_ptr_glShaderSource(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShaderSource(GLuint  argument_0, GLsizei  argument_1, const GLchar *const* argument_2, const GLint * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glShaderSource( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glShaderSource( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glShaderSource("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glShaderSource( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glShaderSource( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSHADINGRATECOMBINEROPSEXTPROC function_ptr_glShadingRateCombinerOpsEXT;
+int exists_function_glShadingRateCombinerOpsEXT(void);
+PFNGLSHADINGRATECOMBINEROPSEXTPROC get_function_ptr_glShadingRateCombinerOpsEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateCombinerOpsEXT(GLenum  argument_0, GLenum  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glShadingRateCombinerOpsEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glShadingRateCombinerOpsEXT( argument_0, argument_1, __FILE__, __LINE__, "glShadingRateCombinerOpsEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glShadingRateCombinerOpsEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glShadingRateCombinerOpsEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLSHADINGRATEEXTPROC function_ptr_glShadingRateEXT;
+int exists_function_glShadingRateEXT(void);
+PFNGLSHADINGRATEEXTPROC get_function_ptr_glShadingRateEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateEXT(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glShadingRateEXT( argument_0) fastuidraw::gl_binding::debug_function__glShadingRateEXT( argument_0, __FILE__, __LINE__, "glShadingRateEXT("#argument_0")", #argument_0)
+#else
+#define glShadingRateEXT( argument_0) fastuidraw::gl_binding::function_ptr_glShadingRateEXT( argument_0)
+#endif
+
+extern PFNGLSHADINGRATEIMAGEBARRIERNVPROC function_ptr_glShadingRateImageBarrierNV;
+int exists_function_glShadingRateImageBarrierNV(void);
+PFNGLSHADINGRATEIMAGEBARRIERNVPROC get_function_ptr_glShadingRateImageBarrierNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateImageBarrierNV(GLboolean  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glShadingRateImageBarrierNV( argument_0) fastuidraw::gl_binding::debug_function__glShadingRateImageBarrierNV( argument_0, __FILE__, __LINE__, "glShadingRateImageBarrierNV("#argument_0")", #argument_0)
+#else
+#define glShadingRateImageBarrierNV( argument_0) fastuidraw::gl_binding::function_ptr_glShadingRateImageBarrierNV( argument_0)
+#endif
+
+extern PFNGLSHADINGRATEIMAGEPALETTENVPROC function_ptr_glShadingRateImagePaletteNV;
+int exists_function_glShadingRateImagePaletteNV(void);
+PFNGLSHADINGRATEIMAGEPALETTENVPROC get_function_ptr_glShadingRateImagePaletteNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateImagePaletteNV(GLuint  argument_0, GLuint  argument_1, GLsizei  argument_2, const GLenum * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glShadingRateImagePaletteNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glShadingRateImagePaletteNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glShadingRateImagePaletteNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glShadingRateImagePaletteNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glShadingRateImagePaletteNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSHADINGRATEQCOMPROC function_ptr_glShadingRateQCOM;
+int exists_function_glShadingRateQCOM(void);
+PFNGLSHADINGRATEQCOMPROC get_function_ptr_glShadingRateQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateQCOM(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glShadingRateQCOM( argument_0) fastuidraw::gl_binding::debug_function__glShadingRateQCOM( argument_0, __FILE__, __LINE__, "glShadingRateQCOM("#argument_0")", #argument_0)
+#else
+#define glShadingRateQCOM( argument_0) fastuidraw::gl_binding::function_ptr_glShadingRateQCOM( argument_0)
+#endif
+
+extern PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC function_ptr_glShadingRateSampleOrderCustomNV;
+int exists_function_glShadingRateSampleOrderCustomNV(void);
+PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC get_function_ptr_glShadingRateSampleOrderCustomNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateSampleOrderCustomNV(GLenum  argument_0, GLuint  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glShadingRateSampleOrderCustomNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glShadingRateSampleOrderCustomNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glShadingRateSampleOrderCustomNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glShadingRateSampleOrderCustomNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glShadingRateSampleOrderCustomNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSHADINGRATESAMPLEORDERNVPROC function_ptr_glShadingRateSampleOrderNV;
+int exists_function_glShadingRateSampleOrderNV(void);
+PFNGLSHADINGRATESAMPLEORDERNVPROC get_function_ptr_glShadingRateSampleOrderNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glShadingRateSampleOrderNV(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glShadingRateSampleOrderNV( argument_0) fastuidraw::gl_binding::debug_function__glShadingRateSampleOrderNV( argument_0, __FILE__, __LINE__, "glShadingRateSampleOrderNV("#argument_0")", #argument_0)
+#else
+#define glShadingRateSampleOrderNV( argument_0) fastuidraw::gl_binding::function_ptr_glShadingRateSampleOrderNV( argument_0)
+#endif
+
+extern PFNGLSIGNALSEMAPHOREEXTPROC function_ptr_glSignalSemaphoreEXT;
+int exists_function_glSignalSemaphoreEXT(void);
+PFNGLSIGNALSEMAPHOREEXTPROC get_function_ptr_glSignalSemaphoreEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSignalSemaphoreEXT(GLuint  argument_0, GLuint  argument_1, const GLuint * argument_2, GLuint  argument_3, const GLuint * argument_4, const GLenum * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glSignalSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glSignalSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glSignalSemaphoreEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glSignalSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glSignalSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLSIGNALVKFENCENVPROC function_ptr_glSignalVkFenceNV;
+int exists_function_glSignalVkFenceNV(void);
+PFNGLSIGNALVKFENCENVPROC get_function_ptr_glSignalVkFenceNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSignalVkFenceNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glSignalVkFenceNV( argument_0) fastuidraw::gl_binding::debug_function__glSignalVkFenceNV( argument_0, __FILE__, __LINE__, "glSignalVkFenceNV("#argument_0")", #argument_0)
+#else
+#define glSignalVkFenceNV( argument_0) fastuidraw::gl_binding::function_ptr_glSignalVkFenceNV( argument_0)
+#endif
+
+extern PFNGLSIGNALVKSEMAPHORENVPROC function_ptr_glSignalVkSemaphoreNV;
+int exists_function_glSignalVkSemaphoreNV(void);
+PFNGLSIGNALVKSEMAPHORENVPROC get_function_ptr_glSignalVkSemaphoreNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSignalVkSemaphoreNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glSignalVkSemaphoreNV( argument_0) fastuidraw::gl_binding::debug_function__glSignalVkSemaphoreNV( argument_0, __FILE__, __LINE__, "glSignalVkSemaphoreNV("#argument_0")", #argument_0)
+#else
+#define glSignalVkSemaphoreNV( argument_0) fastuidraw::gl_binding::function_ptr_glSignalVkSemaphoreNV( argument_0)
+#endif
+
+extern PFNGLSTARTTILINGQCOMPROC function_ptr_glStartTilingQCOM;
+int exists_function_glStartTilingQCOM(void);
+PFNGLSTARTTILINGQCOMPROC get_function_ptr_glStartTilingQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStartTilingQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, GLbitfield  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glStartTilingQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glStartTilingQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glStartTilingQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glStartTilingQCOM( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glStartTilingQCOM( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLSTENCILFILLPATHINSTANCEDNVPROC function_ptr_glStencilFillPathInstancedNV;
+int exists_function_glStencilFillPathInstancedNV(void);
+PFNGLSTENCILFILLPATHINSTANCEDNVPROC get_function_ptr_glStencilFillPathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilFillPathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLenum  argument_4, GLuint  argument_5, GLenum  argument_6, const GLfloat * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glStencilFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glStencilFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glStencilFillPathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glStencilFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glStencilFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLSTENCILFILLPATHNVPROC function_ptr_glStencilFillPathNV;
+int exists_function_glStencilFillPathNV(void);
+PFNGLSTENCILFILLPATHNVPROC get_function_ptr_glStencilFillPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilFillPathNV(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glStencilFillPathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glStencilFillPathNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glStencilFillPathNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glStencilFillPathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glStencilFillPathNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSTENCILFUNCPROC function_ptr_glStencilFunc;
+int exists_function_glStencilFunc(void);
+PFNGLSTENCILFUNCPROC get_function_ptr_glStencilFunc(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilFunc(GLenum  argument_0, GLint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glStencilFunc( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glStencilFunc( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glStencilFunc("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glStencilFunc( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glStencilFunc( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSTENCILFUNCSEPARATEPROC function_ptr_glStencilFuncSeparate;
+int exists_function_glStencilFuncSeparate(void);
+PFNGLSTENCILFUNCSEPARATEPROC get_function_ptr_glStencilFuncSeparate(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilFuncSeparate(GLenum  argument_0, GLenum  argument_1, GLint  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glStencilFuncSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glStencilFuncSeparate( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glStencilFuncSeparate("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glStencilFuncSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glStencilFuncSeparate( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSTENCILMASKPROC function_ptr_glStencilMask;
+int exists_function_glStencilMask(void);
+PFNGLSTENCILMASKPROC get_function_ptr_glStencilMask(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilMask(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glStencilMask( argument_0) fastuidraw::gl_binding::debug_function__glStencilMask( argument_0, __FILE__, __LINE__, "glStencilMask("#argument_0")", #argument_0)
+#else
+#define glStencilMask( argument_0) fastuidraw::gl_binding::function_ptr_glStencilMask( argument_0)
+#endif
+
+extern PFNGLSTENCILMASKSEPARATEPROC function_ptr_glStencilMaskSeparate;
+int exists_function_glStencilMaskSeparate(void);
+PFNGLSTENCILMASKSEPARATEPROC get_function_ptr_glStencilMaskSeparate(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilMaskSeparate(GLenum  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glStencilMaskSeparate( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glStencilMaskSeparate( argument_0, argument_1, __FILE__, __LINE__, "glStencilMaskSeparate("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glStencilMaskSeparate( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glStencilMaskSeparate( argument_0, argument_1)
+#endif
+
+extern PFNGLSTENCILOPPROC function_ptr_glStencilOp;
+int exists_function_glStencilOp(void);
+PFNGLSTENCILOPPROC get_function_ptr_glStencilOp(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilOp(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glStencilOp( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glStencilOp( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glStencilOp("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glStencilOp( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glStencilOp( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSTENCILOPSEPARATEPROC function_ptr_glStencilOpSeparate;
+int exists_function_glStencilOpSeparate(void);
+PFNGLSTENCILOPSEPARATEPROC get_function_ptr_glStencilOpSeparate(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilOpSeparate(GLenum  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glStencilOpSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glStencilOpSeparate( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glStencilOpSeparate("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glStencilOpSeparate( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glStencilOpSeparate( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC function_ptr_glStencilStrokePathInstancedNV;
+int exists_function_glStencilStrokePathInstancedNV(void);
+PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC get_function_ptr_glStencilStrokePathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilStrokePathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLint  argument_4, GLuint  argument_5, GLenum  argument_6, const GLfloat * argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glStencilStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glStencilStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glStencilStrokePathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glStencilStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glStencilStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLSTENCILSTROKEPATHNVPROC function_ptr_glStencilStrokePathNV;
+int exists_function_glStencilStrokePathNV(void);
+PFNGLSTENCILSTROKEPATHNVPROC get_function_ptr_glStencilStrokePathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilStrokePathNV(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glStencilStrokePathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glStencilStrokePathNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glStencilStrokePathNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glStencilStrokePathNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glStencilStrokePathNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC function_ptr_glStencilThenCoverFillPathInstancedNV;
+int exists_function_glStencilThenCoverFillPathInstancedNV(void);
+PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC get_function_ptr_glStencilThenCoverFillPathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilThenCoverFillPathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLenum  argument_4, GLuint  argument_5, GLenum  argument_6, GLenum  argument_7, const GLfloat * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glStencilThenCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glStencilThenCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glStencilThenCoverFillPathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glStencilThenCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glStencilThenCoverFillPathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLSTENCILTHENCOVERFILLPATHNVPROC function_ptr_glStencilThenCoverFillPathNV;
+int exists_function_glStencilThenCoverFillPathNV(void);
+PFNGLSTENCILTHENCOVERFILLPATHNVPROC get_function_ptr_glStencilThenCoverFillPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilThenCoverFillPathNV(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glStencilThenCoverFillPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glStencilThenCoverFillPathNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glStencilThenCoverFillPathNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glStencilThenCoverFillPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glStencilThenCoverFillPathNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC function_ptr_glStencilThenCoverStrokePathInstancedNV;
+int exists_function_glStencilThenCoverStrokePathInstancedNV(void);
+PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC get_function_ptr_glStencilThenCoverStrokePathInstancedNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilThenCoverStrokePathInstancedNV(GLsizei  argument_0, GLenum  argument_1, const void * argument_2, GLuint  argument_3, GLint  argument_4, GLuint  argument_5, GLenum  argument_6, GLenum  argument_7, const GLfloat * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glStencilThenCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glStencilThenCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glStencilThenCoverStrokePathInstancedNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glStencilThenCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glStencilThenCoverStrokePathInstancedNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC function_ptr_glStencilThenCoverStrokePathNV;
+int exists_function_glStencilThenCoverStrokePathNV(void);
+PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC get_function_ptr_glStencilThenCoverStrokePathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glStencilThenCoverStrokePathNV(GLuint  argument_0, GLint  argument_1, GLuint  argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glStencilThenCoverStrokePathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glStencilThenCoverStrokePathNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glStencilThenCoverStrokePathNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glStencilThenCoverStrokePathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glStencilThenCoverStrokePathNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLSUBPIXELPRECISIONBIASNVPROC function_ptr_glSubpixelPrecisionBiasNV;
+int exists_function_glSubpixelPrecisionBiasNV(void);
+PFNGLSUBPIXELPRECISIONBIASNVPROC get_function_ptr_glSubpixelPrecisionBiasNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glSubpixelPrecisionBiasNV(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glSubpixelPrecisionBiasNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glSubpixelPrecisionBiasNV( argument_0, argument_1, __FILE__, __LINE__, "glSubpixelPrecisionBiasNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glSubpixelPrecisionBiasNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glSubpixelPrecisionBiasNV( argument_0, argument_1)
+#endif
+
+extern PFNGLTESTFENCENVPROC function_ptr_glTestFenceNV;
+int exists_function_glTestFenceNV(void);
+PFNGLTESTFENCENVPROC get_function_ptr_glTestFenceNV(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glTestFenceNV(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glTestFenceNV( argument_0) fastuidraw::gl_binding::debug_function__glTestFenceNV( argument_0, __FILE__, __LINE__, "glTestFenceNV("#argument_0")", #argument_0)
+#else
+#define glTestFenceNV( argument_0) fastuidraw::gl_binding::function_ptr_glTestFenceNV( argument_0)
+#endif
+
+extern PFNGLTEXATTACHMEMORYNVPROC function_ptr_glTexAttachMemoryNV;
+int exists_function_glTexAttachMemoryNV(void);
+PFNGLTEXATTACHMEMORYNVPROC get_function_ptr_glTexAttachMemoryNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexAttachMemoryNV(GLenum  argument_0, GLuint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexAttachMemoryNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexAttachMemoryNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexAttachMemoryNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXBUFFERPROC function_ptr_glTexBuffer;
+int exists_function_glTexBuffer(void);
+PFNGLTEXBUFFERPROC get_function_ptr_glTexBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBuffer(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexBuffer( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexBuffer( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexBuffer("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexBuffer( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexBuffer( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXBUFFEREXTPROC function_ptr_glTexBufferEXT;
+int exists_function_glTexBufferEXT(void);
+PFNGLTEXBUFFEREXTPROC get_function_ptr_glTexBufferEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBufferEXT(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexBufferEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexBufferEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexBufferEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexBufferEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexBufferEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXBUFFEROESPROC function_ptr_glTexBufferOES;
+int exists_function_glTexBufferOES(void);
+PFNGLTEXBUFFEROESPROC get_function_ptr_glTexBufferOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBufferOES(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexBufferOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexBufferOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexBufferOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexBufferOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexBufferOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXBUFFERRANGEPROC function_ptr_glTexBufferRange;
+int exists_function_glTexBufferRange(void);
+PFNGLTEXBUFFERRANGEPROC get_function_ptr_glTexBufferRange(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBufferRange(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTexBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTexBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTexBufferRange("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTexBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTexBufferRange( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXBUFFERRANGEEXTPROC function_ptr_glTexBufferRangeEXT;
+int exists_function_glTexBufferRangeEXT(void);
+PFNGLTEXBUFFERRANGEEXTPROC get_function_ptr_glTexBufferRangeEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBufferRangeEXT(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTexBufferRangeEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTexBufferRangeEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTexBufferRangeEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTexBufferRangeEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTexBufferRangeEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXBUFFERRANGEOESPROC function_ptr_glTexBufferRangeOES;
+int exists_function_glTexBufferRangeOES(void);
+PFNGLTEXBUFFERRANGEOESPROC get_function_ptr_glTexBufferRangeOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexBufferRangeOES(GLenum  argument_0, GLenum  argument_1, GLuint  argument_2, GLintptr  argument_3, GLsizeiptr  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTexBufferRangeOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTexBufferRangeOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTexBufferRangeOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTexBufferRangeOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTexBufferRangeOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXESTIMATEMOTIONQCOMPROC function_ptr_glTexEstimateMotionQCOM;
+int exists_function_glTexEstimateMotionQCOM(void);
+PFNGLTEXESTIMATEMOTIONQCOMPROC get_function_ptr_glTexEstimateMotionQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexEstimateMotionQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexEstimateMotionQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexEstimateMotionQCOM( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexEstimateMotionQCOM("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexEstimateMotionQCOM( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexEstimateMotionQCOM( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXESTIMATEMOTIONREGIONSQCOMPROC function_ptr_glTexEstimateMotionRegionsQCOM;
+int exists_function_glTexEstimateMotionRegionsQCOM(void);
+PFNGLTEXESTIMATEMOTIONREGIONSQCOMPROC get_function_ptr_glTexEstimateMotionRegionsQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexEstimateMotionRegionsQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glTexEstimateMotionRegionsQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glTexEstimateMotionRegionsQCOM( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glTexEstimateMotionRegionsQCOM("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glTexEstimateMotionRegionsQCOM( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glTexEstimateMotionRegionsQCOM( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLTEXIMAGE2DPROC function_ptr_glTexImage2D;
+int exists_function_glTexImage2D(void);
+PFNGLTEXIMAGE2DPROC get_function_ptr_glTexImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexImage2D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLint  argument_5, GLenum  argument_6, GLenum  argument_7, const void * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glTexImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glTexImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLTEXIMAGE3DPROC function_ptr_glTexImage3D;
+int exists_function_glTexImage3D(void);
+PFNGLTEXIMAGE3DPROC get_function_ptr_glTexImage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexImage3D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLint  argument_6, GLenum  argument_7, GLenum  argument_8, const void * argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glTexImage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glTexImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLTEXIMAGE3DOESPROC function_ptr_glTexImage3DOES;
+int exists_function_glTexImage3DOES(void);
+PFNGLTEXIMAGE3DOESPROC get_function_ptr_glTexImage3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexImage3DOES(GLenum  argument_0, GLint  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLint  argument_6, GLenum  argument_7, GLenum  argument_8, const void * argument_9, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9);
+#define glTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::debug_function__glTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, __FILE__, __LINE__, "glTexImage3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9)
+#else
+#define glTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9) fastuidraw::gl_binding::function_ptr_glTexImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9)
+#endif
+
+extern PFNGLTEXPAGECOMMITMENTEXTPROC function_ptr_glTexPageCommitmentEXT;
+int exists_function_glTexPageCommitmentEXT(void);
+PFNGLTEXPAGECOMMITMENTEXTPROC get_function_ptr_glTexPageCommitmentEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexPageCommitmentEXT(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLboolean  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glTexPageCommitmentEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glTexPageCommitmentEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glTexPageCommitmentEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glTexPageCommitmentEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glTexPageCommitmentEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLTEXPAGECOMMITMENTMEMNVPROC function_ptr_glTexPageCommitmentMemNV;
+int exists_function_glTexPageCommitmentMemNV(void);
+PFNGLTEXPAGECOMMITMENTMEMNVPROC get_function_ptr_glTexPageCommitmentMemNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexPageCommitmentMemNV(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLsizei  argument_8, GLuint  argument_9, GLuint64  argument_10, GLboolean  argument_11, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10, const char *argumentName_11);
+#define glTexPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11) fastuidraw::gl_binding::debug_function__glTexPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, __FILE__, __LINE__, "glTexPageCommitmentMemNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10","#argument_11")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10, #argument_11)
+#else
+#define glTexPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11) fastuidraw::gl_binding::function_ptr_glTexPageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11)
+#endif
+
+extern PFNGLTEXPARAMETERIIVPROC function_ptr_glTexParameterIiv;
+int exists_function_glTexParameterIiv(void);
+PFNGLTEXPARAMETERIIVPROC get_function_ptr_glTexParameterIiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIiv(GLenum  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIIVEXTPROC function_ptr_glTexParameterIivEXT;
+int exists_function_glTexParameterIivEXT(void);
+PFNGLTEXPARAMETERIIVEXTPROC get_function_ptr_glTexParameterIivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIivEXT(GLenum  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIIVOESPROC function_ptr_glTexParameterIivOES;
+int exists_function_glTexParameterIivOES(void);
+PFNGLTEXPARAMETERIIVOESPROC get_function_ptr_glTexParameterIivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIivOES(GLenum  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIUIVPROC function_ptr_glTexParameterIuiv;
+int exists_function_glTexParameterIuiv(void);
+PFNGLTEXPARAMETERIUIVPROC get_function_ptr_glTexParameterIuiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIuiv(GLenum  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIuiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIuiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIuiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIuiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIUIVEXTPROC function_ptr_glTexParameterIuivEXT;
+int exists_function_glTexParameterIuivEXT(void);
+PFNGLTEXPARAMETERIUIVEXTPROC get_function_ptr_glTexParameterIuivEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIuivEXT(GLenum  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIuivEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIuivEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIuivEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIuivEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIUIVOESPROC function_ptr_glTexParameterIuivOES;
+int exists_function_glTexParameterIuivOES(void);
+PFNGLTEXPARAMETERIUIVOESPROC get_function_ptr_glTexParameterIuivOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterIuivOES(GLenum  argument_0, GLenum  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterIuivOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterIuivOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterIuivOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterIuivOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERFPROC function_ptr_glTexParameterf;
+int exists_function_glTexParameterf(void);
+PFNGLTEXPARAMETERFPROC get_function_ptr_glTexParameterf(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterf(GLenum  argument_0, GLenum  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterf( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterf( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterf("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterf( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterf( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERFVPROC function_ptr_glTexParameterfv;
+int exists_function_glTexParameterfv(void);
+PFNGLTEXPARAMETERFVPROC get_function_ptr_glTexParameterfv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameterfv(GLenum  argument_0, GLenum  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameterfv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameterfv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameterfv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameterfv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIPROC function_ptr_glTexParameteri;
+int exists_function_glTexParameteri(void);
+PFNGLTEXPARAMETERIPROC get_function_ptr_glTexParameteri(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameteri(GLenum  argument_0, GLenum  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameteri( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameteri("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameteri( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameteri( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXPARAMETERIVPROC function_ptr_glTexParameteriv;
+int exists_function_glTexParameteriv(void);
+PFNGLTEXPARAMETERIVPROC get_function_ptr_glTexParameteriv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexParameteriv(GLenum  argument_0, GLenum  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTexParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTexParameteriv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTexParameteriv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTexParameteriv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTexParameteriv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXSTORAGE1DEXTPROC function_ptr_glTexStorage1DEXT;
+int exists_function_glTexStorage1DEXT(void);
+PFNGLTEXSTORAGE1DEXTPROC get_function_ptr_glTexStorage1DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage1DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glTexStorage1DEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glTexStorage1DEXT( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glTexStorage1DEXT("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glTexStorage1DEXT( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glTexStorage1DEXT( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLTEXSTORAGE2DPROC function_ptr_glTexStorage2D;
+int exists_function_glTexStorage2D(void);
+PFNGLTEXSTORAGE2DPROC get_function_ptr_glTexStorage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage2D(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTexStorage2D( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTexStorage2D( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTexStorage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTexStorage2D( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTexStorage2D( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXSTORAGE2DEXTPROC function_ptr_glTexStorage2DEXT;
+int exists_function_glTexStorage2DEXT(void);
+PFNGLTEXSTORAGE2DEXTPROC get_function_ptr_glTexStorage2DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage2DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTexStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTexStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTexStorage2DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTexStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTexStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC function_ptr_glTexStorage2DMultisample;
+int exists_function_glTexStorage2DMultisample(void);
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC get_function_ptr_glTexStorage2DMultisample(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage2DMultisample(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLboolean  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glTexStorage2DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glTexStorage2DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glTexStorage2DMultisample("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glTexStorage2DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glTexStorage2DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLTEXSTORAGE3DPROC function_ptr_glTexStorage3D;
+int exists_function_glTexStorage3D(void);
+PFNGLTEXSTORAGE3DPROC get_function_ptr_glTexStorage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage3D(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glTexStorage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glTexStorage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glTexStorage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glTexStorage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glTexStorage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLTEXSTORAGE3DEXTPROC function_ptr_glTexStorage3DEXT;
+int exists_function_glTexStorage3DEXT(void);
+PFNGLTEXSTORAGE3DEXTPROC get_function_ptr_glTexStorage3DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage3DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glTexStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glTexStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glTexStorage3DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glTexStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glTexStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC function_ptr_glTexStorage3DMultisample;
+int exists_function_glTexStorage3DMultisample(void);
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC get_function_ptr_glTexStorage3DMultisample(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage3DMultisample(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLboolean  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTexStorage3DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTexStorage3DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTexStorage3DMultisample("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTexStorage3DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTexStorage3DMultisample( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC function_ptr_glTexStorage3DMultisampleOES;
+int exists_function_glTexStorage3DMultisampleOES(void);
+PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC get_function_ptr_glTexStorage3DMultisampleOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorage3DMultisampleOES(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLboolean  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTexStorage3DMultisampleOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTexStorage3DMultisampleOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTexStorage3DMultisampleOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTexStorage3DMultisampleOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTexStorage3DMultisampleOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXSTORAGEATTRIBS2DEXTPROC function_ptr_glTexStorageAttribs2DEXT;
+int exists_function_glTexStorageAttribs2DEXT(void);
+PFNGLTEXSTORAGEATTRIBS2DEXTPROC get_function_ptr_glTexStorageAttribs2DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageAttribs2DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, const GLint*  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glTexStorageAttribs2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glTexStorageAttribs2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glTexStorageAttribs2DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glTexStorageAttribs2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glTexStorageAttribs2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLTEXSTORAGEATTRIBS3DEXTPROC function_ptr_glTexStorageAttribs3DEXT;
+int exists_function_glTexStorageAttribs3DEXT(void);
+PFNGLTEXSTORAGEATTRIBS3DEXTPROC get_function_ptr_glTexStorageAttribs3DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageAttribs3DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, const GLint*  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTexStorageAttribs3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTexStorageAttribs3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTexStorageAttribs3DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTexStorageAttribs3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTexStorageAttribs3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXSTORAGEMEM2DEXTPROC function_ptr_glTexStorageMem2DEXT;
+int exists_function_glTexStorageMem2DEXT(void);
+PFNGLTEXSTORAGEMEM2DEXTPROC get_function_ptr_glTexStorageMem2DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageMem2DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLuint  argument_5, GLuint64  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTexStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTexStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTexStorageMem2DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTexStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTexStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC function_ptr_glTexStorageMem2DMultisampleEXT;
+int exists_function_glTexStorageMem2DMultisampleEXT(void);
+PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC get_function_ptr_glTexStorageMem2DMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageMem2DMultisampleEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLboolean  argument_5, GLuint  argument_6, GLuint64  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTexStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTexStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTexStorageMem2DMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTexStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTexStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXSTORAGEMEM3DEXTPROC function_ptr_glTexStorageMem3DEXT;
+int exists_function_glTexStorageMem3DEXT(void);
+PFNGLTEXSTORAGEMEM3DEXTPROC get_function_ptr_glTexStorageMem3DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageMem3DEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLuint  argument_6, GLuint64  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTexStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTexStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTexStorageMem3DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTexStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTexStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC function_ptr_glTexStorageMem3DMultisampleEXT;
+int exists_function_glTexStorageMem3DMultisampleEXT(void);
+PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC get_function_ptr_glTexStorageMem3DMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexStorageMem3DMultisampleEXT(GLenum  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLboolean  argument_6, GLuint  argument_7, GLuint64  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glTexStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glTexStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glTexStorageMem3DMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glTexStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glTexStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLTEXSUBIMAGE2DPROC function_ptr_glTexSubImage2D;
+int exists_function_glTexSubImage2D(void);
+PFNGLTEXSUBIMAGE2DPROC get_function_ptr_glTexSubImage2D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexSubImage2D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLenum  argument_6, GLenum  argument_7, const void * argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glTexSubImage2D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glTexSubImage2D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLTEXSUBIMAGE3DPROC function_ptr_glTexSubImage3D;
+int exists_function_glTexSubImage3D(void);
+PFNGLTEXSUBIMAGE3DPROC get_function_ptr_glTexSubImage3D(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexSubImage3D(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLenum  argument_9, const void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glTexSubImage3D("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glTexSubImage3D( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLTEXSUBIMAGE3DOESPROC function_ptr_glTexSubImage3DOES;
+int exists_function_glTexSubImage3DOES(void);
+PFNGLTEXSUBIMAGE3DOESPROC get_function_ptr_glTexSubImage3DOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexSubImage3DOES(GLenum  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLsizei  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLenum  argument_8, GLenum  argument_9, const void * argument_10, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10);
+#define glTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::debug_function__glTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, __FILE__, __LINE__, "glTexSubImage3DOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10)
+#else
+#define glTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10) fastuidraw::gl_binding::function_ptr_glTexSubImage3DOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10)
+#endif
+
+extern PFNGLTEXTUREATTACHMEMORYNVPROC function_ptr_glTextureAttachMemoryNV;
+int exists_function_glTextureAttachMemoryNV(void);
+PFNGLTEXTUREATTACHMEMORYNVPROC get_function_ptr_glTextureAttachMemoryNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureAttachMemoryNV(GLuint  argument_0, GLuint  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glTextureAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glTextureAttachMemoryNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glTextureAttachMemoryNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glTextureAttachMemoryNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glTextureAttachMemoryNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLTEXTUREFOVEATIONPARAMETERSQCOMPROC function_ptr_glTextureFoveationParametersQCOM;
+int exists_function_glTextureFoveationParametersQCOM(void);
+PFNGLTEXTUREFOVEATIONPARAMETERSQCOMPROC get_function_ptr_glTextureFoveationParametersQCOM(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureFoveationParametersQCOM(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLfloat  argument_3, GLfloat  argument_4, GLfloat  argument_5, GLfloat  argument_6, GLfloat  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTextureFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTextureFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTextureFoveationParametersQCOM("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTextureFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTextureFoveationParametersQCOM( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXTUREPAGECOMMITMENTMEMNVPROC function_ptr_glTexturePageCommitmentMemNV;
+int exists_function_glTexturePageCommitmentMemNV(void);
+PFNGLTEXTUREPAGECOMMITMENTMEMNVPROC get_function_ptr_glTexturePageCommitmentMemNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTexturePageCommitmentMemNV(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, GLint  argument_5, GLsizei  argument_6, GLsizei  argument_7, GLsizei  argument_8, GLuint  argument_9, GLuint64  argument_10, GLboolean  argument_11, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8, const char *argumentName_9, const char *argumentName_10, const char *argumentName_11);
+#define glTexturePageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11) fastuidraw::gl_binding::debug_function__glTexturePageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11, __FILE__, __LINE__, "glTexturePageCommitmentMemNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8","#argument_9","#argument_10","#argument_11")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8, #argument_9, #argument_10, #argument_11)
+#else
+#define glTexturePageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11) fastuidraw::gl_binding::function_ptr_glTexturePageCommitmentMemNV( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, argument_9, argument_10, argument_11)
+#endif
+
+extern PFNGLTEXTURESTORAGE1DEXTPROC function_ptr_glTextureStorage1DEXT;
+int exists_function_glTextureStorage1DEXT(void);
+PFNGLTEXTURESTORAGE1DEXTPROC get_function_ptr_glTextureStorage1DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorage1DEXT(GLuint  argument_0, GLenum  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glTextureStorage1DEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glTextureStorage1DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glTextureStorage1DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glTextureStorage1DEXT( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glTextureStorage1DEXT( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLTEXTURESTORAGE2DEXTPROC function_ptr_glTextureStorage2DEXT;
+int exists_function_glTextureStorage2DEXT(void);
+PFNGLTEXTURESTORAGE2DEXTPROC get_function_ptr_glTextureStorage2DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorage2DEXT(GLuint  argument_0, GLenum  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, GLsizei  argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glTextureStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glTextureStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glTextureStorage2DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glTextureStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glTextureStorage2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLTEXTURESTORAGE3DEXTPROC function_ptr_glTextureStorage3DEXT;
+int exists_function_glTextureStorage3DEXT(void);
+PFNGLTEXTURESTORAGE3DEXTPROC get_function_ptr_glTextureStorage3DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorage3DEXT(GLuint  argument_0, GLenum  argument_1, GLsizei  argument_2, GLenum  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLsizei  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTextureStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTextureStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTextureStorage3DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTextureStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTextureStorage3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXTURESTORAGEMEM2DEXTPROC function_ptr_glTextureStorageMem2DEXT;
+int exists_function_glTextureStorageMem2DEXT(void);
+PFNGLTEXTURESTORAGEMEM2DEXTPROC get_function_ptr_glTextureStorageMem2DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorageMem2DEXT(GLuint  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLuint  argument_5, GLuint64  argument_6, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6);
+#define glTextureStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::debug_function__glTextureStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, __FILE__, __LINE__, "glTextureStorageMem2DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6)
+#else
+#define glTextureStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6) fastuidraw::gl_binding::function_ptr_glTextureStorageMem2DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6)
+#endif
+
+extern PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC function_ptr_glTextureStorageMem2DMultisampleEXT;
+int exists_function_glTextureStorageMem2DMultisampleEXT(void);
+PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC get_function_ptr_glTextureStorageMem2DMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorageMem2DMultisampleEXT(GLuint  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLboolean  argument_5, GLuint  argument_6, GLuint64  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTextureStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTextureStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTextureStorageMem2DMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTextureStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTextureStorageMem2DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXTURESTORAGEMEM3DEXTPROC function_ptr_glTextureStorageMem3DEXT;
+int exists_function_glTextureStorageMem3DEXT(void);
+PFNGLTEXTURESTORAGEMEM3DEXTPROC get_function_ptr_glTextureStorageMem3DEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorageMem3DEXT(GLuint  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLuint  argument_6, GLuint64  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTextureStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTextureStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTextureStorageMem3DEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTextureStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTextureStorageMem3DEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC function_ptr_glTextureStorageMem3DMultisampleEXT;
+int exists_function_glTextureStorageMem3DMultisampleEXT(void);
+PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC get_function_ptr_glTextureStorageMem3DMultisampleEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureStorageMem3DMultisampleEXT(GLuint  argument_0, GLsizei  argument_1, GLenum  argument_2, GLsizei  argument_3, GLsizei  argument_4, GLsizei  argument_5, GLboolean  argument_6, GLuint  argument_7, GLuint64  argument_8, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7, const char *argumentName_8);
+#define glTextureStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::debug_function__glTextureStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8, __FILE__, __LINE__, "glTextureStorageMem3DMultisampleEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7","#argument_8")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7, #argument_8)
+#else
+#define glTextureStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8) fastuidraw::gl_binding::function_ptr_glTextureStorageMem3DMultisampleEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, argument_8)
+#endif
+
+extern PFNGLTEXTUREVIEWEXTPROC function_ptr_glTextureViewEXT;
+int exists_function_glTextureViewEXT(void);
+PFNGLTEXTUREVIEWEXTPROC get_function_ptr_glTextureViewEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureViewEXT(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLenum  argument_3, GLuint  argument_4, GLuint  argument_5, GLuint  argument_6, GLuint  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTextureViewEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTextureViewEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTextureViewEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTextureViewEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTextureViewEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTEXTUREVIEWOESPROC function_ptr_glTextureViewOES;
+int exists_function_glTextureViewOES(void);
+PFNGLTEXTUREVIEWOESPROC get_function_ptr_glTextureViewOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTextureViewOES(GLuint  argument_0, GLenum  argument_1, GLuint  argument_2, GLenum  argument_3, GLuint  argument_4, GLuint  argument_5, GLuint  argument_6, GLuint  argument_7, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5, const char *argumentName_6, const char *argumentName_7);
+#define glTextureViewOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::debug_function__glTextureViewOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7, __FILE__, __LINE__, "glTextureViewOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5","#argument_6","#argument_7")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5, #argument_6, #argument_7)
+#else
+#define glTextureViewOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7) fastuidraw::gl_binding::function_ptr_glTextureViewOES( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, argument_6, argument_7)
+#endif
+
+extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC function_ptr_glTransformFeedbackVaryings;
+int exists_function_glTransformFeedbackVaryings(void);
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC get_function_ptr_glTransformFeedbackVaryings(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTransformFeedbackVaryings(GLuint  argument_0, GLsizei  argument_1, const GLchar *const* argument_2, GLenum  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glTransformFeedbackVaryings( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glTransformFeedbackVaryings( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glTransformFeedbackVaryings("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glTransformFeedbackVaryings( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glTransformFeedbackVaryings( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLTRANSFORMPATHNVPROC function_ptr_glTransformPathNV;
+int exists_function_glTransformPathNV(void);
+PFNGLTRANSFORMPATHNVPROC get_function_ptr_glTransformPathNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glTransformPathNV(GLuint  argument_0, GLuint  argument_1, GLenum  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glTransformPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glTransformPathNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glTransformPathNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glTransformPathNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glTransformPathNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM1FPROC function_ptr_glUniform1f;
+int exists_function_glUniform1f(void);
+PFNGLUNIFORM1FPROC get_function_ptr_glUniform1f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1f(GLint  argument_0, GLfloat  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniform1f( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniform1f( argument_0, argument_1, __FILE__, __LINE__, "glUniform1f("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniform1f( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniform1f( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORM1FVPROC function_ptr_glUniform1fv;
+int exists_function_glUniform1fv(void);
+PFNGLUNIFORM1FVPROC get_function_ptr_glUniform1fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1fv(GLint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform1fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform1fv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform1fv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform1fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform1fv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM1IPROC function_ptr_glUniform1i;
+int exists_function_glUniform1i(void);
+PFNGLUNIFORM1IPROC get_function_ptr_glUniform1i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1i(GLint  argument_0, GLint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniform1i( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniform1i( argument_0, argument_1, __FILE__, __LINE__, "glUniform1i("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniform1i( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniform1i( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORM1I64NVPROC function_ptr_glUniform1i64NV;
+int exists_function_glUniform1i64NV(void);
+PFNGLUNIFORM1I64NVPROC get_function_ptr_glUniform1i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1i64NV(GLint  argument_0, GLint64EXT  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniform1i64NV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniform1i64NV( argument_0, argument_1, __FILE__, __LINE__, "glUniform1i64NV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniform1i64NV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniform1i64NV( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORM1I64VNVPROC function_ptr_glUniform1i64vNV;
+int exists_function_glUniform1i64vNV(void);
+PFNGLUNIFORM1I64VNVPROC get_function_ptr_glUniform1i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1i64vNV(GLint  argument_0, GLsizei  argument_1, const GLint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform1i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform1i64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform1i64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform1i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform1i64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM1IVPROC function_ptr_glUniform1iv;
+int exists_function_glUniform1iv(void);
+PFNGLUNIFORM1IVPROC get_function_ptr_glUniform1iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1iv(GLint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform1iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform1iv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform1iv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform1iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform1iv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM1UIPROC function_ptr_glUniform1ui;
+int exists_function_glUniform1ui(void);
+PFNGLUNIFORM1UIPROC get_function_ptr_glUniform1ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1ui(GLint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniform1ui( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniform1ui( argument_0, argument_1, __FILE__, __LINE__, "glUniform1ui("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniform1ui( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniform1ui( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORM1UI64NVPROC function_ptr_glUniform1ui64NV;
+int exists_function_glUniform1ui64NV(void);
+PFNGLUNIFORM1UI64NVPROC get_function_ptr_glUniform1ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1ui64NV(GLint  argument_0, GLuint64EXT  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniform1ui64NV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniform1ui64NV( argument_0, argument_1, __FILE__, __LINE__, "glUniform1ui64NV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniform1ui64NV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniform1ui64NV( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORM1UI64VNVPROC function_ptr_glUniform1ui64vNV;
+int exists_function_glUniform1ui64vNV(void);
+PFNGLUNIFORM1UI64VNVPROC get_function_ptr_glUniform1ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1ui64vNV(GLint  argument_0, GLsizei  argument_1, const GLuint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform1ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform1ui64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform1ui64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform1ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform1ui64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM1UIVPROC function_ptr_glUniform1uiv;
+int exists_function_glUniform1uiv(void);
+PFNGLUNIFORM1UIVPROC get_function_ptr_glUniform1uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform1uiv(GLint  argument_0, GLsizei  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform1uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform1uiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform1uiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform1uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform1uiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2FPROC function_ptr_glUniform2f;
+int exists_function_glUniform2f(void);
+PFNGLUNIFORM2FPROC get_function_ptr_glUniform2f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2f(GLint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2f( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2f("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2f( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2FVPROC function_ptr_glUniform2fv;
+int exists_function_glUniform2fv(void);
+PFNGLUNIFORM2FVPROC get_function_ptr_glUniform2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2fv(GLint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2fv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2fv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2fv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2IPROC function_ptr_glUniform2i;
+int exists_function_glUniform2i(void);
+PFNGLUNIFORM2IPROC get_function_ptr_glUniform2i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2i(GLint  argument_0, GLint  argument_1, GLint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2i( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2i( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2i("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2i( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2i( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2I64NVPROC function_ptr_glUniform2i64NV;
+int exists_function_glUniform2i64NV(void);
+PFNGLUNIFORM2I64NVPROC get_function_ptr_glUniform2i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2i64NV(GLint  argument_0, GLint64EXT  argument_1, GLint64EXT  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2i64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2i64NV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2i64NV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2i64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2i64NV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2I64VNVPROC function_ptr_glUniform2i64vNV;
+int exists_function_glUniform2i64vNV(void);
+PFNGLUNIFORM2I64VNVPROC get_function_ptr_glUniform2i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2i64vNV(GLint  argument_0, GLsizei  argument_1, const GLint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2i64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2i64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2i64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2IVPROC function_ptr_glUniform2iv;
+int exists_function_glUniform2iv(void);
+PFNGLUNIFORM2IVPROC get_function_ptr_glUniform2iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2iv(GLint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2iv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2iv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2iv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2UIPROC function_ptr_glUniform2ui;
+int exists_function_glUniform2ui(void);
+PFNGLUNIFORM2UIPROC get_function_ptr_glUniform2ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2ui(GLint  argument_0, GLuint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2ui( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2ui( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2ui("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2ui( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2ui( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2UI64NVPROC function_ptr_glUniform2ui64NV;
+int exists_function_glUniform2ui64NV(void);
+PFNGLUNIFORM2UI64NVPROC get_function_ptr_glUniform2ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2ui64NV(GLint  argument_0, GLuint64EXT  argument_1, GLuint64EXT  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2ui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2ui64NV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2ui64NV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2ui64NV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2ui64NV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2UI64VNVPROC function_ptr_glUniform2ui64vNV;
+int exists_function_glUniform2ui64vNV(void);
+PFNGLUNIFORM2UI64VNVPROC get_function_ptr_glUniform2ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2ui64vNV(GLint  argument_0, GLsizei  argument_1, const GLuint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2ui64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2ui64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2ui64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM2UIVPROC function_ptr_glUniform2uiv;
+int exists_function_glUniform2uiv(void);
+PFNGLUNIFORM2UIVPROC get_function_ptr_glUniform2uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform2uiv(GLint  argument_0, GLsizei  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform2uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform2uiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform2uiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform2uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform2uiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM3FPROC function_ptr_glUniform3f;
+int exists_function_glUniform3f(void);
+PFNGLUNIFORM3FPROC get_function_ptr_glUniform3f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3f(GLint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniform3f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniform3f( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniform3f("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniform3f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniform3f( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM3FVPROC function_ptr_glUniform3fv;
+int exists_function_glUniform3fv(void);
+PFNGLUNIFORM3FVPROC get_function_ptr_glUniform3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3fv(GLint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform3fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform3fv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform3fv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform3fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform3fv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM3IPROC function_ptr_glUniform3i;
+int exists_function_glUniform3i(void);
+PFNGLUNIFORM3IPROC get_function_ptr_glUniform3i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3i(GLint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniform3i( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniform3i( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniform3i("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniform3i( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniform3i( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM3I64NVPROC function_ptr_glUniform3i64NV;
+int exists_function_glUniform3i64NV(void);
+PFNGLUNIFORM3I64NVPROC get_function_ptr_glUniform3i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3i64NV(GLint  argument_0, GLint64EXT  argument_1, GLint64EXT  argument_2, GLint64EXT  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniform3i64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniform3i64NV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniform3i64NV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniform3i64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniform3i64NV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM3I64VNVPROC function_ptr_glUniform3i64vNV;
+int exists_function_glUniform3i64vNV(void);
+PFNGLUNIFORM3I64VNVPROC get_function_ptr_glUniform3i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3i64vNV(GLint  argument_0, GLsizei  argument_1, const GLint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform3i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform3i64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform3i64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform3i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform3i64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM3IVPROC function_ptr_glUniform3iv;
+int exists_function_glUniform3iv(void);
+PFNGLUNIFORM3IVPROC get_function_ptr_glUniform3iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3iv(GLint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform3iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform3iv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform3iv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform3iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform3iv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM3UIPROC function_ptr_glUniform3ui;
+int exists_function_glUniform3ui(void);
+PFNGLUNIFORM3UIPROC get_function_ptr_glUniform3ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3ui(GLint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniform3ui( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniform3ui( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniform3ui("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniform3ui( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniform3ui( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM3UI64NVPROC function_ptr_glUniform3ui64NV;
+int exists_function_glUniform3ui64NV(void);
+PFNGLUNIFORM3UI64NVPROC get_function_ptr_glUniform3ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3ui64NV(GLint  argument_0, GLuint64EXT  argument_1, GLuint64EXT  argument_2, GLuint64EXT  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniform3ui64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniform3ui64NV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniform3ui64NV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniform3ui64NV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniform3ui64NV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORM3UI64VNVPROC function_ptr_glUniform3ui64vNV;
+int exists_function_glUniform3ui64vNV(void);
+PFNGLUNIFORM3UI64VNVPROC get_function_ptr_glUniform3ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3ui64vNV(GLint  argument_0, GLsizei  argument_1, const GLuint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform3ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform3ui64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform3ui64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform3ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform3ui64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM3UIVPROC function_ptr_glUniform3uiv;
+int exists_function_glUniform3uiv(void);
+PFNGLUNIFORM3UIVPROC get_function_ptr_glUniform3uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform3uiv(GLint  argument_0, GLsizei  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform3uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform3uiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform3uiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform3uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform3uiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM4FPROC function_ptr_glUniform4f;
+int exists_function_glUniform4f(void);
+PFNGLUNIFORM4FPROC get_function_ptr_glUniform4f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4f(GLint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glUniform4f("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glUniform4f( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLUNIFORM4FVPROC function_ptr_glUniform4fv;
+int exists_function_glUniform4fv(void);
+PFNGLUNIFORM4FVPROC get_function_ptr_glUniform4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4fv(GLint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform4fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform4fv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform4fv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform4fv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform4fv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM4IPROC function_ptr_glUniform4i;
+int exists_function_glUniform4i(void);
+PFNGLUNIFORM4IPROC get_function_ptr_glUniform4i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4i(GLint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glUniform4i("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glUniform4i( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLUNIFORM4I64NVPROC function_ptr_glUniform4i64NV;
+int exists_function_glUniform4i64NV(void);
+PFNGLUNIFORM4I64NVPROC get_function_ptr_glUniform4i64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4i64NV(GLint  argument_0, GLint64EXT  argument_1, GLint64EXT  argument_2, GLint64EXT  argument_3, GLint64EXT  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glUniform4i64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glUniform4i64NV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLUNIFORM4I64VNVPROC function_ptr_glUniform4i64vNV;
+int exists_function_glUniform4i64vNV(void);
+PFNGLUNIFORM4I64VNVPROC get_function_ptr_glUniform4i64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4i64vNV(GLint  argument_0, GLsizei  argument_1, const GLint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform4i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform4i64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform4i64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform4i64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform4i64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM4IVPROC function_ptr_glUniform4iv;
+int exists_function_glUniform4iv(void);
+PFNGLUNIFORM4IVPROC get_function_ptr_glUniform4iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4iv(GLint  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform4iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform4iv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform4iv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform4iv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform4iv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM4UIPROC function_ptr_glUniform4ui;
+int exists_function_glUniform4ui(void);
+PFNGLUNIFORM4UIPROC get_function_ptr_glUniform4ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4ui(GLint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glUniform4ui("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glUniform4ui( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLUNIFORM4UI64NVPROC function_ptr_glUniform4ui64NV;
+int exists_function_glUniform4ui64NV(void);
+PFNGLUNIFORM4UI64NVPROC get_function_ptr_glUniform4ui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4ui64NV(GLint  argument_0, GLuint64EXT  argument_1, GLuint64EXT  argument_2, GLuint64EXT  argument_3, GLuint64EXT  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glUniform4ui64NV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glUniform4ui64NV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLUNIFORM4UI64VNVPROC function_ptr_glUniform4ui64vNV;
+int exists_function_glUniform4ui64vNV(void);
+PFNGLUNIFORM4UI64VNVPROC get_function_ptr_glUniform4ui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4ui64vNV(GLint  argument_0, GLsizei  argument_1, const GLuint64EXT * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform4ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform4ui64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform4ui64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform4ui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform4ui64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORM4UIVPROC function_ptr_glUniform4uiv;
+int exists_function_glUniform4uiv(void);
+PFNGLUNIFORM4UIVPROC get_function_ptr_glUniform4uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniform4uiv(GLint  argument_0, GLsizei  argument_1, const GLuint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniform4uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniform4uiv( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniform4uiv("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniform4uiv( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniform4uiv( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORMBLOCKBINDINGPROC function_ptr_glUniformBlockBinding;
+int exists_function_glUniformBlockBinding(void);
+PFNGLUNIFORMBLOCKBINDINGPROC get_function_ptr_glUniformBlockBinding(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformBlockBinding(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniformBlockBinding( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniformBlockBinding( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniformBlockBinding("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniformBlockBinding( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniformBlockBinding( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORMHANDLEUI64IMGPROC function_ptr_glUniformHandleui64IMG;
+int exists_function_glUniformHandleui64IMG(void);
+PFNGLUNIFORMHANDLEUI64IMGPROC get_function_ptr_glUniformHandleui64IMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformHandleui64IMG(GLint  argument_0, GLuint64  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniformHandleui64IMG( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniformHandleui64IMG( argument_0, argument_1, __FILE__, __LINE__, "glUniformHandleui64IMG("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniformHandleui64IMG( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniformHandleui64IMG( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORMHANDLEUI64NVPROC function_ptr_glUniformHandleui64NV;
+int exists_function_glUniformHandleui64NV(void);
+PFNGLUNIFORMHANDLEUI64NVPROC get_function_ptr_glUniformHandleui64NV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformHandleui64NV(GLint  argument_0, GLuint64  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glUniformHandleui64NV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glUniformHandleui64NV( argument_0, argument_1, __FILE__, __LINE__, "glUniformHandleui64NV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glUniformHandleui64NV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glUniformHandleui64NV( argument_0, argument_1)
+#endif
+
+extern PFNGLUNIFORMHANDLEUI64VIMGPROC function_ptr_glUniformHandleui64vIMG;
+int exists_function_glUniformHandleui64vIMG(void);
+PFNGLUNIFORMHANDLEUI64VIMGPROC get_function_ptr_glUniformHandleui64vIMG(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformHandleui64vIMG(GLint  argument_0, GLsizei  argument_1, const GLuint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniformHandleui64vIMG( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniformHandleui64vIMG( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniformHandleui64vIMG("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniformHandleui64vIMG( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniformHandleui64vIMG( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORMHANDLEUI64VNVPROC function_ptr_glUniformHandleui64vNV;
+int exists_function_glUniformHandleui64vNV(void);
+PFNGLUNIFORMHANDLEUI64VNVPROC get_function_ptr_glUniformHandleui64vNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformHandleui64vNV(GLint  argument_0, GLsizei  argument_1, const GLuint64 * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUniformHandleui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUniformHandleui64vNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUniformHandleui64vNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUniformHandleui64vNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUniformHandleui64vNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUNIFORMMATRIX2FVPROC function_ptr_glUniformMatrix2fv;
+int exists_function_glUniformMatrix2fv(void);
+PFNGLUNIFORMMATRIX2FVPROC get_function_ptr_glUniformMatrix2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix2fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix2fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix2fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX2X3FVPROC function_ptr_glUniformMatrix2x3fv;
+int exists_function_glUniformMatrix2x3fv(void);
+PFNGLUNIFORMMATRIX2X3FVPROC get_function_ptr_glUniformMatrix2x3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix2x3fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix2x3fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix2x3fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX2X3FVNVPROC function_ptr_glUniformMatrix2x3fvNV;
+int exists_function_glUniformMatrix2x3fvNV(void);
+PFNGLUNIFORMMATRIX2X3FVNVPROC get_function_ptr_glUniformMatrix2x3fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix2x3fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix2x3fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix2x3fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix2x3fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix2x3fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix2x3fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX2X4FVPROC function_ptr_glUniformMatrix2x4fv;
+int exists_function_glUniformMatrix2x4fv(void);
+PFNGLUNIFORMMATRIX2X4FVPROC get_function_ptr_glUniformMatrix2x4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix2x4fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix2x4fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix2x4fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX2X4FVNVPROC function_ptr_glUniformMatrix2x4fvNV;
+int exists_function_glUniformMatrix2x4fvNV(void);
+PFNGLUNIFORMMATRIX2X4FVNVPROC get_function_ptr_glUniformMatrix2x4fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix2x4fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix2x4fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix2x4fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix2x4fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix2x4fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix2x4fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX3FVPROC function_ptr_glUniformMatrix3fv;
+int exists_function_glUniformMatrix3fv(void);
+PFNGLUNIFORMMATRIX3FVPROC get_function_ptr_glUniformMatrix3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix3fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix3fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix3fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX3X2FVPROC function_ptr_glUniformMatrix3x2fv;
+int exists_function_glUniformMatrix3x2fv(void);
+PFNGLUNIFORMMATRIX3X2FVPROC get_function_ptr_glUniformMatrix3x2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix3x2fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix3x2fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix3x2fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX3X2FVNVPROC function_ptr_glUniformMatrix3x2fvNV;
+int exists_function_glUniformMatrix3x2fvNV(void);
+PFNGLUNIFORMMATRIX3X2FVNVPROC get_function_ptr_glUniformMatrix3x2fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix3x2fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix3x2fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix3x2fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix3x2fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix3x2fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix3x2fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX3X4FVPROC function_ptr_glUniformMatrix3x4fv;
+int exists_function_glUniformMatrix3x4fv(void);
+PFNGLUNIFORMMATRIX3X4FVPROC get_function_ptr_glUniformMatrix3x4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix3x4fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix3x4fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix3x4fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX3X4FVNVPROC function_ptr_glUniformMatrix3x4fvNV;
+int exists_function_glUniformMatrix3x4fvNV(void);
+PFNGLUNIFORMMATRIX3X4FVNVPROC get_function_ptr_glUniformMatrix3x4fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix3x4fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix3x4fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix3x4fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix3x4fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix3x4fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix3x4fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX4FVPROC function_ptr_glUniformMatrix4fv;
+int exists_function_glUniformMatrix4fv(void);
+PFNGLUNIFORMMATRIX4FVPROC get_function_ptr_glUniformMatrix4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix4fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix4fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix4fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX4X2FVPROC function_ptr_glUniformMatrix4x2fv;
+int exists_function_glUniformMatrix4x2fv(void);
+PFNGLUNIFORMMATRIX4X2FVPROC get_function_ptr_glUniformMatrix4x2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix4x2fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix4x2fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix4x2fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX4X2FVNVPROC function_ptr_glUniformMatrix4x2fvNV;
+int exists_function_glUniformMatrix4x2fvNV(void);
+PFNGLUNIFORMMATRIX4X2FVNVPROC get_function_ptr_glUniformMatrix4x2fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix4x2fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix4x2fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix4x2fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix4x2fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix4x2fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix4x2fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX4X3FVPROC function_ptr_glUniformMatrix4x3fv;
+int exists_function_glUniformMatrix4x3fv(void);
+PFNGLUNIFORMMATRIX4X3FVPROC get_function_ptr_glUniformMatrix4x3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix4x3fv(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix4x3fv("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix4x3fv( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNIFORMMATRIX4X3FVNVPROC function_ptr_glUniformMatrix4x3fvNV;
+int exists_function_glUniformMatrix4x3fvNV(void);
+PFNGLUNIFORMMATRIX4X3FVNVPROC get_function_ptr_glUniformMatrix4x3fvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUniformMatrix4x3fvNV(GLint  argument_0, GLsizei  argument_1, GLboolean  argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glUniformMatrix4x3fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glUniformMatrix4x3fvNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glUniformMatrix4x3fvNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glUniformMatrix4x3fvNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glUniformMatrix4x3fvNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLUNMAPBUFFERPROC function_ptr_glUnmapBuffer;
+int exists_function_glUnmapBuffer(void);
+PFNGLUNMAPBUFFERPROC get_function_ptr_glUnmapBuffer(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glUnmapBuffer(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glUnmapBuffer( argument_0) fastuidraw::gl_binding::debug_function__glUnmapBuffer( argument_0, __FILE__, __LINE__, "glUnmapBuffer("#argument_0")", #argument_0)
+#else
+#define glUnmapBuffer( argument_0) fastuidraw::gl_binding::function_ptr_glUnmapBuffer( argument_0)
+#endif
+
+extern PFNGLUNMAPBUFFEROESPROC function_ptr_glUnmapBufferOES;
+int exists_function_glUnmapBufferOES(void);
+PFNGLUNMAPBUFFEROESPROC get_function_ptr_glUnmapBufferOES(void);
+#ifdef FASTUIDRAW_DEBUG
+GLboolean debug_function__glUnmapBufferOES(GLenum  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glUnmapBufferOES( argument_0) fastuidraw::gl_binding::debug_function__glUnmapBufferOES( argument_0, __FILE__, __LINE__, "glUnmapBufferOES("#argument_0")", #argument_0)
+#else
+#define glUnmapBufferOES( argument_0) fastuidraw::gl_binding::function_ptr_glUnmapBufferOES( argument_0)
+#endif
+
+extern PFNGLUSEPROGRAMPROC function_ptr_glUseProgram;
+int exists_function_glUseProgram(void);
+PFNGLUSEPROGRAMPROC get_function_ptr_glUseProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUseProgram(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glUseProgram( argument_0) fastuidraw::gl_binding::debug_function__glUseProgram( argument_0, __FILE__, __LINE__, "glUseProgram("#argument_0")", #argument_0)
+#else
+#define glUseProgram( argument_0) fastuidraw::gl_binding::function_ptr_glUseProgram( argument_0)
+#endif
+
+extern PFNGLUSEPROGRAMSTAGESPROC function_ptr_glUseProgramStages;
+int exists_function_glUseProgramStages(void);
+PFNGLUSEPROGRAMSTAGESPROC get_function_ptr_glUseProgramStages(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUseProgramStages(GLuint  argument_0, GLbitfield  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUseProgramStages( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUseProgramStages( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUseProgramStages("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUseProgramStages( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUseProgramStages( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLUSEPROGRAMSTAGESEXTPROC function_ptr_glUseProgramStagesEXT;
+int exists_function_glUseProgramStagesEXT(void);
+PFNGLUSEPROGRAMSTAGESEXTPROC get_function_ptr_glUseProgramStagesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glUseProgramStagesEXT(GLuint  argument_0, GLbitfield  argument_1, GLuint  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glUseProgramStagesEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glUseProgramStagesEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glUseProgramStagesEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glUseProgramStagesEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glUseProgramStagesEXT( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLVALIDATEPROGRAMPROC function_ptr_glValidateProgram;
+int exists_function_glValidateProgram(void);
+PFNGLVALIDATEPROGRAMPROC get_function_ptr_glValidateProgram(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glValidateProgram(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glValidateProgram( argument_0) fastuidraw::gl_binding::debug_function__glValidateProgram( argument_0, __FILE__, __LINE__, "glValidateProgram("#argument_0")", #argument_0)
+#else
+#define glValidateProgram( argument_0) fastuidraw::gl_binding::function_ptr_glValidateProgram( argument_0)
+#endif
+
+extern PFNGLVALIDATEPROGRAMPIPELINEPROC function_ptr_glValidateProgramPipeline;
+int exists_function_glValidateProgramPipeline(void);
+PFNGLVALIDATEPROGRAMPIPELINEPROC get_function_ptr_glValidateProgramPipeline(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glValidateProgramPipeline(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glValidateProgramPipeline( argument_0) fastuidraw::gl_binding::debug_function__glValidateProgramPipeline( argument_0, __FILE__, __LINE__, "glValidateProgramPipeline("#argument_0")", #argument_0)
+#else
+#define glValidateProgramPipeline( argument_0) fastuidraw::gl_binding::function_ptr_glValidateProgramPipeline( argument_0)
+#endif
+
+extern PFNGLVALIDATEPROGRAMPIPELINEEXTPROC function_ptr_glValidateProgramPipelineEXT;
+int exists_function_glValidateProgramPipelineEXT(void);
+PFNGLVALIDATEPROGRAMPIPELINEEXTPROC get_function_ptr_glValidateProgramPipelineEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glValidateProgramPipelineEXT(GLuint  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glValidateProgramPipelineEXT( argument_0) fastuidraw::gl_binding::debug_function__glValidateProgramPipelineEXT( argument_0, __FILE__, __LINE__, "glValidateProgramPipelineEXT("#argument_0")", #argument_0)
+#else
+#define glValidateProgramPipelineEXT( argument_0) fastuidraw::gl_binding::function_ptr_glValidateProgramPipelineEXT( argument_0)
+#endif
+
+extern PFNGLVERTEXATTRIB1FPROC function_ptr_glVertexAttrib1f;
+int exists_function_glVertexAttrib1f(void);
+PFNGLVERTEXATTRIB1FPROC get_function_ptr_glVertexAttrib1f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib1f(GLuint  argument_0, GLfloat  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttrib1f( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttrib1f( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttrib1f("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttrib1f( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttrib1f( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIB1FVPROC function_ptr_glVertexAttrib1fv;
+int exists_function_glVertexAttrib1fv(void);
+PFNGLVERTEXATTRIB1FVPROC get_function_ptr_glVertexAttrib1fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib1fv(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttrib1fv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttrib1fv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttrib1fv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttrib1fv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttrib1fv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIB2FPROC function_ptr_glVertexAttrib2f;
+int exists_function_glVertexAttrib2f(void);
+PFNGLVERTEXATTRIB2FPROC get_function_ptr_glVertexAttrib2f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib2f(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glVertexAttrib2f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glVertexAttrib2f( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glVertexAttrib2f("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glVertexAttrib2f( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glVertexAttrib2f( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLVERTEXATTRIB2FVPROC function_ptr_glVertexAttrib2fv;
+int exists_function_glVertexAttrib2fv(void);
+PFNGLVERTEXATTRIB2FVPROC get_function_ptr_glVertexAttrib2fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib2fv(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttrib2fv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttrib2fv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttrib2fv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttrib2fv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttrib2fv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIB3FPROC function_ptr_glVertexAttrib3f;
+int exists_function_glVertexAttrib3f(void);
+PFNGLVERTEXATTRIB3FPROC get_function_ptr_glVertexAttrib3f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib3f(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glVertexAttrib3f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glVertexAttrib3f( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glVertexAttrib3f("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glVertexAttrib3f( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glVertexAttrib3f( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLVERTEXATTRIB3FVPROC function_ptr_glVertexAttrib3fv;
+int exists_function_glVertexAttrib3fv(void);
+PFNGLVERTEXATTRIB3FVPROC get_function_ptr_glVertexAttrib3fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib3fv(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttrib3fv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttrib3fv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttrib3fv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttrib3fv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttrib3fv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIB4FPROC function_ptr_glVertexAttrib4f;
+int exists_function_glVertexAttrib4f(void);
+PFNGLVERTEXATTRIB4FPROC get_function_ptr_glVertexAttrib4f(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib4f(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glVertexAttrib4f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glVertexAttrib4f( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glVertexAttrib4f("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glVertexAttrib4f( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glVertexAttrib4f( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVERTEXATTRIB4FVPROC function_ptr_glVertexAttrib4fv;
+int exists_function_glVertexAttrib4fv(void);
+PFNGLVERTEXATTRIB4FVPROC get_function_ptr_glVertexAttrib4fv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttrib4fv(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttrib4fv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttrib4fv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttrib4fv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttrib4fv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttrib4fv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBBINDINGPROC function_ptr_glVertexAttribBinding;
+int exists_function_glVertexAttribBinding(void);
+PFNGLVERTEXATTRIBBINDINGPROC get_function_ptr_glVertexAttribBinding(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribBinding(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribBinding( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribBinding( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribBinding("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribBinding( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribBinding( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBDIVISORPROC function_ptr_glVertexAttribDivisor;
+int exists_function_glVertexAttribDivisor(void);
+PFNGLVERTEXATTRIBDIVISORPROC get_function_ptr_glVertexAttribDivisor(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribDivisor(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribDivisor( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribDivisor( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribDivisor("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribDivisor( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribDivisor( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBDIVISORANGLEPROC function_ptr_glVertexAttribDivisorANGLE;
+int exists_function_glVertexAttribDivisorANGLE(void);
+PFNGLVERTEXATTRIBDIVISORANGLEPROC get_function_ptr_glVertexAttribDivisorANGLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribDivisorANGLE(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribDivisorANGLE( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribDivisorANGLE( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribDivisorANGLE("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribDivisorANGLE( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribDivisorANGLE( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBDIVISOREXTPROC function_ptr_glVertexAttribDivisorEXT;
+int exists_function_glVertexAttribDivisorEXT(void);
+PFNGLVERTEXATTRIBDIVISOREXTPROC get_function_ptr_glVertexAttribDivisorEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribDivisorEXT(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribDivisorEXT( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribDivisorEXT( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribDivisorEXT("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribDivisorEXT( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribDivisorEXT( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBDIVISORNVPROC function_ptr_glVertexAttribDivisorNV;
+int exists_function_glVertexAttribDivisorNV(void);
+PFNGLVERTEXATTRIBDIVISORNVPROC get_function_ptr_glVertexAttribDivisorNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribDivisorNV(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribDivisorNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribDivisorNV( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribDivisorNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribDivisorNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribDivisorNV( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBFORMATPROC function_ptr_glVertexAttribFormat;
+int exists_function_glVertexAttribFormat(void);
+PFNGLVERTEXATTRIBFORMATPROC get_function_ptr_glVertexAttribFormat(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribFormat(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLboolean  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glVertexAttribFormat( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glVertexAttribFormat( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glVertexAttribFormat("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glVertexAttribFormat( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glVertexAttribFormat( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVERTEXATTRIBI4IPROC function_ptr_glVertexAttribI4i;
+int exists_function_glVertexAttribI4i(void);
+PFNGLVERTEXATTRIBI4IPROC get_function_ptr_glVertexAttribI4i(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribI4i(GLuint  argument_0, GLint  argument_1, GLint  argument_2, GLint  argument_3, GLint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glVertexAttribI4i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glVertexAttribI4i( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glVertexAttribI4i("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glVertexAttribI4i( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glVertexAttribI4i( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVERTEXATTRIBI4IVPROC function_ptr_glVertexAttribI4iv;
+int exists_function_glVertexAttribI4iv(void);
+PFNGLVERTEXATTRIBI4IVPROC get_function_ptr_glVertexAttribI4iv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribI4iv(GLuint  argument_0, const GLint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribI4iv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribI4iv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribI4iv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribI4iv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribI4iv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBI4UIPROC function_ptr_glVertexAttribI4ui;
+int exists_function_glVertexAttribI4ui(void);
+PFNGLVERTEXATTRIBI4UIPROC get_function_ptr_glVertexAttribI4ui(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribI4ui(GLuint  argument_0, GLuint  argument_1, GLuint  argument_2, GLuint  argument_3, GLuint  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glVertexAttribI4ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glVertexAttribI4ui( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glVertexAttribI4ui("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glVertexAttribI4ui( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glVertexAttribI4ui( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVERTEXATTRIBI4UIVPROC function_ptr_glVertexAttribI4uiv;
+int exists_function_glVertexAttribI4uiv(void);
+PFNGLVERTEXATTRIBI4UIVPROC get_function_ptr_glVertexAttribI4uiv(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribI4uiv(GLuint  argument_0, const GLuint * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexAttribI4uiv( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexAttribI4uiv( argument_0, argument_1, __FILE__, __LINE__, "glVertexAttribI4uiv("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexAttribI4uiv( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexAttribI4uiv( argument_0, argument_1)
+#endif
+
+extern PFNGLVERTEXATTRIBIFORMATPROC function_ptr_glVertexAttribIFormat;
+int exists_function_glVertexAttribIFormat(void);
+PFNGLVERTEXATTRIBIFORMATPROC get_function_ptr_glVertexAttribIFormat(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribIFormat(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLuint  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glVertexAttribIFormat( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glVertexAttribIFormat( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glVertexAttribIFormat("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glVertexAttribIFormat( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glVertexAttribIFormat( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLVERTEXATTRIBIPOINTERPROC function_ptr_glVertexAttribIPointer;
+int exists_function_glVertexAttribIPointer(void);
+PFNGLVERTEXATTRIBIPOINTERPROC get_function_ptr_glVertexAttribIPointer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribIPointer(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLsizei  argument_3, const void * argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glVertexAttribIPointer( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glVertexAttribIPointer( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glVertexAttribIPointer("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glVertexAttribIPointer( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glVertexAttribIPointer( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVERTEXATTRIBPOINTERPROC function_ptr_glVertexAttribPointer;
+int exists_function_glVertexAttribPointer(void);
+PFNGLVERTEXATTRIBPOINTERPROC get_function_ptr_glVertexAttribPointer(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexAttribPointer(GLuint  argument_0, GLint  argument_1, GLenum  argument_2, GLboolean  argument_3, GLsizei  argument_4, const void * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glVertexAttribPointer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glVertexAttribPointer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glVertexAttribPointer("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glVertexAttribPointer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glVertexAttribPointer( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLVERTEXBINDINGDIVISORPROC function_ptr_glVertexBindingDivisor;
+int exists_function_glVertexBindingDivisor(void);
+PFNGLVERTEXBINDINGDIVISORPROC get_function_ptr_glVertexBindingDivisor(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glVertexBindingDivisor(GLuint  argument_0, GLuint  argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glVertexBindingDivisor( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glVertexBindingDivisor( argument_0, argument_1, __FILE__, __LINE__, "glVertexBindingDivisor("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glVertexBindingDivisor( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glVertexBindingDivisor( argument_0, argument_1)
+#endif
+
+extern PFNGLVIEWPORTPROC function_ptr_glViewport;
+int exists_function_glViewport(void);
+PFNGLVIEWPORTPROC get_function_ptr_glViewport(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewport(GLint  argument_0, GLint  argument_1, GLsizei  argument_2, GLsizei  argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glViewport( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glViewport( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glViewport("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glViewport( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glViewport( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLVIEWPORTARRAYVNVPROC function_ptr_glViewportArrayvNV;
+int exists_function_glViewportArrayvNV(void);
+PFNGLVIEWPORTARRAYVNVPROC get_function_ptr_glViewportArrayvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportArrayvNV(GLuint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glViewportArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glViewportArrayvNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glViewportArrayvNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glViewportArrayvNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glViewportArrayvNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLVIEWPORTARRAYVOESPROC function_ptr_glViewportArrayvOES;
+int exists_function_glViewportArrayvOES(void);
+PFNGLVIEWPORTARRAYVOESPROC get_function_ptr_glViewportArrayvOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportArrayvOES(GLuint  argument_0, GLsizei  argument_1, const GLfloat * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glViewportArrayvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glViewportArrayvOES( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glViewportArrayvOES("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glViewportArrayvOES( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glViewportArrayvOES( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLVIEWPORTINDEXEDFNVPROC function_ptr_glViewportIndexedfNV;
+int exists_function_glViewportIndexedfNV(void);
+PFNGLVIEWPORTINDEXEDFNVPROC get_function_ptr_glViewportIndexedfNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportIndexedfNV(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glViewportIndexedfNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glViewportIndexedfNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glViewportIndexedfNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glViewportIndexedfNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glViewportIndexedfNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVIEWPORTINDEXEDFOESPROC function_ptr_glViewportIndexedfOES;
+int exists_function_glViewportIndexedfOES(void);
+PFNGLVIEWPORTINDEXEDFOESPROC get_function_ptr_glViewportIndexedfOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportIndexedfOES(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, GLfloat  argument_3, GLfloat  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glViewportIndexedfOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glViewportIndexedfOES( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glViewportIndexedfOES("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glViewportIndexedfOES( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glViewportIndexedfOES( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLVIEWPORTINDEXEDFVNVPROC function_ptr_glViewportIndexedfvNV;
+int exists_function_glViewportIndexedfvNV(void);
+PFNGLVIEWPORTINDEXEDFVNVPROC get_function_ptr_glViewportIndexedfvNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportIndexedfvNV(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glViewportIndexedfvNV( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glViewportIndexedfvNV( argument_0, argument_1, __FILE__, __LINE__, "glViewportIndexedfvNV("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glViewportIndexedfvNV( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glViewportIndexedfvNV( argument_0, argument_1)
+#endif
+
+extern PFNGLVIEWPORTINDEXEDFVOESPROC function_ptr_glViewportIndexedfvOES;
+int exists_function_glViewportIndexedfvOES(void);
+PFNGLVIEWPORTINDEXEDFVOESPROC get_function_ptr_glViewportIndexedfvOES(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportIndexedfvOES(GLuint  argument_0, const GLfloat * argument_1, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1);
+#define glViewportIndexedfvOES( argument_0, argument_1) fastuidraw::gl_binding::debug_function__glViewportIndexedfvOES( argument_0, argument_1, __FILE__, __LINE__, "glViewportIndexedfvOES("#argument_0","#argument_1")", #argument_0, #argument_1)
+#else
+#define glViewportIndexedfvOES( argument_0, argument_1) fastuidraw::gl_binding::function_ptr_glViewportIndexedfvOES( argument_0, argument_1)
+#endif
+
+extern PFNGLVIEWPORTPOSITIONWSCALENVPROC function_ptr_glViewportPositionWScaleNV;
+int exists_function_glViewportPositionWScaleNV(void);
+PFNGLVIEWPORTPOSITIONWSCALENVPROC get_function_ptr_glViewportPositionWScaleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportPositionWScaleNV(GLuint  argument_0, GLfloat  argument_1, GLfloat  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glViewportPositionWScaleNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glViewportPositionWScaleNV( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glViewportPositionWScaleNV("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glViewportPositionWScaleNV( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glViewportPositionWScaleNV( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLVIEWPORTSWIZZLENVPROC function_ptr_glViewportSwizzleNV;
+int exists_function_glViewportSwizzleNV(void);
+PFNGLVIEWPORTSWIZZLENVPROC get_function_ptr_glViewportSwizzleNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glViewportSwizzleNV(GLuint  argument_0, GLenum  argument_1, GLenum  argument_2, GLenum  argument_3, GLenum  argument_4, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4);
+#define glViewportSwizzleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::debug_function__glViewportSwizzleNV( argument_0, argument_1, argument_2, argument_3, argument_4, __FILE__, __LINE__, "glViewportSwizzleNV("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4)
+#else
+#define glViewportSwizzleNV( argument_0, argument_1, argument_2, argument_3, argument_4) fastuidraw::gl_binding::function_ptr_glViewportSwizzleNV( argument_0, argument_1, argument_2, argument_3, argument_4)
+#endif
+
+extern PFNGLWAITSEMAPHOREEXTPROC function_ptr_glWaitSemaphoreEXT;
+int exists_function_glWaitSemaphoreEXT(void);
+PFNGLWAITSEMAPHOREEXTPROC get_function_ptr_glWaitSemaphoreEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWaitSemaphoreEXT(GLuint  argument_0, GLuint  argument_1, const GLuint * argument_2, GLuint  argument_3, const GLuint * argument_4, const GLenum * argument_5, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3, const char *argumentName_4, const char *argumentName_5);
+#define glWaitSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::debug_function__glWaitSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5, __FILE__, __LINE__, "glWaitSemaphoreEXT("#argument_0","#argument_1","#argument_2","#argument_3","#argument_4","#argument_5")", #argument_0, #argument_1, #argument_2, #argument_3, #argument_4, #argument_5)
+#else
+#define glWaitSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5) fastuidraw::gl_binding::function_ptr_glWaitSemaphoreEXT( argument_0, argument_1, argument_2, argument_3, argument_4, argument_5)
+#endif
+
+extern PFNGLWAITSYNCPROC function_ptr_glWaitSync;
+int exists_function_glWaitSync(void);
+PFNGLWAITSYNCPROC get_function_ptr_glWaitSync(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWaitSync(GLsync  argument_0, GLbitfield  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glWaitSync( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glWaitSync( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glWaitSync("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glWaitSync( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glWaitSync( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLWAITSYNCAPPLEPROC function_ptr_glWaitSyncAPPLE;
+int exists_function_glWaitSyncAPPLE(void);
+PFNGLWAITSYNCAPPLEPROC get_function_ptr_glWaitSyncAPPLE(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWaitSyncAPPLE(GLsync  argument_0, GLbitfield  argument_1, GLuint64  argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glWaitSyncAPPLE( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glWaitSyncAPPLE( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glWaitSyncAPPLE("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glWaitSyncAPPLE( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glWaitSyncAPPLE( argument_0, argument_1, argument_2)
+#endif
+
+extern PFNGLWAITVKSEMAPHORENVPROC function_ptr_glWaitVkSemaphoreNV;
+int exists_function_glWaitVkSemaphoreNV(void);
+PFNGLWAITVKSEMAPHORENVPROC get_function_ptr_glWaitVkSemaphoreNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWaitVkSemaphoreNV(GLuint64  argument_0, const char *file, int line, const char *call, const char *argumentName_0);
+#define glWaitVkSemaphoreNV( argument_0) fastuidraw::gl_binding::debug_function__glWaitVkSemaphoreNV( argument_0, __FILE__, __LINE__, "glWaitVkSemaphoreNV("#argument_0")", #argument_0)
+#else
+#define glWaitVkSemaphoreNV( argument_0) fastuidraw::gl_binding::function_ptr_glWaitVkSemaphoreNV( argument_0)
+#endif
+
+extern PFNGLWEIGHTPATHSNVPROC function_ptr_glWeightPathsNV;
+int exists_function_glWeightPathsNV(void);
+PFNGLWEIGHTPATHSNVPROC get_function_ptr_glWeightPathsNV(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWeightPathsNV(GLuint  argument_0, GLsizei  argument_1, const GLuint * argument_2, const GLfloat * argument_3, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2, const char *argumentName_3);
+#define glWeightPathsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::debug_function__glWeightPathsNV( argument_0, argument_1, argument_2, argument_3, __FILE__, __LINE__, "glWeightPathsNV("#argument_0","#argument_1","#argument_2","#argument_3")", #argument_0, #argument_1, #argument_2, #argument_3)
+#else
+#define glWeightPathsNV( argument_0, argument_1, argument_2, argument_3) fastuidraw::gl_binding::function_ptr_glWeightPathsNV( argument_0, argument_1, argument_2, argument_3)
+#endif
+
+extern PFNGLWINDOWRECTANGLESEXTPROC function_ptr_glWindowRectanglesEXT;
+int exists_function_glWindowRectanglesEXT(void);
+PFNGLWINDOWRECTANGLESEXTPROC get_function_ptr_glWindowRectanglesEXT(void);
+#ifdef FASTUIDRAW_DEBUG
+void debug_function__glWindowRectanglesEXT(GLenum  argument_0, GLsizei  argument_1, const GLint * argument_2, const char *file, int line, const char *call, const char *argumentName_0, const char *argumentName_1, const char *argumentName_2);
+#define glWindowRectanglesEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::debug_function__glWindowRectanglesEXT( argument_0, argument_1, argument_2, __FILE__, __LINE__, "glWindowRectanglesEXT("#argument_0","#argument_1","#argument_2")", #argument_0, #argument_1, #argument_2)
+#else
+#define glWindowRectanglesEXT( argument_0, argument_1, argument_2) fastuidraw::gl_binding::function_ptr_glWindowRectanglesEXT( argument_0, argument_1, argument_2)
+#endif
+
+
+
+} //fastuidraw
+
+} //gl_binding
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include <fastuidraw/gl_backend/image_gl.hpp>
 #include <fastuidraw/gl_backend/glyph_atlas_gl.hpp>
 #include <fastuidraw/gl_backend/colorstop_atlas_gl.hpp>
+#include <fastuidraw/gl_backend/gl_program.hpp>
 
 namespace fastuidraw
 {
@@ -141,6 +142,46 @@ namespace fastuidraw
         ConfigurationGL&
         glyph_atlas(const reference_counted_ptr<GlyphAtlasGL> &v);
 
+        /*!
+         * If non-null, the ProgramBinaryCache used by the
+         * Program objects of the PainterBackendGL so that
+         * the uber-shaders are loaded from program binaries
+         * instead of being compiled and linked whenever their
+         * GLSL source code is unchanged. The timing of building
+         * each program is available from Program::program_build_time()
+         * and Program::program_from_binary() of program().
+         * Default value is nullptr.
+         */
+        const reference_counted_ptr<ProgramBinaryCache>&
+        program_binary_cache(void) const;
+
+        /*!
+         * Set the value returned by program_binary_cache(void) const.
+         */
+        ConfigurationGL&
+        program_binary_cache(const reference_counted_ptr<ProgramBinaryCache> &v);
+
+        /*!
+         * The GLContextWorker to which the PainterBackendGL, its
+         * Program objects and the SurfaceGL objects it draws to
+         * queue the deletion of their GL objects. The PainterBackendGL
+         * runs it and the GLContextWorker of each of its atlases in
+         * on_pre_draw() and on_post_draw(). If nullptr, the
+         * PainterBackendGL creates its own GLContextWorker, which is
+         * then returned by configuration_gl(). An application with
+         * several PainterBackendGL objects whose GL contexts are in
+         * the same share group may have them use one GLContextWorker.
+         * Default value is nullptr.
+         */
+        const reference_counted_ptr<GLContextWorker>&
+        worker(void) const;
+
+        /*!
+         * Set the value returned by worker(void) const.
+         */
+        ConfigurationGL&
+        worker(const reference_counted_ptr<GLContextWorker> &v);
+
         /*!
          * Specifies the maximum number of attributes
          * a PainterDraw returned by
@@ -281,6 +322,67 @@ namespace fastuidraw
         ConfigurationGL&
         number_pools(unsigned int v);
 
+        /*!
+         * If true, the buffer objects of the pools (see number_pools())
+         * are allocated with immutable storage and mapped once with
+         * GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT for their entire
+         * lifetime, instead of being mapped and unmapped for each
+         * PainterDraw. The pools then act as a ring: a fence is placed
+         * when a pool is finished (see number_pools()) and the pool is
+         * not written to again until that fence signals. Requires
+         * GL 4.4 or GL_ARB_buffer_storage (GL_EXT_buffer_storage for
+         * GLES); if not supported, the value is set to false.
+         * Default value is false.
+         */
+        bool
+        use_persistent_mapped_buffers(void) const;
+
+        /*!
+         * Set the value for use_persistent_mapped_buffers(void) const
+         */
+        ConfigurationGL&
+        use_persistent_mapped_buffers(bool v);
+
+        /*!
+         * If true, each PainterDraw stores its indices as 16-bit
+         * values (GL_UNSIGNED_SHORT) while the attributes written
+         * to it number at most 65536, and as 32-bit PainterIndex
+         * values for the indices written after that; this halves
+         * the bytes of index data sent to GL for every draw that
+         * is not larger than that. The indices are written directly
+         * to the mapped index buffer at their final width.
+         * Default value is false.
+         */
+        bool
+        use_16bit_indices(void) const;
+
+        /*!
+         * Set the value for use_16bit_indices(void) const
+         */
+        ConfigurationGL&
+        use_16bit_indices(bool v);
+
+        /*!
+         * If true, each PainterDraw also provides
+         * PainterDraw::m_compact_attributes, backed by its own
+         * buffer object and VAO, so that the attributes of
+         * glyphs and filled paths are sent as 24-byte
+         * PainterCompactAttribute values instead of 52 bytes
+         * of PainterAttribute and header attribute; positions
+         * are then quantized to units of 1/8 in item
+         * coordinates. Each switch between the two attribute
+         * formats within a PainterDraw is a draw break.
+         * Default value is false.
+         */
+        bool
+        use_compact_attributes(void) const;
+
+        /*!
+         * Set the value for use_compact_attributes(void) const
+         */
+        ConfigurationGL&
+        use_compact_attributes(bool v);
+
         /*!
          * If true, place different item shaders in seperate
          * entries of a glMultiDrawElements call.
@@ -201,9 +201,39 @@ namespace fastuidraw
           uint_attrib_slot,
 
           /*!
-           * Slot for the values of PainterDraw::m_header_attributes
+           * Slot for the values of PainterDraw::m_header_attributes;
+           * when drawing from PainterDraw::m_compact_attributes, slot
+           * for the values of PainterCompactAttribute::m_header
            */
           header_attrib_slot,
+
+          /*!
+           * Slot for the values of PainterCompactAttribute::m_position
+           * of PainterDraw::m_compact_attributes, only present if
+           * UberShaderParams::compact_attributes() is true
+           */
+          compact_position_slot,
+
+          /*!
+           * Slot for the values of PainterCompactAttribute::m_texel
+           * of PainterDraw::m_compact_attributes, only present if
+           * UberShaderParams::compact_attributes() is true
+           */
+          compact_texel_slot,
+
+          /*!
+           * Slot for the values of PainterCompactAttribute::m_layer
+           * of PainterDraw::m_compact_attributes, only present if
+           * UberShaderParams::compact_attributes() is true
+           */
+          compact_layer_slot,
+
+          /*!
+           * Slot for the values of PainterCompactAttribute::m_data
+           * of PainterDraw::m_compact_attributes, only present if
+           * UberShaderParams::compact_attributes() is true
+           */
+          compact_data_slot,
         };
 
       /*!
@@ -701,6 +731,24 @@ namespace fastuidraw
         UberShaderParams&
         unpack_header_and_brush_in_frag_shader(bool);
 
+        /*!
+         * If true, the vertex shader also declares the inputs
+         * for the fields of PainterCompactAttribute (see \ref
+         * vertex_shader_in_layout) and, for each vertex whose
+         * header value has PainterCompactAttribute::compact_bit
+         * up, unpacks them into the values an item shader reads
+         * for the layout named by the header value.
+         */
+        bool
+        compact_attributes(void) const;
+
+        /*!
+         * Set the value returned by compact_attributes(void) const.
+         * Default value is false.
+         */
+        UberShaderParams&
+        compact_attributes(bool);
+
         /*!
          * Specify how to access the data in PainterDraw::m_store
          * from the GLSL shader.
@@ -113,7 +113,10 @@ namespace fastuidraw
        * that compute the interval a distance value lies upon from
        * a repeated interval pattern. The parameter meanins are:
        * - intervals_location gives the location into the data store buffer where the
-       *   interval data is packed as (TODO: document format).
+       *   interval data is packed as a search tree, see PainterDashedStrokeParams;
+       *   the search reads one block of the data store per level of the tree and
+       *   PainterDashedStrokeParams::compute_interval() is the reference
+       *   implementation.
        * - total_distance the period of the repeat interval pattern
        * - first_interval_start
        * - in_distance distance value to evaluate
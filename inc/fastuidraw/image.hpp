@@ -383,6 +383,43 @@ class Image;
     public reference_counted<ImageAtlas>::default_base
   {
   public:
+    /*!
+     * Enumeration to specify a counter of an ImageAtlas.
+     */
+    enum counter_t
+      {
+        /*!
+         * Number of times add_color_tile() returned a tile
+         * already present in the atlas instead of creating
+         * a new tile.
+         */
+        shared_color_tile_counter,
+
+        /*!
+         * Number of bytes of texel data, across all mipmap
+         * levels, that were not uploaded to the color backing
+         * store because add_color_tile() returned a tile
+         * already present in the atlas.
+         */
+        bytes_saved_counter,
+
+        /*!
+         * Number of color tiles of sparse Image objects
+         * (see Image::create_sparse()) made resident by
+         * update_sparse_residency().
+         */
+        sparse_upload_counter,
+
+        /*!
+         * Number of color tiles of sparse Image objects
+         * that were evicted by update_sparse_residency()
+         * to make room for other tiles.
+         */
+        sparse_eviction_counter,
+
+        number_counters
+      };
+
     /*!
      * Ctor.
      * \param pcolor_tile_size size of each color tile
@@ -507,7 +544,11 @@ class Image;
     /*!
      * Adds a tile to the atlas returning the location
      * (in pixels) of the tile in the backing store
-     * of the atlas.
+     * of the atlas. If a tile with the exact same texel
+     * values (across all mipmap levels) is already in
+     * the atlas, that tile is returned and its reference
+     * count is incremented instead of adding a new tile.
+     * Tiles are matched by a 128-bit hash of their texels.
      * \param src_xy location from ImageSourceBase to take data
      * \param image_data image data to which to set the tile
      */
@@ -517,7 +558,8 @@ class Image;
     /*!
      * Adds a tile of a constant color to the atlas returning
      * the location (in pixels) of the tile in the backing store
-     * of the atlas.
+     * of the atlas. As with add_color_tile(ivec2, const ImageSourceBase&),
+     * a tile already in the atlas of the same color is reused.
      * \param color_data color value to which to set all pixels of
      *                   the tile
      */
@@ -525,12 +567,29 @@ class Image;
     add_color_tile(u8vec4 color_data);
 
     /*!
-     * Mark a tile as free in the atlas
+     * Decrements the reference count of a tile, marking
+     * the tile as free in the atlas when it reaches zero;
+     * each call to add_color_tile() is to be matched by
+     * exactly one call to delete_color_tile().
      * \param tile tile to free as returned by add_color_tile().
      */
     void
     delete_color_tile(ivec3 tile);
 
+    /*!
+     * Returns the value of a counter since construction
+     * or the last call to reset_counters().
+     * \param tp which counter
+     */
+    uint64_t
+    counter(enum counter_t tp) const;
+
+    /*!
+     * Set all counters to zero.
+     */
+    void
+    reset_counters(void);
+
     /*!
      * Returns the number of free color tiles that are available
      * in the atlas without resizing the AtlasColorBackingStoreBase
@@ -550,7 +609,72 @@ class Image;
     void
     resize_to_fit(int num_color_tiles, int num_index_tiles);
 
+    /*!
+     * Set the maximum number of color tiles of sparse Image
+     * objects (see Image::create_sparse()) that are resident
+     * at any time on the atlas. Default value is ~0u, i.e.
+     * only limited by the size of the atlas. A smaller
+     * value takes effect at the next call to
+     * update_sparse_residency().
+     */
+    void
+    sparse_color_tile_budget(unsigned int v);
+
+    /*!
+     * Returns the value set by
+     * sparse_color_tile_budget(unsigned int).
+     */
+    unsigned int
+    sparse_color_tile_budget(void) const;
+
+    /*!
+     * Returns the number of color tiles of sparse Image
+     * objects that are resident on the atlas.
+     */
+    unsigned int
+    number_resident_sparse_color_tiles(void) const;
+
+    /*!
+     * Process the color tiles requested by Image::request_color_tiles()
+     * and Image::request_region() since the last call. Tiles
+     * that were requested and already resident are marked as
+     * used; then those that are not resident are uploaded
+     * (in the order requested) evicting the least recently
+     * requested tiles that were not requested since the last
+     * call, as needed to stay within sparse_color_tile_budget()
+     * and the size of the atlas. Requests that cannot be honored
+     * are dropped, an application is expected to call this once
+     * a frame, after the requests for the frame are made. The
+     * index tiles of the affected images are updated so that a
+     * non-resident tile shows the fallback color of its Image.
+     * Returns the number of tiles uploaded.
+     * \param max_uploads maximum number of tiles to upload
+     */
+    unsigned int
+    update_sparse_residency(unsigned int max_uploads = ~0u);
+
+    /*!
+     * Place onto the atlas the color tiles of Image objects made
+     * with Image::create_async() whose texels have been fetched
+     * by the worker threads of the atlas since the last call.
+     * The index tiles of the affected images are updated and
+     * an image whose every color tile has landed becomes
+     * Image::ready(). An application is expected to call this
+     * once a frame; if the backing stores of the atlas upload
+     * data immediately, it must be called from the thread on
+     * which they may upload (for example the thread with the GL
+     * context of a non-delayed ImageAtlasGL).
+     * Returns the number of color tiles placed.
+     * \param time_budget_us once this many microseconds have elapsed,
+     *                       stop taking fetched tiles; remaining
+     *                       tiles are placed on the next call
+     */
+    unsigned int
+    process_async_uploads(uint64_t time_budget_us = ~uint64_t(0));
+
   private:
+    friend class Image;
+
     void *m_d;
   };
 
@@ -612,6 +736,63 @@ class Image;
     create(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
            c_array<const u8vec4> image_data, unsigned int pslack);
 
+    /*!
+     * Construct a sparse \ref Image backed by an \ref ImageAtlas. A
+     * sparse image allocates only its index tiles at creation;
+     * its color tiles are made resident by
+     * ImageAtlas::update_sparse_residency() after being requested
+     * with request_color_tiles() or request_region() and may be
+     * evicted later. A color tile that is not resident is drawn
+     * with a fallback color. If there is insufficient room on the
+     * atlas for the index tiles, returns a nullptr handle.
+     * \param atlas ImageAtlas atlas onto which to place the image.
+     * \param w width of the image
+     * \param h height of the image
+     * \param image_data image data from which to take the texels of
+     *                   the color tiles; the object is NOT copied and
+     *                   must stay alive for the lifetime of the Image.
+     * \param pslack number of pixels allowed to sample outside of color tile
+     *               for the image. A value of one allows for bilinear
+     *               filtering and a value of two allows for cubic filtering.
+     * \param fallback_color color with which to draw the color tiles
+     *                       that are not resident
+     */
+    static
+    reference_counted_ptr<Image>
+    create_sparse(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
+                  const ImageSourceBase &image_data, unsigned int pslack,
+                  u8vec4 fallback_color = u8vec4(0u, 0u, 0u, 0u));
+
+    /*!
+     * Construct an \ref Image backed by an \ref ImageAtlas whose
+     * texels are fetched from the ImageSourceBase by worker
+     * threads of the atlas instead of by the calling thread.
+     * The fetched color tiles are placed onto the atlas by
+     * ImageAtlas::process_async_uploads(); until a color tile
+     * is placed, it is drawn with a fallback color. If there
+     * is insufficient room on the atlas, returns a nullptr
+     * handle.
+     * \param atlas ImageAtlas atlas onto which to place the image.
+     * \param w width of the image
+     * \param h height of the image
+     * \param image_data image data from which to take the texels;
+     *                   the object is NOT copied and must stay
+     *                   alive until ready() returns true or the
+     *                   Image is destroyed. The methods of the
+     *                   object are called from the worker threads
+     *                   and so must be thread safe.
+     * \param pslack number of pixels allowed to sample outside of color tile
+     *               for the image. A value of one allows for bilinear
+     *               filtering and a value of two allows for cubic filtering.
+     * \param fallback_color color with which to draw the color tiles
+     *                       that have not yet been placed
+     */
+    static
+    reference_counted_ptr<Image>
+    create_async(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
+                 const ImageSourceBase &image_data, unsigned int pslack,
+                 u8vec4 fallback_color = u8vec4(0u, 0u, 0u, 0u));
+
     /*!
      * Create an \ref Image backed by a bindless texture.
      * \param w width of the image
@@ -707,6 +888,54 @@ class Image;
     type_t
     type(void) const;
 
+    /*!
+     * Returns true if and only if the Image was created
+     * with create_sparse().
+     */
+    bool
+    sparse(void) const;
+
+    /*!
+     * Returns false if and only if the Image was created with
+     * create_async() and not all of its color tiles have yet
+     * been placed by ImageAtlas::process_async_uploads().
+     * May be called from any thread.
+     */
+    bool
+    ready(void) const;
+
+    /*!
+     * Returns the number of color tiles in each dimension
+     * of the Image.
+     *
+     * Only applies when type() returns \ref on_atlas.
+     */
+    ivec2
+    number_color_tiles(void) const;
+
+    /*!
+     * Request that color tiles of a sparse Image be made resident
+     * at the next call to ImageAtlas::update_sparse_residency().
+     * Tiles outside of number_color_tiles() are ignored, as are
+     * all requests if the Image is not sparse.
+     * \param tiles which tiles, each with 0 <= x < number_color_tiles().x()
+     *              and 0 <= y < number_color_tiles().y()
+     */
+    void
+    request_color_tiles(c_array<const ivec2> tiles);
+
+    /*!
+     * Request that the color tiles of a sparse Image covering a
+     * rectangle of texels be made resident at the next call to
+     * ImageAtlas::update_sparse_residency(). Does nothing if the
+     * Image is not sparse.
+     * \param min_pt min-corner of the rectangle in texel coordinates
+     * \param max_pt max-corner (exclusive) of the rectangle in texel
+     *               coordinates
+     */
+    void
+    request_region(ivec2 min_pt, ivec2 max_pt);
+
   protected:
     /*!
      * Protected ctor for creating an Image backed by a bindless texture;
@@ -727,6 +956,10 @@ class Image;
     Image(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
           const ImageSourceBase &image_data, unsigned int pslack);
 
+    Image(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
+          const ImageSourceBase &image_data, unsigned int pslack,
+          u8vec4 fallback_color, bool async);
+
 
     void *m_d;
   };
@@ -0,0 +1,178 @@
+/*!
+ * \file binned_glyph_run.hpp
+ * \brief file binned_glyph_run.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/fastuidraw_memory.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/matrix.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/painter/painter_enums.hpp>
+#include <fastuidraw/text/glyph.hpp>
+
+namespace fastuidraw
+{
+///@cond
+class PainterAttributeData;
+///@endcond
+
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A BinnedGlyphRun holds the attribute and index data to draw a
+   * glyph run, partitioned into spatial bins. The glyphs are placed
+   * into the cells of a regular grid in item coordinates according
+   * to their position; each non-empty cell is a bin that holds a
+   * PainterAttributeData filled by a PainterAttributeDataFillerGlyphs
+   * and the bounding box of the glyphs of the bin. This allows for
+   * Painter::draw_glyphs() to skip those bins that are entirely
+   * clipped, which is important for long glyph runs (for example
+   * an entire document) of which only a small portion is visible.
+   *
+   * Just as with PainterAttributeDataFillerGlyphs, the glyphs
+   * are uploaded to their GlyphAtlas when the BinnedGlyphRun is
+   * constructed and filling of a bin stops at the first glyph of
+   * the bin that cannot be uploaded.
+   */
+  class BinnedGlyphRun:
+    public reference_counted<BinnedGlyphRun>::non_concurrent
+  {
+  public:
+    /*!
+     * \brief
+     * Opaque object to hold work room needed for functions
+     * of BinnedGlyphRun that require scratch space.
+     */
+    class ScratchSpace:fastuidraw::noncopyable
+    {
+    public:
+      ScratchSpace(void);
+      ~ScratchSpace();
+    private:
+      friend class BinnedGlyphRun;
+      void *m_d;
+    };
+
+    /*!
+     * Ctor. The values behind the arrays are NOT referenced
+     * after the ctor returns.
+     * \param glyph_positions position of the bottom left corner of each glyph
+     * \param glyphs glyphs to draw, array must be same size as glyph_positions
+     * \param scale_factors scale factors to apply to each glyph, must be either
+     *                      empty (indicating no scaling factors) or the exact
+     *                      same length as glyph_positions
+     * \param orientation orientation of drawing
+     * \param bin_size width and height of the grid cells in item coordinates
+     */
+    BinnedGlyphRun(c_array<const vec2> glyph_positions,
+                   c_array<const Glyph> glyphs,
+                   c_array<const float> scale_factors,
+                   enum PainterEnums::glyph_orientation orientation
+                   = PainterEnums::y_increases_downwards,
+                   float bin_size = 256.0f);
+
+    /*!
+     * Ctor. The values behind the arrays are NOT referenced
+     * after the ctor returns.
+     * \param glyph_positions position of the bottom left corner of each glyph
+     * \param glyphs glyphs to draw, array must be same size as glyph_positions
+     * \param render_pixel_size pixel size to which to scale the glyphs
+     * \param orientation orientation of drawing
+     * \param bin_size width and height of the grid cells in item coordinates
+     */
+    BinnedGlyphRun(c_array<const vec2> glyph_positions,
+                   c_array<const Glyph> glyphs,
+                   float render_pixel_size,
+                   enum PainterEnums::glyph_orientation orientation
+                   = PainterEnums::y_increases_downwards,
+                   float bin_size = 256.0f);
+
+    ~BinnedGlyphRun();
+
+    /*!
+     * Returns the number of bins.
+     */
+    unsigned int
+    number_bins(void) const;
+
+    /*!
+     * Returns the number of glyphs in the attribute data
+     * of all bins.
+     */
+    unsigned int
+    number_glyphs(void) const;
+
+    /*!
+     * Returns the data to draw the glyphs of a bin; the chunks
+     * of the PainterAttributeData are as for
+     * PainterAttributeDataFillerGlyphs.
+     * \param bin which bin, must be less than number_bins()
+     */
+    const PainterAttributeData&
+    bin_data(unsigned int bin) const;
+
+    /*!
+     * Returns the number of glyphs in the attribute data
+     * of a bin.
+     * \param bin which bin, must be less than number_bins()
+     */
+    unsigned int
+    bin_number_glyphs(unsigned int bin) const;
+
+    /*!
+     * Returns the min-corner of the bounding box, in item
+     * coordinates, of the glyphs of a bin.
+     * \param bin which bin, must be less than number_bins()
+     */
+    vec2
+    bin_min_point(unsigned int bin) const;
+
+    /*!
+     * Returns the max-corner of the bounding box, in item
+     * coordinates, of the glyphs of a bin.
+     * \param bin which bin, must be less than number_bins()
+     */
+    vec2
+    bin_max_point(unsigned int bin) const;
+
+    /*!
+     * Fetch those bins whose bounding box is not entirely
+     * clipped. Returns the number of bins written to dst.
+     * \param scratch_space scratch space for computations.
+     * \param clip_equations array of clip equations
+     * \param clip_matrix_local 3x3 transformation from local (x, y, 1)
+     *                          coordinates to clip coordinates.
+     * \param dst[output] location to which to write the bins,
+     *                    must be at least number_bins() in size
+     */
+    unsigned int
+    select_bins(ScratchSpace &scratch_space,
+                c_array<const vec3> clip_equations,
+                const float3x3 &clip_matrix_local,
+                c_array<unsigned int> dst) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
@@ -50,6 +50,44 @@ class FilledPath:
     public reference_counted<FilledPath>::non_concurrent
 {
 public:
+  /*!
+   * Enumeration to specify a counter of a FilledPath,
+   * see counter().
+   */
+  enum counter_t
+    {
+      /*!
+       * Number of times a Subset without children was
+       * triangulated.
+       */
+      triangulated_subsets_counter,
+
+      /*!
+       * Number of Subset objects whose data was shared
+       * with the FilledPath from which this FilledPath
+       * was made instead of being recomputed.
+       */
+      reused_subsets_counter,
+
+      /*!
+       * Time in microseconds spent computing the attribute
+       * data of Subset objects, i.e. triangulating Subset
+       * objects without children and merging the data of
+       * children into their parent.
+       */
+      build_time_us_counter,
+
+      /*!
+       * Time in microseconds spent making this FilledPath
+       * from a previous FilledPath, not including
+       * the computation of attribute data, which is done when
+       * the data of a Subset is first needed.
+       */
+      update_time_us_counter,
+
+      number_counters
+    };
+
   /*!
    * \brief
    * A Subset represents a handle to a portion of a FilledPath.
@@ -173,6 +211,45 @@ public:
 
   ~FilledPath();
 
+  /*!
+   * Ctor. Construct a FilledPath from the data of a
+   * TessellatedPath, typically of an edited version of the
+   * Path whose TessellatedPath prev fills. The contours of
+   * P are compared against the contours of prev; only those
+   * Subset objects whose bounds intersect a changed portion
+   * of a contour (before or after the change) are computed,
+   * the attribute data of all other Subset objects is shared
+   * with prev. If P is not contained in the bounds of the root
+   * Subset of prev, the FilledPath is made entirely from P.
+   * prev is not modified, its Subset handles stay valid.
+   * \param P source TessellatedPath
+   * \param prev FilledPath from which to share data
+   */
+  FilledPath(const TessellatedPath &P, const FilledPath &prev);
+
+  /*!
+   * Returns the value of a counter since construction or the
+   * last call to reset_counters().
+   * \param tp which counter
+   */
+  uint64_t
+  counter(enum counter_t tp) const;
+
+  /*!
+   * Set all counters to zero.
+   */
+  void
+  reset_counters(void);
+
+  /*!
+   * Returns the number of bytes used by the attribute and
+   * index data of those Subset objects whose data has been
+   * created, including the data shared with other FilledPath
+   * objects.
+   */
+  uint64_t
+  memory_usage(void) const;
+
   /*!
    * Returns the number of Subset objects of the FilledPath.
    */
@@ -394,6 +394,18 @@ namespace fastuidraw
     void
     register_shader(const PainterFillShader &p);
 
+    /*!
+     * Provided as a conveniance, equivalent to
+     * \code
+     * register_shader(p.item_shader());
+     * register_shader(p.clip_inside_shader());
+     * register_shader(p.clip_outside_shader());
+     * \endcode
+     * \param p PainterRoundedRectShader hold shaders to register
+     */
+    void
+    register_shader(const PainterRoundedRectShader &p);
+
     /*!
      * Provided as a conveniance, equivalent to calling
      * register_shader(const PainterStrokeShader&) on each
@@ -0,0 +1,107 @@
+/*!
+ * \file painter_display_list.hpp
+ * \brief file painter_display_list.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/matrix.hpp>
+
+namespace fastuidraw
+{
+///@cond
+class PainterPacker;
+///@endcond
+
+/*!\addtogroup PainterPacking
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterDisplayList holds packed attribute, index, header
+   * and data store content recorded by a PainterPacker between
+   * PainterPacker::begin_sub() and PainterPacker::end(). Drawing
+   * a PainterDisplayList with PainterPacker::draw_display_list()
+   * copies the content to the current PainterDraw, changing only
+   * the z-values, the item matrices and the clip equations of
+   * the headers, thus static content can be drawn without
+   * repeating the clipping, chunk selection and packing done to
+   * record it. A PainterDisplayList is created with
+   * PainterPacker::create_display_list() and can only be drawn
+   * by a PainterPacker that uses the same PainterBackend as the
+   * PainterPacker that recorded it. A PainterDisplayList keeps
+   * alive the actions, images and color stop sequences its
+   * content uses and keeps the glyphs it draws pinned, see
+   * PainterPacker::create_display_list().
+   */
+  class PainterDisplayList:
+    public reference_counted<PainterDisplayList>::default_base
+  {
+  public:
+    ~PainterDisplayList();
+
+    /*!
+     * Returns the item matrix (see PainterItemMatrix) relative
+     * to which the content was recorded, as passed to
+     * PainterPacker::create_display_list().
+     */
+    const float3x3&
+    base_item_matrix(void) const;
+
+    /*!
+     * Returns the number of z-values used by the content,
+     * as passed to PainterPacker::create_display_list().
+     */
+    int
+    number_z(void) const;
+
+    /*!
+     * Returns the number of headers of the content.
+     */
+    unsigned int
+    number_headers(void) const;
+
+    /*!
+     * Returns the number of attributes of the content.
+     */
+    unsigned int
+    number_attributes(void) const;
+
+    /*!
+     * Returns the number of indices of the content.
+     */
+    unsigned int
+    number_indices(void) const;
+
+    /*!
+     * Returns the number of generic_data values of the data
+     * store of the content.
+     */
+    unsigned int
+    number_generic_datas(void) const;
+
+  private:
+    friend class PainterPacker;
+
+    PainterDisplayList(void);
+
+    void *m_d;
+  };
+/*! @} */
+}
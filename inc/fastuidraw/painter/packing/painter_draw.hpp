@@ -106,7 +106,7 @@ namespace fastuidraw
      * between two indices to be fed the the GPU; an Action
      * will imply an draw break in the underlying 3D API.
      */
-    class Action:public reference_counted<Action>::non_concurrent
+    class Action:public reference_counted<Action>::default_base
     {
     public:
       /*!
@@ -153,6 +153,39 @@ namespace fastuidraw
      */
     c_array<generic_data> m_store;
 
+    /*!
+     * If non-empty, the same store as \ref m_indices
+     * viewed as 16-bit values. While every attribute
+     * written to a PainterDraw has an index less than
+     * 65536, indices are written to \ref m_indices_16bit.
+     * Once an index does not fit, index_width_break() is
+     * called and the remaining indices are written to
+     * \ref m_indices, starting at the first element of
+     * \ref m_indices past the 16-bit indices already
+     * written. A backend leaves this empty if it only
+     * draws with 32-bit indices.
+     */
+    c_array<uint16_t> m_indices_16bit;
+
+    /*!
+     * If non-empty, location to which to place the attributes
+     * of items whose PainterItemShader declares a compact layout
+     * (see PainterItemShader::compact_layout()) as
+     * PainterCompactAttribute values; a PainterCompactAttribute
+     * carries its own header location, so nothing is written
+     * to \ref m_header_attributes for it. The indices of an
+     * item whose attributes are in \ref m_compact_attributes
+     * are indices into \ref m_compact_attributes and
+     * attribute_format_break() is called each time the indices
+     * written switch between indexing into \ref m_attributes
+     * and indexing into \ref m_compact_attributes. A backend
+     * leaves this empty if it does not support compact
+     * attributes, in which case every attribute is written
+     * to \ref m_attributes. The store is understood to be
+     * write only.
+     */
+    c_array<PainterCompactAttribute> m_compact_attributes;
+
     /*!
      * Ctor, a derived class will set \ref m_attributes,
      * \ref m_header_attributes, \ref m_indices and
@@ -189,6 +222,35 @@ namespace fastuidraw
     draw_break(const reference_counted_ptr<const Action> &action,
                unsigned int indices_written) const = 0;
 
+    /*!
+     * Called when the indices stop being written to
+     * \ref m_indices_16bit and start being written to
+     * \ref m_indices. Called at most once and only
+     * if \ref m_indices_16bit is non-empty. Default
+     * implementation does nothing.
+     * \param indices_written total number of indices written,
+     *                        all as 16-bit values, -before- the change
+     */
+    virtual
+    void
+    index_width_break(unsigned int indices_written) const;
+
+    /*!
+     * Called when the indices written switch between indexing
+     * into \ref m_attributes and indexing into \ref
+     * m_compact_attributes. Only called if \ref
+     * m_compact_attributes is non-empty; the indices written
+     * before any call index into \ref m_attributes. Default
+     * implementation does nothing.
+     * \param compact if true, the indices written after the
+     *                change index into \ref m_compact_attributes,
+     *                otherwise they index into \ref m_attributes
+     * \param indices_written total number of indices written -before- the change
+     */
+    virtual
+    void
+    attribute_format_break(bool compact, unsigned int indices_written) const;
+
     /*!
      * Adds a delayed action to the action list.
      * \param h handle to action to add.
@@ -202,11 +264,13 @@ namespace fastuidraw
      * have been added with add_action() have been
      * called.
      * \param attributes_written number of elements written to m_attributes and m_header_attributes
+     * \param compact_attributes_written number of elements written to m_compact_attributes
      * \param indices_written number of elements written to m_indices
      * \param data_store_written number of elements written to m_store
      */
     void
     unmap(unsigned int attributes_written,
+          unsigned int compact_attributes_written,
           unsigned int indices_written,
           unsigned int data_store_written) const;
 
@@ -240,6 +304,10 @@ namespace fastuidraw
      * \param attributes_written only the range [0,floats_written) of
      *                           m_attributes must be uploaded to
      *                           3D API
+     * \param compact_attributes_written only the range
+     *                                   [0,compact_attributes_written) of
+     *                                   m_compact_attributes must be
+     *                                   uploaded to 3D API
      * \param indices_written only the range [0,uints_written) of
      *                        m_indices specify indices to use.
      * \param data_store_written only the range [0,data_store_written) of
@@ -248,6 +316,7 @@ namespace fastuidraw
     virtual
     void
     unmap_implement(unsigned int attributes_written,
+                    unsigned int compact_attributes_written,
                     unsigned int indices_written,
                     unsigned int data_store_written) const = 0;
 
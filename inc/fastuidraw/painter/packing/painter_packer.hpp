@@ -36,6 +36,7 @@
 #include <fastuidraw/painter/packing/painter_draw.hpp>
 #include <fastuidraw/painter/packing/painter_backend.hpp>
 #include <fastuidraw/painter/packing/painter_packer_data.hpp>
+#include <fastuidraw/painter/packing/painter_display_list.hpp>
 
 namespace fastuidraw
 {
@@ -152,6 +153,24 @@ namespace fastuidraw
                     unsigned int index_offset_value,
                     unsigned int index_chunk) const = 0;
 
+      /*!
+       * May be implemented by a derived class to write indices
+       * as 16-bit values, called in place of the 32-bit version
+       * when the PainterDraw takes 16-bit indices; every value
+       * written is then guaranteed to fit. Default implementation
+       * writes the indices with the 32-bit version to a temporary
+       * array and narrows them to dst.
+       * \param dst location to which to write indices
+       * \param index_offset_value value by which to increment the index
+       *                           values written
+       * \param index_chunk which chunk of indices to write
+       */
+      virtual
+      void
+      write_indices(c_array<uint16_t> dst,
+                    unsigned int index_offset_value,
+                    unsigned int index_chunk) const;
+
       /*!
        * To be implemented by a derived class to write attributes.
        * \param dst location to which to write indices
@@ -171,7 +190,8 @@ namespace fastuidraw
     enum stats_t
       {
         /*!
-         * Offset to how many attributes processed
+         * Offset to how many attributes processed, including
+         * those sent as PainterCompactAttribute values
          */
         num_attributes,
 
@@ -196,6 +216,34 @@ namespace fastuidraw
          */
         num_headers,
 
+        /*!
+         * Offset to how many times PainterDraw::draw_break()
+         * was called because the shader group of consecutive
+         * headers differed.
+         */
+        num_draw_breaks,
+
+        /*!
+         * Offset to how many bytes of vertex data, i.e. of
+         * the attributes, header attributes and compact
+         * attributes, processed.
+         */
+        num_attribute_bytes,
+
+        /*!
+         * Offset to how many bytes of index data processed,
+         * counting the indices written to
+         * PainterDraw::m_indices_16bit as two bytes each.
+         */
+        num_index_bytes,
+
+        /*!
+         * Offset to how many attributes processed were sent as
+         * PainterCompactAttribute values to
+         * PainterDraw::m_compact_attributes.
+         */
+        num_compact_attributes,
+
         /*!
          * Number of stats.
          */
@@ -280,6 +328,92 @@ namespace fastuidraw
     void
     end(void);
 
+    /*!
+     * Indicate to start recording into host memory instead of
+     * into the PainterDraw objects of the PainterBackend. The
+     * recorded content is not sent to the backend on end();
+     * instead it is merged into another PainterPacker with
+     * submit_sub(). A PainterPacker recording in this mode
+     * does not touch the PainterBackend or the state of the
+     * parent, so several PainterPacker objects sharing the
+     * same PainterBackend can record concurrently from
+     * separate threads. Caveats:
+     *  - the PainterPacker must have been constructed, and all
+     *    shaders it uses registered, before recording starts
+     *    since shader registration is not thread safe.
+     *  - the glyphs and images drawn must already be uploaded
+     *    to the atlases of the PainterBackend.
+     * \param parent PainterPacker into which the recorded content
+     *               will be submitted; parent must use the same
+     *               PainterBackend and must have had begin()
+     *               called at least once before.
+     */
+    void
+    begin_sub(const PainterPacker &parent);
+
+    /*!
+     * Merge the content recorded by a PainterPacker between
+     * begin_sub() and end() into this PainterPacker. The
+     * content is appended to the current draw, so the
+     * order of submission is the order in which the content
+     * is drawn. The attribute, index and data store locations
+     * of the content are relocated and the z-values of all
+     * headers are incremented by z_offset. Must be called
+     * between begin() and end() (or begin_sub() and end())
+     * of this PainterPacker and after end() of sub. The
+     * recorded content of sub stays valid until sub is begun
+     * again, thus it can be submitted more than once.
+     * \param sub PainterPacker whose recorded content to merge
+     * \param z_offset amount by which to increment the z-value
+     *                 of the merged content
+     */
+    void
+    submit_sub(const PainterPacker &sub, int z_offset);
+
+    /*!
+     * Take the content recorded by this PainterPacker between
+     * begin_sub() and end() as a PainterDisplayList. Afterwards
+     * the content can no longer be passed to submit_sub(). The
+     * same caveats as for begin_sub() apply to the content. The
+     * PainterDisplayList takes references to the actions passed
+     * to draw_break() and to the images and color stop sequences
+     * of the brushes of the content, and pins (see Glyph::pin())
+     * the glyphs passed to retain_glyphs(), for as long as it
+     * exists. Since pinning a glyph is not thread safe, the
+     * PainterDisplayList must be created and destroyed by the
+     * thread that uses the GlyphCache of those glyphs. Must be
+     * called after end() and before this PainterPacker is begun
+     * again.
+     * \param base_item_matrix item matrix relative to which the
+     *                         content was recorded, see
+     *                         draw_display_list()
+     * \param number_z number of z-values the content uses
+     */
+    reference_counted_ptr<PainterDisplayList>
+    create_display_list(const float3x3 &base_item_matrix, int number_z);
+
+    /*!
+     * Append the content of a PainterDisplayList to the current
+     * draw. The content is relocated as with submit_sub(), in
+     * addition each item matrix M of the content is replaced by
+     * item_matrix * inverse(PainterDisplayList::base_item_matrix()) * M
+     * and the clip equations of all headers of the content are
+     * replaced by clip. Must be called between begin() and end()
+     * (or begin_sub() and end()) of this PainterPacker.
+     * \param list PainterDisplayList to draw, must have been
+     *             created by a PainterPacker with the same
+     *             PainterBackend
+     * \param item_matrix item matrix with which to draw the content
+     * \param clip clip equations with which to draw the content
+     * \param z_offset amount by which to increment the z-value
+     *                 of the content
+     */
+    void
+    draw_display_list(const PainterDisplayList &list,
+                      const float3x3 &item_matrix,
+                      const PainterClipEquations &clip,
+                      int z_offset);
+
     /*!
      * Add a draw break to execute an action.
      * \param action action to execute on draw break
@@ -287,6 +421,46 @@ namespace fastuidraw
     void
     draw_break(const reference_counted_ptr<const PainterDraw::Action> &action);
 
+    /*!
+     * Indicate that content drawn between begin_sub() and end()
+     * has attributes holding the atlas locations of glyphs, so
+     * that a PainterDisplayList created from the content keeps
+     * those glyphs pinned (see create_display_list()). Has no
+     * effect if this PainterPacker is not between begin_sub()
+     * and end(). Painter::draw_glyphs() passes the glyphs of
+     * PainterAttributeData::pinned_glyphs() of the data drawn.
+     * \param glyphs glyphs whose atlas locations are drawn
+     */
+    void
+    retain_glyphs(c_array<const Glyph> glyphs);
+
+    /*!
+     * Set if draws are to be state sorted. When state sorting,
+     * draws are recorded into buckets according to their shader
+     * groups (see PainterShaderGroup) instead of directly into
+     * the current draw. The buckets are merged into the current
+     * draw, one after another ordered by shader groups, at the
+     * next draw with a DataCallBack, draw_break(), submit_sub(),
+     * end() or state_sort(false). Doing so reduces the number of
+     * times the shader group changes, and thus the number of
+     * calls to PainterDraw::draw_break(), at the cost of not
+     * drawing in the order of submission. Thus state sorting
+     * should only be enabled for draws that do not overlap or
+     * whose drawing order is already enforced by their z-values
+     * (i.e. opaque draws). Data of PainterPackedValue objects
+     * is not shared across draws that are recorded into buckets.
+     * Default value is false.
+     * \param v if true, enable state sorting
+     */
+    void
+    state_sort(bool v);
+
+    /*!
+     * Returns the value set by state_sort(bool).
+     */
+    bool
+    state_sort(void) const;
+
     /*!
      * Return the default shaders for common drawing types.
      */
@@ -23,7 +23,10 @@
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/painter/stroked_path.hpp>
 #include <fastuidraw/painter/filled_path.hpp>
+#include <fastuidraw/painter/binned_glyph_run.hpp>
 #include <fastuidraw/painter/fill_rule.hpp>
+#include <fastuidraw/painter/rounded_rect.hpp>
+#include <fastuidraw/painter/simple_path.hpp>
 #include <fastuidraw/painter/painter_brush.hpp>
 #include <fastuidraw/painter/painter_stroke_params.hpp>
 #include <fastuidraw/painter/painter_dashed_stroke_params.hpp>
@@ -195,6 +198,76 @@ namespace fastuidraw
     void
     end(void);
 
+    /*!
+     * Indicate to start drawing with methods of this Painter
+     * for the purpose of submitting the content to another
+     * Painter with submit_sub(). Drawing between begin_sub()
+     * and end() only writes to memory owned by this Painter,
+     * thus several Painter objects created with the same
+     * PainterBackend can draw concurrently on separate threads,
+     * see PainterPacker::begin_sub() for the caveats. The
+     * transformation, clipping and blend state of parent are
+     * not inherited; as with begin(), drawing starts with the
+     * identity transformation and clipped to the viewport of
+     * surface.
+     * \param parent Painter to which the content will be submitted,
+     *               must have had begin() called at least once before
+     * \param surface the \ref PainterBackend::Surface to which parent
+     *                will render
+     */
+    void
+    begin_sub(const Painter &parent,
+              const reference_counted_ptr<PainterBackend::Surface> &surface);
+
+    /*!
+     * Add the content drawn by a Painter between begin_sub() and
+     * end() to this Painter. The content is drawn after all content
+     * previously drawn by this Painter and before all content drawn
+     * after. The occluders this Painter uses for clipOutPath() and
+     * clipInPath() apply to the content, the clip-rectangle of
+     * this Painter (see clipInRect()) does not. Must be called between
+     * begin() and end() of this Painter and after end() of sub.
+     * \param sub Painter whose content to add.
+     */
+    void
+    submit_sub(const Painter &sub);
+
+    /*!
+     * Take the content drawn by this Painter between begin_sub()
+     * and end() as a PainterDisplayList that can be drawn any
+     * number of times with draw_display_list() at the cost of
+     * copying its packed data; see also
+     * PainterPacker::create_display_list(). Only the content that
+     * is not culled against the viewport of the surface passed to
+     * begin_sub() is recorded. Must be called after end() and
+     * before this Painter is begun again.
+     * \param base_transformation transformation (see transformation())
+     *                            relative to which the content was
+     *                            drawn, typically the projection
+     *                            set after begin_sub()
+     */
+    reference_counted_ptr<PainterDisplayList>
+    create_display_list(const float3x3 &base_transformation);
+
+    /*!
+     * Draw the content of a PainterDisplayList. The content is
+     * drawn as if the base transformation passed to
+     * create_display_list() were replaced by the current
+     * transformation of this Painter and it is clipped by the
+     * current clip-rectangle of this Painter instead of the
+     * clip-rectangles set by clipInRect() while recording;
+     * occluders of clipOutPath() and clipInPath() drawn while
+     * recording are part of the content and thus still apply.
+     * As with submit_sub(), the occluders of this Painter apply
+     * to the content and the current z of this Painter is
+     * incremented past the z-values the content uses.
+     * \param list PainterDisplayList to draw, must have been
+     *             created by a Painter using the same
+     *             PainterBackend as this Painter
+     */
+    void
+    draw_display_list(const PainterDisplayList &list);
+
     /*!
      * Concats the current transformation matrix
      * by a given matrix.
@@ -323,6 +396,46 @@ namespace fastuidraw
     void
     clipInPath(const Path &path, const CustomFillRuleBase &fill_rule);
 
+    /*!
+     * Clip-out by a rounded rectangle, i.e. set the clipping
+     * to be the intersection of the current clipping against
+     * the -complement- of a RoundedRect. The boundary of the
+     * RoundedRect is computed per-fragment instead of from a
+     * tessellation, see PainterRoundedRectShader.
+     * \param R rounded rectangle by which to clip out
+     */
+    void
+    clipOutRoundedRect(const RoundedRect &R);
+
+    /*!
+     * Clip-in by a rounded rectangle, i.e. set the clipping
+     * to be the intersection of the current clipping against
+     * a RoundedRect. The boundary of the RoundedRect is computed
+     * per-fragment instead of from a tessellation, see
+     * PainterRoundedRectShader.
+     * \param R rounded rectangle by which to clip in
+     */
+    void
+    clipInRoundedRect(const RoundedRect &R);
+
+    /*!
+     * Set the clipping to the intersection of the region of a
+     * SimplePath against the clipping as it was at the last call
+     * to save(), or to just the region of the SimplePath if there
+     * is no such call to save() (i.e. the save stack is empty).
+     * All clipping applied since that save() is discarded; this
+     * allows for an arbitrary clip region to be built on the CPU
+     * with the boolean operations of SimplePath and applied with
+     * a single occluder instead of a chain of clipInPath() and
+     * clipOutPath() calls. The transformation, blend shader and
+     * curve flatness are not changed and the next restore()
+     * restores the clipping as it was at the last save() as usual.
+     * \param path region to which to set the clipping, in the
+     *             coordinates of the current transformation
+     */
+    void
+    setClip(const SimplePath &path);
+
     /*!
      * Set the curve flatness requirement for TessellatedPath
      * and StrokedPath selection when stroking or filling paths
@@ -408,6 +521,37 @@ namespace fastuidraw
     draw_glyphs(const PainterData &draw,
                 const PainterAttributeData &data, bool use_anisotropic = false,
                 const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+     * Draw glyphs of a BinnedGlyphRun; only those bins whose
+     * bounding box is not entirely clipped are drawn. The glyphs
+     * of the bins that are skipped are added to the value
+     * returned by number_culled_glyphs().
+     * \param shader with which to draw the glyphs
+     * \param draw data for how to draw
+     * \param data BinnedGlyphRun holding the glyphs to draw
+     * \param call_back if non-nullptr handle, call back called when attribute data
+     *                  is added.
+     */
+    void
+    draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
+                const BinnedGlyphRun &data,
+                const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+     * Draw glyphs of a BinnedGlyphRun; only those bins whose
+     * bounding box is not entirely clipped are drawn.
+     * \param draw data for how to draw
+     * \param data BinnedGlyphRun holding the glyphs to draw
+     * \param use_anisotropic if true, use default_shaders().glyph_shader_anisotropic()
+     *                        otherwise use default_shaders().glyph_shader()
+     * \param call_back if non-nullptr handle, call back called when attribute data
+     *                  is added.
+     */
+    void
+    draw_glyphs(const PainterData &draw,
+                const BinnedGlyphRun &data, bool use_anisotropic = false,
+                const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
     /*!
      * Stroke a path.
      * \param shader shader with which to stroke the attribute data
@@ -738,6 +882,33 @@ namespace fastuidraw
     draw_rect(const PainterData &draw, const vec2 &p, const vec2 &wh,
               const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
 
+    /*!
+     * Draw a rounded rect anti-aliased using a custom shader;
+     * the coverage is computed analytically per-fragment and
+     * the rounded rect is drawn as a single quad.
+     * \param shader shader with which to draw the rounded rect
+     * \param draw data for how to draw
+     * \param R rounded rect to draw
+     * \param call_back if non-nullptr handle, call back called when attribute data
+     *                  is added.
+     */
+    void
+    fill_rounded_rect(const PainterRoundedRectShader &shader, const PainterData &draw,
+                      const RoundedRect &R,
+                      const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
+    /*!
+     * Draw a rounded rect anti-aliased using the default
+     * rounded rect shader.
+     * \param draw data for how to draw
+     * \param R rounded rect to draw
+     * \param call_back if non-nullptr handle, call back called when attribute data
+     *                  is added.
+     */
+    void
+    fill_rounded_rect(const PainterData &draw, const RoundedRect &R,
+                      const reference_counted_ptr<PainterPacker::DataCallBack> &call_back = reference_counted_ptr<PainterPacker::DataCallBack>());
+
     /*!
      * Draw generic attribute data.
      * \param shader shader with which to draw data
@@ -825,6 +996,24 @@ namespace fastuidraw
     void
     queue_action(const reference_counted_ptr<const PainterDraw::Action> &action);
 
+    /*!
+     * Set if draws are to be state sorted, see
+     * PainterPacker::state_sort(bool). An application
+     * should enable state sorting only around drawing
+     * content that does not overlap or is opaque. The
+     * occluders of clip-out operations and the anti-aliasing
+     * passes of strokes are never moved across.
+     * \param v if true, enable state sorting
+     */
+    void
+    state_sort(bool v);
+
+    /*!
+     * Returns the value set by state_sort(bool).
+     */
+    bool
+    state_sort(void) const;
+
     /*!
      * Returns a stat on how much data the Packer has
      * handled since the last call to begin().
@@ -833,6 +1022,16 @@ namespace fastuidraw
     unsigned int
     query_stat(enum PainterPacker::stats_t st) const;
 
+    /*!
+     * Returns the number of glyphs that draw_glyphs() did not
+     * draw because they were in a bin of a BinnedGlyphRun that
+     * was entirely clipped, since the last call to begin().
+     * The glyphs culled by a Painter passed to submit_sub() are
+     * added to the value at submit_sub().
+     */
+    unsigned int
+    number_culled_glyphs(void) const;
+
     /*!
      * Return the z-depth value that the next item will have.
      */
@@ -899,6 +1098,8 @@ namespace fastuidraw
     register_shader(const PainterShaderSet &p);
 
   private:
+    void
+    begin_common(const reference_counted_ptr<PainterBackend::Surface> &surface);
 
     void *m_d;
   };
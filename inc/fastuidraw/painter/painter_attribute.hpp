@@ -53,6 +53,142 @@ namespace fastuidraw
     uvec4 m_attrib2;
   };
 
+  /*!
+   * \brief
+   * A PainterCompactAttribute is the 16-bit quantized form of
+   * a PainterAttribute together with its header location for
+   * the attribute layouts of the glyph and fill item shaders.
+   * PainterPacker converts the attributes of a draw to compact
+   * attributes when the PainterItemShader of the draw declares
+   * a compact layout (see PainterItemShader::compact_layout())
+   * and the PainterDraw provides PainterDraw::m_compact_attributes.
+   * If an attribute cannot be realized by the compact layout,
+   * the draw uses PainterAttribute values instead.
+   */
+  class PainterCompactAttribute
+  {
+  public:
+    /*!
+     * \brief
+     * Enumeration of the attribute layouts that have a compact form.
+     */
+    enum layout_t
+      {
+        /*!
+         * The attributes have no compact form
+         */
+        no_compact_layout,
+
+        /*!
+         * Layout of the attributes of filled paths:
+         * PainterAttribute::m_attrib0.xy is the position
+         * and all other fields are zero.
+         */
+        fill_layout,
+
+        /*!
+         * Layout of the attributes of glyphs as packed by
+         * PainterAttributeDataFillerGlyphs:
+         *  - PainterAttribute::m_attrib0 is the texel locations
+         *    in the primary and secondary atlas
+         *  - PainterAttribute::m_attrib1.xy is the position and
+         *    PainterAttribute::m_attrib1.zw is zero
+         *  - PainterAttribute::m_attrib2.x is zero,
+         *    PainterAttribute::m_attrib2.y is the geometry offset
+         *    and PainterAttribute::m_attrib2.zw are the layers in
+         *    the primary and secondary atlas
+         */
+        glyph_layout,
+      };
+
+    /*!
+     * \brief
+     * Enumeration describing the encoding of \ref m_header.
+     */
+    enum header_encoding_t
+      {
+        /*!
+         * Bit set in \ref m_header to indicate that the
+         * attribute is a PainterCompactAttribute.
+         */
+        compact_bit = 31u,
+
+        /*!
+         * Bit set in \ref m_header to indicate that the
+         * attribute is packed with \ref glyph_layout;
+         * if not set, the attribute is packed with
+         * \ref fill_layout.
+         */
+        glyph_layout_bit = 30u,
+
+        /*!
+         * Number of bits of \ref m_header that store the
+         * header location; header locations must be less
+         * than 2^number_header_location_bits.
+         */
+        number_header_location_bits = 30u,
+      };
+
+    /*!
+     * \brief
+     * Enumeration describing the quantization of \ref m_position.
+     */
+    enum position_quantization_t
+      {
+        /*!
+         * Number of fractional bits of \ref m_position, i.e.
+         * the position is stored in units of 1/8.
+         */
+        position_fraction_bits = 3u,
+      };
+
+    /*!
+     * Sets the fields of this PainterCompactAttribute from a
+     * PainterAttribute. Returns false if the attribute cannot
+     * be realized by the named layout, for example if a position
+     * is out of the range of \ref m_position or if a texel or
+     * layer is not an integer that fits in 16-bits.
+     * \param layout layout of the attribute src
+     * \param src attribute to convert
+     * \param header_location header location of the attribute,
+     *                        must be less than
+     *                        2^number_header_location_bits.
+     */
+    bool
+    pack(enum layout_t layout, const PainterAttribute &src,
+         uint32_t header_location);
+
+    /*!
+     * Position in item coordinates in units of
+     * 2^-position_fraction_bits
+     */
+    vecN<int16_t, 2> m_position;
+
+    /*!
+     * For \ref glyph_layout, the texel locations in the
+     * primary and secondary atlas, unused for \ref fill_layout
+     */
+    vecN<int16_t, 4> m_texel;
+
+    /*!
+     * For \ref glyph_layout, the layers in the primary and
+     * secondary atlas, unused for \ref fill_layout
+     */
+    vecN<int16_t, 2> m_layer;
+
+    /*!
+     * For \ref glyph_layout, the geometry offset of the
+     * glyph, unused for \ref fill_layout
+     */
+    uint32_t m_data;
+
+    /*!
+     * The header location of the attribute encoded
+     * as described by \ref header_encoding_t
+     */
+    uint32_t m_header;
+  };
+
   /*!
    * \brief
    * Typedef for the index type used by PainterPacker
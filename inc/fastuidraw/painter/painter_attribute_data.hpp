@@ -148,6 +148,24 @@ namespace fastuidraw
     range_type<int>
     z_range(unsigned int i) const;
 
+    /*!
+     * Returns the number of bytes used by the attribute,
+     * index and chunk data of this PainterAttributeData.
+     */
+    uint64_t
+    memory_usage(void) const;
+
+    /*!
+     * Returns the glyphs that this PainterAttributeData keeps
+     * pinned (see Glyph::pin()), i.e. the glyphs returned by
+     * PainterAttributeDataFiller::packed_glyphs() of the filler
+     * last passed to set_data(). They are unpinned when the
+     * PainterAttributeData is destroyed or set_data() is called
+     * again.
+     */
+    c_array<const Glyph>
+    pinned_glyphs(void) const;
+
   private:
     void *m_d;
   };
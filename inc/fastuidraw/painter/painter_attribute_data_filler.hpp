@@ -22,6 +22,7 @@
 #include <fastuidraw/util/util.hpp>
 #include <fastuidraw/util/c_array.hpp>
 #include <fastuidraw/painter/painter_attribute.hpp>
+#include <fastuidraw/text/glyph.hpp>
 
 namespace fastuidraw
 {
@@ -90,6 +91,21 @@ namespace fastuidraw
               c_array<c_array<const PainterIndex> > index_chunks,
               c_array<range_type<int> > zranges,
               c_array<int> index_adjusts) const = 0;
+
+    /*!
+     * To be optionally implemented by a derived class to return
+     * the glyphs whose atlas locations fill_data() packed into
+     * the attributes; PainterAttributeData::set_data() pins
+     * (see Glyph::pin()) these glyphs for as long as it holds
+     * the data. Called after fill_data(). Default implementation
+     * returns an empty array.
+     */
+    virtual
+    c_array<const Glyph>
+    packed_glyphs(void) const
+    {
+      return c_array<const Glyph>();
+    }
   };
 /*! @} */
 }
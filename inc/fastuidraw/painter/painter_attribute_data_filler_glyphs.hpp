@@ -44,7 +44,10 @@ namespace fastuidraw
    * successfully uploaded to its GlyphCache. That value can be
    * queried by number_glyphs(). If all glyphs are uploaded or
    * successfully loaded, then number_glyphs() returns the number
-   * glyph in the glyph run. Data for glyphs is packed as follows:
+   * glyph in the glyph run. The glyphs that are filled stay pinned
+   * (see Glyph::pin()) for as long as the PainterAttributeData holds
+   * the data, so that their GlyphCache does not evict them from the
+   * GlyphAtlas. Data for glyphs is packed as follows:
    *   - PainterAttribute::m_attrib0 .xy -> xy-texel location in primary atlas (float)
    *   - PainterAttribute::m_attrib0 .zw -> xy-texel location in secondary atlas (float)
    *   - PainterAttribute::m_attrib1 .xy -> position in item coordinates (float)
@@ -136,6 +139,10 @@ namespace fastuidraw
               c_array<range_type<int> > zranges,
               c_array<int> index_adjusts) const;
 
+    virtual
+    c_array<const Glyph>
+    packed_glyphs(void) const;
+
   private:
     void *m_d;
   };
@@ -32,7 +32,18 @@ namespace fastuidraw
    * \brief
    * Class to specify dashed stroking parameters, data is packed
    * as according to PainterDashedStrokeParams::stroke_data_offset_t.
-   * Data for dashing is packed [TODO describe].
+   * Data for dashing is packed in the blocks after the static
+   * data: the ends of the intervals of the dash pattern, i.e.
+   * the running sums of the draw and space lengths, are the
+   * keys of an implicit search tree where each node is one
+   * block of the data store. Thus with an alignment of N, each
+   * node holds N keys and has N + 1 children, the j'th child of
+   * node k being node k * (N + 1) + 1 + j. The keys are placed
+   * in the nodes by an in-order traversal and the last node is
+   * padded with values larger than the length of the pattern.
+   * After the nodes come as many blocks holding, for each key,
+   * the index of its interval (packed as uint). A search reads
+   * one block per level of the tree, see compute_interval().
    */
   class PainterDashedStrokeParams:public PainterItemShaderData
   {
@@ -184,6 +195,37 @@ namespace fastuidraw
     PainterDashedStrokeParams&
     dash_pattern(c_array<const DashPatternElement> v);
 
+    /*!
+     * Computes on the CPU the same values as the GLSL function
+     * generated by glsl::code::compute_interval() does, i.e.
+     * finds the interval of a repeated dash pattern on which a
+     * distance lies by searching the data as packed by a
+     * PainterDashedStrokeParams. Returns +1.0 if the distance is
+     * in a draw interval and -1.0 if it is in a skip interval.
+     * \param alignment alignment of the data store, see
+     *                  PainterBackend::ConfigurationBase::alignment()
+     * \param intervals the data packed for the dash pattern, i.e. the
+     *                  data packed by pack_data() starting at the block
+     *                  after the static data
+     * \param total_distance length of the dash pattern
+     * \param first_interval_start start of the first interval
+     * \param in_distance distance value to evaluate
+     * \param number_intervals number of intervals of the dash pattern,
+     *                         i.e. the value packed at
+     *                         \ref stroke_number_intervals_offset
+     * \param[out] out_interval_id ID of the interval, -1 if not found
+     * \param[out] out_interval_begin where the interval begins
+     * \param[out] out_interval_end where the interval ends
+     */
+    static
+    float
+    compute_interval(unsigned int alignment,
+                     c_array<const generic_data> intervals,
+                     float total_distance, float first_interval_start,
+                     float in_distance, unsigned int number_intervals,
+                     int *out_interval_id,
+                     float *out_interval_begin, float *out_interval_end);
+
     /*!
      * Returns a StrokingDataSelectorBase suitable for
      * PainterDashedStrokeParams.
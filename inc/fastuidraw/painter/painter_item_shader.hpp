@@ -19,6 +19,7 @@
 
 #pragma once
 #include <fastuidraw/painter/painter_shader.hpp>
+#include <fastuidraw/painter/painter_attribute.hpp>
 
 namespace fastuidraw
 {
@@ -40,7 +41,8 @@ namespace fastuidraw
      * Ctor for a PainterItemShader with no sub-shaders.
      */
     PainterItemShader(void):
-      PainterShader()
+      PainterShader(),
+      m_compact_layout(PainterCompactAttribute::no_compact_layout)
     {}
 
     /*!
@@ -53,7 +55,8 @@ namespace fastuidraw
      */
     explicit
     PainterItemShader(unsigned int num_sub_shaders):
-      PainterShader(num_sub_shaders)
+      PainterShader(num_sub_shaders),
+      m_compact_layout(PainterCompactAttribute::no_compact_layout)
     {}
 
     /*!
@@ -64,8 +67,39 @@ namespace fastuidraw
      */
     PainterItemShader(unsigned int sub_shader,
                       reference_counted_ptr<PainterItemShader> parent):
-      PainterShader(sub_shader, parent)
+      PainterShader(sub_shader, parent),
+      m_compact_layout(PainterCompactAttribute::no_compact_layout)
     {}
+
+    /*!
+     * Returns the layout of the attributes the PainterItemShader
+     * consumes that PainterPacker may send as PainterCompactAttribute
+     * values. A sub-shader returns the value of its parent.
+     * Default value is PainterCompactAttribute::no_compact_layout.
+     */
+    enum PainterCompactAttribute::layout_t
+    compact_layout(void) const
+    {
+      return (parent()) ?
+        static_cast<const PainterItemShader*>(parent().get())->compact_layout() :
+        m_compact_layout;
+    }
+
+    /*!
+     * Set the value returned by compact_layout(void) const.
+     * Only set a layout whose description in
+     * PainterCompactAttribute::layout_t matches how the
+     * shader reads its attributes.
+     */
+    PainterItemShader&
+    compact_layout(enum PainterCompactAttribute::layout_t v)
+    {
+      m_compact_layout = v;
+      return *this;
+    }
+
+  private:
+    enum PainterCompactAttribute::layout_t m_compact_layout;
   };
 
 /*! @} */
@@ -78,12 +78,17 @@ namespace fastuidraw
    * already copied to PainterDraw::m_store.
    *
    * If already on a store, then rather than copying the data again, the data
-   * is reused. The object behind the handle is NOT thread safe. In addition
-   * the underlying reference count is not either. Hence any access
-   * (even dtor, copy ctor and equality operator) on a fixed object cannot
-   * be done from multiple threads simutaneously. A fixed
-   * PainterPackedValue can be used by different Painter (and PainterPacker)
-   * objects subject to the condition that the data store alignment (see
+   * is reused. The reference count of the underlying object is thread safe,
+   * hence PainterPackedValue objects referring to the same value can be
+   * created, copied and destroyed from multiple threads simutaneously; a
+   * single PainterPackedValue object however cannot be modified from one
+   * thread while accessed from another. The tracking of where the data was
+   * copied is not thread safe, thus at any time at most one PainterPacker
+   * that is not recording with PainterPacker::begin_sub() may use the value,
+   * whereas any number of PainterPacker objects recording with
+   * PainterPacker::begin_sub() may use it. A fixed PainterPackedValue can be
+   * used by different Painter (and PainterPacker) objects subject to the
+   * condition that the data store alignment (see
    * PainterPacker::Configuration::alignment()) is the same for each of these
    * objects.
    */
@@ -206,10 +211,13 @@ namespace fastuidraw
    * A PainterPackedValuePool can be used to create PainterPackedValue
    * objects.
    *
-   * Just like PainterPackedValue, PainterPackedValuePool is
-   * NOT thread safe, as such it is not a safe operation to use the
-   * same PainterPackedValuePool object from multiple threads at the
-   * same time. A fixed PainterPackedValuePool can create PainterPackedValue
+   * The methods of PainterPackedValuePool are thread safe; several
+   * threads can create PainterPackedValue objects from the same
+   * PainterPackedValuePool at the same time, for example to pack
+   * values on background threads while another thread draws with
+   * values already created. Creating a value does not take a lock
+   * except when all the slots of the pool are in use and a new
+   * block of slots is allocated. A fixed PainterPackedValuePool can create PainterPackedValue
    * objects used by different Painter (and PainterPacker) objects subject
    * to the condition that the data store alignment (see
    * PainterPacker::Configuration::alignment()) is the same for each of
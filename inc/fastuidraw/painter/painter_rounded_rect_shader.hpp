@@ -0,0 +1,155 @@
+/*!
+ * \file painter_rounded_rect_shader.hpp
+ * \brief file painter_rounded_rect_shader.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+
+#include <fastuidraw/painter/painter_item_shader.hpp>
+#include <fastuidraw/painter/painter_attribute.hpp>
+#include <fastuidraw/painter/rounded_rect.hpp>
+#include <fastuidraw/util/c_array.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A PainterRoundedRectShader holds the shaders for drawing
+   * and clipping against a RoundedRect. A RoundedRect is drawn
+   * as a single quad whose four attributes each carry the
+   * entire RoundedRect; the fragment shader computes the
+   * (approximate) signed distance to the boundary of the
+   * RoundedRect to give the coverage analytically. The
+   * attributes are as made by pack_attributes() and each
+   * attribute is:
+   * - PainterAttribute::m_attrib0 .xy -> position of the corner of the quad (float)
+   * - PainterAttribute::m_attrib0 .zw -> position of the opposite corner of the quad (float)
+   * - PainterAttribute::m_attrib1 .xy -> radii of RoundedRect::minx_miny_corner (float)
+   * - PainterAttribute::m_attrib1 .zw -> radii of RoundedRect::maxx_miny_corner (float)
+   * - PainterAttribute::m_attrib2 .xy -> radii of RoundedRect::minx_maxy_corner (float)
+   * - PainterAttribute::m_attrib2 .zw -> radii of RoundedRect::maxx_maxy_corner (float)
+   */
+  class PainterRoundedRectShader
+  {
+  public:
+    /*!
+     * Ctor
+     */
+    PainterRoundedRectShader(void);
+
+    /*!
+     * Copy ctor.
+     */
+    PainterRoundedRectShader(const PainterRoundedRectShader &obj);
+
+    ~PainterRoundedRectShader();
+
+    /*!
+     * Assignment operator.
+     */
+    PainterRoundedRectShader&
+    operator=(const PainterRoundedRectShader &rhs);
+
+    /*!
+     * Swap operation
+     * \param obj object with which to swap
+     */
+    void
+    swap(PainterRoundedRectShader &obj);
+
+    /*!
+     * Returns the PainterItemShader to draw a RoundedRect
+     * anti-aliased; the shader pushes the edges of the
+     * quad out by a pixel and emits a coverage value as
+     * the alpha of the fragment.
+     */
+    const reference_counted_ptr<PainterItemShader>&
+    item_shader(void) const;
+
+    /*!
+     * Set the value returned by item_shader(void) const.
+     * \param sh value to use
+     */
+    PainterRoundedRectShader&
+    item_shader(const reference_counted_ptr<PainterItemShader> &sh);
+
+    /*!
+     * Returns the PainterItemShader used to draw the occluder
+     * of Painter::clipOutRoundedRect(); the shader emits
+     * the fragments inside of the RoundedRect and discards
+     * those outside of it.
+     */
+    const reference_counted_ptr<PainterItemShader>&
+    clip_inside_shader(void) const;
+
+    /*!
+     * Set the value returned by clip_inside_shader(void) const.
+     * \param sh value to use
+     */
+    PainterRoundedRectShader&
+    clip_inside_shader(const reference_counted_ptr<PainterItemShader> &sh);
+
+    /*!
+     * Returns the PainterItemShader used to draw the occluder
+     * of Painter::clipInRoundedRect(); the shader emits the
+     * fragments outside of the RoundedRect (but within its
+     * bounding rectangle) and discards those inside of it.
+     */
+    const reference_counted_ptr<PainterItemShader>&
+    clip_outside_shader(void) const;
+
+    /*!
+     * Set the value returned by clip_outside_shader(void) const.
+     * \param sh value to use
+     */
+    PainterRoundedRectShader&
+    clip_outside_shader(const reference_counted_ptr<PainterItemShader> &sh);
+
+    /*!
+     * Pack the attributes and indices to draw a RoundedRect
+     * with the shaders of a PainterRoundedRectShader.
+     * \param R RoundedRect to pack, R.sanitized() is what is packed
+     * \param dst_attribs location to which to write the attributes
+     * \param dst_indices location to which to write the indices
+     */
+    static
+    void
+    pack_attributes(const RoundedRect &R,
+                    c_array<PainterAttribute> dst_attribs,
+                    c_array<PainterIndex> dst_indices);
+
+    /*!
+     * Number of attributes written by pack_attributes().
+     */
+    static const unsigned int number_attributes = 4;
+
+    /*!
+     * Number of indices written by pack_attributes().
+     */
+    static const unsigned int number_indices = 6;
+
+  private:
+    void *m_d;
+  };
+
+/*! @} */
+}
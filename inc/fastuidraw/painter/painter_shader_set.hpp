@@ -20,6 +20,7 @@
 #pragma once
 
 #include <fastuidraw/painter/painter_fill_shader.hpp>
+#include <fastuidraw/painter/painter_rounded_rect_shader.hpp>
 #include <fastuidraw/painter/painter_stroke_shader.hpp>
 #include <fastuidraw/painter/painter_glyph_shader.hpp>
 #include <fastuidraw/painter/painter_blend_shader_set.hpp>
@@ -140,6 +141,19 @@ namespace fastuidraw
     PainterShaderSet&
     fill_shader(const PainterFillShader &sh);
 
+    /*!
+     * Shader for drawing and clipping against a \ref RoundedRect.
+     */
+    const PainterRoundedRectShader&
+    rounded_rect_shader(void) const;
+
+    /*!
+     * Set the value returned by rounded_rect_shader(void) const.
+     * \param sh value to use
+     */
+    PainterShaderSet&
+    rounded_rect_shader(const PainterRoundedRectShader &sh);
+
     /*!
      * Blend shaders. If an element is a nullptr shader, then that
      * blend mode is not supported.
@@ -0,0 +1,169 @@
+/*!
+ * \file rounded_rect.hpp
+ * \brief file rounded_rect.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/vecN.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A RoundedRect represents an axis aligned rectangle
+   * whose corners are (possibly) replaced by quarter
+   * ellipses; each corner has its own x and y radii.
+   * A RoundedRect is drawn and clipped against by
+   * Painter::fill_rounded_rect(), Painter::clipInRoundedRect()
+   * and Painter::clipOutRoundedRect() which compute coverage
+   * analytically in the fragment shader instead of
+   * tessellating the boundary.
+   */
+  class RoundedRect
+  {
+  public:
+    /*!
+     * Enumeration to name the corners of a RoundedRect.
+     */
+    enum corner_t
+      {
+        minx_miny_corner, /*!< corner at (m_min_point.x(), m_min_point.y()) */
+        maxx_miny_corner, /*!< corner at (m_max_point.x(), m_min_point.y()) */
+        minx_maxy_corner, /*!< corner at (m_min_point.x(), m_max_point.y()) */
+        maxx_maxy_corner, /*!< corner at (m_max_point.x(), m_max_point.y()) */
+
+        number_corners
+      };
+
+    /*!
+     * Ctor, initializes as an empty rect with no rounding.
+     */
+    RoundedRect(void):
+      m_min_point(0.0f, 0.0f),
+      m_max_point(0.0f, 0.0f),
+      m_corner_radii(vec2(0.0f, 0.0f))
+    {}
+
+    /*!
+     * Ctor where all corners have the same radii.
+     * \param min_point value to which to initialize m_min_point
+     * \param max_point value to which to initialize m_max_point
+     * \param radii x and y radii of every corner
+     */
+    RoundedRect(const vec2 &min_point, const vec2 &max_point,
+                const vec2 &radii):
+      m_min_point(min_point),
+      m_max_point(max_point),
+      m_corner_radii(radii)
+    {}
+
+    /*!
+     * Ctor where all corners have the same radius
+     * in both x and y.
+     * \param min_point value to which to initialize m_min_point
+     * \param max_point value to which to initialize m_max_point
+     * \param radius x and y radius of every corner
+     */
+    RoundedRect(const vec2 &min_point, const vec2 &max_point,
+                float radius):
+      m_min_point(min_point),
+      m_max_point(max_point),
+      m_corner_radii(vec2(radius, radius))
+    {}
+
+    /*!
+     * Set the radii of a corner.
+     * \param c which corner
+     * \param radii x and y radii of the corner
+     */
+    RoundedRect&
+    corner_radii(enum corner_t c, const vec2 &radii)
+    {
+      m_corner_radii[c] = radii;
+      return *this;
+    }
+
+    /*!
+     * Returns the RoundedRect as drawn: the radii are
+     * clamped to be non-negative and, if the sum of the
+     * radii along a side exceeds the length of that side,
+     * all radii are scaled down uniformly so that they fit
+     * (in the same manner as CSS border-radius).
+     */
+    RoundedRect
+    sanitized(void) const
+    {
+      RoundedRect R(*this);
+      vec2 sz;
+      float f(1.0f);
+
+      sz = m_max_point - m_min_point;
+      for(unsigned int c = 0; c < number_corners; ++c)
+        {
+          R.m_corner_radii[c].x() = (R.m_corner_radii[c].x() > 0.0f) ? R.m_corner_radii[c].x() : 0.0f;
+          R.m_corner_radii[c].y() = (R.m_corner_radii[c].y() > 0.0f) ? R.m_corner_radii[c].y() : 0.0f;
+        }
+
+      f = compute_scale(f, sz.x(), R.m_corner_radii[minx_miny_corner].x() + R.m_corner_radii[maxx_miny_corner].x());
+      f = compute_scale(f, sz.x(), R.m_corner_radii[minx_maxy_corner].x() + R.m_corner_radii[maxx_maxy_corner].x());
+      f = compute_scale(f, sz.y(), R.m_corner_radii[minx_miny_corner].y() + R.m_corner_radii[minx_maxy_corner].y());
+      f = compute_scale(f, sz.y(), R.m_corner_radii[maxx_miny_corner].y() + R.m_corner_radii[maxx_maxy_corner].y());
+      if (f < 1.0f)
+        {
+          for(unsigned int c = 0; c < number_corners; ++c)
+            {
+              R.m_corner_radii[c] *= f;
+            }
+        }
+      return R;
+    }
+
+    /*!
+     * The min-corner of the bounding rectangle.
+     */
+    vec2 m_min_point;
+
+    /*!
+     * The max-corner of the bounding rectangle.
+     */
+    vec2 m_max_point;
+
+    /*!
+     * The x and y radii of each corner, indexed by \ref corner_t.
+     * A radius of zero in either coordinate makes the corner
+     * sharp.
+     */
+    vecN<vec2, number_corners> m_corner_radii;
+
+  private:
+    static
+    float
+    compute_scale(float current, float side, float sum)
+    {
+      return (sum > side && sum > 0.0f && side / sum < current) ?
+        side / sum :
+        current;
+    }
+  };
+
+/*! @} */
+}
@@ -0,0 +1,220 @@
+/*!
+ * \file simple_path.hpp
+ * \brief file simple_path.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/fastuidraw_memory.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/painter/painter_enums.hpp>
+#include <fastuidraw/painter/fill_rule.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A SimplePath is a set of closed polygonal contours so that
+   * the winding number of every point is either 0 or 1; the
+   * region of a SimplePath is the set of points with winding
+   * number 1. Because of this, the fill of a SimplePath is the
+   * same under all of the fill rules of PainterEnums::fill_rule_t
+   * except PainterEnums::complement_odd_even_fill_rule and
+   * PainterEnums::complement_nonzero_fill_rule.
+   *
+   * A SimplePath is made from the outline of the fill of a Path
+   * or from a boolean operation (see \ref boolean_op_t) applied
+   * to other SimplePath objects. The contours are computed on
+   * the CPU with the GLU tessellator from the line segments of
+   * a tessellation of the Path (see Path::tessellation(float)).
+   * A region that is infinite, such as the fill of a Path with
+   * a complement fill rule, cannot be represented by a SimplePath;
+   * the outline of such a fill is empty.
+   */
+  class SimplePath
+  {
+  public:
+    /*!
+     * \brief
+     * Enumeration to specify a boolean operation
+     * on the regions of SimplePath objects.
+     */
+    enum boolean_op_t
+      {
+        /*!
+         * The region of the result is the set of points
+         * that are in the region of any of the operands.
+         */
+        union_op,
+
+        /*!
+         * The region of the result is the set of points
+         * that are in the region of all of the operands.
+         */
+        intersection_op,
+
+        /*!
+         * The region of the result is the set of points
+         * that are in the region of an odd number of the
+         * operands.
+         */
+        xor_op,
+
+        /*!
+         * The region of the result is the set of points
+         * that are in the region of the first operand and
+         * not in the region of any of the other operands.
+         */
+        difference_op,
+      };
+
+    /*!
+     * Ctor, initializes the SimplePath as empty.
+     */
+    SimplePath(void);
+
+    /*!
+     * Ctor. Initializes the SimplePath as the outline of
+     * the fill of a Path with a fill rule.
+     * \param path Path whose fill to outline
+     * \param fill_rule fill rule to apply to path
+     * \param thresh value passed to Path::tessellation(float)
+     *               to select the tessellation of path from
+     *               which to take the line segments
+     */
+    SimplePath(const Path &path, enum PainterEnums::fill_rule_t fill_rule,
+               float thresh = -1.0f);
+
+    /*!
+     * Ctor. Initializes the SimplePath as the outline of
+     * the fill of a Path with a custom fill rule. The
+     * regions with winding number 0 are never part of the
+     * outline, regardless of the value of fill_rule(0).
+     * \param path Path whose fill to outline
+     * \param fill_rule custom fill rule to apply to path
+     * \param thresh value passed to Path::tessellation(float)
+     *               to select the tessellation of path from
+     *               which to take the line segments
+     */
+    SimplePath(const Path &path, const CustomFillRuleBase &fill_rule,
+               float thresh = -1.0f);
+
+    /*!
+     * Ctor. Initializes the SimplePath as the result of
+     * a boolean operation applied to a pair of SimplePath
+     * objects.
+     * \param a first operand
+     * \param b second operand
+     * \param op boolean operation to apply
+     */
+    SimplePath(const SimplePath &a, const SimplePath &b,
+               enum boolean_op_t op);
+
+    /*!
+     * Ctor. Initializes the SimplePath as the result of
+     * a boolean operation applied to an array of SimplePath
+     * objects.
+     * \param paths operands of the operation
+     * \param op boolean operation to apply
+     */
+    SimplePath(c_array<const SimplePath> paths,
+               enum boolean_op_t op);
+
+    /*!
+     * Copy ctor.
+     * \param obj value from which to copy
+     */
+    SimplePath(const SimplePath &obj);
+
+    ~SimplePath();
+
+    /*!
+     * Assignment operator
+     * \param rhs value from which to assign
+     */
+    SimplePath&
+    operator=(const SimplePath &rhs);
+
+    /*!
+     * Swaps the values of this SimplePath with another.
+     * \param obj object with which to swap
+     */
+    void
+    swap(SimplePath &obj);
+
+    /*!
+     * Returns true if and only if the region of
+     * the SimplePath is empty.
+     */
+    bool
+    empty(void) const;
+
+    /*!
+     * Returns the number of contours of the SimplePath.
+     */
+    unsigned int
+    number_contours(void) const;
+
+    /*!
+     * Returns the points of a contour of the SimplePath;
+     * the contour is closed, i.e. there is an edge from
+     * the last point to the first point. The contours
+     * bounding the region are oriented so that the region
+     * has winding number 1, i.e. an outer contour is
+     * counter-clockwise when the y-coordinate increases
+     * upwards and a contour of a hole is clockwise.
+     * \param C which contour, must be less than number_contours()
+     */
+    c_array<const vec2>
+    contour(unsigned int C) const;
+
+    /*!
+     * Returns the min-corner of the bounding box of the
+     * SimplePath. If the SimplePath is empty, returns
+     * (0, 0).
+     */
+    vec2
+    bounding_box_min(void) const;
+
+    /*!
+     * Returns the max-corner of the bounding box of the
+     * SimplePath. If the SimplePath is empty, returns
+     * (0, 0).
+     */
+    vec2
+    bounding_box_max(void) const;
+
+    /*!
+     * Returns the contours of the SimplePath as a Path
+     * made of line segments, for example to draw with
+     * Painter::fill_path() or to clip with
+     * Painter::clipInPath().
+     */
+    const Path&
+    path(void) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
@@ -341,6 +341,13 @@ public:
   const PainterAttributeData&
   arc_rounded_caps(void) const;
 
+  /*!
+   * Returns the number of bytes used by the attribute and
+   * index data of the joins and caps created so far.
+   */
+  uint64_t
+  memory_usage(void) const;
+
 private:
   void *m_d;
 };
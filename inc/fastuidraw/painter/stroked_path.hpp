@@ -190,6 +190,14 @@ public:
   const StrokedCapsJoins&
   caps_joins(void) const;
 
+  /*!
+   * Returns the number of bytes used by the attribute and
+   * index data of the edges and of the joins and caps
+   * created so far.
+   */
+  uint64_t
+  memory_usage(void) const;
+
 private:
   void *m_d;
 };
@@ -875,6 +875,21 @@ public:
   Path&
   add_contour(const reference_counted_ptr<const PathContour> &contour);
 
+  /*!
+   * Replaces a PathContour of this Path, typically to edit the
+   * Path. Nothing is done if contour is not ended or if the
+   * PathContour being replaced is not ended. The tessellations
+   * made (see tessellation()) after the replacement make their
+   * TessellatedPath::filled() from the FilledPath of the
+   * tessellations made before it (see TessellatedPath::fill_from()),
+   * so that only the portion of the fill near the changed contour
+   * is recomputed.
+   * \param i index of the contour to replace (0 <= i < number_contours())
+   * \param contour PathContour to place at index i
+   */
+  Path&
+  replace_contour(unsigned int i, const reference_counted_ptr<const PathContour> &contour);
+
   /*!
    * Add all the ended PathContour objects of a Path into this Path.
    * \param path Path to add
@@ -966,6 +981,65 @@ public:
   const reference_counted_ptr<const TessellatedPath>&
   arc_tessellation(void) const;
 
+  /*!
+   * Returns the number of bytes used by the tessellations of
+   * this Path made so far by tessellation() and arc_tessellation(),
+   * including the attribute and index data made so far of their
+   * TessellatedPath::stroked() and TessellatedPath::filled().
+   */
+  uint64_t
+  memory_usage(void) const;
+
+  /*!
+   * Set the budget, in bytes, for the tessellations (see tessellation()
+   * and arc_tessellation()) of all Path objects together, as measured
+   * by TessellatedPath::memory_usage(). The budget is only applied by
+   * enforce_tessellation_budget(); tessellation() and arc_tessellation()
+   * never release tessellations. A value of 0, the default, indicates
+   * no budget.
+   * \param v budget in bytes
+   */
+  static
+  void
+  tessellation_memory_budget(uint64_t v);
+
+  /*!
+   * Returns the value set by tessellation_memory_budget(uint64_t).
+   */
+  static
+  uint64_t
+  tessellation_memory_budget(void);
+
+  /*!
+   * Returns the number of bytes used by the tessellations of all
+   * Path objects as measured by the last call to
+   * enforce_tessellation_budget(); returns 0 if there is no budget.
+   * A tessellation shared by copies of a Path is counted once.
+   */
+  static
+  uint64_t
+  tessellation_memory_usage(void);
+
+  /*!
+   * If there is a budget (see tessellation_memory_budget(uint64_t)),
+   * measure the tessellations of all Path objects returned since the
+   * last call, including the data made from them by
+   * TessellatedPath::stroked() and TessellatedPath::filled(), and
+   * release the least recently returned tessellations, of any Path,
+   * while over budget. A released tessellation is made again when it
+   * is next needed; a reference_counted_ptr to it held elsewhere
+   * keeps it alive. This method must not
+   * be called while another thread calls tessellation() or
+   * arc_tessellation() of any Path or uses the references they
+   * returned; a typical application calls it from one thread at the
+   * end of each frame. The references returned by tessellation() and
+   * arc_tessellation() stay valid until the next call to this method
+   * (or until the Path is modified or destroyed).
+   */
+  static
+  void
+  enforce_tessellation_budget(void);
+
 private:
   void *m_d;
 };
@@ -516,6 +516,29 @@ public:
   const reference_counted_ptr<const FilledPath>&
   filled(void) const;
 
+  /*!
+   * Specify a TessellatedPath, typically of the Path before
+   * an edit, from which to make filled() incrementally. When
+   * filled() is first called, if prev has made its FilledPath,
+   * the FilledPath is made with the ctor FilledPath(const
+   * TessellatedPath&, const FilledPath&) sharing the data of
+   * the FilledPath of prev instead of being made from scratch;
+   * the FilledPath of prev is not modified. Has no effect if
+   * filled() was already called or if either TessellatedPath
+   * has arcs.
+   * \param prev TessellatedPath whose FilledPath to share data from
+   */
+  void
+  fill_from(const reference_counted_ptr<const TessellatedPath> &prev) const;
+
+  /*!
+   * Returns the number of bytes used by the segment data of
+   * this TessellatedPath and by the attribute and index data
+   * created so far of stroked() and filled().
+   */
+  uint64_t
+  memory_usage(void) const;
+
 private:
   TessellatedPath(Refiner *p, float threshhold,
                   unsigned int additional_recursion_count);
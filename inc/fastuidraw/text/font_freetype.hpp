@@ -22,6 +22,7 @@
 #include <fastuidraw/text/font.hpp>
 #include <fastuidraw/text/freetype_lib.hpp>
 #include <fastuidraw/text/freetype_face.hpp>
+#include <fastuidraw/text/glyph_render_data_file_cache.hpp>
 
 namespace fastuidraw
 {
@@ -123,6 +124,25 @@ namespace fastuidraw
       RenderParams&
       curve_pair_pixel_size(unsigned int v);
 
+      /*!
+       * If non-null, the GlyphRenderDataFileCache from which to
+       * take the rendering data of distance field and curve pair
+       * glyphs and in which to store them on a miss. Only used
+       * for fonts whose font file can be read whole through
+       * FT_Load_Sfnt_Table() (i.e. TrueType and OpenType fonts),
+       * since the file contents are part of the key. Initial
+       * value is nullptr.
+       */
+      const reference_counted_ptr<GlyphRenderDataFileCache>&
+      render_data_file_cache(void) const;
+
+      /*!
+       * Set the value returned by render_data_file_cache(void) const.
+       * \param v value
+       */
+      RenderParams&
+      render_data_file_cache(const reference_counted_ptr<GlyphRenderDataFileCache> &v);
+
     private:
       void *m_d;
     };
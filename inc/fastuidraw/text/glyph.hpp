@@ -138,11 +138,39 @@ namespace fastuidraw
      * If returns \ref routine_fail, then the GlyphCache
      * on which the glyph resides needs to be cleared
      * first. If the glyph is already uploaded returns
-     * immediately with \ref routine_success.
+     * immediately with \ref routine_success. If the
+     * GlyphAtlas is full, glyphs of the GlyphCache not
+     * used in the current frame and not pinned are evicted
+     * (see GlyphCache::begin_frame() and pin()) before
+     * failing. Marks
+     * the glyph as used in the current frame.
      */
     enum return_code
     upload_to_atlas(void) const;
 
+    /*!
+     * Pin the glyph so that the GlyphCache on which it resides
+     * does not evict it from the GlyphAtlas to make room for
+     * other glyphs, regardless of GlyphCache::begin_frame().
+     * Pins nest: each call to pin() must be matched by a call
+     * to unpin(). PainterAttributeData::set_data() pins the
+     * glyphs packed by a PainterAttributeDataFillerGlyphs for
+     * as long as the PainterAttributeData holds the data.
+     * GlyphCache::clear_atlas(), GlyphCache::clear_cache() and
+     * GlyphCache::delete_glyph() remove a glyph from the atlas
+     * even if it is pinned. Like the methods of GlyphCache,
+     * pin() and unpin() are not thread safe.
+     */
+    void
+    pin(void) const;
+
+    /*!
+     * Remove a pin added by pin(). Has no effect if the
+     * glyph was removed from its GlyphCache after pin().
+     */
+    void
+    unpin(void) const;
+
     /*!
      * Returns the path of the Glyph; the path is in
      * coordinates of the glyph with the convention
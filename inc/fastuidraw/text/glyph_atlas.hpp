@@ -229,11 +229,56 @@ namespace fastuidraw
    * an application. Ideally, all glyph data is placed into a
    * single GlyphAtlas. Methods of GlyphAtlas are thread
    * safe, locked behind a mutex of the GlyphAtlas.
+   *
+   * The data passed to allocate() and allocate_geometry_data()
+   * is not written to the backing stores until flush(). At
+   * flush(), the texel writes to each layer are coalesced into
+   * a few writes of regions containing them, each region at
+   * least half covered by the writes, and writes to adjacent
+   * geometry data are coalesced into a single write.
+   * To that end, a GlyphAtlas keeps a copy in host memory of
+   * each layer of the texel store to which it has written.
    */
   class GlyphAtlas:
     public reference_counted<GlyphAtlas>::default_base
   {
   public:
+    /*!
+     * Enumeration to specify a counter of a GlyphAtlas.
+     */
+    enum counter_t
+      {
+        /*!
+         * Number of calls made to
+         * GlyphAtlasTexelBackingStoreBase::set_data()
+         * by flush().
+         */
+        texel_upload_counter,
+
+        /*!
+         * Number of bytes passed to
+         * GlyphAtlasTexelBackingStoreBase::set_data()
+         * by flush().
+         */
+        texel_upload_bytes_counter,
+
+        /*!
+         * Number of calls made to
+         * GlyphAtlasGeometryBackingStoreBase::set_values()
+         * by flush().
+         */
+        geometry_upload_counter,
+
+        /*!
+         * Number of bytes passed to
+         * GlyphAtlasGeometryBackingStoreBase::set_values()
+         * by flush().
+         */
+        geometry_upload_bytes_counter,
+
+        number_counters
+      };
+
     /*!
      * \brief
      * A Padding object holds how much of the data allocated
@@ -319,7 +364,10 @@ namespace fastuidraw
     clear(void);
 
     /*!
-     * Calls GlyphAtlasTexelBackingStoreBase::flush() on
+     * Writes the data passed to allocate() and
+     * allocate_geometry_data() since the last call to
+     * the backing stores and then calls
+     * GlyphAtlasTexelBackingStoreBase::flush() on
      * the texel backing store (see texel_store())
      * and GlyphAtlasGeometryBackingStoreBase::flush() on
      * the geometry backing store (see geometry_store()).
@@ -327,6 +375,20 @@ namespace fastuidraw
     void
     flush(void) const;
 
+    /*!
+     * Returns the value of a counter since construction
+     * or the last call to reset_counters().
+     * \param tp which counter
+     */
+    uint64_t
+    counter(enum counter_t tp) const;
+
+    /*!
+     * Set all counters to zero.
+     */
+    void
+    reset_counters(void);
+
     /*!
      * Returns the texel store for this GlyphAtlas.
      */
@@ -36,16 +36,71 @@ namespace fastuidraw
    * A GlyphCache represents a cache of glyphs and manages the uploading
    * of the data to a GlyphAtlas. Methods are reentrant but NOT thread
    * safe.
+   *
+   * A GlyphCache tracks for each glyph the last frame (see begin_frame())
+   * in which the glyph was fetched or uploaded. When the GlyphAtlas
+   * does not have room to upload a glyph, the GlyphCache releases the
+   * atlas room of the least recently used glyphs that were not used in
+   * the current frame and tries again; the evicted glyphs stay in the
+   * cache and are re-uploaded when next used. Since begin_frame() is
+   * never called implicitly, a GlyphCache whose begin_frame() is never
+   * called never evicts glyphs.
+   *
+   * Attribute data of a glyph holds the location of the glyph on the
+   * GlyphAtlas, so the glyph must not be evicted for as long as the
+   * attribute data is drawn. Glyphs that are pinned (see Glyph::pin())
+   * are never evicted; a PainterAttributeData filled by a \ref
+   * PainterAttributeDataFillerGlyphs (and thus a \ref BinnedGlyphRun)
+   * pins its glyphs for as long as it holds the data and a \ref
+   * PainterDisplayList keeps the glyphs it draws pinned. An application
+   * that packs the attribute data of glyphs by other means and keeps it
+   * across frames must pin those glyphs, call Glyph::upload_to_atlas()
+   * on them each frame or not call begin_frame(). Pins do not protect
+   * against clear_atlas(), clear_cache() or delete_glyph(); attribute
+   * data of the glyphs must be filled again after those.
    */
   class GlyphCache:public reference_counted<GlyphCache>::default_base
   {
   public:
+    /*!
+     * Enumeration to specify a counter of a GlyphCache.
+     */
+    enum counter_t
+      {
+        /*!
+         * Number of times fetch_glyph() or fetch_glyphs()
+         * found the glyph already in the cache.
+         */
+        hit_counter,
+
+        /*!
+         * Number of times fetch_glyph() or fetch_glyphs()
+         * needed to create the glyph.
+         */
+        miss_counter,
+
+        /*!
+         * Number of times a glyph was removed from the
+         * GlyphAtlas to make room for another glyph.
+         */
+        eviction_counter,
+
+        number_counters
+      };
+
     /*!
      * Ctor
      * \param patlas GlyphAtlas to store glyph data
+     * \param num_prefetch_threads number of threads used to generate
+     *                             glyph data for prefetch(); a value
+     *                             of 0 indicates to use the number of
+     *                             hardware threads. The threads are
+     *                             only created on the first call to
+     *                             prefetch().
      */
     explicit
-    GlyphCache(reference_counted_ptr<GlyphAtlas> patlas);
+    GlyphCache(reference_counted_ptr<GlyphAtlas> patlas,
+               unsigned int num_prefetch_threads = 0);
 
     ~GlyphCache();
 
@@ -59,6 +114,64 @@ namespace fastuidraw
                 const reference_counted_ptr<const FontBase> &font,
                 uint32_t glyph_code);
 
+    /*!
+     * Fetch, and if necessay create and store, a sequence of
+     * glyphs all from the same font and with the same GlyphRender.
+     * Equivalent to calling fetch_glyph() for each element of
+     * glyph_codes, but the portion of the lookup that depends only
+     * on the font and renderer is performed once for the entire
+     * sequence.
+     * \param render specifies how to render the glyphs
+     * \param font font from which to take the glyphs
+     * \param glyph_codes glyph codes of the glyphs to fetch
+     * \param out_glyphs location to which to write the glyphs,
+     *                   must be the same size as glyph_codes
+     */
+    void
+    fetch_glyphs(GlyphRender render,
+                 const reference_counted_ptr<const FontBase> &font,
+                 c_array<const uint32_t> glyph_codes,
+                 c_array<Glyph> out_glyphs);
+
+    /*!
+     * Start generating, in the threads of this GlyphCache, the
+     * rendering data of a sequence of glyphs all from the same
+     * font and with the same GlyphRender. The method returns
+     * immediately with a ticket to pass to prefetch_complete()
+     * and wait_prefetch(). Once the generation of a prefetch
+     * is complete, the glyphs are placed into the GlyphCache
+     * by the next call to wait_prefetch(), fetch_glyph(),
+     * fetch_glyphs(), add_glyph() or prefetch(); until then
+     * fetch_glyph() generates a glyph of a pending prefetch
+     * itself. Glyph codes already in the cache are skipped.
+     * FontBase::compute_rendering_data() of the font must be
+     * thread safe, as is the case for \ref FontFreeType.
+     * \param render specifies how to render the glyphs
+     * \param font font from which to take the glyphs
+     * \param glyph_codes glyph codes of the glyphs to generate
+     */
+    unsigned int
+    prefetch(GlyphRender render,
+             const reference_counted_ptr<const FontBase> &font,
+             c_array<const uint32_t> glyph_codes);
+
+    /*!
+     * Returns true if the generation of the glyphs of a
+     * prefetch() is complete; does not block.
+     * \param ticket return value of prefetch()
+     */
+    bool
+    prefetch_complete(unsigned int ticket) const;
+
+    /*!
+     * Block until the generation of the glyphs of a prefetch()
+     * is complete and place all completed prefetches into the
+     * GlyphCache.
+     * \param ticket return value of prefetch()
+     */
+    void
+    wait_prefetch(unsigned int ticket);
+
     /*!
      * Add a Glyph created with Glyph::create_glyph() to
      * this GlyphCache. Will fail if a Glyph with the
@@ -100,6 +213,31 @@ namespace fastuidraw
     void
     clear_cache(void);
 
+    /*!
+     * Mark the start of a new frame. Glyphs that are fetched or
+     * uploaded after the call are not eligible for eviction until
+     * the next call to begin_frame(). Only call begin_frame() when
+     * the attribute data of glyphs used before the call that are not
+     * pinned (see Glyph::pin()) is no longer going to be drawn without
+     * first calling Glyph::upload_to_atlas() again.
+     */
+    void
+    begin_frame(void);
+
+    /*!
+     * Returns the value of a counter since construction
+     * or the last call to reset_counters().
+     * \param tp which counter
+     */
+    unsigned int
+    counter(enum counter_t tp) const;
+
+    /*!
+     * Set all counters to zero.
+     */
+    void
+    reset_counters(void);
+
   private:
     void *m_d;
   };
@@ -0,0 +1,192 @@
+/*!
+ * \file glyph_render_data_file_cache.hpp
+ * \brief file glyph_render_data_file_cache.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/data_buffer_base.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Text
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A GlyphRenderDataFileCache is a persistent store of generated
+   * glyph rendering data backed by a file. It is used by a font
+   * (see FontFreeType::RenderParams::render_data_file_cache()) to
+   * skip generating the rendering data of a glyph that was already
+   * generated by a previous run of the application.
+   *
+   * The file is versioned; a file written with a different version
+   * of the format, or on a machine with a different byte order, is
+   * ignored and replaced on save(). The file is laid out as a header,
+   * followed by an index of the entries, followed by the entry data,
+   * so that the data of an entry is used directly from the loaded
+   * file contents without parsing; an application can pass the
+   * contents of a memory mapped file to the ctor to avoid reading the
+   * file altogether. The methods fetch() and store() are thread safe.
+   */
+  class GlyphRenderDataFileCache:
+    public reference_counted<GlyphRenderDataFileCache>::default_base
+  {
+  public:
+    /*!
+     * \brief
+     * A key identifies an entry in a GlyphRenderDataFileCache.
+     */
+    class key
+    {
+    public:
+      key(void):
+        m_font_hash(0),
+        m_face_index(0),
+        m_glyph_code(0),
+        m_glyph_type(0),
+        m_pixel_size(0),
+        m_parameters(0)
+      {}
+
+      /*!
+       * Comparison operator for sorting.
+       * \param rhs value to which to compare
+       */
+      bool
+      operator<(const key &rhs) const;
+
+      /*!
+       * Hash of the contents of the font file.
+       */
+      uint64_t m_font_hash;
+
+      /*!
+       * Index of the face within the font file.
+       */
+      uint32_t m_face_index;
+
+      /*!
+       * Glyph code of the glyph.
+       */
+      uint32_t m_glyph_code;
+
+      /*!
+       * Value of \ref glyph_type of the rendering data.
+       */
+      uint32_t m_glyph_type;
+
+      /*!
+       * Pixel size at which the rendering data is generated.
+       */
+      uint32_t m_pixel_size;
+
+      /*!
+       * Any other value that affects the generated data,
+       * for example the bits of a floating point parameter.
+       */
+      uint32_t m_parameters;
+    };
+
+    /*!
+     * Ctor. Loads the entries of the named file if it exists
+     * and is valid.
+     * \param filename name of the file from which to load
+     *                 and to which to save
+     */
+    explicit
+    GlyphRenderDataFileCache(c_string filename);
+
+    /*!
+     * Ctor. Loads the entries from the given contents of
+     * the file instead of reading the file. The data
+     * returned by fetch() for those entries points into
+     * contents.
+     * \param filename name of the file to which to save
+     * \param contents contents of the file, typically the
+     *                 file memory mapped by the application
+     */
+    GlyphRenderDataFileCache(c_string filename,
+                             const reference_counted_ptr<const DataBufferBase> &contents);
+
+    /*!
+     * Dtor. If there are entries added by store() that have
+     * not been written to the file, calls save().
+     */
+    ~GlyphRenderDataFileCache();
+
+    /*!
+     * Returns the name of the file of this
+     * GlyphRenderDataFileCache.
+     */
+    c_string
+    filename(void) const;
+
+    /*!
+     * Fetch the data of an entry. Returns false if there
+     * is no entry for the key. The returned data stays
+     * valid for the lifetime of the GlyphRenderDataFileCache.
+     * \param K key of the entry
+     * \param out_data location to which to write the data of
+     *                 the entry
+     */
+    bool
+    fetch(const key &K, c_array<const uint8_t> *out_data) const;
+
+    /*!
+     * Add an entry. If there is already an entry for the
+     * key, the data is not changed. The data is written to
+     * the file by the next call to save().
+     * \param K key of the entry
+     * \param data data of the entry, the data is copied
+     */
+    void
+    store(const key &K, c_array<const uint8_t> data);
+
+    /*!
+     * Returns the number of entries.
+     */
+    unsigned int
+    number_entries(void) const;
+
+    /*!
+     * Returns the number of entries added by store()
+     * since the last call to save().
+     */
+    unsigned int
+    number_unsaved_entries(void) const;
+
+    /*!
+     * Write all entries to the file; the file is first
+     * written to a temporary file that then replaces the
+     * file, so that an interrupted save() does not leave
+     * a corrupt file. Does nothing if there are no unsaved
+     * entries.
+     */
+    enum return_code
+    save(void);
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
@@ -1,5 +1,5 @@
-FASTUIDRAW_DEPS_LIBS += $(shell freetype-config --libs)
-FASTUIDRAW_DEPS_STATIC_LIBS += $(shell freetype-config --static --libs)
+FASTUIDRAW_DEPS_LIBS += $(shell freetype-config --libs) -pthread
+FASTUIDRAW_DEPS_STATIC_LIBS += $(shell freetype-config --static --libs) -pthread
 
 FASTUIDRAW_BASE_CFLAGS = -std=c++11 -D_USE_MATH_DEFINES
 FASTUIDRAW_debug_BASE_CFLAGS = $(FASTUIDRAW_BASE_CFLAGS) -DFASTUIDRAW_DEBUG
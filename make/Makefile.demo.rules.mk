@@ -147,5 +147,73 @@ endef
 
 $(call demosapi,GL,$(BUILD_GL))
 $(call demosapi,GLES,$(BUILD_GLES))
+
+# Demos listed in CORE_DEMOS only use the core library: they do not
+# link against SDL or a GL backend and thus can run without a GPU.
+CORE_DEMO_release_CFLAGS = -O3 -fstrict-aliasing -Idemos/common $(shell ./fastuidraw-config.nodir --release --cflags --incdir=inc)
+CORE_DEMO_debug_CFLAGS = -g -Idemos/common $(shell ./fastuidraw-config.nodir --debug --cflags --incdir=inc)
+CORE_DEMO_release_LIBS = $(shell ./fastuidraw-config.nodir --release --libs --libdir=.)
+CORE_DEMO_debug_LIBS = $(shell ./fastuidraw-config.nodir --debug --libs --libdir=.)
+
+# $1 --> release or debug
+define coredemobuildrules
+$(eval
+build/demo/$(1)/core/%.o: %.cpp build/demo/$(1)/core/%.d fastuidraw-config.nodir
+	@mkdir -p $$(dir $$@)
+	$(CXX) $$(CORE_DEMO_$(1)_CFLAGS) -MT $$@ -MMD -MP -MF build/demo/$(1)/core/$$*.d  -c $$< -o $$@
+
+build/demo/$(1)/core/%.d: ;
+.PRECIOUS: build/demo/$(1)/core/%.d
+)
+endef
+
+# how to build each core demo:
+# $1 --> Demo name
+# $2 --> release or debug
+define coredemorule
+$(eval THISDEMO_$(1)_core_$(2)_SOURCES = $$($(1)_SOURCES) $$(CORE_DEMO_SOURCES)
+THISDEMO_$(1)_core_$(2)_DEPS = $$(addprefix build/demo/$(2)/core/, $$(patsubst %.cpp, %.d, $$(THISDEMO_$(1)_core_$(2)_SOURCES)))
+THISDEMO_$(1)_core_$(2)_OBJS = $$(addprefix build/demo/$(2)/core/, $$(patsubst %.cpp, %.o, $$(THISDEMO_$(1)_core_$(2)_SOURCES)))
+CLEAN_FILES += $$(THISDEMO_$(1)_core_$(2)_OBJS) $(1)-$(2) $(1)-$(2).exe
+SUPER_CLEAN_FILES += $$(THISDEMO_$(1)_core_$(2)_DEPS)
+ifneq ($(MAKECMDGOALS),clean)
+ifneq ($(MAKECMDGOALS),clean-all)
+ifneq ($(MAKECMDGOALS),targets)
+ifneq ($(MAKECMDGOALS),docs)
+ifneq ($(MAKECMDGOALS),clean-docs)
+ifneq ($(MAKECMDGOALS),install-docs)
+ifneq ($(MAKECMDGOALS),uninstall-docs)
+-include $$(THISDEMO_$(1)_core_$(2)_DEPS)
+endif
+endif
+endif
+endif
+endif
+endif
+endif
+demos-core-$(2): $(1)-$(2)
+.PHONY: demos-core-$(2)
+$(1): $(1)-$(2)
+.PHONY: $(1)
+$(1)-$(2): libFastUIDraw_$(2) $$(THISDEMO_$(1)_core_$(2)_OBJS)
+	$$(CXX) -o $$@ $$(THISDEMO_$(1)_core_$(2)_OBJS) $$(CORE_DEMO_$(2)_LIBS)
+)
+endef
+
+# $1 --> release or debug
+define coredemoset
+$(eval $(call coredemobuildrules,$(1))
+$(foreach demoname,$(CORE_DEMOS),$(call coredemorule,$(demoname),$(1)))
+demos-$(1): demos-core-$(1)
+)
+endef
+
+$(foreach demoname,$(CORE_DEMOS),$(call adddemotarget,$(demoname)))
+$(call coredemoset,release)
+$(call coredemoset,debug)
+demos-core: demos-core-release demos-core-debug
+.PHONY: demos-core
+TARGETLIST += demos-core
+
 demos: demos-debug demos-release
 all: demos
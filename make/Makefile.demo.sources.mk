@@ -30,5 +30,10 @@
 # sp		:= $(basename $(sp))
 # # End standard footer
 
+# A demo that only uses the core library, i.e. needs neither SDL
+# nor a GL/GLES context, adds its name to CORE_DEMOS instead of
+# DEMOS. Its executables are foo-release and foo-debug and they
+# are linked with the sources of CORE_DEMO_SOURCES of demos/common.
+
 dir := demos
 include $(dir)/Rules.mk
@@ -25,6 +25,9 @@ include $(dir)/Rules.mk
 dir := $(d)/glsl
 include $(dir)/Rules.mk
 
+dir := $(d)/cpu_backend
+include $(dir)/Rules.mk
+
 dir := $(d)/gl_backend
 include $(dir)/Rules.mk
 
@@ -0,0 +1,14 @@
+# Begin standard header
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+# End standard header
+
+FASTUIDRAW_SOURCES += $(call filelist, glyph_atlas_cpu.cpp image_cpu.cpp \
+	colorstop_atlas_cpu.cpp painter_backend_recorder.cpp \
+	painter_rasterizer.cpp)
+
+# Begin standard footer
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
+# End standard footer
@@ -0,0 +1,163 @@
+/*!
+ * \file colorstop_atlas_cpu.cpp
+ * \brief file colorstop_atlas_cpu.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/cpu_backend/colorstop_atlas_cpu.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class BackingStore:public fastuidraw::ColorStopBackingStore
+  {
+  public:
+    BackingStore(int w, int l):
+      fastuidraw::ColorStopBackingStore(w, l, true),
+      m_data(w * l, fastuidraw::u8vec4(0, 0, 0, 0))
+    {}
+
+    virtual
+    void
+    set_data(int x, int l, int w,
+             fastuidraw::c_array<const fastuidraw::u8vec4> data)
+    {
+      FASTUIDRAWassert(w >= 0 && static_cast<unsigned int>(w) <= data.size());
+      std::copy(data.begin(), data.begin() + w,
+                m_data.begin() + x + l * dimensions().x());
+    }
+
+    fastuidraw::c_array<const fastuidraw::u8vec4>
+    texels(void) const
+    {
+      return fastuidraw::make_c_array(m_data);
+    }
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore>
+    create(int w, int l)
+    {
+      BackingStore *p;
+      p = FASTUIDRAWnew BackingStore(w, l);
+      return fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore>(p);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers)
+    {
+      m_data.resize(dimensions().x() * new_num_layers, fastuidraw::u8vec4(0, 0, 0, 0));
+    }
+
+  private:
+    std::vector<fastuidraw::u8vec4> m_data;
+  };
+
+  class ColorStopAtlasCPUParamsPrivate
+  {
+  public:
+    ColorStopAtlasCPUParamsPrivate(void):
+      m_width(1024),
+      m_num_layers(32)
+    {}
+
+    int m_width;
+    int m_num_layers;
+  };
+
+  class ColorStopAtlasCPUPrivate
+  {
+  public:
+    explicit
+    ColorStopAtlasCPUPrivate(const fastuidraw::cpu::ColorStopAtlasCPU::params &P):
+      m_params(P)
+    {}
+
+    fastuidraw::cpu::ColorStopAtlasCPU::params m_params;
+  };
+}
+
+///////////////////////////////////////////////
+// fastuidraw::cpu::ColorStopAtlasCPU::params methods
+fastuidraw::cpu::ColorStopAtlasCPU::params::
+params(void)
+{
+  m_d = FASTUIDRAWnew ColorStopAtlasCPUParamsPrivate();
+}
+
+fastuidraw::cpu::ColorStopAtlasCPU::params::
+params(const params &obj)
+{
+  ColorStopAtlasCPUParamsPrivate *d;
+  d = static_cast<ColorStopAtlasCPUParamsPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ColorStopAtlasCPUParamsPrivate(*d);
+}
+
+fastuidraw::cpu::ColorStopAtlasCPU::params::
+~params()
+{
+  ColorStopAtlasCPUParamsPrivate *d;
+  d = static_cast<ColorStopAtlasCPUParamsPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::cpu::ColorStopAtlasCPU::params)
+setget_implement(fastuidraw::cpu::ColorStopAtlasCPU::params,
+                 ColorStopAtlasCPUParamsPrivate,
+                 int, width)
+setget_implement(fastuidraw::cpu::ColorStopAtlasCPU::params,
+                 ColorStopAtlasCPUParamsPrivate,
+                 int, num_layers)
+
+//////////////////////////////////////////////////////
+// fastuidraw::cpu::ColorStopAtlasCPU methods
+fastuidraw::cpu::ColorStopAtlasCPU::
+ColorStopAtlasCPU(const params &P):
+  fastuidraw::ColorStopAtlas(BackingStore::create(P.width(), P.num_layers()))
+{
+  m_d = FASTUIDRAWnew ColorStopAtlasCPUPrivate(P);
+}
+
+fastuidraw::cpu::ColorStopAtlasCPU::
+~ColorStopAtlasCPU()
+{
+  ColorStopAtlasCPUPrivate *d;
+  d = static_cast<ColorStopAtlasCPUPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::cpu::ColorStopAtlasCPU::params&
+fastuidraw::cpu::ColorStopAtlasCPU::
+param_values(void) const
+{
+  ColorStopAtlasCPUPrivate *d;
+  d = static_cast<ColorStopAtlasCPUPrivate*>(m_d);
+  return d->m_params;
+}
+
+fastuidraw::c_array<const fastuidraw::u8vec4>
+fastuidraw::cpu::ColorStopAtlasCPU::
+texels(void) const
+{
+  const BackingStore *p;
+  FASTUIDRAWassert(dynamic_cast<const BackingStore*>(backing_store().get()));
+  p = static_cast<const BackingStore*>(backing_store().get());
+  return p->texels();
+}
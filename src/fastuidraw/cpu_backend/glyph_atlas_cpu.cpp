@@ -0,0 +1,240 @@
+/*!
+ * \file glyph_atlas_cpu.cpp
+ * \brief file glyph_atlas_cpu.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/cpu_backend/glyph_atlas_cpu.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class TexelStoreCPU:public fastuidraw::GlyphAtlasTexelBackingStoreBase
+  {
+  public:
+    explicit
+    TexelStoreCPU(fastuidraw::ivec3 dims):
+      fastuidraw::GlyphAtlasTexelBackingStoreBase(dims, true),
+      m_data(dims.x() * dims.y() * dims.z(), 0u)
+    {}
+
+    virtual
+    void
+    set_data(int x, int y, int l, int w, int h,
+             fastuidraw::c_array<const uint8_t> data)
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      unsigned int dst;
+
+      FASTUIDRAWassert(data.size() >= static_cast<unsigned int>(w * h));
+      dst = x + dims.x() * y + dims.x() * dims.y() * l;
+      for(int row = 0; row < h; ++row, dst += dims.x())
+        {
+          fastuidraw::c_array<const uint8_t> src;
+          src = data.sub_array(row * w, w);
+          std::copy(src.begin(), src.end(), m_data.begin() + dst);
+        }
+    }
+
+    virtual
+    void
+    flush(void)
+    {}
+
+    fastuidraw::c_array<const uint8_t>
+    texels(void) const
+    {
+      return fastuidraw::make_c_array(m_data);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers)
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      m_data.resize(dims.x() * dims.y() * new_num_layers, 0u);
+    }
+
+  private:
+    std::vector<uint8_t> m_data;
+  };
+
+  class GeometryStoreCPU:public fastuidraw::GlyphAtlasGeometryBackingStoreBase
+  {
+  public:
+    GeometryStoreCPU(unsigned int alignment, unsigned int number_blocks):
+      fastuidraw::GlyphAtlasGeometryBackingStoreBase(alignment, number_blocks, true),
+      m_data(alignment * number_blocks)
+    {}
+
+    virtual
+    void
+    set_values(unsigned int location,
+               fastuidraw::c_array<const fastuidraw::generic_data> pdata)
+    {
+      FASTUIDRAWassert(pdata.size() % alignment() == 0);
+      std::copy(pdata.begin(), pdata.end(), m_data.begin() + location * alignment());
+    }
+
+    virtual
+    void
+    flush(void)
+    {}
+
+    fastuidraw::c_array<const fastuidraw::generic_data>
+    values(void) const
+    {
+      return fastuidraw::make_c_array(m_data);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(unsigned int new_size)
+    {
+      m_data.resize(new_size * alignment());
+    }
+
+  private:
+    std::vector<fastuidraw::generic_data> m_data;
+  };
+
+  class GlyphAtlasCPUParamsPrivate
+  {
+  public:
+    GlyphAtlasCPUParamsPrivate(void):
+      m_texel_store_dimensions(1024, 1024, 16),
+      m_number_floats(1024 * 1024),
+      m_alignment(4)
+    {}
+
+    fastuidraw::ivec3 m_texel_store_dimensions;
+    unsigned int m_number_floats;
+    unsigned int m_alignment;
+  };
+
+  class GlyphAtlasCPUPrivate
+  {
+  public:
+    explicit
+    GlyphAtlasCPUPrivate(const fastuidraw::cpu::GlyphAtlasCPU::params &P):
+      m_params(P)
+    {}
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasTexelBackingStoreBase>
+    create_texel_store(const fastuidraw::cpu::GlyphAtlasCPU::params &P)
+    {
+      return FASTUIDRAWnew TexelStoreCPU(P.texel_store_dimensions());
+    }
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasGeometryBackingStoreBase>
+    create_geometry_store(const fastuidraw::cpu::GlyphAtlasCPU::params &P)
+    {
+      unsigned int number_blocks;
+      number_blocks = P.number_floats() / P.alignment();
+      return FASTUIDRAWnew GeometryStoreCPU(P.alignment(), number_blocks);
+    }
+
+    fastuidraw::cpu::GlyphAtlasCPU::params m_params;
+  };
+}
+
+///////////////////////////////////////////////
+// fastuidraw::cpu::GlyphAtlasCPU::params methods
+fastuidraw::cpu::GlyphAtlasCPU::params::
+params(void)
+{
+  m_d = FASTUIDRAWnew GlyphAtlasCPUParamsPrivate();
+}
+
+fastuidraw::cpu::GlyphAtlasCPU::params::
+params(const params &obj)
+{
+  GlyphAtlasCPUParamsPrivate *d;
+  d = static_cast<GlyphAtlasCPUParamsPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew GlyphAtlasCPUParamsPrivate(*d);
+}
+
+fastuidraw::cpu::GlyphAtlasCPU::params::
+~params()
+{
+  GlyphAtlasCPUParamsPrivate *d;
+  d = static_cast<GlyphAtlasCPUParamsPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::cpu::GlyphAtlasCPU::params)
+setget_implement(fastuidraw::cpu::GlyphAtlasCPU::params, GlyphAtlasCPUParamsPrivate,
+                 fastuidraw::ivec3, texel_store_dimensions)
+setget_implement(fastuidraw::cpu::GlyphAtlasCPU::params, GlyphAtlasCPUParamsPrivate,
+                 unsigned int, number_floats)
+setget_implement(fastuidraw::cpu::GlyphAtlasCPU::params, GlyphAtlasCPUParamsPrivate,
+                 unsigned int, alignment)
+
+///////////////////////////////////////////////
+// fastuidraw::cpu::GlyphAtlasCPU methods
+fastuidraw::cpu::GlyphAtlasCPU::
+GlyphAtlasCPU(const params &P):
+  GlyphAtlas(GlyphAtlasCPUPrivate::create_texel_store(P),
+             GlyphAtlasCPUPrivate::create_geometry_store(P))
+{
+  m_d = FASTUIDRAWnew GlyphAtlasCPUPrivate(P);
+}
+
+fastuidraw::cpu::GlyphAtlasCPU::
+~GlyphAtlasCPU()
+{
+  GlyphAtlasCPUPrivate *d;
+  d = static_cast<GlyphAtlasCPUPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::c_array<const uint8_t>
+fastuidraw::cpu::GlyphAtlasCPU::
+texels(void) const
+{
+  flush();
+  const TexelStoreCPU *p;
+  FASTUIDRAWassert(dynamic_cast<const TexelStoreCPU*>(texel_store().get()));
+  p = static_cast<const TexelStoreCPU*>(texel_store().get());
+  return p->texels();
+}
+
+fastuidraw::c_array<const fastuidraw::generic_data>
+fastuidraw::cpu::GlyphAtlasCPU::
+geometry_data(void) const
+{
+  flush();
+  const GeometryStoreCPU *p;
+  FASTUIDRAWassert(dynamic_cast<const GeometryStoreCPU*>(geometry_store().get()));
+  p = static_cast<const GeometryStoreCPU*>(geometry_store().get());
+  return p->values();
+}
+
+const fastuidraw::cpu::GlyphAtlasCPU::params&
+fastuidraw::cpu::GlyphAtlasCPU::
+param_values(void) const
+{
+  GlyphAtlasCPUPrivate *d;
+  d = static_cast<GlyphAtlasCPUPrivate*>(m_d);
+  return d->m_params;
+}
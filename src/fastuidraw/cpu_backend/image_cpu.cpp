@@ -0,0 +1,391 @@
+/*!
+ * \file image_cpu.cpp
+ * \brief file image_cpu.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/cpu_backend/image_cpu.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  fastuidraw::ivec3
+  store_size(int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layers)
+  {
+    /* match the GL backend which clamps to 8 because
+     * the index values are packed as 8-bit integers
+     */
+    log2_num_tiles_per_row_per_col = std::max(1, std::min(8, log2_num_tiles_per_row_per_col));
+    int v(1 << (log2_num_tiles_per_row_per_col + log2_tile_size));
+    return fastuidraw::ivec3(v, v, num_layers);
+  }
+
+  class ColorBackingStoreCPU:public fastuidraw::AtlasColorBackingStoreBase
+  {
+  public:
+    ColorBackingStoreCPU(int log2_tile_size, int log2_num_tiles_per_row_per_col,
+                         int number_layers):
+      fastuidraw::AtlasColorBackingStoreBase(store_size(log2_tile_size,
+                                                        log2_num_tiles_per_row_per_col,
+                                                        number_layers),
+                                             true),
+      m_levels(std::max(1, log2_tile_size))
+    {
+      allocate_levels(number_layers);
+    }
+
+    virtual
+    void
+    set_data(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l, fastuidraw::ivec2 src_xy,
+             unsigned int size, const fastuidraw::ImageSourceBase &image_data)
+    {
+      if (mipmap_level >= static_cast<int>(m_levels.size()))
+        {
+          return;
+        }
+
+      std::vector<fastuidraw::u8vec4> tmp(size * size);
+      image_data.fetch_texels(mipmap_level, src_xy, size, size,
+                              fastuidraw::make_c_array(tmp));
+      write_block(mipmap_level, dst_xy, dst_l, size,
+                  fastuidraw::make_c_array(tmp));
+    }
+
+    virtual
+    void
+    set_data(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l,
+             unsigned int size, fastuidraw::u8vec4 color_value)
+    {
+      if (mipmap_level >= static_cast<int>(m_levels.size()))
+        {
+          return;
+        }
+
+      int w(level_width(mipmap_level));
+      std::vector<fastuidraw::u8vec4> &dst(m_levels[mipmap_level]);
+      for(unsigned int y = 0; y < size; ++y)
+        {
+          unsigned int offset;
+          offset = dst_xy.x() + w * (dst_xy.y() + y + level_height(mipmap_level) * dst_l);
+          std::fill(dst.begin() + offset, dst.begin() + offset + size, color_value);
+        }
+    }
+
+    virtual
+    void
+    flush(void)
+    {}
+
+    unsigned int
+    num_levels(void) const
+    {
+      return m_levels.size();
+    }
+
+    fastuidraw::c_array<const fastuidraw::u8vec4>
+    texels(unsigned int mipmap_level) const
+    {
+      FASTUIDRAWassert(mipmap_level < m_levels.size());
+      return fastuidraw::make_c_array(m_levels[mipmap_level]);
+    }
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase>
+    create(int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layers)
+    {
+      ColorBackingStoreCPU *p;
+      p = FASTUIDRAWnew ColorBackingStoreCPU(log2_tile_size, log2_num_tiles_per_row_per_col, num_layers);
+      return fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase>(p);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers)
+    {
+      allocate_levels(new_num_layers);
+    }
+
+  private:
+    int
+    level_width(int mipmap_level) const
+    {
+      return std::max(1, dimensions().x() >> mipmap_level);
+    }
+
+    int
+    level_height(int mipmap_level) const
+    {
+      return std::max(1, dimensions().y() >> mipmap_level);
+    }
+
+    void
+    allocate_levels(int num_layers)
+    {
+      for(unsigned int m = 0; m < m_levels.size(); ++m)
+        {
+          m_levels[m].resize(level_width(m) * level_height(m) * num_layers,
+                             fastuidraw::u8vec4(0, 0, 0, 0));
+        }
+    }
+
+    void
+    write_block(int mipmap_level, fastuidraw::ivec2 dst_xy, int dst_l,
+                unsigned int size,
+                fastuidraw::c_array<const fastuidraw::u8vec4> src)
+    {
+      int w(level_width(mipmap_level));
+      std::vector<fastuidraw::u8vec4> &dst(m_levels[mipmap_level]);
+      for(unsigned int y = 0; y < size; ++y)
+        {
+          unsigned int offset;
+          fastuidraw::c_array<const fastuidraw::u8vec4> row;
+
+          offset = dst_xy.x() + w * (dst_xy.y() + y + level_height(mipmap_level) * dst_l);
+          row = src.sub_array(y * size, size);
+          std::copy(row.begin(), row.end(), dst.begin() + offset);
+        }
+    }
+
+    std::vector<std::vector<fastuidraw::u8vec4> > m_levels;
+  };
+
+  class IndexBackingStoreCPU:public fastuidraw::AtlasIndexBackingStoreBase
+  {
+  public:
+    IndexBackingStoreCPU(int log2_tile_size,
+                         int log2_num_index_tiles_per_row_per_col,
+                         int num_layers):
+      fastuidraw::AtlasIndexBackingStoreBase(store_size(log2_tile_size,
+                                                        log2_num_index_tiles_per_row_per_col,
+                                                        num_layers),
+                                             true)
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      m_data.resize(dims.x() * dims.y() * dims.z(), fastuidraw::ivec3(0, 0, 0));
+    }
+
+    virtual
+    void
+    set_data(int x, int y, int l,
+             int w, int h,
+             fastuidraw::c_array<const fastuidraw::ivec3> data,
+             int slack,
+             const fastuidraw::AtlasColorBackingStoreBase *C,
+             int pcolor_tile_size)
+    {
+      FASTUIDRAWunused(slack);
+      FASTUIDRAWunused(C);
+      FASTUIDRAWunused(pcolor_tile_size);
+      set_data(x, y, l, w, h, data);
+    }
+
+    virtual
+    void
+    set_data(int x, int y, int l,
+             int w, int h,
+             fastuidraw::c_array<const fastuidraw::ivec3> data)
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      for(int b = 0; b < h; ++b)
+        {
+          unsigned int offset;
+          fastuidraw::c_array<const fastuidraw::ivec3> row;
+
+          offset = x + dims.x() * (y + b + dims.y() * l);
+          row = data.sub_array(b * w, w);
+          std::copy(row.begin(), row.end(), m_data.begin() + offset);
+        }
+    }
+
+    virtual
+    void
+    flush(void)
+    {}
+
+    fastuidraw::c_array<const fastuidraw::ivec3>
+    values(void) const
+    {
+      return fastuidraw::make_c_array(m_data);
+    }
+
+    static
+    fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase>
+    create(int log2_tile_size,
+           int log2_num_index_tiles_per_row_per_col,
+           int num_layers)
+    {
+      IndexBackingStoreCPU *p;
+      p = FASTUIDRAWnew IndexBackingStoreCPU(log2_tile_size,
+                                            log2_num_index_tiles_per_row_per_col,
+                                            num_layers);
+      return fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase>(p);
+    }
+
+  protected:
+    virtual
+    void
+    resize_implement(int new_num_layers)
+    {
+      fastuidraw::ivec3 dims(dimensions());
+      m_data.resize(dims.x() * dims.y() * new_num_layers, fastuidraw::ivec3(0, 0, 0));
+    }
+
+  private:
+    std::vector<fastuidraw::ivec3> m_data;
+  };
+
+  class ImageAtlasCPUParamsPrivate
+  {
+  public:
+    ImageAtlasCPUParamsPrivate(void):
+      m_log2_color_tile_size(5),
+      m_log2_num_color_tiles_per_row_per_col(5),
+      m_num_color_layers(1),
+      m_log2_index_tile_size(2),
+      m_log2_num_index_tiles_per_row_per_col(6),
+      m_num_index_layers(4)
+    {}
+
+    int m_log2_color_tile_size;
+    int m_log2_num_color_tiles_per_row_per_col;
+    int m_num_color_layers;
+    int m_log2_index_tile_size;
+    int m_log2_num_index_tiles_per_row_per_col;
+    int m_num_index_layers;
+  };
+
+  class ImageAtlasCPUPrivate
+  {
+  public:
+    explicit
+    ImageAtlasCPUPrivate(const fastuidraw::cpu::ImageAtlasCPU::params &P):
+      m_params(P)
+    {}
+
+    fastuidraw::cpu::ImageAtlasCPU::params m_params;
+  };
+}
+
+//////////////////////////////////////////////
+// fastuidraw::cpu::ImageAtlasCPU::params methods
+fastuidraw::cpu::ImageAtlasCPU::params::
+params(void)
+{
+  m_d = FASTUIDRAWnew ImageAtlasCPUParamsPrivate();
+}
+
+fastuidraw::cpu::ImageAtlasCPU::params::
+params(const params &obj)
+{
+  ImageAtlasCPUParamsPrivate *d;
+  d = static_cast<ImageAtlasCPUParamsPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ImageAtlasCPUParamsPrivate(*d);
+}
+
+fastuidraw::cpu::ImageAtlasCPU::params::
+~params()
+{
+  ImageAtlasCPUParamsPrivate *d;
+  d = static_cast<ImageAtlasCPUParamsPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::cpu::ImageAtlasCPU::params)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, log2_color_tile_size)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, log2_num_color_tiles_per_row_per_col)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, num_color_layers)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, log2_index_tile_size)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, log2_num_index_tiles_per_row_per_col)
+setget_implement(fastuidraw::cpu::ImageAtlasCPU::params,
+                 ImageAtlasCPUParamsPrivate,
+                 int, num_index_layers)
+
+//////////////////////////////////////////////
+// fastuidraw::cpu::ImageAtlasCPU methods
+fastuidraw::cpu::ImageAtlasCPU::
+ImageAtlasCPU(const params &P):
+  fastuidraw::ImageAtlas(1 << P.log2_color_tile_size(),
+                        1 << P.log2_index_tile_size(),
+                        ColorBackingStoreCPU::create(P.log2_color_tile_size(),
+                                                     P.log2_num_color_tiles_per_row_per_col(),
+                                                     P.num_color_layers()),
+                        IndexBackingStoreCPU::create(P.log2_index_tile_size(),
+                                                     P.log2_num_index_tiles_per_row_per_col(),
+                                                     P.num_index_layers()))
+{
+  m_d = FASTUIDRAWnew ImageAtlasCPUPrivate(P);
+}
+
+fastuidraw::cpu::ImageAtlasCPU::
+~ImageAtlasCPU()
+{
+  ImageAtlasCPUPrivate *d;
+  d = static_cast<ImageAtlasCPUPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::cpu::ImageAtlasCPU::params&
+fastuidraw::cpu::ImageAtlasCPU::
+param_values(void) const
+{
+  ImageAtlasCPUPrivate *d;
+  d = static_cast<ImageAtlasCPUPrivate*>(m_d);
+  return d->m_params;
+}
+
+unsigned int
+fastuidraw::cpu::ImageAtlasCPU::
+num_color_mipmap_levels(void) const
+{
+  const ColorBackingStoreCPU *p;
+  FASTUIDRAWassert(dynamic_cast<const ColorBackingStoreCPU*>(color_store().get()));
+  p = static_cast<const ColorBackingStoreCPU*>(color_store().get());
+  return p->num_levels();
+}
+
+fastuidraw::c_array<const fastuidraw::u8vec4>
+fastuidraw::cpu::ImageAtlasCPU::
+color_texels(unsigned int mipmap_level) const
+{
+  const ColorBackingStoreCPU *p;
+  FASTUIDRAWassert(dynamic_cast<const ColorBackingStoreCPU*>(color_store().get()));
+  p = static_cast<const ColorBackingStoreCPU*>(color_store().get());
+  return p->texels(mipmap_level);
+}
+
+fastuidraw::c_array<const fastuidraw::ivec3>
+fastuidraw::cpu::ImageAtlasCPU::
+index_texels(void) const
+{
+  const IndexBackingStoreCPU *p;
+  FASTUIDRAWassert(dynamic_cast<const IndexBackingStoreCPU*>(index_store().get()));
+  p = static_cast<const IndexBackingStoreCPU*>(index_store().get());
+  return p->values();
+}
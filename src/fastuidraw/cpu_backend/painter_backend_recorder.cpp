@@ -0,0 +1,582 @@
+/*!
+ * \file painter_backend_recorder.cpp
+ * \brief file painter_backend_recorder.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/cpu_backend/painter_backend_recorder.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class PainterBackendRecorderPrivate;
+
+  class ConfigurationRecorderPrivate
+  {
+  public:
+    ConfigurationRecorderPrivate(void):
+      m_attributes_per_buffer(512 * 512),
+      m_indices_per_buffer((m_attributes_per_buffer * 6) / 4),
+      m_data_blocks_per_store_buffer(1024 * 64),
+      m_execute_actions(false)
+    {}
+
+    unsigned int m_attributes_per_buffer;
+    unsigned int m_indices_per_buffer;
+    unsigned int m_data_blocks_per_store_buffer;
+    bool m_execute_actions;
+    fastuidraw::reference_counted_ptr<fastuidraw::cpu::ImageAtlasCPU> m_image_atlas;
+    fastuidraw::reference_counted_ptr<fastuidraw::cpu::ColorStopAtlasCPU> m_colorstop_atlas;
+    fastuidraw::reference_counted_ptr<fastuidraw::cpu::GlyphAtlasCPU> m_glyph_atlas;
+  };
+
+  class SurfaceRecorderPrivate
+  {
+  public:
+    explicit
+    SurfaceRecorderPrivate(fastuidraw::ivec2 dims):
+      m_dimensions(dims),
+      m_viewport(0, 0, dims.x(), dims.y())
+    {}
+
+    fastuidraw::ivec2 m_dimensions;
+    fastuidraw::PainterBackend::Surface::Viewport m_viewport;
+  };
+
+  /* A BufferSet is the host memory that backs a single
+   * PainterDraw; the sets are recycled by a BufferPool
+   * so that the packing hot path does not pay for
+   * (re)allocating large arrays on each map_draw().
+   */
+  class BufferSet:fastuidraw::noncopyable
+  {
+  public:
+    BufferSet(unsigned int num_attributes,
+              unsigned int num_indices,
+              unsigned int num_store):
+      m_attributes(num_attributes),
+      m_header_attributes(num_attributes),
+      m_indices(num_indices),
+      m_store(num_store)
+    {}
+
+    std::vector<fastuidraw::PainterAttribute> m_attributes;
+    std::vector<uint32_t> m_header_attributes;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::generic_data> m_store;
+    std::vector<fastuidraw::cpu::PainterBackendRecorder::DrawBreak> m_breaks;
+  };
+
+  class BufferPool:public fastuidraw::reference_counted<BufferPool>::non_concurrent
+  {
+  public:
+    BufferPool(unsigned int num_attributes,
+               unsigned int num_indices,
+               unsigned int num_store):
+      m_num_attributes(num_attributes),
+      m_num_indices(num_indices),
+      m_num_store(num_store)
+    {}
+
+    ~BufferPool()
+    {
+      for(BufferSet *p : m_free)
+        {
+          FASTUIDRAWdelete(p);
+        }
+    }
+
+    BufferSet*
+    acquire(void)
+    {
+      BufferSet *return_value;
+      if (m_free.empty())
+        {
+          return_value = FASTUIDRAWnew BufferSet(m_num_attributes, m_num_indices, m_num_store);
+        }
+      else
+        {
+          return_value = m_free.back();
+          m_free.pop_back();
+          return_value->m_breaks.clear();
+        }
+      return return_value;
+    }
+
+    void
+    release(BufferSet *p)
+    {
+      m_free.push_back(p);
+    }
+
+  private:
+    unsigned int m_num_attributes, m_num_indices, m_num_store;
+    std::vector<BufferSet*> m_free;
+  };
+
+  class DrawRecord:public fastuidraw::PainterDraw
+  {
+  public:
+    DrawRecord(const fastuidraw::reference_counted_ptr<BufferPool> &pool,
+               PainterBackendRecorderPrivate *pr);
+
+    ~DrawRecord();
+
+    virtual
+    void
+    draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
+               const fastuidraw::PainterShaderGroup &new_shaders,
+               unsigned int indices_written) const;
+
+    virtual
+    void
+    draw_break(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> &action,
+               unsigned int indices_written) const;
+
+    virtual
+    void
+    draw(void) const;
+
+    fastuidraw::cpu::PainterBackendRecorder::RecordedDraw
+    recorded(void) const;
+
+  protected:
+    virtual
+    void
+    unmap_implement(unsigned int attributes_written,
+                    unsigned int compact_attributes_written,
+                    unsigned int indices_written,
+                    unsigned int data_store_written) const;
+
+  private:
+    fastuidraw::reference_counted_ptr<BufferPool> m_pool;
+    BufferSet *m_buffers;
+    PainterBackendRecorderPrivate *m_pr;
+    mutable unsigned int m_attributes_written, m_indices_written;
+    mutable unsigned int m_data_store_written;
+  };
+
+  class PainterBackendRecorderPrivate
+  {
+  public:
+    PainterBackendRecorderPrivate(const fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder &P,
+                                  unsigned int alignment);
+
+    fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder m_params;
+    fastuidraw::reference_counted_ptr<BufferPool> m_pool;
+    std::vector<fastuidraw::reference_counted_ptr<const DrawRecord> > m_frame;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend::Surface> m_surface;
+    bool m_clear_color_buffer;
+    fastuidraw::vecN<unsigned int, fastuidraw::cpu::PainterBackendRecorder::num_stats> m_stats;
+  };
+}
+
+////////////////////////////////////
+// DrawRecord methods
+DrawRecord::
+DrawRecord(const fastuidraw::reference_counted_ptr<BufferPool> &pool,
+           PainterBackendRecorderPrivate *pr):
+  m_pool(pool),
+  m_buffers(pool->acquire()),
+  m_pr(pr),
+  m_attributes_written(0),
+  m_indices_written(0),
+  m_data_store_written(0)
+{
+  m_attributes = fastuidraw::make_c_array(m_buffers->m_attributes);
+  m_header_attributes = fastuidraw::make_c_array(m_buffers->m_header_attributes);
+  m_indices = fastuidraw::make_c_array(m_buffers->m_indices);
+  m_store = fastuidraw::make_c_array(m_buffers->m_store);
+}
+
+DrawRecord::
+~DrawRecord()
+{
+  m_pool->release(m_buffers);
+}
+
+void
+DrawRecord::
+draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
+           const fastuidraw::PainterShaderGroup &new_shaders,
+           unsigned int indices_written) const
+{
+  fastuidraw::cpu::PainterBackendRecorder::DrawBreak B;
+
+  FASTUIDRAWunused(old_shaders);
+  B.m_type = fastuidraw::cpu::PainterBackendRecorder::DrawBreak::shader_group_break;
+  B.m_indices_written = indices_written;
+  B.m_item_group = new_shaders.item_group();
+  B.m_blend_group = new_shaders.blend_group();
+  B.m_brush = new_shaders.brush();
+  B.m_packed_blend_mode = new_shaders.packed_blend_mode();
+  m_buffers->m_breaks.push_back(B);
+  ++m_pr->m_stats[fastuidraw::cpu::PainterBackendRecorder::num_draw_breaks];
+}
+
+void
+DrawRecord::
+draw_break(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> &action,
+           unsigned int indices_written) const
+{
+  if (action)
+    {
+      fastuidraw::cpu::PainterBackendRecorder::DrawBreak B;
+
+      B.m_type = fastuidraw::cpu::PainterBackendRecorder::DrawBreak::action_break;
+      B.m_indices_written = indices_written;
+      B.m_item_group = 0u;
+      B.m_blend_group = 0u;
+      B.m_brush = 0u;
+      B.m_packed_blend_mode = 0u;
+      B.m_action = action;
+      m_buffers->m_breaks.push_back(B);
+      ++m_pr->m_stats[fastuidraw::cpu::PainterBackendRecorder::num_action_breaks];
+    }
+}
+
+void
+DrawRecord::
+unmap_implement(unsigned int attributes_written,
+                unsigned int compact_attributes_written,
+                unsigned int indices_written,
+                unsigned int data_store_written) const
+{
+  using namespace fastuidraw::cpu;
+
+  /* m_compact_attributes is left empty, so every
+   * attribute is written to m_attributes.
+   */
+  FASTUIDRAWassert(compact_attributes_written == 0u);
+  FASTUIDRAWunused(compact_attributes_written);
+
+  m_attributes_written = attributes_written;
+  m_indices_written = indices_written;
+  m_data_store_written = data_store_written;
+
+  m_pr->m_stats[PainterBackendRecorder::num_attributes] += attributes_written;
+  m_pr->m_stats[PainterBackendRecorder::num_indices] += indices_written;
+  m_pr->m_stats[PainterBackendRecorder::num_generic_datas] += data_store_written;
+}
+
+void
+DrawRecord::
+draw(void) const
+{
+  m_pr->m_frame.push_back(this);
+  if (m_pr->m_params.execute_actions())
+    {
+      for(const auto &B : m_buffers->m_breaks)
+        {
+          if (B.m_action)
+            {
+              B.m_action->execute(nullptr);
+            }
+        }
+    }
+}
+
+fastuidraw::cpu::PainterBackendRecorder::RecordedDraw
+DrawRecord::
+recorded(void) const
+{
+  fastuidraw::cpu::PainterBackendRecorder::RecordedDraw return_value;
+
+  return_value.m_attributes = m_attributes.sub_array(0, m_attributes_written);
+  return_value.m_header_attributes = m_header_attributes.sub_array(0, m_attributes_written);
+  return_value.m_indices = m_indices.sub_array(0, m_indices_written);
+  return_value.m_store = m_store.sub_array(0, m_data_store_written);
+  return_value.m_breaks = fastuidraw::make_c_array(m_buffers->m_breaks);
+  return return_value;
+}
+
+//////////////////////////////////////////////
+// PainterBackendRecorderPrivate methods
+PainterBackendRecorderPrivate::
+PainterBackendRecorderPrivate(const fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder &P,
+                              unsigned int alignment):
+  m_params(P),
+  m_clear_color_buffer(false),
+  m_stats(0u)
+{
+  m_pool = FASTUIDRAWnew BufferPool(m_params.attributes_per_buffer(),
+                                    m_params.indices_per_buffer(),
+                                    m_params.data_blocks_per_store_buffer() * alignment);
+}
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder methods
+fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder::
+SurfaceRecorder(ivec2 dims)
+{
+  m_d = FASTUIDRAWnew SurfaceRecorderPrivate(dims);
+}
+
+fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder::
+~SurfaceRecorder()
+{
+  SurfaceRecorderPrivate *d;
+  d = static_cast<SurfaceRecorderPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::PainterBackend::Surface::Viewport
+fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder::
+viewport(void) const
+{
+  SurfaceRecorderPrivate *d;
+  d = static_cast<SurfaceRecorderPrivate*>(m_d);
+  return d->m_viewport;
+}
+
+void
+fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder::
+viewport(const Viewport &vwp)
+{
+  SurfaceRecorderPrivate *d;
+  d = static_cast<SurfaceRecorderPrivate*>(m_d);
+  d->m_viewport = vwp;
+}
+
+fastuidraw::ivec2
+fastuidraw::cpu::PainterBackendRecorder::SurfaceRecorder::
+dimensions(void) const
+{
+  SurfaceRecorderPrivate *d;
+  d = static_cast<SurfaceRecorderPrivate*>(m_d);
+  return d->m_dimensions;
+}
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder methods
+fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder::
+ConfigurationRecorder(void)
+{
+  m_d = FASTUIDRAWnew ConfigurationRecorderPrivate();
+}
+
+fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder::
+ConfigurationRecorder(const ConfigurationRecorder &obj)
+{
+  ConfigurationRecorderPrivate *d;
+  d = static_cast<ConfigurationRecorderPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ConfigurationRecorderPrivate(*d);
+}
+
+fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder::
+~ConfigurationRecorder()
+{
+  ConfigurationRecorderPrivate *d;
+  d = static_cast<ConfigurationRecorderPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 unsigned int, attributes_per_buffer)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 unsigned int, indices_per_buffer)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 unsigned int, data_blocks_per_store_buffer)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 bool, execute_actions)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::cpu::ImageAtlasCPU>&,
+                 image_atlas)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::cpu::ColorStopAtlasCPU>&,
+                 colorstop_atlas)
+setget_implement(fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder,
+                 ConfigurationRecorderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::cpu::GlyphAtlasCPU>&,
+                 glyph_atlas)
+
+///////////////////////////////////////////////
+// fastuidraw::cpu::PainterBackendRecorder methods
+fastuidraw::cpu::PainterBackendRecorder::
+PainterBackendRecorder(const ConfigurationRecorder &config_recorder,
+                       const ConfigurationBase &config_base):
+  PainterBackendGLSL(config_recorder.glyph_atlas(),
+                     config_recorder.image_atlas(),
+                     config_recorder.colorstop_atlas(),
+                     ConfigurationGLSL(),
+                     config_base)
+{
+  m_d = FASTUIDRAWnew PainterBackendRecorderPrivate(config_recorder, config_base.alignment());
+}
+
+fastuidraw::cpu::PainterBackendRecorder::
+~PainterBackendRecorder()
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::cpu::PainterBackendRecorder::
+attribs_per_mapping(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_params.attributes_per_buffer();
+}
+
+unsigned int
+fastuidraw::cpu::PainterBackendRecorder::
+indices_per_mapping(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_params.indices_per_buffer();
+}
+
+void
+fastuidraw::cpu::PainterBackendRecorder::
+on_pre_draw(const reference_counted_ptr<Surface> &surface,
+            bool clear_color_buffer)
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+
+  d->m_frame.clear();
+  d->m_surface = surface;
+  d->m_clear_color_buffer = clear_color_buffer;
+  ++d->m_stats[num_frames];
+  viewport(surface->viewport());
+}
+
+void
+fastuidraw::cpu::PainterBackendRecorder::
+on_post_draw(void)
+{
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw>
+fastuidraw::cpu::PainterBackendRecorder::
+map_draw(void)
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  ++d->m_stats[num_draws];
+  return FASTUIDRAWnew DrawRecord(d->m_pool, d);
+}
+
+const fastuidraw::cpu::PainterBackendRecorder::ConfigurationRecorder&
+fastuidraw::cpu::PainterBackendRecorder::
+configuration_recorder(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_params;
+}
+
+unsigned int
+fastuidraw::cpu::PainterBackendRecorder::
+number_recorded_draws(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_frame.size();
+}
+
+fastuidraw::cpu::PainterBackendRecorder::RecordedDraw
+fastuidraw::cpu::PainterBackendRecorder::
+recorded_draw(unsigned int I) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  FASTUIDRAWassert(I < d->m_frame.size());
+  return d->m_frame[I]->recorded();
+}
+
+const fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend::Surface>&
+fastuidraw::cpu::PainterBackendRecorder::
+recorded_surface(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_surface;
+}
+
+bool
+fastuidraw::cpu::PainterBackendRecorder::
+recorded_clear_color_buffer(void) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_clear_color_buffer;
+}
+
+unsigned int
+fastuidraw::cpu::PainterBackendRecorder::
+query_stat(enum stats_t st) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  return d->m_stats[st];
+}
+
+void
+fastuidraw::cpu::PainterBackendRecorder::
+reset_stats(void)
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+  std::fill(d->m_stats.begin(), d->m_stats.end(), 0u);
+}
+
+void
+fastuidraw::cpu::PainterBackendRecorder::
+replay_stats(c_array<unsigned int> dst) const
+{
+  PainterBackendRecorderPrivate *d;
+  d = static_cast<PainterBackendRecorderPrivate*>(m_d);
+
+  FASTUIDRAWassert(dst.size() >= num_stats);
+  std::fill(dst.begin(), dst.begin() + num_stats, 0u);
+  dst[num_frames] = (d->m_surface) ? 1u : 0u;
+  dst[num_draws] = d->m_frame.size();
+  for(const auto &draw : d->m_frame)
+    {
+      RecordedDraw R(draw->recorded());
+
+      dst[num_attributes] += R.m_attributes.size();
+      dst[num_indices] += R.m_indices.size();
+      dst[num_generic_datas] += R.m_store.size();
+      for(const DrawBreak &B : R.m_breaks)
+        {
+          if (B.m_type == DrawBreak::action_break)
+            {
+              ++dst[num_action_breaks];
+            }
+          else
+            {
+              ++dst[num_draw_breaks];
+            }
+        }
+    }
+}
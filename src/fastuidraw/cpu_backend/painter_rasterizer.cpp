@@ -0,0 +1,1883 @@
+/*!
+ * \file painter_rasterizer.cpp
+ * \brief file painter_rasterizer.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <fastuidraw/util/matrix.hpp>
+#include <fastuidraw/painter/painter_header.hpp>
+#include <fastuidraw/painter/painter_item_matrix.hpp>
+#include <fastuidraw/painter/painter_clip_equations.hpp>
+#include <fastuidraw/painter/painter_brush.hpp>
+#include <fastuidraw/painter/painter_stroke_params.hpp>
+#include <fastuidraw/painter/stroked_point.hpp>
+#include <fastuidraw/cpu_backend/painter_rasterizer.hpp>
+#include "../private/util_private.hpp"
+#include "../private/worker_pool.hpp"
+
+namespace
+{
+  /* The item shaders whose vertex and fragment shading
+   * is replicated by the rasterizer; the values are
+   * found by the shader ID of the header.
+   */
+  enum item_kind_t
+    {
+      fill_kind,
+      aa_fuzz_kind,
+      coverage_glyph_kind,
+      distance_field_glyph_kind,
+      anisotropic_distance_field_glyph_kind,
+      stroke_non_aa_kind,
+      stroke_aa_pass1_kind,
+      stroke_aa_pass2_kind,
+      rounded_rect_kind,
+      rounded_rect_clip_inside_kind,
+      rounded_rect_clip_outside_kind,
+      unsupported_kind,
+    };
+
+  enum
+    {
+      number_varyings = 12
+    };
+
+  typedef fastuidraw::vecN<float, number_varyings> Varyings;
+
+  class ParamsPrivate
+  {
+  public:
+    ParamsPrivate(void):
+      m_number_threads(0),
+      m_tile_size(64),
+      m_clear_color(0.0f, 0.0f, 0.0f, 0.0f)
+    {}
+
+    unsigned int m_number_threads;
+    unsigned int m_tile_size;
+    fastuidraw::vec4 m_clear_color;
+  };
+
+  class mat2
+  {
+  public:
+    fastuidraw::vec2
+    operator*(const fastuidraw::vec2 &v) const
+    {
+      return m_c0 * v.x() + m_c1 * v.y();
+    }
+
+    fastuidraw::vec2 m_c0, m_c1;
+  };
+
+  float
+  sign_of(float v)
+  {
+    return (v > 0.0f) ?
+      1.0f :
+      ((v < 0.0f) ? -1.0f : 0.0f);
+  }
+
+  float
+  clamp_value(float v, float min_v, float max_v)
+  {
+    return fastuidraw::t_min(max_v, fastuidraw::t_max(min_v, v));
+  }
+
+  fastuidraw::vec2
+  normalize_vec(const fastuidraw::vec2 &v)
+  {
+    float m;
+    m = v.magnitude();
+    return (m > 0.0f) ? v / m : v;
+  }
+
+  float
+  as_float(uint32_t v)
+  {
+    fastuidraw::generic_data d;
+    d.u = v;
+    return d.f;
+  }
+
+  fastuidraw::vec4
+  as_float(const fastuidraw::uvec4 &v)
+  {
+    return fastuidraw::vec4(as_float(v.x()), as_float(v.y()),
+                            as_float(v.z()), as_float(v.w()));
+  }
+
+  /* CPU version of the GLSL routines used by the vertex shaders
+   * of the default shaders; see fastuidraw_align.vert.glsl,
+   * fastuidraw_compute_local_distance_from_pixel_distance.glsl,
+   * fastuidraw_unpack_unit_vector.glsl and
+   * fastuidraw_circular_interpolate.glsl.
+   */
+  class VertexShading
+  {
+  public:
+    VertexShading(const fastuidraw::float3x3 &item_matrix,
+                  const fastuidraw::vec2 &viewport_pixels):
+      m_item_matrix(item_matrix),
+      m_viewport_pixels(viewport_pixels),
+      m_viewport_recip_pixels(1.0f / viewport_pixels.x(), 1.0f / viewport_pixels.y())
+    {}
+
+    fastuidraw::vec3
+    clip_point(const fastuidraw::vec2 &p) const
+    {
+      return m_item_matrix * fastuidraw::vec3(p.x(), p.y(), 1.0f);
+    }
+
+    fastuidraw::vec3
+    clip_direction(const fastuidraw::vec2 &v) const
+    {
+      return m_item_matrix * fastuidraw::vec3(v.x(), v.y(), 0.0f);
+    }
+
+    float
+    local_distance_from_pixel_distance(float pixel_distance,
+                                       const fastuidraw::vec3 &clip_p,
+                                       const fastuidraw::vec3 &clip_direction) const;
+
+    void
+    compute_Q_adjoint_Q(const fastuidraw::vec3 &clip_p, mat2 &Q, mat2 &adjQ) const;
+
+    fastuidraw::vec2
+    align_normal_to_screen(const fastuidraw::vec3 &clip_p, const fastuidraw::vec2 &n) const;
+
+    static
+    fastuidraw::vec2
+    unpack_unit_vector(float x, uint32_t b);
+
+    static
+    fastuidraw::vec2
+    circular_interpolate(const fastuidraw::vec2 &v0, const fastuidraw::vec2 &v1,
+                         float d, float interpolate);
+
+    fastuidraw::float3x3 m_item_matrix;
+    fastuidraw::vec2 m_viewport_pixels, m_viewport_recip_pixels;
+  };
+
+  /* the values of a PainterHeader needed to shade */
+  class Header
+  {
+  public:
+    Header(fastuidraw::c_array<const fastuidraw::generic_data> store,
+           unsigned int alignment, uint32_t location);
+
+    fastuidraw::float3x3 m_item_matrix;
+    fastuidraw::vecN<fastuidraw::vec3, 4> m_clip_equations;
+    fastuidraw::vec4 m_brush_color;
+    uint32_t m_item_shader, m_blend_shader;
+    unsigned int m_item_shader_data;
+    int m_z;
+  };
+
+  /* a vertex after vertex shading */
+  class ProcessedVertex
+  {
+  public:
+    fastuidraw::vec2 m_window;
+    float m_clip_w, m_depth;
+    fastuidraw::vecN<float, 4> m_clip_distances;
+    Varyings m_varyings;
+    fastuidraw::vec4 m_brush_color;
+    uint32_t m_blend_shader;
+    enum item_kind_t m_kind;
+    int m_layer;
+  };
+
+  /* a triangle to rasterize; the state is taken
+   * from the first vertex, just as the GLSL
+   * uber-shader takes the header as flat.
+   */
+  class ProcessedTriangle
+  {
+  public:
+    fastuidraw::vecN<const ProcessedVertex*, 3> m_vertices;
+    enum fastuidraw::PainterEnums::blend_mode_t m_blend_mode;
+    fastuidraw::ivec2 m_min, m_max;
+  };
+
+  /* Edge equations of a triangle in window coordinates;
+   * the triangle is made counter-clockwise so that the
+   * three edge functions are non-negative inside.
+   */
+  class TriangleSetup
+  {
+  public:
+    explicit
+    TriangleSetup(const ProcessedTriangle &tri);
+
+    bool
+    inside(const fastuidraw::vec2 &pt, fastuidraw::vec3 &b) const;
+
+    void
+    barycentric(const fastuidraw::vec2 &pt, fastuidraw::vec3 &b) const;
+
+    float
+    depth(const fastuidraw::vec3 &b) const;
+
+    void
+    interpolate(const fastuidraw::vec3 &b, Varyings &out) const;
+
+    void
+    interpolate_clip_distances(const fastuidraw::vec3 &b,
+                               fastuidraw::vecN<float, 4> &out) const;
+
+    fastuidraw::vecN<const ProcessedVertex*, 3> m_v;
+    fastuidraw::vecN<fastuidraw::vec3, 3> m_edges;
+    fastuidraw::vecN<bool, 3> m_top_left;
+    float m_recip_area;
+    bool m_constant_depth;
+  };
+
+  class GlyphTexels
+  {
+  public:
+    GlyphTexels(void):
+      m_dims(0, 0, 0)
+    {}
+
+    float
+    fetch(int x, int y, int layer) const;
+
+    float
+    bilinear(float x, float y, int layer) const;
+
+    fastuidraw::c_array<const uint8_t> m_texels;
+    fastuidraw::ivec3 m_dims;
+  };
+
+  class ThreadStats
+  {
+  public:
+    ThreadStats(void):
+      m_fragments(0),
+      m_fragments_written(0)
+    {}
+
+    unsigned int m_fragments;
+    unsigned int m_fragments_written;
+  };
+
+  class PainterRasterizerPrivate
+  {
+  public:
+    PainterRasterizerPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::cpu::PainterBackendRecorder> &backend,
+                             const fastuidraw::cpu::PainterRasterizer::params &P);
+
+    ~PainterRasterizerPrivate();
+
+    void
+    add_item_shader(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                    enum item_kind_t kind);
+
+    void
+    add_glyph_shaders(const fastuidraw::PainterGlyphShader &shaders, bool anisotropic);
+
+    enum item_kind_t
+    item_kind(uint32_t shader) const
+    {
+      return (shader < m_item_kinds.size()) ?
+        m_item_kinds[shader] :
+        unsupported_kind;
+    }
+
+    enum fastuidraw::PainterEnums::blend_mode_t
+    blend_mode(uint32_t shader, fastuidraw::BlendMode::packed_value packed) const;
+
+    void
+    prepare_frame(void);
+
+    void
+    process_vertices(unsigned int thread_id);
+
+    void
+    process_vertex(const fastuidraw::cpu::PainterBackendRecorder::RecordedDraw &draw,
+                   unsigned int idx, ProcessedVertex &dst) const;
+
+    fastuidraw::vec2
+    vertex_shader(enum item_kind_t kind, const fastuidraw::PainterAttribute &attrib,
+                  const Header &header, const VertexShading &shading,
+                  fastuidraw::c_array<const fastuidraw::generic_data> store,
+                  ProcessedVertex &dst, int &z_add) const;
+
+    void
+    assemble_triangles(void);
+
+    void
+    rasterize_tiles(unsigned int thread_id);
+
+    void
+    rasterize_triangle(const ProcessedTriangle &tri,
+                       const fastuidraw::ivec2 &tile_min,
+                       const fastuidraw::ivec2 &tile_max,
+                       ThreadStats &stats);
+
+    bool
+    shade_fragment(const ProcessedTriangle &tri, const TriangleSetup &setup,
+                   const fastuidraw::vec2 &pt, const Varyings &v,
+                   float &alpha) const;
+
+    template<typename F>
+    void
+    run_threads(F f);
+
+    fastuidraw::reference_counted_ptr<fastuidraw::cpu::PainterBackendRecorder> m_backend;
+    fastuidraw::cpu::PainterRasterizer::params m_params;
+    unsigned int m_number_threads;
+    unsigned int m_alignment;
+    std::vector<enum item_kind_t> m_item_kinds;
+
+    class BlendEntry
+    {
+    public:
+      uint32_t m_shader;
+      fastuidraw::BlendMode::packed_value m_packed;
+      enum fastuidraw::PainterEnums::blend_mode_t m_mode;
+    };
+    std::vector<BlendEntry> m_blend_entries;
+    fastuidraw::BlendMode::packed_value m_initial_packed_blend;
+
+    /* per-frame values */
+    fastuidraw::ivec2 m_dimensions;
+    fastuidraw::ivec2 m_scissor_min, m_scissor_max;
+    fastuidraw::PainterBackend::Surface::Viewport m_viewport;
+    GlyphTexels m_glyph_texels;
+    std::vector<fastuidraw::cpu::PainterBackendRecorder::RecordedDraw> m_draws;
+    std::vector<unsigned int> m_draw_vertex_offsets;
+    std::vector<ProcessedVertex> m_vertices;
+    std::vector<ProcessedTriangle> m_triangles;
+    fastuidraw::ivec2 m_number_tiles;
+    std::vector<std::vector<unsigned int> > m_bins;
+    std::atomic<unsigned int> m_next_tile;
+    std::vector<ThreadStats> m_thread_stats;
+
+    std::vector<fastuidraw::u8vec4> m_color;
+    std::vector<float> m_depth;
+    fastuidraw::vecN<unsigned int, fastuidraw::cpu::PainterRasterizer::num_stats> m_stats;
+
+    /* runs the phases of thread_id 1 to m_number_threads - 1,
+     * the calling thread runs thread_id 0; nullptr if only
+     * one thread is used.
+     */
+    fastuidraw::detail::WorkerPool *m_pool;
+  };
+}
+
+///////////////////////////////////
+// VertexShading methods
+float
+VertexShading::
+local_distance_from_pixel_distance(float pixel_distance,
+                                   const fastuidraw::vec3 &clip_p,
+                                   const fastuidraw::vec3 &clip_direction) const
+{
+  fastuidraw::vec3 p, v;
+  fastuidraw::vec2 zeta;
+  float return_value;
+
+  p = fastuidraw::vec3(0.5f * m_viewport_pixels.x() * clip_p.x(),
+                       0.5f * m_viewport_pixels.y() * clip_p.y(),
+                       clip_p.z());
+  v = fastuidraw::vec3(0.5f * m_viewport_pixels.x() * clip_direction.x(),
+                       0.5f * m_viewport_pixels.y() * clip_direction.y(),
+                       clip_direction.z());
+
+  zeta = fastuidraw::vec2(v.x() * p.z() - v.z() * p.x(),
+                          v.y() * p.z() - v.z() * p.y());
+
+  return_value = pixel_distance * p.z() * p.z();
+  return_value /= (-pixel_distance * fastuidraw::t_abs(p.z() * v.z()) + zeta.magnitude());
+  return return_value;
+}
+
+void
+VertexShading::
+compute_Q_adjoint_Q(const fastuidraw::vec3 &pclip_p, mat2 &Q, mat2 &adjQ) const
+{
+  const fastuidraw::float3x3 &M(m_item_matrix);
+  fastuidraw::vec3 clip;
+
+  clip = fastuidraw::vec3(m_viewport_pixels.x() * pclip_p.x(),
+                          m_viewport_pixels.y() * pclip_p.y(),
+                          pclip_p.z());
+
+  Q.m_c0.x() = clip.z() * M(0, 0) - clip.x() * M(2, 0);
+  Q.m_c0.y() = clip.z() * M(1, 0) - clip.y() * M(2, 0);
+  Q.m_c1.x() = clip.z() * M(0, 1) - clip.x() * M(2, 1);
+  Q.m_c1.y() = clip.z() * M(1, 1) - clip.y() * M(2, 1);
+
+  adjQ.m_c0 = fastuidraw::vec2(Q.m_c1.y(), -Q.m_c0.y());
+  adjQ.m_c1 = fastuidraw::vec2(-Q.m_c1.x(), Q.m_c0.x());
+}
+
+fastuidraw::vec2
+VertexShading::
+align_normal_to_screen(const fastuidraw::vec3 &clip_p, const fastuidraw::vec2 &n) const
+{
+  mat2 Q, adjQ;
+  fastuidraw::vec2 n_screen, t_screen, t;
+
+  compute_Q_adjoint_Q(clip_p, Q, adjQ);
+  t = fastuidraw::vec2(-n.y(), n.x());
+  t_screen = m_viewport_pixels * (Q * t);
+  n_screen = fastuidraw::vec2(t_screen.y(), -t_screen.x());
+  return adjQ * (m_viewport_recip_pixels * n_screen);
+}
+
+fastuidraw::vec2
+VertexShading::
+unpack_unit_vector(float x, uint32_t b)
+{
+  fastuidraw::vec2 return_value;
+
+  return_value.x() = x;
+  return_value.y() = std::sqrt(fastuidraw::t_max(0.0f, 1.0f - x * x));
+  if (b != 0u)
+    {
+      return_value.y() = -return_value.y();
+    }
+  return return_value;
+}
+
+fastuidraw::vec2
+VertexShading::
+circular_interpolate(const fastuidraw::vec2 &v0, const fastuidraw::vec2 &v1,
+                     float d, float interpolate)
+{
+  float angle, c, s;
+
+  angle = std::acos(clamp_value(d, -1.0f, 1.0f));
+  c = std::cos(angle * interpolate);
+  s = std::sin(angle * interpolate) * sign_of(v0.x() * v1.y() - v1.x() * v0.y());
+  return fastuidraw::vec2(c * v0.x() - s * v0.y(),
+                          s * v0.x() + c * v0.y());
+}
+
+/////////////////////////////////
+// Header methods
+Header::
+Header(fastuidraw::c_array<const fastuidraw::generic_data> store,
+       unsigned int alignment, uint32_t location)
+{
+  using namespace fastuidraw;
+
+  c_array<const generic_data> h, m, c, b;
+  uint32_t packed;
+
+  h = store.sub_array(location * alignment, PainterHeader::header_size);
+  m = store.sub_array(h[PainterHeader::item_matrix_location_offset].u * alignment,
+                      PainterItemMatrix::matrix_data_size);
+  c = store.sub_array(h[PainterHeader::clip_equations_location_offset].u * alignment,
+                      PainterClipEquations::clip_data_size);
+  b = store.sub_array(h[PainterHeader::brush_shader_data_location_offset].u * alignment,
+                      PainterBrush::pen_data_size);
+
+  m_item_matrix(0, 0) = m[PainterItemMatrix::matrix00_offset].f;
+  m_item_matrix(0, 1) = m[PainterItemMatrix::matrix01_offset].f;
+  m_item_matrix(0, 2) = m[PainterItemMatrix::matrix02_offset].f;
+  m_item_matrix(1, 0) = m[PainterItemMatrix::matrix10_offset].f;
+  m_item_matrix(1, 1) = m[PainterItemMatrix::matrix11_offset].f;
+  m_item_matrix(1, 2) = m[PainterItemMatrix::matrix12_offset].f;
+  m_item_matrix(2, 0) = m[PainterItemMatrix::matrix20_offset].f;
+  m_item_matrix(2, 1) = m[PainterItemMatrix::matrix21_offset].f;
+  m_item_matrix(2, 2) = m[PainterItemMatrix::matrix22_offset].f;
+
+  m_clip_equations[0] = vec3(c[PainterClipEquations::clip0_coeff_x].f,
+                             c[PainterClipEquations::clip0_coeff_y].f,
+                             c[PainterClipEquations::clip0_coeff_w].f);
+  m_clip_equations[1] = vec3(c[PainterClipEquations::clip1_coeff_x].f,
+                             c[PainterClipEquations::clip1_coeff_y].f,
+                             c[PainterClipEquations::clip1_coeff_w].f);
+  m_clip_equations[2] = vec3(c[PainterClipEquations::clip2_coeff_x].f,
+                             c[PainterClipEquations::clip2_coeff_y].f,
+                             c[PainterClipEquations::clip2_coeff_w].f);
+  m_clip_equations[3] = vec3(c[PainterClipEquations::clip3_coeff_x].f,
+                             c[PainterClipEquations::clip3_coeff_y].f,
+                             c[PainterClipEquations::clip3_coeff_w].f);
+
+  m_brush_color = vec4(b[PainterBrush::pen_red_offset].f,
+                       b[PainterBrush::pen_green_offset].f,
+                       b[PainterBrush::pen_blue_offset].f,
+                       b[PainterBrush::pen_alpha_offset].f);
+
+  packed = h[PainterHeader::item_blend_shader_offset].u;
+  m_item_shader = unpack_bits(PainterHeader::item_shader_bit0,
+                              PainterHeader::item_shader_num_bits,
+                              packed);
+  m_blend_shader = unpack_bits(PainterHeader::blend_shader_bit0,
+                               PainterHeader::blend_shader_num_bits,
+                               packed);
+  m_item_shader_data = h[PainterHeader::item_shader_data_location_offset].u * alignment;
+  m_z = h[PainterHeader::z_offset].i;
+}
+
+//////////////////////////////////////
+// TriangleSetup methods
+TriangleSetup::
+TriangleSetup(const ProcessedTriangle &tri):
+  m_v(tri.m_vertices)
+{
+  float area;
+
+  area = (m_v[1]->m_window - m_v[0]->m_window).x() * (m_v[2]->m_window - m_v[0]->m_window).y()
+    - (m_v[1]->m_window - m_v[0]->m_window).y() * (m_v[2]->m_window - m_v[0]->m_window).x();
+
+  if (area < 0.0f)
+    {
+      std::swap(m_v[1], m_v[2]);
+      area = -area;
+    }
+
+  /* m_edges[i] is the edge opposite to vertex i, so that
+   * m_edges[i] evaluated at a point divided by the area
+   * is the barycentric coordinate of vertex i.
+   */
+  for(unsigned int i = 0; i < 3; ++i)
+    {
+      fastuidraw::vec2 p, q, d;
+
+      p = m_v[(i + 1) % 3]->m_window;
+      q = m_v[(i + 2) % 3]->m_window;
+      d = q - p;
+      m_edges[i] = fastuidraw::vec3(-d.y(), d.x(), d.y() * p.x() - d.x() * p.y());
+
+      /* a pixel center exactly on an edge shared by two
+       * triangles is taken by exactly one of them since
+       * the edge is traversed in opposite directions.
+       */
+      m_top_left[i] = (d.y() > 0.0f) || (d.y() == 0.0f && d.x() < 0.0f);
+    }
+
+  m_recip_area = (area > 0.0f) ? 1.0f / area : 0.0f;
+  m_constant_depth = (m_v[0]->m_depth == m_v[1]->m_depth && m_v[0]->m_depth == m_v[2]->m_depth);
+}
+
+void
+TriangleSetup::
+barycentric(const fastuidraw::vec2 &pt, fastuidraw::vec3 &b) const
+{
+  for(unsigned int i = 0; i < 3; ++i)
+    {
+      b[i] = m_recip_area * (m_edges[i].x() * pt.x() + m_edges[i].y() * pt.y() + m_edges[i].z());
+    }
+}
+
+bool
+TriangleSetup::
+inside(const fastuidraw::vec2 &pt, fastuidraw::vec3 &b) const
+{
+  for(unsigned int i = 0; i < 3; ++i)
+    {
+      float e;
+
+      e = m_edges[i].x() * pt.x() + m_edges[i].y() * pt.y() + m_edges[i].z();
+      if (e < 0.0f || (e == 0.0f && !m_top_left[i]))
+        {
+          return false;
+        }
+      b[i] = m_recip_area * e;
+    }
+  return true;
+}
+
+float
+TriangleSetup::
+depth(const fastuidraw::vec3 &b) const
+{
+  /* the depth is linear in window coordinates */
+  return (m_constant_depth) ?
+    m_v[0]->m_depth :
+    b[0] * m_v[0]->m_depth + b[1] * m_v[1]->m_depth + b[2] * m_v[2]->m_depth;
+}
+
+void
+TriangleSetup::
+interpolate(const fastuidraw::vec3 &b, Varyings &out) const
+{
+  fastuidraw::vec3 w;
+  float s;
+
+  /* perspective correct interpolation, as GL does
+   * for varyings that are not noperspective.
+   */
+  w = fastuidraw::vec3(b[0] / m_v[0]->m_clip_w,
+                       b[1] / m_v[1]->m_clip_w,
+                       b[2] / m_v[2]->m_clip_w);
+  s = w[0] + w[1] + w[2];
+  w /= s;
+
+  for(unsigned int i = 0; i < number_varyings; ++i)
+    {
+      out[i] = w[0] * m_v[0]->m_varyings[i]
+        + w[1] * m_v[1]->m_varyings[i]
+        + w[2] * m_v[2]->m_varyings[i];
+    }
+}
+
+void
+TriangleSetup::
+interpolate_clip_distances(const fastuidraw::vec3 &b,
+                           fastuidraw::vecN<float, 4> &out) const
+{
+  fastuidraw::vec3 w;
+  float s;
+
+  w = fastuidraw::vec3(b[0] / m_v[0]->m_clip_w,
+                       b[1] / m_v[1]->m_clip_w,
+                       b[2] / m_v[2]->m_clip_w);
+  s = w[0] + w[1] + w[2];
+  w /= s;
+
+  for(unsigned int i = 0; i < 4; ++i)
+    {
+      out[i] = w[0] * m_v[0]->m_clip_distances[i]
+        + w[1] * m_v[1]->m_clip_distances[i]
+        + w[2] * m_v[2]->m_clip_distances[i];
+    }
+}
+
+////////////////////////////////
+// GlyphTexels methods
+float
+GlyphTexels::
+fetch(int x, int y, int layer) const
+{
+  x = fastuidraw::t_max(0, fastuidraw::t_min(x, m_dims.x() - 1));
+  y = fastuidraw::t_max(0, fastuidraw::t_min(y, m_dims.y() - 1));
+  layer = fastuidraw::t_max(0, fastuidraw::t_min(layer, m_dims.z() - 1));
+  return static_cast<float>(m_texels[x + m_dims.x() * y + m_dims.x() * m_dims.y() * layer]);
+}
+
+float
+GlyphTexels::
+bilinear(float x, float y, int layer) const
+{
+  /* same as the FASTUIDRAW_PAINTER_EMULATE_GLYPH_TEXEL_STORE_FLOAT
+   * path of the glyph fragment shaders.
+   */
+  int x0, y0;
+  float mx, my, f0, f1;
+
+  if (m_texels.empty())
+    {
+      return 0.0f;
+    }
+
+  x0 = static_cast<int>(x);
+  y0 = static_cast<int>(y);
+  mx = x - static_cast<float>(x0);
+  my = y - static_cast<float>(y0);
+
+  f0 = fetch(x0, y0, layer) + my * (fetch(x0, y0 + 1, layer) - fetch(x0, y0, layer));
+  f1 = fetch(x0 + 1, y0, layer) + my * (fetch(x0 + 1, y0 + 1, layer) - fetch(x0 + 1, y0, layer));
+  return (f0 + mx * (f1 - f0)) / 255.0f;
+}
+
+////////////////////////////////////////////
+// PainterRasterizerPrivate methods
+PainterRasterizerPrivate::
+PainterRasterizerPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::cpu::PainterBackendRecorder> &backend,
+                         const fastuidraw::cpu::PainterRasterizer::params &P):
+  m_backend(backend),
+  m_params(P),
+  m_alignment(backend->configuration_base().alignment()),
+  m_dimensions(0, 0),
+  m_next_tile(0),
+  m_pool(nullptr)
+{
+  using namespace fastuidraw;
+
+  const PainterShaderSet &shaders(m_backend->default_shaders());
+  const PainterStrokeShader &stroke(shaders.stroke_shader());
+  const PainterRoundedRectShader &rounded_rect(shaders.rounded_rect_shader());
+  const PainterBlendShaderSet &blend(shaders.blend_shaders());
+
+  m_number_threads = (P.number_threads() != 0) ?
+    P.number_threads() :
+    std::max(1u, std::thread::hardware_concurrency());
+  if (m_number_threads > 1)
+    {
+      m_pool = FASTUIDRAWnew fastuidraw::detail::WorkerPool(m_number_threads - 1);
+    }
+
+  add_item_shader(shaders.fill_shader().item_shader(), fill_kind);
+  add_item_shader(shaders.fill_shader().aa_fuzz_shader(), aa_fuzz_kind);
+  add_item_shader(stroke.non_aa_shader(), stroke_non_aa_kind);
+  add_item_shader(stroke.aa_shader_pass1(), stroke_aa_pass1_kind);
+  add_item_shader(stroke.aa_shader_pass2(), stroke_aa_pass2_kind);
+  add_item_shader(rounded_rect.item_shader(), rounded_rect_kind);
+  add_item_shader(rounded_rect.clip_inside_shader(), rounded_rect_clip_inside_kind);
+  add_item_shader(rounded_rect.clip_outside_shader(), rounded_rect_clip_outside_kind);
+  add_glyph_shaders(shaders.glyph_shader(), false);
+  add_glyph_shaders(shaders.glyph_shader_anisotropic(), true);
+
+  for(unsigned int m = PainterEnums::blend_porter_duff_clear; m <= PainterEnums::blend_porter_duff_xor; ++m)
+    {
+      enum PainterEnums::blend_mode_t mode;
+
+      mode = static_cast<enum PainterEnums::blend_mode_t>(m);
+      if (blend.shader(mode))
+        {
+          BlendEntry E;
+
+          E.m_shader = blend.shader(mode)->ID();
+          E.m_packed = blend.blend_mode(mode);
+          E.m_mode = mode;
+          m_blend_entries.push_back(E);
+        }
+    }
+  m_initial_packed_blend = blend.blend_mode(PainterEnums::blend_porter_duff_src_over);
+  m_stats = vecN<unsigned int, cpu::PainterRasterizer::num_stats>(0u);
+}
+
+PainterRasterizerPrivate::
+~PainterRasterizerPrivate()
+{
+  if (m_pool)
+    {
+      FASTUIDRAWdelete(m_pool);
+    }
+}
+
+void
+PainterRasterizerPrivate::
+add_item_shader(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                enum item_kind_t kind)
+{
+  uint32_t ID;
+
+  if (!shader)
+    {
+      return;
+    }
+
+  ID = shader->ID();
+  if (ID >= m_item_kinds.size())
+    {
+      m_item_kinds.resize(ID + 1, unsupported_kind);
+    }
+
+  /* the first kind registered to an ID wins; this way
+   * the coverage glyph shader, which is shared between
+   * the isotropic and anisotropic glyph shaders, keeps
+   * its kind.
+   */
+  if (m_item_kinds[ID] == unsupported_kind)
+    {
+      m_item_kinds[ID] = kind;
+    }
+}
+
+void
+PainterRasterizerPrivate::
+add_glyph_shaders(const fastuidraw::PainterGlyphShader &shaders, bool anisotropic)
+{
+  if (fastuidraw::coverage_glyph < shaders.shader_count())
+    {
+      add_item_shader(shaders.shader(fastuidraw::coverage_glyph), coverage_glyph_kind);
+    }
+
+  if (fastuidraw::distance_field_glyph < shaders.shader_count())
+    {
+      add_item_shader(shaders.shader(fastuidraw::distance_field_glyph),
+                      (anisotropic) ?
+                      anisotropic_distance_field_glyph_kind :
+                      distance_field_glyph_kind);
+    }
+}
+
+enum fastuidraw::PainterEnums::blend_mode_t
+PainterRasterizerPrivate::
+blend_mode(uint32_t shader, fastuidraw::BlendMode::packed_value packed) const
+{
+  enum fastuidraw::PainterEnums::blend_mode_t return_value;
+
+  /* For single_src blending, all Porter-Duff modes share
+   * the same blend shader and only differ by the BlendMode
+   * of the draw break; for the other blend types the blend
+   * shader alone determines the mode.
+   */
+  return_value = fastuidraw::PainterEnums::blend_porter_duff_src_over;
+  for(const BlendEntry &E : m_blend_entries)
+    {
+      if (E.m_shader == shader)
+        {
+          if (E.m_packed == packed)
+            {
+              return E.m_mode;
+            }
+          else if (return_value == fastuidraw::PainterEnums::blend_porter_duff_src_over)
+            {
+              return_value = E.m_mode;
+            }
+        }
+    }
+  return return_value;
+}
+
+template<typename F>
+void
+PainterRasterizerPrivate::
+run_threads(F f)
+{
+  for(unsigned int i = 1; i < m_number_threads; ++i)
+    {
+      m_pool->add(this, [f, i] { f(i); });
+    }
+  f(0);
+
+  if (m_pool)
+    {
+      m_pool->wait(this);
+    }
+}
+
+void
+PainterRasterizerPrivate::
+prepare_frame(void)
+{
+  using namespace fastuidraw;
+
+  const reference_counted_ptr<PainterBackend::Surface> &surface(m_backend->recorded_surface());
+  const reference_counted_ptr<cpu::GlyphAtlasCPU> &glyph_atlas(m_backend->configuration_recorder().glyph_atlas());
+  ivec2 dims;
+  bool clear_color;
+  unsigned int num_vertices, tile_size;
+
+  dims = (surface) ? surface->dimensions() : ivec2(0, 0);
+  m_viewport = (surface) ? surface->viewport() : PainterBackend::Surface::Viewport(0, 0, 0, 0);
+
+  clear_color = m_backend->recorded_clear_color_buffer();
+  if (dims != m_dimensions)
+    {
+      m_dimensions = dims;
+      m_color.resize(dims.x() * dims.y());
+      m_depth.resize(dims.x() * dims.y());
+      clear_color = true;
+    }
+
+  if (clear_color)
+    {
+      vec4 c(m_params.clear_color());
+      u8vec4 v;
+
+      for(unsigned int i = 0; i < 4; ++i)
+        {
+          float f;
+          f = (i == 3) ? c[3] : c[i] * c[3];
+          v[i] = static_cast<uint8_t>(255.0f * clamp_value(f, 0.0f, 1.0f) + 0.5f);
+        }
+      std::fill(m_color.begin(), m_color.end(), v);
+    }
+  std::fill(m_depth.begin(), m_depth.end(), 0.0f);
+
+  /* GL backend scissors to the viewport */
+  m_scissor_min.x() = t_max(0, m_viewport.m_origin.x());
+  m_scissor_min.y() = t_max(0, m_viewport.m_origin.y());
+  m_scissor_max.x() = t_min(dims.x(), m_viewport.m_origin.x() + m_viewport.m_dimensions.x());
+  m_scissor_max.y() = t_min(dims.y(), m_viewport.m_origin.y() + m_viewport.m_dimensions.y());
+
+  if (glyph_atlas)
+    {
+      m_glyph_texels.m_texels = glyph_atlas->texels();
+      m_glyph_texels.m_dims = glyph_atlas->texel_store()->dimensions();
+    }
+  else
+    {
+      m_glyph_texels = GlyphTexels();
+    }
+
+  m_draws.clear();
+  m_draw_vertex_offsets.clear();
+  num_vertices = 0;
+  for(unsigned int i = 0, endi = m_backend->number_recorded_draws(); i < endi; ++i)
+    {
+      m_draws.push_back(m_backend->recorded_draw(i));
+      m_draw_vertex_offsets.push_back(num_vertices);
+      num_vertices += m_draws.back().m_attributes.size();
+    }
+  m_vertices.resize(num_vertices);
+
+  tile_size = t_max(1u, m_params.tile_size());
+  m_number_tiles.x() = (dims.x() + tile_size - 1) / tile_size;
+  m_number_tiles.y() = (dims.y() + tile_size - 1) / tile_size;
+  m_bins.resize(m_number_tiles.x() * m_number_tiles.y());
+  for(std::vector<unsigned int> &bin : m_bins)
+    {
+      bin.clear();
+    }
+  m_triangles.clear();
+  m_next_tile = 0;
+  m_thread_stats.assign(m_number_threads, ThreadStats());
+}
+
+void
+PainterRasterizerPrivate::
+process_vertices(unsigned int thread_id)
+{
+  for(unsigned int d = 0, endd = m_draws.size(); d < endd; ++d)
+    {
+      unsigned int count, begin, end;
+
+      count = m_draws[d].m_attributes.size();
+      begin = (count * thread_id) / m_number_threads;
+      end = (count * (thread_id + 1)) / m_number_threads;
+      for(unsigned int i = begin; i < end; ++i)
+        {
+          process_vertex(m_draws[d], i, m_vertices[m_draw_vertex_offsets[d] + i]);
+        }
+    }
+}
+
+void
+PainterRasterizerPrivate::
+process_vertex(const fastuidraw::cpu::PainterBackendRecorder::RecordedDraw &draw,
+               unsigned int idx, ProcessedVertex &dst) const
+{
+  using namespace fastuidraw;
+
+  Header header(draw.m_store, m_alignment, draw.m_header_attributes[idx]);
+  VertexShading shading(header.m_item_matrix, vec2(m_viewport.m_dimensions));
+  vec2 p;
+  vec3 clip_p;
+  int z_add(0);
+
+  dst.m_kind = item_kind(header.m_item_shader);
+  dst.m_blend_shader = header.m_blend_shader;
+  dst.m_brush_color = header.m_brush_color;
+  dst.m_layer = 0;
+  dst.m_varyings = Varyings(0.0f);
+
+  if (dst.m_kind == unsupported_kind)
+    {
+      return;
+    }
+
+  p = vertex_shader(dst.m_kind, draw.m_attributes[idx], header, shading,
+                    draw.m_store, dst, z_add);
+
+  clip_p = shading.clip_point(p);
+  for(unsigned int i = 0; i < 4; ++i)
+    {
+      dst.m_clip_distances[i] = dot(header.m_clip_equations[i], clip_p);
+    }
+
+  dst.m_clip_w = clip_p.z();
+  dst.m_depth = static_cast<float>(z_add + header.m_z);
+  if (clip_p.z() > 0.0f)
+    {
+      vec2 ndc(clip_p.x() / clip_p.z(), clip_p.y() / clip_p.z());
+
+      dst.m_window.x() = static_cast<float>(m_viewport.m_origin.x())
+        + 0.5f * (ndc.x() + 1.0f) * static_cast<float>(m_viewport.m_dimensions.x());
+      dst.m_window.y() = static_cast<float>(m_viewport.m_origin.y())
+        + 0.5f * (ndc.y() + 1.0f) * static_cast<float>(m_viewport.m_dimensions.y());
+    }
+}
+
+fastuidraw::vec2
+PainterRasterizerPrivate::
+vertex_shader(enum item_kind_t kind, const fastuidraw::PainterAttribute &attrib,
+              const Header &header, const VertexShading &shading,
+              fastuidraw::c_array<const fastuidraw::generic_data> store,
+              ProcessedVertex &dst, int &z_add) const
+{
+  using namespace fastuidraw;
+
+  vec4 primary_attrib, secondary_attrib;
+
+  primary_attrib = as_float(attrib.m_attrib0);
+  secondary_attrib = as_float(attrib.m_attrib1);
+  z_add = 0;
+
+  switch(kind)
+    {
+    default:
+    case fill_kind:
+      return vec2(primary_attrib.x(), primary_attrib.y());
+
+    case aa_fuzz_kind:
+      {
+        /* see fastuidraw_painter_fill_aa_fuzz.vert.glsl */
+        vec2 p(primary_attrib.x(), primary_attrib.y());
+        vec2 n(primary_attrib.z(), primary_attrib.w());
+        float sgn(secondary_attrib.x());
+
+        if (t_abs(sgn) > 0.5f)
+          {
+            vec3 clip_p;
+            float dist;
+
+            n *= sgn;
+            clip_p = shading.clip_point(p);
+            n = shading.align_normal_to_screen(clip_p, n);
+            dist = shading.local_distance_from_pixel_distance(1.0f, clip_p, shading.clip_direction(n));
+            p += dist * n;
+          }
+        dst.m_varyings[0] = sgn;
+        z_add = static_cast<int>(attrib.m_attrib1.y());
+        return p;
+      }
+
+    case coverage_glyph_kind:
+    case distance_field_glyph_kind:
+    case anisotropic_distance_field_glyph_kind:
+      {
+        /* see fastuidraw_painter_glyph_coverage.vert.glsl; the texel
+         * coordinates are not normalized as the texel store is
+         * accessed as by FASTUIDRAW_PAINTER_EMULATE_GLYPH_TEXEL_STORE_FLOAT
+         */
+        dst.m_varyings[0] = primary_attrib.x();
+        dst.m_varyings[1] = primary_attrib.y();
+        dst.m_layer = static_cast<int>(as_float(attrib.m_attrib2.z()));
+        return vec2(secondary_attrib.x(), secondary_attrib.y());
+      }
+
+    case rounded_rect_kind:
+    case rounded_rect_clip_inside_kind:
+    case rounded_rect_clip_outside_kind:
+      {
+        /* see fastuidraw_painter_rounded_rect.vert.glsl */
+        vec2 p(primary_attrib.x(), primary_attrib.y());
+        vec2 q(primary_attrib.z(), primary_attrib.w());
+        vec2 center(0.5f * (p + q));
+        vec4 uint_attrib(as_float(attrib.m_attrib2));
+
+        if (kind == rounded_rect_kind)
+          {
+            vec3 clip_p;
+            vec2 outward(sign_of(p.x() - q.x()), sign_of(p.y() - q.y()));
+
+            clip_p = shading.clip_point(p);
+            p.x() += outward.x() * shading.local_distance_from_pixel_distance(1.0f, clip_p,
+                                                                              shading.clip_direction(vec2(1.0f, 0.0f)));
+            p.y() += outward.y() * shading.local_distance_from_pixel_distance(1.0f, clip_p,
+                                                                              shading.clip_direction(vec2(0.0f, 1.0f)));
+          }
+
+        dst.m_varyings[0] = p.x() - center.x();
+        dst.m_varyings[1] = p.y() - center.y();
+        dst.m_varyings[2] = 0.5f * t_abs(primary_attrib.x() - primary_attrib.z());
+        dst.m_varyings[3] = 0.5f * t_abs(primary_attrib.y() - primary_attrib.w());
+        for(unsigned int i = 0; i < 4; ++i)
+          {
+            dst.m_varyings[4 + i] = secondary_attrib[i];
+            dst.m_varyings[8 + i] = uint_attrib[i];
+          }
+        return p;
+      }
+
+    case stroke_non_aa_kind:
+    case stroke_aa_pass1_kind:
+    case stroke_aa_pass2_kind:
+      {
+        /* see fastuidraw_painter_stroke.vert.glsl and
+         * fastuidraw_painter_stroke_compute_offset.vert.glsl
+         * for non-dashed stroking.
+         */
+        const float anti_alias_thickness = 1.5f;
+        vec2 position(primary_attrib.x(), primary_attrib.y());
+        vec2 pre_offset(primary_attrib.z(), primary_attrib.w());
+        vec2 auxiliary_offset(secondary_attrib.z(), secondary_attrib.w());
+        uint32_t point_packed_data(attrib.m_attrib2.x());
+        int offset_type;
+        bool on_boundary, stroke_width_pixels;
+        float stroke_radius, miter_limit;
+        vec2 p, offset;
+
+        offset_type = unpack_bits(StrokedPoint::offset_type_bit0,
+                                  StrokedPoint::offset_type_num_bits,
+                                  point_packed_data);
+        on_boundary = unpack_bits(StrokedPoint::boundary_bit, 1u, point_packed_data) != 0u;
+        stroke_radius = store[header.m_item_shader_data + PainterStrokeParams::stroke_radius_offset].f;
+        miter_limit = store[header.m_item_shader_data + PainterStrokeParams::stroke_miter_limit_offset].f;
+        stroke_width_pixels = (stroke_radius < 0.0f);
+        stroke_radius = t_abs(stroke_radius);
+
+        if (kind == stroke_aa_pass1_kind && stroke_width_pixels)
+          {
+            stroke_radius = t_max(stroke_radius - anti_alias_thickness, 0.0f);
+          }
+
+        if (on_boundary)
+          {
+            vec2 n0(pre_offset), Jn0(n0.y(), -n0.x());
+            vec2 n1(auxiliary_offset), Jn1(n1.y(), -n1.x());
+
+            if (!stroke_width_pixels)
+              {
+                switch(offset_type)
+                  {
+                  case StrokedPoint::offset_miter_clip_join:
+                    {
+                      float r, det, lambda;
+
+                      det = dot(Jn1, n0);
+                      lambda = -sign_of(det);
+                      r = (det != 0.0f) ? (dot(n0, n1) - 1.0f) / det : 0.0f;
+                      if (point_packed_data & StrokedPoint::lambda_negated_mask)
+                        {
+                          lambda = -lambda;
+                        }
+                      if (miter_limit >= 0.0f)
+                        {
+                          float mm;
+                          mm = miter_limit * t_abs(r) / std::sqrt(1.0f + r * r);
+                          r = clamp_value(r, -mm, mm);
+                        }
+                      offset = lambda * (n0 + r * Jn0);
+                    }
+                    break;
+
+                  case StrokedPoint::offset_miter_join:
+                  case StrokedPoint::offset_miter_bevel_join:
+                    {
+                      vec2 n0_plus_n1(n0 + n1);
+                      float r, lambda, den;
+
+                      lambda = sign_of(dot(Jn0, n1));
+                      den = 1.0f + dot(n0, n1);
+                      r = (den != 0.0f) ? 1.0f / den : 0.0f;
+                      if (miter_limit >= 0.0f)
+                        {
+                          float d, den_m;
+                          d = dot(n0_plus_n1, n0_plus_n1);
+                          den_m = miter_limit * den;
+                          if (d >= den_m * den_m)
+                            {
+                              r = (offset_type == StrokedPoint::offset_miter_bevel_join) ?
+                                0.5f :
+                                miter_limit / std::sqrt(d);
+                            }
+                        }
+                      r = t_max(r, 0.5f) * lambda;
+                      offset = r * n0_plus_n1;
+                    }
+                    break;
+
+                  case StrokedPoint::offset_rounded_join:
+                    offset = VertexShading::unpack_unit_vector(auxiliary_offset.y(),
+                                                               point_packed_data & StrokedPoint::sin_sign_mask);
+                    break;
+
+                  case StrokedPoint::offset_square_cap:
+                    offset = pre_offset + auxiliary_offset;
+                    break;
+
+                  case StrokedPoint::offset_rounded_cap:
+                    offset = auxiliary_offset.x() * Jn0 + auxiliary_offset.y() * pre_offset;
+                    break;
+
+                  default:
+                    offset = pre_offset;
+                  }
+              }
+            else
+              {
+                switch(offset_type)
+                  {
+                  case StrokedPoint::offset_miter_clip_join:
+                  case StrokedPoint::offset_miter_join:
+                  case StrokedPoint::offset_miter_bevel_join:
+                    {
+                      vec3 clip_p;
+                      vec2 v0(Jn0), v1(Jn1), d0, d1, delta_d;
+                      float lambda, r0, r1, det;
+
+                      lambda = -sign_of(dot(v1, n0));
+                      if (offset_type == StrokedPoint::offset_miter_clip_join
+                          && (point_packed_data & StrokedPoint::lambda_negated_mask) != 0u)
+                        {
+                          lambda = -lambda;
+                        }
+
+                      clip_p = shading.clip_point(position);
+                      n0 = lambda * shading.align_normal_to_screen(clip_p, n0);
+                      n1 = lambda * shading.align_normal_to_screen(clip_p, n1);
+                      if (offset_type != StrokedPoint::offset_miter_clip_join)
+                        {
+                          n0 = normalize_vec(n0);
+                          n1 = normalize_vec(n1);
+                        }
+
+                      r0 = shading.local_distance_from_pixel_distance(stroke_radius, clip_p, shading.clip_direction(n0));
+                      d0 = r0 * n0;
+                      r1 = shading.local_distance_from_pixel_distance(stroke_radius, clip_p, shading.clip_direction(n1));
+                      d1 = r1 * n1;
+
+                      delta_d = d1 - d0;
+                      det = v0.x() * v1.y() - v0.y() * v1.x();
+
+                      if (offset_type == StrokedPoint::offset_miter_clip_join)
+                        {
+                          float r;
+
+                          r = (det != 0.0f) ? (v1.y() * delta_d.x() - v1.x() * delta_d.y()) / det : 0.0f;
+                          if (miter_limit >= 0.0f)
+                            {
+                              float m, mm;
+                              m = miter_limit * d0.magnitude();
+                              mm = m * t_abs(r) / (d0 + r * v0).magnitude();
+                              r = clamp_value(r, -mm, mm);
+                            }
+                          offset = d0 + r * v0;
+                        }
+                      else if (det != 0.0f)
+                        {
+                          float r;
+
+                          r = (v1.y() * delta_d.x() - v1.x() * delta_d.y()) / det;
+                          offset = d0 + r * v0;
+                          if (miter_limit >= 0.0f)
+                            {
+                              float m, l;
+                              m = miter_limit * t_max(r0, r1);
+                              l = offset.magnitude();
+                              if (l > m)
+                                {
+                                  if (offset_type == StrokedPoint::offset_miter_bevel_join)
+                                    {
+                                      offset = 0.5f * (d0 + d1);
+                                    }
+                                  else
+                                    {
+                                      float k;
+                                      k = 0.5f * (d0 + d1).magnitude();
+                                      offset *= t_max(m, k) / l;
+                                    }
+                                }
+                            }
+                        }
+                      else
+                        {
+                          offset = 0.5f * (d0 + d1);
+                        }
+                      stroke_radius = 1.0f;
+                    }
+                    break;
+
+                  case StrokedPoint::offset_rounded_join:
+                    {
+                      vec3 clip_p;
+                      vec2 t0, t1, screen_t0, screen_t1, screen_t, screen_n;
+                      float interpolate, d;
+                      mat2 Q, adjQ;
+
+                      n0 = VertexShading::unpack_unit_vector(pre_offset.x(),
+                                                             point_packed_data & StrokedPoint::normal0_y_sign_mask);
+                      n1 = VertexShading::unpack_unit_vector(pre_offset.y(),
+                                                             point_packed_data & StrokedPoint::normal1_y_sign_mask);
+                      interpolate = auxiliary_offset.x();
+
+                      clip_p = shading.clip_point(position);
+                      shading.compute_Q_adjoint_Q(clip_p, Q, adjQ);
+
+                      t0 = vec2(-n0.y(), n0.x());
+                      t1 = vec2(-n1.y(), n1.x());
+                      screen_t0 = normalize_vec(shading.m_viewport_pixels * (Q * t0));
+                      screen_t1 = normalize_vec(shading.m_viewport_pixels * (Q * t1));
+                      d = dot(screen_t0, screen_t1);
+
+                      screen_t = (d > 0.0f) ?
+                        screen_t0 + interpolate * (screen_t1 - screen_t0) :
+                        VertexShading::circular_interpolate(screen_t0, screen_t1, d, interpolate);
+                      screen_n = vec2(screen_t.y(), -screen_t.x());
+
+                      offset = adjQ * (shading.m_viewport_recip_pixels * screen_n);
+                      stroke_radius = shading.local_distance_from_pixel_distance(stroke_radius, clip_p,
+                                                                                 shading.clip_direction(offset));
+                    }
+                    break;
+
+                  case StrokedPoint::offset_square_cap:
+                    {
+                      vec3 clip_p;
+                      float s0, s1;
+                      vec2 n;
+
+                      clip_p = shading.clip_point(position);
+                      s0 = shading.local_distance_from_pixel_distance(stroke_radius, clip_p,
+                                                                      shading.clip_direction(auxiliary_offset));
+                      clip_p = shading.clip_point(position + s0 * auxiliary_offset);
+                      n = shading.align_normal_to_screen(clip_p, pre_offset);
+                      s1 = shading.local_distance_from_pixel_distance(stroke_radius, clip_p,
+                                                                      shading.clip_direction(n));
+                      stroke_radius = 1.0f;
+                      offset = s0 * auxiliary_offset + s1 * n;
+                    }
+                    break;
+
+                  case StrokedPoint::offset_rounded_cap:
+                    {
+                      vec3 clip_p;
+                      vec2 n, tn(auxiliary_offset);
+
+                      clip_p = shading.clip_point(position);
+                      n = shading.align_normal_to_screen(clip_p, pre_offset);
+                      tn.x() = shading.local_distance_from_pixel_distance(tn.x() * stroke_radius, clip_p,
+                                                                          shading.clip_direction(Jn0));
+                      tn.y() = shading.local_distance_from_pixel_distance(tn.y() * stroke_radius, clip_p,
+                                                                          shading.clip_direction(n));
+                      stroke_radius = 1.0f;
+                      offset = tn.x() * Jn0 + tn.y() * n;
+                    }
+                    break;
+
+                  default:
+                    {
+                      vec3 clip_p;
+                      vec2 n;
+
+                      clip_p = (point_packed_data & StrokedPoint::end_sub_edge_mask) ?
+                        shading.clip_point(position + auxiliary_offset) :
+                        shading.clip_point(position);
+                      n = shading.align_normal_to_screen(clip_p, pre_offset);
+                      stroke_radius = shading.local_distance_from_pixel_distance(stroke_radius, clip_p,
+                                                                                 shading.clip_direction(n));
+                      offset = n;
+                    }
+                  }
+              }
+
+            p = position + stroke_radius * offset;
+            if (kind == stroke_aa_pass1_kind && !stroke_width_pixels)
+              {
+                vec3 clip_p;
+                float r;
+
+                clip_p = shading.clip_point(p);
+                r = shading.local_distance_from_pixel_distance(anti_alias_thickness, clip_p,
+                                                               shading.clip_direction(offset));
+                p -= t_min(stroke_radius, r) * offset;
+              }
+          }
+        else
+          {
+            p = position;
+          }
+
+        dst.m_varyings[0] = (on_boundary) ? 1.0f : 0.0f;
+        z_add = unpack_bits(StrokedPoint::depth_bit0,
+                            StrokedPoint::depth_num_bits,
+                            point_packed_data);
+        return p;
+      }
+    }
+}
+
+void
+PainterRasterizerPrivate::
+assemble_triangles(void)
+{
+  using namespace fastuidraw;
+
+  BlendMode::packed_value packed_blend(m_initial_packed_blend);
+  unsigned int tile_size;
+
+  tile_size = t_max(1u, m_params.tile_size());
+  for(unsigned int d = 0, endd = m_draws.size(); d < endd; ++d)
+    {
+      const cpu::PainterBackendRecorder::RecordedDraw &draw(m_draws[d]);
+      const ProcessedVertex *vertices(&m_vertices[m_draw_vertex_offsets[d]]);
+      unsigned int current_break(0);
+
+      for(unsigned int i = 0; i + 2 < draw.m_indices.size(); i += 3)
+        {
+          ProcessedTriangle tri;
+          const ProcessedVertex *v0;
+          vec2 bb_min, bb_max;
+
+          while (current_break < draw.m_breaks.size()
+                 && draw.m_breaks[current_break].m_indices_written <= i)
+            {
+              if (draw.m_breaks[current_break].m_type == cpu::PainterBackendRecorder::DrawBreak::shader_group_break)
+                {
+                  packed_blend = draw.m_breaks[current_break].m_packed_blend_mode;
+                }
+              ++current_break;
+            }
+
+          ++m_stats[cpu::PainterRasterizer::num_triangles];
+          for(unsigned int k = 0; k < 3; ++k)
+            {
+              tri.m_vertices[k] = &vertices[draw.m_indices[i + k]];
+            }
+
+          v0 = tri.m_vertices[0];
+          if (v0->m_kind == unsupported_kind)
+            {
+              ++m_stats[cpu::PainterRasterizer::num_triangles_skipped];
+              continue;
+            }
+
+          /* triangles crossing w = 0 would need to be clipped
+           * against the near plane; the projections used by
+           * Painter do not make such triangles, so just drop them.
+           */
+          if (tri.m_vertices[0]->m_clip_w <= 0.0f
+              || tri.m_vertices[1]->m_clip_w <= 0.0f
+              || tri.m_vertices[2]->m_clip_w <= 0.0f)
+            {
+              continue;
+            }
+
+          bb_min = bb_max = v0->m_window;
+          for(unsigned int k = 1; k < 3; ++k)
+            {
+              bb_min.x() = t_min(bb_min.x(), tri.m_vertices[k]->m_window.x());
+              bb_min.y() = t_min(bb_min.y(), tri.m_vertices[k]->m_window.y());
+              bb_max.x() = t_max(bb_max.x(), tri.m_vertices[k]->m_window.x());
+              bb_max.y() = t_max(bb_max.y(), tri.m_vertices[k]->m_window.y());
+            }
+
+          tri.m_min.x() = t_max(m_scissor_min.x(), static_cast<int>(std::floor(bb_min.x())));
+          tri.m_min.y() = t_max(m_scissor_min.y(), static_cast<int>(std::floor(bb_min.y())));
+          tri.m_max.x() = t_min(m_scissor_max.x(), static_cast<int>(std::ceil(bb_max.x())) + 1);
+          tri.m_max.y() = t_min(m_scissor_max.y(), static_cast<int>(std::ceil(bb_max.y())) + 1);
+          if (tri.m_min.x() >= tri.m_max.x() || tri.m_min.y() >= tri.m_max.y())
+            {
+              continue;
+            }
+
+          tri.m_blend_mode = blend_mode(v0->m_blend_shader, packed_blend);
+          for(int ty = tri.m_min.y() / tile_size, endty = (tri.m_max.y() - 1) / tile_size; ty <= endty; ++ty)
+            {
+              for(int tx = tri.m_min.x() / tile_size, endtx = (tri.m_max.x() - 1) / tile_size; tx <= endtx; ++tx)
+                {
+                  m_bins[tx + ty * m_number_tiles.x()].push_back(m_triangles.size());
+                }
+            }
+          m_triangles.push_back(tri);
+        }
+    }
+}
+
+void
+PainterRasterizerPrivate::
+rasterize_tiles(unsigned int thread_id)
+{
+  unsigned int tile_size, num_tiles;
+
+  tile_size = fastuidraw::t_max(1u, m_params.tile_size());
+  num_tiles = m_bins.size();
+  for(unsigned int tile = m_next_tile++; tile < num_tiles; tile = m_next_tile++)
+    {
+      fastuidraw::ivec2 tile_min, tile_max;
+
+      tile_min.x() = (tile % m_number_tiles.x()) * tile_size;
+      tile_min.y() = (tile / m_number_tiles.x()) * tile_size;
+      tile_max.x() = fastuidraw::t_min(m_dimensions.x(), tile_min.x() + int(tile_size));
+      tile_max.y() = fastuidraw::t_min(m_dimensions.y(), tile_min.y() + int(tile_size));
+
+      for(unsigned int t : m_bins[tile])
+        {
+          rasterize_triangle(m_triangles[t], tile_min, tile_max, m_thread_stats[thread_id]);
+        }
+    }
+}
+
+void
+PainterRasterizerPrivate::
+rasterize_triangle(const ProcessedTriangle &tri,
+                   const fastuidraw::ivec2 &tile_min,
+                   const fastuidraw::ivec2 &tile_max,
+                   ThreadStats &stats)
+{
+  using namespace fastuidraw;
+
+  TriangleSetup setup(tri);
+  ivec2 pmin, pmax;
+
+  if (setup.m_recip_area == 0.0f)
+    {
+      return;
+    }
+
+  pmin.x() = t_max(tri.m_min.x(), tile_min.x());
+  pmin.y() = t_max(tri.m_min.y(), tile_min.y());
+  pmax.x() = t_min(tri.m_max.x(), tile_max.x());
+  pmax.y() = t_min(tri.m_max.y(), tile_max.y());
+
+  for(int y = pmin.y(); y < pmax.y(); ++y)
+    {
+      for(int x = pmin.x(); x < pmax.x(); ++x)
+        {
+          vec2 pt(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+          vecN<float, 4> clip_distances;
+          vec3 b;
+          Varyings v;
+          float depth, alpha;
+          unsigned int pixel;
+
+          if (!setup.inside(pt, b))
+            {
+              continue;
+            }
+
+          setup.interpolate_clip_distances(b, clip_distances);
+          if (clip_distances[0] < 0.0f || clip_distances[1] < 0.0f
+              || clip_distances[2] < 0.0f || clip_distances[3] < 0.0f)
+            {
+              continue;
+            }
+
+          ++stats.m_fragments;
+          setup.interpolate(b, v);
+          if (!shade_fragment(tri, setup, pt, v, alpha))
+            {
+              continue;
+            }
+
+          pixel = x + y * m_dimensions.x();
+          depth = setup.depth(b);
+          if (depth < m_depth[pixel])
+            {
+              continue;
+            }
+          m_depth[pixel] = depth;
+          ++stats.m_fragments_written;
+
+          /* as in the uber-shader: v = brush * item color, then
+           * pre-multiplied by alpha, then sent to the blend shader.
+           */
+          vec4 src(tri.m_vertices[0]->m_brush_color);
+          vec4 dst;
+          float fs, fd;
+
+          src.w() *= alpha;
+          src.x() *= src.w();
+          src.y() *= src.w();
+          src.z() *= src.w();
+          for(unsigned int c = 0; c < 4; ++c)
+            {
+              dst[c] = static_cast<float>(m_color[pixel][c]) / 255.0f;
+            }
+
+          switch(tri.m_blend_mode)
+            {
+            case PainterEnums::blend_porter_duff_clear:
+              fs = 0.0f; fd = 0.0f;
+              break;
+            case PainterEnums::blend_porter_duff_src:
+              fs = 1.0f; fd = 0.0f;
+              break;
+            case PainterEnums::blend_porter_duff_dst:
+              fs = 0.0f; fd = 1.0f;
+              break;
+            case PainterEnums::blend_porter_duff_dst_over:
+              fs = 1.0f - dst.w(); fd = 1.0f;
+              break;
+            case PainterEnums::blend_porter_duff_src_in:
+              fs = dst.w(); fd = 0.0f;
+              break;
+            case PainterEnums::blend_porter_duff_dst_in:
+              fs = 0.0f; fd = src.w();
+              break;
+            case PainterEnums::blend_porter_duff_src_out:
+              fs = 1.0f - dst.w(); fd = 0.0f;
+              break;
+            case PainterEnums::blend_porter_duff_dst_out:
+              fs = 0.0f; fd = 1.0f - src.w();
+              break;
+            case PainterEnums::blend_porter_duff_src_atop:
+              fs = dst.w(); fd = 1.0f - src.w();
+              break;
+            case PainterEnums::blend_porter_duff_dst_atop:
+              fs = 1.0f - dst.w(); fd = src.w();
+              break;
+            case PainterEnums::blend_porter_duff_xor:
+              fs = 1.0f - dst.w(); fd = 1.0f - src.w();
+              break;
+            default:
+              fs = 1.0f; fd = 1.0f - src.w();
+            }
+
+          for(unsigned int c = 0; c < 4; ++c)
+            {
+              float f;
+              f = clamp_value(fs * src[c] + fd * dst[c], 0.0f, 1.0f);
+              m_color[pixel][c] = static_cast<uint8_t>(255.0f * f + 0.5f);
+            }
+        }
+    }
+}
+
+bool
+PainterRasterizerPrivate::
+shade_fragment(const ProcessedTriangle &tri, const TriangleSetup &setup,
+               const fastuidraw::vec2 &pt, const Varyings &v,
+               float &alpha) const
+{
+  using namespace fastuidraw;
+
+  const ProcessedVertex *v0(tri.m_vertices[0]);
+
+  /* values of the varyings one pixel to the right and one pixel
+   * up; these play the role of dFdx() and dFdy().
+   */
+  Varyings vx, vy;
+  if (v0->m_kind == distance_field_glyph_kind
+      || v0->m_kind == anisotropic_distance_field_glyph_kind
+      || v0->m_kind == stroke_aa_pass2_kind
+      || v0->m_kind == rounded_rect_kind)
+    {
+      vec3 b;
+
+      setup.barycentric(pt + vec2(1.0f, 0.0f), b);
+      setup.interpolate(b, vx);
+      setup.barycentric(pt + vec2(0.0f, 1.0f), b);
+      setup.interpolate(b, vy);
+    }
+
+  switch(v0->m_kind)
+    {
+    default:
+    case fill_kind:
+    case stroke_non_aa_kind:
+    case stroke_aa_pass1_kind:
+      alpha = 1.0f;
+      return true;
+
+    case aa_fuzz_kind:
+      alpha = 1.0f - t_abs(v[0]);
+      return true;
+
+    case coverage_glyph_kind:
+      alpha = m_glyph_texels.bilinear(v[0], v[1], v0->m_layer);
+      return true;
+
+    case distance_field_glyph_kind:
+      {
+        float dist, scale, t;
+        vec2 dx, dy;
+
+        dist = 2.0f * m_glyph_texels.bilinear(v[0], v[1], v0->m_layer) - 1.0f;
+        dx = vec2(vx[0] - v[0], vx[1] - v[1]);
+        dy = vec2(vy[0] - v[0], vy[1] - v[1]);
+        scale = std::sqrt(0.5f * (dot(dx, dx) + dot(dy, dy)));
+
+        /* smoothstep(-0.4 * scale, 0.4 * scale, dist) */
+        t = (scale > 0.0f) ?
+          clamp_value((dist + 0.4f * scale) / (0.8f * scale), 0.0f, 1.0f) :
+          ((dist >= 0.0f) ? 1.0f : 0.0f);
+        alpha = t * t * (3.0f - 2.0f * t);
+        return true;
+      }
+
+    case anisotropic_distance_field_glyph_kind:
+      {
+        float dist, ddx, ddy, mag_sq;
+
+        dist = 2.0f * m_glyph_texels.bilinear(v[0], v[1], v0->m_layer) - 1.0f;
+        ddx = 2.0f * m_glyph_texels.bilinear(vx[0], vx[1], v0->m_layer) - 1.0f - dist;
+        ddy = 2.0f * m_glyph_texels.bilinear(vy[0], vy[1], v0->m_layer) - 1.0f - dist;
+        mag_sq = ddx * ddx + ddy * ddy;
+        alpha = (mag_sq > 0.0f) ?
+          clamp_value(0.5f + dist / std::sqrt(mag_sq), 0.0f, 1.0f) :
+          ((dist > 0.0f) ? 1.0f : 0.0f);
+        return true;
+      }
+
+    case stroke_aa_pass2_kind:
+      {
+        float q, fw, dd;
+
+        q = 1.0f - v[0];
+        fw = t_abs((1.0f - vx[0]) - q) + t_abs((1.0f - vy[0]) - q);
+        dd = t_max(q, fw);
+        alpha = (dd > 0.0f) ? q / dd : 0.0f;
+        return true;
+      }
+
+    case rounded_rect_kind:
+    case rounded_rect_clip_inside_kind:
+    case rounded_rect_clip_outside_kind:
+      {
+        /* see fastuidraw_painter_rounded_rect.frag.glsl */
+        class Local
+        {
+        public:
+          static
+          float
+          signed_distance(const Varyings &v)
+          {
+            vec2 p(v[0], v[1]), half_size(v[2], v[3]), radii, q;
+
+            if (p.y() < 0.0f)
+              {
+                radii = (p.x() < 0.0f) ? vec2(v[4], v[5]) : vec2(v[6], v[7]);
+              }
+            else
+              {
+                radii = (p.x() < 0.0f) ? vec2(v[8], v[9]) : vec2(v[10], v[11]);
+              }
+
+            q = half_size - vec2(t_abs(p.x()), t_abs(p.y()));
+            if (radii.x() > 0.0f && radii.y() > 0.0f && q.x() < radii.x() && q.y() < radii.y())
+              {
+                vec2 e, grad;
+                float L;
+
+                e = (radii - q) / radii;
+                L = e.magnitude();
+                grad = e / (radii * t_max(L, 1e-6f));
+                return (L - 1.0f) / t_max(grad.magnitude(), 1e-6f);
+              }
+            return t_max(-q.x(), -q.y());
+          }
+        };
+
+        float d;
+
+        d = Local::signed_distance(v);
+        if (v0->m_kind == rounded_rect_kind)
+          {
+            float fw;
+
+            fw = t_abs(Local::signed_distance(vx) - d) + t_abs(Local::signed_distance(vy) - d);
+            alpha = clamp_value(0.5f - d / t_max(fw, 1e-6f), 0.0f, 1.0f);
+            return true;
+          }
+
+        alpha = 1.0f;
+        return (d <= 0.0f) != (v0->m_kind == rounded_rect_clip_outside_kind);
+      }
+    }
+}
+
+//////////////////////////////////////////////////////////////
+// fastuidraw::cpu::PainterRasterizer::params methods
+fastuidraw::cpu::PainterRasterizer::params::
+params(void)
+{
+  m_d = FASTUIDRAWnew ParamsPrivate();
+}
+
+fastuidraw::cpu::PainterRasterizer::params::
+params(const params &obj)
+{
+  ParamsPrivate *d;
+  d = static_cast<ParamsPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew ParamsPrivate(*d);
+}
+
+fastuidraw::cpu::PainterRasterizer::params::
+~params()
+{
+  ParamsPrivate *d;
+  d = static_cast<ParamsPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::cpu::PainterRasterizer::params)
+setget_implement(fastuidraw::cpu::PainterRasterizer::params, ParamsPrivate,
+                 unsigned int, number_threads)
+setget_implement(fastuidraw::cpu::PainterRasterizer::params, ParamsPrivate,
+                 unsigned int, tile_size)
+setget_implement(fastuidraw::cpu::PainterRasterizer::params, ParamsPrivate,
+                 const fastuidraw::vec4&, clear_color)
+
+//////////////////////////////////////////////
+// fastuidraw::cpu::PainterRasterizer methods
+fastuidraw::cpu::PainterRasterizer::
+PainterRasterizer(const reference_counted_ptr<PainterBackendRecorder> &backend,
+                  const params &P)
+{
+  m_d = FASTUIDRAWnew PainterRasterizerPrivate(backend, P);
+}
+
+fastuidraw::cpu::PainterRasterizer::
+~PainterRasterizer()
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::cpu::PainterRasterizer::params&
+fastuidraw::cpu::PainterRasterizer::
+param_values(void) const
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  return d->m_params;
+}
+
+void
+fastuidraw::cpu::PainterRasterizer::
+rasterize(void)
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+
+  d->prepare_frame();
+  d->run_threads([d](unsigned int thread_id) { d->process_vertices(thread_id); });
+  d->assemble_triangles();
+  d->run_threads([d](unsigned int thread_id) { d->rasterize_tiles(thread_id); });
+
+  ++d->m_stats[num_frames];
+  for(const ThreadStats &st : d->m_thread_stats)
+    {
+      d->m_stats[num_fragments] += st.m_fragments;
+      d->m_stats[num_fragments_written] += st.m_fragments_written;
+    }
+}
+
+fastuidraw::ivec2
+fastuidraw::cpu::PainterRasterizer::
+dimensions(void) const
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  return d->m_dimensions;
+}
+
+fastuidraw::c_array<const fastuidraw::u8vec4>
+fastuidraw::cpu::PainterRasterizer::
+pixels(void) const
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  return make_c_array(d->m_color);
+}
+
+unsigned int
+fastuidraw::cpu::PainterRasterizer::
+query_stat(enum stats_t st) const
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  return d->m_stats[st];
+}
+
+void
+fastuidraw::cpu::PainterRasterizer::
+reset_stats(void)
+{
+  PainterRasterizerPrivate *d;
+  d = static_cast<PainterRasterizerPrivate*>(m_d);
+  d->m_stats = vecN<unsigned int, num_stats>(0u);
+}
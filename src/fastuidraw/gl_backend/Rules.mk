@@ -16,7 +16,7 @@ include $(dir)/Rules.mk
 
 
 FASTUIDRAW_GL_SOURCES += $(call filelist, gl_get.cpp opengl_trait.cpp gluniform_implement.cpp \
-	gl_program.cpp gl_context_properties.cpp \
+	gl_program.cpp gl_context_properties.cpp gl_context_worker.cpp \
 	image_gl.cpp colorstop_atlas_gl.cpp glyph_atlas_gl.cpp \
 	painter_backend_gl.cpp)
 
@@ -30,7 +30,8 @@ namespace
   class BackingStore:public fastuidraw::ColorStopBackingStore
   {
   public:
-    BackingStore(int w, int l, bool delayed);
+    BackingStore(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                 int w, int l, bool delayed);
     ~BackingStore();
 
     virtual
@@ -57,10 +58,11 @@ namespace
 
     static
     fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore>
-    create(int w, int l, bool delayed)
+    create(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+           int w, int l, bool delayed)
     {
       BackingStore *p;
-      p = FASTUIDRAWnew BackingStore(w, l, delayed);
+      p = FASTUIDRAWnew BackingStore(worker, w, l, delayed);
       return fastuidraw::reference_counted_ptr<fastuidraw::ColorStopBackingStore>(p);
     }
 
@@ -118,12 +120,14 @@ namespace
     ColorStopAtlasGLParamsPrivate(void):
       m_width(1024),
       m_num_layers(32),
-      m_delayed(false)
+      m_delayed(false),
+      m_worker(FASTUIDRAWnew fastuidraw::gl::GLContextWorker())
     {}
 
     int m_width;
     int m_num_layers;
     bool m_delayed;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
   };
 
   class ColorStopAtlasGLPrivate
@@ -141,9 +145,10 @@ namespace
 //////////////////////////
 // BackingStore methods
 BackingStore::
-BackingStore(int w, int l, bool delayed):
+BackingStore(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+             int w, int l, bool delayed):
   fastuidraw::ColorStopBackingStore(w, l, true),
-  m_backing_store(dimensions_for_store(w, l), delayed)
+  m_backing_store(worker, dimensions_for_store(w, l), delayed)
 {
 }
 
@@ -212,6 +217,9 @@ setget_implement(fastuidraw::gl::ColorStopAtlasGL::params,
 setget_implement(fastuidraw::gl::ColorStopAtlasGL::params,
                  ColorStopAtlasGLParamsPrivate,
                  bool, delayed)
+setget_implement(fastuidraw::gl::ColorStopAtlasGL::params,
+                 ColorStopAtlasGLParamsPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker>&, worker)
 
 fastuidraw::gl::ColorStopAtlasGL::params&
 fastuidraw::gl::ColorStopAtlasGL::params::
@@ -224,8 +232,9 @@ optimal_width(void)
 // fastuidraw::gl::ColorStopAtlasGL methods
 fastuidraw::gl::ColorStopAtlasGL::
 ColorStopAtlasGL(const params &P):
-  fastuidraw::ColorStopAtlas(BackingStore::create(P.width(), P.num_layers(), P.delayed()))
+  fastuidraw::ColorStopAtlas(BackingStore::create(P.worker(), P.width(), P.num_layers(), P.delayed()))
 {
+  FASTUIDRAWassert(P.worker());
   m_d = FASTUIDRAWnew ColorStopAtlasGLPrivate(P);
 }
 
@@ -0,0 +1,276 @@
+/*!
+ * \file gl_context_worker.cpp
+ * \brief file gl_context_worker.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <fastuidraw/util/fastuidraw_memory.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
+#include <fastuidraw/gl_backend/ngl_header.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class WorkQueue
+  {
+  public:
+    unsigned int
+    size(void) const
+    {
+      return m_actions.size() + m_textures.size()
+        + m_buffers.size() + m_vertex_arrays.size()
+        + m_framebuffers.size() + m_samplers.size()
+        + m_programs.size() + m_shaders.size()
+        + m_syncs.size();
+    }
+
+    void
+    swap(WorkQueue &obj)
+    {
+      m_actions.swap(obj.m_actions);
+      m_textures.swap(obj.m_textures);
+      m_buffers.swap(obj.m_buffers);
+      m_vertex_arrays.swap(obj.m_vertex_arrays);
+      m_framebuffers.swap(obj.m_framebuffers);
+      m_samplers.swap(obj.m_samplers);
+      m_programs.swap(obj.m_programs);
+      m_shaders.swap(obj.m_shaders);
+      m_syncs.swap(obj.m_syncs);
+    }
+
+    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker::Action> > m_actions;
+    std::vector<GLuint> m_textures;
+    std::vector<GLuint> m_buffers;
+    std::vector<GLuint> m_vertex_arrays;
+    std::vector<GLuint> m_framebuffers;
+    std::vector<GLuint> m_samplers;
+    std::vector<GLuint> m_programs;
+    std::vector<GLuint> m_shaders;
+    std::vector<GLsync> m_syncs;
+  };
+
+  class GLContextWorkerPrivate
+  {
+  public:
+    void
+    add_name(std::vector<GLuint> &dst, GLuint name)
+    {
+      if (name != 0)
+        {
+          m_mutex.lock();
+          dst.push_back(name);
+          m_mutex.unlock();
+        }
+    }
+
+    mutable fastuidraw::mutex m_mutex;
+    WorkQueue m_queue;
+  };
+}
+
+//////////////////////////////////////////
+// fastuidraw::gl::GLContextWorker methods
+fastuidraw::gl::GLContextWorker::
+GLContextWorker(void)
+{
+  m_d = FASTUIDRAWnew GLContextWorkerPrivate();
+}
+
+fastuidraw::gl::GLContextWorker::
+~GLContextWorker()
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+add_action(const reference_counted_ptr<Action> &action)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+
+  if (action)
+    {
+      d->m_mutex.lock();
+      d->m_queue.m_actions.push_back(action);
+      d->m_mutex.unlock();
+    }
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_texture(GLuint texture)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_textures, texture);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_buffer(GLuint buffer)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_buffers, buffer);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_vertex_array(GLuint vao)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_vertex_arrays, vao);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_framebuffer(GLuint fbo)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_framebuffers, fbo);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_sampler(GLuint sampler)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_samplers, sampler);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_program(GLuint program)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_programs, program);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_shader(GLuint shader)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->add_name(d->m_queue.m_shaders, shader);
+}
+
+void
+fastuidraw::gl::GLContextWorker::
+delete_sync(GLsync sync)
+{
+  GLContextWorkerPrivate *d;
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+
+  if (sync != nullptr)
+    {
+      d->m_mutex.lock();
+      d->m_queue.m_syncs.push_back(sync);
+      d->m_mutex.unlock();
+    }
+}
+
+unsigned int
+fastuidraw::gl::GLContextWorker::
+number_pending(void) const
+{
+  GLContextWorkerPrivate *d;
+  unsigned int return_value;
+
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+  d->m_mutex.lock();
+  return_value = d->m_queue.size();
+  d->m_mutex.unlock();
+
+  return return_value;
+}
+
+unsigned int
+fastuidraw::gl::GLContextWorker::
+execute_actions(void)
+{
+  GLContextWorkerPrivate *d;
+  WorkQueue work;
+
+  d = static_cast<GLContextWorkerPrivate*>(m_d);
+
+  /* take the queue so that the lock is not held while
+   * issuing GL commands or executing the actions, an
+   * Action can then add to the queue without deadlock.
+   */
+  d->m_mutex.lock();
+  work.swap(d->m_queue);
+  d->m_mutex.unlock();
+
+  for(const auto &action : work.m_actions)
+    {
+      action->execute();
+    }
+
+  if (!work.m_textures.empty())
+    {
+      glDeleteTextures(work.m_textures.size(), &work.m_textures[0]);
+    }
+
+  if (!work.m_buffers.empty())
+    {
+      glDeleteBuffers(work.m_buffers.size(), &work.m_buffers[0]);
+    }
+
+  if (!work.m_vertex_arrays.empty())
+    {
+      glDeleteVertexArrays(work.m_vertex_arrays.size(), &work.m_vertex_arrays[0]);
+    }
+
+  if (!work.m_framebuffers.empty())
+    {
+      glDeleteFramebuffers(work.m_framebuffers.size(), &work.m_framebuffers[0]);
+    }
+
+  if (!work.m_samplers.empty())
+    {
+      glDeleteSamplers(work.m_samplers.size(), &work.m_samplers[0]);
+    }
+
+  /* glDeleteProgram and glDeleteShader take only one
+   * name each, programs are deleted first so that the
+   * shaders are not still attached to a program.
+   */
+  for(GLuint program : work.m_programs)
+    {
+      glDeleteProgram(program);
+    }
+
+  for(GLuint shader : work.m_shaders)
+    {
+      glDeleteShader(shader);
+    }
+
+  for(GLsync sync : work.m_syncs)
+    {
+      glDeleteSync(sync);
+    }
+
+  return work.size();
+}
@@ -22,6 +22,7 @@
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <cstdio>
 #include <set>
 #include <string>
 #include <map>
@@ -39,6 +40,7 @@
 #include <fastuidraw/gl_backend/gl_get.hpp>
 #include <fastuidraw/gl_backend/gl_context_properties.hpp>
 #include <fastuidraw/gl_backend/gl_program.hpp>
+#include "../private/util_private.hpp"
 
 namespace
 {
@@ -46,7 +48,8 @@ namespace
   {
   public:
     ShaderPrivate(const fastuidraw::glsl::ShaderSource &src,
-                  GLenum pshader_type);
+                  GLenum pshader_type,
+                  const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker);
 
     void
     compile(void);
@@ -58,6 +61,7 @@ namespace
     std::string m_source_code;
     std::string m_compile_log;
     bool m_compile_success;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
   };
 
   class BindAttributePrivate
@@ -66,10 +70,15 @@ namespace
     BindAttributePrivate(fastuidraw::c_string pname, int plocation):
       m_label(pname),
       m_location(plocation)
-    {}
+    {
+      std::ostringstream str;
+      str << "BindAttribute:" << m_location << ":" << m_label;
+      m_cache_key = str.str();
+    }
 
     std::string m_label;
     int m_location;
+    std::string m_cache_key;
   };
 
   class BindFragDataLocationPrivate
@@ -79,10 +88,16 @@ namespace
       m_label(pname),
       m_location(plocation),
       m_index(pindex)
-    {}
+    {
+      std::ostringstream str;
+      str << "BindFragDataLocation:" << m_location
+          << ":" << m_index << ":" << m_label;
+      m_cache_key = str.str();
+    }
 
     std::string m_label;
     int m_location, m_index;
+    std::string m_cache_key;
   };
 
   class PreLinkActionArrayPrivate
@@ -593,22 +608,109 @@ namespace
     std::string m_compile_log;
   };
 
+  /* File layout of a program binary of a ProgramBinaryCache
+   * (native byte order):
+   *   program_binary_file_header
+   *   key of program_binary_file_header::m_key_length bytes
+   *   program binary of program_binary_file_header::m_binary_size bytes
+   * Bump program_binary_version whenever the layout of the
+   * file or the generation of the key changes.
+   */
+  const char program_binary_magic[8] = { 'F', 'U', 'I', 'D', 'P', 'R', 'O', 'G' };
+  const uint32_t program_binary_byte_order = 0x01020304u;
+  const uint32_t program_binary_version = 2u;
+
+  class program_binary_file_header
+  {
+  public:
+    char m_magic[8];
+    uint32_t m_byte_order;
+    uint32_t m_version;
+    uint64_t m_key_hash;
+    uint64_t m_key_length;
+    uint32_t m_binary_format;
+    uint32_t m_padding;
+    uint64_t m_binary_size;
+  };
+
+  class ProgramBinaryCachePrivate
+  {
+  public:
+    typedef fastuidraw::reference_counted_ptr<fastuidraw::gl::Shader> ShaderRef;
+
+    explicit
+    ProgramBinaryCachePrivate(fastuidraw::c_string directory):
+      m_directory(directory),
+      m_number_hits(0),
+      m_number_misses(0)
+    {}
+
+    /* returns true if the current GL context can get and
+     * set program binaries.
+     */
+    static
+    bool
+    supported(void);
+
+    /* computes the key of the program binary of the shaders
+     * linked with the pre-link actions, the GL context must be
+     * current. Returns false if a pre-link action does not
+     * provide a PreLinkAction::cache_key().
+     */
+    static
+    bool
+    compute_key(const std::vector<ShaderRef> &shaders,
+                const fastuidraw::gl::PreLinkActionArray &actions,
+                std::string *out_key);
+
+    static
+    uint64_t
+    hash_key(const std::string &key);
+
+    bool
+    fetch(const std::string &key, GLenum *out_binary_format,
+          std::vector<uint8_t> *out_binary) const;
+
+    void
+    store(const std::string &key, GLenum binary_format,
+          const std::vector<uint8_t> &binary) const;
+
+    void
+    record(bool hit);
+
+    std::string
+    filename(uint64_t key_hash) const;
+
+    std::string m_directory;
+    mutable fastuidraw::mutex m_mutex;
+    unsigned int m_number_hits, m_number_misses;
+  };
+
   class ProgramPrivate
   {
   public:
     typedef fastuidraw::gl::Shader Shader;
     typedef fastuidraw::reference_counted_ptr<Shader> ShaderRef;
+    typedef fastuidraw::reference_counted_ptr<fastuidraw::gl::ProgramBinaryCache> BinaryCacheRef;
+    typedef fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> WorkerRef;
 
     ProgramPrivate(const fastuidraw::c_array<const ShaderRef> pshaders,
                    const fastuidraw::gl::PreLinkActionArray &action,
                    const fastuidraw::gl::ProgramInitializerArray &initers,
+                   const BinaryCacheRef &binary_cache,
+                   ProgramBinaryCachePrivate *binary_cache_d,
+                   const WorkerRef &worker,
                    fastuidraw::gl::Program *p):
       m_shaders(pshaders.begin(), pshaders.end()),
       m_name(0),
       m_delete_program(true),
       m_assembled(false),
+      m_from_binary(false),
       m_initializers(initers),
       m_pre_link_actions(action),
+      m_binary_cache(binary_cache),
+      m_binary_cache_d(binary_cache_d),
+      m_worker(worker),
       m_p(p)
     {
       for(const ShaderRef &R : m_shaders)
@@ -622,12 +724,19 @@ namespace
                    fastuidraw::reference_counted_ptr<fastuidraw::gl::Shader> frag_shader,
                    const fastuidraw::gl::PreLinkActionArray &action,
                    const fastuidraw::gl::ProgramInitializerArray &initers,
+                   const BinaryCacheRef &binary_cache,
+                   ProgramBinaryCachePrivate *binary_cache_d,
+                   const WorkerRef &worker,
                    fastuidraw::gl::Program *p):
       m_name(0),
       m_delete_program(true),
       m_assembled(false),
+      m_from_binary(false),
       m_initializers(initers),
       m_pre_link_actions(action),
+      m_binary_cache(binary_cache),
+      m_binary_cache_d(binary_cache_d),
+      m_worker(worker),
       m_p(p)
     {
       FASTUIDRAWassert(vert_shader && vert_shader->shader_type() == GL_VERTEX_SHADER);
@@ -640,19 +749,27 @@ namespace
                    const fastuidraw::glsl::ShaderSource &frag_shader,
                    const fastuidraw::gl::PreLinkActionArray &action,
                    const fastuidraw::gl::ProgramInitializerArray &initers,
+                   const BinaryCacheRef &binary_cache,
+                   ProgramBinaryCachePrivate *binary_cache_d,
+                   const WorkerRef &worker,
                    fastuidraw::gl::Program *p):
       m_name(0),
       m_delete_program(true),
       m_assembled(false),
+      m_from_binary(false),
       m_initializers(initers),
       m_pre_link_actions(action),
+      m_binary_cache(binary_cache),
+      m_binary_cache_d(binary_cache_d),
+      m_worker(worker),
       m_p(p)
     {
-      m_shaders.push_back(FASTUIDRAWnew fastuidraw::gl::Shader(vert_shader, GL_VERTEX_SHADER));
-      m_shaders.push_back(FASTUIDRAWnew fastuidraw::gl::Shader(frag_shader, GL_FRAGMENT_SHADER));
+      m_shaders.push_back(FASTUIDRAWnew fastuidraw::gl::Shader(vert_shader, GL_VERTEX_SHADER, worker));
+      m_shaders.push_back(FASTUIDRAWnew fastuidraw::gl::Shader(frag_shader, GL_FRAGMENT_SHADER, worker));
     }
 
-    ProgramPrivate(GLuint pname, bool take_ownership, fastuidraw::gl::Program *p);
+    ProgramPrivate(GLuint pname, bool take_ownership, const WorkerRef &worker,
+                   fastuidraw::gl::Program *p);
 
     void
     assemble(void);
@@ -663,6 +780,12 @@ namespace
     void
     clear_shaders_and_save_shader_data(void);
 
+    bool
+    load_from_binary_cache(const std::string &key);
+
+    void
+    save_to_binary_cache(const std::string &key);
+
     void
     generate_log(void);
 
@@ -672,7 +795,7 @@ namespace
 
     GLuint m_name;
     bool m_delete_program;
-    bool m_link_success, m_assembled;
+    bool m_link_success, m_assembled, m_from_binary;
     std::string m_link_log;
     std::string m_log;
     float m_assemble_time;
@@ -683,6 +806,9 @@ namespace
     ShaderStorageBlockSetInfo m_storage_buffer_list;
     fastuidraw::gl::ProgramInitializerArray m_initializers;
     fastuidraw::gl::PreLinkActionArray m_pre_link_actions;
+    BinaryCacheRef m_binary_cache;
+    ProgramBinaryCachePrivate *m_binary_cache_d;
+    WorkerRef m_worker;
     fastuidraw::gl::Program *m_p;
   };
 }
@@ -691,11 +817,13 @@ namespace
 // ShaderPrivate methods
 ShaderPrivate::
 ShaderPrivate(const fastuidraw::glsl::ShaderSource &src,
-              GLenum pshader_type):
+              GLenum pshader_type,
+              const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker):
   m_shader_ready(false),
   m_name(0),
   m_shader_type(pshader_type),
-  m_compile_success(false)
+  m_compile_success(false),
+  m_worker(worker)
 {
   m_source_code = std::string(src.assembled_code());
 }
@@ -1559,9 +1687,10 @@ populate_private_non_program_interface_query(GLuint program,
 ////////////////////////////////////////////////
 // fastuidraw::gl::Shader methods
 fastuidraw::gl::Shader::
-Shader(const glsl::ShaderSource &src, GLenum pshader_type)
+Shader(const glsl::ShaderSource &src, GLenum pshader_type,
+       const reference_counted_ptr<GLContextWorker> &worker)
 {
-  m_d = FASTUIDRAWnew ShaderPrivate(src, pshader_type);
+  m_d = FASTUIDRAWnew ShaderPrivate(src, pshader_type, worker);
 }
 
 fastuidraw::gl::Shader::
@@ -1570,14 +1699,16 @@ fastuidraw::gl::Shader::
   ShaderPrivate *d;
   d = static_cast<ShaderPrivate*>(m_d);
 
-  /*
-   * TODO: deletion of a shader should not be
-   * required to be done with a GL context
-   * current.
-   */
   if (d->m_name)
     {
-      glDeleteShader(d->m_name);
+      if (d->m_worker)
+        {
+          d->m_worker->delete_shader(d->m_name);
+        }
+      else
+        {
+          glDeleteShader(d->m_name);
+        }
     }
   FASTUIDRAWdelete(d);
   m_d = nullptr;
@@ -1705,6 +1836,15 @@ action(GLuint glsl_program) const
   glBindAttribLocation(glsl_program, d->m_location, d->m_label.c_str());
 }
 
+fastuidraw::c_string
+fastuidraw::gl::BindAttribute::
+cache_key(void) const
+{
+  BindAttributePrivate *d;
+  d = static_cast<BindAttributePrivate*>(m_d);
+  return d->m_cache_key.c_str();
+}
+
 
 ////////////////////////////////////////
 // fastuidraw::gl::BindFragDataLocation methods
@@ -1740,6 +1880,15 @@ action(GLuint glsl_program) const
   #endif
 }
 
+fastuidraw::c_string
+fastuidraw::gl::BindFragDataLocation::
+cache_key(void) const
+{
+  BindFragDataLocationPrivate *d;
+  d = static_cast<BindFragDataLocationPrivate*>(m_d);
+  return d->m_cache_key.c_str();
+}
+
 ////////////////////////////////////
 // ProgramSeparable methods
 void
@@ -1749,6 +1898,13 @@ action(GLuint glsl_program) const
   glProgramParameteri(glsl_program, GL_PROGRAM_SEPARABLE, GL_TRUE);
 }
 
+fastuidraw::c_string
+fastuidraw::gl::ProgramSeparable::
+cache_key(void) const
+{
+  return "ProgramSeparable";
+}
+
 
 ////////////////////////////////////////////
 // fastuidraw::gl::PreLinkActionArray methods
@@ -1821,6 +1977,15 @@ execute_actions(GLuint pr) const
     }
 }
 
+fastuidraw::c_array<const fastuidraw::reference_counted_ptr<fastuidraw::gl::PreLinkAction> >
+fastuidraw::gl::PreLinkActionArray::
+actions(void) const
+{
+  PreLinkActionArrayPrivate *d;
+  d = static_cast<PreLinkActionArrayPrivate*>(m_d);
+  return make_c_array(d->m_values);
+}
+
 
 ///////////////////////////////////////////////////
 // fastuidraw::gl::Program::shader_variable_info methods
@@ -2158,15 +2323,216 @@ variable(c_string name,
 }
 
 
+/////////////////////////////////////////////////////////
+//ProgramBinaryCachePrivate methods
+bool
+ProgramBinaryCachePrivate::
+supported(void)
+{
+  fastuidraw::gl::ContextProperties ctx_props;
+  bool return_value;
+
+  if (ctx_props.is_es())
+    {
+      return_value = ctx_props.version() >= fastuidraw::ivec2(3, 0);
+    }
+  else
+    {
+      return_value = ctx_props.version() >= fastuidraw::ivec2(4, 1)
+        || ctx_props.has_extension("GL_ARB_get_program_binary");
+    }
+
+  return return_value
+    && fastuidraw::gl::context_get<GLint>(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+}
+
+bool
+ProgramBinaryCachePrivate::
+compute_key(const std::vector<ShaderRef> &shaders,
+            const fastuidraw::gl::PreLinkActionArray &actions,
+            std::string *out_key)
+{
+  std::ostringstream str;
+  const GLenum driver_strings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+
+  for(GLenum e : driver_strings)
+    {
+      const GLubyte *v;
+
+      v = glGetString(e);
+      str << ((v) ? reinterpret_cast<fastuidraw::c_string>(v) : "") << "\n";
+    }
+
+  for(const ShaderRef &sh : shaders)
+    {
+      str << fastuidraw::gl::Shader::gl_shader_type_label(sh->shader_type())
+          << "\n" << sh->source_code() << '\0';
+    }
+
+  for(const auto &action : actions.actions())
+    {
+      fastuidraw::c_string v;
+
+      v = (action) ? action->cache_key() : "";
+      if (!v)
+        {
+          return false;
+        }
+      str << "PreLinkAction:" << v << '\0';
+    }
+
+  *out_key = str.str();
+  return true;
+}
+
+uint64_t
+ProgramBinaryCachePrivate::
+hash_key(const std::string &key)
+{
+  /* FNV-1a */
+  uint64_t h(0xcbf29ce484222325ull);
+  for(char c : key)
+    {
+      h ^= static_cast<uint8_t>(c);
+      h *= 0x100000001b3ull;
+    }
+  return h;
+}
+
+std::string
+ProgramBinaryCachePrivate::
+filename(uint64_t key_hash) const
+{
+  std::ostringstream str;
+
+  str << m_directory << "/fastuidraw_program_"
+      << std::hex << std::setw(16) << std::setfill('0')
+      << key_hash << ".bin";
+  return str.str();
+}
+
+bool
+ProgramBinaryCachePrivate::
+fetch(const std::string &key, GLenum *out_binary_format,
+      std::vector<uint8_t> *out_binary) const
+{
+  uint64_t key_hash(hash_key(key));
+  program_binary_file_header header;
+  std::ifstream file(filename(key_hash).c_str(), std::ios::binary);
+
+  if (!file)
+    {
+      return false;
+    }
+
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file
+      || std::memcmp(header.m_magic, program_binary_magic, sizeof(program_binary_magic)) != 0
+      || header.m_byte_order != program_binary_byte_order
+      || header.m_version != program_binary_version
+      || header.m_key_hash != key_hash
+      || header.m_key_length != key.length()
+      || header.m_binary_size == 0)
+    {
+      return false;
+    }
+
+  /* the hash only selects the file, two different keys can
+   * share a hash; the full key stored in the file must match.
+   */
+  std::vector<char> stored_key(key.length());
+  file.read(&stored_key[0], key.length());
+  if (!file || std::memcmp(&stored_key[0], key.data(), key.length()) != 0)
+    {
+      return false;
+    }
+
+  out_binary->resize(header.m_binary_size);
+  file.read(reinterpret_cast<char*>(&(*out_binary)[0]), header.m_binary_size);
+  if (!file)
+    {
+      out_binary->clear();
+      return false;
+    }
+
+  *out_binary_format = header.m_binary_format;
+  return true;
+}
+
+void
+ProgramBinaryCachePrivate::
+store(const std::string &key, GLenum binary_format,
+      const std::vector<uint8_t> &binary) const
+{
+  uint64_t key_hash(hash_key(key));
+  std::string name(filename(key_hash));
+  std::string tmp_name(name + ".tmp");
+  program_binary_file_header header;
+
+  std::memcpy(header.m_magic, program_binary_magic, sizeof(program_binary_magic));
+  header.m_byte_order = program_binary_byte_order;
+  header.m_version = program_binary_version;
+  header.m_key_hash = key_hash;
+  header.m_key_length = key.length();
+  header.m_binary_format = binary_format;
+  header.m_padding = 0;
+  header.m_binary_size = binary.size();
+
+  /* write to a temporary file first so that an interrupted
+   * write or another process reading the cache never sees
+   * a partial file.
+   */
+  {
+    std::ofstream file(tmp_name.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file)
+      {
+        return;
+      }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(key.data(), key.length());
+    file.write(reinterpret_cast<const char*>(&binary[0]), binary.size());
+    if (!file)
+      {
+        file.close();
+        std::remove(tmp_name.c_str());
+        return;
+      }
+  }
+
+  if (std::rename(tmp_name.c_str(), name.c_str()) != 0)
+    {
+      std::remove(tmp_name.c_str());
+    }
+}
+
+void
+ProgramBinaryCachePrivate::
+record(bool hit)
+{
+  fastuidraw::autolock_mutex M(m_mutex);
+  if (hit)
+    {
+      ++m_number_hits;
+    }
+  else
+    {
+      ++m_number_misses;
+    }
+}
+
 /////////////////////////////////////////////////////////
 //ProgramPrivate methods
 ProgramPrivate::
-ProgramPrivate(GLuint pname, bool take_ownership, fastuidraw::gl::Program *p):
+ProgramPrivate(GLuint pname, bool take_ownership, const WorkerRef &worker,
+               fastuidraw::gl::Program *p):
   m_name(pname),
   m_delete_program(take_ownership),
   m_link_success(true),
   m_assembled(true),
+  m_from_binary(false),
   m_assemble_time(0.0f),
+  m_binary_cache_d(nullptr),
+  m_worker(worker),
   m_p(p)
 {
   populate_info();
@@ -2237,41 +2603,69 @@ assemble(void)
   auto start_time = std::chrono::steady_clock::now();
 
   std::ostringstream error_ostr;
+  bool use_binary_cache;
+  std::string binary_key;
 
   m_assembled = true;
   FASTUIDRAWassert(m_name == 0);
-  m_name = glCreateProgram();
-  m_link_success = true;
 
-  //attatch the shaders, attaching a bad shader makes
-  //m_link_success become false
-  for(const auto &sh : m_shaders)
+  use_binary_cache = m_binary_cache_d
+    && ProgramBinaryCachePrivate::supported()
+    && ProgramBinaryCachePrivate::compute_key(m_shaders, m_pre_link_actions, &binary_key);
+  if (use_binary_cache)
     {
-      if (sh->compile_success())
-        {
-          glAttachShader(m_name, sh->name());
-        }
-      else
+      m_from_binary = load_from_binary_cache(binary_key);
+    }
+
+  if (!m_from_binary)
+    {
+      m_name = glCreateProgram();
+      m_link_success = true;
+
+      //attatch the shaders, attaching a bad shader makes
+      //m_link_success become false
+      for(const auto &sh : m_shaders)
         {
-          m_link_success = false;
+          if (sh->compile_success())
+            {
+              glAttachShader(m_name, sh->name());
+            }
+          else
+            {
+              m_link_success = false;
+            }
         }
-    }
 
-  //we no longer need the GL shaders.
-  clear_shaders_and_save_shader_data();
+      //we no longer need the GL shaders.
+      clear_shaders_and_save_shader_data();
 
-  //perform any pre-link actions and then clear them
-  m_pre_link_actions.execute_actions(m_name);
-  m_pre_link_actions = fastuidraw::gl::PreLinkActionArray();
+      //perform any pre-link actions and then clear them
+      m_pre_link_actions.execute_actions(m_name);
+      m_pre_link_actions = fastuidraw::gl::PreLinkActionArray();
 
-  //now finally link!
-  glLinkProgram(m_name);
+      if (use_binary_cache)
+        {
+          glProgramParameteri(m_name, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+
+      //now finally link!
+      glLinkProgram(m_name);
+    }
 
   auto end_time = std::chrono::steady_clock::now();
   m_assemble_time = std::chrono::duration<float>(end_time - start_time).count();
 
   populate_info();
 
+  if (use_binary_cache)
+    {
+      m_binary_cache_d->record(m_from_binary);
+      if (!m_from_binary && m_link_success)
+        {
+          save_to_binary_cache(binary_key);
+        }
+    }
+
   if (!m_link_success)
     {
       std::ostringstream oo;
@@ -2300,14 +2694,86 @@ clear_shaders_and_save_shader_data(void)
   for(unsigned int i = 0, endi = m_shaders.size(); i<endi; ++i)
     {
       m_shader_data[i].m_source_code = m_shaders[i]->source_code();
-      m_shader_data[i].m_name = m_shaders[i]->name();
       m_shader_data[i].m_shader_type = m_shaders[i]->shader_type();
-      m_shader_data[i].m_compile_log = m_shaders[i]->compile_log();
+
+      /* the shaders are not compiled if the program was
+       * loaded from a program binary; do not force
+       * them to be compiled.
+       */
+      if (m_shaders[i]->shader_ready())
+        {
+          m_shader_data[i].m_name = m_shaders[i]->name();
+          m_shader_data[i].m_compile_log = m_shaders[i]->compile_log();
+        }
+      else
+        {
+          m_shader_data[i].m_name = 0;
+        }
       m_shader_data_sorted_by_type[m_shader_data[i].m_shader_type].push_back(i);
     }
   m_shaders.clear();
 }
 
+bool
+ProgramPrivate::
+load_from_binary_cache(const std::string &key)
+{
+  GLenum binary_format;
+  std::vector<uint8_t> binary;
+  GLint linkOK;
+
+  if (!m_binary_cache_d->fetch(key, &binary_format, &binary))
+    {
+      return false;
+    }
+
+  m_name = glCreateProgram();
+  glProgramBinary(m_name, binary_format, &binary[0], binary.size());
+
+  /* GL rejects a binary (for example one made by a different
+   * build of the driver) by failing the link status; then
+   * the program is compiled and linked from source.
+   */
+  glGetProgramiv(m_name, GL_LINK_STATUS, &linkOK);
+  if (linkOK != GL_TRUE)
+    {
+      glDeleteProgram(m_name);
+      m_name = 0;
+      return false;
+    }
+
+  m_link_success = true;
+  clear_shaders_and_save_shader_data();
+  m_pre_link_actions = fastuidraw::gl::PreLinkActionArray();
+  return true;
+}
+
+void
+ProgramPrivate::
+save_to_binary_cache(const std::string &key)
+{
+  GLint length(0);
+  GLsizei written(0);
+  GLenum binary_format(GL_NONE);
+  std::vector<uint8_t> binary;
+
+  glGetProgramiv(m_name, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+    {
+      return;
+    }
+
+  binary.resize(length);
+  glGetProgramBinary(m_name, length, &written, &binary_format, &binary[0]);
+  if (written <= 0)
+    {
+      return;
+    }
+
+  binary.resize(written);
+  m_binary_cache_d->store(key, binary_format, binary);
+}
+
 void
 ProgramPrivate::
 generate_log(void)
@@ -2499,38 +2965,105 @@ generate_log(void)
   m_log = ostr.str();
 }
 
+////////////////////////////////////////////////////////
+//fastuidraw::gl::ProgramBinaryCache methods
+fastuidraw::gl::ProgramBinaryCache::
+ProgramBinaryCache(c_string directory)
+{
+  m_d = FASTUIDRAWnew ProgramBinaryCachePrivate(directory);
+}
+
+fastuidraw::gl::ProgramBinaryCache::
+~ProgramBinaryCache()
+{
+  ProgramBinaryCachePrivate *d;
+  d = static_cast<ProgramBinaryCachePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::c_string
+fastuidraw::gl::ProgramBinaryCache::
+directory(void) const
+{
+  ProgramBinaryCachePrivate *d;
+  d = static_cast<ProgramBinaryCachePrivate*>(m_d);
+  return d->m_directory.c_str();
+}
+
+unsigned int
+fastuidraw::gl::ProgramBinaryCache::
+number_hits(void) const
+{
+  ProgramBinaryCachePrivate *d;
+  d = static_cast<ProgramBinaryCachePrivate*>(m_d);
+
+  fastuidraw::autolock_mutex M(d->m_mutex);
+  return d->m_number_hits;
+}
+
+unsigned int
+fastuidraw::gl::ProgramBinaryCache::
+number_misses(void) const
+{
+  ProgramBinaryCachePrivate *d;
+  d = static_cast<ProgramBinaryCachePrivate*>(m_d);
+
+  fastuidraw::autolock_mutex M(d->m_mutex);
+  return d->m_number_misses;
+}
+
 ////////////////////////////////////////////////////////
 //fastuidraw::gl::Program methods
 fastuidraw::gl::Program::
 Program(c_array<const reference_counted_ptr<Shader> > pshaders,
         const PreLinkActionArray &action,
-        const ProgramInitializerArray &initers)
+        const ProgramInitializerArray &initers,
+        const reference_counted_ptr<ProgramBinaryCache> &binary_cache,
+        const reference_counted_ptr<GLContextWorker> &worker)
 {
-  m_d = FASTUIDRAWnew ProgramPrivate(pshaders, action, initers, this);
+  m_d = FASTUIDRAWnew ProgramPrivate(pshaders, action, initers, binary_cache,
+                                     (binary_cache) ?
+                                     static_cast<ProgramBinaryCachePrivate*>(binary_cache->m_d) :
+                                     nullptr,
+                                     worker, this);
 }
 
 fastuidraw::gl::Program::
 Program(reference_counted_ptr<Shader> vert_shader,
         reference_counted_ptr<Shader> frag_shader,
         const PreLinkActionArray &action,
-        const ProgramInitializerArray &initers)
+        const ProgramInitializerArray &initers,
+        const reference_counted_ptr<ProgramBinaryCache> &binary_cache,
+        const reference_counted_ptr<GLContextWorker> &worker)
 {
-  m_d = FASTUIDRAWnew ProgramPrivate(vert_shader, frag_shader, action, initers, this);
+  m_d = FASTUIDRAWnew ProgramPrivate(vert_shader, frag_shader, action, initers, binary_cache,
+                                     (binary_cache) ?
+                                     static_cast<ProgramBinaryCachePrivate*>(binary_cache->m_d) :
+                                     nullptr,
+                                     worker, this);
 }
 
 fastuidraw::gl::Program::
 Program(const glsl::ShaderSource &vert_shader,
         const glsl::ShaderSource &frag_shader,
         const PreLinkActionArray &action,
-        const ProgramInitializerArray &initers)
+        const ProgramInitializerArray &initers,
+        const reference_counted_ptr<ProgramBinaryCache> &binary_cache,
+        const reference_counted_ptr<GLContextWorker> &worker)
 {
-  m_d = FASTUIDRAWnew ProgramPrivate(vert_shader, frag_shader, action, initers, this);
+  m_d = FASTUIDRAWnew ProgramPrivate(vert_shader, frag_shader, action, initers, binary_cache,
+                                     (binary_cache) ?
+                                     static_cast<ProgramBinaryCachePrivate*>(binary_cache->m_d) :
+                                     nullptr,
+                                     worker, this);
 }
 
 fastuidraw::gl::Program::
-Program(GLuint pname, bool take_ownership)
+Program(GLuint pname, bool take_ownership,
+        const reference_counted_ptr<GLContextWorker> &worker)
 {
-  m_d = FASTUIDRAWnew ProgramPrivate(pname, take_ownership, this);
+  m_d = FASTUIDRAWnew ProgramPrivate(pname, take_ownership, worker, this);
 }
 
 fastuidraw::gl::Program::
@@ -2540,7 +3073,14 @@ fastuidraw::gl::Program::
   d = static_cast<ProgramPrivate*>(m_d);
   if (d->m_name && d->m_delete_program)
     {
-      glDeleteProgram(d->m_name);
+      if (d->m_worker)
+        {
+          d->m_worker->delete_program(d->m_name);
+        }
+      else
+        {
+          glDeleteProgram(d->m_name);
+        }
     }
   FASTUIDRAWdelete(d);
   m_d = nullptr;
@@ -2590,6 +3130,16 @@ program_build_time(void)
   return d->m_assemble_time;
 }
 
+bool
+fastuidraw::gl::Program::
+program_from_binary(void)
+{
+  ProgramPrivate *d;
+  d = static_cast<ProgramPrivate*>(m_d);
+  d->assemble();
+  return d->m_from_binary;
+}
+
 bool
 fastuidraw::gl::Program::
 link_success(void)
@@ -20,6 +20,7 @@
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/glyph_atlas_gl.hpp>
 #include <fastuidraw/gl_backend/gl_get.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 #include "private/texture_gl.hpp"
 #include "private/buffer_object_gl.hpp"
@@ -32,7 +33,8 @@ namespace
   class TexelStoreGL:public fastuidraw::GlyphAtlasTexelBackingStoreBase
   {
   public:
-    TexelStoreGL(fastuidraw::ivec3 dims, bool delayed);
+    TexelStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                 fastuidraw::ivec3 dims, bool delayed);
 
     ~TexelStoreGL(void);
 
@@ -51,7 +53,8 @@ namespace
 
     static
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasTexelBackingStoreBase>
-    create(fastuidraw::ivec3 dims, bool delayed);
+    create(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+           fastuidraw::ivec3 dims, bool delayed);
 
   protected:
 
@@ -65,6 +68,7 @@ namespace
                                               GL_R8UI, GL_RED_INTEGER,
                                               GL_UNSIGNED_BYTE,
                                               GL_NEAREST, GL_NEAREST> TextureGL;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
     TextureGL m_backing_store;
     mutable GLuint m_texture_as_r8;
   };
@@ -96,8 +100,10 @@ namespace
   class GeometryStoreGL_Buffer:public GeometryStoreGL
   {
   public:
-    explicit
-    GeometryStoreGL_Buffer(unsigned int number_vecNs, bool delayed, unsigned int N);
+    GeometryStoreGL_Buffer(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                           unsigned int number_vecNs, bool delayed, unsigned int N);
+
+    ~GeometryStoreGL_Buffer();
 
     virtual
     void
@@ -121,6 +127,7 @@ namespace
   private:
 
     typedef fastuidraw::gl::detail::BufferGL<GL_TEXTURE_BUFFER, GL_STATIC_DRAW> BufferGL;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
     BufferGL m_backing_store;
     mutable GLuint m_texture;
     mutable bool m_tbo_dirty;
@@ -129,8 +136,9 @@ namespace
   class GeometryStoreGL_Texture:public GeometryStoreGL
   {
   public:
-    explicit
-    GeometryStoreGL_Texture(fastuidraw::ivec2 log2_wh, unsigned int number_vecNs, bool delayed, unsigned int N);
+    GeometryStoreGL_Texture(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                            fastuidraw::ivec2 log2_wh, unsigned int number_vecNs,
+                            bool delayed, unsigned int N);
 
     virtual
     void
@@ -180,7 +188,8 @@ namespace
       m_delayed(false),
       m_alignment(4),
       m_type(fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_tbo),
-      m_log2_dims_geometry_store(-1, -1)
+      m_log2_dims_geometry_store(-1, -1),
+      m_worker(FASTUIDRAWnew fastuidraw::gl::GLContextWorker())
     {}
 
     fastuidraw::ivec3 m_texel_store_dimensions;
@@ -189,6 +198,7 @@ namespace
     unsigned int m_alignment;
     enum fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_backing_t m_type;
     fastuidraw::ivec2 m_log2_dims_geometry_store;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
   };
 
   class GlyphAtlasGLPrivate
@@ -208,9 +218,11 @@ namespace
 /////////////////////////////////////////
 // TexelStoreGL methods
 TexelStoreGL::
-TexelStoreGL(fastuidraw::ivec3 dims, bool delayed):
+TexelStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+             fastuidraw::ivec3 dims, bool delayed):
   fastuidraw::GlyphAtlasTexelBackingStoreBase(dims, true),
-  m_backing_store(dims, delayed),
+  m_worker(worker),
+  m_backing_store(worker, dims, delayed),
   m_texture_as_r8(0)
 {
   /* clear the right and bottom border
@@ -232,10 +244,7 @@ TexelStoreGL(fastuidraw::ivec3 dims, bool delayed):
 TexelStoreGL::
 ~TexelStoreGL(void)
 {
-  if (m_texture_as_r8 != 0)
-    {
-      glDeleteTextures(1, &m_texture_as_r8);
-    }
+  m_worker->delete_texture(m_texture_as_r8);
 }
 
 void
@@ -340,21 +349,24 @@ texture(bool as_integer) const
 
 fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasTexelBackingStoreBase>
 TexelStoreGL::
-create(fastuidraw::ivec3 dims, bool delayed)
+create(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+       fastuidraw::ivec3 dims, bool delayed)
 {
   TexelStoreGL *p;
-  p = FASTUIDRAWnew TexelStoreGL(dims, delayed);
+  p = FASTUIDRAWnew TexelStoreGL(worker, dims, delayed);
   return fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasTexelBackingStoreBase>(p);
 }
 
 ///////////////////////////////////////////////
 // GeometryStoreGL_Texture methods
 GeometryStoreGL_Texture::
-GeometryStoreGL_Texture(fastuidraw::ivec2 log2_wh, unsigned int number_texels, bool delayed, unsigned int N):
+GeometryStoreGL_Texture(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                        fastuidraw::ivec2 log2_wh, unsigned int number_texels,
+                        bool delayed, unsigned int N):
   GeometryStoreGL(number_texels, N, GL_TEXTURE_2D_ARRAY, log2_wh),
   m_layer_dims(1 << log2_wh.x(), 1 << log2_wh.y()),
   m_texels_per_layer(m_layer_dims.x() * m_layer_dims.y()),
-  m_backing_store(internal_format(N), external_format(N), GL_FLOAT,
+  m_backing_store(worker, internal_format(N), external_format(N), GL_FLOAT,
                   GL_NEAREST, GL_NEAREST,
                   texture_size(m_layer_dims, number_texels), delayed)
 {
@@ -484,16 +496,24 @@ set_values(unsigned int location,
 ///////////////////////////////////////////////
 // GeometryStoreGL_Buffer methods
 GeometryStoreGL_Buffer::
-GeometryStoreGL_Buffer(unsigned int number_vecNs, bool delayed, unsigned int N):
+GeometryStoreGL_Buffer(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                       unsigned int number_vecNs, bool delayed, unsigned int N):
   GeometryStoreGL(number_vecNs, N, GL_TEXTURE_BUFFER,
                   fastuidraw::ivec2(-1, -1)),
-  m_backing_store(number_vecNs * N * sizeof(float), delayed),
+  m_worker(worker),
+  m_backing_store(worker, number_vecNs * N * sizeof(float), delayed),
   m_texture(0),
   m_tbo_dirty(true)
 {
   FASTUIDRAWassert(N <= 4 && N > 0);
 }
 
+GeometryStoreGL_Buffer::
+~GeometryStoreGL_Buffer()
+{
+  m_worker->delete_texture(m_texture);
+}
+
 void
 GeometryStoreGL_Buffer::
 set_values(unsigned int location,
@@ -574,11 +594,11 @@ create(const fastuidraw::gl::GlyphAtlasGL::params &P)
   switch(P.glyph_geometry_backing_store_type())
     {
     case fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_tbo:
-      p = FASTUIDRAWnew GeometryStoreGL_Buffer(number_vecNs, delayed, N);
+      p = FASTUIDRAWnew GeometryStoreGL_Buffer(P.worker(), number_vecNs, delayed, N);
       break;
 
     case fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_texture_array:
-      p = FASTUIDRAWnew GeometryStoreGL_Texture(P.texture_2d_array_geometry_store_log2_dims(),
+      p = FASTUIDRAWnew GeometryStoreGL_Texture(P.worker(), P.texture_2d_array_geometry_store_log2_dims(),
                                                 number_vecNs, delayed, N);
       break;
 
@@ -717,14 +737,18 @@ setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
 setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
                  GlyphAtlasGLParamsPrivate,
                  unsigned int, alignment);
+setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
+                 GlyphAtlasGLParamsPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker>&, worker);
 
 //////////////////////////////////////////////////////////////////
 // fastuidraw::gl::GlyphAtlasGL methods
 fastuidraw::gl::GlyphAtlasGL::
 GlyphAtlasGL(const params &P):
-  GlyphAtlas(TexelStoreGL::create(P.texel_store_dimensions(), P.delayed()),
+  GlyphAtlas(TexelStoreGL::create(P.worker(), P.texel_store_dimensions(), P.delayed()),
              GeometryStoreGL::create(P))
 {
+  FASTUIDRAWassert(P.worker());
   m_d = FASTUIDRAWnew GlyphAtlasGLPrivate(P);
 }
 
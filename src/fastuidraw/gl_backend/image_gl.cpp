@@ -21,6 +21,7 @@
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/gl_get.hpp>
 #include <fastuidraw/gl_backend/image_gl.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 #include "private/texture_gl.hpp"
 #include "private/bindless.hpp"
 #include "../private/util_private.hpp"
@@ -45,7 +46,9 @@ namespace
   class ColorBackingStoreGL:public fastuidraw::AtlasColorBackingStoreBase
   {
   public:
-    ColorBackingStoreGL(int log2_tile_size, int log2_num_tiles_per_row_per_col, int number_layers, bool delayed);
+    ColorBackingStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                        int log2_tile_size, int log2_num_tiles_per_row_per_col,
+                        int number_layers, bool delayed);
     ~ColorBackingStoreGL() {}
 
     virtual
@@ -76,10 +79,12 @@ namespace
 
     static
     fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase>
-    create(int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layers, bool delayed)
+    create(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+           int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layers, bool delayed)
     {
       ColorBackingStoreGL *p;
-      p = FASTUIDRAWnew ColorBackingStoreGL(log2_tile_size, log2_num_tiles_per_row_per_col, num_layers, delayed);
+      p = FASTUIDRAWnew ColorBackingStoreGL(worker, log2_tile_size, log2_num_tiles_per_row_per_col,
+                                           num_layers, delayed);
       return fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase>(p);
     }
 
@@ -102,7 +107,8 @@ namespace
   class IndexBackingStoreGL:public fastuidraw::AtlasIndexBackingStoreBase
   {
   public:
-    IndexBackingStoreGL(int log2_tile_size,
+    IndexBackingStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                        int log2_tile_size,
                         int log2_num_index_tiles_per_row_per_col,
                         int num_layers,
                         bool delayed);
@@ -146,12 +152,13 @@ namespace
 
     static
     fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase>
-    create(int log2_tile_size,
+    create(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+           int log2_tile_size,
            int log2_num_index_tiles_per_row_per_col,
            int num_layers, bool delayed)
     {
       IndexBackingStoreGL *p;
-      p = FASTUIDRAWnew IndexBackingStoreGL(log2_tile_size,
+      p = FASTUIDRAWnew IndexBackingStoreGL(worker, log2_tile_size,
                                            log2_num_index_tiles_per_row_per_col,
                                            num_layers, delayed);
       return fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase>(p);
@@ -184,11 +191,34 @@ namespace
   class ImageGLBindless:public fastuidraw::Image
   {
   public:
-    ImageGLBindless(int w, int h, unsigned int m, GLuint tex, GLuint64 handle);
+    ImageGLBindless(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                    int w, int h, unsigned int m, GLuint tex, GLuint64 handle);
     ~ImageGLBindless();
 
+  private:
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
+    GLuint m_texture;
+  };
+
+  /* makes the handle of a bindless texture non-resident
+   * and deletes the texture, done with a GL context
+   * current by the GLContextWorker.
+   */
+  class ReleaseBindlessTexture:public fastuidraw::gl::GLContextWorker::Action
+  {
+  public:
+    ReleaseBindlessTexture(GLuint tex, GLuint64 handle):
+      m_texture(tex),
+      m_handle(handle)
+    {}
+
+    virtual
+    void
+    execute(void);
+
   private:
     GLuint m_texture;
+    GLuint64 m_handle;
   };
 
   class ImageAtlasGLParamsPrivate
@@ -201,7 +231,8 @@ namespace
       m_log2_index_tile_size(2),
       m_log2_num_index_tiles_per_row_per_col(6),
       m_num_index_layers(4),
-      m_delayed(false)
+      m_delayed(false),
+      m_worker(FASTUIDRAWnew fastuidraw::gl::GLContextWorker())
     {}
 
     int m_log2_color_tile_size;
@@ -211,6 +242,7 @@ namespace
     int m_log2_num_index_tiles_per_row_per_col;
     int m_num_index_layers;
     bool m_delayed;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
   };
 
   class ImageAtlasGLPrivate
@@ -228,13 +260,14 @@ namespace
 ////////////////////////////////////////////
 // ColorBackingStoreGL methods
 ColorBackingStoreGL::
-ColorBackingStoreGL(int log2_tile_size,
+ColorBackingStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                    int log2_tile_size,
                     int log2_num_tiles_per_row_per_col,
                     int number_layers,
                     bool delayed):
   fastuidraw::AtlasColorBackingStoreBase(store_size(log2_tile_size, log2_num_tiles_per_row_per_col, number_layers),
                                          true),
-  m_backing_store(dimensions(), delayed, log2_tile_size),
+  m_backing_store(worker, dimensions(), delayed, log2_tile_size),
   m_number_mipmap_levels(log2_tile_size)
 {}
 
@@ -313,13 +346,14 @@ store_size(int log2_tile_size, int log2_num_tiles_per_row_per_col, int num_layer
 //////////////////////////////////////////
 // IndexBackingStoreGL methods
 IndexBackingStoreGL::
-IndexBackingStoreGL(int log2_tile_size,
+IndexBackingStoreGL(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                    int log2_tile_size,
                     int log2_num_index_tiles_per_row_per_col,
                     int num_layers,
                     bool delayed):
   fastuidraw::AtlasIndexBackingStoreBase(store_size(log2_tile_size, log2_num_index_tiles_per_row_per_col, num_layers),
                                         true),
-  m_backing_store(dimensions(), delayed)
+  m_backing_store(worker, dimensions(), delayed)
 {}
 
 void
@@ -384,9 +418,11 @@ store_size(int log2_tile_size, int log2_num_index_tiles_per_row_per_col, int num
 ////////////////////////////////////////////
 // ImageGLBindless methods
 ImageGLBindless::
-ImageGLBindless(int w, int h, unsigned int m,
+ImageGLBindless(const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> &worker,
+                int w, int h, unsigned int m,
                 GLuint tex, GLuint64 handle):
   fastuidraw::Image(w, h, m, fastuidraw::Image::bindless_texture2d, handle),
+  m_worker(worker),
   m_texture(tex)
 {
 }
@@ -397,7 +433,16 @@ ImageGLBindless::
   using namespace fastuidraw;
   using namespace gl;
 
-  detail::bindless().make_texture_handle_non_resident(bindless_handle());
+  m_worker->add_action(FASTUIDRAWnew ReleaseBindlessTexture(m_texture, bindless_handle()));
+}
+
+////////////////////////////////////////////
+// ReleaseBindlessTexture methods
+void
+ReleaseBindlessTexture::
+execute(void)
+{
+  fastuidraw::gl::detail::bindless().make_texture_handle_non_resident(m_handle);
   glDeleteTextures(1, &m_texture);
 }
 
@@ -459,6 +504,9 @@ setget_implement(fastuidraw::gl::ImageAtlasGL::params,
 setget_implement(fastuidraw::gl::ImageAtlasGL::params,
                  ImageAtlasGLParamsPrivate,
                  bool, delayed)
+setget_implement(fastuidraw::gl::ImageAtlasGL::params,
+                 ImageAtlasGLParamsPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker>&, worker)
 
 //////////////////////////////////////////////
 // fastuidraw::gl::ImageAtlasGL methods
@@ -466,12 +514,14 @@ fastuidraw::gl::ImageAtlasGL::
 ImageAtlasGL(const params &P):
   fastuidraw::ImageAtlas(1 << P.log2_color_tile_size(), //color tile size
                         1 << P.log2_index_tile_size(), //index tile size
-                        ColorBackingStoreGL::create(P.log2_color_tile_size(), P.log2_num_color_tiles_per_row_per_col(),
+                        ColorBackingStoreGL::create(P.worker(),
+                                                    P.log2_color_tile_size(), P.log2_num_color_tiles_per_row_per_col(),
                                                     P.num_color_layers(), P.delayed()),
-                        IndexBackingStoreGL::create(P.log2_index_tile_size(),
+                        IndexBackingStoreGL::create(P.worker(), P.log2_index_tile_size(),
                                                     P.log2_num_index_tiles_per_row_per_col(),
                                                     P.num_index_layers(), P.delayed()))
 {
+  FASTUIDRAWassert(P.worker());
   m_d = FASTUIDRAWnew ImageAtlasGLPrivate(P);
 }
 
@@ -518,7 +568,7 @@ index_texture(void) const
 fastuidraw::reference_counted_ptr<fastuidraw::Image>
 fastuidraw::gl::ImageAtlasGL::
 create_bindless(int pw, int ph, unsigned int m, const ImageSourceBase &image,
-                GLenum min_filter, GLenum mag_filter, GLuint *tex)
+                GLenum min_filter, GLenum mag_filter, GLuint *tex) const
 {
   GLuint texture;
   GLuint64 handle;
@@ -558,5 +608,5 @@ create_bindless(int pw, int ph, unsigned int m, const ImageSourceBase &image,
       *tex = texture;
     }
 
-  return FASTUIDRAWnew ImageGLBindless(pw, ph, m, texture, handle);
+  return FASTUIDRAWnew ImageGLBindless(param_values().worker(), pw, ph, m, texture, handle);
 }
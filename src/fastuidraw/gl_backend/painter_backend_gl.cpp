@@ -19,6 +19,7 @@
 
 #include <list>
 #include <map>
+#include <algorithm>
 #include <sstream>
 #include <vector>
 #include <iostream>
@@ -29,6 +30,7 @@
 #include <fastuidraw/gl_backend/opengl_trait.hpp>
 #include <fastuidraw/gl_backend/gl_get.hpp>
 #include <fastuidraw/gl_backend/gl_context_properties.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 #include <fastuidraw/gl_backend/gluniform.hpp>
 
 #include "../private/util_private.hpp"
@@ -231,16 +233,33 @@ namespace
   public:
     painter_vao(void):
       m_vao(0),
+      m_compact_vao(0),
       m_attribute_bo(0),
       m_header_bo(0),
       m_index_bo(0),
       m_data_bo(0),
-      m_data_tbo(0)
+      m_compact_attribute_bo(0),
+      m_data_tbo(0),
+      m_attribute_mapped(nullptr),
+      m_header_mapped(nullptr),
+      m_index_mapped(nullptr),
+      m_data_mapped(nullptr),
+      m_compact_attribute_mapped(nullptr)
     {}
 
-    GLuint m_vao;
+    /* m_compact_vao sources the attributes from m_compact_attribute_bo
+     * and shares m_index_bo with m_vao; it and m_compact_attribute_bo
+     * are 0 unless ConfigurationGL::use_compact_attributes() is true.
+     */
+    GLuint m_vao, m_compact_vao;
     GLuint m_attribute_bo, m_header_bo, m_index_bo, m_data_bo;
+    GLuint m_compact_attribute_bo;
     GLuint m_data_tbo;
+
+    /* non-null only when the buffers are persistently mapped */
+    void *m_attribute_mapped, *m_header_mapped, *m_index_mapped, *m_data_mapped;
+    void *m_compact_attribute_mapped;
+
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     unsigned int m_data_store_binding_point;
   };
@@ -280,6 +299,12 @@ namespace
       return m_data_buffer_size;
     }
 
+    unsigned int
+    compact_attribute_buffer_size(void) const
+    {
+      return m_compact_attribute_buffer_size;
+    }
+
     painter_vao
     request_vao(void);
 
@@ -293,23 +318,43 @@ namespace
     void
     generate_tbos(painter_vao &vao);
 
+    void
+    generate_compact_vao(painter_vao &vao);
+
     GLuint
     generate_tbo(GLuint src_buffer, GLenum fmt, unsigned int unit);
 
     GLuint
     generate_bo(GLenum bind_target, GLsizei psize);
 
+    GLuint
+    generate_mapped_bo(GLenum bind_target, GLsizei psize, void **mapped);
+
+    void
+    wait_pool_fence(void);
+
     unsigned int m_attribute_buffer_size, m_header_buffer_size;
     unsigned int m_index_buffer_size;
+
+    /* 0 if compact attributes are not used */
+    unsigned int m_compact_attribute_buffer_size;
     int m_alignment, m_blocks_per_data_buffer;
     unsigned int m_data_buffer_size;
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     enum fastuidraw::gl::detail::tex_buffer_support_t m_tex_buffer_support;
     fastuidraw::glsl::PainterBackendGLSL::BindingPoints m_binding_points;
+    bool m_persistent_mapped;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
 
     unsigned int m_current, m_pool;
     std::vector<std::vector<painter_vao> > m_vaos;
     std::vector<GLuint> m_ubos;
+
+    /* fence placed by next_pool() when the pool is finished, only
+     * used when the buffers are persistently mapped; the pool is
+     * not written to again until the fence signals.
+     */
+    std::vector<GLsync> m_fences;
   };
 
   bool
@@ -394,6 +439,9 @@ namespace
     void
     configure_backend(void);
 
+    void
+    execute_workers(void);
+
     void
     configure_source_front_matter(void);
 
@@ -437,9 +485,10 @@ namespace
   {
   public:
     explicit
-    DrawState(fastuidraw::gl::Program *pr):
+    DrawState(fastuidraw::gl::Program *pr, GLuint vao):
       m_current_program(pr),
-      m_current_blend_mode(nullptr)
+      m_current_blend_mode(nullptr),
+      m_current_vao(vao)
     {}
 
     void
@@ -449,6 +498,7 @@ namespace
 
     fastuidraw::gl::Program *m_current_program;
     const fastuidraw::BlendMode *m_current_blend_mode;
+    GLuint m_current_vao;
 
   private:
     static
@@ -472,19 +522,42 @@ namespace
     DrawEntry(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> &action);
 
     void
-    add_entry(GLsizei count, const void *offset);
+    add_entry(GLsizei count, const void *offset, bool index_16bit, bool compact);
 
     void
     draw(PainterBackendGLPrivate *pr, const painter_vao &vao,
          DrawState &st) const;
 
   private:
+    /* a run of elements of a glMultiDrawElements call that
+     * all have the same index type and are sourced from
+     * the same VAO.
+     */
+    class MultiDraw
+    {
+    public:
+      MultiDraw(GLenum index_type, bool compact):
+        m_index_type(index_type),
+        m_compact(compact)
+      {}
+
+      void
+      draw(PainterBackendGLPrivate *pr) const;
+
+      GLenum m_index_type;
+      bool m_compact;
+      std::vector<GLsizei> m_counts;
+      std::vector<const GLvoid*> m_indices;
+    };
+
     bool m_set_blend;
     fastuidraw::BlendMode m_blend_mode;
     fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> m_action;
 
-    std::vector<GLsizei> m_counts;
-    std::vector<const GLvoid*> m_indices;
+    /* drawn in order, a new run is started each time
+     * the index type or the attribute format changes.
+     */
+    std::vector<MultiDraw> m_draws;
     fastuidraw::gl::Program *m_new_program;
   };
 
@@ -511,6 +584,14 @@ namespace
     draw_break(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> &action,
                unsigned int indices_written) const;
 
+    virtual
+    void
+    index_width_break(unsigned int indices_written) const;
+
+    virtual
+    void
+    attribute_format_break(bool compact, unsigned int indices_written) const;
+
     virtual
     void
     draw(void) const;
@@ -520,17 +601,39 @@ namespace
     virtual
     void
     unmap_implement(unsigned int attributes_written,
+                    unsigned int compact_attributes_written,
                     unsigned int indices_written,
                     unsigned int data_store_written) const;
 
   private:
 
+    void
+    set_arrays(painter_vao_pool *hnd,
+               const fastuidraw::gl::PainterBackendGL::ConfigurationGL &params,
+               void *attr_bo, void *index_bo, void *data_bo, void *header_bo,
+               void *compact_attr_bo);
+
     void
     add_entry(unsigned int indices_written) const;
 
+    unsigned int
+    index_byte_offset(unsigned int index) const;
+
     PainterBackendGLPrivate *m_pr;
     painter_vao m_vao;
     mutable unsigned int m_attributes_written, m_indices_written;
+
+    /* once m_wide_indices is true, the first m_indices_16bit_written
+     * indices are 16-bit and the rest are PainterIndex values
+     * starting at the first 4-byte boundary after them.
+     */
+    mutable bool m_wide_indices;
+    mutable unsigned int m_indices_16bit_written;
+
+    /* true if the indices added by the next add_entry()
+     * index into m_compact_attributes
+     */
+    mutable bool m_compact;
     mutable std::list<DrawEntry> m_draws;
   };
 
@@ -609,6 +712,12 @@ namespace
     fastuidraw::vec4 m_clear_color;
     fastuidraw::gl::PainterBackendGL::SurfaceGL::Properties m_properties;
 
+    /* GLContextWorker of the PainterBackendGL that first
+     * drew to the surface, the GL objects of the surface
+     * are deleted through it.
+     */
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
+
   private:
     enum buffer_t
       {
@@ -636,6 +745,9 @@ namespace
       m_data_blocks_per_store_buffer(1024 * 64),
       m_data_store_backing(fastuidraw::gl::PainterBackendGL::data_store_tbo),
       m_number_pools(3),
+      m_use_persistent_mapped_buffers(false),
+      m_use_16bit_indices(false),
+      m_use_compact_attributes(false),
       m_break_on_shader_change(false),
       m_use_hw_clip_planes(true),
       /* on Mesa/i965 using switch statement gives much slower
@@ -659,10 +771,15 @@ namespace
     unsigned int m_data_blocks_per_store_buffer;
     enum fastuidraw::gl::PainterBackendGL::data_store_backing_t m_data_store_backing;
     unsigned int m_number_pools;
+    bool m_use_persistent_mapped_buffers;
+    bool m_use_16bit_indices;
+    bool m_use_compact_attributes;
     bool m_break_on_shader_change;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::ImageAtlasGL> m_image_atlas;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::ColorStopAtlasGL> m_colorstop_atlas;
     fastuidraw::reference_counted_ptr<fastuidraw::gl::GlyphAtlasGL> m_glyph_atlas;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::ProgramBinaryCache> m_program_binary_cache;
+    fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker> m_worker;
     bool m_use_hw_clip_planes;
     bool m_vert_shader_use_switch;
     bool m_frag_shader_use_switch;
@@ -689,41 +806,49 @@ painter_vao_pool(const fastuidraw::gl::PainterBackendGL::ConfigurationGL &params
   m_attribute_buffer_size(params.attributes_per_buffer() * sizeof(fastuidraw::PainterAttribute)),
   m_header_buffer_size(params.attributes_per_buffer() * sizeof(uint32_t)),
   m_index_buffer_size(params.indices_per_buffer() * sizeof(fastuidraw::PainterIndex)),
+  m_compact_attribute_buffer_size(params.use_compact_attributes() ?
+                                  params.attributes_per_buffer() * sizeof(fastuidraw::PainterCompactAttribute) :
+                                  0u),
   m_alignment(params_base.alignment()),
   m_blocks_per_data_buffer(params.data_blocks_per_store_buffer()),
   m_data_buffer_size(m_blocks_per_data_buffer * m_alignment * sizeof(fastuidraw::generic_data)),
   m_data_store_backing(params.data_store_backing()),
   m_tex_buffer_support(tex_buffer_support),
   m_binding_points(binding_points),
+  m_persistent_mapped(params.use_persistent_mapped_buffers()),
+  m_worker(params.worker()),
   m_current(0),
   m_pool(0),
   m_vaos(params.number_pools()),
-  m_ubos(params.number_pools(), 0)
+  m_ubos(params.number_pools(), 0),
+  m_fences(params.number_pools(), nullptr)
 {}
 
 painter_vao_pool::
 ~painter_vao_pool()
 {
+  /* the last reference to the PainterBackendGL may be
+   * released when no GL context is current, so the
+   * deletion of the GL objects is deferred.
+   */
+  fastuidraw::gl::GLContextWorker &worker(*m_worker);
+
   FASTUIDRAWassert(m_ubos.size() == m_vaos.size());
   for(unsigned int p = 0, endp = m_vaos.size(); p < endp; ++p)
     {
       for(const painter_vao &vao : m_vaos[p])
         {
-          if (vao.m_data_tbo != 0)
-            {
-              glDeleteTextures(1, &vao.m_data_tbo);
-            }
-          glDeleteBuffers(1, &vao.m_attribute_bo);
-          glDeleteBuffers(1, &vao.m_header_bo);
-          glDeleteBuffers(1, &vao.m_index_bo);
-          glDeleteBuffers(1, &vao.m_data_bo);
-          glDeleteVertexArrays(1, &vao.m_vao);
-        }
-
-      if (m_ubos[p] != 0)
-        {
-          glDeleteBuffers(1, &m_ubos[p]);
+          worker.delete_texture(vao.m_data_tbo);
+          worker.delete_buffer(vao.m_attribute_bo);
+          worker.delete_buffer(vao.m_header_bo);
+          worker.delete_buffer(vao.m_index_bo);
+          worker.delete_buffer(vao.m_data_bo);
+          worker.delete_buffer(vao.m_compact_attribute_bo);
+          worker.delete_vertex_array(vao.m_vao);
+          worker.delete_vertex_array(vao.m_compact_vao);
         }
+      worker.delete_buffer(m_ubos[p]);
+      worker.delete_sync(m_fences[p]);
     }
 }
 
@@ -757,6 +882,7 @@ request_vao(void)
 {
   painter_vao return_value;
 
+  wait_pool_fence();
   if (m_current == m_vaos[m_pool].size())
     {
       fastuidraw::gl::opengl_trait_value v;
@@ -773,7 +899,8 @@ request_vao(void)
         {
         case fastuidraw::gl::PainterBackendGL::data_store_tbo:
           {
-            m_vaos[m_pool][m_current].m_data_bo = generate_bo(GL_ARRAY_BUFFER, m_data_buffer_size);
+            m_vaos[m_pool][m_current].m_data_bo = generate_mapped_bo(GL_ARRAY_BUFFER, m_data_buffer_size,
+                                                                     &m_vaos[m_pool][m_current].m_data_mapped);
             m_vaos[m_pool][m_current].m_data_store_binding_point = m_binding_points.data_store_buffer_tbo();
             generate_tbos(m_vaos[m_pool][m_current]);
           }
@@ -781,17 +908,20 @@ request_vao(void)
 
         case fastuidraw::gl::PainterBackendGL::data_store_ubo:
           {
-            m_vaos[m_pool][m_current].m_data_bo = generate_bo(GL_ARRAY_BUFFER, m_data_buffer_size);
+            m_vaos[m_pool][m_current].m_data_bo = generate_mapped_bo(GL_ARRAY_BUFFER, m_data_buffer_size,
+                                                                     &m_vaos[m_pool][m_current].m_data_mapped);
             m_vaos[m_pool][m_current].m_data_store_binding_point = m_binding_points.data_store_buffer_ubo();
           }
           break;
         }
 
-      /* generate_bo leaves the returned buffer object bound to
-       * the passed binding target.
+      /* generate_mapped_bo leaves the returned buffer object bound
+       * to the passed binding target.
        */
-      m_vaos[m_pool][m_current].m_attribute_bo = generate_bo(GL_ARRAY_BUFFER, m_attribute_buffer_size);
-      m_vaos[m_pool][m_current].m_index_bo = generate_bo(GL_ELEMENT_ARRAY_BUFFER, m_index_buffer_size);
+      m_vaos[m_pool][m_current].m_attribute_bo = generate_mapped_bo(GL_ARRAY_BUFFER, m_attribute_buffer_size,
+                                                                    &m_vaos[m_pool][m_current].m_attribute_mapped);
+      m_vaos[m_pool][m_current].m_index_bo = generate_mapped_bo(GL_ELEMENT_ARRAY_BUFFER, m_index_buffer_size,
+                                                                &m_vaos[m_pool][m_current].m_index_mapped);
 
       glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::primary_attrib_slot);
       v = fastuidraw::gl::opengl_trait_values<fastuidraw::uvec4>(sizeof(fastuidraw::PainterAttribute),
@@ -808,11 +938,17 @@ request_vao(void)
                                                                  offsetof(fastuidraw::PainterAttribute, m_attrib2));
       fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::uint_attrib_slot, v);
 
-      m_vaos[m_pool][m_current].m_header_bo = generate_bo(GL_ARRAY_BUFFER, m_header_buffer_size);
+      m_vaos[m_pool][m_current].m_header_bo = generate_mapped_bo(GL_ARRAY_BUFFER, m_header_buffer_size,
+                                                                 &m_vaos[m_pool][m_current].m_header_mapped);
       glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot);
       v = fastuidraw::gl::opengl_trait_values<uint32_t>();
       fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot, v);
 
+      if (m_compact_attribute_buffer_size > 0)
+        {
+          generate_compact_vao(m_vaos[m_pool][m_current]);
+        }
+
       glBindVertexArray(0);
     }
 
@@ -826,6 +962,16 @@ void
 painter_vao_pool::
 next_pool(void)
 {
+  if (m_persistent_mapped && m_current > 0)
+    {
+      /* the commands reading from the buffers of the pool
+       * have all been issued; the fence signals once GL
+       * is done with them.
+       */
+      FASTUIDRAWassert(m_fences[m_pool] == nullptr);
+      m_fences[m_pool] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
   ++m_pool;
   if (m_pool == m_vaos.size())
     {
@@ -836,6 +982,51 @@ next_pool(void)
 }
 
 
+void
+painter_vao_pool::
+generate_compact_vao(painter_vao &vao)
+{
+  typedef fastuidraw::PainterCompactAttribute CompactAttribute;
+  fastuidraw::gl::opengl_trait_value v;
+
+  glGenVertexArrays(1, &vao.m_compact_vao);
+  FASTUIDRAWassert(vao.m_compact_vao != 0);
+  glBindVertexArray(vao.m_compact_vao);
+
+  /* the compact VAO shares the index buffer of the VAO */
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vao.m_index_bo);
+  vao.m_compact_attribute_bo = generate_mapped_bo(GL_ARRAY_BUFFER, m_compact_attribute_buffer_size,
+                                                  &vao.m_compact_attribute_mapped);
+
+  /* the positions, texels and layers are integers that
+   * the vertex shader reads as floats.
+   */
+  glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::compact_position_slot);
+  v = fastuidraw::gl::opengl_trait_values<fastuidraw::vecN<GLshort, 2> >(sizeof(CompactAttribute),
+                                                                         offsetof(CompactAttribute, m_position));
+  fastuidraw::gl::VertexAttribPointer(fastuidraw::glsl::PainterBackendGLSL::compact_position_slot, v);
+
+  glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::compact_texel_slot);
+  v = fastuidraw::gl::opengl_trait_values<fastuidraw::vecN<GLshort, 4> >(sizeof(CompactAttribute),
+                                                                         offsetof(CompactAttribute, m_texel));
+  fastuidraw::gl::VertexAttribPointer(fastuidraw::glsl::PainterBackendGLSL::compact_texel_slot, v);
+
+  glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::compact_layer_slot);
+  v = fastuidraw::gl::opengl_trait_values<fastuidraw::vecN<GLshort, 2> >(sizeof(CompactAttribute),
+                                                                         offsetof(CompactAttribute, m_layer));
+  fastuidraw::gl::VertexAttribPointer(fastuidraw::glsl::PainterBackendGLSL::compact_layer_slot, v);
+
+  glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::compact_data_slot);
+  v = fastuidraw::gl::opengl_trait_values<uint32_t>(sizeof(CompactAttribute),
+                                                    offsetof(CompactAttribute, m_data));
+  fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::compact_data_slot, v);
+
+  glEnableVertexAttribArray(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot);
+  v = fastuidraw::gl::opengl_trait_values<uint32_t>(sizeof(CompactAttribute),
+                                                    offsetof(CompactAttribute, m_header));
+  fastuidraw::gl::VertexAttribIPointer(fastuidraw::glsl::PainterBackendGLSL::header_attrib_slot, v);
+}
+
 void
 painter_vao_pool::
 generate_tbos(painter_vao &vao)
@@ -879,6 +1070,70 @@ generate_bo(GLenum bind_target, GLsizei psize)
   return return_value;
 }
 
+GLuint
+painter_vao_pool::
+generate_mapped_bo(GLenum bind_target, GLsizei psize, void **mapped)
+{
+  GLuint return_value;
+  GLbitfield flags;
+
+  if (!m_persistent_mapped)
+    {
+      *mapped = nullptr;
+      return generate_bo(bind_target, psize);
+    }
+
+  return_value = 0;
+  glGenBuffers(1, &return_value);
+  FASTUIDRAWassert(return_value != 0);
+  glBindBuffer(bind_target, return_value);
+
+  #ifdef FASTUIDRAW_GL_USE_GLES
+    {
+      flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+      glBufferStorageEXT(bind_target, psize, nullptr, flags);
+    }
+  #else
+    {
+      flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      glBufferStorage(bind_target, psize, nullptr, flags);
+    }
+  #endif
+
+  /* the mapping stays valid until the buffer is deleted */
+  *mapped = glMapBufferRange(bind_target, 0, psize, flags);
+  FASTUIDRAWassert(*mapped != nullptr);
+
+  return return_value;
+}
+
+void
+painter_vao_pool::
+wait_pool_fence(void)
+{
+  /* the GL implementation may clamp the timeout passed
+   * to glClientWaitSync(), so wait in a loop.
+   */
+  const GLuint64 timeout_ns(1000u * 1000u);
+  GLsync &fence(m_fences[m_pool]);
+  GLenum status;
+
+  if (fence == nullptr)
+    {
+      return;
+    }
+
+  do
+    {
+      status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout_ns);
+    }
+  while (status == GL_TIMEOUT_EXPIRED);
+
+  FASTUIDRAWassert(status != GL_WAIT_FAILED);
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
 ////////////////////////////////////////////
 // DrawState methods
 void
@@ -1030,10 +1285,22 @@ DrawEntry(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw:
 
 void
 DrawEntry::
-add_entry(GLsizei count, const void *offset)
+add_entry(GLsizei count, const void *offset, bool index_16bit, bool compact)
 {
-  m_counts.push_back(count);
-  m_indices.push_back(offset);
+  GLenum index_type;
+
+  index_type = (index_16bit) ?
+    GL_UNSIGNED_SHORT :
+    fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type;
+
+  if (m_draws.empty()
+      || m_draws.back().m_index_type != index_type
+      || m_draws.back().m_compact != compact)
+    {
+      m_draws.push_back(MultiDraw(index_type, compact));
+    }
+  m_draws.back().m_counts.push_back(count);
+  m_draws.back().m_indices.push_back(offset);
 }
 
 void
@@ -1053,7 +1320,7 @@ draw(PainterBackendGLPrivate *pr, const painter_vao &vao,
        */
       glBindVertexArray(0);
       flags |= m_action->execute(nullptr);
-      glBindVertexArray(vao.m_vao);
+      glBindVertexArray(st.m_current_vao);
     }
 
   if (m_set_blend)
@@ -1069,7 +1336,26 @@ draw(PainterBackendGLPrivate *pr, const painter_vao &vao,
     }
 
   st.restore_gl_state(vao, pr, flags);
+  for(const MultiDraw &M : m_draws)
+    {
+      GLuint v;
 
+      v = (M.m_compact) ? vao.m_compact_vao : vao.m_vao;
+      FASTUIDRAWassert(v != 0);
+      if (v != st.m_current_vao)
+        {
+          glBindVertexArray(v);
+          st.m_current_vao = v;
+        }
+      M.draw(pr);
+    }
+}
+
+void
+DrawEntry::MultiDraw::
+draw(PainterBackendGLPrivate *pr) const
+{
+  FASTUIDRAWunused(pr);
   if (m_counts.empty())
     {
       return;
@@ -1079,24 +1365,21 @@ draw(PainterBackendGLPrivate *pr, const painter_vao &vao,
 
   #ifndef FASTUIDRAW_GL_USE_GLES
     {
-      glMultiDrawElements(GL_TRIANGLES, &m_counts[0],
-                          fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
+      glMultiDrawElements(GL_TRIANGLES, &m_counts[0], m_index_type,
                           &m_indices[0], m_counts.size());
     }
   #else
     {
       if (pr->m_has_multi_draw_elements)
         {
-          glMultiDrawElementsEXT(GL_TRIANGLES, &m_counts[0],
-                                 fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
+          glMultiDrawElementsEXT(GL_TRIANGLES, &m_counts[0], m_index_type,
                                  &m_indices[0], m_counts.size());
         }
       else
         {
           for(unsigned int i = 0, endi = m_counts.size(); i < endi; ++i)
             {
-              glDrawElements(GL_TRIANGLES, m_counts[i],
-                             fastuidraw::gl::opengl_trait<fastuidraw::PainterIndex>::type,
+              glDrawElements(GL_TRIANGLES, m_counts[i], m_index_type,
                              m_indices[i]);
             }
         }
@@ -1113,14 +1396,28 @@ DrawCommand(painter_vao_pool *hnd,
   m_pr(pr),
   m_vao(hnd->request_vao()),
   m_attributes_written(0),
-  m_indices_written(0)
+  m_indices_written(0),
+  m_wide_indices(!params.use_16bit_indices()),
+  m_indices_16bit_written(0),
+  m_compact(false)
 {
   /* map the buffers and set to the c_array<> fields of
    * fastuidraw::PainterDraw to the mapping location.
    */
-  void *attr_bo, *index_bo, *data_bo, *header_bo;
+  void *attr_bo, *index_bo, *data_bo, *header_bo, *compact_attr_bo(nullptr);
   uint32_t flags;
 
+  if (m_vao.m_attribute_mapped)
+    {
+      /* the buffers are persistently mapped and painter_vao_pool
+       * has already waited for GL to finish reading from them.
+       */
+      set_arrays(hnd, params, m_vao.m_attribute_mapped, m_vao.m_index_mapped,
+                 m_vao.m_data_mapped, m_vao.m_header_mapped,
+                 m_vao.m_compact_attribute_mapped);
+      return;
+    }
+
   flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_FLUSH_EXPLICIT_BIT;
 
   glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
@@ -1139,18 +1436,45 @@ DrawCommand(painter_vao_pool *hnd,
   data_bo = glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->data_buffer_size(), flags);
   FASTUIDRAWassert(data_bo != nullptr);
 
+  if (m_vao.m_compact_attribute_bo != 0)
+    {
+      glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_compact_attribute_bo);
+      compact_attr_bo = glMapBufferRange(GL_ARRAY_BUFFER, 0, hnd->compact_attribute_buffer_size(), flags);
+      FASTUIDRAWassert(compact_attr_bo != nullptr);
+    }
+
+  set_arrays(hnd, params, attr_bo, index_bo, data_bo, header_bo, compact_attr_bo);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void
+DrawCommand::
+set_arrays(painter_vao_pool *hnd,
+           const fastuidraw::gl::PainterBackendGL::ConfigurationGL &params,
+           void *attr_bo, void *index_bo, void *data_bo, void *header_bo,
+           void *compact_attr_bo)
+{
   m_attributes = fastuidraw::c_array<fastuidraw::PainterAttribute>(static_cast<fastuidraw::PainterAttribute*>(attr_bo),
                                                                  params.attributes_per_buffer());
   m_indices = fastuidraw::c_array<fastuidraw::PainterIndex>(static_cast<fastuidraw::PainterIndex*>(index_bo),
                                                           params.indices_per_buffer());
+  if (params.use_16bit_indices())
+    {
+      m_indices_16bit = fastuidraw::c_array<uint16_t>(static_cast<uint16_t*>(index_bo),
+                                                      2 * params.indices_per_buffer());
+    }
   m_store = fastuidraw::c_array<fastuidraw::generic_data>(static_cast<fastuidraw::generic_data*>(data_bo),
                                                           hnd->data_buffer_size() / sizeof(fastuidraw::generic_data));
 
   m_header_attributes = fastuidraw::c_array<uint32_t>(static_cast<uint32_t*>(header_bo),
                                                      params.attributes_per_buffer());
-
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  if (compact_attr_bo)
+    {
+      m_compact_attributes = fastuidraw::c_array<fastuidraw::PainterCompactAttribute>(static_cast<fastuidraw::PainterCompactAttribute*>(compact_attr_bo),
+                                                                                     params.attributes_per_buffer());
+    }
 }
 
 void
@@ -1214,6 +1538,25 @@ draw_break(const fastuidraw::PainterShaderGroup &old_shaders,
     }
 }
 
+void
+DrawCommand::
+index_width_break(unsigned int indices_written) const
+{
+  FASTUIDRAWassert(!m_wide_indices);
+  add_entry(indices_written);
+  m_wide_indices = true;
+  m_indices_16bit_written = indices_written;
+}
+
+void
+DrawCommand::
+attribute_format_break(bool compact, unsigned int indices_written) const
+{
+  FASTUIDRAWassert(compact != m_compact);
+  add_entry(indices_written);
+  m_compact = compact;
+}
+
 void
 DrawCommand::
 draw(void) const
@@ -1245,7 +1588,7 @@ draw(void) const
     PainterBackendGL::program_without_discard :
     PainterBackendGL::program_all;
 
-  DrawState st(m_pr->m_programs[choice].get());
+  DrawState st(m_pr->m_programs[choice].get(), m_vao.m_vao);
   st.m_current_program->use_program();
 
   for(const DrawEntry &entry : m_draws)
@@ -1258,6 +1601,7 @@ draw(void) const
 void
 DrawCommand::
 unmap_implement(unsigned int attributes_written,
+                unsigned int compact_attributes_written,
                 unsigned int indices_written,
                 unsigned int data_store_written) const
 {
@@ -1265,6 +1609,14 @@ unmap_implement(unsigned int attributes_written,
   add_entry(indices_written);
   FASTUIDRAWassert(m_indices_written == indices_written);
 
+  if (m_vao.m_attribute_mapped)
+    {
+      /* writes to a coherent mapping are visible to the
+       * GL commands issued after them, nothing to flush.
+       */
+      return;
+    }
+
   glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_attribute_bo);
   glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, attributes_written * sizeof(fastuidraw::PainterAttribute));
   glUnmapBuffer(GL_ARRAY_BUFFER);
@@ -1274,12 +1626,34 @@ unmap_implement(unsigned int attributes_written,
   glUnmapBuffer(GL_ARRAY_BUFFER);
 
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vao.m_index_bo);
-  glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indices_written * sizeof(fastuidraw::PainterIndex));
+  glFlushMappedBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, index_byte_offset(indices_written));
   glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
 
   glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_data_bo);
   glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, data_store_written * sizeof(fastuidraw::generic_data));
   glUnmapBuffer(GL_ARRAY_BUFFER);
+
+  if (m_vao.m_compact_attribute_bo != 0)
+    {
+      glBindBuffer(GL_ARRAY_BUFFER, m_vao.m_compact_attribute_bo);
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0,
+                               compact_attributes_written * sizeof(fastuidraw::PainterCompactAttribute));
+      glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+}
+
+unsigned int
+DrawCommand::
+index_byte_offset(unsigned int index) const
+{
+  if (!m_wide_indices)
+    {
+      return index * sizeof(uint16_t);
+    }
+
+  FASTUIDRAWassert(index >= m_indices_16bit_written);
+  return ((m_indices_16bit_written + 1u) / 2u + index - m_indices_16bit_written)
+    * sizeof(fastuidraw::PainterIndex);
 }
 
 void
@@ -1287,7 +1661,7 @@ DrawCommand::
 add_entry(unsigned int indices_written) const
 {
   unsigned int count;
-  const fastuidraw::PainterIndex *offset(nullptr);
+  const uint8_t *offset(nullptr);
 
   if (m_draws.empty())
     {
@@ -1295,8 +1669,8 @@ add_entry(unsigned int indices_written) const
     }
   FASTUIDRAWassert(indices_written >= m_indices_written);
   count = indices_written - m_indices_written;
-  offset += m_indices_written;
-  m_draws.back().add_entry(count, offset);
+  offset += index_byte_offset(m_indices_written);
+  m_draws.back().add_entry(count, offset, !m_wide_indices, m_compact);
   m_indices_written = indices_written;
 }
 
@@ -1324,9 +1698,34 @@ SurfaceGLPrivate::
     {
       m_buffers[buffer_color] = 0;
     }
-  glDeleteTextures(m_auxiliary_buffer.size(), m_auxiliary_buffer.c_ptr());
-  glDeleteFramebuffers(m_fbo.size(), m_fbo.c_ptr());
-  glDeleteTextures(m_buffers.size(), m_buffers.c_ptr());
+
+  if (!m_worker)
+    {
+      /* never drawn to by a PainterBackendGL, any GL objects
+       * were made by the application calling SurfaceGL::texture()
+       * which requires a GL context current.
+       */
+      glDeleteFramebuffers(m_fbo.size(), m_fbo.c_ptr());
+      glDeleteTextures(m_auxiliary_buffer.size(), m_auxiliary_buffer.c_ptr());
+      glDeleteTextures(m_buffers.size(), m_buffers.c_ptr());
+      return;
+    }
+
+  /* the surface may be released when no GL context
+   * is current, so the deletion is deferred.
+   */
+  for(GLuint tex : m_auxiliary_buffer)
+    {
+      m_worker->delete_texture(tex);
+    }
+  for(GLuint fbo : m_fbo)
+    {
+      m_worker->delete_framebuffer(fbo);
+    }
+  for(GLuint tex : m_buffers)
+    {
+      m_worker->delete_texture(tex);
+    }
 }
 
 fastuidraw::gl::PainterBackendGL::SurfaceGL*
@@ -1473,20 +1872,41 @@ PainterBackendGLPrivate(const fastuidraw::gl::PainterBackendGL::ConfigurationGL
   m_surface_gl(nullptr),
   m_p(p)
 {
+  if (!m_params.worker())
+    {
+      m_params.worker(FASTUIDRAWnew fastuidraw::gl::GLContextWorker());
+    }
   configure_backend();
 }
 
 PainterBackendGLPrivate::
 ~PainterBackendGLPrivate()
 {
-  if (m_nearest_filter_sampler != 0)
+  m_params.worker()->delete_sampler(m_nearest_filter_sampler);
+  if (m_pool)
     {
-      glDeleteSamplers(1, &m_nearest_filter_sampler);
+      FASTUIDRAWdelete(m_pool);
     }
+}
 
-  if (m_pool)
+void
+PainterBackendGLPrivate::
+execute_workers(void)
+{
+  /* the atlases may have been given the GLContextWorker
+   * of the PainterBackendGL, only run each once.
+   */
+  fastuidraw::vecN<fastuidraw::gl::GLContextWorker*, 4> workers(m_params.worker().get(),
+                                                               m_params.glyph_atlas()->param_values().worker().get(),
+                                                               m_params.image_atlas()->param_values().worker().get(),
+                                                               m_params.colorstop_atlas()->param_values().worker().get());
+
+  for(auto iter = workers.begin(); iter != workers.end(); ++iter)
     {
-      FASTUIDRAWdelete(m_pool);
+      if (std::find(workers.begin(), iter, *iter) == iter)
+        {
+          (*iter)->execute_actions();
+        }
     }
 }
 
@@ -1670,10 +2090,15 @@ configure_backend(void)
   #ifdef FASTUIDRAW_GL_USE_GLES
     {
       m_has_multi_draw_elements = m_ctx_properties.has_extension("GL_EXT_multi_draw_arrays");
+      m_params.use_persistent_mapped_buffers(m_params.use_persistent_mapped_buffers()
+                                             && m_ctx_properties.has_extension("GL_EXT_buffer_storage"));
     }
   #else
     {
       m_has_multi_draw_elements = true;
+      m_params.use_persistent_mapped_buffers(m_params.use_persistent_mapped_buffers()
+                                             && (m_ctx_properties.version() >= fastuidraw::ivec2(4, 4)
+                                                 || m_ctx_properties.has_extension("GL_ARB_buffer_storage")));
     }
   #endif
 
@@ -1749,6 +2174,7 @@ configure_backend(void)
     .frag_shader_use_switch(m_params.frag_shader_use_switch())
     .blend_shader_use_switch(m_params.blend_shader_use_switch())
     .unpack_header_and_brush_in_frag_shader(m_params.unpack_header_and_brush_in_frag_shader())
+    .compact_attributes(m_params.use_compact_attributes())
     .data_store_backing(m_params.data_store_backing())
     .data_blocks_per_store_buffer(m_params.data_blocks_per_store_buffer())
     .glyph_geometry_backing(m_params.glyph_atlas()->param_values().glyph_geometry_backing_store_type())
@@ -1805,7 +2231,20 @@ configure_source_front_matter(void)
         }
     }
 
-  if (!m_uber_shader_builder_params.assign_layout_to_vertex_shader_inputs())
+  if (!m_uber_shader_builder_params.assign_layout_to_vertex_shader_inputs()
+      && m_uber_shader_builder_params.compact_attributes())
+    {
+      m_attribute_binder
+        .add_binding("fastuidraw_primary_attribute_in", PainterBackendGLSL::primary_attrib_slot)
+        .add_binding("fastuidraw_secondary_attribute_in", PainterBackendGLSL::secondary_attrib_slot)
+        .add_binding("fastuidraw_uint_attribute_in", PainterBackendGLSL::uint_attrib_slot)
+        .add_binding("fastuidraw_header_attribute_in", PainterBackendGLSL::header_attrib_slot)
+        .add_binding("fastuidraw_compact_position", PainterBackendGLSL::compact_position_slot)
+        .add_binding("fastuidraw_compact_texel", PainterBackendGLSL::compact_texel_slot)
+        .add_binding("fastuidraw_compact_layer", PainterBackendGLSL::compact_layer_slot)
+        .add_binding("fastuidraw_compact_data", PainterBackendGLSL::compact_data_slot);
+    }
+  else if (!m_uber_shader_builder_params.assign_layout_to_vertex_shader_inputs())
     {
       m_attribute_binder
         .add_binding("fastuidraw_primary_attribute", PainterBackendGLSL::primary_attrib_slot)
@@ -2051,7 +2490,9 @@ build_program(enum fastuidraw::gl::PainterBackendGL::program_type_t tp)
   m_p->construct_shader(vert, frag, m_uber_shader_builder_params, &item_filter, discard_macro);
   return_value = FASTUIDRAWnew fastuidraw::gl::Program(vert, frag,
                                                        m_attribute_binder,
-                                                       m_initializer);
+                                                       m_initializer,
+                                                       m_params.program_binary_cache(),
+                                                       m_params.worker());
   return return_value;
 }
 
@@ -2397,6 +2838,12 @@ setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, Configuratio
                  unsigned int, data_blocks_per_store_buffer)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
                  unsigned int, number_pools)
+setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
+                 bool, use_persistent_mapped_buffers)
+setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
+                 bool, use_16bit_indices)
+setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
+                 bool, use_compact_attributes)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
                  bool, break_on_shader_change)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
@@ -2405,6 +2852,10 @@ setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, Configuratio
                  const fastuidraw::reference_counted_ptr<fastuidraw::gl::ColorStopAtlasGL>&, colorstop_atlas)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
                  const fastuidraw::reference_counted_ptr<fastuidraw::gl::GlyphAtlasGL>&, glyph_atlas)
+setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::gl::ProgramBinaryCache>&, program_binary_cache)
+setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::gl::GLContextWorker>&, worker)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
                  bool, use_hw_clip_planes)
 setget_implement(fastuidraw::gl::PainterBackendGL::ConfigurationGL, ConfigurationGLPrivate,
@@ -2534,6 +2985,15 @@ on_pre_draw(const reference_counted_ptr<Surface> &surface,
 
   d = static_cast<PainterBackendGLPrivate*>(m_d);
   d->m_surface_gl = static_cast<SurfaceGLPrivate*>(SurfaceGLPrivate::surface_gl(surface)->m_d);
+  if (!d->m_surface_gl->m_worker)
+    {
+      d->m_surface_gl->m_worker = d->m_params.worker();
+    }
+
+  /* the GL context is current, run the GL work that was
+   * queued by objects released since the last draw.
+   */
+  d->execute_workers();
 
   if (d->m_nearest_filter_sampler == 0)
     {
@@ -2618,6 +3078,12 @@ on_post_draw(void)
   glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
   glDisable(GL_SCISSOR_TEST);
   d->m_pool->next_pool();
+
+  /* objects released while drawing, for example by
+   * PainterPacker releasing its references at the end
+   * of a frame, are deleted now.
+   */
+  d->execute_workers();
 }
 
 fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw>
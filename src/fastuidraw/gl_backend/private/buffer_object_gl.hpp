@@ -21,6 +21,7 @@
 
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/gl_get.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 namespace fastuidraw { namespace gl { namespace detail {
 
@@ -44,7 +45,9 @@ template<GLenum binding_point,
 class BufferGL
 {
 public:
-  BufferGL(GLsizei psize, bool delayed):
+  BufferGL(const reference_counted_ptr<GLContextWorker> &worker,
+           GLsizei psize, bool delayed):
+    m_worker(worker),
     m_size(psize),
     m_buffer_size(psize),
     m_delayed(delayed),
@@ -59,19 +62,11 @@ public:
 
   ~BufferGL()
   {
-    if (m_buffer != 0)
-      {
-        delete_buffer();
-      }
-  }
-
-  void
-  delete_buffer(void)
-  {
-    FASTUIDRAWassert(m_buffer != 0);
-    glBindBuffer(binding_point, 0);
-    glDeleteBuffers(1, &m_buffer);
-    m_buffer = 0;
+    /* the dtor can be called when no GL context
+     * is current, so the deletion is deferred
+     */
+    FASTUIDRAWassert(m_worker);
+    m_worker->delete_buffer(m_buffer);
   }
 
   void
@@ -206,6 +201,7 @@ private:
     glBufferData(binding_point, m_size, nullptr, usage);
   }
 
+  reference_counted_ptr<GLContextWorker> m_worker;
   GLsizei m_size;
   GLsizei m_buffer_size;
   bool m_delayed;
@@ -26,6 +26,7 @@
 #include <fastuidraw/util/c_array.hpp>
 #include <fastuidraw/gl_backend/ngl_header.hpp>
 #include <fastuidraw/gl_backend/gl_context_properties.hpp>
+#include <fastuidraw/gl_backend/gl_context_worker.hpp>
 
 namespace fastuidraw { namespace gl { namespace detail {
 
@@ -368,7 +369,8 @@ public:
   typedef EntryLocationN<N> EntryLocation;
   typedef vecN<int, N> DimensionType;
 
-  TextureGLGeneric(GLenum internal_format,
+  TextureGLGeneric(const reference_counted_ptr<GLContextWorker> &worker,
+                   GLenum internal_format,
                    GLenum external_format,
                    GLenum external_type,
                    GLenum mag_filter,
@@ -377,9 +379,6 @@ public:
                    unsigned int mipmap_levels = 1);
   ~TextureGLGeneric();
 
-  void
-  delete_texture(void);
-
   GLuint
   texture(void) const;
 
@@ -418,6 +417,7 @@ private:
   void
   flush_size_change(void);
 
+  reference_counted_ptr<GLContextWorker> m_worker;
   GLenum m_internal_format;
   GLenum m_external_format;
   GLenum m_external_type;
@@ -443,13 +443,15 @@ private:
 //TextureGLGeneric methods
 template<GLenum texture_target>
 TextureGLGeneric<texture_target>::
-TextureGLGeneric(GLenum internal_format,
+TextureGLGeneric(const reference_counted_ptr<GLContextWorker> &worker,
+                 GLenum internal_format,
                  GLenum external_format,
                  GLenum external_type,
                  GLenum mag_filter,
                  GLenum min_filter,
                  vecN<int, N> dims, bool delayed,
                  unsigned int mipmap_levels):
+  m_worker(worker),
   m_internal_format(internal_format),
   m_external_format(external_format),
   m_external_type(external_type),
@@ -472,10 +474,11 @@ template<GLenum texture_target>
 TextureGLGeneric<texture_target>::
 ~TextureGLGeneric()
 {
-  if (m_texture != 0)
-    {
-      delete_texture();
-    }
+  /* the dtor can be called when no GL context
+   * is current, so the deletion is deferred
+   */
+  FASTUIDRAWassert(m_worker);
+  m_worker->delete_texture(m_texture);
 }
 
 template<GLenum texture_target>
@@ -543,16 +546,6 @@ flush_size_change(void)
     }
 }
 
-template<GLenum texture_target>
-void
-TextureGLGeneric<texture_target>::
-delete_texture(void)
-{
-  FASTUIDRAWassert(m_texture != 0);
-  glDeleteTextures(1, &m_texture);
-  m_texture = 0;
-}
-
 
 template<GLenum texture_target>
 GLuint
@@ -688,9 +681,10 @@ template<GLenum texture_target,
 class TextureGL:public TextureGLGeneric<texture_target>
 {
 public:
-  TextureGL(typename TextureGLGeneric<texture_target>::DimensionType dims, bool delayed,
+  TextureGL(const reference_counted_ptr<GLContextWorker> &worker,
+            typename TextureGLGeneric<texture_target>::DimensionType dims, bool delayed,
             unsigned int num_mip_map_levels = 1):
-    TextureGLGeneric<texture_target>(internal_format, external_format,
+    TextureGLGeneric<texture_target>(worker, internal_format, external_format,
                                      external_type, mag_filter, min_filter,
                                      dims, delayed, num_mip_map_levels)
   {}
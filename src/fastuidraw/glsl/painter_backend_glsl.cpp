@@ -116,6 +116,7 @@ namespace
       m_frag_shader_use_switch(false),
       m_blend_shader_use_switch(false),
       m_unpack_header_and_brush_in_frag_shader(false),
+      m_compact_attributes(false),
       m_data_store_backing(fastuidraw::glsl::PainterBackendGLSL::data_store_tbo),
       m_data_blocks_per_store_buffer(-1),
       m_glyph_geometry_backing(fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_tbo),
@@ -136,6 +137,7 @@ namespace
     bool m_frag_shader_use_switch;
     bool m_blend_shader_use_switch;
     bool m_unpack_header_and_brush_in_frag_shader;
+    bool m_compact_attributes;
     enum fastuidraw::glsl::PainterBackendGLSL::data_store_backing_t m_data_store_backing;
     int m_data_blocks_per_store_buffer;
     enum fastuidraw::glsl::PainterBackendGLSL::glyph_geometry_backing_t m_glyph_geometry_backing;
@@ -793,7 +795,41 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
       item_shaders = make_c_array(m_item_shaders);
     }
 
-  if (params.assign_layout_to_vertex_shader_inputs())
+  if (params.compact_attributes())
+    {
+      /* the inputs are unpacked by fastuidraw_unpack_compact_attributes()
+       * into globals with the names the uber-shader reads.
+       */
+      std::ostringstream ostr;
+      if (params.assign_layout_to_vertex_shader_inputs())
+        {
+          ostr << "layout(location = " << PainterBackendGLSL::primary_attrib_slot << ") in uvec4 fastuidraw_primary_attribute_in;\n"
+               << "layout(location = " << PainterBackendGLSL::secondary_attrib_slot << ") in uvec4 fastuidraw_secondary_attribute_in;\n"
+               << "layout(location = " << PainterBackendGLSL::uint_attrib_slot << ") in uvec4 fastuidraw_uint_attribute_in;\n"
+               << "layout(location = " << PainterBackendGLSL::header_attrib_slot << ") in uint fastuidraw_header_attribute_in;\n"
+               << "layout(location = " << PainterBackendGLSL::compact_position_slot << ") in vec2 fastuidraw_compact_position;\n"
+               << "layout(location = " << PainterBackendGLSL::compact_texel_slot << ") in vec4 fastuidraw_compact_texel;\n"
+               << "layout(location = " << PainterBackendGLSL::compact_layer_slot << ") in vec2 fastuidraw_compact_layer;\n"
+               << "layout(location = " << PainterBackendGLSL::compact_data_slot << ") in uint fastuidraw_compact_data;\n";
+        }
+      else
+        {
+          ostr << "in uvec4 fastuidraw_primary_attribute_in;\n"
+               << "in uvec4 fastuidraw_secondary_attribute_in;\n"
+               << "in uvec4 fastuidraw_uint_attribute_in;\n"
+               << "in uint fastuidraw_header_attribute_in;\n"
+               << "in vec2 fastuidraw_compact_position;\n"
+               << "in vec4 fastuidraw_compact_texel;\n"
+               << "in vec2 fastuidraw_compact_layer;\n"
+               << "in uint fastuidraw_compact_data;\n";
+        }
+      ostr << "uvec4 fastuidraw_primary_attribute;\n"
+           << "uvec4 fastuidraw_secondary_attribute;\n"
+           << "uvec4 fastuidraw_uint_attribute;\n"
+           << "uint fastuidraw_header_attribute;\n";
+      declare_vertex_shader_ins = ostr.str();
+    }
+  else if (params.assign_layout_to_vertex_shader_inputs())
     {
       std::ostringstream ostr;
       ostr << "layout(location = " << PainterBackendGLSL::primary_attrib_slot << ") in uvec4 fastuidraw_primary_attribute;\n"
@@ -878,6 +914,18 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
       frag.add_macro("FASTUIDRAW_PAINTER_UNPACK_AT_FRAGMENT_SHADER");
     }
 
+  if (params.compact_attributes())
+    {
+      vert
+        .add_macro("FASTUIDRAW_PAINTER_COMPACT_ATTRIBUTES")
+        .add_macro("FASTUIDRAW_COMPACT_BIT", uint32_t(PainterCompactAttribute::compact_bit))
+        .add_macro("FASTUIDRAW_COMPACT_GLYPH_LAYOUT_BIT", uint32_t(PainterCompactAttribute::glyph_layout_bit))
+        .add_macro("FASTUIDRAW_COMPACT_HEADER_LOCATION_NUM_BITS",
+                   uint32_t(PainterCompactAttribute::number_header_location_bits))
+        .add_macro("FASTUIDRAW_COMPACT_POSITION_FRACTION_BITS",
+                   uint32_t(PainterCompactAttribute::position_fraction_bits));
+    }
+
   if (params.negate_normalized_y_coordinate())
     {
       vert.add_macro("FASTUIDRAW_PAINTER_NEGATE_POSITION_Y_COORDINATE");
@@ -1061,6 +1109,7 @@ construct_shader(fastuidraw::glsl::ShaderSource &vert,
     .add_source("fastuidraw_painter_brush_unpack_forward_declares.glsl.resource_string", ShaderSource::from_resource)
     .add_source("fastuidraw_painter_brush_unpack.glsl.resource_string", ShaderSource::from_resource)
     .add_source("fastuidraw_painter_brush.vert.glsl.resource_string", ShaderSource::from_resource)
+    .add_source("fastuidraw_painter_compact_attributes.vert.glsl.resource_string", ShaderSource::from_resource)
     .add_source("fastuidraw_painter_main.vert.glsl.resource_string", ShaderSource::from_resource)
     .add_source(m_vert_shader_utils);
 
@@ -1283,6 +1332,8 @@ setget_implement(fastuidraw::glsl::PainterBackendGLSL::UberShaderParams,
                  UberShaderParamsPrivate, bool, blend_shader_use_switch)
 setget_implement(fastuidraw::glsl::PainterBackendGLSL::UberShaderParams,
                  UberShaderParamsPrivate, bool, unpack_header_and_brush_in_frag_shader)
+setget_implement(fastuidraw::glsl::PainterBackendGLSL::UberShaderParams,
+                 UberShaderParamsPrivate, bool, compact_attributes)
 setget_implement(fastuidraw::glsl::PainterBackendGLSL::UberShaderParams,
                  UberShaderParamsPrivate, enum fastuidraw::glsl::PainterBackendGLSL::data_store_backing_t, data_store_backing)
 setget_implement(fastuidraw::glsl::PainterBackendGLSL::UberShaderParams,
@@ -473,6 +473,7 @@ create_glyph_item_shader(const std::string &vert_src,
                                                ShaderSource()
                                                .add_source(frag_src.c_str(), ShaderSource::from_resource),
                                                varyings);
+  shader->compact_layout(PainterCompactAttribute::glyph_layout);
   return shader;
 }
 
@@ -618,16 +619,20 @@ ShaderSetCreator::
 create_fill_shader(void)
 {
   PainterFillShader fill_shader;
+  reference_counted_ptr<PainterItemShader> item_shader;
+
+  item_shader = FASTUIDRAWnew PainterItemShaderGLSL(false,
+                                                    ShaderSource()
+                                                    .add_source("fastuidraw_painter_fill.vert.glsl.resource_string",
+                                                                ShaderSource::from_resource),
+                                                    ShaderSource()
+                                                    .add_source("fastuidraw_painter_fill.frag.glsl.resource_string",
+                                                                ShaderSource::from_resource),
+                                                    varying_list());
+  item_shader->compact_layout(PainterCompactAttribute::fill_layout);
 
   fill_shader
-    .item_shader(FASTUIDRAWnew PainterItemShaderGLSL(false,
-                                                     ShaderSource()
-                                                     .add_source("fastuidraw_painter_fill.vert.glsl.resource_string",
-                                                                 ShaderSource::from_resource),
-                                                     ShaderSource()
-                                                     .add_source("fastuidraw_painter_fill.frag.glsl.resource_string",
-                                                                 ShaderSource::from_resource),
-                                                     varying_list()))
+    .item_shader(item_shader)
     .aa_fuzz_shader(FASTUIDRAWnew PainterItemShaderGLSL(false,
                                                         ShaderSource()
                                                         .add_source("fastuidraw_painter_fill_aa_fuzz.vert.glsl.resource_string",
@@ -640,6 +645,68 @@ create_fill_shader(void)
   return fill_shader;
 }
 
+PainterRoundedRectShader
+ShaderSetCreator::
+create_rounded_rect_shader(void)
+{
+  /* the clip shader has two sub-shaders: the first emits
+   * the inside of the rounded rect, the second the outside.
+   */
+  enum
+    {
+      clip_inside_sub_shader = 0,
+      clip_outside_sub_shader,
+      number_clip_sub_shaders
+    };
+
+  PainterRoundedRectShader return_value;
+  reference_counted_ptr<PainterItemShader> clip_shader;
+  varying_list varyings;
+  ShaderSource vert, frag, clip_vert, clip_frag;
+
+  varyings
+    .add_float_varying("fastuidraw_rounded_rect_x")
+    .add_float_varying("fastuidraw_rounded_rect_y")
+    .add_float_varying("fastuidraw_rounded_rect_half_width", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_half_height", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_minx_miny_rx", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_minx_miny_ry", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_maxx_miny_rx", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_maxx_miny_ry", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_minx_maxy_rx", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_minx_maxy_ry", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_maxx_maxy_rx", varying_list::interpolation_flat)
+    .add_float_varying("fastuidraw_rounded_rect_maxx_maxy_ry", varying_list::interpolation_flat);
+
+  vert
+    .add_source("fastuidraw_painter_rounded_rect.vert.glsl.resource_string",
+                ShaderSource::from_resource);
+  frag
+    .add_source("fastuidraw_painter_rounded_rect.frag.glsl.resource_string",
+                ShaderSource::from_resource);
+
+  clip_vert
+    .add_macro("FASTUIDRAW_ROUNDED_RECT_CLIP")
+    .add_source("fastuidraw_painter_rounded_rect.vert.glsl.resource_string",
+                ShaderSource::from_resource)
+    .remove_macro("FASTUIDRAW_ROUNDED_RECT_CLIP");
+  clip_frag
+    .add_macro("FASTUIDRAW_ROUNDED_RECT_CLIP")
+    .add_macro("FASTUIDRAW_ROUNDED_RECT_CLIP_OUTSIDE", uint32_t(clip_outside_sub_shader))
+    .add_source("fastuidraw_painter_rounded_rect.frag.glsl.resource_string",
+                ShaderSource::from_resource)
+    .remove_macro("FASTUIDRAW_ROUNDED_RECT_CLIP_OUTSIDE")
+    .remove_macro("FASTUIDRAW_ROUNDED_RECT_CLIP");
+
+  clip_shader = FASTUIDRAWnew PainterItemShaderGLSL(true, clip_vert, clip_frag, varyings,
+                                                    number_clip_sub_shaders);
+  return_value
+    .item_shader(FASTUIDRAWnew PainterItemShaderGLSL(false, vert, frag, varyings))
+    .clip_inside_shader(FASTUIDRAWnew PainterItemShader(clip_inside_sub_shader, clip_shader))
+    .clip_outside_shader(FASTUIDRAWnew PainterItemShader(clip_outside_sub_shader, clip_shader));
+  return return_value;
+}
+
 PainterShaderSet
 ShaderSetCreator::
 create_shader_set(void)
@@ -656,6 +723,7 @@ create_shader_set(void)
     .stroke_shader(create_stroke_shader(number_cap_styles, se))
     .dashed_stroke_shader(create_dashed_stroke_shader_set())
     .fill_shader(create_fill_shader())
+    .rounded_rect_shader(create_rounded_rect_shader())
     .blend_shaders(create_blend_shaders());
   return return_value;
 }
@@ -139,6 +139,9 @@ private:
   PainterFillShader
   create_fill_shader(void);
 
+  PainterRoundedRectShader
+  create_rounded_rect_shader(void);
+
   enum PainterStrokeShader::type_t m_stroke_tp;
 
   reference_counted_ptr<PainterItemShaderGLSL> m_uber_stroke_shader, m_uber_dashed_stroke_shader;
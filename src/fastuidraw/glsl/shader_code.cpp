@@ -237,15 +237,6 @@ compute_interval(c_string function_name, unsigned int data_alignment)
   ShaderSource return_value;
   std::ostringstream ostr;
 
-  c_string xyzw = "xyzw";
-  c_string itypes[] =
-    {
-      "uint",
-      "uvec2",
-      "uvec3",
-      "uvec4"
-    };
-
   c_string ftypes[] =
     {
       "float",
@@ -262,33 +253,15 @@ compute_interval(c_string function_name, unsigned int data_alignment)
       "xyzw",
     };
 
-  c_string start_interval[] =
-    {
-      "lastd",
-      "fV.x",
-      "fV.y",
-      "fV.z",
-    };
-
-  c_string end_interval[] =
-    {
-      "fV.x",
-      "fV.y",
-      "fV.z",
-      "fV.w"
-    };
-
-  c_string return_signs[] =
-    {
-      "1.0",
-      "-1.0",
-      "1.0",
-      "-1.0"
-    };
-
   FASTUIDRAWassert(data_alignment >=1 && data_alignment <= 4);
 
-  /* This.. is awful.
+  /* The data is packed as an implicit search tree with
+   * data_alignment keys per node and (data_alignment + 1)
+   * children per node, see PainterDashedStrokeParams. Each
+   * iteration of the loop reads one node; the predecessor
+   * and successor of the distance are on the path from the
+   * root, the last ones found being the closest. The rank
+   * of the successor gives the interval.
    */
   ostr << "float\n" << function_name
        << "(in uint intervals_location, in float total_distance,\n"
@@ -297,65 +270,87 @@ compute_interval(c_string function_name, unsigned int data_alignment)
        << "\tout int interval_ID,\n"
        << "\tout float interval_begin, out float interval_end)\n"
        << "{\n"
-       << "\tint loc;\n"
-       << "\tfloat d, lastd, ff, fd;\n";
-
-  if (data_alignment == 1 || data_alignment == 3)
-    {
-      ostr << "\tfloat s = 1.0;\n";
-    }
-
-  ostr << "\n"
+       << "\tint k, num_nodes, succ_node, succ_slot;\n"
+       << "\tuint rank;\n"
+       << "\tfloat d, ff, fd, pred, succ;\n"
+       << "\n"
        << "\tfd = floor(in_distance / total_distance);\n"
        << "\tff = total_distance * fd;\n"
        << "\td = in_distance - ff;\n"
-       << "\tlastd = first_interval_start;\n"
-       << "\tloc = 0;\n"
+       << "\tpred = first_interval_start;\n"
+       << "\tsucc = 0.0;\n"
+       << "\tsucc_node = -1;\n"
+       << "\tsucc_slot = 0;\n"
+       << "\tnum_nodes = (int(number_intervals) + " << data_alignment - 1 << ") / " << data_alignment << ";\n"
        << "\tinterval_begin = 0.0;\n"
        << "\tinterval_end = 0.0;\n"
        << "\tinterval_ID = -1;\n"
-       << "\n\n"
-       << "\tdo\n"
+       << "\tk = 0;\n"
+       << "\n"
+       << "\twhile(k < num_nodes)\n"
        << "\t{\n"
-       << "\t\t" << itypes[data_alignment - 1] << " V;\n"
        << "\t\t" << ftypes[data_alignment - 1] << " fV;\n"
-       << "\t\tV = fastuidraw_fetch_data(loc + int(intervals_location))." << extract_swizzle[data_alignment - 1] << ";\n"
-       << "\t\tfV = uintBitsToFloat(V);\n";
-  for(unsigned int i = 0; i < data_alignment; ++i)
+       << "\t\tint c;\n"
+       << "\n"
+       << "\t\tfV = uintBitsToFloat(fastuidraw_fetch_data(k + int(intervals_location))."
+       << extract_swizzle[data_alignment - 1] << ");\n";
+
+  if (data_alignment == 1)
     {
-      ostr << "\t\t";
-      if (i != 0)
-        {
-          ostr << "else ";
-        }
-      ostr << "if (d < fV." << xyzw[i] << ")\n"
+      ostr << "\t\tc = int(step(fV, d));\n"
+           << "\t\tif (c > 0)\n"
            << "\t\t{\n"
-           << "\t\t\tinterval_begin = ff + " << start_interval[i] << ";\n"
-           << "\t\t\tinterval_end = ff + " << end_interval[i] << ";\n"
-           << "\t\t\tinterval_ID = int(" << data_alignment << ") * loc "
-           << "+ int(" << i << ") + int(fd) * int(number_intervals);\n";
-      if (data_alignment == 1 || data_alignment == 3)
-        {
-          ostr << "\t\t\treturn s * " << return_signs[i] << ";\n";
-        }
-      else
-        {
-          ostr << "\t\t\treturn " << return_signs[i] << ";\n";
-        }
-      ostr << "\t\t\tlastd = 2.0 * total_distance + 1.0;\n"
+           << "\t\t\tpred = fV;\n"
+           << "\t\t}\n"
+           << "\t\telse\n"
+           << "\t\t{\n"
+           << "\t\t\tsucc = fV;\n"
+           << "\t\t\tsucc_node = k;\n"
+           << "\t\t}\n";
+    }
+  else
+    {
+      ostr << "\t\tc = int(dot(step(fV, " << ftypes[data_alignment - 1] << "(d)), "
+           << ftypes[data_alignment - 1] << "(1.0)));\n"
+           << "\t\tif (c > 0)\n"
+           << "\t\t{\n"
+           << "\t\t\tpred = fV[c - 1];\n"
+           << "\t\t}\n"
+           << "\t\tif (c < " << data_alignment << ")\n"
+           << "\t\t{\n"
+           << "\t\t\tsucc = fV[c];\n"
+           << "\t\t\tsucc_node = k;\n"
+           << "\t\t\tsucc_slot = c;\n"
            << "\t\t}\n";
     }
-  ostr << "\t\tlastd = fV." << xyzw[data_alignment - 1] << ";\n"
-       << "\t\t++loc;\n";
 
-  if (data_alignment == 1 || data_alignment == 3)
+  ostr << "\t\tk = k * " << data_alignment + 1 << " + 1 + c;\n"
+       << "\t}\n"
+       << "\n"
+       << "\tif (succ_node == -1)\n"
+       << "\t{\n"
+       << "\t\treturn -1.0;\n"
+       << "\t}\n"
+       << "\n";
+
+  if (data_alignment == 1)
     {
-      ostr << "\t\ts *= -1.0;\n";
+      ostr << "\trank = fastuidraw_fetch_data(num_nodes + succ_node + int(intervals_location)).x;\n";
+    }
+  else
+    {
+      ostr << "\trank = fastuidraw_fetch_data(num_nodes + succ_node + int(intervals_location))[succ_slot];\n";
     }
 
-  ostr << "\t}\n"
-       << "\twhile(lastd < total_distance);\n"
-       << "\treturn -1.0;\n"
+  ostr << "\tif (rank >= number_intervals)\n"
+       << "\t{\n"
+       << "\t\treturn -1.0;\n"
+       << "\t}\n"
+       << "\n"
+       << "\tinterval_begin = ff + pred;\n"
+       << "\tinterval_end = ff + succ;\n"
+       << "\tinterval_ID = int(rank) + int(fd) * int(number_intervals);\n"
+       << "\treturn ((rank & 1u) == 0u) ? 1.0 : -1.0;\n"
        << "}";
 
   return_value
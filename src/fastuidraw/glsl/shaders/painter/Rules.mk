@@ -15,6 +15,7 @@ dir := $(d)/blend
 include $(dir)/Rules.mk
 
 FASTUIDRAW_RESOURCE_STRING += $(call filelist, fastuidraw_painter_main.vert.glsl.resource_string \
+	fastuidraw_painter_compact_attributes.vert.glsl.resource_string \
 	fastuidraw_painter_types.glsl.resource_string \
 	fastuidraw_painter_forward_declares.vert.glsl.resource_string \
 	fastuidraw_painter_uniforms.glsl.resource_string \
@@ -32,7 +33,9 @@ FASTUIDRAW_RESOURCE_STRING += $(call filelist, fastuidraw_painter_main.vert.glsl
 	fastuidraw_painter_fill.vert.glsl.resource_string \
 	fastuidraw_painter_fill.frag.glsl.resource_string \
 	fastuidraw_painter_fill_aa_fuzz.vert.glsl.resource_string \
-	fastuidraw_painter_fill_aa_fuzz.frag.glsl.resource_string)
+	fastuidraw_painter_fill_aa_fuzz.frag.glsl.resource_string \
+	fastuidraw_painter_rounded_rect.vert.glsl.resource_string \
+	fastuidraw_painter_rounded_rect.frag.glsl.resource_string)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
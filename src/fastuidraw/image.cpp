@@ -19,8 +19,17 @@
 
 #include <list>
 #include <map>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <fastuidraw/image.hpp>
 #include "private/array3d.hpp"
+#include "private/worker_pool.hpp"
 #include "private/util_private.hpp"
 
 
@@ -242,18 +251,232 @@ namespace
     #endif
   };
 
+  /* 128-bit hash of the texels of a color tile, used as the
+   * key to find a tile already in the atlas with the same
+   * texel data.
+   */
+  typedef fastuidraw::vecN<uint64_t, 2> tile_hash;
+
+  /* The texels of all mipmap levels of a color tile as fetched
+   * from an ImageSourceBase; the texels are fetched once so
+   * that they are hashed and then uploaded to the backing
+   * store from the same values. A color_tile_texels can be
+   * fetched into repeatedly, reusing its storage.
+   */
+  class color_tile_texels:public fastuidraw::ImageSourceBase
+  {
+  public:
+    color_tile_texels(void):
+      m_num_levels(0)
+    {}
+
+    color_tile_texels(fastuidraw::ivec2 src_xy, int tile_size,
+                      const fastuidraw::ImageSourceBase &image_data):
+      m_num_levels(0)
+    {
+      fetch(src_xy, tile_size, image_data);
+    }
+
+    void
+    fetch(fastuidraw::ivec2 src_xy, int tile_size,
+          const fastuidraw::ImageSourceBase &image_data);
+
+    virtual
+    bool
+    all_same_color(fastuidraw::ivec2 location, int square_size,
+                   fastuidraw::u8vec4 *dst) const;
+
+    virtual
+    unsigned int
+    num_mipmap_levels(void) const
+    {
+      return m_num_levels;
+    }
+
+    virtual
+    void
+    fetch_texels(unsigned int mipmap_level, fastuidraw::ivec2 location,
+                 unsigned int w, unsigned int h,
+                 fastuidraw::c_array<fastuidraw::u8vec4> dst) const;
+
+    fastuidraw::ivec2
+    location(unsigned int mipmap_level) const
+    {
+      return m_levels[mipmap_level].m_location;
+    }
+
+    const tile_hash&
+    hash(void) const
+    {
+      return m_hash;
+    }
+
+  private:
+    class per_level
+    {
+    public:
+      fastuidraw::ivec2 m_location;
+      int m_size;
+      std::vector<fastuidraw::u8vec4> m_texels;
+    };
+
+    /* only the first m_num_levels elements are used */
+    std::vector<per_level> m_levels;
+    unsigned int m_num_levels;
+    tile_hash m_hash;
+  };
+
+  /* A color tile of the atlas together with the number
+   * of times it was returned by an add_color_tile()
+   * call not yet matched by a delete_color_tile() call.
+   */
+  class shared_color_tile
+  {
+  public:
+    unsigned int m_reference_count;
+    bool m_is_constant_color;
+    fastuidraw::u8vec4 m_color;
+    tile_hash m_hash;
+  };
+
+  class ImagePrivate;
+
+  /* A color tile of a sparse Image that is resident
+   * on the atlas.
+   */
+  class sparse_tile
+  {
+  public:
+    ImagePrivate *m_image;
+    unsigned int m_tile;
+    uint64_t m_last_requested_frame;
+  };
+
+  typedef std::list<sparse_tile> sparse_tile_list;
+
+  typedef std::vector<std::pair<ImagePrivate*, unsigned int> > dirty_color_tiles;
+
+  /* A color tile of an Image created with Image::create_async()
+   * that is to be fetched or has been fetched.
+   */
+  class async_tile
+  {
+  public:
+    ImagePrivate *m_image;
+    unsigned int m_tile;
+    bool m_same_color;
+    fastuidraw::u8vec4 m_color;
+    color_tile_texels *m_texels;
+  };
+
+  /* Fetches, on the threads of a WorkerPool, the texels of
+   * the color tiles of Image objects created with
+   * Image::create_async() into staging color_tile_texels
+   * taken from a pool.
+   */
+  class AsyncUploadWorkers:fastuidraw::noncopyable
+  {
+  public:
+    AsyncUploadWorkers(int tile_size, unsigned int num_threads);
+
+    ~AsyncUploadWorkers();
+
+    /* queue all color tiles of an image to be fetched */
+    void
+    add(ImagePrivate *image, unsigned int num_tiles);
+
+    /* take a fetched tile; the tile is counted as in use
+     * until passed to release(). Returns false if there
+     * is no fetched tile.
+     */
+    bool
+    take_fetched(async_tile *dst);
+
+    void
+    release(const async_tile &T);
+
+    /* drop the tiles of an image, blocking until no tile
+     * of the image is being fetched or is in use.
+     */
+    void
+    cancel(ImagePrivate *image);
+
+  private:
+    void
+    fetch(ImagePrivate *image, unsigned int tile);
+
+    int m_tile_size;
+    std::mutex m_mutex;
+    std::condition_variable m_done_cv;
+    std::deque<async_tile> m_fetched;
+    std::vector<color_tile_texels*> m_staging_pool;
+
+    /* declared last so that its threads are
+     * joined before the above are destroyed.
+     */
+    fastuidraw::detail::WorkerPool m_pool;
+  };
+
   class ImageAtlasPrivate
   {
   public:
     ImageAtlasPrivate(int pcolor_tile_size, int pindex_tile_size,
                       fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase> pcolor_store,
-                      fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase> pindex_store):
-      m_color_store(pcolor_store),
-      m_color_tiles(pcolor_tile_size, pcolor_store->dimensions()),
-      m_index_store(pindex_store),
-      m_index_tiles(pindex_tile_size, pindex_store->dimensions()),
-      m_resizeable(m_color_store->resizeable() && m_index_store->resizeable())
-    {}
+                      fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase> pindex_store);
+
+    ~ImageAtlasPrivate();
+
+    /* add a constant color tile or a tile of the given texels,
+     * reusing a tile already on the atlas if possible; mutex
+     * must be locked.
+     */
+    fastuidraw::ivec3
+    add_color_tile(fastuidraw::u8vec4 color_data);
+
+    fastuidraw::ivec3
+    add_color_tile(const color_tile_texels &texels);
+
+    /* rewrite once each index tile holding one of the given color
+     * tiles; the elements of dirty are modified. The mutex must
+     * be locked.
+     */
+    void
+    update_index_tiles(dirty_color_tiles &dirty);
+
+    /* returns m_async_workers, creating it if necessary;
+     * mutex must be locked.
+     */
+    AsyncUploadWorkers*
+    async_workers(void);
+
+    /* increments the reference count of a tile already
+     * in the atlas and records the bytes saved.
+     */
+    fastuidraw::ivec3
+    reuse_color_tile(fastuidraw::ivec3 tile);
+
+    /* registers a newly allocated tile with a reference count of 1 */
+    void
+    add_shared_color_tile(fastuidraw::ivec3 tile, const shared_color_tile &v);
+
+    /* allocates a tile and sets its texels, mutex must be locked */
+    fastuidraw::ivec3
+    upload_color_tile(const color_tile_texels &texels);
+
+    /* makes room for one more sparse tile, returning false if
+     * there is no tile that can be evicted; mutex must be locked.
+     */
+    bool
+    make_room_for_sparse_tile(dirty_color_tiles &dirty);
+
+    /* evicts the least recently requested sparse tile;
+     * mutex must be locked.
+     */
+    void
+    evict_sparse_tile(dirty_color_tiles &dirty);
+
+    unsigned int
+    update_sparse_residency(unsigned int max_uploads);
 
     fastuidraw::mutex m_mutex;
 
@@ -264,32 +487,55 @@ namespace
     tile_allocator m_index_tiles;
 
     bool m_resizeable;
-  };
 
-  class per_color_tile
-  {
-  public:
-    per_color_tile(const fastuidraw::ivec3 t, bool b):
-      m_tile(t), m_non_repeat_color(b)
-    {}
+    /* number of bytes of texel data, across all mipmap
+     * levels, of a single color tile.
+     */
+    uint64_t m_color_tile_bytes;
 
-    operator fastuidraw::ivec3() const
-    {
-      return m_tile;
-    }
+    std::map<fastuidraw::ivec3, shared_color_tile> m_shared_color_tiles;
+    std::map<tile_hash, fastuidraw::ivec3> m_color_tiles_by_hash;
+    std::map<fastuidraw::u8vec4, fastuidraw::ivec3> m_color_tiles_by_color;
+    fastuidraw::vecN<uint64_t, fastuidraw::ImageAtlas::number_counters> m_counters;
+
+    /* resident tiles of sparse images, ordered from most
+     * recently requested to least recently requested.
+     */
+    sparse_tile_list m_sparse_tiles;
 
-    fastuidraw::ivec3 m_tile;
-    bool m_non_repeat_color;
+    /* tiles requested since the last update_sparse_residency() */
+    std::vector<std::pair<ImagePrivate*, unsigned int> > m_sparse_requests;
+    unsigned int m_sparse_tile_budget;
+    uint64_t m_sparse_frame;
+
+    /* created on the first Image::create_async() */
+    AsyncUploadWorkers *m_async_workers;
   };
 
   class ImagePrivate
   {
   public:
+    /* how the color tiles of an image whose color tiles are
+     * not all added at construction are made resident.
+     */
+    enum delayed_tiles_t
+      {
+        sparse_tiles,
+        async_tiles
+      };
+
     ImagePrivate(fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> patlas,
                  int w, int h,
                  const fastuidraw::ImageSourceBase &image_data,
                  unsigned int pslack);
 
+    ImagePrivate(fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> patlas,
+                 int w, int h,
+                 const fastuidraw::ImageSourceBase &image_data,
+                 unsigned int pslack,
+                 fastuidraw::u8vec4 fallback_color,
+                 enum delayed_tiles_t tp);
+
     ImagePrivate(int w, int h, unsigned int m, fastuidraw::Image::type_t t, uint64_t handle):
       m_dimensions(w, h),
       m_num_mipmap_levels(m),
@@ -300,6 +546,11 @@ namespace
       m_master_index_tile_dims(-1.0f, -1.0f),
       m_number_index_lookups(0),
       m_dimensions_index_divisor(-1.0f),
+      m_sparse_source(nullptr),
+      m_async_source(nullptr),
+      m_async_remaining(0),
+      m_async_in_flight(0),
+      m_ready(true),
       m_bindless_handle(handle)
     {}
 
@@ -308,6 +559,31 @@ namespace
     void
     create_color_tiles(const fastuidraw::ImageSourceBase &image_data);
 
+    void
+    compute_color_tile_layout(void);
+
+    /* location in the ImageSourceBase of the texels of a color tile */
+    fastuidraw::ivec2
+    color_tile_source_location(unsigned int tile) const;
+
+    /* request that a color tile of a sparse image be resident;
+     * the mutex of the atlas must be locked.
+     */
+    void
+    request_sparse_tile(ImageAtlasPrivate *atlas, int tx, int ty);
+
+    /* rewrite the index tile holding the given color tile;
+     * the mutex of the atlas must be locked.
+     */
+    void
+    update_index_tile(ImageAtlasPrivate *atlas, unsigned int tile);
+
+    /* remove the resident tiles and pending requests of a
+     * sparse image from the atlas.
+     */
+    void
+    release_sparse_tiles(ImageAtlasPrivate *atlas);
+
     void
     create_index_tiles(void);
 
@@ -326,14 +602,38 @@ namespace
     /* Data for when the image has type on_atlas */
     unsigned int m_slack;
     fastuidraw::ivec2 m_num_color_tiles;
-    std::map<fastuidraw::u8vec4, fastuidraw::ivec3> m_repeated_tiles;
-    std::vector<per_color_tile> m_color_tiles;
+    std::vector<fastuidraw::ivec3> m_color_tiles;
     std::list<std::vector<fastuidraw::ivec3> > m_index_tiles;
     fastuidraw::ivec3 m_master_index_tile;
     fastuidraw::vec2 m_master_index_tile_dims;
     unsigned int m_number_index_lookups;
     float m_dimensions_index_divisor;
 
+    /* Data for when the image is sparse, m_sparse_source is
+     * nullptr for images that are not sparse. For each color
+     * tile, if the tile is resident, the location of the tile
+     * in ImageAtlasPrivate::m_sparse_tiles.
+     */
+    const fastuidraw::ImageSourceBase *m_sparse_source;
+    std::vector<std::pair<bool, sparse_tile_list::iterator> > m_sparse_tiles;
+
+    /* Data for when the image was created with Image::create_async(),
+     * m_async_source is nullptr for other images. Until all color
+     * tiles have landed, m_ready is false. m_async_in_flight, the
+     * number of fetched tiles being placed on the atlas, is guarded
+     * by the mutex of the AsyncUploadWorkers.
+     */
+    const fastuidraw::ImageSourceBase *m_async_source;
+    std::vector<bool> m_async_landed;
+    unsigned int m_async_remaining;
+    unsigned int m_async_in_flight;
+    std::atomic<bool> m_ready;
+
+    /* tile used for the color tiles of a sparse or async image
+     * that are not on the atlas.
+     */
+    fastuidraw::ivec3 m_fallback_tile;
+
     /* data for when image has different type than on_atlas */
     uint64_t m_bindless_handle;
   };
@@ -351,6 +651,11 @@ ImagePrivate(fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> patlas,
   m_num_mipmap_levels(image_data.num_mipmap_levels()),
   m_type(fastuidraw::Image::on_atlas),
   m_slack(pslack),
+  m_sparse_source(nullptr),
+  m_async_source(nullptr),
+  m_async_remaining(0),
+  m_async_in_flight(0),
+  m_ready(true),
   m_bindless_handle(-1)
 {
   FASTUIDRAWassert(m_dimensions.x() > 0);
@@ -361,20 +666,83 @@ ImagePrivate(fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> patlas,
   create_index_tiles();
 }
 
+ImagePrivate::
+ImagePrivate(fastuidraw::reference_counted_ptr<fastuidraw::ImageAtlas> patlas,
+             int w, int h,
+             const fastuidraw::ImageSourceBase &image_data,
+             unsigned int pslack,
+             fastuidraw::u8vec4 fallback_color,
+             enum delayed_tiles_t tp):
+  m_atlas(patlas),
+  m_dimensions(w, h),
+  m_num_mipmap_levels(image_data.num_mipmap_levels()),
+  m_type(fastuidraw::Image::on_atlas),
+  m_slack(pslack),
+  m_sparse_source(tp == sparse_tiles ? &image_data : nullptr),
+  m_async_source(tp == async_tiles ? &image_data : nullptr),
+  m_async_remaining(0),
+  m_async_in_flight(0),
+  m_ready(tp != async_tiles),
+  m_bindless_handle(-1)
+{
+  unsigned int num_tiles;
+
+  FASTUIDRAWassert(m_dimensions.x() > 0);
+  FASTUIDRAWassert(m_dimensions.y() > 0);
+  FASTUIDRAWassert(m_atlas);
+
+  /* every color tile starts as the shared fallback tile until
+   * it is made resident by ImageAtlas::update_sparse_residency()
+   * or lands by ImageAtlas::process_async_uploads().
+   */
+  compute_color_tile_layout();
+  num_tiles = m_num_color_tiles.x() * m_num_color_tiles.y();
+  m_fallback_tile = m_atlas->add_color_tile(fallback_color);
+  m_color_tiles.resize(num_tiles, m_fallback_tile);
+  if (tp == sparse_tiles)
+    {
+      m_sparse_tiles.resize(num_tiles, std::make_pair(false, sparse_tile_list::iterator()));
+    }
+  else
+    {
+      m_async_landed.resize(num_tiles, false);
+      m_async_remaining = num_tiles;
+    }
+  create_index_tiles();
+}
+
 ImagePrivate::
 ~ImagePrivate()
 {
-  for(const per_color_tile &C : m_color_tiles)
+  if (m_sparse_source)
     {
-      if (C.m_non_repeat_color)
+      /* the resident tiles were already released by
+       * release_sparse_tiles(), leaving only the
+       * fallback tile.
+       */
+      m_atlas->delete_color_tile(m_fallback_tile);
+    }
+  else if (!m_ready)
+    {
+      /* the tiles of the image were removed from the
+       * AsyncUploadWorkers by Image::~Image(), so only
+       * those that landed are on the atlas.
+       */
+      for(unsigned int t = 0, endt = m_color_tiles.size(); t < endt; ++t)
         {
-          m_atlas->delete_color_tile(C.m_tile);
+          if (m_async_landed[t])
+            {
+              m_atlas->delete_color_tile(m_color_tiles[t]);
+            }
         }
+      m_atlas->delete_color_tile(m_fallback_tile);
     }
-
-  for(const auto &C : m_repeated_tiles)
+  else
     {
-      m_atlas->delete_color_tile(C.second);
+      for(const fastuidraw::ivec3 &C : m_color_tiles)
+        {
+          m_atlas->delete_color_tile(C);
+        }
     }
 
   for(const auto &tile_array: m_index_tiles)
@@ -386,6 +754,102 @@ ImagePrivate::
     }
 }
 
+void
+ImagePrivate::
+compute_color_tile_layout(void)
+{
+  int tile_interior_size;
+
+  tile_interior_size = m_atlas->color_tile_size() - 2 * m_slack;
+  m_num_color_tiles = divide_up(m_dimensions, tile_interior_size);
+  m_master_index_tile_dims = fastuidraw::vec2(m_dimensions) / static_cast<float>(tile_interior_size);
+  m_dimensions_index_divisor = static_cast<float>(tile_interior_size);
+}
+
+fastuidraw::ivec2
+ImagePrivate::
+color_tile_source_location(unsigned int tile) const
+{
+  int tile_interior_size;
+  fastuidraw::ivec2 t(tile % m_num_color_tiles.x(), tile / m_num_color_tiles.x());
+
+  tile_interior_size = m_atlas->color_tile_size() - 2 * m_slack;
+  return t * tile_interior_size - fastuidraw::ivec2(m_slack, m_slack);
+}
+
+void
+ImagePrivate::
+request_sparse_tile(ImageAtlasPrivate *atlas, int tx, int ty)
+{
+  FASTUIDRAWassert(m_sparse_source);
+  if (tx >= 0 && ty >= 0 && tx < m_num_color_tiles.x() && ty < m_num_color_tiles.y())
+    {
+      atlas->m_sparse_requests.push_back(std::make_pair(this, tx + ty * m_num_color_tiles.x()));
+    }
+}
+
+void
+ImagePrivate::
+update_index_tile(ImageAtlasPrivate *atlas, unsigned int tile)
+{
+  int index_tile_size;
+  fastuidraw::ivec2 num_index_tiles, t, it;
+  fastuidraw::ivec3 index_tile;
+  std::vector<fastuidraw::ivec3> tile_data;
+
+  /* the first index layer made by create_index_layer()
+   * lists the index tiles row by row, each covering
+   * index_tile_size x index_tile_size color tiles.
+   */
+  index_tile_size = atlas->m_index_tiles.tile_size();
+  num_index_tiles = divide_up(m_num_color_tiles, index_tile_size);
+  t = fastuidraw::ivec2(tile % m_num_color_tiles.x(), tile / m_num_color_tiles.x());
+  it = t / index_tile_size;
+  index_tile = m_index_tiles.front()[it.x() + it.y() * num_index_tiles.x()];
+
+  tile_data.resize(index_tile_size * index_tile_size);
+  copy_sub_data<fastuidraw::ivec3, fastuidraw::ivec3>(fastuidraw::make_c_array(tile_data),
+                                                      index_tile_size, index_tile_size,
+                                                      fastuidraw::make_c_array(m_color_tiles),
+                                                      it.x() * index_tile_size,
+                                                      it.y() * index_tile_size,
+                                                      m_num_color_tiles);
+  atlas->m_index_store->set_data(index_tile.x() * index_tile_size,
+                                 index_tile.y() * index_tile_size,
+                                 index_tile.z(),
+                                 index_tile_size, index_tile_size,
+                                 fastuidraw::make_c_array(tile_data),
+                                 m_slack,
+                                 atlas->m_color_store.get(),
+                                 atlas->m_color_tiles.tile_size());
+}
+
+void
+ImagePrivate::
+release_sparse_tiles(ImageAtlasPrivate *atlas)
+{
+  std::vector<std::pair<ImagePrivate*, unsigned int> > &requests(atlas->m_sparse_requests);
+
+  FASTUIDRAWassert(m_sparse_source);
+  requests.erase(std::remove_if(requests.begin(), requests.end(),
+                                [this](const std::pair<ImagePrivate*, unsigned int> &v)
+                                {
+                                  return v.first == this;
+                                }),
+                 requests.end());
+
+  for(unsigned int t = 0, endt = m_sparse_tiles.size(); t < endt; ++t)
+    {
+      if (m_sparse_tiles[t].first)
+        {
+          atlas->m_sparse_tiles.erase(m_sparse_tiles[t].second);
+          atlas->m_color_tiles.delete_tile(m_color_tiles[t]);
+          m_sparse_tiles[t].first = false;
+          m_color_tiles[t] = m_fallback_tile;
+        }
+    }
+}
+
 void
 ImagePrivate::
 create_color_tiles(const fastuidraw::ImageSourceBase &image_data)
@@ -393,13 +857,13 @@ create_color_tiles(const fastuidraw::ImageSourceBase &image_data)
   int tile_interior_size;
   int color_tile_size;
 
+  compute_color_tile_layout();
   color_tile_size = m_atlas->color_tile_size();
   tile_interior_size = color_tile_size - 2 * m_slack;
-  m_num_color_tiles = divide_up(m_dimensions, tile_interior_size);
-  m_master_index_tile_dims = fastuidraw::vec2(m_dimensions) / static_cast<float>(tile_interior_size);
-  m_dimensions_index_divisor = static_cast<float>(tile_interior_size);
 
-  unsigned int savings(0);
+  /* tiles, both constant color and not, are shared across
+   * all images of the atlas by ImageAtlas::add_color_tile().
+   */
   for(int ty = 0, source_y = -m_slack;
       ty < m_num_color_tiles.y();
       ++ty, source_y += tile_interior_size)
@@ -410,40 +874,20 @@ create_color_tiles(const fastuidraw::ImageSourceBase &image_data)
         {
           fastuidraw::ivec3 new_tile;
           fastuidraw::ivec2 src_xy(source_x, source_y);
-          bool all_same_color;
           fastuidraw::u8vec4 same_color_value;
 
-          all_same_color = image_data.all_same_color(src_xy, color_tile_size, &same_color_value);
-
-          if (all_same_color)
+          if (image_data.all_same_color(src_xy, color_tile_size, &same_color_value))
             {
-              std::map<fastuidraw::u8vec4, fastuidraw::ivec3>::iterator iter;
-
-              iter = m_repeated_tiles.find(same_color_value);
-              if (iter != m_repeated_tiles.end())
-                {
-                  new_tile = iter->second;
-                  ++savings;
-                }
-              else
-                {
-                  new_tile = m_atlas->add_color_tile(same_color_value);
-                  m_repeated_tiles[same_color_value] = new_tile;
-                }
+              new_tile = m_atlas->add_color_tile(same_color_value);
             }
           else
             {
               new_tile = m_atlas->add_color_tile(src_xy, image_data);
             }
 
-          m_color_tiles.push_back(per_color_tile(new_tile, !all_same_color) );
+          m_color_tiles.push_back(new_tile);
         }
     }
-
-  FASTUIDRAWunused(savings);
-  //std::cout << "Saved " << savings << " out of "
-  //        << m_num_color_tiles.x() * m_num_color_tiles.y()
-  //        << " tiles from repeat color magicks\n";
 }
 
 
@@ -502,24 +946,570 @@ create_index_tiles(void)
   float findex_tile_size;
 
   findex_tile_size = static_cast<float>(m_atlas->index_tile_size());
-  num_index_tiles = create_index_layer<per_color_tile>(fastuidraw::make_c_array(m_color_tiles),
-                                                       m_num_color_tiles,
-                                                       m_slack,
-                                                       m_index_tiles);
+  num_index_tiles = create_index_layer<fastuidraw::ivec3>(fastuidraw::make_c_array(m_color_tiles),
+                                                          m_num_color_tiles,
+                                                          m_slack,
+                                                          m_index_tiles);
+
+  for(level = 2; num_index_tiles.x() > 1 || num_index_tiles.y() > 1; ++level)
+    {
+      num_index_tiles = create_index_layer<fastuidraw::ivec3>(fastuidraw::make_c_array(m_index_tiles.back()),
+                                                             num_index_tiles,
+                                                             -1, //indicates from index tile
+                                                             m_index_tiles);
+      m_dimensions_index_divisor *= findex_tile_size;
+      m_master_index_tile_dims /= findex_tile_size;
+    }
+
+  FASTUIDRAWassert(m_index_tiles.back().size() == 1);
+  m_master_index_tile = m_index_tiles.back()[0];
+  m_number_index_lookups = m_index_tiles.size();
+}
+
+///////////////////////////////////////////
+// color_tile_texels methods
+void
+color_tile_texels::
+fetch(fastuidraw::ivec2 src_xy, int tile_size,
+      const fastuidraw::ImageSourceBase &image_data)
+{
+  int sz, level, last_level;
+
+  /* the hash is built from two 64-bit hashes computed
+   * differently (FNV-1a on bytes and a multiply-rotate
+   * on texels) so that a false match of two different
+   * tiles is not a practical concern.
+   */
+  m_hash[0] = 14695981039346656037ull;
+  m_hash[1] = 0x9E3779B97F4A7C15ull;
+
+  m_num_levels = 0;
+  last_level = image_data.num_mipmap_levels();
+  for (level = 0; level < last_level && tile_size > 0; ++level, tile_size /= 2, src_xy /= 2)
+    {
+      if (m_levels.size() <= m_num_levels)
+        {
+          m_levels.push_back(per_level());
+        }
+
+      per_level &L(m_levels[m_num_levels++]);
+      sz = tile_size;
+      L.m_location = src_xy;
+      L.m_size = sz;
+      L.m_texels.resize(sz * sz);
+      image_data.fetch_texels(level, src_xy, sz, sz, fastuidraw::make_c_array(L.m_texels));
+
+      for(const fastuidraw::u8vec4 &texel : L.m_texels)
+        {
+          uint64_t v;
+
+          v = uint64_t(texel[0]) | (uint64_t(texel[1]) << 8u)
+            | (uint64_t(texel[2]) << 16u) | (uint64_t(texel[3]) << 24u);
+          for(unsigned int c = 0; c < 4; ++c)
+            {
+              m_hash[0] ^= texel[c];
+              m_hash[0] *= 1099511628211ull;
+            }
+          m_hash[1] = (m_hash[1] ^ v) * 0xFF51AFD7ED558CCDull;
+          m_hash[1] = (m_hash[1] << 31u) | (m_hash[1] >> 33u);
+        }
+    }
+
+  /* levels beyond those of the image are filled with a fixed
+   * color, thus the number of levels is also part of the key.
+   */
+  m_hash[0] ^= m_num_levels;
+  m_hash[0] *= 1099511628211ull;
+  m_hash[1] = (m_hash[1] ^ m_num_levels) * 0xFF51AFD7ED558CCDull;
+}
+
+bool
+color_tile_texels::
+all_same_color(fastuidraw::ivec2 location, int square_size,
+               fastuidraw::u8vec4 *dst) const
+{
+  if (m_num_levels == 0)
+    {
+      return false;
+    }
+
+  const per_level &L(m_levels[0]);
+
+  location -= L.m_location;
+  if (location.x() < 0 || location.y() < 0
+      || location.x() + square_size > L.m_size
+      || location.y() + square_size > L.m_size)
+    {
+      return false;
+    }
+
+  *dst = L.m_texels[location.x() + location.y() * L.m_size];
+  for (int y = location.y(), endy = location.y() + square_size; y < endy; ++y)
+    {
+      for (int x = location.x(), endx = location.x() + square_size; x < endx; ++x)
+        {
+          if (*dst != L.m_texels[x + y * L.m_size])
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+void
+color_tile_texels::
+fetch_texels(unsigned int mipmap_level, fastuidraw::ivec2 location,
+             unsigned int w, unsigned int h,
+             fastuidraw::c_array<fastuidraw::u8vec4> dst) const
+{
+  if (mipmap_level >= m_num_levels)
+    {
+      std::fill(dst.begin(), dst.end(), fastuidraw::u8vec4(255u, 255u, 0u, 255u));
+    }
+  else
+    {
+      const per_level &L(m_levels[mipmap_level]);
+
+      location -= L.m_location;
+      copy_sub_data(dst, w, h,
+                    fastuidraw::make_c_array(L.m_texels),
+                    location.x(), location.y(),
+                    fastuidraw::ivec2(L.m_size, L.m_size));
+    }
+}
+
+///////////////////////////////////////////
+// ImageAtlasPrivate methods
+ImageAtlasPrivate::
+ImageAtlasPrivate(int pcolor_tile_size, int pindex_tile_size,
+                  fastuidraw::reference_counted_ptr<fastuidraw::AtlasColorBackingStoreBase> pcolor_store,
+                  fastuidraw::reference_counted_ptr<fastuidraw::AtlasIndexBackingStoreBase> pindex_store):
+  m_color_store(pcolor_store),
+  m_color_tiles(pcolor_tile_size, pcolor_store->dimensions()),
+  m_index_store(pindex_store),
+  m_index_tiles(pindex_tile_size, pindex_store->dimensions()),
+  m_resizeable(m_color_store->resizeable() && m_index_store->resizeable()),
+  m_color_tile_bytes(0u),
+  m_counters(0u),
+  m_sparse_tile_budget(~0u),
+  m_sparse_frame(0u),
+  m_async_workers(nullptr)
+{
+  for(uint64_t sz = pcolor_tile_size; sz > 0u; sz /= 2u)
+    {
+      m_color_tile_bytes += sz * sz * sizeof(fastuidraw::u8vec4);
+    }
+}
+
+ImageAtlasPrivate::
+~ImageAtlasPrivate()
+{
+  if (m_async_workers)
+    {
+      FASTUIDRAWdelete(m_async_workers);
+    }
+}
+
+fastuidraw::ivec3
+ImageAtlasPrivate::
+add_color_tile(fastuidraw::u8vec4 color_data)
+{
+  std::map<fastuidraw::u8vec4, fastuidraw::ivec3>::const_iterator iter;
+  fastuidraw::ivec3 return_value;
+  shared_color_tile shared;
+  fastuidraw::ivec2 dst_xy;
+  int sz;
+
+  iter = m_color_tiles_by_color.find(color_data);
+  if (iter != m_color_tiles_by_color.end())
+    {
+      return reuse_color_tile(iter->second);
+    }
+
+  return_value = m_color_tiles.allocate_tile();
+  dst_xy.x() = return_value.x() * m_color_tiles.tile_size();
+  dst_xy.y() = return_value.y() * m_color_tiles.tile_size();
+  sz = m_color_tiles.tile_size();
+
+  for (int level = 0; sz > 0; ++level, sz /= 2, dst_xy /= 2)
+    {
+      m_color_store->set_data(level, dst_xy, return_value.z(),
+                              sz, color_data);
+    }
+
+  shared.m_is_constant_color = true;
+  shared.m_color = color_data;
+  add_shared_color_tile(return_value, shared);
+
+  return return_value;
+}
+
+fastuidraw::ivec3
+ImageAtlasPrivate::
+add_color_tile(const color_tile_texels &texels)
+{
+  std::map<tile_hash, fastuidraw::ivec3>::const_iterator iter;
+  fastuidraw::ivec3 return_value;
+  shared_color_tile shared;
+
+  iter = m_color_tiles_by_hash.find(texels.hash());
+  if (iter != m_color_tiles_by_hash.end())
+    {
+      return reuse_color_tile(iter->second);
+    }
+
+  return_value = upload_color_tile(texels);
+  shared.m_is_constant_color = false;
+  shared.m_hash = texels.hash();
+  add_shared_color_tile(return_value, shared);
+
+  return return_value;
+}
+
+void
+ImageAtlasPrivate::
+update_index_tiles(dirty_color_tiles &dirty)
+{
+  /* replace each color tile with the first color tile of
+   * its index tile so that sorting makes the duplicates
+   * adjacent.
+   */
+  for(auto &D : dirty)
+    {
+      int index_tile_size(m_index_tiles.tile_size());
+      int nx(D.first->m_num_color_tiles.x());
+      fastuidraw::ivec2 t(D.second % nx, D.second / nx);
+
+      t = (t / index_tile_size) * index_tile_size;
+      D.second = t.x() + t.y() * nx;
+    }
+  std::sort(dirty.begin(), dirty.end());
+  dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+  for(const auto &D : dirty)
+    {
+      D.first->update_index_tile(this, D.second);
+    }
+}
+
+AsyncUploadWorkers*
+ImageAtlasPrivate::
+async_workers(void)
+{
+  if (!m_async_workers)
+    {
+      unsigned int num_threads;
+
+      num_threads = std::max(1u, std::thread::hardware_concurrency());
+      m_async_workers = FASTUIDRAWnew AsyncUploadWorkers(m_color_tiles.tile_size(), num_threads);
+    }
+  return m_async_workers;
+}
+
+fastuidraw::ivec3
+ImageAtlasPrivate::
+reuse_color_tile(fastuidraw::ivec3 tile)
+{
+  std::map<fastuidraw::ivec3, shared_color_tile>::iterator iter;
+
+  iter = m_shared_color_tiles.find(tile);
+  FASTUIDRAWassert(iter != m_shared_color_tiles.end());
+  ++iter->second.m_reference_count;
+
+  ++m_counters[fastuidraw::ImageAtlas::shared_color_tile_counter];
+  m_counters[fastuidraw::ImageAtlas::bytes_saved_counter] += m_color_tile_bytes;
+  return tile;
+}
+
+void
+ImageAtlasPrivate::
+add_shared_color_tile(fastuidraw::ivec3 tile, const shared_color_tile &v)
+{
+  FASTUIDRAWassert(m_shared_color_tiles.find(tile) == m_shared_color_tiles.end());
+  m_shared_color_tiles[tile] = v;
+  m_shared_color_tiles[tile].m_reference_count = 1;
+  if (v.m_is_constant_color)
+    {
+      m_color_tiles_by_color[v.m_color] = tile;
+    }
+  else
+    {
+      m_color_tiles_by_hash[v.m_hash] = tile;
+    }
+}
+
+fastuidraw::ivec3
+ImageAtlasPrivate::
+upload_color_tile(const color_tile_texels &texels)
+{
+  fastuidraw::ivec3 return_value;
+  fastuidraw::ivec2 dst_xy;
+  int sz, level, last_level;
+
+  return_value = m_color_tiles.allocate_tile();
+  dst_xy.x() = return_value.x() * m_color_tiles.tile_size();
+  dst_xy.y() = return_value.y() * m_color_tiles.tile_size();
+  sz = m_color_tiles.tile_size();
+  last_level = texels.num_mipmap_levels();
+
+  for (level = 0; level < last_level; ++level, sz /= 2, dst_xy /= 2)
+    {
+      m_color_store->set_data(level, dst_xy, return_value.z(),
+                              texels.location(level), sz, texels);
+    }
+
+  for (; sz > 0; ++level, sz /= 2, dst_xy /= 2)
+    {
+      m_color_store->set_data(level, dst_xy, return_value.z(), sz,
+                              fastuidraw::u8vec4(255u, 255u, 0u, 255u));
+    }
+
+  return return_value;
+}
+
+void
+ImageAtlasPrivate::
+evict_sparse_tile(dirty_color_tiles &dirty)
+{
+  ImagePrivate *image;
+  unsigned int tile;
+
+  FASTUIDRAWassert(!m_sparse_tiles.empty());
+  image = m_sparse_tiles.back().m_image;
+  tile = m_sparse_tiles.back().m_tile;
+  m_sparse_tiles.pop_back();
+
+  /* delete_tile() honors delay_tile_freeing(), so the texels
+   * stay valid for draws that are not yet sent to the GPU.
+   */
+  m_color_tiles.delete_tile(image->m_color_tiles[tile]);
+  image->m_color_tiles[tile] = image->m_fallback_tile;
+  image->m_sparse_tiles[tile].first = false;
+  dirty.push_back(std::make_pair(image, tile));
+  ++m_counters[fastuidraw::ImageAtlas::sparse_eviction_counter];
+}
+
+bool
+ImageAtlasPrivate::
+make_room_for_sparse_tile(dirty_color_tiles &dirty)
+{
+  /* tiles requested in the current frame are never
+   * evicted to make room for other tiles of the frame.
+   */
+  while (m_sparse_tiles.size() >= m_sparse_tile_budget)
+    {
+      if (m_sparse_tiles.empty()
+          || m_sparse_tiles.back().m_last_requested_frame == m_sparse_frame)
+        {
+          return false;
+        }
+      evict_sparse_tile(dirty);
+    }
+
+  while (m_color_tiles.number_free() == 0)
+    {
+      if (m_resizeable)
+        {
+          m_color_tiles.resize_to_fit(1);
+          m_color_store->resize(m_color_tiles.num_tiles().z());
+        }
+      else if (!m_sparse_tiles.empty()
+               && m_sparse_tiles.back().m_last_requested_frame != m_sparse_frame)
+        {
+          /* the evicted tile might only be freed later
+           * because of delay_tile_freeing(), so keep going.
+           */
+          evict_sparse_tile(dirty);
+        }
+      else
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+unsigned int
+ImageAtlasPrivate::
+update_sparse_residency(unsigned int max_uploads)
+{
+  dirty_color_tiles dirty;
+  unsigned int num_uploads(0);
+
+  ++m_sparse_frame;
+
+  /* first mark the requested tiles that are already resident
+   * as used so that they are not evicted for the others.
+   */
+  for(const auto &R : m_sparse_requests)
+    {
+      std::pair<bool, sparse_tile_list::iterator> &S(R.first->m_sparse_tiles[R.second]);
+      if (S.first)
+        {
+          S.second->m_last_requested_frame = m_sparse_frame;
+          m_sparse_tiles.splice(m_sparse_tiles.begin(), m_sparse_tiles, S.second);
+        }
+    }
+
+  for(const auto &R : m_sparse_requests)
+    {
+      ImagePrivate *image(R.first);
+      std::pair<bool, sparse_tile_list::iterator> &S(image->m_sparse_tiles[R.second]);
+      sparse_tile entry;
+
+      if (S.first)
+        {
+          continue;
+        }
+
+      if (num_uploads >= max_uploads || !make_room_for_sparse_tile(dirty))
+        {
+          break;
+        }
+
+      color_tile_texels texels(image->color_tile_source_location(R.second),
+                               m_color_tiles.tile_size(),
+                               *image->m_sparse_source);
+
+      image->m_color_tiles[R.second] = upload_color_tile(texels);
+      entry.m_image = image;
+      entry.m_tile = R.second;
+      entry.m_last_requested_frame = m_sparse_frame;
+      m_sparse_tiles.push_front(entry);
+      S.first = true;
+      S.second = m_sparse_tiles.begin();
+      dirty.push_back(R);
+
+      ++num_uploads;
+      ++m_counters[fastuidraw::ImageAtlas::sparse_upload_counter];
+    }
+
+  /* requests that could not be honored are dropped, the
+   * application is to request them again on a later frame.
+   */
+  m_sparse_requests.clear();
+
+  update_index_tiles(dirty);
+  return num_uploads;
+}
+
+///////////////////////////////////////////
+// AsyncUploadWorkers methods
+AsyncUploadWorkers::
+AsyncUploadWorkers(int tile_size, unsigned int num_threads):
+  m_tile_size(tile_size),
+  m_pool(num_threads)
+{
+}
+
+AsyncUploadWorkers::
+~AsyncUploadWorkers()
+{
+  /* every Image cancels its tiles before it is destroyed
+   * and the ImageAtlas outlives its Image objects, so no
+   * tile is being fetched.
+   */
+  FASTUIDRAWassert(m_fetched.empty());
+  for(color_tile_texels *p : m_staging_pool)
+    {
+      FASTUIDRAWdelete(p);
+    }
+}
+
+void
+AsyncUploadWorkers::
+add(ImagePrivate *image, unsigned int num_tiles)
+{
+  for(unsigned int t = 0; t < num_tiles; ++t)
+    {
+      m_pool.add(image, [this, image, t] { fetch(image, t); });
+    }
+}
+
+bool
+AsyncUploadWorkers::
+take_fetched(async_tile *dst)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_fetched.empty())
+    {
+      return false;
+    }
+
+  *dst = m_fetched.front();
+  m_fetched.pop_front();
+  ++dst->m_image->m_async_in_flight;
+  return true;
+}
+
+void
+AsyncUploadWorkers::
+release(const async_tile &T)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_staging_pool.push_back(T.m_texels);
+    --T.m_image->m_async_in_flight;
+  }
+  m_done_cv.notify_all();
+}
+
+void
+AsyncUploadWorkers::
+cancel(ImagePrivate *image)
+{
+  auto of_image = [image](const async_tile &T) { return T.m_image == image; };
+
+  /* after this no tile of the image is queued or being fetched */
+  m_pool.cancel(image);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock, [image] { return image->m_async_in_flight == 0; });
+  for(const async_tile &T : m_fetched)
+    {
+      if (T.m_image == image)
+        {
+          m_staging_pool.push_back(T.m_texels);
+        }
+    }
+  m_fetched.erase(std::remove_if(m_fetched.begin(), m_fetched.end(), of_image), m_fetched.end());
+}
+
+void
+AsyncUploadWorkers::
+fetch(ImagePrivate *image, unsigned int tile)
+{
+  async_tile T;
+  fastuidraw::ivec2 src_xy;
+
+  T.m_image = image;
+  T.m_tile = tile;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_staging_pool.empty())
+      {
+        T.m_texels = FASTUIDRAWnew color_tile_texels();
+      }
+    else
+      {
+        T.m_texels = m_staging_pool.back();
+        m_staging_pool.pop_back();
+      }
+  }
 
-  for(level = 2; num_index_tiles.x() > 1 || num_index_tiles.y() > 1; ++level)
+  /* same choice between a constant color tile and a
+   * tile of texels as ImagePrivate::create_color_tiles().
+   */
+  src_xy = image->color_tile_source_location(tile);
+  T.m_same_color = image->m_async_source->all_same_color(src_xy, m_tile_size, &T.m_color);
+  if (!T.m_same_color)
     {
-      num_index_tiles = create_index_layer<fastuidraw::ivec3>(fastuidraw::make_c_array(m_index_tiles.back()),
-                                                             num_index_tiles,
-                                                             -1, //indicates from index tile
-                                                             m_index_tiles);
-      m_dimensions_index_divisor *= findex_tile_size;
-      m_master_index_tile_dims /= findex_tile_size;
+      T.m_texels->fetch(src_xy, m_tile_size, *image->m_async_source);
     }
 
-  FASTUIDRAWassert(m_index_tiles.back().size() == 1);
-  m_master_index_tile = m_index_tiles.back()[0];
-  m_number_index_lookups = m_index_tiles.size();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_fetched.push_back(T);
 }
 
 ///////////////////////////////////////////
@@ -1017,65 +2007,192 @@ add_color_tile(u8vec4 color_data)
 {
   ImageAtlasPrivate *d;
   d = static_cast<ImageAtlasPrivate*>(m_d);
-
-  ivec3 return_value;
   autolock_mutex M(d->m_mutex);
-  ivec2 dst_xy;
-  int sz;
+  return d->add_color_tile(color_data);
+}
 
-  return_value = d->m_color_tiles.allocate_tile();
-  dst_xy.x() = return_value.x() * d->m_color_tiles.tile_size();
-  dst_xy.y() = return_value.y() * d->m_color_tiles.tile_size();
-  sz = d->m_color_tiles.tile_size();
+fastuidraw::ivec3
+fastuidraw::ImageAtlas::
+add_color_tile(ivec2 src_xy, const ImageSourceBase &image_data)
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
 
-  for (int level = 0; sz > 0; ++level, sz /= 2, dst_xy /= 2)
-    {
-      d->m_color_store->set_data(level, dst_xy, return_value.z(),
-                                 sz, color_data);
-    }
+  /* fetching and hashing the texels does not touch
+   * the atlas, so do it before taking the lock.
+   */
+  color_tile_texels texels(src_xy, color_tile_size(), image_data);
 
-  return return_value;
+  autolock_mutex M(d->m_mutex);
+  return d->add_color_tile(texels);
 }
 
-fastuidraw::ivec3
+void
 fastuidraw::ImageAtlas::
-add_color_tile(ivec2 src_xy, const ImageSourceBase &image_data)
+delete_color_tile(fastuidraw::ivec3 tile)
 {
   ImageAtlasPrivate *d;
   d = static_cast<ImageAtlasPrivate*>(m_d);
-  ivec3 return_value;
   autolock_mutex M(d->m_mutex);
-  ivec2 dst_xy;
-  int sz, level, last_level;
+  std::map<ivec3, shared_color_tile>::iterator iter;
 
-  return_value = d->m_color_tiles.allocate_tile();
-  dst_xy.x() = return_value.x() * d->m_color_tiles.tile_size();
-  dst_xy.y() = return_value.y() * d->m_color_tiles.tile_size();
-  sz = d->m_color_tiles.tile_size();
-  last_level = image_data.num_mipmap_levels();
+  iter = d->m_shared_color_tiles.find(tile);
+  FASTUIDRAWassert(iter != d->m_shared_color_tiles.end());
+  FASTUIDRAWassert(iter->second.m_reference_count > 0);
 
-  for (level = 0; level < last_level && sz > 0; ++level, sz /= 2, dst_xy /= 2, src_xy /= 2)
+  --iter->second.m_reference_count;
+  if (iter->second.m_reference_count == 0)
     {
-      d->m_color_store->set_data(level, dst_xy, return_value.z(), src_xy, sz, image_data);
+      if (iter->second.m_is_constant_color)
+        {
+          d->m_color_tiles_by_color.erase(iter->second.m_color);
+        }
+      else
+        {
+          d->m_color_tiles_by_hash.erase(iter->second.m_hash);
+        }
+      d->m_shared_color_tiles.erase(iter);
+      d->m_color_tiles.delete_tile(tile);
     }
+}
 
-  for (; sz > 0; ++level, sz /= 2, dst_xy /= 2, src_xy /= 2, sz /= 2)
-    {
-      d->m_color_store->set_data(level, dst_xy, return_value.z(), sz,
-                                 u8vec4(255u, 255u, 0u, 255u));
-    }
+uint64_t
+fastuidraw::ImageAtlas::
+counter(enum counter_t tp) const
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  autolock_mutex M(d->m_mutex);
+  return d->m_counters[tp];
+}
 
-  return return_value;
+void
+fastuidraw::ImageAtlas::
+reset_counters(void)
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  autolock_mutex M(d->m_mutex);
+  d->m_counters = vecN<uint64_t, number_counters>(0u);
 }
 
 void
 fastuidraw::ImageAtlas::
-delete_color_tile(fastuidraw::ivec3 tile)
+sparse_color_tile_budget(unsigned int v)
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  autolock_mutex M(d->m_mutex);
+  d->m_sparse_tile_budget = v;
+}
+
+unsigned int
+fastuidraw::ImageAtlas::
+sparse_color_tile_budget(void) const
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  autolock_mutex M(d->m_mutex);
+  return d->m_sparse_tile_budget;
+}
+
+unsigned int
+fastuidraw::ImageAtlas::
+number_resident_sparse_color_tiles(void) const
+{
+  ImageAtlasPrivate *d;
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  autolock_mutex M(d->m_mutex);
+  return d->m_sparse_tiles.size();
+}
+
+unsigned int
+fastuidraw::ImageAtlas::
+update_sparse_residency(unsigned int max_uploads)
 {
   ImageAtlasPrivate *d;
   d = static_cast<ImageAtlasPrivate*>(m_d);
   autolock_mutex M(d->m_mutex);
-  d->m_color_tiles.delete_tile(tile);
+  return d->update_sparse_residency(max_uploads);
+}
+
+unsigned int
+fastuidraw::ImageAtlas::
+process_async_uploads(uint64_t time_budget_us)
+{
+  ImageAtlasPrivate *d;
+  AsyncUploadWorkers *workers;
+  std::vector<async_tile> taken;
+  std::vector<ImagePrivate*> completed;
+  dirty_color_tiles dirty;
+  std::chrono::steady_clock::time_point start_time;
+
+  d = static_cast<ImageAtlasPrivate*>(m_d);
+  {
+    autolock_mutex M(d->m_mutex);
+    workers = d->m_async_workers;
+  }
+
+  if (!workers)
+    {
+      return 0;
+    }
+
+  start_time = std::chrono::steady_clock::now();
+  for(async_tile T; workers->take_fetched(&T);)
+    {
+      uint64_t elapsed_us;
+
+      taken.push_back(T);
+      {
+        ImagePrivate *image(T.m_image);
+        autolock_mutex M(d->m_mutex);
+
+        FASTUIDRAWassert(!image->m_async_landed[T.m_tile]);
+        image->m_color_tiles[T.m_tile] = (T.m_same_color) ?
+          d->add_color_tile(T.m_color) :
+          d->add_color_tile(*T.m_texels);
+        image->m_async_landed[T.m_tile] = true;
+        dirty.push_back(std::make_pair(image, T.m_tile));
+
+        FASTUIDRAWassert(image->m_async_remaining > 0);
+        --image->m_async_remaining;
+        if (image->m_async_remaining == 0)
+          {
+            completed.push_back(image);
+          }
+      }
+
+      elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+      if (elapsed_us >= time_budget_us)
+        {
+          break;
+        }
+    }
+
+  {
+    autolock_mutex M(d->m_mutex);
+    d->update_index_tiles(dirty);
+  }
+
+  /* the index tiles of a completed image no longer
+   * reference its fallback tile.
+   */
+  for(ImagePrivate *image : completed)
+    {
+      delete_color_tile(image->m_fallback_tile);
+      image->m_ready = true;
+    }
+
+  /* releasing the tiles last keeps Image::~Image() from
+   * deleting the images while they are used above.
+   */
+  for(const async_tile &T : taken)
+    {
+      workers->release(T);
+    }
+
+  return taken.size();
 }
 
 void
@@ -1195,6 +2312,90 @@ create(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
   return FASTUIDRAWnew Image(atlas, w, h, image_data, pslack);
 }
 
+fastuidraw::reference_counted_ptr<fastuidraw::Image>
+fastuidraw::Image::
+create_sparse(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
+              const ImageSourceBase &image_data, unsigned int pslack,
+              u8vec4 fallback_color)
+{
+  int tile_interior_size;
+  ivec2 num_color_tiles;
+  int index_tiles;
+
+  if (w <= 0 || h <= 0)
+    {
+      return reference_counted_ptr<Image>();
+    }
+
+  tile_interior_size = atlas->color_tile_size() - 2 * pslack;
+  if (tile_interior_size <= 0)
+    {
+      return reference_counted_ptr<Image>();
+    }
+
+  /* only the index tiles and the single fallback
+   * color tile are needed at creation.
+   */
+  num_color_tiles = divide_up(ivec2(w, h), tile_interior_size);
+  index_tiles = number_index_tiles_needed(num_color_tiles, atlas->index_tile_size());
+  if (index_tiles > atlas->number_free_index_tiles()
+      || atlas->number_free_color_tiles() < 1)
+    {
+      if (atlas->resizeable())
+        {
+          atlas->resize_to_fit(1, index_tiles);
+        }
+      else
+        {
+          return reference_counted_ptr<Image>();
+        }
+    }
+
+  return FASTUIDRAWnew Image(atlas, w, h, image_data, pslack, fallback_color, false);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::Image>
+fastuidraw::Image::
+create_async(reference_counted_ptr<ImageAtlas> atlas, int w, int h,
+             const ImageSourceBase &image_data, unsigned int pslack,
+             u8vec4 fallback_color)
+{
+  int tile_interior_size;
+  ivec2 num_color_tiles;
+  int index_tiles;
+
+  if (w <= 0 || h <= 0)
+    {
+      return reference_counted_ptr<Image>();
+    }
+
+  tile_interior_size = atlas->color_tile_size() - 2 * pslack;
+  if (tile_interior_size <= 0)
+    {
+      return reference_counted_ptr<Image>();
+    }
+
+  /* the same room as create() needs, together with
+   * the fallback color tile.
+   */
+  num_color_tiles = divide_up(ivec2(w, h), tile_interior_size);
+  index_tiles = number_index_tiles_needed(num_color_tiles, atlas->index_tile_size());
+  if (index_tiles > atlas->number_free_index_tiles()
+      || num_color_tiles.x() * num_color_tiles.y() + 1 > atlas->number_free_color_tiles())
+    {
+      if (atlas->resizeable())
+        {
+          atlas->resize_to_fit(num_color_tiles.x() * num_color_tiles.y() + 1, index_tiles);
+        }
+      else
+        {
+          return reference_counted_ptr<Image>();
+        }
+    }
+
+  return FASTUIDRAWnew Image(atlas, w, h, image_data, pslack, fallback_color, true);
+}
+
 fastuidraw::reference_counted_ptr<fastuidraw::Image>
 fastuidraw::Image::
 create_bindless(int w, int h, unsigned int m, enum type_t type, uint64_t handle)
@@ -1222,11 +2423,53 @@ Image(reference_counted_ptr<ImageAtlas> patlas,
   m_d = FASTUIDRAWnew ImagePrivate(patlas, w, h, image_data, pslack);
 }
 
+fastuidraw::Image::
+Image(reference_counted_ptr<ImageAtlas> patlas,
+      int w, int h,
+      const ImageSourceBase &image_data,
+      unsigned int pslack,
+      u8vec4 fallback_color,
+      bool async)
+{
+  ImagePrivate *d;
+
+  d = FASTUIDRAWnew ImagePrivate(patlas, w, h, image_data, pslack, fallback_color,
+                                 async ? ImagePrivate::async_tiles : ImagePrivate::sparse_tiles);
+  m_d = d;
+  if (async)
+    {
+      ImageAtlasPrivate *atlas_d;
+      atlas_d = static_cast<ImageAtlasPrivate*>(patlas->m_d);
+
+      autolock_mutex M(atlas_d->m_mutex);
+      atlas_d->async_workers()->add(d, d->m_color_tiles.size());
+    }
+}
+
 fastuidraw::Image::
 ~Image()
 {
   ImagePrivate *d;
   d = static_cast<ImagePrivate*>(m_d);
+  if (d->m_sparse_source)
+    {
+      ImageAtlasPrivate *atlas_d;
+      atlas_d = static_cast<ImageAtlasPrivate*>(d->m_atlas->m_d);
+
+      autolock_mutex M(atlas_d->m_mutex);
+      d->release_sparse_tiles(atlas_d);
+    }
+  else if (d->m_async_source)
+    {
+      ImageAtlasPrivate *atlas_d;
+      atlas_d = static_cast<ImageAtlasPrivate*>(d->m_atlas->m_d);
+
+      /* the workers exist since the ctor made them; do not
+       * hold the atlas lock because process_async_uploads()
+       * takes it while holding tiles of this image.
+       */
+      atlas_d->m_async_workers->cancel(d);
+    }
   FASTUIDRAWdelete(d);
   m_d = nullptr;
 }
@@ -1321,3 +2564,90 @@ atlas(void) const
   d = static_cast<ImagePrivate*>(m_d);
   return d->m_atlas;
 }
+
+bool
+fastuidraw::Image::
+sparse(void) const
+{
+  ImagePrivate *d;
+  d = static_cast<ImagePrivate*>(m_d);
+  return d->m_sparse_source != nullptr;
+}
+
+bool
+fastuidraw::Image::
+ready(void) const
+{
+  ImagePrivate *d;
+  d = static_cast<ImagePrivate*>(m_d);
+  return d->m_ready;
+}
+
+fastuidraw::ivec2
+fastuidraw::Image::
+number_color_tiles(void) const
+{
+  ImagePrivate *d;
+  d = static_cast<ImagePrivate*>(m_d);
+  return d->m_num_color_tiles;
+}
+
+void
+fastuidraw::Image::
+request_color_tiles(c_array<const ivec2> tiles)
+{
+  ImagePrivate *d;
+  ImageAtlasPrivate *atlas_d;
+
+  d = static_cast<ImagePrivate*>(m_d);
+  if (!d->m_sparse_source)
+    {
+      return;
+    }
+
+  atlas_d = static_cast<ImageAtlasPrivate*>(d->m_atlas->m_d);
+  autolock_mutex M(atlas_d->m_mutex);
+  for(const ivec2 &t : tiles)
+    {
+      d->request_sparse_tile(atlas_d, t.x(), t.y());
+    }
+}
+
+void
+fastuidraw::Image::
+request_region(ivec2 min_pt, ivec2 max_pt)
+{
+  ImagePrivate *d;
+  ImageAtlasPrivate *atlas_d;
+  int tile_interior_size;
+  ivec2 min_tile, max_tile;
+
+  d = static_cast<ImagePrivate*>(m_d);
+  if (!d->m_sparse_source)
+    {
+      return;
+    }
+
+  min_pt.x() = t_max(min_pt.x(), 0);
+  min_pt.y() = t_max(min_pt.y(), 0);
+  max_pt.x() = t_min(max_pt.x(), d->m_dimensions.x());
+  max_pt.y() = t_min(max_pt.y(), d->m_dimensions.y());
+  if (min_pt.x() >= max_pt.x() || min_pt.y() >= max_pt.y())
+    {
+      return;
+    }
+
+  tile_interior_size = d->m_atlas->color_tile_size() - 2 * d->m_slack;
+  min_tile = min_pt / tile_interior_size;
+  max_tile = (max_pt - ivec2(1, 1)) / tile_interior_size;
+
+  atlas_d = static_cast<ImageAtlasPrivate*>(d->m_atlas->m_d);
+  autolock_mutex M(atlas_d->m_mutex);
+  for(int ty = min_tile.y(); ty <= max_tile.y(); ++ty)
+    {
+      for(int tx = min_tile.x(); tx <= max_tile.x(); ++tx)
+        {
+          d->request_sparse_tile(atlas_d, tx, ty);
+        }
+    }
+}
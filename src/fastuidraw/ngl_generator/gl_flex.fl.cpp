@@ -55,7 +55,7 @@ allSpace [ \t\n]
 anychar .|{allSpace}
 const "const"{allSpace}+
 GLTYPEARB GLchar|GLcharARB|GLintptr|GLintpreARB|GLsizeiptr|GLsizeiptrARB|GLhandleARB|GLhalfARB|GLhalfNV
-GLTYPESIMPLE GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT
+GLTYPESIMPLE GLenum|GLbitfield|GLboolean|GLsizei|GLvoid|GLuint64EXT|GLuint64|GLint64|GLint64EXT|GLsync
 GLTYPEBYTE GLbyte|GLubyte
 GLTYPESHORT GLshort|GLushort
 GLTYPEINT GLint|GLuint|int
@@ -9,8 +9,10 @@ dir := $(d)/packing
 include $(dir)/Rules.mk
 
 FASTUIDRAW_SOURCES += $(call filelist, fill_rule.cpp \
+	painter_attribute.cpp \
 	painter_attribute_data.cpp \
 	painter_attribute_data_filler_glyphs.cpp \
+	binned_glyph_run.cpp \
 	painter_brush.cpp painter_stroke_params.cpp \
 	painter_dashed_stroke_params.cpp \
 	painter.cpp painter_enums.cpp \
@@ -20,7 +22,8 @@ FASTUIDRAW_SOURCES += $(call filelist, fill_rule.cpp \
 	painter_shader.cpp painter_shader_set.cpp \
 	painter_dashed_stroke_shader_set.cpp painter_stroke_shader.cpp \
 	painter_glyph_shader.cpp painter_blend_shader_set.cpp \
-	painter_fill_shader.cpp \
+	painter_fill_shader.cpp painter_rounded_rect_shader.cpp \
+	simple_path.cpp \
 	stroked_caps_joins.cpp stroked_point.cpp \
 	stroked_path.cpp filled_path.cpp \
 	arc_stroked_point.cpp)
@@ -0,0 +1,318 @@
+/*!
+ * \file binned_glyph_run.cpp
+ * \brief file binned_glyph_run.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <map>
+#include <vector>
+#include <cmath>
+#include <fastuidraw/painter/binned_glyph_run.hpp>
+#include <fastuidraw/painter/painter_attribute_data.hpp>
+#include <fastuidraw/painter/painter_attribute_data_filler_glyphs.hpp>
+#include "../private/util_private.hpp"
+#include "../private/bounding_box.hpp"
+#include "../private/clip.hpp"
+
+namespace
+{
+  class ScratchSpacePrivate
+  {
+  public:
+    std::vector<fastuidraw::vec3> m_adjusted_clip_eqs;
+    std::vector<fastuidraw::vec2> m_clipped_rect;
+
+    fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
+    std::vector<float> m_clip_scratch_floats;
+  };
+
+  /* the glyphs of a grid cell before its attribute data is made */
+  class BinBuilder
+  {
+  public:
+    std::vector<fastuidraw::vec2> m_positions;
+    std::vector<fastuidraw::Glyph> m_glyphs;
+    std::vector<float> m_scale_factors;
+    fastuidraw::BoundingBox<float> m_bounds;
+  };
+
+  class Bin
+  {
+  public:
+    fastuidraw::BoundingBox<float> m_bounds;
+    fastuidraw::PainterAttributeData *m_data;
+    unsigned int m_number_glyphs;
+  };
+
+  class BinnedGlyphRunPrivate:fastuidraw::noncopyable
+  {
+  public:
+    BinnedGlyphRunPrivate(fastuidraw::c_array<const fastuidraw::vec2> glyph_positions,
+                          fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
+                          fastuidraw::c_array<const float> scale_factors,
+                          std::pair<bool, float> render_pixel_size,
+                          enum fastuidraw::PainterEnums::glyph_orientation orientation,
+                          float bin_size);
+
+    ~BinnedGlyphRunPrivate();
+
+    std::vector<Bin> m_bins;
+    unsigned int m_number_glyphs;
+  };
+}
+
+//////////////////////////////////////
+// BinnedGlyphRunPrivate methods
+BinnedGlyphRunPrivate::
+BinnedGlyphRunPrivate(fastuidraw::c_array<const fastuidraw::vec2> glyph_positions,
+                      fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
+                      fastuidraw::c_array<const float> scale_factors,
+                      std::pair<bool, float> render_pixel_size,
+                      enum fastuidraw::PainterEnums::glyph_orientation orientation,
+                      float bin_size):
+  m_number_glyphs(0)
+{
+  using namespace fastuidraw;
+
+  typedef std::pair<int, int> cell;
+  std::map<cell, BinBuilder> builders;
+
+  FASTUIDRAWassert(glyph_positions.size() == glyphs.size());
+  FASTUIDRAWassert(scale_factors.empty() || scale_factors.size() == glyphs.size());
+  FASTUIDRAWassert(bin_size > 0.0f);
+
+  for(unsigned int g = 0, endg = glyphs.size(); g < endg; ++g)
+    {
+      Glyph G(glyphs[g]);
+      vec2 p(glyph_positions[g]), p_bl, p_tr;
+      float scale;
+      cell C;
+
+      if (!G.valid())
+        {
+          continue;
+        }
+
+      scale = (render_pixel_size.first) ?
+        render_pixel_size.second / G.layout().m_units_per_EM :
+        (scale_factors.empty()) ? 1.0f : scale_factors[g];
+
+      /* same computation of the corners of the glyph as
+       * done by PainterAttributeDataFillerGlyphs
+       */
+      if (orientation == PainterEnums::y_increases_downwards)
+        {
+          p_bl.x() = p.x() + scale * G.layout().m_horizontal_layout_offset.x();
+          p_bl.y() = p.y() - scale * G.layout().m_horizontal_layout_offset.y();
+          p_tr.x() = p_bl.x() + scale * G.layout().m_size.x();
+          p_tr.y() = p_bl.y() - scale * G.layout().m_size.y();
+        }
+      else
+        {
+          p_bl = p + scale * G.layout().m_horizontal_layout_offset;
+          p_tr = p_bl + scale * G.layout().m_size;
+        }
+
+      C.first = static_cast<int>(std::floor(p.x() / bin_size));
+      C.second = static_cast<int>(std::floor(p.y() / bin_size));
+
+      BinBuilder &B(builders[C]);
+      B.m_positions.push_back(p);
+      B.m_glyphs.push_back(G);
+      B.m_scale_factors.push_back(scale);
+      B.m_bounds.union_point(p_bl);
+      B.m_bounds.union_point(p_tr);
+    }
+
+  m_bins.reserve(builders.size());
+  for(const auto &e : builders)
+    {
+      const BinBuilder &B(e.second);
+      PainterAttributeDataFillerGlyphs filler(make_c_array(B.m_positions),
+                                              make_c_array(B.m_glyphs),
+                                              make_c_array(B.m_scale_factors),
+                                              orientation);
+      Bin bin;
+
+      bin.m_bounds = B.m_bounds;
+      bin.m_data = FASTUIDRAWnew PainterAttributeData();
+      bin.m_data->set_data(filler);
+      bin.m_number_glyphs = filler.number_glyphs();
+      m_number_glyphs += bin.m_number_glyphs;
+      m_bins.push_back(bin);
+    }
+}
+
+BinnedGlyphRunPrivate::
+~BinnedGlyphRunPrivate()
+{
+  for(Bin &bin : m_bins)
+    {
+      FASTUIDRAWdelete(bin.m_data);
+    }
+}
+
+////////////////////////////////////////////////
+// fastuidraw::BinnedGlyphRun::ScratchSpace methods
+fastuidraw::BinnedGlyphRun::ScratchSpace::
+ScratchSpace(void)
+{
+  m_d = FASTUIDRAWnew ScratchSpacePrivate();
+}
+
+fastuidraw::BinnedGlyphRun::ScratchSpace::
+~ScratchSpace(void)
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+////////////////////////////////////////
+// fastuidraw::BinnedGlyphRun methods
+fastuidraw::BinnedGlyphRun::
+BinnedGlyphRun(c_array<const vec2> glyph_positions,
+               c_array<const Glyph> glyphs,
+               c_array<const float> scale_factors,
+               enum PainterEnums::glyph_orientation orientation,
+               float bin_size)
+{
+  m_d = FASTUIDRAWnew BinnedGlyphRunPrivate(glyph_positions, glyphs, scale_factors,
+                                            std::make_pair(false, 1.0f),
+                                            orientation, bin_size);
+}
+
+fastuidraw::BinnedGlyphRun::
+BinnedGlyphRun(c_array<const vec2> glyph_positions,
+               c_array<const Glyph> glyphs,
+               float render_pixel_size,
+               enum PainterEnums::glyph_orientation orientation,
+               float bin_size)
+{
+  m_d = FASTUIDRAWnew BinnedGlyphRunPrivate(glyph_positions, glyphs, c_array<const float>(),
+                                            std::make_pair(true, render_pixel_size),
+                                            orientation, bin_size);
+}
+
+fastuidraw::BinnedGlyphRun::
+~BinnedGlyphRun()
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::BinnedGlyphRun::
+number_bins(void) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  return d->m_bins.size();
+}
+
+unsigned int
+fastuidraw::BinnedGlyphRun::
+number_glyphs(void) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  return d->m_number_glyphs;
+}
+
+const fastuidraw::PainterAttributeData&
+fastuidraw::BinnedGlyphRun::
+bin_data(unsigned int bin) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  FASTUIDRAWassert(bin < d->m_bins.size());
+  return *d->m_bins[bin].m_data;
+}
+
+unsigned int
+fastuidraw::BinnedGlyphRun::
+bin_number_glyphs(unsigned int bin) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  FASTUIDRAWassert(bin < d->m_bins.size());
+  return d->m_bins[bin].m_number_glyphs;
+}
+
+fastuidraw::vec2
+fastuidraw::BinnedGlyphRun::
+bin_min_point(unsigned int bin) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  FASTUIDRAWassert(bin < d->m_bins.size());
+  return d->m_bins[bin].m_bounds.min_point();
+}
+
+fastuidraw::vec2
+fastuidraw::BinnedGlyphRun::
+bin_max_point(unsigned int bin) const
+{
+  BinnedGlyphRunPrivate *d;
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  FASTUIDRAWassert(bin < d->m_bins.size());
+  return d->m_bins[bin].m_bounds.max_point();
+}
+
+unsigned int
+fastuidraw::BinnedGlyphRun::
+select_bins(ScratchSpace &work_room,
+            c_array<const vec3> clip_equations,
+            const float3x3 &clip_matrix_local,
+            c_array<unsigned int> dst) const
+{
+  BinnedGlyphRunPrivate *d;
+  ScratchSpacePrivate *scratch;
+  unsigned int return_value(0u);
+
+  d = static_cast<BinnedGlyphRunPrivate*>(m_d);
+  scratch = static_cast<ScratchSpacePrivate*>(work_room.m_d);
+  FASTUIDRAWassert(dst.size() >= d->m_bins.size());
+
+  scratch->m_adjusted_clip_eqs.resize(clip_equations.size());
+  for(unsigned int i = 0; i < clip_equations.size(); ++i)
+    {
+      /* transform clip equations from clip coordinates to
+       * local coordinates.
+       */
+      scratch->m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
+    }
+
+  for(unsigned int b = 0, endb = d->m_bins.size(); b < endb; ++b)
+    {
+      vecN<vec2, 4> bb;
+
+      d->m_bins[b].m_bounds.inflated_polygon(bb, 0.0f);
+      detail::clip_against_planes(make_c_array(scratch->m_adjusted_clip_eqs),
+                                  bb, scratch->m_clipped_rect,
+                                  scratch->m_clip_scratch_floats,
+                                  scratch->m_clip_scratch_vec2s);
+      if (!scratch->m_clipped_rect.empty())
+        {
+          dst[return_value] = b;
+          ++return_value;
+        }
+    }
+
+  return return_value;
+}
@@ -22,6 +22,7 @@
 #include <map>
 #include <set>
 #include <algorithm>
+#include <chrono>
 #include <ctime>
 #include <set>
 #include <math.h>
@@ -466,6 +467,9 @@ namespace
     explicit
     SubPath(const fastuidraw::TessellatedPath &P);
 
+    SubPath(const fastuidraw::BoundingBox<double> &bb,
+            const fastuidraw::TessellatedPath &P);
+
     const std::vector<SubContour>&
     contours(void) const
     {
@@ -491,12 +495,19 @@ namespace
     }
 
     fastuidraw::vecN<SubPath*, 2>
-    split(int &splitting_coordinate) const;
+    split(int &splitting_coordinate, double &splitting_value) const;
+
+    fastuidraw::vecN<SubPath*, 2>
+    split_at(int splitting_coordinate, double splitting_value) const;
 
     static
     bool
     contour_is_reducable(const SubContour &C);
 
+    static
+    fastuidraw::BoundingBox<double>
+    compute_bounds(const fastuidraw::TessellatedPath &P);
+
   private:
     SubPath(const fastuidraw::BoundingBox<double> &bb,
             std::vector<SubContour> &contours,
@@ -961,6 +972,72 @@ namespace
     std::vector<float> m_clip_scratch_floats;
   };
 
+  typedef fastuidraw::vecN<uint64_t, fastuidraw::FilledPath::number_counters> FilledPathCounters;
+
+  /* adds the time in microseconds between its ctor and dtor
+   * to a counter.
+   */
+  class ScopedTimer:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    ScopedTimer(uint64_t &dst):
+      m_dst(dst),
+      m_start(std::chrono::steady_clock::now())
+    {}
+
+    ~ScopedTimer()
+    {
+      std::chrono::steady_clock::time_point end(std::chrono::steady_clock::now());
+      m_dst += std::chrono::duration_cast<std::chrono::microseconds>(end - m_start).count();
+    }
+
+  private:
+    uint64_t &m_dst;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  /* The data of a SubsetPrivate that is made lazily. A
+   * FilledPath made from a previous FilledPath shares the
+   * SubsetData of those subsets whose portion of the path
+   * did not change, so that neither FilledPath is modified
+   * by making the other.
+   */
+  class SubsetData:
+    public fastuidraw::reference_counted<SubsetData>::default_base
+  {
+  public:
+    explicit
+    SubsetData(SubPath *Q);
+
+    ~SubsetData();
+
+    /* if the SubsetPrivate has children then
+     * m_painter_data is made by "merging" the
+     * data of m_painter_data from its children.
+     * We do this merging so that we can avoid
+     * recursing if the entirity of the bounding
+     * box is contained in the clipping region.
+     */
+    fastuidraw::PainterAttributeData *m_painter_data;
+    std::vector<int> m_winding_numbers;
+
+    fastuidraw::PainterAttributeData *m_fuzz_painter_data;
+
+    bool m_sizes_ready;
+    unsigned int m_num_attributes;
+    unsigned int m_largest_index_block;
+    unsigned int m_aa_largest_attribute_block;
+    unsigned int m_aa_largest_index_block;
+
+    /* m_sub_path is non-nullptr only if the SubsetPrivate
+     * has no children. In addition, it is set to nullptr
+     * and deleted when m_painter_data is created from
+     * it.
+     */
+    SubPath *m_sub_path;
+  };
+
   class SubsetPrivate
   {
   public:
@@ -980,8 +1057,8 @@ namespace
     fastuidraw::c_array<const int>
     winding_numbers(void)
     {
-      FASTUIDRAWassert(m_painter_data != nullptr);
-      return fastuidraw::make_c_array(m_winding_numbers);
+      FASTUIDRAWassert(m_data->m_painter_data != nullptr);
+      return fastuidraw::make_c_array(m_data->m_winding_numbers);
     }
 
     const fastuidraw::Path&
@@ -993,26 +1070,70 @@ namespace
     const fastuidraw::PainterAttributeData&
     painter_data(void)
     {
-      FASTUIDRAWassert(m_painter_data != nullptr);
-      return *m_painter_data;
+      FASTUIDRAWassert(m_data->m_painter_data != nullptr);
+      return *m_data->m_painter_data;
     }
 
     const fastuidraw::PainterAttributeData&
     fuzz_painter_data(void)
     {
-      FASTUIDRAWassert(m_fuzz_painter_data != nullptr);
-      return *m_fuzz_painter_data;
+      FASTUIDRAWassert(m_data->m_fuzz_painter_data != nullptr);
+      return *m_data->m_fuzz_painter_data;
     }
 
+    uint64_t
+    memory_usage(void) const;
+
+    const fastuidraw::BoundingBox<double>&
+    bounds(void) const
+    {
+      return m_bounds;
+    }
+
+    /* Create the SubsetPrivate (and its descendants) that fills
+     * P where P is the portion of a new path within the bounds
+     * of prev. The SubsetPrivate has the same bounds as prev;
+     * prev and those of its descendants whose bounds do not
+     * intersect an element of changed_regions fill the same as
+     * before, so the created SubsetPrivate objects share their
+     * data. P is deleted or taken over; prev is not modified.
+     */
     static
     SubsetPrivate*
-    create_root_subset(SubPath *P, std::vector<SubsetPrivate*> &out_values);
+    create_updated_subset(const SubsetPrivate &prev, SubPath *P,
+                          fastuidraw::c_array<const fastuidraw::BoundingBox<double> > changed_regions,
+                          FilledPathCounters *counters,
+                          std::vector<SubsetPrivate*> &out_values);
+
+    static
+    SubsetPrivate*
+    create_root_subset(SubPath *P, FilledPathCounters *counters,
+                       std::vector<SubsetPrivate*> &out_values);
 
   private:
 
-    SubsetPrivate(SubPath *P, int max_recursion,
+    SubsetPrivate(SubPath *P, int max_recursion, FilledPathCounters *counters,
                   std::vector<SubsetPrivate*> &out_value);
 
+    /* copy prev and its descendants, sharing their data */
+    SubsetPrivate(const SubsetPrivate &prev, FilledPathCounters *counters,
+                  std::vector<SubsetPrivate*> &out_values);
+
+    /* see create_updated_subset() */
+    SubsetPrivate(const SubsetPrivate &prev, SubPath *P,
+                  fastuidraw::c_array<const fastuidraw::BoundingBox<double> > changed_regions,
+                  FilledPathCounters *counters,
+                  std::vector<SubsetPrivate*> &out_values);
+
+    void
+    create_children(std::vector<SubsetPrivate*> &out_values);
+
+    bool
+    intersects_any(fastuidraw::c_array<const fastuidraw::BoundingBox<double> > regions) const;
+
+    unsigned int
+    number_subsets_in_hierarchy(void) const;
+
     void
     select_subsets_implement(ScratchSpacePrivate &scratch,
                              fastuidraw::c_array<unsigned int> dst,
@@ -1057,33 +1178,20 @@ namespace
     fastuidraw::BoundingBox<float> m_bounds_f;
     fastuidraw::Path m_bounding_path;
 
-    /* if this SubsetPrivate has children then
-     * m_painter_data is made by "merging" the
-     * data of m_painter_data from m_children[0]
-     * and m_children[1]. We do this merging so
-     * that we can avoid recursing if the entirity
-     * of the bounding box is contained in the
-     * clipping region.
-     */
-    fastuidraw::PainterAttributeData *m_painter_data;
-    std::vector<int> m_winding_numbers;
-
-    fastuidraw::PainterAttributeData *m_fuzz_painter_data;
-
-    bool m_sizes_ready;
-    unsigned int m_num_attributes;
-    unsigned int m_largest_index_block;
-    unsigned int m_aa_largest_attribute_block;
-    unsigned int m_aa_largest_index_block;
+    fastuidraw::reference_counted_ptr<SubsetData> m_data;
+    fastuidraw::vecN<SubsetPrivate*, 2> m_children;
 
-    /* m_sub_path is non-nullptr only if this SubsetPrivate
-     * has no children. In addition, it is set to nullptr
-     * and deleted when m_painter_data is created from
-     * it.
+    /* the half plane used to split m_bounds into the
+     * bounds of m_children, kept so that a FilledPath
+     * made from this one can split its path the same way.
      */
-    SubPath *m_sub_path;
-    fastuidraw::vecN<SubsetPrivate*, 2> m_children;
     int m_splitting_coordinate;
+    double m_splitting_value;
+
+    /* how many more levels of children may be created */
+    int m_max_recursion;
+
+    FilledPathCounters *m_counters;
   };
 
   class FilledPathPrivate
@@ -1092,10 +1200,30 @@ namespace
     explicit
     FilledPathPrivate(const fastuidraw::TessellatedPath &P);
 
+    FilledPathPrivate(const fastuidraw::TessellatedPath &P,
+                      const FilledPathPrivate &prev);
+
     ~FilledPathPrivate();
 
     SubsetPrivate *m_root;
     std::vector<SubsetPrivate*> m_subsets;
+    FilledPathCounters m_counters;
+
+    /* the contours of the path filled, used by a
+     * FilledPath made from this one to find what
+     * portions changed.
+     */
+    std::vector<SubPath::SubContour> m_contours;
+
+  private:
+    void
+    create_root(SubPath *P);
+
+    static
+    void
+    add_changed_region(const SubPath::SubContour &old_contour,
+                       const SubPath::SubContour &new_contour,
+                       std::vector<fastuidraw::BoundingBox<double> > *out_regions);
   };
 }
 
@@ -1214,9 +1342,14 @@ SubPath(const fastuidraw::BoundingBox<double> &bb,
 
 SubPath::
 SubPath(const fastuidraw::TessellatedPath &P):
+  SubPath(compute_bounds(P), P)
+{}
+
+SubPath::
+SubPath(const fastuidraw::BoundingBox<double> &bb,
+        const fastuidraw::TessellatedPath &P):
   m_num_points(0),
-  m_bounds(fastuidraw::dvec2(P.bounding_box_min() - 0.01 * P.bounding_box_size()),
-           fastuidraw::dvec2(P.bounding_box_max() + 0.01 * P.bounding_box_size())),
+  m_bounds(bb),
   m_contours(P.number_contours()),
   m_gen(0)
 {
@@ -1465,14 +1598,27 @@ split_contour(const SubContour &src,
     }
 }
 
+fastuidraw::BoundingBox<double>
+SubPath::
+compute_bounds(const fastuidraw::TessellatedPath &P)
+{
+  return fastuidraw::BoundingBox<double>(fastuidraw::dvec2(P.bounding_box_min() - 0.01 * P.bounding_box_size()),
+                                         fastuidraw::dvec2(P.bounding_box_max() + 0.01 * P.bounding_box_size()));
+}
+
 fastuidraw::vecN<SubPath*, 2>
 SubPath::
-split(int &splitting_coordinate) const
+split(int &splitting_coordinate, double &splitting_value) const
 {
-  fastuidraw::vecN<SubPath*, 2> return_value(nullptr, nullptr);
-  double mid_pt;
+  splitting_coordinate = choose_splitting_coordinate(splitting_value);
+  return split_at(splitting_coordinate, splitting_value);
+}
 
-  splitting_coordinate = choose_splitting_coordinate(mid_pt);
+fastuidraw::vecN<SubPath*, 2>
+SubPath::
+split_at(int splitting_coordinate, double mid_pt) const
+{
+  fastuidraw::vecN<SubPath*, 2> return_value(nullptr, nullptr);
 
   /* now split each contour. */
   fastuidraw::dvec2 B0_max, B1_min;
@@ -2701,43 +2847,53 @@ fill_data(fastuidraw::c_array<fastuidraw::PainterAttribute> attributes,
     }
 }
 
+/////////////////////////////////
+// SubsetData methods
+SubsetData::
+SubsetData(SubPath *Q):
+  m_painter_data(nullptr),
+  m_fuzz_painter_data(nullptr),
+  m_sizes_ready(false),
+  m_sub_path(Q)
+{}
+
+SubsetData::
+~SubsetData()
+{
+  if (m_sub_path != nullptr)
+    {
+      FASTUIDRAWassert(m_painter_data == nullptr);
+      FASTUIDRAWassert(m_fuzz_painter_data == nullptr);
+      FASTUIDRAWdelete(m_sub_path);
+    }
+
+  if (m_painter_data != nullptr)
+    {
+      FASTUIDRAWassert(m_sub_path == nullptr);
+      FASTUIDRAWassert(m_fuzz_painter_data != nullptr);
+      FASTUIDRAWdelete(m_painter_data);
+      FASTUIDRAWdelete(m_fuzz_painter_data);
+    }
+}
+
 /////////////////////////////////
 // SubsetPrivate methods
 SubsetPrivate::
-SubsetPrivate(SubPath *Q, int max_recursion,
+SubsetPrivate(SubPath *Q, int max_recursion, FilledPathCounters *counters,
               std::vector<SubsetPrivate*> &out_values):
   m_ID(out_values.size()),
   m_bounds(Q->bounds()),
   m_bounds_f(fastuidraw::vec2(m_bounds.min_point()),
              fastuidraw::vec2(m_bounds.max_point())),
-  m_painter_data(nullptr),
-  m_fuzz_painter_data(nullptr),
-  m_sizes_ready(false),
-  m_sub_path(Q),
+  m_data(FASTUIDRAWnew SubsetData(Q)),
   m_children(nullptr, nullptr),
-  m_splitting_coordinate(-1)
+  m_splitting_coordinate(-1),
+  m_splitting_value(0.0),
+  m_max_recursion(max_recursion),
+  m_counters(counters)
 {
   out_values.push_back(this);
-  if (max_recursion > 0
-      && m_sub_path->num_points() > SubsetConstants::points_per_subset)
-    {
-      fastuidraw::vecN<SubPath*, 2> C;
-
-      C = Q->split(m_splitting_coordinate);
-      if (C[0]->num_points() < m_sub_path->num_points()
-          || C[1]->num_points() < m_sub_path->num_points())
-        {
-          m_children[0] = FASTUIDRAWnew SubsetPrivate(C[0], max_recursion - 1, out_values);
-          m_children[1] = FASTUIDRAWnew SubsetPrivate(C[1], max_recursion - 1, out_values);
-          FASTUIDRAWdelete(m_sub_path);
-          m_sub_path = nullptr;
-        }
-      else
-        {
-          FASTUIDRAWdelete(C[0]);
-          FASTUIDRAWdelete(C[1]);
-        }
-    }
+  create_children(out_values);
 
   const fastuidraw::vec2 &m(m_bounds_f.min_point());
   const fastuidraw::vec2 &M(m_bounds_f.max_point());
@@ -2750,40 +2906,177 @@ SubsetPrivate(SubPath *Q, int max_recursion,
 }
 
 SubsetPrivate::
-~SubsetPrivate(void)
+SubsetPrivate(const SubsetPrivate &prev, FilledPathCounters *counters,
+              std::vector<SubsetPrivate*> &out_values):
+  m_ID(out_values.size()),
+  m_bounds(prev.m_bounds),
+  m_bounds_f(prev.m_bounds_f),
+  m_bounding_path(prev.m_bounding_path),
+  m_data(prev.m_data),
+  m_children(nullptr, nullptr),
+  m_splitting_coordinate(prev.m_splitting_coordinate),
+  m_splitting_value(prev.m_splitting_value),
+  m_max_recursion(prev.m_max_recursion),
+  m_counters(counters)
 {
-  if (m_sub_path != nullptr)
+  out_values.push_back(this);
+  if (prev.m_children[0] != nullptr)
     {
-      FASTUIDRAWassert(m_painter_data == nullptr);
-      FASTUIDRAWassert(m_fuzz_painter_data == nullptr);
-      FASTUIDRAWassert(m_children[0] == nullptr);
-      FASTUIDRAWassert(m_children[1] == nullptr);
-      FASTUIDRAWdelete(m_sub_path);
+      m_children[0] = FASTUIDRAWnew SubsetPrivate(*prev.m_children[0], counters, out_values);
+      m_children[1] = FASTUIDRAWnew SubsetPrivate(*prev.m_children[1], counters, out_values);
+    }
+}
+
+SubsetPrivate::
+SubsetPrivate(const SubsetPrivate &prev, SubPath *P,
+              fastuidraw::c_array<const fastuidraw::BoundingBox<double> > changed_regions,
+              FilledPathCounters *counters,
+              std::vector<SubsetPrivate*> &out_values):
+  m_ID(out_values.size()),
+  m_bounds(prev.m_bounds),
+  m_bounds_f(prev.m_bounds_f),
+  m_bounding_path(prev.m_bounding_path),
+  m_children(nullptr, nullptr),
+  m_splitting_coordinate(prev.m_splitting_coordinate),
+  m_splitting_value(prev.m_splitting_value),
+  m_max_recursion(prev.m_max_recursion),
+  m_counters(counters)
+{
+  out_values.push_back(this);
+
+  /* the data of this SubsetPrivate is either made from
+   * the changed portion of the path directly or merged
+   * from the data of a child that changes, so it is not
+   * shared with prev.
+   */
+  if (prev.m_children[0] == nullptr)
+    {
+      m_data = FASTUIDRAWnew SubsetData(P);
+
+      /* the new path may have enough points to warrant
+       * splitting.
+       */
+      create_children(out_values);
+      return;
     }
 
-  if (m_painter_data != nullptr)
+  /* split the new path the same way as prev so that the
+   * children of prev that do not change can be shared.
+   */
+  fastuidraw::vecN<SubPath*, 2> C;
+  C = P->split_at(m_splitting_coordinate, m_splitting_value);
+  FASTUIDRAWdelete(P);
+
+  m_data = FASTUIDRAWnew SubsetData(nullptr);
+  for(unsigned int i = 0; i < 2; ++i)
     {
-      FASTUIDRAWassert(m_sub_path == nullptr);
-      FASTUIDRAWassert(m_fuzz_painter_data != nullptr);
-      FASTUIDRAWdelete(m_painter_data);
-      FASTUIDRAWdelete(m_fuzz_painter_data);
+      m_children[i] = create_updated_subset(*prev.m_children[i], C[i],
+                                            changed_regions, counters,
+                                            out_values);
     }
+}
 
+SubsetPrivate::
+~SubsetPrivate(void)
+{
   if (m_children[0] != nullptr)
     {
-      FASTUIDRAWassert(m_sub_path == nullptr);
+      FASTUIDRAWassert(m_data->m_sub_path == nullptr);
       FASTUIDRAWassert(m_children[1] != nullptr);
       FASTUIDRAWdelete(m_children[0]);
       FASTUIDRAWdelete(m_children[1]);
     }
 }
 
+void
+SubsetPrivate::
+create_children(std::vector<SubsetPrivate*> &out_values)
+{
+  SubPath *sub_path(m_data->m_sub_path);
+
+  FASTUIDRAWassert(sub_path != nullptr);
+  FASTUIDRAWassert(m_children[0] == nullptr);
+  FASTUIDRAWassert(m_children[1] == nullptr);
+
+  if (m_max_recursion > 0
+      && sub_path->num_points() > SubsetConstants::points_per_subset)
+    {
+      fastuidraw::vecN<SubPath*, 2> C;
+
+      C = sub_path->split(m_splitting_coordinate, m_splitting_value);
+      if (C[0]->num_points() < sub_path->num_points()
+          || C[1]->num_points() < sub_path->num_points())
+        {
+          m_children[0] = FASTUIDRAWnew SubsetPrivate(C[0], m_max_recursion - 1, m_counters, out_values);
+          m_children[1] = FASTUIDRAWnew SubsetPrivate(C[1], m_max_recursion - 1, m_counters, out_values);
+          FASTUIDRAWdelete(sub_path);
+          m_data->m_sub_path = nullptr;
+        }
+      else
+        {
+          FASTUIDRAWdelete(C[0]);
+          FASTUIDRAWdelete(C[1]);
+        }
+    }
+}
+
+bool
+SubsetPrivate::
+intersects_any(fastuidraw::c_array<const fastuidraw::BoundingBox<double> > regions) const
+{
+  for(const fastuidraw::BoundingBox<double> &R : regions)
+    {
+      if (m_bounds.intersects(R))
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+unsigned int
+SubsetPrivate::
+number_subsets_in_hierarchy(void) const
+{
+  unsigned int return_value(1);
+  if (m_children[0] != nullptr)
+    {
+      return_value += m_children[0]->number_subsets_in_hierarchy();
+      return_value += m_children[1]->number_subsets_in_hierarchy();
+    }
+  return return_value;
+}
+
 SubsetPrivate*
 SubsetPrivate::
-create_root_subset(SubPath *P, std::vector<SubsetPrivate*> &out_values)
+create_updated_subset(const SubsetPrivate &prev, SubPath *P,
+                      fastuidraw::c_array<const fastuidraw::BoundingBox<double> > changed_regions,
+                      FilledPathCounters *counters,
+                      std::vector<SubsetPrivate*> &out_values)
+{
+  if (prev.intersects_any(changed_regions))
+    {
+      return FASTUIDRAWnew SubsetPrivate(prev, P, changed_regions, counters, out_values);
+    }
+
+  /* The edges and the winding numbers of the path only change
+   * within the changed regions, so a subset whose bounds do not
+   * intersect any changed region fills the same as before and
+   * can share its data with prev.
+   */
+  FASTUIDRAWdelete(P);
+  (*counters)[fastuidraw::FilledPath::reused_subsets_counter]
+    += prev.number_subsets_in_hierarchy();
+  return FASTUIDRAWnew SubsetPrivate(prev, counters, out_values);
+}
+
+SubsetPrivate*
+SubsetPrivate::
+create_root_subset(SubPath *P, FilledPathCounters *counters,
+                   std::vector<SubsetPrivate*> &out_values)
 {
   SubsetPrivate *root;
-  root = FASTUIDRAWnew SubsetPrivate(P, SubsetConstants::recursion_depth, out_values);
+  root = FASTUIDRAWnew SubsetPrivate(P, SubsetConstants::recursion_depth, counters, out_values);
   return root;
 }
 
@@ -2849,6 +3142,26 @@ select_subsets_implement(ScratchSpacePrivate &scratch,
   m_children[1]->select_subsets_implement(scratch, dst, max_attribute_cnt, max_index_cnt, current);
 }
 
+uint64_t
+SubsetPrivate::
+memory_usage(void) const
+{
+  uint64_t return_value;
+
+  return_value = m_data->m_winding_numbers.capacity() * sizeof(int);
+  if (m_data->m_painter_data)
+    {
+      return_value += m_data->m_painter_data->memory_usage();
+    }
+
+  if (m_data->m_fuzz_painter_data)
+    {
+      return_value += m_data->m_fuzz_painter_data->memory_usage();
+    }
+
+  return return_value;
+}
+
 void
 SubsetPrivate::
 select_subsets_all_unculled(fastuidraw::c_array<unsigned int> dst,
@@ -2856,20 +3169,20 @@ select_subsets_all_unculled(fastuidraw::c_array<unsigned int> dst,
                             unsigned int max_index_cnt,
                             unsigned int &current)
 {
-  if (!m_sizes_ready && m_children[0] == nullptr && m_sub_path != nullptr)
+  if (!m_data->m_sizes_ready && m_children[0] == nullptr && m_data->m_sub_path != nullptr)
     {
       /* we are going to need the attributes because
        * the element will be selected.
        */
       make_ready_from_sub_path();
-      FASTUIDRAWassert(m_painter_data != nullptr);
+      FASTUIDRAWassert(m_data->m_painter_data != nullptr);
     }
 
-  if (m_sizes_ready
-      && m_num_attributes <= max_attribute_cnt
-      && m_largest_index_block <= max_index_cnt
-      && m_aa_largest_attribute_block <= max_attribute_cnt
-      && m_aa_largest_index_block <= max_index_cnt)
+  if (m_data->m_sizes_ready
+      && m_data->m_num_attributes <= max_attribute_cnt
+      && m_data->m_largest_index_block <= max_index_cnt
+      && m_data->m_aa_largest_attribute_block <= max_attribute_cnt
+      && m_data->m_aa_largest_index_block <= max_index_cnt)
     {
       dst[current] = m_ID;
       ++current;
@@ -2878,14 +3191,14 @@ select_subsets_all_unculled(fastuidraw::c_array<unsigned int> dst,
     {
       m_children[0]->select_subsets_all_unculled(dst, max_attribute_cnt, max_index_cnt, current);
       m_children[1]->select_subsets_all_unculled(dst, max_attribute_cnt, max_index_cnt, current);
-      if (!m_sizes_ready)
+      if (!m_data->m_sizes_ready)
         {
           ready_sizes_from_children();
         }
     }
   else
     {
-      FASTUIDRAWassert(m_sizes_ready);
+      FASTUIDRAWassert(m_data->m_sizes_ready);
       FASTUIDRAWassert(!"Childless FilledPath::Subset has too many attributes or indices");
     }
 }
@@ -2896,33 +3209,33 @@ ready_sizes_from_children(void)
 {
   FASTUIDRAWassert(m_children[0] != nullptr);
   FASTUIDRAWassert(m_children[1] != nullptr);
-  FASTUIDRAWassert(!m_sizes_ready);
+  FASTUIDRAWassert(!m_data->m_sizes_ready);
 
-  m_sizes_ready = true;
-  FASTUIDRAWassert(m_children[0]->m_sizes_ready);
-  FASTUIDRAWassert(m_children[1]->m_sizes_ready);
-  m_num_attributes = m_children[0]->m_num_attributes + m_children[1]->m_num_attributes;
+  m_data->m_sizes_ready = true;
+  FASTUIDRAWassert(m_children[0]->m_data->m_sizes_ready);
+  FASTUIDRAWassert(m_children[1]->m_data->m_sizes_ready);
+  m_data->m_num_attributes = m_children[0]->m_data->m_num_attributes + m_children[1]->m_data->m_num_attributes;
 
   /* these are upper-bounds, they will get overwritten when the actual creation
    * of the attribute objects is done.
    */
-  m_largest_index_block =
-    m_children[0]->m_largest_index_block + m_children[1]->m_largest_index_block;
+  m_data->m_largest_index_block =
+    m_children[0]->m_data->m_largest_index_block + m_children[1]->m_data->m_largest_index_block;
 
-  m_aa_largest_attribute_block =
-    m_children[0]->m_aa_largest_attribute_block + m_children[1]->m_aa_largest_attribute_block;
+  m_data->m_aa_largest_attribute_block =
+    m_children[0]->m_data->m_aa_largest_attribute_block + m_children[1]->m_data->m_aa_largest_attribute_block;
 
-  m_aa_largest_index_block =
-    m_children[0]->m_aa_largest_index_block + m_children[1]->m_aa_largest_index_block;
+  m_data->m_aa_largest_index_block =
+    m_children[0]->m_data->m_aa_largest_index_block + m_children[1]->m_data->m_aa_largest_index_block;
 }
 
 void
 SubsetPrivate::
 make_ready(void)
 {
-  if (m_painter_data == nullptr)
+  if (m_data->m_painter_data == nullptr)
     {
-      if (m_sub_path != nullptr)
+      if (m_data->m_sub_path != nullptr)
         {
           make_ready_from_sub_path();
         }
@@ -2953,33 +3266,34 @@ make_ready_from_children(void)
 {
   FASTUIDRAWassert(m_children[0] != nullptr);
   FASTUIDRAWassert(m_children[1] != nullptr);
-  FASTUIDRAWassert(m_sub_path == nullptr);
-  FASTUIDRAWassert(m_painter_data == nullptr);
+  FASTUIDRAWassert(m_data->m_sub_path == nullptr);
+  FASTUIDRAWassert(m_data->m_painter_data == nullptr);
 
   m_children[0]->make_ready();
   m_children[1]->make_ready();
 
+  ScopedTimer timer((*m_counters)[fastuidraw::FilledPath::build_time_us_counter]);
   FillAttributeDataMerger merger(m_children[0]->painter_data(),
                                  m_children[1]->painter_data());
 
-  m_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
-  m_painter_data->set_data(merger);
+  m_data->m_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_data->m_painter_data->set_data(merger);
 
   merge_winding_lists(m_children[0]->winding_numbers(),
                       m_children[1]->winding_numbers(),
-                      &m_winding_numbers);
+                      &m_data->m_winding_numbers);
 
-  m_fuzz_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_data->m_fuzz_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
   EdgeAttributeDataMerger fuzz_merger(m_children[0]->fuzz_painter_data(),
                                       m_children[1]->fuzz_painter_data());
-  m_fuzz_painter_data->set_data(fuzz_merger);
+  m_data->m_fuzz_painter_data->set_data(fuzz_merger);
 
   /* overwrite size values to be precise */
-  m_sizes_ready = true;
-  m_num_attributes = m_painter_data->largest_attribute_chunk();
-  m_largest_index_block = m_painter_data->largest_index_chunk();
-  m_aa_largest_attribute_block = m_fuzz_painter_data->largest_attribute_chunk();
-  m_aa_largest_index_block = m_fuzz_painter_data->largest_index_chunk();
+  m_data->m_sizes_ready = true;
+  m_data->m_num_attributes = m_data->m_painter_data->largest_attribute_chunk();
+  m_data->m_largest_index_block = m_data->m_painter_data->largest_index_chunk();
+  m_data->m_aa_largest_attribute_block = m_data->m_fuzz_painter_data->largest_attribute_chunk();
+  m_data->m_aa_largest_index_block = m_data->m_fuzz_painter_data->largest_index_chunk();
 }
 
 void
@@ -2988,12 +3302,15 @@ make_ready_from_sub_path(void)
 {
   FASTUIDRAWassert(m_children[0] == nullptr);
   FASTUIDRAWassert(m_children[1] == nullptr);
-  FASTUIDRAWassert(m_sub_path != nullptr);
-  FASTUIDRAWassert(m_painter_data == nullptr);
-  FASTUIDRAWassert(!m_sizes_ready);
+  FASTUIDRAWassert(m_data->m_sub_path != nullptr);
+  FASTUIDRAWassert(m_data->m_painter_data == nullptr);
+  FASTUIDRAWassert(!m_data->m_sizes_ready);
+
+  ScopedTimer timer((*m_counters)[fastuidraw::FilledPath::build_time_us_counter]);
+  ++(*m_counters)[fastuidraw::FilledPath::triangulated_subsets_counter];
 
   FillAttributeDataFiller filler;
-  builder B(*m_sub_path, filler.m_points);
+  builder B(*m_data->m_sub_path, filler.m_points);
   unsigned int even_non_zero_start, zero_start;
   unsigned int m1, m2;
 
@@ -3006,38 +3323,40 @@ make_ready_from_sub_path(void)
   filler.m_even_winding_indices = indices_ptr.sub_array(even_non_zero_start);
   filler.m_zero_winding_indices = indices_ptr.sub_array(zero_start);
 
-  m_sizes_ready = true;
+  m_data->m_sizes_ready = true;
   m1 = fastuidraw::t_max(filler.m_nonzero_winding_indices.size(),
                          filler.m_zero_winding_indices.size());
   m2 = fastuidraw::t_max(filler.m_odd_winding_indices.size(),
                          filler.m_even_winding_indices.size());
-  m_largest_index_block = fastuidraw::t_max(m1, m2);
-  m_num_attributes = filler.m_points.size();
+  m_data->m_largest_index_block = fastuidraw::t_max(m1, m2);
+  m_data->m_num_attributes = filler.m_points.size();
 
-  m_winding_numbers.reserve(filler.m_per_fill.size());
+  m_data->m_winding_numbers.reserve(filler.m_per_fill.size());
   for(const auto & e : filler.m_per_fill)
     {
       FASTUIDRAWassert(!e.second.empty());
-      m_winding_numbers.push_back(e.first);
+      m_data->m_winding_numbers.push_back(e.first);
     }
 
   /* now fill m_painter_data. */
-  m_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
-  m_painter_data->set_data(filler);
+  m_data->m_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_data->m_painter_data->set_data(filler);
 
   /* fill m_fuzz_painter_data */
-  m_fuzz_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
-  if (!m_winding_numbers.empty())
+  m_data->m_fuzz_painter_data = FASTUIDRAWnew fastuidraw::PainterAttributeData();
+  m_data->m_aa_largest_attribute_block = 0;
+  m_data->m_aa_largest_index_block = 0;
+  if (!m_data->m_winding_numbers.empty())
     {
-      AAFuzzAttributeDataFiller edge_filler(fastuidraw::make_c_array(m_winding_numbers),
+      AAFuzzAttributeDataFiller edge_filler(fastuidraw::make_c_array(m_data->m_winding_numbers),
                                             &filler.m_points, &B);
-      m_fuzz_painter_data->set_data(edge_filler);
-      m_aa_largest_attribute_block = m_fuzz_painter_data->largest_attribute_chunk();
-      m_aa_largest_index_block = m_fuzz_painter_data->largest_index_chunk();
+      m_data->m_fuzz_painter_data->set_data(edge_filler);
+      m_data->m_aa_largest_attribute_block = m_data->m_fuzz_painter_data->largest_attribute_chunk();
+      m_data->m_aa_largest_index_block = m_data->m_fuzz_painter_data->largest_index_chunk();
     }
 
-  FASTUIDRAWdelete(m_sub_path);
-  m_sub_path = nullptr;
+  FASTUIDRAWdelete(m_data->m_sub_path);
+  m_data->m_sub_path = nullptr;
 
   #ifdef FASTUIDRAW_DEBUG
     {
@@ -3057,11 +3376,50 @@ make_ready_from_sub_path(void)
 /////////////////////////////////
 // FilledPathPrivate methods
 FilledPathPrivate::
-FilledPathPrivate(const fastuidraw::TessellatedPath &P)
+FilledPathPrivate(const fastuidraw::TessellatedPath &P):
+  m_root(nullptr),
+  m_counters(0u)
 {
+  create_root(FASTUIDRAWnew SubPath(P));
+}
+
+FilledPathPrivate::
+FilledPathPrivate(const fastuidraw::TessellatedPath &P,
+                  const FilledPathPrivate &prev):
+  m_root(nullptr),
+  m_counters(0u)
+{
+  ScopedTimer timer(m_counters[fastuidraw::FilledPath::update_time_us_counter]);
+  fastuidraw::BoundingBox<double> bb;
+  std::vector<fastuidraw::BoundingBox<double> > changed_regions;
   SubPath *q;
-  q = FASTUIDRAWnew SubPath(P);
-  m_root = SubsetPrivate::create_root_subset(q, m_subsets);
+
+  bb.union_point(fastuidraw::dvec2(P.bounding_box_min()));
+  bb.union_point(fastuidraw::dvec2(P.bounding_box_max()));
+  if (!prev.m_root->bounds().contains(bb))
+    {
+      /* the hierarchy of prev does not cover the new path */
+      create_root(FASTUIDRAWnew SubPath(P));
+      return;
+    }
+
+  /* the new path must be split with the same bounds
+   * as the hierarchy of prev.
+   */
+  q = FASTUIDRAWnew SubPath(prev.m_root->bounds(), P);
+  m_contours = q->contours();
+
+  for(unsigned int c = 0, endc = fastuidraw::t_max(prev.m_contours.size(), m_contours.size()); c < endc; ++c)
+    {
+      static const SubPath::SubContour empty_contour;
+      add_changed_region((c < prev.m_contours.size()) ? prev.m_contours[c] : empty_contour,
+                         (c < m_contours.size()) ? m_contours[c] : empty_contour,
+                         &changed_regions);
+    }
+
+  m_root = SubsetPrivate::create_updated_subset(*prev.m_root, q,
+                                                fastuidraw::make_c_array(changed_regions),
+                                                &m_counters, m_subsets);
 }
 
 FilledPathPrivate::
@@ -3070,6 +3428,62 @@ FilledPathPrivate::
   FASTUIDRAWdelete(m_root);
 }
 
+void
+FilledPathPrivate::
+create_root(SubPath *P)
+{
+  FASTUIDRAWassert(m_root == nullptr);
+  m_contours = P->contours();
+  m_root = SubsetPrivate::create_root_subset(P, &m_counters, m_subsets);
+}
+
+void
+FilledPathPrivate::
+add_changed_region(const SubPath::SubContour &old_contour,
+                   const SubPath::SubContour &new_contour,
+                   std::vector<fastuidraw::BoundingBox<double> > *out_regions)
+{
+  unsigned int prefix, suffix, max_common;
+  fastuidraw::BoundingBox<double> R;
+
+  /* find the points common to the start and end of both
+   * contours; only the edges between them changed.
+   */
+  max_common = fastuidraw::t_min(old_contour.size(), new_contour.size());
+  for(prefix = 0; prefix < max_common && old_contour[prefix] == new_contour[prefix]; ++prefix)
+    {}
+
+  if (prefix == old_contour.size() && prefix == new_contour.size())
+    {
+      return;
+    }
+
+  for(suffix = 0;
+      prefix + suffix < max_common
+        && old_contour[old_contour.size() - 1 - suffix] == new_contour[new_contour.size() - 1 - suffix];
+      ++suffix)
+    {}
+
+  /* The winding number only changes within the region between
+   * the old and new edges, which is contained in the bounding box
+   * of the old and new edges together. The changed edges start at
+   * the last point of the prefix and end at the first point of the
+   * suffix; if either is empty, the changed edges include the edge
+   * closing the contour, so just take the entire contours.
+   */
+  if (prefix == 0 || suffix == 0)
+    {
+      R.union_points(old_contour.begin(), old_contour.end());
+      R.union_points(new_contour.begin(), new_contour.end());
+    }
+  else
+    {
+      R.union_points(old_contour.begin() + prefix - 1, old_contour.end() - suffix + 1);
+      R.union_points(new_contour.begin() + prefix - 1, new_contour.end() - suffix + 1);
+    }
+  out_regions->push_back(R);
+}
+
 ///////////////////////////////
 //fastuidraw::FilledPath::ScratchSpace methods
 fastuidraw::FilledPath::ScratchSpace::
@@ -3183,6 +3597,48 @@ fastuidraw::FilledPath::
   m_d = nullptr;
 }
 
+fastuidraw::FilledPath::
+FilledPath(const TessellatedPath &P, const FilledPath &prev)
+{
+  const FilledPathPrivate *prev_d;
+  prev_d = static_cast<const FilledPathPrivate*>(prev.m_d);
+  m_d = FASTUIDRAWnew FilledPathPrivate(P, *prev_d);
+}
+
+uint64_t
+fastuidraw::FilledPath::
+counter(enum counter_t tp) const
+{
+  FilledPathPrivate *d;
+  d = static_cast<FilledPathPrivate*>(m_d);
+  FASTUIDRAWassert(tp < number_counters);
+  return d->m_counters[tp];
+}
+
+void
+fastuidraw::FilledPath::
+reset_counters(void)
+{
+  FilledPathPrivate *d;
+  d = static_cast<FilledPathPrivate*>(m_d);
+  d->m_counters = FilledPathCounters(0u);
+}
+
+uint64_t
+fastuidraw::FilledPath::
+memory_usage(void) const
+{
+  FilledPathPrivate *d;
+  uint64_t return_value(0u);
+
+  d = static_cast<FilledPathPrivate*>(m_d);
+  for(const SubsetPrivate *s : d->m_subsets)
+    {
+      return_value += s->memory_usage();
+    }
+  return return_value;
+}
+
 unsigned int
 fastuidraw::FilledPath::
 number_subsets(void) const
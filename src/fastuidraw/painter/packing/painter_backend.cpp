@@ -265,6 +265,7 @@ register_shader(const PainterShaderSet &shaders)
   register_shader(shaders.stroke_shader());
   register_shader(shaders.dashed_stroke_shader());
   register_shader(shaders.fill_shader());
+  register_shader(shaders.rounded_rect_shader());
   register_shader(shaders.glyph_shader());
   register_shader(shaders.glyph_shader_anisotropic());
   register_shader(shaders.blend_shaders());
@@ -305,6 +306,15 @@ register_shader(const PainterFillShader &p)
   register_shader(p.aa_fuzz_shader());
 }
 
+void
+fastuidraw::PainterBackend::
+register_shader(const PainterRoundedRectShader &p)
+{
+  register_shader(p.item_shader());
+  register_shader(p.clip_inside_shader());
+  register_shader(p.clip_outside_shader());
+}
+
 void
 fastuidraw::PainterBackend::
 register_shader(const PainterDashedStrokeShaderSet &p)
@@ -38,6 +38,7 @@ namespace
       m_map_status(status_mapped),
       m_action_count(0),
       m_attribs_written(0),
+      m_compact_attribs_written(0),
       m_indices_written(0),
       m_data_store_written(0),
       m_p(p)
@@ -46,7 +47,8 @@ namespace
     enum map_status_t m_map_status;
     unsigned int m_action_count;
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PainterDraw::DelayedAction> > m_actions;
-    unsigned int m_attribs_written, m_indices_written, m_data_store_written;
+    unsigned int m_attribs_written, m_compact_attribs_written;
+    unsigned int m_indices_written, m_data_store_written;
     fastuidraw::PainterDraw *m_p;
   };
 
@@ -122,6 +124,16 @@ fastuidraw::PainterDraw::
   m_d = nullptr;
 }
 
+void
+fastuidraw::PainterDraw::
+index_width_break(unsigned int) const
+{}
+
+void
+fastuidraw::PainterDraw::
+attribute_format_break(bool, unsigned int) const
+{}
+
 void
 fastuidraw::PainterDraw::
 add_action(const reference_counted_ptr<DelayedAction> &h) const
@@ -146,6 +158,7 @@ add_action(const reference_counted_ptr<DelayedAction> &h) const
 void
 fastuidraw::PainterDraw::
 unmap(unsigned int attributes_written,
+      unsigned int compact_attributes_written,
       unsigned int indices_written,
       unsigned int data_store_written) const
 {
@@ -155,6 +168,7 @@ unmap(unsigned int attributes_written,
   FASTUIDRAWassert(d->m_map_status == status_mapped);
 
   d->m_attribs_written = attributes_written;
+  d->m_compact_attribs_written = compact_attributes_written;
   d->m_indices_written = indices_written;
   d->m_data_store_written = data_store_written;
   d->m_map_status = status_waiting_for_actions_to_complete;
@@ -173,7 +187,8 @@ complete_unmapping(void) const
 
   FASTUIDRAWassert(d->m_map_status == status_waiting_for_actions_to_complete);
   FASTUIDRAWassert(d->m_action_count == 0);
-  unmap_implement(d->m_attribs_written, d->m_indices_written, d->m_data_store_written);
+  unmap_implement(d->m_attribs_written, d->m_compact_attribs_written,
+                  d->m_indices_written, d->m_data_store_written);
   d->m_map_status = status_unmapped;
 }
 
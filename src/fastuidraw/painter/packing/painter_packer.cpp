@@ -21,9 +21,15 @@
 #include <vector>
 #include <list>
 #include <cstring>
+#include <algorithm>
+#include <atomic>
 
 #include <fastuidraw/painter/packing/painter_packer.hpp>
 #include <fastuidraw/painter/painter_header.hpp>
+#include <fastuidraw/painter/painter_item_matrix.hpp>
+#include <fastuidraw/painter/painter_clip_equations.hpp>
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/util/reference_count_atomic.hpp>
 #include "../../private/util_private.hpp"
 
 namespace
@@ -67,6 +73,11 @@ namespace
       PainterShaderGroupValues(obj)
     {}
 
+    explicit
+    PainterShaderGroupPrivate(const PainterShaderGroupValues &obj):
+      PainterShaderGroupValues(obj)
+    {}
+
     void
     operator=(const PainterShaderGroupPrivate &obj)
     {
@@ -74,10 +85,348 @@ namespace
     }
   };
 
-  /* QUESTION
-   *  - does the reference count to a pool need to be thread safe?
+  /* Host memory backing a HostPainterDraw; the arrays are
+   * allocated with new[] so that pages that are never written
+   * to are never touched.
+   */
+  class HostBufferSet:fastuidraw::noncopyable
+  {
+  public:
+    HostBufferSet(unsigned int num_attributes,
+                  unsigned int num_indices,
+                  unsigned int num_store):
+      m_attributes(FASTUIDRAWnew fastuidraw::PainterAttribute[num_attributes], num_attributes),
+      m_header_attributes(FASTUIDRAWnew uint32_t[num_attributes], num_attributes),
+      m_indices(FASTUIDRAWnew fastuidraw::PainterIndex[num_indices], num_indices),
+      m_store(FASTUIDRAWnew fastuidraw::generic_data[num_store], num_store)
+    {}
+
+    ~HostBufferSet()
+    {
+      FASTUIDRAWdelete_array(m_attributes.c_ptr());
+      FASTUIDRAWdelete_array(m_header_attributes.c_ptr());
+      FASTUIDRAWdelete_array(m_indices.c_ptr());
+      FASTUIDRAWdelete_array(m_store.c_ptr());
+    }
+
+    fastuidraw::c_array<fastuidraw::PainterAttribute> m_attributes;
+    fastuidraw::c_array<uint32_t> m_header_attributes;
+    fastuidraw::c_array<fastuidraw::PainterIndex> m_indices;
+    fastuidraw::c_array<fastuidraw::generic_data> m_store;
+  };
+
+  /* The pool is only ever accessed by the thread recording
+   * into the PainterPacker that owns it.
+   */
+  class HostBufferPool:public fastuidraw::reference_counted<HostBufferPool>::non_concurrent
+  {
+  public:
+    HostBufferPool(unsigned int num_attributes,
+                   unsigned int num_indices,
+                   unsigned int num_store):
+      m_num_attributes(num_attributes),
+      m_num_indices(num_indices),
+      m_num_store(num_store)
+    {}
+
+    ~HostBufferPool()
+    {
+      for(HostBufferSet *p : m_free)
+        {
+          FASTUIDRAWdelete(p);
+        }
+    }
+
+    HostBufferSet*
+    acquire(void)
+    {
+      HostBufferSet *return_value;
+      if (m_free.empty())
+        {
+          return_value = FASTUIDRAWnew HostBufferSet(m_num_attributes, m_num_indices, m_num_store);
+        }
+      else
+        {
+          return_value = m_free.back();
+          m_free.pop_back();
+        }
+      return return_value;
+    }
+
+    void
+    release(HostBufferSet *p)
+    {
+      m_free.push_back(p);
+    }
+
+    unsigned int
+    num_store(void) const
+    {
+      return m_num_store;
+    }
+
+  private:
+    unsigned int m_num_attributes, m_num_indices, m_num_store;
+    std::vector<HostBufferSet*> m_free;
+  };
+
+  /* A HostPainterDraw is what a PainterPacker records into
+   * between begin_sub() and end(). Instead of issuing draw
+   * breaks, it records the location of each header and each
+   * action in the order they are added so that the content
+   * can be relocated and replayed into another PainterDraw.
+   */
+  class HostPainterDraw:public fastuidraw::PainterDraw
+  {
+  public:
+    class event
+    {
+    public:
+      /* number of indices written when the event was added */
+      unsigned int m_indices_written;
+
+      /* if non-null, the event is an action break, otherwise
+       * it is the adding of a header at m_header_location
+       * whose shader groups are m_groups.
+       */
+      fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw::Action> m_action;
+      unsigned int m_header_location;
+      PainterShaderGroupValues m_groups;
+    };
+
+    explicit
+    HostPainterDraw(const fastuidraw::reference_counted_ptr<HostBufferPool> &pool):
+      m_pool(pool),
+      m_buffers(pool->acquire())
+    {
+      m_attributes = m_buffers->m_attributes;
+      m_header_attributes = m_buffers->m_header_attributes;
+      m_indices = m_buffers->m_indices;
+      m_store = m_buffers->m_store;
+
+      /* m_compact_attributes is left empty: the recorded
+       * content is appended to PainterDraw objects that
+       * may not support compact attributes.
+       */
+    }
+
+    ~HostPainterDraw()
+    {
+      m_pool->release(m_buffers);
+    }
+
+    virtual
+    void
+    draw_break(const fastuidraw::PainterShaderGroup&,
+               const fastuidraw::PainterShaderGroup&,
+               unsigned int) const
+    {
+      FASTUIDRAWassert(!"HostPainterDraw records headers with add_header() instead");
+    }
+
+    virtual
+    void
+    draw_break(const fastuidraw::reference_counted_ptr<const Action> &action,
+               unsigned int indices_written) const
+    {
+      event E;
+
+      FASTUIDRAWassert(action);
+      E.m_indices_written = indices_written;
+      E.m_action = action;
+      E.m_header_location = 0;
+      m_events.push_back(E);
+    }
+
+    void
+    add_header(unsigned int location, const PainterShaderGroupValues &groups,
+               unsigned int indices_written) const
+    {
+      event E;
+
+      E.m_indices_written = indices_written;
+      E.m_header_location = location;
+      E.m_groups = groups;
+      m_events.push_back(E);
+    }
+
+    virtual
+    void
+    draw(void) const
+    {
+      FASTUIDRAWassert(!"HostPainterDraw cannot be drawn, it must be submitted");
+    }
+
+    mutable std::vector<event> m_events;
+
+  protected:
+    virtual
+    void
+    unmap_implement(unsigned int, unsigned int, unsigned int, unsigned int) const
+    {}
+
+  private:
+    fastuidraw::reference_counted_ptr<HostBufferPool> m_pool;
+    HostBufferSet *m_buffers;
+  };
+
+  /* What content recorded between begin_sub() and end() uses
+   * besides the actions of its events: the images and color
+   * stop sequences of the brushes, whose atlas locations are
+   * packed into the data store, and the glyphs whose atlas
+   * locations are packed into the attributes. A
+   * PainterDisplayList keeps these alive.
+   */
+  class RetainedResources
+  {
+  public:
+    void
+    add_brush(const fastuidraw::PainterBrush &brush)
+    {
+      /* consecutive draws typically use the same brush */
+      if (brush.image() && (m_images.empty() || m_images.back() != brush.image()))
+        {
+          m_images.push_back(brush.image());
+        }
+
+      if (brush.color_stops() && (m_color_stops.empty() || m_color_stops.back() != brush.color_stops()))
+        {
+          m_color_stops.push_back(brush.color_stops());
+        }
+    }
+
+    void
+    add_glyphs(fastuidraw::c_array<const fastuidraw::Glyph> glyphs)
+    {
+      m_glyphs.insert(m_glyphs.end(), glyphs.begin(), glyphs.end());
+    }
+
+    void
+    add(const RetainedResources &obj)
+    {
+      m_images.insert(m_images.end(), obj.m_images.begin(), obj.m_images.end());
+      m_color_stops.insert(m_color_stops.end(), obj.m_color_stops.begin(), obj.m_color_stops.end());
+      m_glyphs.insert(m_glyphs.end(), obj.m_glyphs.begin(), obj.m_glyphs.end());
+    }
+
+    void
+    clear(void)
+    {
+      m_images.clear();
+      m_color_stops.clear();
+      m_glyphs.clear();
+    }
+
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::Image> > m_images;
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::ColorStopSequenceOnAtlas> > m_color_stops;
+    std::vector<fastuidraw::Glyph> m_glyphs;
+  };
+
+  /* View of content recorded into a HostPainterDraw or
+   * of such content copied into a PainterDisplayList.
+   */
+  class RecordedContent
+  {
+  public:
+    fastuidraw::c_array<const fastuidraw::PainterAttribute> m_attributes;
+    fastuidraw::c_array<const uint32_t> m_header_attributes;
+    fastuidraw::c_array<const fastuidraw::PainterIndex> m_indices;
+    fastuidraw::c_array<const fastuidraw::generic_data> m_store;
+    fastuidraw::c_array<const HostPainterDraw::event> m_events;
+
+    /* the item matrix locations of the headers without
+     * duplicates; only read when appending with a ReplayPatch.
+     */
+    fastuidraw::c_array<const unsigned int> m_item_matrix_locations;
+  };
+
+  /* what to change of recorded content when drawing a PainterDisplayList */
+  class ReplayPatch
+  {
+  public:
+    /* matrix by which to pre-multiply each item matrix */
+    fastuidraw::float3x3 m_item_matrix;
+
+    /* clip equations to use for all headers */
+    fastuidraw::PainterClipEquations m_clip;
+  };
+
+  /* content of one per_draw_command copied into exactly
+   * sized arrays for a PainterDisplayList.
    */
-  class PoolBase:public fastuidraw::reference_counted<PoolBase>::non_concurrent
+  class DisplayListSegment
+  {
+  public:
+    RecordedContent
+    content(void) const
+    {
+      RecordedContent R;
+
+      R.m_attributes = fastuidraw::make_c_array(m_attributes);
+      R.m_header_attributes = fastuidraw::make_c_array(m_header_attributes);
+      R.m_indices = fastuidraw::make_c_array(m_indices);
+      R.m_store = fastuidraw::make_c_array(m_store);
+      R.m_events = fastuidraw::make_c_array(m_events);
+      R.m_item_matrix_locations = fastuidraw::make_c_array(m_item_matrix_locations);
+      return R;
+    }
+
+    std::vector<fastuidraw::PainterAttribute> m_attributes;
+    std::vector<uint32_t> m_header_attributes;
+    std::vector<fastuidraw::PainterIndex> m_indices;
+    std::vector<fastuidraw::generic_data> m_store;
+    std::vector<HostPainterDraw::event> m_events;
+    std::vector<unsigned int> m_item_matrix_locations;
+  };
+
+  class PainterDisplayListPrivate
+  {
+  public:
+    PainterDisplayListPrivate(void):
+      m_backend(nullptr),
+      m_number_z(0),
+      m_number_headers(0),
+      m_number_attributes(0),
+      m_number_indices(0),
+      m_number_generic_datas(0)
+    {}
+
+    ~PainterDisplayListPrivate()
+    {
+      for(const fastuidraw::Glyph &G : m_resources.m_glyphs)
+        {
+          G.unpin();
+        }
+    }
+
+    std::vector<DisplayListSegment> m_segments;
+
+    /* the glyphs of m_resources are pinned for the lifetime
+     * of the list; m_glyph_caches keeps their caches alive so
+     * that they can be unpinned.
+     */
+    RetainedResources m_resources;
+    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> > m_glyph_caches;
+    const fastuidraw::PainterBackend *m_backend;
+    fastuidraw::float3x3 m_base_item_matrix;
+    fastuidraw::float3x3 m_base_item_matrix_inverse;
+    int m_number_z;
+    unsigned int m_number_headers;
+    unsigned int m_number_attributes;
+    unsigned int m_number_indices;
+    unsigned int m_number_generic_datas;
+  };
+
+  /* A PoolBase holds pool_size slots; the free slots form a
+   * lock-free stack (Treiber stack) so that slots can be
+   * acquired and released concurrently from several threads.
+   * The head of the stack packs the top slot (offset by one
+   * so that 0 means empty) in the low 32-bits and a tag that
+   * is incremented on each change in the high 32-bits; the tag
+   * prevents the ABA problem when a slot is popped and pushed
+   * back between the load and compare-exchange of another thread.
+   */
+  class PoolBase:public fastuidraw::reference_counted<PoolBase>::default_base
   {
   public:
     enum
@@ -85,69 +434,114 @@ namespace
         pool_size = 1024
       };
 
-    PoolBase(void):
-      m_free_slots_back(pool_size - 1)
+    PoolBase(void)
     {
+      /* slot i links to slot i + 1, the last slot ends the stack */
       for(unsigned int i = 0; i < pool_size; ++i)
         {
-          m_free_slots[i] = pool_size - 1 - i;
+          m_next[i].store(i + 2 <= pool_size ? i + 2 : 0, std::memory_order_relaxed);
+        }
+      m_head.store(pack_head(1u, 0u), std::memory_order_relaxed);
+
+      #ifdef FASTUIDRAW_DEBUG
+        {
+          m_number_free.store(pool_size, std::memory_order_relaxed);
         }
+      #endif
     }
 
     ~PoolBase()
     {
-      FASTUIDRAWassert(m_free_slots_back == pool_size - 1);
+      #ifdef FASTUIDRAW_DEBUG
+        {
+          FASTUIDRAWassert(m_number_free.load() == pool_size);
+        }
+      #endif
     }
 
     int
     aquire_slot(void)
     {
-      /* Should we make this thread safe? We can make it
-       * thread safe by using atomic operation on m_free_slots_back.
-       * The following code would make it thread safe.
-       *
-       * return_value = m_free_slots_back.fetch_sub(1, std::memory_order_aquire)
-       * if (return_value < 0)
-       *   {
-       *      m_free_slots_back.fetch_add(1, std::memory_order_aquire);
-       *   }
-       * return return_value;
-       */
-      int return_value(-1);
+      uint64_t old_head, new_head;
+      uint32_t top;
 
-      if (m_free_slots_back >= 0)
+      old_head = m_head.load(std::memory_order_acquire);
+      do
         {
-          return_value = m_free_slots[m_free_slots_back];
-          --m_free_slots_back;
+          top = unpack_top(old_head);
+          if (top == 0u)
+            {
+              return -1;
+            }
+          new_head = pack_head(m_next[top - 1u].load(std::memory_order_relaxed),
+                               unpack_tag(old_head) + 1u);
         }
-      return return_value;
+      while(!m_head.compare_exchange_weak(old_head, new_head,
+                                          std::memory_order_acquire,
+                                          std::memory_order_acquire));
+
+      #ifdef FASTUIDRAW_DEBUG
+        {
+          m_number_free.fetch_sub(1, std::memory_order_relaxed);
+        }
+      #endif
+
+      return top - 1u;
     }
 
     void
     release_slot(int v)
     {
-      /* Should we make this thread safe? We can make it
-       * thread safe by using atomic operation on m_free_slots_back.
-       * The following code would make it thread safe.
-       *
-       * int S;
-       * S = m_free_slots_back.fetch_add(1, std::memory_order_release);
-       * std::atomic_thread_fence(std::memory_order_acquire);
-       * FASTUIDRAWassert(S < pool_size);
-       * m_free_slots[S] = v;
-       */
+      uint64_t old_head, new_head;
+
       FASTUIDRAWassert(v >= 0);
       FASTUIDRAWassert(v < pool_size);
 
-      ++m_free_slots_back;
+      #ifdef FASTUIDRAW_DEBUG
+        {
+          FASTUIDRAWassert(m_number_free.fetch_add(1, std::memory_order_relaxed) < pool_size);
+        }
+      #endif
 
-      FASTUIDRAWassert(m_free_slots_back < pool_size);
-      m_free_slots[m_free_slots_back] = v;
+      old_head = m_head.load(std::memory_order_relaxed);
+      do
+        {
+          m_next[v].store(unpack_top(old_head), std::memory_order_relaxed);
+          new_head = pack_head(v + 1u, unpack_tag(old_head) + 1u);
+        }
+      while(!m_head.compare_exchange_weak(old_head, new_head,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
     }
 
   private:
-    int m_free_slots_back;
-    fastuidraw::vecN<int, pool_size> m_free_slots;
+    static
+    uint64_t
+    pack_head(uint32_t top, uint32_t tag)
+    {
+      return uint64_t(top) | (uint64_t(tag) << 32u);
+    }
+
+    static
+    uint32_t
+    unpack_top(uint64_t v)
+    {
+      return uint32_t(v & 0xFFFFFFFFu);
+    }
+
+    static
+    uint32_t
+    unpack_tag(uint64_t v)
+    {
+      return uint32_t(v >> 32u);
+    }
+
+    std::atomic<uint64_t> m_head;
+    fastuidraw::vecN<std::atomic<uint32_t>, pool_size> m_next;
+
+    #ifdef FASTUIDRAW_DEBUG
+    std::atomic<int> m_number_free;
+    #endif
   };
 
   class EntryBase
@@ -174,9 +568,17 @@ namespace
       FASTUIDRAWassert(m_pool_slot >= 0);
       if (m_count.remove_reference())
         {
-          m_pool->release_slot(m_pool_slot);
+          /* the slot can be handed out by another thread as
+           * soon as it is released, so clear the fields before
+           * releasing it; the local reference keeps the pool
+           * (and thus this Entry) alive until after release_slot().
+           */
+          fastuidraw::reference_counted_ptr<PoolBase> pool;
+          int slot(m_pool_slot);
+
+          pool.swap(m_pool);
           m_pool_slot = -1;
-          m_pool = nullptr;
+          pool->release_slot(slot);
         }
     }
 
@@ -187,7 +589,9 @@ namespace
     }
 
     /* To what painter and where in data store buffer
-     * already packed into PainterDraw::m_store
+     * already packed into PainterDraw::m_store; these
+     * are only accessed by a PainterPacker not in
+     * sub-recording mode.
      */
     const fastuidraw::PainterPacker *m_painter;
     std::vector<fastuidraw::generic_data> m_data;
@@ -210,10 +614,7 @@ namespace
     int m_pool_slot;
 
   private:
-    /* Entry reference count is not thread safe because
-     * the objects themselves are not.
-     */
-    fastuidraw::reference_count_non_concurrent m_count;
+    fastuidraw::reference_count_atomic m_count;
   };
 
   template<typename T>
@@ -272,6 +673,10 @@ namespace
     fastuidraw::vecN<Entry<T>, PoolBase::pool_size> m_data;
   };
 
+  /* Allocation only walks the current pool; a new pool is
+   * created (under a lock) only when the current pool is
+   * exhausted, so the common path takes no lock.
+   */
   template<typename T>
   class PoolSet:fastuidraw::noncopyable
   {
@@ -280,25 +685,36 @@ namespace
     PoolSet(void)
     {
       m_pools.push_back(FASTUIDRAWnew Pool<T>());
+      m_current.store(m_pools.back().get(), std::memory_order_release);
     }
 
     Entry<T>*
     allocate(const T &st, int alignment)
     {
-      Entry<T> *return_value;
+      Entry<T> *return_value(nullptr);
 
-      return_value = m_pools.back()->allocate(st, alignment);
-      if (!return_value)
+      while(!return_value)
         {
-          m_pools.push_back(FASTUIDRAWnew Pool<T>());
-          return_value = m_pools.back()->allocate(st, alignment);
-        }
+          Pool<T> *p;
 
-      FASTUIDRAWassert(return_value);
+          p = m_current.load(std::memory_order_acquire);
+          return_value = p->allocate(st, alignment);
+          if (!return_value)
+            {
+              fastuidraw::autolock_mutex m(m_mutex);
+              if (m_current.load(std::memory_order_relaxed) == p)
+                {
+                  m_pools.push_back(FASTUIDRAWnew Pool<T>());
+                  m_current.store(m_pools.back().get(), std::memory_order_release);
+                }
+            }
+        }
       return return_value;
     }
 
   private:
+    std::atomic<Pool<T>*> m_current;
+    fastuidraw::mutex m_mutex;
     std::vector<fastuidraw::reference_counted_ptr<Pool<T> > > m_pools;
   };
 
@@ -335,7 +751,8 @@ namespace
   {
   public:
     per_draw_command(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &r,
-                     const fastuidraw::PainterBackend::ConfigurationBase &config);
+                     const fastuidraw::PainterBackend::ConfigurationBase &config,
+                     const HostPainterDraw *host = nullptr);
 
     unsigned int
     attribute_room(void)
@@ -344,11 +761,26 @@ namespace
       return m_draw_command->m_attributes.size() - m_attributes_written;
     }
 
+    unsigned int
+    compact_attribute_room(void)
+    {
+      FASTUIDRAWassert(m_compact_attributes_written <= m_draw_command->m_compact_attributes.size());
+      return m_draw_command->m_compact_attributes.size() - m_compact_attributes_written;
+    }
+
+    /* room is measured in elements of m_draw_command->m_indices,
+     * i.e. as if every index still to be written is 32-bit.
+     */
     unsigned int
     index_room(void)
     {
-      FASTUIDRAWassert(m_indices_written <= m_draw_command->m_indices.size());
-      return m_draw_command->m_indices.size() - m_indices_written;
+      unsigned int used;
+
+      used = (m_wide_indices) ?
+        wide_index_slot() :
+        (m_indices_written + 1u) / 2u;
+      FASTUIDRAWassert(used <= m_draw_command->m_indices.size());
+      return m_draw_command->m_indices.size() - used;
     }
 
     unsigned int
@@ -366,10 +798,66 @@ namespace
       return current_block() * m_alignment;
     }
 
+    unsigned int
+    attribute_bytes_written(void)
+    {
+      return m_attributes_written * (sizeof(fastuidraw::PainterAttribute) + sizeof(uint32_t))
+        + m_compact_attributes_written * sizeof(fastuidraw::PainterCompactAttribute);
+    }
+
+    unsigned int
+    index_bytes_written(void)
+    {
+      unsigned int num_16bit;
+
+      num_16bit = (m_wide_indices) ? m_indices_16bit_written : m_indices_written;
+      return num_16bit * sizeof(uint16_t)
+        + (m_indices_written - num_16bit) * sizeof(fastuidraw::PainterIndex);
+    }
+
+    /* Sets exactly one of dst_16bit, dst to where the
+     * next count indices are to be written; switches
+     * to 32-bit indices once an attribute written has
+     * an index that does not fit in 16 bits. If compact
+     * is different than m_compact, the indices to be
+     * written index into the other attribute array.
+     */
+    void
+    index_destination(unsigned int count, bool compact,
+                      fastuidraw::c_array<uint16_t> &dst_16bit,
+                      fastuidraw::c_array<fastuidraw::PainterIndex> &dst)
+    {
+      if (compact != m_compact)
+        {
+          m_draw_command->attribute_format_break(compact, m_indices_written);
+          m_compact = compact;
+        }
+
+      if (!m_wide_indices
+          && std::max(m_attributes_written, m_compact_attributes_written) > 0x10000u)
+        {
+          m_draw_command->index_width_break(m_indices_written);
+          m_wide_indices = true;
+          m_indices_16bit_written = m_indices_written;
+        }
+
+      if (m_wide_indices)
+        {
+          dst_16bit = fastuidraw::c_array<uint16_t>();
+          dst = m_draw_command->m_indices.sub_array(wide_index_slot(), count);
+        }
+      else
+        {
+          dst_16bit = m_draw_command->m_indices_16bit.sub_array(m_indices_written, count);
+          dst = fastuidraw::c_array<fastuidraw::PainterIndex>();
+        }
+    }
+
     void
     unmap(void)
     {
-      m_draw_command->unmap(m_attributes_written, m_indices_written, store_written());
+      m_draw_command->unmap(m_attributes_written, m_compact_attributes_written,
+                            m_indices_written, store_written());
     }
 
     void
@@ -392,10 +880,53 @@ namespace
       m_draw_command->draw_break(action, m_indices_written);
     }
 
+    /* returns the content recorded, m_draw_command must
+     * be a HostPainterDraw that is unmapped.
+     */
+    RecordedContent
+    recorded_content(void);
+
+    /* append recorded content, relocating data store locations
+     * and incrementing the z-values by z_offset; if patch is
+     * non-null, the item matrices and clip equations are also
+     * changed as described by patch.
+     */
+    void
+    append(const RecordedContent &src, int z_offset,
+           const ReplayPatch *patch = nullptr);
+
     fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> m_draw_command;
     unsigned int m_attributes_written, m_indices_written;
+    unsigned int m_compact_attributes_written;
+    unsigned int m_draw_breaks;
+
+    /* true if the indices last written index into
+     * m_draw_command->m_compact_attributes
+     */
+    bool m_compact;
+
+    /* true once indices are written to m_draw_command->m_indices,
+     * in which case the first m_indices_16bit_written indices
+     * are in m_draw_command->m_indices_16bit
+     */
+    bool m_wide_indices;
+    unsigned int m_indices_16bit_written;
+
+    /* non-null exactly when m_draw_command is a HostPainterDraw */
+    const HostPainterDraw *m_host;
 
   private:
+    unsigned int
+    wide_index_slot(void)
+    {
+      FASTUIDRAWassert(m_wide_indices);
+      return (m_indices_16bit_written + 1u) / 2u + m_indices_written - m_indices_16bit_written;
+    }
+
+    void
+    add_header(unsigned int location,
+               const PainterShaderGroupPrivate &current,
+               unsigned int indices_written);
     fastuidraw::c_array<fastuidraw::generic_data>
     allocate_store(unsigned int num_elements);
 
@@ -455,6 +986,17 @@ namespace
   {
   public:
     std::vector<unsigned int> m_attribs_loaded;
+
+    /* m_attribs_compact[i] is true if the attribute chunk i
+     * was loaded into PainterDraw::m_compact_attributes
+     */
+    std::vector<bool> m_attribs_compact;
+
+    /* attributes of a chunk and their compact form as
+     * written by PainterPackerPrivate::pack_compact_attributes()
+     */
+    std::vector<fastuidraw::PainterAttribute> m_attribs;
+    std::vector<fastuidraw::PainterCompactAttribute> m_compact_attribs;
   };
 
   class AttributeIndexSrcFromArray
@@ -509,8 +1051,9 @@ namespace
         m_attrib_chunk_selector[index_chunk];
     }
 
+    template<typename T>
     void
-    write_indices(fastuidraw::c_array<fastuidraw::PainterIndex> dst,
+    write_indices(fastuidraw::c_array<T> dst,
                   unsigned int index_offset_value,
                   unsigned int index_chunk) const
     {
@@ -523,7 +1066,7 @@ namespace
       for(unsigned int i = 0; i < dst.size(); ++i)
         {
           FASTUIDRAWassert(int(src[i]) + m_index_adjusts[index_chunk] >= 0);
-          dst[i] = int(src[i] + index_offset_value) + m_index_adjusts[index_chunk];
+          dst[i] = T(int(src[i] + index_offset_value) + m_index_adjusts[index_chunk]);
         }
     }
 
@@ -553,12 +1096,46 @@ namespace
     PainterPackerPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> backend,
                          fastuidraw::PainterPacker *p);
 
+    ~PainterPackerPrivate();
+
     void
     start_new_command(void);
 
+    /* add the stats of the current command and unmap it */
+    void
+    finish_current_command(void);
+
+    void
+    begin_sub(const PainterPackerPrivate *parent);
+
+    void
+    end_sub(void);
+
+    /* returns the bucket into which to record a draw when
+     * state sorting, beginning it if necessary.
+     */
+    PainterPackerPrivate*
+    sort_bucket(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                const fastuidraw::PainterPackerData &draw);
+
+    /* submit the content of the buckets, ordered by
+     * their shader groups.
+     */
+    void
+    flush_sort_buckets(void);
+
     void
     upload_draw_state(const fastuidraw::PainterPackerData &draw_state);
 
+    void
+    submit_sub(PainterPackerPrivate *sub, int z_offset);
+
+    /* append recorded content to the current draw,
+     * starting a new draw if there is not enough room.
+     */
+    void
+    append_recorded(const RecordedContent &src, int z_offset, const ReplayPatch *patch);
+
     unsigned int
     compute_room_needed_for_packing(const fastuidraw::PainterPackerData &draw_state);
 
@@ -570,7 +1147,7 @@ namespace
         {
           EntryBase *d;
           d = static_cast<EntryBase*>(obj.m_packed_value.opaque_data());
-          if (d->m_painter == m_p && d->m_begin_id == m_number_begins
+          if (!m_sub_mode && d->m_painter == m_p && d->m_begin_id == m_number_begins
              && d->m_draw_command_id == m_accumulated_draws.size())
             {
               return 0;
@@ -599,6 +1176,18 @@ namespace
                            int z,
                            const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &call_back);
 
+    /* writes the attributes of the named chunk of src to
+     * m_work_room.m_attribs and converts them to
+     * m_work_room.m_compact_attribs; returns false if
+     * the current PainterDraw does not support compact
+     * attributes or if the attributes cannot be realized
+     * by the layout.
+     */
+    template<typename T>
+    bool
+    pack_compact_attributes(enum fastuidraw::PainterCompactAttribute::layout_t layout,
+                            const T &src, unsigned int attrib_src);
+
     fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> m_backend;
     fastuidraw::PainterShaderSet m_default_shaders;
     unsigned int m_alignment;
@@ -614,9 +1203,58 @@ namespace
     std::vector<per_draw_command> m_accumulated_draws;
     fastuidraw::PainterPacker *m_p;
 
+    /* size of PainterDraw::m_store of the backend, recorded
+     * at the first begin(); sub-recording PainterPacker objects
+     * read it from their parent.
+     */
+    unsigned int m_store_size;
+
+    /* true between begin_sub() and end() */
+    bool m_sub_mode;
+    fastuidraw::reference_counted_ptr<HostBufferPool> m_host_pool;
+    std::vector<per_draw_command> m_recorded_segments;
+    RetainedResources m_retained;
+
+    /* when state sorting, draws are recorded into the
+     * first m_number_active_buckets elements of m_sort_buckets
+     * according to their shader groups; the elements past
+     * are kept for reuse.
+     */
+    bool m_state_sort;
+    std::vector<std::pair<PainterShaderGroupValues, PainterPackerPrivate*> > m_sort_buckets;
+    unsigned int m_number_active_buckets;
+
     PainterPackerPrivateWorkroom m_work_room;
     fastuidraw::vecN<unsigned int, fastuidraw::PainterPacker::num_stats> m_stats;
   };
+
+  bool
+  operator<(const PainterShaderGroupValues &lhs, const PainterShaderGroupValues &rhs)
+  {
+    /* order first by what is most expensive to change */
+    if (lhs.m_blend_mode != rhs.m_blend_mode)
+      {
+        return lhs.m_blend_mode < rhs.m_blend_mode;
+      }
+    if (lhs.m_item_group != rhs.m_item_group)
+      {
+        return lhs.m_item_group < rhs.m_item_group;
+      }
+    if (lhs.m_blend_group != rhs.m_blend_group)
+      {
+        return lhs.m_blend_group < rhs.m_blend_group;
+      }
+    return lhs.m_brush < rhs.m_brush;
+  }
+
+  bool
+  operator==(const PainterShaderGroupValues &lhs, const PainterShaderGroupValues &rhs)
+  {
+    return lhs.m_blend_mode == rhs.m_blend_mode
+      && lhs.m_item_group == rhs.m_item_group
+      && lhs.m_blend_group == rhs.m_blend_group
+      && lhs.m_brush == rhs.m_brush;
+  }
 }
 
 
@@ -624,10 +1262,17 @@ namespace
 // per_draw_command methods
 per_draw_command::
 per_draw_command(const fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> &r,
-                 const fastuidraw::PainterBackend::ConfigurationBase &config):
+                 const fastuidraw::PainterBackend::ConfigurationBase &config,
+                 const HostPainterDraw *host):
   m_draw_command(r),
   m_attributes_written(0),
   m_indices_written(0),
+  m_compact_attributes_written(0),
+  m_draw_breaks(0),
+  m_compact(false),
+  m_wide_indices(r->m_indices_16bit.empty()),
+  m_indices_16bit_written(0),
+  m_host(host),
   m_store_blocks_written(0),
   m_alignment(config.alignment()),
   m_brush_shader_mask(config.brush_shader_mask())
@@ -655,8 +1300,13 @@ per_draw_command::
 pack_state_data(PainterPackerPrivate *p,
                 EntryBase *d, uint32_t &location)
 {
-  if (d->m_painter == p->m_p && d->m_begin_id == p->m_number_begins
-     && d->m_draw_command_id == p->m_accumulated_draws.size())
+  /* When recording for a sub-submission, the location
+   * cache of the packed value is neither read nor written
+   * because the value may be in use by several threads.
+   */
+  if (!p->m_sub_mode && d->m_painter == p->m_p
+      && d->m_begin_id == p->m_number_begins
+      && d->m_draw_command_id == p->m_accumulated_draws.size())
     {
       location = d->m_offset;
       return;
@@ -673,6 +1323,11 @@ pack_state_data(PainterPackerPrivate *p,
   dst = allocate_store(src.size());
   std::copy(src.begin(), src.end(), dst.begin());
 
+  if (p->m_sub_mode)
+    {
+      return;
+    }
+
   d->m_painter = p->m_p;
   d->m_begin_id = p->m_number_begins;
   d->m_draw_command_id = p->m_accumulated_draws.size();
@@ -689,6 +1344,10 @@ pack_painter_state(const fastuidraw::PainterPackerData &state,
   pack_state_data(p, state.m_item_shader_data, out_data.m_item_shader_data_loc);
   pack_state_data(p, state.m_blend_shader_data, out_data.m_blend_shader_data_loc);
   pack_state_data(p, state.m_brush, out_data.m_brush_shader_data_loc);
+  if (p->m_sub_mode)
+    {
+      p->m_retained.add_brush(fetch_value(state.m_brush));
+    }
 }
 
 unsigned int
@@ -706,95 +1365,407 @@ pack_header(unsigned int header_size,
   fastuidraw::c_array<fastuidraw::generic_data> dst;
   fastuidraw::PainterHeader header;
 
-  return_value = current_block();
-  dst = allocate_store(header_size);
+  return_value = current_block();
+  dst = allocate_store(header_size);
+
+  if (call_back)
+    {
+      call_back->current_draw(m_draw_command);
+    }
+
+  PainterShaderGroupPrivate current;
+  fastuidraw::PainterShader::Tag blend;
+
+  if (blend_shader)
+    {
+      blend = blend_shader->tag();
+    }
+  current.m_item_group = item_shader->group();
+  current.m_brush = brush_shader;
+  current.m_blend_group = blend.m_group;
+  current.m_blend_mode = blend_mode;
+
+  header.m_clip_equations_location = loc.m_clipping_data_loc;
+  header.m_item_matrix_location = loc.m_item_matrix_data_loc;
+  header.m_brush_shader_data_location = loc.m_brush_shader_data_loc;
+  header.m_item_shader_data_location = loc.m_item_shader_data_loc;
+  header.m_blend_shader_data_location = loc.m_blend_shader_data_loc;
+  header.m_item_shader = item_shader->ID();
+  header.m_brush_shader = current.m_brush;
+  header.m_blend_shader = blend.m_ID;
+  header.m_z = z;
+  header.pack_data(m_alignment, dst);
+  add_header(return_value, current, m_indices_written);
+
+  if (call_back)
+    {
+      call_back->header_added(header, dst);
+    }
+
+  return return_value;
+}
+
+void
+per_draw_command::
+add_header(unsigned int location,
+           const PainterShaderGroupPrivate &current,
+           unsigned int indices_written)
+{
+  if (m_host)
+    {
+      m_host->add_header(location, current, indices_written);
+    }
+  else if (current.m_item_group != m_prev_state.m_item_group
+           || current.m_blend_group != m_prev_state.m_blend_group
+           || (m_brush_shader_mask & (current.m_brush ^ m_prev_state.m_brush)) != 0u
+           || current.m_blend_mode != m_prev_state.m_blend_mode)
+    {
+      m_draw_command->draw_break(m_prev_state, current, indices_written);
+      ++m_draw_breaks;
+    }
+  m_prev_state = current;
+}
+
+RecordedContent
+per_draw_command::
+recorded_content(void)
+{
+  RecordedContent R;
+
+  FASTUIDRAWassert(m_host);
+  FASTUIDRAWassert(m_draw_command->unmapped());
+  FASTUIDRAWassert(m_compact_attributes_written == 0u);
+  R.m_attributes = m_draw_command->m_attributes.sub_array(0, m_attributes_written);
+  R.m_header_attributes = m_draw_command->m_header_attributes.sub_array(0, m_attributes_written);
+  R.m_indices = m_draw_command->m_indices.sub_array(0, m_indices_written);
+  R.m_store = m_draw_command->m_store.sub_array(0, store_written());
+  R.m_events = fastuidraw::make_c_array(m_host->m_events);
+  return R;
+}
+
+void
+per_draw_command::
+append(const RecordedContent &src, int z_offset, const ReplayPatch *patch)
+{
+  unsigned int block_offset, attrib_offset, index_offset, clip_location(0);
+  fastuidraw::c_array<fastuidraw::generic_data> dst_store;
+
+  FASTUIDRAWassert(src.m_attributes.size() <= attribute_room());
+  FASTUIDRAWassert(src.m_indices.size() <= index_room());
+  FASTUIDRAWassert(src.m_store.size() <= store_room());
+
+  block_offset = current_block();
+  attrib_offset = m_attributes_written;
+  index_offset = m_indices_written;
+
+  dst_store = allocate_store(src.m_store.size());
+  std::copy(src.m_store.begin(), src.m_store.end(), dst_store.begin());
+
+  if (patch)
+    {
+      fastuidraw::c_array<fastuidraw::generic_data> dst;
+
+      /* the matrix values are packed in row-major order
+       * starting at PainterItemMatrix::matrix00_offset
+       */
+      for(unsigned int loc : src.m_item_matrix_locations)
+        {
+          fastuidraw::PainterItemMatrix M;
+
+          dst = dst_store.sub_array(loc * m_alignment);
+          for(unsigned int r = 0; r < 3; ++r)
+            {
+              for(unsigned int c = 0; c < 3; ++c)
+                {
+                  M.m_item_matrix(r, c) = dst[fastuidraw::PainterItemMatrix::matrix00_offset + 3 * r + c].f;
+                }
+            }
+          M.m_item_matrix = patch->m_item_matrix * M.m_item_matrix;
+          M.pack_data(m_alignment, dst);
+        }
+
+      clip_location = current_block();
+      dst = allocate_store(patch->m_clip.data_size(m_alignment));
+      patch->m_clip.pack_data(m_alignment, dst);
+    }
+
+  fastuidraw::c_array<uint32_t> dst_headers;
+  fastuidraw::c_array<uint16_t> dst_indices_16bit;
+  fastuidraw::c_array<fastuidraw::PainterIndex> dst_indices;
+
+  std::copy(src.m_attributes.begin(), src.m_attributes.end(),
+            m_draw_command->m_attributes.begin() + attrib_offset);
+
+  dst_headers = m_draw_command->m_header_attributes.sub_array(attrib_offset, src.m_header_attributes.size());
+  for(unsigned int i = 0; i < src.m_header_attributes.size(); ++i)
+    {
+      dst_headers[i] = src.m_header_attributes[i] + block_offset;
+    }
+
+  m_attributes_written += src.m_attributes.size();
+  index_destination(src.m_indices.size(), false, dst_indices_16bit, dst_indices);
+  for(unsigned int i = 0; i < dst_indices_16bit.size(); ++i)
+    {
+      dst_indices_16bit[i] = src.m_indices[i] + attrib_offset;
+    }
+  for(unsigned int i = 0; i < dst_indices.size(); ++i)
+    {
+      dst_indices[i] = src.m_indices[i] + attrib_offset;
+    }
+  m_indices_written += src.m_indices.size();
+
+  for(const HostPainterDraw::event &E : src.m_events)
+    {
+      if (E.m_action)
+        {
+          m_draw_command->draw_break(E.m_action, index_offset + E.m_indices_written);
+        }
+      else
+        {
+          fastuidraw::c_array<fastuidraw::generic_data> header;
+
+          header = dst_store.sub_array(E.m_header_location * m_alignment);
+          if (patch)
+            {
+              header[fastuidraw::PainterHeader::clip_equations_location_offset].u = clip_location;
+            }
+          else
+            {
+              header[fastuidraw::PainterHeader::clip_equations_location_offset].u += block_offset;
+            }
+          header[fastuidraw::PainterHeader::item_matrix_location_offset].u += block_offset;
+          header[fastuidraw::PainterHeader::brush_shader_data_location_offset].u += block_offset;
+          header[fastuidraw::PainterHeader::item_shader_data_location_offset].u += block_offset;
+          header[fastuidraw::PainterHeader::blend_shader_data_location_offset].u += block_offset;
+          header[fastuidraw::PainterHeader::z_offset].i += z_offset;
+          add_header(block_offset + E.m_header_location,
+                     PainterShaderGroupPrivate(E.m_groups),
+                     index_offset + E.m_indices_written);
+        }
+    }
+}
+
+///////////////////////////////////////////
+// PainterPackerPrivate methods
+PainterPackerPrivate::
+PainterPackerPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> backend,
+                     fastuidraw::PainterPacker *p):
+  m_backend(backend),
+  m_clear_color_buffer(false),
+  m_p(p),
+  m_store_size(0),
+  m_sub_mode(false),
+  m_state_sort(false),
+  m_number_active_buckets(0)
+{
+  m_alignment = m_backend->configuration_base().alignment();
+  m_header_size = fastuidraw::PainterHeader::data_size(m_alignment);
+  // By calling PainterBackend::default_shaders(), we make the shaders
+  // registered. By setting m_default_shaders to its return value,
+  // and using that for the return value of PainterPacker::default_shaders(),
+  // we skip the check in PainterBackend::default_shaders() to register
+  // the shaders as well.
+  m_default_shaders = m_backend->default_shaders();
+  m_number_begins = 0;
+}
+
+PainterPackerPrivate::
+~PainterPackerPrivate()
+{
+  for(const auto &B : m_sort_buckets)
+    {
+      FASTUIDRAWdelete(B.second);
+    }
+}
+
+void
+PainterPackerPrivate::
+finish_current_command(void)
+{
+  if (!m_accumulated_draws.empty())
+    {
+      per_draw_command &c(m_accumulated_draws.back());
+
+      m_stats[fastuidraw::PainterPacker::num_attributes] += c.m_attributes_written + c.m_compact_attributes_written;
+      m_stats[fastuidraw::PainterPacker::num_indices] += c.m_indices_written;
+      m_stats[fastuidraw::PainterPacker::num_generic_datas] += c.store_written();
+      m_stats[fastuidraw::PainterPacker::num_draws] += 1u;
+      m_stats[fastuidraw::PainterPacker::num_draw_breaks] += c.m_draw_breaks;
+      m_stats[fastuidraw::PainterPacker::num_attribute_bytes] += c.attribute_bytes_written();
+      m_stats[fastuidraw::PainterPacker::num_index_bytes] += c.index_bytes_written();
+      m_stats[fastuidraw::PainterPacker::num_compact_attributes] += c.m_compact_attributes_written;
+
+      c.unmap();
+    }
+}
+
+void
+PainterPackerPrivate::
+start_new_command(void)
+{
+  finish_current_command();
+
+  if (m_sub_mode)
+    {
+      fastuidraw::reference_counted_ptr<const HostPainterDraw> h;
+      h = FASTUIDRAWnew HostPainterDraw(m_host_pool);
+      m_accumulated_draws.push_back(per_draw_command(h, m_backend->configuration_base(), h.get()));
+    }
+  else
+    {
+      fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> r;
+      r = m_backend->map_draw();
+      m_accumulated_draws.push_back(per_draw_command(r, m_backend->configuration_base()));
+    }
+}
+
+void
+PainterPackerPrivate::
+submit_sub(PainterPackerPrivate *sub, int z_offset)
+{
+  FASTUIDRAWassert(!m_accumulated_draws.empty());
+  FASTUIDRAWassert(sub->m_accumulated_draws.empty());
+  FASTUIDRAWassert(sub->m_backend == m_backend);
+
+  for(per_draw_command &src : sub->m_recorded_segments)
+    {
+      append_recorded(src.recorded_content(), z_offset, nullptr);
+    }
+  m_stats[fastuidraw::PainterPacker::num_headers] += sub->m_stats[fastuidraw::PainterPacker::num_headers];
+  if (m_sub_mode)
+    {
+      m_retained.add(sub->m_retained);
+    }
+}
+
+void
+PainterPackerPrivate::
+append_recorded(const RecordedContent &src, int z_offset, const ReplayPatch *patch)
+{
+  unsigned int store_needed;
+
+  store_needed = src.m_store.size();
+  if (patch)
+    {
+      store_needed += patch->m_clip.data_size(m_alignment);
+    }
 
-  if (call_back)
+  if (src.m_attributes.size() > m_accumulated_draws.back().attribute_room()
+      || src.m_indices.size() > m_accumulated_draws.back().index_room()
+      || store_needed > m_accumulated_draws.back().store_room())
     {
-      call_back->current_draw(m_draw_command);
+      start_new_command();
     }
+  m_accumulated_draws.back().append(src, z_offset, patch);
+}
 
-  PainterShaderGroupPrivate current;
-  fastuidraw::PainterShader::Tag blend;
+void
+PainterPackerPrivate::
+begin_sub(const PainterPackerPrivate *parent)
+{
+  FASTUIDRAWassert(m_accumulated_draws.empty());
+  FASTUIDRAWassert(parent->m_backend == m_backend);
+  FASTUIDRAWassert(parent->m_store_size > 0);
 
-  if (blend_shader)
+  if (!m_host_pool || m_host_pool->num_store() != parent->m_store_size)
     {
-      blend = blend_shader->tag();
+      m_host_pool = FASTUIDRAWnew HostBufferPool(m_backend->attribs_per_mapping(),
+                                                 m_backend->indices_per_mapping(),
+                                                 parent->m_store_size);
     }
-  current.m_item_group = item_shader->group();
-  current.m_brush = brush_shader;
-  current.m_blend_group = blend.m_group;
-  current.m_blend_mode = blend_mode;
 
-  header.m_clip_equations_location = loc.m_clipping_data_loc;
-  header.m_item_matrix_location = loc.m_item_matrix_data_loc;
-  header.m_brush_shader_data_location = loc.m_brush_shader_data_loc;
-  header.m_item_shader_data_location = loc.m_item_shader_data_loc;
-  header.m_blend_shader_data_location = loc.m_blend_shader_data_loc;
-  header.m_item_shader = item_shader->ID();
-  header.m_brush_shader = current.m_brush;
-  header.m_blend_shader = blend.m_ID;
-  header.m_z = z;
-  header.pack_data(m_alignment, dst);
+  std::fill(m_stats.begin(), m_stats.end(), 0u);
+  m_recorded_segments.clear();
+  m_retained.clear();
+  m_store_size = parent->m_store_size;
+  m_sub_mode = true;
+  start_new_command();
+  ++m_number_begins;
+}
+
+void
+PainterPackerPrivate::
+end_sub(void)
+{
+  FASTUIDRAWassert(m_sub_mode);
+  finish_current_command();
+
+  /* keep the recorded content for submit_sub() */
+  m_sub_mode = false;
+  m_recorded_segments.swap(m_accumulated_draws);
+  m_accumulated_draws.clear();
+}
+
+PainterPackerPrivate*
+PainterPackerPrivate::
+sort_bucket(const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+            const fastuidraw::PainterPackerData &draw)
+{
+  PainterShaderGroupValues key;
+  fastuidraw::PainterShader::Tag blend;
+  PainterPackerPrivate *bucket;
 
-  if (current.m_item_group != m_prev_state.m_item_group
-     || current.m_blend_group != m_prev_state.m_blend_group
-     || (m_brush_shader_mask & (current.m_brush ^ m_prev_state.m_brush)) != 0u
-     || current.m_blend_mode != m_prev_state.m_blend_mode)
+  /* same values as compared by per_draw_command::add_header() */
+  if (m_blend_shader)
     {
-      m_draw_command->draw_break(m_prev_state, current,
-                                 m_indices_written);
+      blend = m_blend_shader->tag();
     }
+  key.m_item_group = shader->group();
+  key.m_brush = fetch_value(draw.m_brush).shader() & m_backend->configuration_base().brush_shader_mask();
+  key.m_blend_group = blend.m_group;
+  key.m_blend_mode = m_blend_mode;
 
-  m_prev_state = current;
+  for(unsigned int i = 0; i < m_number_active_buckets; ++i)
+    {
+      if (m_sort_buckets[i].first == key)
+        {
+          bucket = m_sort_buckets[i].second;
+          bucket->m_blend_shader = m_blend_shader;
+          return bucket;
+        }
+    }
 
-  if (call_back)
+  if (m_number_active_buckets == m_sort_buckets.size())
     {
-      call_back->header_added(header, dst);
+      bucket = FASTUIDRAWnew PainterPackerPrivate(m_backend, m_p);
+      m_sort_buckets.push_back(std::make_pair(key, bucket));
     }
 
-  return return_value;
-}
+  m_sort_buckets[m_number_active_buckets].first = key;
+  bucket = m_sort_buckets[m_number_active_buckets].second;
+  ++m_number_active_buckets;
 
-///////////////////////////////////////////
-// PainterPackerPrivate methods
-PainterPackerPrivate::
-PainterPackerPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> backend,
-                     fastuidraw::PainterPacker *p):
-  m_backend(backend),
-  m_clear_color_buffer(false),
-  m_p(p)
-{
-  m_alignment = m_backend->configuration_base().alignment();
-  m_header_size = fastuidraw::PainterHeader::data_size(m_alignment);
-  // By calling PainterBackend::default_shaders(), we make the shaders
-  // registered. By setting m_default_shaders to its return value,
-  // and using that for the return value of PainterPacker::default_shaders(),
-  // we skip the check in PainterBackend::default_shaders() to register
-  // the shaders as well.
-  m_default_shaders = m_backend->default_shaders();
-  m_number_begins = 0;
+  bucket->begin_sub(this);
+  bucket->m_blend_shader = m_blend_shader;
+  bucket->m_blend_mode = m_blend_mode;
+  return bucket;
 }
 
 void
 PainterPackerPrivate::
-start_new_command(void)
+flush_sort_buckets(void)
 {
-  if (!m_accumulated_draws.empty())
+  fastuidraw::c_array<std::pair<PainterShaderGroupValues, PainterPackerPrivate*> > buckets;
+
+  if (m_number_active_buckets == 0)
     {
-      per_draw_command &c(m_accumulated_draws.back());
+      return;
+    }
 
-      m_stats[fastuidraw::PainterPacker::num_attributes] += c.m_attributes_written;
-      m_stats[fastuidraw::PainterPacker::num_indices] += c.m_indices_written;
-      m_stats[fastuidraw::PainterPacker::num_generic_datas] += c.store_written();
-      m_stats[fastuidraw::PainterPacker::num_draws] += 1u;
+  buckets = fastuidraw::make_c_array(m_sort_buckets).sub_array(0, m_number_active_buckets);
+  std::sort(buckets.begin(), buckets.end(),
+            [](const std::pair<PainterShaderGroupValues, PainterPackerPrivate*> &a,
+               const std::pair<PainterShaderGroupValues, PainterPackerPrivate*> &b)
+            {
+              return a.first < b.first;
+            });
 
-      c.unmap();
+  m_number_active_buckets = 0;
+  for(const auto &B : buckets)
+    {
+      B.second->end_sub();
+      submit_sub(B.second, 0);
     }
-
-  fastuidraw::reference_counted_ptr<const fastuidraw::PainterDraw> r;
-  r = m_backend->map_draw();
-  m_accumulated_draws.push_back(per_draw_command(r, m_backend->configuration_base()));
 }
 
 unsigned int
@@ -825,6 +1796,34 @@ upload_draw_state(const fastuidraw::PainterPackerData &draw_state)
   m_accumulated_draws.back().pack_painter_state(draw_state, this, m_painter_state_location);
 }
 
+template<typename T>
+bool
+PainterPackerPrivate::
+pack_compact_attributes(enum fastuidraw::PainterCompactAttribute::layout_t layout,
+                        const T &src, unsigned int attrib_src)
+{
+  unsigned int num_attribs;
+
+  if (layout == fastuidraw::PainterCompactAttribute::no_compact_layout
+      || m_accumulated_draws.back().m_draw_command->m_compact_attributes.empty())
+    {
+      return false;
+    }
+
+  num_attribs = src.number_attributes(attrib_src);
+  m_work_room.m_attribs.resize(num_attribs);
+  m_work_room.m_compact_attribs.resize(num_attribs);
+  src.write_attributes(fastuidraw::make_c_array(m_work_room.m_attribs), attrib_src);
+  for(unsigned int i = 0; i < num_attribs; ++i)
+    {
+      if (!m_work_room.m_compact_attribs[i].pack(layout, m_work_room.m_attribs[i], 0u))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
 template<typename T>
 void
 PainterPackerPrivate::
@@ -849,8 +1848,29 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
       return;
     }
 
+  if (m_state_sort)
+    {
+      /* a call back may modify the data it is handed after
+       * the draw, which would be lost if the draw were
+       * recorded into a bucket; a draw with a call back also
+       * acts as a barrier to keep draws from moving across it
+       * (for example across the occluders of a clip-out).
+       */
+      if (call_back)
+        {
+          flush_sort_buckets();
+        }
+      else
+        {
+          sort_bucket(shader, draw)->draw_generic_implement(shader, draw, src, z, call_back);
+          return;
+        }
+    }
+
   m_work_room.m_attribs_loaded.clear();
   m_work_room.m_attribs_loaded.resize(number_attribute_chunks, NOT_LOADED);
+  m_work_room.m_attribs_compact.clear();
+  m_work_room.m_attribs_compact.resize(number_attribute_chunks, false);
 
   FASTUIDRAWassert(shader);
 
@@ -862,10 +1882,7 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
       unsigned int attrib_room, index_room, data_room;
       unsigned int attrib_src, needed_attrib_room;
       unsigned int num_attribs, num_indices;
-
-      attrib_room = m_accumulated_draws.back().attribute_room();
-      index_room = m_accumulated_draws.back().index_room();
-      data_room = m_accumulated_draws.back().store_room();
+      bool compact;
 
       attrib_src = src.attribute_chunk_selection(chunk);
       FASTUIDRAWassert(attrib_src < number_attribute_chunks);
@@ -877,8 +1894,22 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
           continue;
         }
 
-      needed_attrib_room = (m_work_room.m_attribs_loaded[attrib_src] == NOT_LOADED) ?
-        num_attribs : 0;
+      if (m_work_room.m_attribs_loaded[attrib_src] == NOT_LOADED)
+        {
+          needed_attrib_room = num_attribs;
+          compact = pack_compact_attributes(shader->compact_layout(), src, attrib_src);
+        }
+      else
+        {
+          needed_attrib_room = 0;
+          compact = m_work_room.m_attribs_compact[attrib_src];
+        }
+
+      attrib_room = (compact) ?
+        m_accumulated_draws.back().compact_attribute_room() :
+        m_accumulated_draws.back().attribute_room();
+      index_room = m_accumulated_draws.back().index_room();
+      data_room = m_accumulated_draws.back().store_room();
 
       if (attrib_room < needed_attrib_room || index_room < num_indices
          || (allocate_header && data_room < m_header_size))
@@ -886,12 +1917,23 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
           start_new_command();
           upload_draw_state(draw);
 
+          /* the chunk is to be loaded into the new command, if it
+           * was already loaded into the previous command, its
+           * attributes have not yet been converted.
+           */
+          if (needed_attrib_room == 0)
+            {
+              compact = pack_compact_attributes(shader->compact_layout(), src, attrib_src);
+            }
+
           /* reset attribs_loaded[] and recompute needed_attrib_room
            */
           std::fill(m_work_room.m_attribs_loaded.begin(), m_work_room.m_attribs_loaded.end(), NOT_LOADED);
           needed_attrib_room = num_attribs;
 
-          attrib_room = m_accumulated_draws.back().attribute_room();
+          attrib_room = (compact) ?
+            m_accumulated_draws.back().compact_attribute_room() :
+            m_accumulated_draws.back().attribute_room();
           index_room = m_accumulated_draws.back().index_room();
           data_room = m_accumulated_draws.back().store_room();
           allocate_header = true;
@@ -924,7 +1966,32 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
        */
       unsigned int attrib_offset;
 
-      if (needed_attrib_room > 0)
+      if (needed_attrib_room > 0 && compact)
+        {
+          fastuidraw::c_array<fastuidraw::PainterCompactAttribute> attrib_dst_ptr;
+
+          FASTUIDRAWassert(header_loc < (1u << fastuidraw::PainterCompactAttribute::number_header_location_bits));
+          FASTUIDRAWassert(m_work_room.m_compact_attribs.size() == num_attribs);
+          attrib_dst_ptr = cmd.m_draw_command->m_compact_attributes.sub_array(cmd.m_compact_attributes_written, num_attribs);
+          for(unsigned int i = 0; i < num_attribs; ++i)
+            {
+              fastuidraw::PainterCompactAttribute A(m_work_room.m_compact_attribs[i]);
+
+              /* the store is write only, so the header location
+               * is added before the attribute is written.
+               */
+              A.m_header |= header_loc;
+              attrib_dst_ptr[i] = A;
+            }
+
+          FASTUIDRAWassert(m_work_room.m_attribs_loaded[attrib_src] == NOT_LOADED);
+          m_work_room.m_attribs_loaded[attrib_src] = cmd.m_compact_attributes_written;
+          m_work_room.m_attribs_compact[attrib_src] = true;
+
+          attrib_offset = cmd.m_compact_attributes_written;
+          cmd.m_compact_attributes_written += num_attribs;
+        }
+      else if (needed_attrib_room > 0)
         {
           fastuidraw::c_array<fastuidraw::PainterAttribute> attrib_dst_ptr;
           fastuidraw::c_array<uint32_t> header_dst_ptr;
@@ -937,6 +2004,7 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
 
           FASTUIDRAWassert(m_work_room.m_attribs_loaded[attrib_src] == NOT_LOADED);
           m_work_room.m_attribs_loaded[attrib_src] = cmd.m_attributes_written;
+          m_work_room.m_attribs_compact[attrib_src] = false;
 
           attrib_offset = cmd.m_attributes_written;
           cmd.m_attributes_written += attrib_dst_ptr.size();
@@ -949,11 +2017,19 @@ draw_generic_implement(const fastuidraw::reference_counted_ptr<fastuidraw::Paint
 
       /* copy and adjust the index value by incrementing them by attrib_offset
        */
+      fastuidraw::c_array<uint16_t> index_dst_16bit_ptr;
       fastuidraw::c_array<fastuidraw::PainterIndex> index_dst_ptr;
 
-      index_dst_ptr = cmd.m_draw_command->m_indices.sub_array(cmd.m_indices_written, num_indices);
-      src.write_indices(index_dst_ptr, attrib_offset, chunk);
-      cmd.m_indices_written += index_dst_ptr.size();
+      cmd.index_destination(num_indices, compact, index_dst_16bit_ptr, index_dst_ptr);
+      if (index_dst_16bit_ptr.empty())
+        {
+          src.write_indices(index_dst_ptr, attrib_offset, chunk);
+        }
+      else
+        {
+          src.write_indices(index_dst_16bit_ptr, attrib_offset, chunk);
+        }
+      cmd.m_indices_written += num_indices;
     }
 }
 
@@ -995,6 +2071,24 @@ packed_blend_mode(void) const
   return d->m_blend_mode;
 }
 
+////////////////////////////////////////////
+// fastuidraw::PainterPacker::DataWriter methods
+void
+fastuidraw::PainterPacker::DataWriter::
+write_indices(c_array<uint16_t> dst,
+              unsigned int index_offset_value,
+              unsigned int index_chunk) const
+{
+  std::vector<PainterIndex> tmp(dst.size());
+
+  write_indices(make_c_array(tmp), index_offset_value, index_chunk);
+  for(unsigned int i = 0; i < dst.size(); ++i)
+    {
+      FASTUIDRAWassert(tmp[i] <= 0xFFFFu);
+      dst[i] = static_cast<uint16_t>(tmp[i]);
+    }
+}
+
 ////////////////////////////////////////////
 // fastuidraw::PainterPacker methods
 fastuidraw::PainterPacker::
@@ -1025,10 +2119,159 @@ begin(const reference_counted_ptr<PainterBackend::Surface> &surface,
   d->m_backend->image_atlas()->delay_tile_freeing();
   d->m_backend->colorstop_atlas()->delay_interval_freeing();
   std::fill(d->m_stats.begin(), d->m_stats.end(), 0u);
+  d->m_recorded_segments.clear();
   d->m_surface = surface;
   d->m_clear_color_buffer = clear_color_buffer;
   d->start_new_command();
   ++d->m_number_begins;
+
+  if (d->m_store_size == 0)
+    {
+      d->m_store_size = d->m_accumulated_draws.back().m_draw_command->m_store.size();
+    }
+}
+
+void
+fastuidraw::PainterPacker::
+begin_sub(const PainterPacker &parent)
+{
+  PainterPackerPrivate *d, *parent_d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  parent_d = static_cast<PainterPackerPrivate*>(parent.m_d);
+  d->begin_sub(parent_d);
+}
+
+void
+fastuidraw::PainterPacker::
+submit_sub(const PainterPacker &sub, int z_offset)
+{
+  PainterPackerPrivate *d, *sub_d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  sub_d = static_cast<PainterPackerPrivate*>(sub.m_d);
+  d->flush_sort_buckets();
+  d->submit_sub(sub_d, z_offset);
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDisplayList>
+fastuidraw::PainterPacker::
+create_display_list(const float3x3 &base_item_matrix, int number_z)
+{
+  PainterPackerPrivate *d;
+  PainterDisplayListPrivate *list_d;
+  reference_counted_ptr<PainterDisplayList> return_value;
+
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  FASTUIDRAWassert(!d->m_sub_mode);
+  FASTUIDRAWassert(d->m_accumulated_draws.empty());
+
+  return_value = FASTUIDRAWnew PainterDisplayList();
+  list_d = static_cast<PainterDisplayListPrivate*>(return_value->m_d);
+  list_d->m_backend = d->m_backend.get();
+  list_d->m_base_item_matrix = base_item_matrix;
+  base_item_matrix.inverse(list_d->m_base_item_matrix_inverse);
+  list_d->m_number_z = number_z;
+  list_d->m_number_headers = d->m_stats[num_headers];
+
+  list_d->m_segments.resize(d->m_recorded_segments.size());
+  for(unsigned int i = 0, endi = d->m_recorded_segments.size(); i < endi; ++i)
+    {
+      RecordedContent src(d->m_recorded_segments[i].recorded_content());
+      DisplayListSegment &dst(list_d->m_segments[i]);
+
+      dst.m_attributes.assign(src.m_attributes.begin(), src.m_attributes.end());
+      dst.m_header_attributes.assign(src.m_header_attributes.begin(), src.m_header_attributes.end());
+      dst.m_indices.assign(src.m_indices.begin(), src.m_indices.end());
+      dst.m_store.assign(src.m_store.begin(), src.m_store.end());
+      dst.m_events.assign(src.m_events.begin(), src.m_events.end());
+      for(const HostPainterDraw::event &E : dst.m_events)
+        {
+          if (!E.m_action)
+            {
+              c_array<const generic_data> header;
+
+              header = src.m_store.sub_array(E.m_header_location * d->m_alignment);
+              dst.m_item_matrix_locations.push_back(header[PainterHeader::item_matrix_location_offset].u);
+            }
+        }
+      std::sort(dst.m_item_matrix_locations.begin(), dst.m_item_matrix_locations.end());
+      dst.m_item_matrix_locations.erase(std::unique(dst.m_item_matrix_locations.begin(),
+                                                    dst.m_item_matrix_locations.end()),
+                                        dst.m_item_matrix_locations.end());
+
+      list_d->m_number_attributes += dst.m_attributes.size();
+      list_d->m_number_indices += dst.m_indices.size();
+      list_d->m_number_generic_datas += dst.m_store.size();
+    }
+
+  /* the list keeps alive what its content uses; consecutive
+   * draws typically use the same images and color stops,
+   * drop the duplicates.
+   */
+  RetainedResources &R(list_d->m_resources);
+  R.add(d->m_retained);
+  std::sort(R.m_images.begin(), R.m_images.end());
+  R.m_images.erase(std::unique(R.m_images.begin(), R.m_images.end()), R.m_images.end());
+  std::sort(R.m_color_stops.begin(), R.m_color_stops.end());
+  R.m_color_stops.erase(std::unique(R.m_color_stops.begin(), R.m_color_stops.end()), R.m_color_stops.end());
+  for(const Glyph &G : R.m_glyphs)
+    {
+      reference_counted_ptr<GlyphCache> cache(G.cache());
+
+      G.pin();
+      if (list_d->m_glyph_caches.empty() || list_d->m_glyph_caches.back() != cache)
+        {
+          list_d->m_glyph_caches.push_back(cache);
+        }
+    }
+
+  /* the content now lives in the display list, release
+   * the buffers of the recording back to the pool.
+   */
+  d->m_recorded_segments.clear();
+  d->m_retained.clear();
+  return return_value;
+}
+
+void
+fastuidraw::PainterPacker::
+draw_display_list(const PainterDisplayList &list,
+                  const float3x3 &item_matrix,
+                  const PainterClipEquations &clip,
+                  int z_offset)
+{
+  PainterPackerPrivate *d;
+  PainterDisplayListPrivate *list_d;
+  ReplayPatch patch;
+
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  list_d = static_cast<PainterDisplayListPrivate*>(list.m_d);
+  FASTUIDRAWassert(!d->m_accumulated_draws.empty());
+  FASTUIDRAWassert(list_d->m_backend == d->m_backend.get());
+
+  d->flush_sort_buckets();
+  patch.m_item_matrix = item_matrix * list_d->m_base_item_matrix_inverse;
+  patch.m_clip = clip;
+  for(const DisplayListSegment &S : list_d->m_segments)
+    {
+      d->append_recorded(S.content(), z_offset, &patch);
+    }
+  d->m_stats[num_headers] += list_d->m_number_headers;
+  if (d->m_sub_mode)
+    {
+      d->m_retained.add(list_d->m_resources);
+    }
+}
+
+void
+fastuidraw::PainterPacker::
+retain_glyphs(c_array<const Glyph> glyphs)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  if (d->m_sub_mode)
+    {
+      d->m_retained.add_glyphs(glyphs);
+    }
 }
 
 unsigned int
@@ -1042,10 +2285,14 @@ query_stat(enum stats_t st) const
   if (!d->m_accumulated_draws.empty())
     {
       per_draw_command &c(d->m_accumulated_draws.back());
-      tmp[num_attributes] = c.m_attributes_written;
+      tmp[num_attributes] = c.m_attributes_written + c.m_compact_attributes_written;
       tmp[num_indices] = c.m_indices_written;
       tmp[num_generic_datas] = c.store_written();
       tmp[num_draws] = 1u;
+      tmp[num_draw_breaks] = c.m_draw_breaks;
+      tmp[num_attribute_bytes] = c.attribute_bytes_written();
+      tmp[num_index_bytes] = c.index_bytes_written();
+      tmp[num_compact_attributes] = c.m_compact_attributes_written;
     }
   return d->m_stats[st] + tmp[st];
 }
@@ -1056,18 +2303,16 @@ end(void)
 {
   PainterPackerPrivate *d;
   d = static_cast<PainterPackerPrivate*>(m_d);
-  if (!d->m_accumulated_draws.empty())
-    {
-      per_draw_command &c(d->m_accumulated_draws.back());
-
-      d->m_stats[fastuidraw::PainterPacker::num_attributes] += c.m_attributes_written;
-      d->m_stats[fastuidraw::PainterPacker::num_indices] += c.m_indices_written;
-      d->m_stats[fastuidraw::PainterPacker::num_generic_datas] += c.store_written();
-      d->m_stats[fastuidraw::PainterPacker::num_draws] += 1u;
 
-      c.unmap();
+  d->flush_sort_buckets();
+  if (d->m_sub_mode)
+    {
+      d->end_sub();
+      return;
     }
 
+  d->finish_current_command();
+
   d->m_backend->on_pre_draw(d->m_surface, d->m_clear_color_buffer);
   for(per_draw_command &cmd : d->m_accumulated_draws)
     {
@@ -1087,6 +2332,7 @@ draw_break(const reference_counted_ptr<const PainterDraw::Action> &action)
 {
   PainterPackerPrivate *d;
   d = static_cast<PainterPackerPrivate*>(m_d);
+  d->flush_sort_buckets();
   d->m_accumulated_draws.back().draw_break(action);
 }
 
@@ -1136,6 +2382,28 @@ draw_generic(const reference_counted_ptr<PainterItemShader> &shader,
   d->draw_generic_implement(shader, data, src, z, call_back);
 }
 
+void
+fastuidraw::PainterPacker::
+state_sort(bool v)
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  if (!v)
+    {
+      d->flush_sort_buckets();
+    }
+  d->m_state_sort = v;
+}
+
+bool
+fastuidraw::PainterPacker::
+state_sort(void) const
+{
+  PainterPackerPrivate *d;
+  d = static_cast<PainterPackerPrivate*>(m_d);
+  return d->m_state_sort;
+}
+
 const fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas>&
 fastuidraw::PainterPacker::
 glyph_atlas(void) const
@@ -1434,3 +2702,74 @@ create_packed_value(const PainterBlendShaderData &value)
   e = d->m_blend_shader_data_pool.allocate(value, d->m_alignment);
   return fastuidraw::PainterPackedValue<PainterBlendShaderData>(e);
 }
+
+//////////////////////////////////////////
+// fastuidraw::PainterDisplayList methods
+fastuidraw::PainterDisplayList::
+PainterDisplayList(void)
+{
+  m_d = FASTUIDRAWnew PainterDisplayListPrivate();
+}
+
+fastuidraw::PainterDisplayList::
+~PainterDisplayList()
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+const fastuidraw::float3x3&
+fastuidraw::PainterDisplayList::
+base_item_matrix(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_base_item_matrix;
+}
+
+int
+fastuidraw::PainterDisplayList::
+number_z(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_number_z;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_headers(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_number_headers;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_attributes(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_number_attributes;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_indices(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_number_indices;
+}
+
+unsigned int
+fastuidraw::PainterDisplayList::
+number_generic_datas(void) const
+{
+  PainterDisplayListPrivate *d;
+  d = static_cast<PainterDisplayListPrivate*>(m_d);
+  return d->m_number_generic_datas;
+}
@@ -305,6 +305,25 @@ namespace
   }
 
 
+  void
+  draw_rounded_rect(fastuidraw::Painter *painter,
+                    const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> &shader,
+                    const fastuidraw::PainterData &draw,
+                    const fastuidraw::RoundedRect &R,
+                    const fastuidraw::reference_counted_ptr<fastuidraw::PainterPacker::DataCallBack> &callback)
+  {
+    using namespace fastuidraw;
+    vecN<PainterAttribute, PainterRoundedRectShader::number_attributes> attribs;
+    vecN<PainterIndex, PainterRoundedRectShader::number_indices> indices;
+
+    PainterRoundedRectShader::pack_attributes(R, attribs, indices);
+    painter->draw_generic(shader, draw,
+                          c_array<const PainterAttribute>(attribs),
+                          c_array<const PainterIndex>(indices),
+                          0, callback);
+  }
+
+
   class clip_rect
   {
   public:
@@ -739,6 +758,13 @@ namespace
     std::vector<int> m_fill_aa_fuzz_index_adjusts;
     std::vector<int> m_fill_aa_fuzz_start_zs;
     std::vector<int> m_fill_aa_fuzz_z_increments;
+
+    // work room for binned glyph runs
+    fastuidraw::BinnedGlyphRun::ScratchSpace m_glyph_run_scratch;
+    std::vector<unsigned int> m_glyph_bin_selector;
+    std::vector<fastuidraw::c_array<const fastuidraw::PainterAttribute> > m_glyph_attrib_chunks;
+    std::vector<fastuidraw::c_array<const fastuidraw::PainterIndex> > m_glyph_index_chunks;
+    std::vector<int> m_glyph_index_adjusts;
   };
 
   class PainterPrivate
@@ -848,6 +874,7 @@ namespace
     float m_curve_flatness;
     bool m_stroke_arc_path;
     int m_current_z;
+    unsigned int m_number_culled_glyphs;
     clip_rect_state m_clip_rect_state;
     std::vector<occluder_stack_entry> m_occluder_stack;
     std::vector<state_stack_entry> m_state_stack;
@@ -1132,6 +1159,7 @@ PainterPrivate(fastuidraw::reference_counted_ptr<fastuidraw::PainterBackend> bac
                                              .pen(0.0f, 0.0f, 0.0f, 0.0f));
   m_identiy_matrix = m_pool.create_packed_value(fastuidraw::PainterItemMatrix());
   m_current_z = 1;
+  m_number_culled_glyphs = 0;
   m_max_attribs_per_block = backend->attribs_per_mapping();
   m_max_indices_per_block = backend->indices_per_mapping();
 }
@@ -1909,17 +1937,88 @@ begin(const reference_counted_ptr<PainterBackend::Surface> &surface,
   d = static_cast<PainterPrivate*>(m_d);
 
   d->m_core->begin(surface, clear_color_buffer);
+  begin_common(surface);
+}
+
+void
+fastuidraw::Painter::
+begin_sub(const Painter &parent,
+          const reference_counted_ptr<PainterBackend::Surface> &surface)
+{
+  PainterPrivate *d, *parent_d;
+  d = static_cast<PainterPrivate*>(m_d);
+  parent_d = static_cast<PainterPrivate*>(parent.m_d);
+
+  d->m_core->begin_sub(*parent_d->m_core);
+  begin_common(surface);
+}
+
+void
+fastuidraw::Painter::
+begin_common(const reference_counted_ptr<PainterBackend::Surface> &surface)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
   d->m_resolution = vec2(surface->viewport().m_dimensions);
   d->m_resolution.x() = std::max(1.0f, d->m_resolution.x());
   d->m_resolution.y() = std::max(1.0f, d->m_resolution.y());
   d->m_one_pixel_width = 1.0f / d->m_resolution;
 
   d->m_current_z = 1;
+  d->m_number_culled_glyphs = 0;
   d->m_clip_rect_state.reset();
   d->m_clip_store.set_current(d->m_clip_rect_state.clip_equations().m_clip_equations);
   blend_shader(PainterEnums::blend_porter_duff_src_over);
 }
 
+void
+fastuidraw::Painter::
+submit_sub(const Painter &sub)
+{
+  PainterPrivate *d, *sub_d;
+  d = static_cast<PainterPrivate*>(m_d);
+  sub_d = static_cast<PainterPrivate*>(sub.m_d);
+
+  /* the content of sub starts at z = 1, place it at the
+   * current z of this Painter and then increment the z of
+   * this Painter past the z-values used by sub so that
+   * content drawn afterwards is not occluded by the
+   * occluders sub used.
+   */
+  d->m_core->submit_sub(*sub_d->m_core, d->m_current_z - 1);
+  d->m_current_z += sub_d->m_current_z - 1;
+  d->m_number_culled_glyphs += sub_d->m_number_culled_glyphs;
+}
+
+fastuidraw::reference_counted_ptr<fastuidraw::PainterDisplayList>
+fastuidraw::Painter::
+create_display_list(const float3x3 &base_transformation)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  /* the content starts at z = 1 */
+  return d->m_core->create_display_list(base_transformation, d->m_current_z - 1);
+}
+
+void
+fastuidraw::Painter::
+draw_display_list(const PainterDisplayList &list)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  if (!d->m_clip_rect_state.m_all_content_culled)
+    {
+      d->m_core->draw_display_list(list,
+                                   d->m_clip_rect_state.item_matrix(),
+                                   d->m_clip_rect_state.clip_equations(),
+                                   d->m_current_z - 1);
+    }
+  d->m_current_z += list.number_z();
+}
+
 void
 fastuidraw::Painter::
 end(void)
@@ -1999,6 +2098,24 @@ queue_action(const reference_counted_ptr<const PainterDraw::Action> &action)
   d->m_core->draw_break(action);
 }
 
+void
+fastuidraw::Painter::
+state_sort(bool v)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  d->m_core->state_sort(v);
+}
+
+bool
+fastuidraw::Painter::
+state_sort(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_core->state_sort();
+}
+
 void
 fastuidraw::Painter::
 draw_convex_polygon(const PainterFillShader &shader,
@@ -2097,6 +2214,26 @@ draw_rect(const PainterData &draw, const vec2 &p, const vec2 &wh,
   draw_rect(default_shaders().fill_shader(), draw, p, wh, call_back);
 }
 
+void
+fastuidraw::Painter::
+fill_rounded_rect(const PainterRoundedRectShader &shader, const PainterData &draw,
+                  const RoundedRect &R,
+                  const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  if (R.m_min_point.x() < R.m_max_point.x() && R.m_min_point.y() < R.m_max_point.y())
+    {
+      draw_rounded_rect(this, shader.item_shader(), draw, R, call_back);
+    }
+}
+
+void
+fastuidraw::Painter::
+fill_rounded_rect(const PainterData &draw, const RoundedRect &R,
+                  const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  fill_rounded_rect(default_shaders().rounded_rect_shader(), draw, R, call_back);
+}
+
 void
 fastuidraw::Painter::
 stroke_path(const PainterStrokeShader &shader, const PainterData &draw,
@@ -2452,6 +2589,7 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
       return;
     }
 
+  d->m_core->retain_glyphs(data.pinned_glyphs());
   c_array<const unsigned int> chks(data.non_empty_index_data_chunks());
   for(unsigned int i = 0; i < chks.size(); ++i)
     {
@@ -2482,6 +2620,87 @@ draw_glyphs(const PainterData &draw,
     }
 }
 
+void
+fastuidraw::Painter::
+draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
+            const BinnedGlyphRun &data,
+            const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  PainterPrivate *d;
+  unsigned int num_bins, num_drawn, num_types;
+
+  d = static_cast<PainterPrivate*>(m_d);
+  if (d->m_clip_rect_state.m_all_content_culled)
+    {
+      d->m_number_culled_glyphs += data.number_glyphs();
+      return;
+    }
+
+  d->m_work_room.m_glyph_bin_selector.resize(data.number_bins());
+  num_bins = data.select_bins(d->m_work_room.m_glyph_run_scratch,
+                              d->m_clip_store.current(),
+                              d->m_clip_rect_state.item_matrix(),
+                              make_c_array(d->m_work_room.m_glyph_bin_selector));
+
+  c_array<const unsigned int> bins;
+  bins = make_c_array(d->m_work_room.m_glyph_bin_selector).sub_array(0, num_bins);
+
+  num_drawn = 0;
+  num_types = 0;
+  for(unsigned int b : bins)
+    {
+      d->m_core->retain_glyphs(data.bin_data(b).pinned_glyphs());
+      num_drawn += data.bin_number_glyphs(b);
+      num_types = t_max(num_types, static_cast<unsigned int>(data.bin_data(b).index_data_chunks().size()));
+    }
+  d->m_number_culled_glyphs += data.number_glyphs() - num_drawn;
+
+  /* draw the glyphs of all selected bins with one call
+   * to draw_generic() per glyph type.
+   */
+  for(unsigned int t = 0; t < num_types; ++t)
+    {
+      d->m_work_room.m_glyph_attrib_chunks.clear();
+      d->m_work_room.m_glyph_index_chunks.clear();
+      d->m_work_room.m_glyph_index_adjusts.clear();
+      for(unsigned int b : bins)
+        {
+          const PainterAttributeData &bin_data(data.bin_data(b));
+          if (!bin_data.index_data_chunk(t).empty())
+            {
+              d->m_work_room.m_glyph_attrib_chunks.push_back(bin_data.attribute_data_chunk(t));
+              d->m_work_room.m_glyph_index_chunks.push_back(bin_data.index_data_chunk(t));
+              d->m_work_room.m_glyph_index_adjusts.push_back(bin_data.index_adjust_chunk(t));
+            }
+        }
+
+      if (!d->m_work_room.m_glyph_index_chunks.empty())
+        {
+          draw_generic(shader.shader(static_cast<enum glyph_type>(t)), draw,
+                       make_c_array(d->m_work_room.m_glyph_attrib_chunks),
+                       make_c_array(d->m_work_room.m_glyph_index_chunks),
+                       make_c_array(d->m_work_room.m_glyph_index_adjusts),
+                       call_back);
+        }
+    }
+}
+
+void
+fastuidraw::Painter::
+draw_glyphs(const PainterData &draw,
+            const BinnedGlyphRun &data, bool use_anistopic_antialias,
+            const reference_counted_ptr<PainterPacker::DataCallBack> &call_back)
+{
+  if (use_anistopic_antialias)
+    {
+      draw_glyphs(default_shaders().glyph_shader_anisotropic(), draw, data, call_back);
+    }
+  else
+    {
+      draw_glyphs(default_shaders().glyph_shader(), draw, data, call_back);
+    }
+}
+
 const fastuidraw::PainterItemMatrix&
 fastuidraw::Painter::
 transformation(void)
@@ -2816,6 +3035,133 @@ clipInPath(const Path &path, const CustomFillRuleBase &fill_rule)
   clipOutPath(path, ComplementFillRule(&fill_rule));
 }
 
+void
+fastuidraw::Painter::
+clipOutRoundedRect(const RoundedRect &R)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  if (d->m_clip_rect_state.m_all_content_culled
+      || R.m_min_point.x() >= R.m_max_point.x()
+      || R.m_min_point.y() >= R.m_max_point.y())
+    {
+      /* everything is clipped anyways or the rounded
+       * rect is empty, either way there is nothing to do.
+       */
+      return;
+    }
+
+  reference_counted_ptr<PainterBlendShader> old_blend;
+  BlendMode::packed_value old_blend_mode;
+  reference_counted_ptr<ZDataCallBack> zdatacallback;
+
+  /* the occluder is the inside of the rounded rect, drawn
+   * with a shader that discards the fragments outside of it.
+   */
+  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+  old_blend = blend_shader();
+  old_blend_mode = blend_mode();
+
+  blend_shader(PainterEnums::blend_porter_duff_dst);
+  draw_rounded_rect(this, default_shaders().rounded_rect_shader().clip_inside_shader(),
+                    PainterData(d->m_black_brush), R, zdatacallback);
+  blend_shader(old_blend, old_blend_mode);
+
+  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+}
+
+void
+fastuidraw::Painter::
+clipInRoundedRect(const RoundedRect &R)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  if (d->m_clip_rect_state.m_all_content_culled)
+    {
+      /* everything is clipped anyways, adding more clipping does not matter
+       */
+      return;
+    }
+
+  /* clip to the bounding rect of the rounded rect and then
+   * occlude the portion of the bounding rect that is outside
+   * of the rounded rect, i.e. the corners.
+   */
+  clipInRect(R.m_min_point, R.m_max_point - R.m_min_point);
+  if (d->m_clip_rect_state.m_all_content_culled)
+    {
+      return;
+    }
+
+  reference_counted_ptr<PainterBlendShader> old_blend;
+  BlendMode::packed_value old_blend_mode;
+  reference_counted_ptr<ZDataCallBack> zdatacallback;
+
+  zdatacallback = FASTUIDRAWnew ZDataCallBack();
+  old_blend = blend_shader();
+  old_blend_mode = blend_mode();
+
+  blend_shader(PainterEnums::blend_porter_duff_dst);
+  draw_rounded_rect(this, default_shaders().rounded_rect_shader().clip_outside_shader(),
+                    PainterData(d->m_black_brush), R, zdatacallback);
+  blend_shader(old_blend, old_blend_mode);
+
+  d->m_occluder_stack.push_back(occluder_stack_entry(zdatacallback->m_actions));
+}
+
+void
+fastuidraw::Painter::
+setClip(const SimplePath &path)
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+
+  float3x3 m(d->m_clip_rect_state.item_matrix());
+  unsigned int occluder_stack_position(0);
+
+  /* return the clipping to the state at the last save(), but
+   * keep the current transformation; this is the same as
+   * restore() followed by save() except that only the clipping
+   * state is touched.
+   */
+  if (d->m_state_stack.empty())
+    {
+      d->m_clip_rect_state.reset();
+      d->m_clip_store.set_current(d->m_clip_rect_state.clip_equations().m_clip_equations);
+    }
+  else
+    {
+      const state_stack_entry &st(d->m_state_stack.back());
+
+      occluder_stack_position = st.m_occluder_stack_position;
+      d->m_clip_rect_state = st.m_clip_rect_state;
+      d->m_clip_store.pop();
+      d->m_clip_store.push();
+    }
+
+  while(d->m_occluder_stack.size() > occluder_stack_position)
+    {
+      d->m_occluder_stack.back().on_pop(this);
+      d->m_occluder_stack.pop_back();
+    }
+  d->m_clip_rect_state.item_matrix(m, true);
+
+  if (path.empty())
+    {
+      /* the region is empty, so everything is clipped */
+      clipInRect(vec2(0.0f, 0.0f), vec2(0.0f, 0.0f));
+    }
+  else
+    {
+      /* a SimplePath has winding number 0 or 1 everywhere,
+       * thus any non-complement fill rule gives its region.
+       */
+      clipInPath(path.path(), PainterEnums::nonzero_fill_rule);
+    }
+}
+
 void
 fastuidraw::Painter::
 clipInRect(const vec2 &pmin, const vec2 &wh)
@@ -3030,6 +3376,15 @@ query_stat(enum PainterPacker::stats_t st) const
   return d->m_core->query_stat(st);
 }
 
+unsigned int
+fastuidraw::Painter::
+number_culled_glyphs(void) const
+{
+  PainterPrivate *d;
+  d = static_cast<PainterPrivate*>(m_d);
+  return d->m_number_culled_glyphs;
+}
+
 int
 fastuidraw::Painter::
 current_z(void) const
@@ -0,0 +1,131 @@
+/*!
+ * \file painter_attribute.cpp
+ * \brief file painter_attribute.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <cmath>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/painter/painter_attribute.hpp>
+
+namespace
+{
+  /* returns false if v (which may be NaN) does not
+   * fit in a signed 16-bit integer.
+   */
+  inline
+  bool
+  fits_int16(float v)
+  {
+    return v >= -32768.0f && v <= 32767.0f;
+  }
+
+  /* stores the float whose bits are v in dst if it is
+   * an integer that fits in a signed 16-bit integer.
+   */
+  inline
+  bool
+  pack_integer(uint32_t v, int16_t &dst)
+  {
+    float f(fastuidraw::unpack_float(v));
+
+    if (!fits_int16(f) || f != std::floor(f))
+      {
+        return false;
+      }
+    dst = static_cast<int16_t>(f);
+    return true;
+  }
+
+  /* stores the float whose bits are v quantized to
+   * units of 2^-position_fraction_bits in dst.
+   */
+  inline
+  bool
+  pack_position(uint32_t v, int16_t &dst)
+  {
+    const float scale(static_cast<float>(1u << fastuidraw::PainterCompactAttribute::position_fraction_bits));
+    float f(std::round(scale * fastuidraw::unpack_float(v)));
+
+    if (!fits_int16(f))
+      {
+        return false;
+      }
+    dst = static_cast<int16_t>(f);
+    return true;
+  }
+}
+
+////////////////////////////////////////////
+// fastuidraw::PainterCompactAttribute methods
+bool
+fastuidraw::PainterCompactAttribute::
+pack(enum layout_t layout, const PainterAttribute &src,
+     uint32_t header_location)
+{
+  FASTUIDRAWassert(header_location < (1u << number_header_location_bits));
+  switch(layout)
+    {
+    case fill_layout:
+      {
+        if (src.m_attrib0.z() != 0u || src.m_attrib0.w() != 0u
+            || src.m_attrib1 != uvec4(0u, 0u, 0u, 0u)
+            || src.m_attrib2 != uvec4(0u, 0u, 0u, 0u)
+            || !pack_position(src.m_attrib0.x(), m_position.x())
+            || !pack_position(src.m_attrib0.y(), m_position.y()))
+          {
+            return false;
+          }
+        m_texel = vecN<int16_t, 4>(0, 0, 0, 0);
+        m_layer = vecN<int16_t, 2>(0, 0);
+        m_data = 0u;
+        m_header = header_location | (1u << compact_bit);
+      }
+      return true;
+
+    case glyph_layout:
+      {
+        if (src.m_attrib1.z() != 0u || src.m_attrib1.w() != 0u
+            || src.m_attrib2.x() != 0u
+            || !pack_position(src.m_attrib1.x(), m_position.x())
+            || !pack_position(src.m_attrib1.y(), m_position.y()))
+          {
+            return false;
+          }
+
+        for(unsigned int i = 0; i < 4; ++i)
+          {
+            if (!pack_integer(src.m_attrib0[i], m_texel[i]))
+              {
+                return false;
+              }
+          }
+
+        for(unsigned int i = 0; i < 2; ++i)
+          {
+            if (!pack_integer(src.m_attrib2[2 + i], m_layer[i]))
+              {
+                return false;
+              }
+          }
+        m_data = src.m_attrib2.y();
+        m_header = header_location | (1u << compact_bit) | (1u << glyph_layout_bit);
+      }
+      return true;
+
+    default:
+      return false;
+    }
+}
@@ -20,6 +20,7 @@
 #include <vector>
 #include <fastuidraw/util/fastuidraw_memory.hpp>
 #include <fastuidraw/painter/painter_attribute_data.hpp>
+#include <fastuidraw/text/glyph_cache.hpp>
 #include "../private/util_private.hpp"
 
 namespace
@@ -27,9 +28,17 @@ namespace
   class PainterAttributeDataPrivate
   {
   public:
+    ~PainterAttributeDataPrivate()
+    {
+      unpin_glyphs();
+    }
+
     void
     post_process_fill(void);
 
+    void
+    unpin_glyphs(void);
+
     std::vector<fastuidraw::PainterAttribute> m_attribute_data;
     std::vector<fastuidraw::PainterIndex> m_index_data;
 
@@ -39,9 +48,28 @@ namespace
     std::vector<unsigned int> m_non_empty_index_data_chunks;
     std::vector<int> m_index_adjust_chunks;
     unsigned int m_largest_attribute_chunk, m_largest_index_chunk;
+
+    /* glyphs whose atlas locations are in m_attribute_data
+     * and the caches holding them, kept alive so that the
+     * glyphs can be unpinned.
+     */
+    std::vector<fastuidraw::Glyph> m_pinned_glyphs;
+    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> > m_glyph_caches;
   };
 }
 
+void
+PainterAttributeDataPrivate::
+unpin_glyphs(void)
+{
+  for(const fastuidraw::Glyph &G : m_pinned_glyphs)
+    {
+      G.unpin();
+    }
+  m_pinned_glyphs.clear();
+  m_glyph_caches.clear();
+}
+
 void
 PainterAttributeDataPrivate::
 post_process_fill(void)
@@ -119,6 +147,31 @@ set_data(const PainterAttributeDataFiller &filler)
                    make_c_array(d->m_index_adjust_chunks));
 
   d->post_process_fill();
+
+  /* pin the new glyphs before unpinning the old ones so that
+   * a glyph in both is not made evictable in between.
+   */
+  c_array<const Glyph> glyphs(filler.packed_glyphs());
+  std::vector<Glyph> prev_pinned;
+  std::vector<reference_counted_ptr<GlyphCache> > prev_caches;
+
+  prev_pinned.swap(d->m_pinned_glyphs);
+  prev_caches.swap(d->m_glyph_caches);
+  d->m_pinned_glyphs.assign(glyphs.begin(), glyphs.end());
+  for(const Glyph &G : d->m_pinned_glyphs)
+    {
+      reference_counted_ptr<GlyphCache> cache(G.cache());
+
+      G.pin();
+      if (cache && (d->m_glyph_caches.empty() || d->m_glyph_caches.back() != cache))
+        {
+          d->m_glyph_caches.push_back(cache);
+        }
+    }
+  for(const Glyph &G : prev_pinned)
+    {
+      G.unpin();
+    }
 }
 
 fastuidraw::c_array<const fastuidraw::c_array<const fastuidraw::PainterAttribute> >
@@ -227,3 +280,27 @@ largest_index_chunk(void) const
   d = static_cast<PainterAttributeDataPrivate*>(m_d);
   return d->m_largest_index_chunk;
 }
+
+uint64_t
+fastuidraw::PainterAttributeData::
+memory_usage(void) const
+{
+  PainterAttributeDataPrivate *d;
+  d = static_cast<PainterAttributeDataPrivate*>(m_d);
+  return d->m_attribute_data.capacity() * sizeof(PainterAttribute)
+    + d->m_index_data.capacity() * sizeof(PainterIndex)
+    + d->m_attribute_chunks.capacity() * sizeof(c_array<const PainterAttribute>)
+    + d->m_index_chunks.capacity() * sizeof(c_array<const PainterIndex>)
+    + d->m_z_ranges.capacity() * sizeof(range_type<int>)
+    + d->m_non_empty_index_data_chunks.capacity() * sizeof(unsigned int)
+    + d->m_index_adjust_chunks.capacity() * sizeof(int);
+}
+
+fastuidraw::c_array<const fastuidraw::Glyph>
+fastuidraw::PainterAttributeData::
+pinned_glyphs(void) const
+{
+  PainterAttributeDataPrivate *d;
+  d = static_cast<PainterAttributeDataPrivate*>(m_d);
+  return make_c_array(d->m_pinned_glyphs);
+}
@@ -251,6 +251,24 @@ fastuidraw::PainterAttributeDataFillerGlyphs::
   m_d = nullptr;
 }
 
+unsigned int
+fastuidraw::PainterAttributeDataFillerGlyphs::
+number_glyphs(void) const
+{
+  FillGlyphsPrivate *d;
+  d = static_cast<FillGlyphsPrivate*>(m_d);
+  return d->m_number_glyphs;
+}
+
+fastuidraw::c_array<const fastuidraw::Glyph>
+fastuidraw::PainterAttributeDataFillerGlyphs::
+packed_glyphs(void) const
+{
+  FillGlyphsPrivate *d;
+  d = static_cast<FillGlyphsPrivate*>(m_d);
+  return d->m_glyphs.sub_array(0, d->m_number_glyphs);
+}
+
 void
 fastuidraw::PainterAttributeDataFillerGlyphs::
 compute_sizes(unsigned int &number_attributes,
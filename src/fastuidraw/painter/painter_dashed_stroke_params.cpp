@@ -55,6 +55,52 @@ namespace
     std::vector<fastuidraw::PainterDashedStrokeParams::DashPatternElement> m_dash_pattern;
     std::vector<fastuidraw::generic_data> m_dash_pattern_packed;
   };
+
+  unsigned int
+  number_tree_nodes(unsigned int number_intervals, unsigned int alignment)
+  {
+    return (number_intervals + alignment - 1u) / alignment;
+  }
+
+  /* Place the sorted values of keys into the nodes of the tree
+   * rooted at node by an in-order traversal, t is the index
+   * into keys of the next key to place. Nodes past the last
+   * key are padded with pad_value and given the rank keys.size().
+   */
+  void
+  build_dash_pattern_tree(unsigned int node, unsigned int alignment,
+                          unsigned int num_nodes,
+                          fastuidraw::c_array<const fastuidraw::generic_data> keys,
+                          float pad_value, unsigned int &t,
+                          fastuidraw::c_array<fastuidraw::generic_data> dst_keys,
+                          fastuidraw::c_array<fastuidraw::generic_data> dst_ranks)
+  {
+    if (node >= num_nodes)
+      {
+        return;
+      }
+
+    for(unsigned int i = 0; i < alignment; ++i)
+      {
+        unsigned int slot(node * alignment + i);
+
+        build_dash_pattern_tree(node * (alignment + 1u) + 1u + i, alignment, num_nodes,
+                                keys, pad_value, t, dst_keys, dst_ranks);
+        if (t < keys.size())
+          {
+            dst_keys[slot].f = keys[t].f;
+            dst_ranks[slot].u = t;
+            ++t;
+          }
+        else
+          {
+            dst_keys[slot].f = pad_value;
+            dst_ranks[slot].u = keys.size();
+          }
+      }
+    build_dash_pattern_tree(node * (alignment + 1u) + 1u + alignment, alignment, num_nodes,
+                            keys, pad_value, t, dst_keys, dst_ranks);
+  }
 }
 
 //////////////////////////////////////
@@ -82,8 +128,9 @@ PainterDashedStrokeParamsData::
 data_size(unsigned int alignment) const
 {
   using namespace fastuidraw;
+  /* the tree nodes followed by the ranks of the keys of the nodes */
   return round_up_to_multiple(PainterDashedStrokeParams::stroke_static_data_size, alignment)
-    + round_up_to_multiple(2 * m_dash_pattern.size(), alignment);
+    + 2u * alignment * number_tree_nodes(m_dash_pattern_packed.size(), alignment);
 }
 
 void
@@ -110,14 +157,19 @@ pack_data(unsigned int alignment, fastuidraw::c_array<fastuidraw::generic_data>
   if (!m_dash_pattern_packed.empty())
     {
       c_array<generic_data> dst_pattern;
+      unsigned int num_nodes, t(0);
+
+      num_nodes = number_tree_nodes(m_dash_pattern_packed.size(), alignment);
       dst_pattern = dst.sub_array(round_up_to_multiple(PainterDashedStrokeParams::stroke_static_data_size, alignment));
-      std::copy(m_dash_pattern_packed.begin(), m_dash_pattern_packed.end(), dst_pattern.begin());
-      for(unsigned int i = m_dash_pattern_packed.size(), endi = dst_pattern.size(); i < endi; ++i)
-        {
-          //make the last entry larger than the total length so a
-          //shader can use that to know when it has reached the end.
-          dst_pattern[i].f = m_total_length * 2.0f + 1.0f;
-        }
+
+      //pad with a value larger than the total length so
+      //that padding is never the result of a search.
+      build_dash_pattern_tree(0, alignment, num_nodes,
+                              make_c_array(m_dash_pattern_packed),
+                              m_total_length * 2.0f + 1.0f, t,
+                              dst_pattern.sub_array(0, num_nodes * alignment),
+                              dst_pattern.sub_array(num_nodes * alignment, num_nodes * alignment));
+      FASTUIDRAWassert(t == m_dash_pattern_packed.size());
     }
 }
 
@@ -340,6 +392,77 @@ stroking_units(enum PainterStrokeParams::stroking_units_t v)
   return *this;
 }
 
+float
+fastuidraw::PainterDashedStrokeParams::
+compute_interval(unsigned int alignment,
+                 c_array<const generic_data> intervals,
+                 float total_distance, float first_interval_start,
+                 float in_distance, unsigned int number_intervals,
+                 int *out_interval_id,
+                 float *out_interval_begin, float *out_interval_end)
+{
+  int num_nodes, k, succ_node, succ_slot;
+  float fd, ff, d, pred, succ;
+
+  FASTUIDRAWassert(alignment >= 1u && alignment <= 4u);
+
+  fd = std::floor(in_distance / total_distance);
+  ff = total_distance * fd;
+  d = in_distance - ff;
+  pred = first_interval_start;
+  succ = 0.0f;
+  succ_node = -1;
+  succ_slot = 0;
+  num_nodes = number_tree_nodes(number_intervals, alignment);
+
+  *out_interval_id = -1;
+  *out_interval_begin = 0.0f;
+  *out_interval_end = 0.0f;
+
+  for(k = 0; k < num_nodes;)
+    {
+      c_array<const generic_data> node;
+      int c(0);
+
+      /* c = number of keys of the node that are no more than d */
+      node = intervals.sub_array(k * alignment, alignment);
+      for(unsigned int i = 0; i < alignment; ++i)
+        {
+          c += (d >= node[i].f) ? 1 : 0;
+        }
+
+      if (c > 0)
+        {
+          pred = node[c - 1].f;
+        }
+
+      if (c < int(alignment))
+        {
+          succ = node[c].f;
+          succ_node = k;
+          succ_slot = c;
+        }
+      k = k * (alignment + 1) + 1 + c;
+    }
+
+  if (succ_node == -1)
+    {
+      return -1.0f;
+    }
+
+  unsigned int rank;
+  rank = intervals[(num_nodes + succ_node) * alignment + succ_slot].u;
+  if (rank >= number_intervals)
+    {
+      return -1.0f;
+    }
+
+  *out_interval_begin = ff + pred;
+  *out_interval_end = ff + succ;
+  *out_interval_id = int(rank) + int(fd) * int(number_intervals);
+  return (rank & 1u) == 0u ? 1.0f : -1.0f;
+}
+
 fastuidraw::reference_counted_ptr<const fastuidraw::StrokingDataSelectorBase>
 fastuidraw::PainterDashedStrokeParams::
 stroking_data_selector(void)
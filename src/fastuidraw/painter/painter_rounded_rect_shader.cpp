@@ -0,0 +1,113 @@
+/*!
+ * \file painter_rounded_rect_shader.cpp
+ * \brief file painter_rounded_rect_shader.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <utility>
+#include <fastuidraw/painter/painter_rounded_rect_shader.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class PainterRoundedRectShaderPrivate
+  {
+  public:
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> m_item_shader;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> m_clip_inside_shader;
+    fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader> m_clip_outside_shader;
+  };
+}
+
+//////////////////////////////////////////
+// fastuidraw::PainterRoundedRectShader methods
+fastuidraw::PainterRoundedRectShader::
+PainterRoundedRectShader(void)
+{
+  m_d = FASTUIDRAWnew PainterRoundedRectShaderPrivate();
+}
+
+fastuidraw::PainterRoundedRectShader::
+PainterRoundedRectShader(const PainterRoundedRectShader &obj)
+{
+  PainterRoundedRectShaderPrivate *d;
+  d = static_cast<PainterRoundedRectShaderPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew PainterRoundedRectShaderPrivate(*d);
+}
+
+fastuidraw::PainterRoundedRectShader::
+~PainterRoundedRectShader()
+{
+  PainterRoundedRectShaderPrivate *d;
+  d = static_cast<PainterRoundedRectShaderPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::PainterRoundedRectShader::
+pack_attributes(const RoundedRect &in_R,
+                c_array<PainterAttribute> dst_attribs,
+                c_array<PainterIndex> dst_indices)
+{
+  RoundedRect R(in_R.sanitized());
+  vecN<vec2, number_attributes> pts;
+  uvec4 radii0, radii1;
+
+  FASTUIDRAWassert(dst_attribs.size() >= number_attributes);
+  FASTUIDRAWassert(dst_indices.size() >= number_indices);
+
+  /* the corners are ordered around the quad so that
+   * corner i and corner (i + 2) % 4 are opposite.
+   */
+  pts[0] = vec2(R.m_min_point.x(), R.m_min_point.y());
+  pts[1] = vec2(R.m_min_point.x(), R.m_max_point.y());
+  pts[2] = vec2(R.m_max_point.x(), R.m_max_point.y());
+  pts[3] = vec2(R.m_max_point.x(), R.m_min_point.y());
+
+  radii0 = pack_vec4(R.m_corner_radii[RoundedRect::minx_miny_corner].x(),
+                     R.m_corner_radii[RoundedRect::minx_miny_corner].y(),
+                     R.m_corner_radii[RoundedRect::maxx_miny_corner].x(),
+                     R.m_corner_radii[RoundedRect::maxx_miny_corner].y());
+  radii1 = pack_vec4(R.m_corner_radii[RoundedRect::minx_maxy_corner].x(),
+                     R.m_corner_radii[RoundedRect::minx_maxy_corner].y(),
+                     R.m_corner_radii[RoundedRect::maxx_maxy_corner].x(),
+                     R.m_corner_radii[RoundedRect::maxx_maxy_corner].y());
+
+  for(unsigned int i = 0; i < number_attributes; ++i)
+    {
+      const vec2 &p(pts[i]);
+      const vec2 &q(pts[(i + 2) % 4]);
+
+      dst_attribs[i].m_attrib0 = pack_vec4(p.x(), p.y(), q.x(), q.y());
+      dst_attribs[i].m_attrib1 = radii0;
+      dst_attribs[i].m_attrib2 = radii1;
+    }
+
+  dst_indices[0] = 0;
+  dst_indices[1] = 1;
+  dst_indices[2] = 2;
+  dst_indices[3] = 0;
+  dst_indices[4] = 2;
+  dst_indices[5] = 3;
+}
+
+assign_swap_implement(fastuidraw::PainterRoundedRectShader)
+setget_implement(fastuidraw::PainterRoundedRectShader, PainterRoundedRectShaderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader>&, item_shader)
+setget_implement(fastuidraw::PainterRoundedRectShader, PainterRoundedRectShaderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader>&, clip_inside_shader)
+setget_implement(fastuidraw::PainterRoundedRectShader, PainterRoundedRectShaderPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::PainterItemShader>&, clip_outside_shader)
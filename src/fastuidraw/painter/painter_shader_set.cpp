@@ -29,6 +29,7 @@ namespace
     fastuidraw::PainterStrokeShader m_stroke_shader;
     fastuidraw::PainterDashedStrokeShaderSet m_dashed_stroke_shader;
     fastuidraw::PainterFillShader m_fill_shader;
+    fastuidraw::PainterRoundedRectShader m_rounded_rect_shader;
     fastuidraw::PainterBlendShaderSet m_blend_shaders;
   };
 }
@@ -74,5 +75,8 @@ setget_implement(fastuidraw::PainterShaderSet, PainterShaderSetPrivate,
 setget_implement(fastuidraw::PainterShaderSet, PainterShaderSetPrivate,
                  const fastuidraw::PainterFillShader&, fill_shader)
 
+setget_implement(fastuidraw::PainterShaderSet, PainterShaderSetPrivate,
+                 const fastuidraw::PainterRoundedRectShader&, rounded_rect_shader)
+
 setget_implement(fastuidraw::PainterShaderSet, PainterShaderSetPrivate,
                  const fastuidraw::PainterBlendShaderSet&, blend_shaders)
@@ -0,0 +1,701 @@
+/*!
+ * \file simple_path.cpp
+ * \brief file simple_path.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <map>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/painter/simple_path.hpp>
+#include "../private/util_private.hpp"
+#include "../private/bounding_box.hpp"
+#include "../../3rd_party/glu-tess/glu-tess.hpp"
+
+namespace
+{
+  typedef std::vector<fastuidraw::dvec2> DContour;
+
+  class SimplePathPrivate
+  {
+  public:
+    void
+    set_contours(const std::vector<DContour> &contours);
+
+    std::vector<std::vector<fastuidraw::vec2> > m_contours;
+    fastuidraw::BoundingBox<float> m_bounds;
+    fastuidraw::Path m_path;
+  };
+
+  /* fill rule of a boolean operation, as described in
+   * SimplePath::boolean_op_t given that the contours of
+   * each operand are added so that the region of the
+   * operand has winding number 1, except for difference_op
+   * where the contours of all but the first operand are
+   * reversed.
+   */
+  class BooleanOpFillRule:public fastuidraw::CustomFillRuleBase
+  {
+  public:
+    BooleanOpFillRule(enum fastuidraw::SimplePath::boolean_op_t op,
+                      unsigned int number_operands):
+      m_op(op),
+      m_number_operands(number_operands)
+    {}
+
+    virtual
+    bool
+    operator()(int winding_number) const;
+
+  private:
+    enum fastuidraw::SimplePath::boolean_op_t m_op;
+    int m_number_operands;
+  };
+
+  /* An OutlineBuilder feeds contours to the GLU tessellator
+   * and collects the boundaries of those winding components
+   * that are filled by a fill rule. The boundaries emitted by
+   * GLU are per winding number, so an edge separating two
+   * filled components is emitted twice, once in each direction;
+   * such pairs are removed and the remaining edges are chained
+   * into the contours of the outline.
+   */
+  class OutlineBuilder:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    OutlineBuilder(const fastuidraw::CustomFillRuleBase &fill_rule);
+
+    void
+    add_contour(fastuidraw::c_array<const fastuidraw::vec2> pts, bool reverse);
+
+    void
+    add_contour(const DContour &pts);
+
+    void
+    add_path(const fastuidraw::Path &path, float thresh);
+
+    void
+    add_simple_path(const fastuidraw::SimplePath &path, bool reverse);
+
+    void
+    build(std::vector<DContour> &out_contours);
+
+  private:
+    typedef std::pair<unsigned int, unsigned int> edge;
+
+    unsigned int
+    add_point(const fastuidraw::dvec2 &p);
+
+    void
+    add_edge(unsigned int a, unsigned int b);
+
+    static
+    void
+    combine_callback(double x, double y, unsigned int data[4],
+                     double weight[4],  unsigned int *outData,
+                     void *tess);
+
+    static
+    void
+    boundary_callback(double *x, double *y,
+                      int step,
+                      FASTUIDRAW_GLUboolean is_max_x,
+                      FASTUIDRAW_GLUboolean is_max_y,
+                      unsigned int *outData,
+                      void *tess);
+
+    static
+    FASTUIDRAW_GLUboolean
+    winding_callback(int winding_number, void *tess);
+
+    static
+    void
+    emitboundary_callback(int winding,
+                          const unsigned int vertex_ids[],
+                          unsigned int count,
+                          void *tess);
+
+    static
+    void
+    remove_collinear_points(DContour &C);
+
+    const fastuidraw::CustomFillRuleBase &m_fill_rule;
+    std::vector<DContour> m_input;
+    fastuidraw::BoundingBox<double> m_bounds;
+
+    /* points of the tessellation; points at the same location
+     * are mapped to one point so that edges can be compared
+     */
+    std::vector<fastuidraw::dvec2> m_pts;
+    std::vector<unsigned int> m_canonical_id;
+    std::map<fastuidraw::dvec2, unsigned int> m_pt_map;
+
+    /* the points of the box GLU adds around the contours */
+    std::vector<unsigned int> m_corner_ids;
+
+    /* the directed edges of the outline, value is
+     * the number of times the edge is present
+     */
+    std::map<edge, int> m_edges;
+  };
+}
+
+//////////////////////////////////////
+// SimplePathPrivate methods
+void
+SimplePathPrivate::
+set_contours(const std::vector<DContour> &contours)
+{
+  using namespace fastuidraw;
+
+  m_contours.clear();
+  m_bounds = BoundingBox<float>();
+  m_path = Path();
+
+  m_contours.resize(contours.size());
+  for(unsigned int c = 0, endc = contours.size(); c < endc; ++c)
+    {
+      m_contours[c].reserve(contours[c].size());
+      for(const dvec2 &p : contours[c])
+        {
+          vec2 q(p.x(), p.y());
+
+          m_contours[c].push_back(q);
+          m_bounds.union_point(q);
+          m_path << q;
+        }
+      m_path << Path::contour_end();
+    }
+}
+
+//////////////////////////////////////
+// BooleanOpFillRule methods
+bool
+BooleanOpFillRule::
+operator()(int winding_number) const
+{
+  switch(m_op)
+    {
+    case fastuidraw::SimplePath::union_op:
+    case fastuidraw::SimplePath::difference_op:
+      return winding_number >= 1;
+
+    case fastuidraw::SimplePath::intersection_op:
+      return winding_number == m_number_operands;
+
+    case fastuidraw::SimplePath::xor_op:
+      return (winding_number & 1) != 0;
+    }
+  return false;
+}
+
+//////////////////////////////////////
+// OutlineBuilder methods
+OutlineBuilder::
+OutlineBuilder(const fastuidraw::CustomFillRuleBase &fill_rule):
+  m_fill_rule(fill_rule)
+{}
+
+void
+OutlineBuilder::
+add_contour(fastuidraw::c_array<const fastuidraw::vec2> pts, bool reverse)
+{
+  if (pts.size() < 3)
+    {
+      return;
+    }
+
+  m_input.push_back(DContour());
+  m_input.back().reserve(pts.size());
+  for(unsigned int i = 0, endi = pts.size(); i < endi; ++i)
+    {
+      const fastuidraw::vec2 &p(pts[reverse ? endi - 1 - i : i]);
+      m_input.back().push_back(fastuidraw::dvec2(p.x(), p.y()));
+      m_bounds.union_point(m_input.back().back());
+    }
+}
+
+void
+OutlineBuilder::
+add_contour(const DContour &pts)
+{
+  if (pts.size() < 3)
+    {
+      return;
+    }
+
+  m_input.push_back(pts);
+  for(const fastuidraw::dvec2 &p : pts)
+    {
+      m_bounds.union_point(p);
+    }
+}
+
+void
+OutlineBuilder::
+add_path(const fastuidraw::Path &path, float thresh)
+{
+  using namespace fastuidraw;
+
+  reference_counted_ptr<const TessellatedPath> tess(path.tessellation(thresh));
+  for(unsigned int c = 0, endc = tess->number_contours(); c < endc; ++c)
+    {
+      DContour C;
+
+      /* same walk of the line segments of a contour as
+       * done by FilledPath to build its sub-paths
+       */
+      for(unsigned int e = 0, ende = tess->number_edges(c); e < ende; ++e)
+        {
+          range_type<unsigned int> R(tess->edge_range(c, e));
+          for(unsigned int v = R.m_begin; v < R.m_end; ++v)
+            {
+              const vec2 &p(tess->segment_data()[v].m_start_pt);
+              C.push_back(dvec2(p.x(), p.y()));
+            }
+        }
+      add_contour(C);
+    }
+}
+
+void
+OutlineBuilder::
+add_simple_path(const fastuidraw::SimplePath &path, bool reverse)
+{
+  for(unsigned int c = 0, endc = path.number_contours(); c < endc; ++c)
+    {
+      add_contour(path.contour(c), reverse);
+    }
+}
+
+unsigned int
+OutlineBuilder::
+add_point(const fastuidraw::dvec2 &p)
+{
+  std::map<fastuidraw::dvec2, unsigned int>::iterator iter;
+  unsigned int return_value(m_canonical_id.size());
+
+  iter = m_pt_map.find(p);
+  if (iter != m_pt_map.end())
+    {
+      m_canonical_id.push_back(iter->second);
+    }
+  else
+    {
+      m_pt_map[p] = return_value;
+      m_canonical_id.push_back(return_value);
+    }
+  m_pts.push_back(p);
+  return return_value;
+}
+
+void
+OutlineBuilder::
+add_edge(unsigned int a, unsigned int b)
+{
+  std::map<edge, int>::iterator iter;
+
+  a = m_canonical_id[a];
+  b = m_canonical_id[b];
+  if (a == b)
+    {
+      return;
+    }
+
+  iter = m_edges.find(edge(b, a));
+  if (iter != m_edges.end())
+    {
+      if (--iter->second == 0)
+        {
+          m_edges.erase(iter);
+        }
+    }
+  else
+    {
+      ++m_edges[edge(a, b)];
+    }
+}
+
+void
+OutlineBuilder::
+build(std::vector<DContour> &out_contours)
+{
+  fastuidraw_GLUtesselator *tess;
+
+  out_contours.clear();
+  if (m_input.empty())
+    {
+      return;
+    }
+
+  tess = fastuidraw_gluNewTess;
+  fastuidraw_gluTessCallbackCombine(tess, &combine_callback);
+  fastuidraw_gluTessCallbackFillRule(tess, &winding_callback);
+  fastuidraw_gluTessCallbackBoundaryCornerPoint(tess, &boundary_callback);
+  fastuidraw_gluTessCallbackEmitBoundary(tess, &emitboundary_callback);
+
+  fastuidraw_gluTessBeginPolygon(tess, this);
+  for(const DContour &C : m_input)
+    {
+      fastuidraw_gluTessBeginContour(tess, FASTUIDRAW_GLU_TRUE);
+      for(const fastuidraw::dvec2 &p : C)
+        {
+          fastuidraw_gluTessVertex(tess, p.x(), p.y(), add_point(p));
+        }
+      fastuidraw_gluTessEndContour(tess);
+    }
+  fastuidraw_gluTessEndPolygon(tess);
+  fastuidraw_gluDeleteTess(tess);
+
+  /* chain the remaining edges into closed contours; the
+   * in-degree and out-degree of every point are the same
+   * since the edges are a sum of closed loops with pairs
+   * of opposite edges removed, thus every walk closes.
+   */
+  std::multimap<unsigned int, unsigned int> next;
+  for(const auto &e : m_edges)
+    {
+      for(int i = 0; i < e.second; ++i)
+        {
+          next.insert(e.first);
+        }
+    }
+
+  while(!next.empty())
+    {
+      std::multimap<unsigned int, unsigned int>::iterator iter;
+      unsigned int start, current;
+      DContour C;
+
+      iter = next.begin();
+      start = iter->first;
+      current = iter->second;
+      next.erase(iter);
+      C.push_back(m_pts[start]);
+      while(current != start)
+        {
+          C.push_back(m_pts[current]);
+          iter = next.find(current);
+          FASTUIDRAWassert(iter != next.end());
+          if (iter == next.end())
+            {
+              break;
+            }
+          current = iter->second;
+          next.erase(iter);
+        }
+
+      remove_collinear_points(C);
+      if (C.size() >= 3)
+        {
+          out_contours.push_back(C);
+        }
+    }
+}
+
+void
+OutlineBuilder::
+remove_collinear_points(DContour &C)
+{
+  bool removed_point(true);
+
+  while(removed_point && C.size() >= 3)
+    {
+      DContour tmp;
+
+      removed_point = false;
+      tmp.reserve(C.size());
+      for(unsigned int i = 0, endi = C.size(); i < endi; ++i)
+        {
+          const fastuidraw::dvec2 &prev(tmp.empty() ? C[endi - 1] : tmp.back());
+          const fastuidraw::dvec2 &next(C[(i + 1 == endi) ? 0 : i + 1]);
+          fastuidraw::dvec2 v0(C[i] - prev), v1(next - C[i]);
+          double cr, mag;
+
+          cr = v0.x() * v1.y() - v0.y() * v1.x();
+          mag = v0.magnitude() * v1.magnitude();
+          if (std::abs(cr) <= 1e-9 * mag)
+            {
+              removed_point = true;
+            }
+          else
+            {
+              tmp.push_back(C[i]);
+            }
+        }
+      C.swap(tmp);
+    }
+}
+
+void
+OutlineBuilder::
+combine_callback(double x, double y, unsigned int data[4],
+                 double weight[4],  unsigned int *outData,
+                 void *tess)
+{
+  OutlineBuilder *p;
+  fastuidraw::dvec2 pt(x, y);
+
+  FASTUIDRAWunused(data);
+  FASTUIDRAWunused(weight);
+  p = static_cast<OutlineBuilder*>(tess);
+  *outData = p->add_point(pt);
+}
+
+void
+OutlineBuilder::
+boundary_callback(double *x, double *y,
+                  int step,
+                  FASTUIDRAW_GLUboolean is_max_x,
+                  FASTUIDRAW_GLUboolean is_max_y,
+                  unsigned int *outData,
+                  void *tess)
+{
+  OutlineBuilder *p;
+  fastuidraw::dvec2 pt, delta;
+  double fudge;
+
+  /* the corners of a box strictly containing all points,
+   * GLU uses them to make the winding 0 region finite.
+   */
+  p = static_cast<OutlineBuilder*>(tess);
+  fudge = 1.0 + fastuidraw::t_max(p->m_bounds.size().x(), p->m_bounds.size().y());
+  delta = fastuidraw::dvec2(is_max_x ? fudge : -fudge,
+                            is_max_y ? fudge : -fudge);
+  pt.x() = (is_max_x) ? p->m_bounds.max_point().x() : p->m_bounds.min_point().x();
+  pt.y() = (is_max_y) ? p->m_bounds.max_point().y() : p->m_bounds.min_point().y();
+  pt += delta;
+
+  if (outData)
+    {
+      FASTUIDRAWassert(step == 0);
+      *outData = p->add_point(pt);
+      p->m_corner_ids.push_back(*outData);
+    }
+  else
+    {
+      pt += static_cast<double>(step) * delta;
+    }
+  *x = pt.x();
+  *y = pt.y();
+}
+
+FASTUIDRAW_GLUboolean
+OutlineBuilder::
+winding_callback(int winding_number, void *tess)
+{
+  /* as in FilledPath, all winding numbers are reported
+   * as filled so that GLU never takes the path for a
+   * single convex contour which does not emit boundaries;
+   * the fill rule is applied to the emitted boundaries.
+   */
+  FASTUIDRAWunused(winding_number);
+  FASTUIDRAWunused(tess);
+  return FASTUIDRAW_GLU_TRUE;
+}
+
+void
+OutlineBuilder::
+emitboundary_callback(int winding,
+                      const unsigned int vertex_ids[],
+                      unsigned int count,
+                      void *tess)
+{
+  OutlineBuilder *p(static_cast<OutlineBuilder*>(tess));
+
+  if (winding == 0 || !p->m_fill_rule(winding))
+    {
+      return;
+    }
+
+  /* GLU also reports the inner side of the box it adds
+   * around the contours as a boundary; the box only
+   * borders the winding 0 region, so any boundary
+   * that has one of its points is not part of the
+   * outline.
+   */
+  for(unsigned int i = 0; i < count; ++i)
+    {
+      if (std::find(p->m_corner_ids.begin(), p->m_corner_ids.end(),
+                    vertex_ids[i]) != p->m_corner_ids.end())
+        {
+          return;
+        }
+    }
+
+  for(unsigned int i = 0; i < count; ++i)
+    {
+      unsigned int next_i;
+
+      next_i = (i + 1u == count) ? 0u: i + 1u;
+      p->add_edge(vertex_ids[i], vertex_ids[next_i]);
+    }
+}
+
+////////////////////////////////////////
+// fastuidraw::SimplePath methods
+fastuidraw::SimplePath::
+SimplePath(void)
+{
+  m_d = FASTUIDRAWnew SimplePathPrivate();
+}
+
+fastuidraw::SimplePath::
+SimplePath(const Path &path, enum PainterEnums::fill_rule_t fill_rule,
+           float thresh)
+{
+  SimplePathPrivate *d;
+  CustomFillRuleFunction rule(fill_rule);
+  OutlineBuilder builder(rule);
+  std::vector<DContour> contours;
+
+  d = FASTUIDRAWnew SimplePathPrivate();
+  m_d = d;
+
+  builder.add_path(path, thresh);
+  builder.build(contours);
+  d->set_contours(contours);
+}
+
+fastuidraw::SimplePath::
+SimplePath(const Path &path, const CustomFillRuleBase &fill_rule,
+           float thresh)
+{
+  SimplePathPrivate *d;
+  OutlineBuilder builder(fill_rule);
+  std::vector<DContour> contours;
+
+  d = FASTUIDRAWnew SimplePathPrivate();
+  m_d = d;
+
+  builder.add_path(path, thresh);
+  builder.build(contours);
+  d->set_contours(contours);
+}
+
+fastuidraw::SimplePath::
+SimplePath(const SimplePath &a, const SimplePath &b,
+           enum boolean_op_t op)
+{
+  SimplePathPrivate *d;
+  BooleanOpFillRule rule(op, 2);
+  OutlineBuilder builder(rule);
+  std::vector<DContour> contours;
+
+  d = FASTUIDRAWnew SimplePathPrivate();
+  m_d = d;
+
+  builder.add_simple_path(a, false);
+  builder.add_simple_path(b, op == difference_op);
+  builder.build(contours);
+  d->set_contours(contours);
+}
+
+fastuidraw::SimplePath::
+SimplePath(c_array<const SimplePath> paths,
+           enum boolean_op_t op)
+{
+  SimplePathPrivate *d;
+  BooleanOpFillRule rule(op, paths.size());
+  OutlineBuilder builder(rule);
+  std::vector<DContour> contours;
+
+  d = FASTUIDRAWnew SimplePathPrivate();
+  m_d = d;
+
+  for(unsigned int i = 0, endi = paths.size(); i < endi; ++i)
+    {
+      builder.add_simple_path(paths[i], op == difference_op && i != 0);
+    }
+  builder.build(contours);
+  d->set_contours(contours);
+}
+
+fastuidraw::SimplePath::
+SimplePath(const SimplePath &obj)
+{
+  SimplePathPrivate *obj_d;
+  obj_d = static_cast<SimplePathPrivate*>(obj.m_d);
+  m_d = FASTUIDRAWnew SimplePathPrivate(*obj_d);
+}
+
+fastuidraw::SimplePath::
+~SimplePath()
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+assign_swap_implement(fastuidraw::SimplePath)
+
+bool
+fastuidraw::SimplePath::
+empty(void) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  return d->m_contours.empty();
+}
+
+unsigned int
+fastuidraw::SimplePath::
+number_contours(void) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  return d->m_contours.size();
+}
+
+fastuidraw::c_array<const fastuidraw::vec2>
+fastuidraw::SimplePath::
+contour(unsigned int C) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  FASTUIDRAWassert(C < d->m_contours.size());
+  return make_c_array(d->m_contours[C]);
+}
+
+fastuidraw::vec2
+fastuidraw::SimplePath::
+bounding_box_min(void) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  return d->m_bounds.empty() ? vec2(0.0f, 0.0f) : d->m_bounds.min_point();
+}
+
+fastuidraw::vec2
+fastuidraw::SimplePath::
+bounding_box_max(void) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  return d->m_bounds.empty() ? vec2(0.0f, 0.0f) : d->m_bounds.max_point();
+}
+
+const fastuidraw::Path&
+fastuidraw::SimplePath::
+path(void) const
+{
+  SimplePathPrivate *d;
+  d = static_cast<SimplePathPrivate*>(m_d);
+  return d->m_path;
+}
@@ -1060,6 +1060,12 @@ namespace
       return m_data;
     }
 
+    uint64_t
+    memory_usage(void) const
+    {
+      return m_data.memory_usage();
+    }
+
   private:
     fastuidraw::PainterAttributeData m_data;
     bool m_ready;
@@ -3377,3 +3383,33 @@ rounded_caps(float thresh) const
     d->fetch_create<RoundedCapCreator>(thresh, d->m_rounded_caps) :
     d->m_empty_data;
 }
+
+uint64_t
+fastuidraw::StrokedCapsJoins::
+memory_usage(void) const
+{
+  StrokedCapsJoinsPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<StrokedCapsJoinsPrivate*>(m_d);
+  return_value = d->m_bevel_joins.memory_usage()
+    + d->m_miter_clip_joins.memory_usage()
+    + d->m_miter_joins.memory_usage()
+    + d->m_miter_bevel_joins.memory_usage()
+    + d->m_arc_rounded_joins.memory_usage()
+    + d->m_square_caps.memory_usage()
+    + d->m_adjustable_caps.memory_usage()
+    + d->m_arc_rounded_caps.memory_usage();
+
+  for(const ThreshWithData &v : d->m_rounded_joins)
+    {
+      return_value += v.m_data->memory_usage();
+    }
+
+  for(const ThreshWithData &v : d->m_rounded_caps)
+    {
+      return_value += v.m_data->memory_usage();
+    }
+
+  return return_value;
+}
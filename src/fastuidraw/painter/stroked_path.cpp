@@ -2521,3 +2521,12 @@ caps_joins(void) const
   d = static_cast<StrokedPathPrivate*>(m_d);
   return d->m_caps_joins;
 }
+
+uint64_t
+fastuidraw::StrokedPath::
+memory_usage(void) const
+{
+  StrokedPathPrivate *d;
+  d = static_cast<StrokedPathPrivate*>(m_d);
+  return d->m_edges.memory_usage() + d->m_caps_joins.memory_usage();
+}
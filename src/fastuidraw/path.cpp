@@ -19,6 +19,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <list>
+#include <map>
 #include <vector>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/tessellated_path.hpp>
@@ -297,6 +300,137 @@ namespace
   };
 
   class PathPrivate;
+  class TessellatedPathList;
+
+  /* The memory of a TessellatedPath as counted by TessellationLRU.
+   * Copies of a Path share their TessellatedPath objects, so the
+   * TessellationLevel objects of several TessellatedPathList objects
+   * share the TessellationMeasure of a TessellatedPath and its bytes
+   * are counted once.
+   */
+  class TessellationMeasure
+  {
+  public:
+    TessellationMeasure(void):
+      m_bytes(0),
+      m_needs_measure(true),
+      m_count(0)
+    {}
+
+    /* value of memory_usage() of the TessellatedPath when last measured */
+    uint64_t m_bytes;
+
+    /* true if the TessellatedPath was returned since it was last measured */
+    bool m_needs_measure;
+
+    /* number of TessellationLevel objects of the TessellatedPath */
+    unsigned int m_count;
+  };
+
+  /* A TessellationLevel is a TessellatedPath of a TessellatedPathList
+   * together with its links in the least recently used list of the
+   * tessellations of all Path objects.
+   */
+  class TessellationLevel
+  {
+  public:
+    typedef fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> TessellatedPathRef;
+
+    TessellationLevel(const TessellatedPathRef &path, TessellatedPathList *list):
+      m_path(path),
+      m_list(list),
+      m_measure(nullptr),
+      m_prev(nullptr),
+      m_next(nullptr)
+    {}
+
+    TessellatedPathRef m_path;
+    TessellatedPathList *m_list;
+
+    /* set by TessellationLRU::add() */
+    TessellationMeasure *m_measure;
+
+    /* m_prev is more recently used, m_next less recently used */
+    TessellationLevel *m_prev, *m_next;
+  };
+
+  /* The least recently used list of the tessellations of all Path
+   * objects. Using a tessellation only moves it to the front of the
+   * list; measuring the tessellations and releasing them is done by
+   * enforce_budget(), which Path::enforce_tessellation_budget() calls
+   * when no other thread fetches or draws tessellations. Measuring
+   * walks the FilledPath and StrokedPath of a TessellatedPath, which
+   * may be in the middle of being made by another thread, so it is
+   * deferred to enforce_budget() as well.
+   */
+  class TessellationLRU:fastuidraw::noncopyable
+  {
+  public:
+    TessellationLRU(void):
+      m_head(nullptr),
+      m_tail(nullptr),
+      m_budget(0),
+      m_total(0)
+    {}
+
+    void
+    add(TessellationLevel *L);
+
+    void
+    remove(TessellationLevel *L);
+
+    /* mark L as the most recently used */
+    void
+    use(TessellationLevel *L);
+
+    /* measure the levels used since they were last measured and
+     * evict the least recently used levels while over budget.
+     */
+    void
+    enforce_budget(void);
+
+    void
+    budget(uint64_t v);
+
+    uint64_t
+    budget(void)
+    {
+      fastuidraw::autolock_mutex m(m_mutex);
+      return m_budget;
+    }
+
+    uint64_t
+    total(void)
+    {
+      fastuidraw::autolock_mutex m(m_mutex);
+      return m_total;
+    }
+
+  private:
+    void
+    link_front(TessellationLevel *L);
+
+    void
+    unlink(TessellationLevel *L);
+
+    /* drop the reference of L to its TessellationMeasure */
+    void
+    release_measure(TessellationLevel *L);
+
+    void
+    measure(TessellationLevel *L);
+
+    fastuidraw::mutex m_mutex;
+    TessellationLevel *m_head, *m_tail;
+    uint64_t m_budget, m_total;
+
+    /* keyed by TessellatedPath, std::map so that the
+     * TessellationMeasure objects do not move.
+     */
+    std::map<const fastuidraw::TessellatedPath*, TessellationMeasure> m_measures;
+  };
+
+  TessellationLRU tessellation_lru;
 
   class TessellatedPathList
   {
@@ -311,38 +445,72 @@ namespace
       m_done(false)
     {}
 
+    TessellatedPathList(const TessellatedPathList &obj);
+
+    ~TessellatedPathList()
+    {
+      clear();
+    }
+
     const TessellatedPathRef&
     tessellation(const fastuidraw::Path &path, float max_distance);
 
     void
-    clear(void)
-    {
-      m_data.clear();
-      m_refiner = nullptr;
-      m_done = false;
-    }
+    clear(void);
+
+    /* clear, but hand the current tessellations to the
+     * tessellations made next so that those make their
+     * FilledPath from the FilledPath of these.
+     */
+    void
+    clear_for_edit(void);
+
+    uint64_t
+    memory_usage(void) const;
+
+    /* called by TessellationLRU to remove a level,
+     * L is already unlinked from the TessellationLRU
+     */
+    void
+    evict(const TessellationLevel *L);
 
   private:
+    typedef std::list<TessellationLevel>::iterator level_iterator;
+
     class reverse_compare_max_distance
     {
     public:
       bool
-      operator()(const TessellatedPathRef &lhs, float rhs) const
+      operator()(const TessellationLevel &lhs, float rhs) const
       {
-        return lhs->max_distance() > rhs;
-      }
-
-      bool
-      operator()(const TessellatedPathRef &lhs,
-                 const TessellatedPathRef &rhs) const
-      {
-        return lhs->max_distance() > rhs->max_distance();
+        return lhs.m_path->max_distance() > rhs;
       }
     };
 
+    level_iterator
+    fetch_level(const fastuidraw::Path &path, float max_distance);
+
+    void
+    create_refiner(const fastuidraw::Path &path);
+
+    void
+    refine(float max_distance);
+
+    void
+    add_level(const TessellatedPathRef &ref);
+
     bool m_allow_arcs, m_done;
     fastuidraw::reference_counted_ptr<TessellatedPath::Refiner> m_refiner;
-    std::vector<TessellatedPathRef> m_data;
+
+    /* sorted by decreasing max_distance; a std::list so that
+     * the TessellationLevel objects do not move.
+     */
+    std::list<TessellationLevel> m_data;
+
+    /* tessellations from before the last clear_for_edit()
+     * not yet handed to a new tessellation by add_level()
+     */
+    std::vector<TessellatedPathRef> m_fill_from;
   };
 
   class PathPrivate:fastuidraw::noncopyable
@@ -1401,50 +1569,323 @@ approximate_bounding_box(vec2 *out_min_bb, vec2 *out_max_bb) const
   return true;
 }
 
+///////////////////////////////////
+// TessellationLRU methods
+void
+TessellationLRU::
+link_front(TessellationLevel *L)
+{
+  L->m_prev = nullptr;
+  L->m_next = m_head;
+  if (m_head)
+    {
+      m_head->m_prev = L;
+    }
+  else
+    {
+      m_tail = L;
+    }
+  m_head = L;
+}
+
+void
+TessellationLRU::
+unlink(TessellationLevel *L)
+{
+  if (L->m_prev)
+    {
+      L->m_prev->m_next = L->m_next;
+    }
+  else
+    {
+      m_head = L->m_next;
+    }
+
+  if (L->m_next)
+    {
+      L->m_next->m_prev = L->m_prev;
+    }
+  else
+    {
+      m_tail = L->m_prev;
+    }
+  L->m_prev = L->m_next = nullptr;
+}
+
+void
+TessellationLRU::
+release_measure(TessellationLevel *L)
+{
+  FASTUIDRAWassert(L->m_measure && L->m_measure->m_count > 0);
+  if (--L->m_measure->m_count == 0)
+    {
+      m_total -= L->m_measure->m_bytes;
+      m_measures.erase(L->m_path.get());
+    }
+  L->m_measure = nullptr;
+}
+
+void
+TessellationLRU::
+measure(TessellationLevel *L)
+{
+  TessellationMeasure *M(L->m_measure);
+
+  m_total -= M->m_bytes;
+  M->m_bytes = L->m_path->memory_usage();
+  M->m_needs_measure = false;
+  m_total += M->m_bytes;
+}
+
+void
+TessellationLRU::
+add(TessellationLevel *L)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+
+  L->m_measure = &m_measures[L->m_path.get()];
+  ++L->m_measure->m_count;
+  link_front(L);
+}
+
+void
+TessellationLRU::
+remove(TessellationLevel *L)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+  unlink(L);
+  release_measure(L);
+}
+
+void
+TessellationLRU::
+use(TessellationLevel *L)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+
+  /* the StrokedPath and FilledPath of a TessellatedPath are
+   * typically created right after it is returned, so it is
+   * measured again by the next enforce_budget().
+   */
+  L->m_measure->m_needs_measure = true;
+  if (m_head != L)
+    {
+      unlink(L);
+      link_front(L);
+    }
+}
+
+void
+TessellationLRU::
+budget(uint64_t v)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+
+  m_budget = v;
+  if (m_budget == 0)
+    {
+      for(auto &M : m_measures)
+        {
+          M.second.m_bytes = 0;
+          M.second.m_needs_measure = true;
+        }
+      m_total = 0;
+    }
+}
+
+void
+TessellationLRU::
+enforce_budget(void)
+{
+  fastuidraw::autolock_mutex m(m_mutex);
+  TessellationLevel *L;
+
+  if (m_budget == 0)
+    {
+      return;
+    }
+
+  for(L = m_head; L; L = L->m_next)
+    {
+      if (L->m_measure->m_needs_measure)
+        {
+          measure(L);
+        }
+    }
+
+  /* the memory of a TessellatedPath shared by copies of a
+   * Path is only released, and removed from m_total, when
+   * the last of its TessellationLevel objects is evicted.
+   */
+  L = m_tail;
+  while(m_total > m_budget && L)
+    {
+      TessellationLevel *prev(L->m_prev);
+
+      unlink(L);
+      release_measure(L);
+      L->m_list->evict(L);
+      L = prev;
+    }
+}
+
 /////////////////////////////////
 // TessellatedPathList methods
-const typename TessellatedPathList::TessellatedPathRef&
 TessellatedPathList::
-tessellation(const fastuidraw::Path &path, float max_distance)
+TessellatedPathList(const TessellatedPathList &obj):
+  m_allow_arcs(obj.m_allow_arcs),
+  m_done(obj.m_done),
+  m_refiner(obj.m_refiner)
 {
-  using namespace fastuidraw;
+  for(const TessellationLevel &L : obj.m_data)
+    {
+      m_data.push_back(TessellationLevel(L.m_path, this));
+      tessellation_lru.add(&m_data.back());
+    }
+}
 
-  if (m_data.empty())
+void
+TessellatedPathList::
+clear(void)
+{
+  for(TessellationLevel &L : m_data)
     {
-      TessellationParams params;
+      tessellation_lru.remove(&L);
+    }
+  m_data.clear();
+  m_fill_from.clear();
+  m_refiner = nullptr;
+  m_done = false;
+}
+
+void
+TessellatedPathList::
+clear_for_edit(void)
+{
+  std::vector<TessellatedPathRef> prev;
 
-      params.allow_arcs(m_allow_arcs);
-      m_data.push_back(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
+  if (m_data.empty())
+    {
+      /* edited again before tessellating, keep the
+       * tessellations from before the first edit.
+       */
+      prev.swap(m_fill_from);
     }
+  else
+    {
+      for(const TessellationLevel &L : m_data)
+        {
+          prev.push_back(L.m_path);
+        }
+    }
+  clear();
+  m_fill_from.swap(prev);
+}
 
-  if (max_distance <= 0.0 || path.is_flat())
+uint64_t
+TessellatedPathList::
+memory_usage(void) const
+{
+  uint64_t return_value(0);
+  for(const TessellationLevel &L : m_data)
     {
-      return m_data.front();
+      return_value += L.m_path->memory_usage();
     }
+  return return_value;
+}
 
-  if (m_data.back()->max_distance() <= max_distance)
+void
+TessellatedPathList::
+evict(const TessellationLevel *L)
+{
+  for(level_iterator iter = m_data.begin(); iter != m_data.end(); ++iter)
     {
-      typename std::vector<TessellatedPathRef>::const_iterator iter;
-      iter = std::lower_bound(m_data.begin(),
-                              m_data.end(),
-                              max_distance,
-                              reverse_compare_max_distance());
+      if (&*iter == L)
+        {
+          if (std::next(iter) == m_data.end())
+            {
+              /* the finest tessellation is gone, a later request
+               * for it restarts the refinement.
+               */
+              m_refiner = nullptr;
+              m_done = false;
+            }
+          else if (m_refiner && m_refiner->tessellated_path() == iter->m_path)
+            {
+              /* the Refiner would keep the tessellation alive */
+              m_refiner = nullptr;
+            }
+          m_data.erase(iter);
+          return;
+        }
+    }
+  FASTUIDRAWassert(!"TessellationLevel not found in its TessellatedPathList");
+}
+
+void
+TessellatedPathList::
+add_level(const TessellatedPathRef &ref)
+{
+  level_iterator iter;
 
-      FASTUIDRAWassert(iter != m_data.end());
-      FASTUIDRAWassert(*iter);
-      FASTUIDRAWassert((*iter)->max_distance() <= max_distance);
-      return *iter;
+  iter = std::lower_bound(m_data.begin(), m_data.end(),
+                          ref->max_distance(),
+                          reverse_compare_max_distance());
+  if (iter != m_data.end() && iter->m_path->max_distance() == ref->max_distance())
+    {
+      /* a tessellation of the same level of detail is
+       * already present, possible when the refinement
+       * is restarted after an eviction.
+       */
+      return;
     }
 
-  if (m_done)
+  iter = m_data.insert(iter, TessellationLevel(ref, this));
+  tessellation_lru.add(&*iter);
+
+  if (!m_fill_from.empty())
     {
-      return m_data.back();
+      unsigned int best(0);
+      float best_diff;
+
+      /* hand the tessellation of nearest level of detail */
+      best_diff = fastuidraw::t_abs(m_fill_from[0]->max_distance() - ref->max_distance());
+      for(unsigned int i = 1, endi = m_fill_from.size(); i < endi; ++i)
+        {
+          float diff;
+
+          diff = fastuidraw::t_abs(m_fill_from[i]->max_distance() - ref->max_distance());
+          if (diff < best_diff)
+            {
+              best = i;
+              best_diff = diff;
+            }
+        }
+      ref->fill_from(m_fill_from[best]);
+      m_fill_from.erase(m_fill_from.begin() + best);
     }
+}
+
+void
+TessellatedPathList::
+create_refiner(const fastuidraw::Path &path)
+{
+  using namespace fastuidraw;
+
+  TessellationParams params;
 
+  params.allow_arcs(m_allow_arcs);
+  add_level(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
+}
+
+void
+TessellatedPathList::
+refine(float max_distance)
+{
   TessellatedPathRef ref;
   float current_max_distance;
 
-  ref = m_data.back();
+  ref = m_refiner->tessellated_path();
   current_max_distance = ref->max_distance();
 
   while(!m_done && ref->max_distance() > max_distance)
@@ -1460,7 +1901,7 @@ tessellation(const fastuidraw::Path &path, float max_distance)
 
           if (last_tess > ref->max_distance())
             {
-              m_data.push_back(ref);
+              add_level(ref);
 
               /*
               std::cout << "Allow arcs = " << m_allow_arcs
@@ -1483,8 +1924,56 @@ tessellation(const fastuidraw::Path &path, float max_distance)
             }
         }
     }
+}
+
+TessellatedPathList::level_iterator
+TessellatedPathList::
+fetch_level(const fastuidraw::Path &path, float max_distance)
+{
+  level_iterator iter;
+
+  if (m_data.empty())
+    {
+      m_refiner = nullptr;
+      m_done = false;
+      create_refiner(path);
+    }
+
+  if (max_distance <= 0.0 || path.is_flat())
+    {
+      return m_data.begin();
+    }
+
+  if (m_data.back().m_path->max_distance() > max_distance && !m_done)
+    {
+      if (!m_refiner)
+        {
+          create_refiner(path);
+        }
+      refine(max_distance);
+    }
 
-  return m_data.back();
+  iter = std::lower_bound(m_data.begin(), m_data.end(),
+                          max_distance,
+                          reverse_compare_max_distance());
+  if (iter == m_data.end())
+    {
+      /* no tessellation is fine enough, return the finest */
+      --iter;
+    }
+  return iter;
+}
+
+const typename TessellatedPathList::TessellatedPathRef&
+TessellatedPathList::
+tessellation(const fastuidraw::Path &path, float max_distance)
+{
+  level_iterator iter;
+
+  iter = fetch_level(path, max_distance);
+
+  tessellation_lru.use(&*iter);
+  return iter->m_path;
 }
 
 /////////////////////////////////
@@ -1654,6 +2143,34 @@ add_contour(const reference_counted_ptr<const PathContour> &pcontour)
   return *this;
 }
 
+fastuidraw::Path&
+fastuidraw::Path::
+replace_contour(unsigned int i, const reference_counted_ptr<const PathContour> &pcontour)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+
+  FASTUIDRAWassert(i < d->m_contours.size());
+  if (!pcontour || !pcontour->ended() || !d->m_contours[i]->ended())
+    {
+      return *this;
+    }
+
+  d->m_tess_list.clear_for_edit();
+  d->m_arc_tess_list.clear();
+  d->m_contours[i] = pcontour.const_cast_ptr<PathContour>();
+
+  d->m_is_flat = true;
+  for(const auto &c : d->m_contours)
+    {
+      d->m_is_flat = d->m_is_flat && c->is_flat();
+    }
+  d->m_bb = BoundingBox<float>();
+  d->m_start_check_bb = 0u;
+
+  return *this;
+}
+
 fastuidraw::Path&
 fastuidraw::Path::
 add_contours(const Path &path)
@@ -1750,6 +2267,43 @@ tessellation(float max_distance) const
   return d->m_tess_list.tessellation(*this, max_distance);
 }
 
+uint64_t
+fastuidraw::Path::
+memory_usage(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_tess_list.memory_usage() + d->m_arc_tess_list.memory_usage();
+}
+
+void
+fastuidraw::Path::
+tessellation_memory_budget(uint64_t v)
+{
+  tessellation_lru.budget(v);
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_memory_budget(void)
+{
+  return tessellation_lru.budget();
+}
+
+uint64_t
+fastuidraw::Path::
+tessellation_memory_usage(void)
+{
+  return tessellation_lru.total();
+}
+
+void
+fastuidraw::Path::
+enforce_tessellation_budget(void)
+{
+  tessellation_lru.enforce_budget();
+}
+
 const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
 fastuidraw::Path::
 arc_tessellation(void) const
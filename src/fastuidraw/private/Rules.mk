@@ -4,7 +4,8 @@ dirstack_$(sp)	:= $(d)
 d		:= $(dir)
 # End standard header
 
-FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, interval_allocator.cpp path_util_private.cpp clip.cpp int_path.cpp)
+FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, interval_allocator.cpp path_util_private.cpp clip.cpp int_path.cpp \
+	worker_pool.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
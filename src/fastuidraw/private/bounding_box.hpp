@@ -120,6 +120,30 @@ namespace fastuidraw
     {
       return m_max;
     }
+
+    /*!
+     * Returns true if this box and b share a point,
+     * touching boxes are considered to intersect.
+     */
+    bool
+    intersects(const BoundingBox &b) const
+    {
+      return !m_empty && !b.m_empty
+        && m_min.x() <= b.m_max.x() && b.m_min.x() <= m_max.x()
+        && m_min.y() <= b.m_max.y() && b.m_min.y() <= m_max.y();
+    }
+
+    /*!
+     * Returns true if b is contained in this box.
+     */
+    bool
+    contains(const BoundingBox &b) const
+    {
+      return b.m_empty
+        || (!m_empty
+            && m_min.x() <= b.m_min.x() && b.m_max.x() <= m_max.x()
+            && m_min.y() <= b.m_min.y() && b.m_max.y() <= m_max.y());
+    }
   private:
     pt_type m_min, m_max;
     bool m_empty;
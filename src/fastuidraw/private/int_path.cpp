@@ -33,6 +33,7 @@
  */
 
 #include <iterator>
+#include <limits>
 #include <set>
 #include "int_path.hpp"
 #include "util_private_ostream.hpp"
@@ -269,6 +270,16 @@ namespace
       unsigned int
       size(void) const;
 
+      /* returns the iterator value one past the last
+       * solution written, including those written by
+       * finalize().
+       */
+      interator
+      end(void) const
+      {
+        return m_iter;
+      }
+
     private:
       interator m_iter;
       unsigned int m_size;
@@ -389,88 +400,83 @@ namespace
     const IntBezierCurve &m_curve;
   };
 
-  class distance_value
+  /* Values computed for the texels of a distance field, stored as
+   * a structure of arrays so that the kernels that update them walk
+   * contiguous runs of floats and ints that the compiler vectorizes.
+   * The values along the lines with a fixed x-coordinate (resp.
+   * y-coordinate) are stored contiguously in the arrays indexed by
+   * Solver::x_fixed (resp. Solver::y_fixed), i.e. the value of
+   * texel (x, y) is at x * count.y() + y in the x_fixed arrays and
+   * at y * count.x() + x in the y_fixed arrays. The distance is the
+   * minimum of the values of the two arrays; a distance of
+   * +infinity indicates that no value was assigned.
+   */
+  class distance_field_values:fastuidraw::noncopyable
   {
   public:
-    typedef fastuidraw::detail::IntBezierCurve IntBezierCurve;
-
-    enum winding_ray_t
-      {
-        from_pt_to_x_negative_infinity,
-        from_pt_to_x_positive_infinity,
-        from_pt_to_y_negative_infinity,
-        from_pt_to_y_positive_infinity,
-      };
-
-    distance_value(void):
-      m_distance(-1.0f),
-      m_ray_intersection_counts(0, 0, 0, 0),
-      m_winding_numbers(0, 0)
-    {}
-
-    void
-    record_distance_value(float v)
-    {
-      FASTUIDRAWassert(v >= 0.0f);
-      m_distance = (m_distance >= 0.0f) ?
-        fastuidraw::t_min(v, m_distance) :
-        v;
-    }
-
-    void
-    increment_ray_intersection_count(enum winding_ray_t tp, int mult)
+    explicit
+    distance_field_values(const fastuidraw::ivec2 &count):
+      m_count(count)
     {
-      FASTUIDRAWassert(mult >= 0);
-      m_ray_intersection_counts[tp] += mult;
+      unsigned int sz(count.x() * count.y());
+      for(int tp = 0; tp < 2; ++tp)
+        {
+          m_distance[tp].resize(sz, std::numeric_limits<float>::infinity());
+          m_winding[tp].resize(sz, 0);
+        }
     }
 
-    void
-    set_winding_number(enum Solver::coordinate_type tp, int w)
+    /* returns the distance values along the line c
+     * whose coordinate fixed_coordinate(tp) is fixed.
+     */
+    float*
+    line_distance(enum Solver::coordinate_type tp, int c)
     {
-      m_winding_numbers[tp] = w;
+      return &m_distance[tp][c * m_count[Solver::varying_coordinate(tp)]];
     }
 
-    float
-    distance(float max_distance) const
+    int*
+    line_winding(enum Solver::coordinate_type tp, int c)
     {
-      return (m_distance < 0.0f) ?
-        max_distance :
-        fastuidraw::t_min(max_distance, m_distance);
+      return &m_winding[tp][c * m_count[Solver::varying_coordinate(tp)]];
     }
 
     float
-    raw_distance(void) const
+    distance(int x, int y, float max_distance) const
     {
-      return m_distance;
+      float d;
+      d = fastuidraw::t_min(m_distance[Solver::x_fixed][x * m_count.y() + y],
+                            m_distance[Solver::y_fixed][y * m_count.x() + x]);
+      return fastuidraw::t_min(max_distance, d);
     }
 
     int
-    ray_intersection_count(enum winding_ray_t tp) const
+    winding_number(enum Solver::coordinate_type tp, int x, int y) const
     {
-      return m_ray_intersection_counts[tp];
+      return (tp == Solver::x_fixed) ?
+        m_winding[tp][x * m_count.y() + y] :
+        m_winding[tp][y * m_count.x() + x];
     }
 
-    int
-    winding_number(enum Solver::coordinate_type tp = Solver::x_fixed) const
+    fastuidraw::range_type<int>
+    winding_range(void) const
     {
-      return m_winding_numbers[tp];
+      fastuidraw::range_type<int> R(0, 0);
+      for(int tp = 0; tp < 2; ++tp)
+        {
+          for(int w : m_winding[tp])
+            {
+              R.m_begin = fastuidraw::t_min(R.m_begin, w);
+              R.m_end = fastuidraw::t_max(R.m_end, w);
+            }
+        }
+      return R;
     }
 
   private:
-    /* unsigned distance in IntPath coordinates,
-     * a negative value indicates value is not
-     * assigned
-     */
-    float m_distance;
-
-    /* number of intersection (counted with multiplicity)
-     * of a ray agains the path.
-     */
-    fastuidraw::vecN<int, 4> m_ray_intersection_counts;
-
-    /* winding number computed from horizontal or vertical lines
-     */
-    fastuidraw::vecN<int, 2> m_winding_numbers;
+    fastuidraw::ivec2 m_count;
+    fastuidraw::vecN<std::vector<float>, 2> m_distance;
+    fastuidraw::vecN<std::vector<int>, 2> m_winding;
   };
 
   class DistanceFieldGenerator
@@ -498,41 +504,61 @@ namespace
     compute_distance_values(const ivec2 &step, const ivec2 &count,
                             const IntBezierCurve::transformation<int> &tr,
                             int radius,
-                            fastuidraw::array2d<distance_value> &out_values) const;
+                            distance_field_values &out_values) const;
 
     static
     uint8_t
     pixel_value_from_distance(float dist, bool outside);
 
   private:
+    /* crossing of a fixed line by the path, reduced to what
+     * the distance and winding computations along the line
+     * need so that sorting the crossings moves little data.
+     */
+    class line_crossing
+    {
+    public:
+      bool
+      operator<(const line_crossing &rhs) const
+      {
+        return m_p < rhs.m_p;
+      }
+
+      /* value of the varying coordinate of the crossing */
+      float m_p;
+
+      /* change to the winding number when crossing */
+      int m_winding_delta;
+    };
+
     template<typename T>
     static
     void
     record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                         const ivec2 &step,
                                         const ivec2 &count,
-                                        fastuidraw::array2d<distance_value> &dst);
+                                        distance_field_values &dst);
 
     void
     compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const;
+                                 distance_field_values &dst) const;
     void
     compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                      const IntBezierCurve::transformation<int> &tr,
                                      int radius,
-                                     fastuidraw::array2d<distance_value> &dst) const;
+                                     distance_field_values &dst) const;
     void
     compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              distance_field_values &dst) const;
     void
     compute_fixed_line_values(enum Solver::coordinate_type tp,
                               std::vector<std::vector<Solver::solution_pt> > &work_room,
                               const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              distance_field_values &dst) const;
 
     const std::vector<fastuidraw::detail::IntContour> &m_contours;
   };
@@ -1129,12 +1155,15 @@ compute_line_intersection(int pt, enum coordinate_type line_type,
   fastuidraw::c_array<const int> poly(m_curve.as_polynomial(coord));
   fastuidraw::c_array<int64_t> tmp(work_room.c_ptr(), poly.size());
 
-  typedef std::vector<poly_solution> solution_holder_t;
-  typedef std::back_insert_iterator<solution_holder_t> solution_iter;
+  /* a polynomial of degree at most 3 has at most 3 roots
+   * in addition to the solutions at t = 0 and t = 1 that
+   * poly_solutions::finalize() adds; using a fixed size
+   * array avoids a heap allocation for each line solved.
+   */
+  typedef fastuidraw::vecN<poly_solution, 5> solution_holder_t;
 
   solution_holder_t solution_holder;
-  solution_iter solutions_iter(std::back_inserter(solution_holder));
-  poly_solutions<solution_iter> solutions(solutions_iter);
+  poly_solutions<solution_holder_t::iterator> solutions(solution_holder.begin());
 
   /* transform m_as_polynomial via transformation tr;
    * that transformation is tr(p) = tr.translate() + tr.scale() * p,
@@ -1150,11 +1179,10 @@ compute_line_intersection(int pt, enum coordinate_type line_type,
   tmp[0] -= pt;
   solve_polynomial(fastuidraw::c_array<const int64_t>(tmp), solution_types_accepted, &solutions);
   solutions.finalize();
-  FASTUIDRAWassert(solutions.size() == solution_holder.size());
 
   /* compute solution point values from polynomial solutions */
   compute_solution_points(m_curve.ID(), m_curve.as_polynomial(),
-                          solution_holder.begin(), solution_holder.end(),
+                          solution_holder.begin(), solutions.end(),
                           tr.cast<float>(),
                           std::back_inserter(*out_value));
 }
@@ -1217,22 +1245,25 @@ DistanceFieldGenerator::
 record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                     const ivec2 &step,
                                     const ivec2 &count,
-                                    fastuidraw::array2d<distance_value> &dst)
+                                    distance_field_values &dst)
 {
   ivec2 ip(p);
+  int miny(fastuidraw::t_max(0, ip.y() - radius));
+  int maxy(fastuidraw::t_min(count.y(), ip.y() + radius));
+
   for(int x = fastuidraw::t_max(0, ip.x() - radius),
         maxx = fastuidraw::t_min(count.x(), ip.x() + radius);
       x < maxx; ++x)
     {
-      for(int y = fastuidraw::t_max(0, ip.y() - radius),
-            maxy = fastuidraw::t_min(count.y(), ip.y() + radius);
-          y < maxy; ++y)
+      float *line(dst.line_distance(Solver::x_fixed, x));
+      T dx(fastuidraw::t_abs(T(x * step.x()) - p.x()));
+
+      for(int y = miny; y < maxy; ++y)
         {
-          T v;
+          float v;
 
-          v = fastuidraw::t_abs(T(x * step.x()) - p.x())
-            + fastuidraw::t_abs(T(y * step.y()) - p.y());
-          dst(x, y).record_distance_value(static_cast<float>(v));
+          v = static_cast<float>(dx + fastuidraw::t_abs(T(y * step.y()) - p.y()));
+          line[y] = fastuidraw::t_min(line[y], v);
         }
     }
 }
@@ -1258,7 +1289,7 @@ void
 DistanceFieldGenerator::
 compute_distance_values(const ivec2 &step, const ivec2 &count,
                         const IntBezierCurve::transformation<int> &tr,
-                        int radius, fastuidraw::array2d<distance_value> &dst) const
+                        int radius, distance_field_values &dst) const
 {
   /* We are computing the L1-distance from the path. For a given
    * curve C, that value is given by
@@ -1289,7 +1320,7 @@ void
 DistanceFieldGenerator::
 compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                              const IntBezierCurve::transformation<int> &tr,
-                             int radius, fastuidraw::array2d<distance_value> &dst) const
+                             int radius, distance_field_values &dst) const
 {
   for(const IntContour &contour: m_contours)
     {
@@ -1307,7 +1338,7 @@ DistanceFieldGenerator::
 compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const
+                                 distance_field_values &dst) const
 {
   IntBezierCurve::transformation<float> ftr(tr.cast<float>());
   for(const IntContour &contour: m_contours)
@@ -1328,7 +1359,7 @@ void
 DistanceFieldGenerator::
 compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          distance_field_values &dst) const
 {
   std::vector<std::vector<Solver::solution_pt> > work_room0;
   std::vector<std::vector<Solver::solution_pt> > work_room1;
@@ -1344,17 +1375,15 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
                           std::vector<std::vector<Solver::solution_pt> > &work_room,
                           const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          distance_field_values &dst) const
 {
-  const enum distance_value::winding_ray_t ray_types[2][2] =
-    {
-      {distance_value::from_pt_to_y_negative_infinity, distance_value::from_pt_to_y_positive_infinity}, //fixed-coordinate 0
-      {distance_value::from_pt_to_x_negative_infinity, distance_value::from_pt_to_x_positive_infinity}, //fixed-coordinate 1
-    };
-
   const int fixed_coord(Solver::fixed_coordinate(tp));
   const int varying_coord(Solver::varying_coordinate(tp));
   const int winding_sgn((tp == Solver::x_fixed) ? 1 : -1);
+  const int line_length(count[varying_coord]);
+  const float line_step(static_cast<float>(step[varying_coord]));
+  std::vector<line_crossing> crossings;
+  std::vector<float> nearest_below(line_length), nearest_above(line_length);
 
   work_room.resize(count[fixed_coord]);
   for(int i = 0; i < count[fixed_coord]; ++i)
@@ -1378,72 +1407,61 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
   /* now for each line, do the distance computation along the line. */
   for(int c = 0; c < count[fixed_coord]; ++c)
     {
-      std::vector<Solver::solution_pt> &L(work_room[c]);
-      int total_cnt(0), winding(0);
+      const std::vector<Solver::solution_pt> &L(work_room[c]);
+      float *line_distance(dst.line_distance(tp, c));
+      int *line_winding(dst.line_winding(tp, c));
+      int winding(0);
 
-      /* sort by the value in the varying coordinate
-       */
-      std::sort(L.begin(), L.end(), Solver::CompareSolutions(varying_coord));
-      for(const Solver::solution_pt &S : L)
+      crossings.resize(L.size());
+      for(unsigned int i = 0, endi = L.size(); i < endi; ++i)
         {
+          const Solver::solution_pt &S(L[i]);
+
           FASTUIDRAWassert(S.m_multiplicity > 0);
           FASTUIDRAWassert(S.m_type != Solver::on_1_boundary);
           FASTUIDRAWassert(S.m_t < 1.0f && S.m_t >= 0.0f);
-          total_cnt += S.m_multiplicity;
+          crossings[i].m_p = S.m_p[varying_coord];
+          crossings[i].m_winding_delta = (S.m_p_t[fixed_coord] > 0.0f) ?
+            1 :
+            (S.m_p_t[fixed_coord] < 0.0f) ? -1 : 0;
         }
 
-      for(int v = 0, current_cnt = 0, current_idx = 0, sz = L.size();
-          v < count[varying_coord]; ++v)
-        {
-          ivec2 pixel;
-          float p;
-          int prev_idx;
-
-          p = static_cast<float>(step[varying_coord] * v);
-          pixel[fixed_coord] = c;
-          pixel[varying_coord] = v;
+      /* sort by the value in the varying coordinate */
+      std::sort(crossings.begin(), crossings.end());
 
-          prev_idx = current_idx;
+      /* walk the texels and crossings together to find, for each
+       * texel, the crossing just before and just after it; the
+       * distance to the line is the smaller distance to those two.
+       */
+      for(int v = 0, current_idx = 0, sz = crossings.size(); v < line_length; ++v)
+        {
+          float p(line_step * static_cast<float>(v));
 
-          /* advance to the next along the line L just after p
-           */
-          while(current_idx < sz && L[current_idx].m_p[varying_coord] < p)
+          while(current_idx < sz && crossings[current_idx].m_p < p)
             {
-              FASTUIDRAWassert(L[current_idx].m_multiplicity > 0);
-              current_cnt += L[current_idx].m_multiplicity;
-
-              if (L[current_idx].m_p_t[fixed_coord] > 0.0f)
-                {
-                  winding += 1;
-                }
-              else if (L[current_idx].m_p_t[fixed_coord] < 0.0f)
-                {
-                  winding -= 1;
-                }
+              winding += crossings[current_idx].m_winding_delta;
               ++current_idx;
             }
 
-          /* update the distance values for all those points between
-           * the point on the line we were at before the loop start
-           * and the point on the line we are at now
-           */
-          for(int idx = fastuidraw::t_max(0, prev_idx - 1),
-                end_idx = fastuidraw::t_min(sz, current_idx + 1);
-              idx < end_idx; ++idx)
-            {
-              float f;
-              f = fastuidraw::t_abs(p - L[idx].m_p[varying_coord]);
-              dst(pixel.x(), pixel.y()).record_distance_value(f);
-            }
+          nearest_below[v] = (current_idx > 0) ?
+            crossings[current_idx - 1].m_p :
+            -std::numeric_limits<float>::infinity();
 
-          /* update the ray-intersection counts */
-          dst(pixel.x(), pixel.y()).increment_ray_intersection_count(ray_types[fixed_coord][0], current_cnt);
-          dst(pixel.x(), pixel.y()).increment_ray_intersection_count(ray_types[fixed_coord][1], total_cnt - current_cnt);
+          nearest_above[v] = (current_idx < sz) ?
+            crossings[current_idx].m_p :
+            std::numeric_limits<float>::infinity();
 
-          /* set winding number */
-          dst(pixel.x(), pixel.y()).set_winding_number(tp, winding_sgn * winding);
+          line_winding[v] = winding_sgn * winding;
         }
 
+      /* branch free kernel over the line */
+      for(int v = 0; v < line_length; ++v)
+        {
+          float p(line_step * static_cast<float>(v)), d;
+
+          d = fastuidraw::t_min(p - nearest_below[v], nearest_above[v] - p);
+          line_distance[v] = fastuidraw::t_min(line_distance[v], d);
+        }
     }
 }
 
@@ -2274,7 +2292,10 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
                     GlyphRenderDataDistanceField *dst) const
 {
   DistanceFieldGenerator compute(m_contours);
-  array2d<distance_value> dist_values(image_sz.x(), image_sz.y());
+  distance_field_values dist_values(image_sz);
+  range_type<int> winding_range;
+  std::vector<bool> outside_table;
+  float recip_max_distance(1.0f / max_distance);
   int radius(2);
 
   /* change tr to be offset by half a texel, so that the
@@ -2290,6 +2311,16 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
 
   compute.compute_distance_values(step, image_sz, tr, radius, dist_values);
 
+  /* evaluate the fill rule once per winding number
+   * instead of twice per texel
+   */
+  winding_range = dist_values.winding_range();
+  outside_table.resize(winding_range.difference() + 1);
+  for(int w = winding_range.m_begin; w <= winding_range.m_end; ++w)
+    {
+      outside_table[w - winding_range.m_begin] = !fill_rule(w);
+    }
+
   dst->resize(image_sz + ivec2(1, 1));
   std::fill(dst->distance_values().begin(), dst->distance_values().end(), 0);
   for(int y = 0; y < image_sz.y(); ++y)
@@ -2302,13 +2333,13 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
           int w1, w2;
           unsigned int location;
 
-          w1 = dist_values(x, y).winding_number(Solver::x_fixed);
-          w2 = dist_values(x, y).winding_number(Solver::y_fixed);
+          w1 = dist_values.winding_number(Solver::x_fixed, x, y);
+          w2 = dist_values.winding_number(Solver::y_fixed, x, y);
 
-          outside1 = !fill_rule(w1);
-          outside2 = !fill_rule(w2);
+          outside1 = outside_table[w1 - winding_range.m_begin];
+          outside2 = outside_table[w2 - winding_range.m_begin];
 
-          dist = dist_values(x, y).distance(max_distance) / max_distance;
+          dist = dist_values.distance(x, y, max_distance) * recip_max_distance;
           if (outside1 != outside2)
             {
               /* if the fills do not match, then a curve is going through
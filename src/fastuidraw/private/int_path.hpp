@@ -365,6 +365,12 @@ namespace fastuidraw
         return m_contours.empty();
       }
 
+      const std::vector<IntContour>&
+      contours(void) const
+      {
+        return m_contours;
+      }
+
       /* Add this IntPath with a transforamtion tr applied to it to a
        * pre-exising (and possibly empty) Path.
        * \param tr transformation to apply to data of path
@@ -0,0 +1,119 @@
+/*!
+ * \file worker_pool.cpp
+ * \brief file worker_pool.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <algorithm>
+#include "worker_pool.hpp"
+
+fastuidraw::detail::WorkerPool::
+WorkerPool(unsigned int num_threads):
+  m_running(num_threads, nullptr),
+  m_shutdown(false)
+{
+  FASTUIDRAWassert(num_threads > 0);
+  for(unsigned int i = 0; i < num_threads; ++i)
+    {
+      m_threads.push_back(std::thread(&WorkerPool::run, this, i));
+    }
+}
+
+fastuidraw::detail::WorkerPool::
+~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+    m_queue.clear();
+  }
+  m_work_cv.notify_all();
+
+  for(std::thread &t : m_threads)
+    {
+      t.join();
+    }
+}
+
+void
+fastuidraw::detail::WorkerPool::
+add(const void *tag, const Job &job)
+{
+  FASTUIDRAWassert(tag != nullptr);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry E;
+
+    E.m_tag = tag;
+    E.m_job = job;
+    m_queue.push_back(E);
+  }
+  m_work_cv.notify_one();
+}
+
+void
+fastuidraw::detail::WorkerPool::
+cancel(const void *tag)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(),
+                               [tag](const entry &E) { return E.m_tag == tag; }),
+                m_queue.end());
+  m_done_cv.wait(lock, [this, tag] {
+      return std::find(m_running.begin(), m_running.end(), tag) == m_running.end();
+    });
+}
+
+void
+fastuidraw::detail::WorkerPool::
+wait(const void *tag)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  m_done_cv.wait(lock, [this, tag] {
+      return std::find_if(m_queue.begin(), m_queue.end(),
+                          [tag](const entry &E) { return E.m_tag == tag; }) == m_queue.end()
+        && std::find(m_running.begin(), m_running.end(), tag) == m_running.end();
+    });
+}
+
+void
+fastuidraw::detail::WorkerPool::
+run(unsigned int thread_id)
+{
+  for(;;)
+    {
+      Job job;
+
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_running[thread_id] = nullptr;
+        m_done_cv.notify_all();
+        m_work_cv.wait(lock, [this] { return m_shutdown || !m_queue.empty(); });
+        if (m_shutdown)
+          {
+            return;
+          }
+
+        m_running[thread_id] = m_queue.front().m_tag;
+        job.swap(m_queue.front().m_job);
+        m_queue.pop_front();
+      }
+
+      job();
+    }
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file worker_pool.hpp
+ * \brief file worker_pool.hpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* A WorkerPool is a fixed set of threads that run jobs in
+     * the order they are added. Each job carries a tag so that
+     * all jobs of an object can be cancelled when the object
+     * goes away. Used by the asynchronous work of ImageAtlas
+     * and GlyphCache and by the threads of cpu::PainterRasterizer.
+     */
+    class WorkerPool:fastuidraw::noncopyable
+    {
+    public:
+      typedef std::function<void ()> Job;
+
+      explicit
+      WorkerPool(unsigned int num_threads);
+
+      /* Jobs not yet started are dropped, blocks
+       * until the running jobs finish.
+       */
+      ~WorkerPool();
+
+      void
+      add(const void *tag, const Job &job);
+
+      /* Drop the jobs with the tag that have not yet started and
+       * block until no job with the tag is running. Must not be
+       * called from a job.
+       */
+      void
+      cancel(const void *tag);
+
+      /* Block until no job with the tag is queued or running.
+       * Must not be called from a job.
+       */
+      void
+      wait(const void *tag);
+
+      unsigned int
+      number_threads(void) const
+      {
+        return m_threads.size();
+      }
+
+    private:
+      class entry
+      {
+      public:
+        const void *m_tag;
+        Job m_job;
+      };
+
+      void
+      run(unsigned int thread_id);
+
+      std::mutex m_mutex;
+      std::condition_variable m_work_cv, m_done_cv;
+      std::deque<entry> m_queue;
+
+      /* tag of the job each thread is running, nullptr if idle */
+      std::vector<const void*> m_running;
+      bool m_shutdown;
+      std::vector<std::thread> m_threads;
+    };
+  }
+}
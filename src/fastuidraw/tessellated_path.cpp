@@ -99,6 +99,9 @@ namespace
     unsigned int m_max_segments, m_max_recursion;
     fastuidraw::reference_counted_ptr<const fastuidraw::StrokedPath> m_stroked;
     fastuidraw::reference_counted_ptr<const fastuidraw::FilledPath> m_filled;
+
+    /* set by fill_from(), released once m_filled is made */
+    fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> m_fill_from;
   };
 
   void
@@ -794,7 +797,62 @@ filled(void) const
   d = static_cast<TessellatedPathPrivate*>(m_d);
   if (!d->m_filled && !d->m_has_arcs)
     {
-      d->m_filled = FASTUIDRAWnew FilledPath(*this);
+      TessellatedPathPrivate *prev_d(nullptr);
+
+      if (d->m_fill_from)
+        {
+          prev_d = static_cast<TessellatedPathPrivate*>(d->m_fill_from->m_d);
+        }
+
+      if (prev_d && prev_d->m_filled)
+        {
+          d->m_filled = FASTUIDRAWnew FilledPath(*this, *prev_d->m_filled);
+        }
+      else
+        {
+          d->m_filled = FASTUIDRAWnew FilledPath(*this);
+        }
+      d->m_fill_from = nullptr;
     }
   return d->m_filled;
 }
+
+void
+fastuidraw::TessellatedPath::
+fill_from(const reference_counted_ptr<const TessellatedPath> &prev) const
+{
+  TessellatedPathPrivate *d;
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+
+  if (!d->m_filled && !d->m_has_arcs && prev.get() != this)
+    {
+      d->m_fill_from = prev;
+    }
+}
+
+uint64_t
+fastuidraw::TessellatedPath::
+memory_usage(void) const
+{
+  TessellatedPathPrivate *d;
+  uint64_t return_value;
+
+  d = static_cast<TessellatedPathPrivate*>(m_d);
+  return_value = d->m_segment_data.capacity() * sizeof(segment);
+  for(const auto &e : d->m_edge_ranges)
+    {
+      return_value += e.capacity() * sizeof(range_type<unsigned int>);
+    }
+
+  if (d->m_stroked)
+    {
+      return_value += d->m_stroked->memory_usage();
+    }
+
+  if (d->m_filled)
+    {
+      return_value += d->m_filled->memory_usage();
+    }
+
+  return return_value;
+}
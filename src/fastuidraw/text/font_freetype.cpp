@@ -17,6 +17,8 @@
  */
 
 #include <sstream>
+#include <vector>
+#include <cstring>
 #include <fastuidraw/text/font_freetype.hpp>
 #include <fastuidraw/text/glyph_layout_data.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
@@ -30,6 +32,7 @@
 
 #include <ft2build.h>
 #include FT_OUTLINE_H
+#include FT_TRUETYPE_TABLES_H
 
 namespace
 {
@@ -77,8 +80,394 @@ namespace
     unsigned int m_distance_field_pixel_size;
     float m_distance_field_max_distance;
     unsigned int m_curve_pair_pixel_size;
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphRenderDataFileCache> m_render_data_file_cache;
   };
 
+  /* The data of a glyph in a GlyphRenderDataFileCache is a
+   * sequence of 32-bit values:
+   *  - the fields of the GlyphLayoutData
+   *  - the curves added to the Path, see record_path()
+   *  - the rendering data, see write_render_data()
+   */
+  class CacheEntryWriter
+  {
+  public:
+    void
+    add_uint(uint32_t v)
+    {
+      m_data.push_back(v);
+    }
+
+    void
+    add_int(int v)
+    {
+      add_uint(static_cast<uint32_t>(v));
+    }
+
+    void
+    add_float(float f)
+    {
+      uint32_t v;
+      std::memcpy(&v, &f, sizeof(v));
+      add_uint(v);
+    }
+
+    void
+    add_vec2(const fastuidraw::vec2 &v)
+    {
+      add_float(v.x());
+      add_float(v.y());
+    }
+
+    void
+    add_ivec2(const fastuidraw::ivec2 &v)
+    {
+      add_int(v.x());
+      add_int(v.y());
+    }
+
+    void
+    add_bytes(fastuidraw::c_array<const uint8_t> v)
+    {
+      unsigned int start;
+
+      add_uint(v.size());
+      start = m_data.size();
+      m_data.resize(start + (v.size() + 3) / 4, 0u);
+      if (!v.empty())
+        {
+          std::memcpy(&m_data[start], v.c_ptr(), v.size());
+        }
+    }
+
+    fastuidraw::c_array<const uint8_t>
+    data(void) const
+    {
+      return fastuidraw::make_c_array(m_data).reinterpret_pointer<const uint8_t>();
+    }
+
+  private:
+    std::vector<uint32_t> m_data;
+  };
+
+  class CacheEntryReader
+  {
+  public:
+    explicit
+    CacheEntryReader(fastuidraw::c_array<const uint8_t> data):
+      m_data(data),
+      m_ok(true)
+    {}
+
+    bool
+    ok(void) const
+    {
+      return m_ok;
+    }
+
+    uint32_t
+    read_uint(void)
+    {
+      uint32_t v(0);
+      fastuidraw::c_array<const uint8_t> bytes(take(sizeof(v)));
+      if (!bytes.empty())
+        {
+          std::memcpy(&v, bytes.c_ptr(), sizeof(v));
+        }
+      return v;
+    }
+
+    int
+    read_int(void)
+    {
+      return static_cast<int>(read_uint());
+    }
+
+    float
+    read_float(void)
+    {
+      uint32_t v(read_uint());
+      float f;
+      std::memcpy(&f, &v, sizeof(f));
+      return f;
+    }
+
+    fastuidraw::vec2
+    read_vec2(void)
+    {
+      fastuidraw::vec2 v;
+      v.x() = read_float();
+      v.y() = read_float();
+      return v;
+    }
+
+    fastuidraw::ivec2
+    read_ivec2(void)
+    {
+      fastuidraw::ivec2 v;
+      v.x() = read_int();
+      v.y() = read_int();
+      return v;
+    }
+
+    fastuidraw::c_array<const uint8_t>
+    read_bytes(void)
+    {
+      uint32_t sz(read_uint());
+      fastuidraw::c_array<const uint8_t> R;
+
+      R = take(4 * ((static_cast<uint64_t>(sz) + 3) / 4));
+      return R.empty() ? R : R.sub_array(0, sz);
+    }
+
+  private:
+    fastuidraw::c_array<const uint8_t>
+    take(uint64_t sz)
+    {
+      fastuidraw::c_array<const uint8_t> R;
+      if (!m_ok || sz > m_data.size())
+        {
+          m_ok = false;
+          return R;
+        }
+      R = m_data.sub_array(0, sz);
+      m_data = m_data.sub_array(sz);
+      return R;
+    }
+
+    fastuidraw::c_array<const uint8_t> m_data;
+    bool m_ok;
+  };
+
+  /* FNV-1a hash of the contents of a font file. */
+  uint64_t
+  hash_font_file(fastuidraw::c_array<const uint8_t> data)
+  {
+    uint64_t h(0xcbf29ce484222325ull);
+    for(uint8_t v : data)
+      {
+        h ^= v;
+        h *= 0x100000001b3ull;
+      }
+    return h;
+  }
+
+  /* Returns true if a resolution read from a cache file is
+   * within sane bounds and num_bytes is exactly bytes_per_texel
+   * bytes for each of its texels; the product is computed in
+   * 64-bits so that a corrupt file cannot overflow it.
+   */
+  bool
+  valid_cached_resolution(fastuidraw::ivec2 res, uint64_t bytes_per_texel,
+                          uint64_t num_bytes)
+  {
+    const int max_resolution(1 << 14);
+
+    if (res.x() < 0 || res.y() < 0
+        || res.x() > max_resolution || res.y() > max_resolution)
+      {
+        return false;
+      }
+    return bytes_per_texel * static_cast<uint64_t>(res.x()) * static_cast<uint64_t>(res.y()) == num_bytes;
+  }
+
+  /* Records the curves that IntContour::add_to_path() adds to
+   * a Path as: number of contours, and for each contour, the
+   * number of curves and for each curve the number of control
+   * points followed by the control points.
+   */
+  void
+  record_path(const fastuidraw::detail::IntPath &src, std::vector<int> *dst)
+  {
+    if (!dst)
+      {
+        return;
+      }
+
+    dst->clear();
+    dst->push_back(src.contours().size());
+    for(const fastuidraw::detail::IntContour &contour : src.contours())
+      {
+        dst->push_back(contour.curves().size());
+        for(const fastuidraw::detail::IntBezierCurve &curve : contour.curves())
+          {
+            fastuidraw::c_array<const fastuidraw::ivec2> pts(curve.control_pts());
+
+            dst->push_back(pts.size());
+            for(const fastuidraw::ivec2 &p : pts)
+              {
+                dst->push_back(p.x());
+                dst->push_back(p.y());
+              }
+          }
+      }
+  }
+
+  /* Reads what record_path() records, and adds it to a Path
+   * the same way as IntContour::add_to_path() with the
+   * identity transformation.
+   */
+  bool
+  read_path(CacheEntryReader &src, fastuidraw::Path &dst)
+  {
+    unsigned int num_contours(src.read_uint());
+    std::vector<fastuidraw::ivec2> pts;
+
+    for(unsigned int c = 0; c < num_contours && src.ok(); ++c)
+      {
+        unsigned int num_curves(src.read_uint());
+
+        for(unsigned int k = 0; k < num_curves && src.ok(); ++k)
+          {
+            unsigned int num_pts(src.read_uint());
+
+            if (num_pts < 2 || num_pts > 4)
+              {
+                return false;
+              }
+
+            pts.resize(num_pts);
+            for(unsigned int i = 0; i < num_pts; ++i)
+              {
+                pts[i] = src.read_ivec2();
+              }
+
+            dst << fastuidraw::vec2(pts[0]);
+            for(unsigned int i = 1; i + 1 < num_pts; ++i)
+              {
+                dst << fastuidraw::Path::control_point(fastuidraw::vec2(pts[i]));
+              }
+          }
+
+        if (num_curves > 0)
+          {
+            dst << fastuidraw::Path::contour_end();
+          }
+      }
+    return src.ok();
+  }
+
+  void
+  write_render_data(const fastuidraw::GlyphRenderDataDistanceField &src,
+                    CacheEntryWriter &dst)
+  {
+    dst.add_ivec2(src.resolution());
+    dst.add_bytes(src.distance_values());
+  }
+
+  bool
+  read_render_data(CacheEntryReader &src,
+                   fastuidraw::GlyphRenderDataDistanceField &dst)
+  {
+    fastuidraw::ivec2 res(src.read_ivec2());
+    fastuidraw::c_array<const uint8_t> values(src.read_bytes());
+
+    if (!src.ok() || !valid_cached_resolution(res, 1, values.size()))
+      {
+        return false;
+      }
+
+    dst.resize(res);
+    std::copy(values.begin(), values.end(), dst.distance_values().begin());
+    return true;
+  }
+
+  void
+  write_render_data(const fastuidraw::GlyphRenderDataCurvePair &src,
+                    CacheEntryWriter &dst)
+  {
+    typedef fastuidraw::GlyphRenderDataCurvePair::per_curve per_curve;
+
+    dst.add_ivec2(src.resolution());
+    dst.add_bytes(src.active_curve_pair().reinterpret_pointer<const uint8_t>());
+    dst.add_uint(src.geometry_data().size());
+    for(const auto &e : src.geometry_data())
+      {
+        dst.add_vec2(e.m_p);
+        for(const per_curve *c : { &e.m_curve0, &e.m_curve1 })
+          {
+            dst.add_float(c->m_m0);
+            dst.add_float(c->m_m1);
+            dst.add_vec2(c->m_q);
+            dst.add_float(c->m_quad_coeff);
+          }
+        dst.add_uint(e.m_use_min);
+        dst.add_float(e.m_zeta);
+        dst.add_uint(e.m_type);
+      }
+  }
+
+  bool
+  read_render_data(CacheEntryReader &src,
+                   fastuidraw::GlyphRenderDataCurvePair &dst)
+  {
+    typedef fastuidraw::GlyphRenderDataCurvePair::per_curve per_curve;
+    typedef fastuidraw::GlyphRenderDataCurvePair::entry_type entry_type;
+
+    fastuidraw::ivec2 res(src.read_ivec2());
+    fastuidraw::c_array<const uint8_t> texels(src.read_bytes());
+    unsigned int num_entries(src.read_uint());
+
+    if (!src.ok() || !valid_cached_resolution(res, sizeof(uint16_t), texels.size()))
+      {
+        return false;
+      }
+
+    dst.resize_active_curve_pair(res);
+    if (!texels.empty())
+      {
+        std::memcpy(dst.active_curve_pair().c_ptr(), texels.c_ptr(), texels.size());
+      }
+
+    /* the values are read from disk, thus an entry type or
+     * an index into the geometry data that is out of range
+     * means the file is corrupt and it is treated as a miss.
+     */
+    bool valid(true);
+
+    dst.resize_geometry_data(0);
+    for(unsigned int i = 0; i < num_entries && valid; ++i)
+      {
+        fastuidraw::GlyphRenderDataCurvePair::entry e(false);
+        uint32_t type;
+
+        e.m_p = src.read_vec2();
+        for(per_curve *c : { &e.m_curve0, &e.m_curve1 })
+          {
+            c->m_m0 = src.read_float();
+            c->m_m1 = src.read_float();
+            c->m_q = src.read_vec2();
+            c->m_quad_coeff = src.read_float();
+          }
+        e.m_use_min = (src.read_uint() != 0);
+        e.m_zeta = src.read_float();
+        type = src.read_uint();
+
+        valid = src.ok() && type <= fastuidraw::GlyphRenderDataCurvePair::entry_completely_uncovered;
+        if (valid)
+          {
+            e.m_type = static_cast<entry_type>(type);
+            dst.resize_geometry_data(i + 1);
+            dst.geometry_data()[i] = e;
+          }
+      }
+
+    for(uint16_t v : dst.active_curve_pair())
+      {
+        valid = valid
+          && (v < num_entries
+              || v == fastuidraw::GlyphRenderDataCurvePair::completely_full_texel
+              || v == fastuidraw::GlyphRenderDataCurvePair::completely_empty_texel);
+      }
+
+    if (!valid)
+      {
+        dst.resize_active_curve_pair(fastuidraw::ivec2(0, 0));
+        dst.resize_geometry_data(0);
+      }
+    return valid;
+  }
+
   class IntPathCreator
   {
   public:
@@ -197,28 +586,63 @@ namespace
                            fastuidraw::GlyphRenderDataCoverage &output,
                            fastuidraw::Path &path);
 
-    void
+    /* The following return false if the glyph could not be
+     * loaded; if path_record is non-null, the curves added to
+     * path are recorded to it with record_path().
+     */
+    bool
     compute_rendering_data(uint32_t glyph_code,
                            fastuidraw::GlyphLayoutData &layout,
                            fastuidraw::GlyphRenderDataDistanceField &output,
-                           fastuidraw::Path &path);
+                           fastuidraw::Path &path,
+                           std::vector<int> *path_record);
 
-    void
+    bool
     compute_rendering_data(uint32_t glyph_code,
                            fastuidraw::GlyphLayoutData &layout,
                            fastuidraw::GlyphRenderDataCurvePair &output,
-                           fastuidraw::Path &path);
+                           fastuidraw::Path &path,
+                           std::vector<int> *path_record);
+
+    /* Takes the rendering data from the GlyphRenderDataFileCache
+     * of m_render_params if present there, otherwise generates it
+     * with one of the above and stores it in the cache.
+     */
+    template<typename T>
+    void
+    fetch_or_compute_rendering_data(enum fastuidraw::glyph_type tp,
+                                    uint32_t glyph_code,
+                                    fastuidraw::GlyphLayoutData &layout,
+                                    T &output, fastuidraw::Path &path);
+
+    /* Returns true if m_render_data_file_cache is to be used;
+     * on the first call, computes the hash of the font file.
+     */
+    bool
+    ready_render_data_file_cache(void);
 
     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace::GeneratorBase> m_generator;
     fastuidraw::FontFreeType::RenderParams m_render_params;
     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_lib;
     fastuidraw::FontFreeType *m_p;
 
-    /* for now we have a static number of m_faces we use for parallel
-     * glyph generation
+    /* Pool of faces for parallel glyph generation; a new face
+     * is added whenever all faces are in use, so the pool grows
+     * to the number of threads generating glyphs concurrently.
+     * m_faces_mutex guards m_faces (but not the faces).
      */
-    fastuidraw::vecN<fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace>, 8> m_faces;
+    fastuidraw::mutex m_faces_mutex;
+    std::vector<fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> > m_faces;
     bool m_all_faces_null;
+
+    /* hashing the font file is deferred to the first glyph
+     * generated so that creating many fonts is not slowed.
+     */
+    fastuidraw::mutex m_render_data_file_cache_mutex;
+    bool m_render_data_file_cache_ready;
+    bool m_use_render_data_file_cache;
+    uint64_t m_font_hash;
+    uint32_t m_face_index;
   };
 }
 
@@ -228,16 +652,49 @@ FontFreeTypePrivate::FaceGrabber::
 FaceGrabber(FontFreeTypePrivate *q):
   m_p(nullptr)
 {
-  while(!m_p && !q->m_all_faces_null)
+  if (q->m_all_faces_null)
     {
-      for(unsigned int i = 0; i < q->m_faces.size() && !m_p; ++i)
-        {
-          const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> &face(q->m_faces[i]);
-          if (face && face->try_lock())
-            {
-              m_p = face.get();
-            }
-        }
+      return;
+    }
+
+  fastuidraw::FreeTypeFace *wait_on(nullptr);
+  {
+    fastuidraw::autolock_mutex m(q->m_faces_mutex);
+    for(unsigned int i = 0; i < q->m_faces.size() && !m_p; ++i)
+      {
+        if (q->m_faces[i]->try_lock())
+          {
+            m_p = q->m_faces[i].get();
+          }
+      }
+
+    if (!m_p)
+      {
+        fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> face;
+
+        face = q->m_generator->create_face(q->m_lib);
+        if (face && face->face())
+          {
+            FT_Set_Transform(face->face(), nullptr, nullptr);
+            face->lock();
+            q->m_faces.push_back(face);
+            m_p = face.get();
+          }
+        else
+          {
+            wait_on = q->m_faces.front().get();
+          }
+      }
+  }
+
+  if (wait_on)
+    {
+      /* the faces of m_faces are never removed until
+       * the FontFreeType is destroyed, so it is safe
+       * to block on the face outside of the lock.
+       */
+      wait_on->lock();
+      m_p = wait_on;
     }
 }
 
@@ -261,27 +718,140 @@ FontFreeTypePrivate(fastuidraw::FontFreeType *p,
   m_render_params(render_params),
   m_lib(lib),
   m_p(p),
-  m_all_faces_null(true)
+  m_all_faces_null(true),
+  m_render_data_file_cache_ready(false),
+  m_use_render_data_file_cache(false),
+  m_font_hash(0),
+  m_face_index(0)
 {
   if (!m_lib)
     {
       m_lib = FASTUIDRAWnew fastuidraw::FreeTypeLib();
     }
 
-  for(unsigned int i = 0; i < m_faces.size(); ++i)
+  fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> face;
+  face = m_generator->create_face(m_lib);
+  if (face && face->face())
+    {
+      m_all_faces_null = false;
+      FT_Set_Transform(face->face(), nullptr, nullptr);
+      m_faces.push_back(face);
+    }
+}
+
+FontFreeTypePrivate::
+~FontFreeTypePrivate()
+{
+}
+
+bool
+FontFreeTypePrivate::
+ready_render_data_file_cache(void)
+{
+  fastuidraw::autolock_mutex m(m_render_data_file_cache_mutex);
+
+  if (!m_render_data_file_cache_ready && m_render_params.render_data_file_cache())
     {
-      m_faces[i] = m_generator->create_face(m_lib);
-      if (m_faces[i] && m_faces[i]->face())
+      FaceGrabber p(this);
+      FT_ULong length(0);
+      std::vector<FT_Byte> bytes;
+
+      /* a tag of 0 loads the entire font file */
+      if (p.m_p && p.m_p->face()
+          && FT_Load_Sfnt_Table(p.m_p->face(), 0, 0, nullptr, &length) == 0
+          && length > 0)
         {
-          m_all_faces_null = false;
-          FT_Set_Transform(m_faces[i]->face(), nullptr, nullptr);
+          bytes.resize(length);
+          if (FT_Load_Sfnt_Table(p.m_p->face(), 0, 0, &bytes[0], &length) == 0)
+            {
+              m_font_hash = hash_font_file(fastuidraw::make_c_array(bytes));
+              m_face_index = p.m_p->face()->face_index;
+              m_use_render_data_file_cache = true;
+            }
         }
     }
+
+  m_render_data_file_cache_ready = true;
+  return m_use_render_data_file_cache;
 }
 
+template<typename T>
+void
 FontFreeTypePrivate::
-~FontFreeTypePrivate()
+fetch_or_compute_rendering_data(enum fastuidraw::glyph_type tp,
+                                uint32_t glyph_code,
+                                fastuidraw::GlyphLayoutData &layout,
+                                T &output, fastuidraw::Path &path)
 {
+  const fastuidraw::reference_counted_ptr<fastuidraw::GlyphRenderDataFileCache> &cache(m_render_params.render_data_file_cache());
+  fastuidraw::GlyphRenderDataFileCache::key K;
+  fastuidraw::c_array<const uint8_t> cached;
+  std::vector<int> path_record;
+  CacheEntryWriter writer;
+  float max_distance;
+
+  if (!ready_render_data_file_cache())
+    {
+      compute_rendering_data(glyph_code, layout, output, path, nullptr);
+      return;
+    }
+
+  K.m_font_hash = m_font_hash;
+  K.m_face_index = m_face_index;
+  K.m_glyph_code = glyph_code;
+  K.m_glyph_type = tp;
+  if (tp == fastuidraw::distance_field_glyph)
+    {
+      K.m_pixel_size = m_render_params.distance_field_pixel_size();
+      max_distance = m_render_params.distance_field_max_distance();
+      std::memcpy(&K.m_parameters, &max_distance, sizeof(K.m_parameters));
+    }
+  else
+    {
+      K.m_pixel_size = m_render_params.curve_pair_pixel_size();
+    }
+
+  if (cache->fetch(K, &cached))
+    {
+      CacheEntryReader reader(cached);
+      fastuidraw::GlyphLayoutData L;
+      fastuidraw::Path P;
+
+      L.m_glyph_code = glyph_code;
+      L.m_font = m_p;
+      L.m_horizontal_layout_offset = reader.read_vec2();
+      L.m_vertical_layout_offset = reader.read_vec2();
+      L.m_size = reader.read_vec2();
+      L.m_advance = reader.read_vec2();
+      L.m_units_per_EM = reader.read_float();
+      if (read_path(reader, P) && read_render_data(reader, output))
+        {
+          layout = L;
+          path = P;
+          return;
+        }
+    }
+
+  if (!compute_rendering_data(glyph_code, layout, output, path, &path_record))
+    {
+      return;
+    }
+
+  writer.add_vec2(layout.m_horizontal_layout_offset);
+  writer.add_vec2(layout.m_vertical_layout_offset);
+  writer.add_vec2(layout.m_size);
+  writer.add_vec2(layout.m_advance);
+  writer.add_float(layout.m_units_per_EM);
+  if (path_record.empty())
+    {
+      writer.add_uint(0);
+    }
+  for(int v : path_record)
+    {
+      writer.add_int(v);
+    }
+  write_render_data(output, writer);
+  cache->store(K, writer.data());
 }
 
 void
@@ -362,12 +932,13 @@ compute_rendering_data(int pixel_size, uint32_t glyph_code,
     }
 }
 
-void
+bool
 FontFreeTypePrivate::
 compute_rendering_data(uint32_t glyph_code,
                        fastuidraw::GlyphLayoutData &layout,
                        fastuidraw::GlyphRenderDataDistanceField &output,
-                       fastuidraw::Path &path)
+                       fastuidraw::Path &path,
+                       std::vector<int> *path_record)
 {
   fastuidraw::detail::IntPath int_path_ecm;
   int units_per_EM;
@@ -379,7 +950,7 @@ compute_rendering_data(uint32_t glyph_code,
     FaceGrabber p(this);
     if (!p.m_p || !p.m_p->face())
       {
-        return;
+        return false;
       }
 
     FT_Face face(p.m_p->face());
@@ -396,11 +967,12 @@ compute_rendering_data(uint32_t glyph_code,
 
   if (int_path_ecm.empty())
     {
-      return;
+      return true;
     }
 
   fastuidraw::detail::IntBezierCurve::transformation<float> identity_tr;
   int_path_ecm.add_to_path(identity_tr, &path);
+  record_path(int_path_ecm, path_record);
 
   /* choose the correct fill rule as according to outline_flags */
   enum fastuidraw::PainterEnums::fill_rule_t fill_rule;
@@ -419,7 +991,7 @@ compute_rendering_data(uint32_t glyph_code,
   if (image_sz.x() == 0 || image_sz.y() == 0)
     {
       output.resize(fastuidraw::ivec2(0, 0));
-      return;
+      return true;
     }
 
   /* we translate by -layout_offset to make the points of
@@ -439,14 +1011,16 @@ compute_rendering_data(uint32_t glyph_code,
   int_path_ecm.extract_render_data(texel_distance, image_sz, max_distance, tr,
                                    fastuidraw::CustomFillRuleFunction(fill_rule),
                                    &output);
+  return true;
 }
 
-void
+bool
 FontFreeTypePrivate::
 compute_rendering_data(uint32_t glyph_code,
                        fastuidraw::GlyphLayoutData &layout,
                        fastuidraw::GlyphRenderDataCurvePair &output,
-                       fastuidraw::Path &path)
+                       fastuidraw::Path &path,
+                       std::vector<int> *path_record)
 {
   fastuidraw::detail::IntPath int_path_ecm;
   int units_per_EM;
@@ -457,7 +1031,7 @@ compute_rendering_data(uint32_t glyph_code,
     FaceGrabber p(this);
     if (!p.m_p || !p.m_p->face())
       {
-        return;
+        return false;
       }
 
     FT_Face face(p.m_p->face());
@@ -494,17 +1068,19 @@ compute_rendering_data(uint32_t glyph_code,
   if (int_path_ecm.empty() || image_sz.x() == 0 || image_sz.y() == 0)
     {
       output.resize_active_curve_pair(fastuidraw::ivec2(0, 0));
-      return;
+      return true;
     }
 
   /* extract to a Path */
   fastuidraw::detail::IntBezierCurve::transformation<float> identity_tr;
   int_path_ecm.add_to_path(identity_tr, &path);
+  record_path(int_path_ecm, path_record);
 
   /* extract render data*/
   int_path_ecm.extract_render_data(texel_distance, image_sz, tr,
                                    fastuidraw::CustomFillRuleFunction(fill_rule),
                                     &output);
+  return true;
 }
 
 /////////////////////////////////////////////
@@ -542,6 +1118,10 @@ setget_implement(fastuidraw::FontFreeType::RenderParams,
 setget_implement(fastuidraw::FontFreeType::RenderParams,
                  RenderParamsPrivate,
                  unsigned int, curve_pair_pixel_size)
+setget_implement(fastuidraw::FontFreeType::RenderParams,
+                 RenderParamsPrivate,
+                 const fastuidraw::reference_counted_ptr<fastuidraw::GlyphRenderDataFileCache>&,
+                 render_data_file_cache)
 
 ///////////////////////////////////////////////////
 // fastuidraw::FontFreeType methods
@@ -626,7 +1206,7 @@ compute_rendering_data(GlyphRender render, uint32_t glyph_code,
       {
         GlyphRenderDataDistanceField *data;
         data = FASTUIDRAWnew GlyphRenderDataDistanceField();
-        d->compute_rendering_data(glyph_code, layout, *data, path);
+        d->fetch_or_compute_rendering_data(distance_field_glyph, glyph_code, layout, *data, path);
         return data;
       }
       break;
@@ -635,7 +1215,7 @@ compute_rendering_data(GlyphRender render, uint32_t glyph_code,
       {
         GlyphRenderDataCurvePair *data;
         data = FASTUIDRAWnew GlyphRenderDataCurvePair();
-        d->compute_rendering_data(glyph_code, layout, *data, path);
+        d->fetch_or_compute_rendering_data(curve_pair_glyph, glyph_code, layout, *data, path);
         return data;
       }
       break;
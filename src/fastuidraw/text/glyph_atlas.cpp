@@ -17,6 +17,8 @@
  */
 
 
+#include <vector>
+#include <algorithm>
 #include <fastuidraw/text/glyph_atlas.hpp>
 
 #include "../private/interval_allocator.hpp"
@@ -80,6 +82,94 @@ namespace
     unsigned int m_size;
   };
 
+  /* A copy in host memory of the texels of a layer of the
+   * texel store together with the regions written since
+   * the last flush.
+   */
+  class texel_layer
+  {
+  public:
+    class region
+    {
+    public:
+      fastuidraw::ivec2 m_min, m_max;
+    };
+
+    void
+    set_data(fastuidraw::ivec2 dims, int x, int y, int w, int h,
+             fastuidraw::c_array<const uint8_t> data);
+
+    /* issue the writes to the texel store, returning the number
+     * of calls to GlyphAtlasTexelBackingStoreBase::set_data()
+     * and the number of bytes passed.
+     */
+    std::pair<unsigned int, uint64_t>
+    flush(fastuidraw::GlyphAtlasTexelBackingStoreBase *store, int layer);
+
+    std::vector<uint8_t> m_texels;
+    std::vector<region> m_dirty;
+
+  private:
+    class cluster
+    {
+    public:
+      explicit
+      cluster(const region &R):
+        m_region(R),
+        m_dirty_area(area(R))
+      {}
+
+      cluster(const cluster &a, const cluster &b):
+        m_dirty_area(a.m_dirty_area + b.m_dirty_area)
+      {
+        m_region.m_min.x() = std::min(a.m_region.m_min.x(), b.m_region.m_min.x());
+        m_region.m_min.y() = std::min(a.m_region.m_min.y(), b.m_region.m_min.y());
+        m_region.m_max.x() = std::max(a.m_region.m_max.x(), b.m_region.m_max.x());
+        m_region.m_max.y() = std::max(a.m_region.m_max.y(), b.m_region.m_max.y());
+      }
+
+      static
+      uint64_t
+      area(const region &R)
+      {
+        return (R.m_max.x() - R.m_min.x()) * (R.m_max.y() - R.m_min.y());
+      }
+
+      uint64_t
+      area(void) const
+      {
+        return area(m_region);
+      }
+
+      static
+      bool
+      compare_y_then_x(const cluster &a, const cluster &b)
+      {
+        const fastuidraw::ivec2 &pa(a.m_region.m_min), &pb(b.m_region.m_min);
+        return pa.y() < pb.y() || (pa.y() == pb.y() && pa.x() < pb.x());
+      }
+
+      region m_region;
+      uint64_t m_dirty_area;
+    };
+
+    void
+    upload(fastuidraw::GlyphAtlasTexelBackingStoreBase *store, int layer,
+           const region &R);
+
+    fastuidraw::ivec2 m_dims;
+    std::vector<uint8_t> m_scratch;
+    std::vector<cluster> m_clusters, m_merged;
+  };
+
+  /* A write to the geometry store not yet issued */
+  class geometry_write
+  {
+  public:
+    unsigned int m_location, m_end, m_order;
+    std::vector<fastuidraw::generic_data> m_data;
+  };
+
   class GlyphAtlasPrivate
   {
   public:
@@ -87,13 +177,20 @@ namespace
                       fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasGeometryBackingStoreBase> pgeometry_store):
       m_texel_store(ptexel_store),
       m_geometry_store(pgeometry_store),
-      m_geometry_data_allocator(pgeometry_store->size())
+      m_geometry_data_allocator(pgeometry_store->size()),
+      m_counters(0u)
     {
       FASTUIDRAWassert(m_texel_store);
       FASTUIDRAWassert(m_geometry_store);
       allocate_atlas_bookkeeping(m_texel_store->dimensions().z());
     };
 
+    void
+    flush_texels(void);
+
+    void
+    flush_geometry(void);
+
     void
     allocate_atlas_bookkeeping(int new_size)
     {
@@ -113,9 +210,216 @@ namespace
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasGeometryBackingStoreBase> m_geometry_store;
     std::vector<fastuidraw::reference_counted_ptr<rect_atlas_layer> > m_private_data;
     fastuidraw::interval_allocator m_geometry_data_allocator;
+
+    /* texel and geometry writes are held until flush() so
+     * that they can be issued to the backing stores as a few
+     * large writes instead of one small write per glyph.
+     */
+    std::vector<texel_layer> m_texel_layers;
+    std::vector<geometry_write> m_pending_geometry;
+    std::vector<geometry_write*> m_geometry_scratch;
+    std::vector<fastuidraw::generic_data> m_geometry_run;
+
+    fastuidraw::vecN<uint64_t, fastuidraw::GlyphAtlas::number_counters> m_counters;
   };
 }
 
+//////////////////////////////////////////
+// texel_layer methods
+void
+texel_layer::
+set_data(fastuidraw::ivec2 dims, int x, int y, int w, int h,
+         fastuidraw::c_array<const uint8_t> data)
+{
+  region R;
+
+  if (m_texels.empty())
+    {
+      m_dims = dims;
+      m_texels.resize(dims.x() * dims.y(), 0u);
+    }
+
+  FASTUIDRAWassert(m_dims == dims);
+  FASTUIDRAWassert(data.size() >= static_cast<unsigned int>(w * h));
+  for(int row = 0; row < h; ++row)
+    {
+      fastuidraw::c_array<const uint8_t> src;
+
+      src = data.sub_array(row * w, w);
+      std::copy(src.begin(), src.end(), m_texels.begin() + x + (y + row) * m_dims.x());
+    }
+
+  R.m_min = fastuidraw::ivec2(x, y);
+  R.m_max = fastuidraw::ivec2(x + w, y + h);
+  m_dirty.push_back(R);
+}
+
+void
+texel_layer::
+upload(fastuidraw::GlyphAtlasTexelBackingStoreBase *store, int layer,
+       const region &R)
+{
+  fastuidraw::ivec2 sz(R.m_max - R.m_min);
+
+  m_scratch.resize(sz.x() * sz.y());
+  for(int row = 0; row < sz.y(); ++row)
+    {
+      std::vector<uint8_t>::const_iterator src;
+
+      src = m_texels.begin() + R.m_min.x() + (R.m_min.y() + row) * m_dims.x();
+      std::copy(src, src + sz.x(), m_scratch.begin() + row * sz.x());
+    }
+  store->set_data(R.m_min.x(), R.m_min.y(), layer, sz.x(), sz.y(),
+                  fastuidraw::make_c_array(m_scratch));
+}
+
+std::pair<unsigned int, uint64_t>
+texel_layer::
+flush(fastuidraw::GlyphAtlasTexelBackingStoreBase *store, int layer)
+{
+  std::pair<unsigned int, uint64_t> return_value(0u, 0u);
+
+  /* Merge the dirty regions into clusters, each written as one
+   * region. Two clusters are merged when the dirty area of the
+   * merged cluster is at least half of its area, so at most half
+   * of the bytes written are not dirty. Each pass sorts the
+   * clusters by (y, x) and tries to merge each cluster into one
+   * of the last merge_window clusters produced by the pass; the
+   * RectAtlas packs glyphs allocated together into rows, so this
+   * finds most merges while keeping the cost of a flush at
+   * O(n log n) instead of comparing every pair of clusters.
+   */
+  const unsigned int merge_window(8), max_passes(4);
+
+  m_clusters.clear();
+  for(const region &R : m_dirty)
+    {
+      m_clusters.push_back(cluster(R));
+    }
+
+  for(unsigned int pass = 0; pass < max_passes && m_clusters.size() > 1; ++pass)
+    {
+      unsigned int start_size(m_clusters.size());
+
+      std::sort(m_clusters.begin(), m_clusters.end(), cluster::compare_y_then_x);
+      m_merged.clear();
+      for(const cluster &C : m_clusters)
+        {
+          bool merged(false);
+          unsigned int end(m_merged.size());
+          unsigned int begin((end > merge_window) ? end - merge_window : 0u);
+
+          for(unsigned int i = end; i > begin && !merged; --i)
+            {
+              cluster M(m_merged[i - 1], C);
+              if (2u * M.m_dirty_area >= M.area())
+                {
+                  m_merged[i - 1] = M;
+                  merged = true;
+                }
+            }
+
+          if (!merged)
+            {
+              m_merged.push_back(C);
+            }
+        }
+      std::swap(m_clusters, m_merged);
+
+      if (m_clusters.size() == start_size)
+        {
+          break;
+        }
+    }
+
+  for(const cluster &C : m_clusters)
+    {
+      upload(store, layer, C.m_region);
+      ++return_value.first;
+      return_value.second += C.area();
+    }
+  m_dirty.clear();
+
+  return return_value;
+}
+
+//////////////////////////////////////////
+// GlyphAtlasPrivate methods
+void
+GlyphAtlasPrivate::
+flush_texels(void)
+{
+  for(unsigned int layer = 0, end_layer = m_texel_layers.size(); layer < end_layer; ++layer)
+    {
+      std::pair<unsigned int, uint64_t> v;
+
+      v = m_texel_layers[layer].flush(m_texel_store.get(), layer);
+      m_counters[fastuidraw::GlyphAtlas::texel_upload_counter] += v.first;
+      m_counters[fastuidraw::GlyphAtlas::texel_upload_bytes_counter] += v.second;
+    }
+}
+
+void
+GlyphAtlasPrivate::
+flush_geometry(void)
+{
+  unsigned int alignment(m_geometry_store->alignment());
+
+  if (m_pending_geometry.empty())
+    {
+      return;
+    }
+
+  m_geometry_scratch.clear();
+  for(geometry_write &G : m_pending_geometry)
+    {
+      m_geometry_scratch.push_back(&G);
+    }
+  std::sort(m_geometry_scratch.begin(), m_geometry_scratch.end(),
+            [](const geometry_write *a, const geometry_write *b)
+            {
+              return a->m_location < b->m_location;
+            });
+
+  /* each run of writes that overlap or touch is issued as
+   * one write; a location written more than once (the data
+   * freed and allocated again before the flush) takes the
+   * value of the last write made to it.
+   */
+  for(unsigned int i = 0, endi = m_geometry_scratch.size(); i < endi;)
+    {
+      unsigned int j, begin, end;
+
+      begin = m_geometry_scratch[i]->m_location;
+      end = m_geometry_scratch[i]->m_end;
+      for(j = i + 1; j < endi && m_geometry_scratch[j]->m_location <= end; ++j)
+        {
+          end = std::max(end, m_geometry_scratch[j]->m_end);
+        }
+
+      std::sort(m_geometry_scratch.begin() + i, m_geometry_scratch.begin() + j,
+                [](const geometry_write *a, const geometry_write *b)
+                {
+                  return a->m_order < b->m_order;
+                });
+
+      m_geometry_run.resize((end - begin) * alignment);
+      for(unsigned int k = i; k < j; ++k)
+        {
+          const geometry_write *G(m_geometry_scratch[k]);
+          std::copy(G->m_data.begin(), G->m_data.end(),
+                    m_geometry_run.begin() + (G->m_location - begin) * alignment);
+        }
+
+      m_geometry_store->set_values(begin, fastuidraw::make_c_array(m_geometry_run));
+      ++m_counters[fastuidraw::GlyphAtlas::geometry_upload_counter];
+      m_counters[fastuidraw::GlyphAtlas::geometry_upload_bytes_counter]
+        += m_geometry_run.size() * sizeof(fastuidraw::generic_data);
+      i = j;
+    }
+  m_pending_geometry.clear();
+}
+
 /////////////////////////////////////////////////////
 // fastuidraw::GlyphAtlasTexelBackingStoreBase methods
 fastuidraw::GlyphAtlasTexelBackingStoreBase::
@@ -341,9 +645,16 @@ allocate(fastuidraw::ivec2 size, c_array<const uint8_t> pdata,
 
   if (r != nullptr)
     {
+      ivec3 dims(d->m_texel_store->dimensions());
+
       return_value.m_opaque = r;
-      d->m_texel_store->set_data(r->minX_minY().x(), r->minX_minY().y(), layer,
-                                 size.x(), size.y(), pdata);
+      if (d->m_texel_layers.size() <= layer)
+        {
+          d->m_texel_layers.resize(layer + 1);
+        }
+      d->m_texel_layers[layer].set_data(ivec2(dims.x(), dims.y()),
+                                        r->minX_minY().x(), r->minX_minY().y(),
+                                        size.x(), size.y(), pdata);
     }
 
   return return_value;
@@ -398,7 +709,14 @@ allocate_geometry_data(c_array<const generic_data> pdata)
         }
     }
 
-  d->m_geometry_store->set_values(return_value, pdata);
+  d->m_pending_geometry.push_back(geometry_write());
+  geometry_write &G(d->m_pending_geometry.back());
+  G.m_location = return_value;
+  G.m_end = return_value + block_count;
+  G.m_order = d->m_pending_geometry.size();
+  G.m_data.resize(pdata.size());
+  std::copy(pdata.begin(), pdata.end(), G.m_data.begin());
+
   return return_value;
 }
 
@@ -446,10 +764,35 @@ flush(void) const
   d = static_cast<GlyphAtlasPrivate*>(m_d);
 
   autolock_mutex m(d->m_mutex);
+  d->flush_texels();
+  d->flush_geometry();
   d->m_texel_store->flush();
   d->m_geometry_store->flush();
 }
 
+uint64_t
+fastuidraw::GlyphAtlas::
+counter(enum counter_t tp) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  FASTUIDRAWassert(tp < number_counters);
+  return d->m_counters[tp];
+}
+
+void
+fastuidraw::GlyphAtlas::
+reset_counters(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  d->m_counters = vecN<uint64_t, number_counters>(0);
+}
+
 fastuidraw::reference_counted_ptr<const fastuidraw::GlyphAtlasTexelBackingStoreBase>
 fastuidraw::GlyphAtlas::
 texel_store(void) const
@@ -17,11 +17,16 @@
  */
 
 
-#include <map>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
 #include "../private/util_private.hpp"
+#include "../private/worker_pool.hpp"
 
 
 namespace
@@ -32,14 +37,18 @@ namespace
   class GlyphDataPrivate
   {
   public:
-    GlyphDataPrivate(GlyphCachePrivate *c, unsigned int I);
-
     explicit
     GlyphDataPrivate(void);
 
     void
     clear(void);
 
+    /* release the room the glyph takes on the atlas,
+     * but keep the data to upload the glyph again
+     */
+    void
+    release_atlas_storage(void);
+
     enum fastuidraw::return_code
     upload_to_atlas(void);
 
@@ -51,6 +60,11 @@ namespace
      */
     unsigned int m_cache_location;
 
+    /* if true, the object is owned by a slab of
+     * m_cache and is not to be deleted directly.
+     */
+    bool m_slab_allocated;
+
     /* layout magicks
      */
     fastuidraw::GlyphLayoutData m_layout;
@@ -62,6 +76,16 @@ namespace
     int m_geometry_offset, m_geometry_length;
     bool m_uploaded_to_atlas;
 
+    /* value of m_cache->m_frame when the glyph was last
+     * fetched or uploaded
+     */
+    uint64_t m_last_used_frame;
+
+    /* number of pins (see Glyph::pin()); a glyph with
+     * pins is never evicted by evict_cold_glyphs().
+     */
+    unsigned int m_pin_count;
+
     /* Path of the glyph
      */
     fastuidraw::Path m_path;
@@ -71,6 +95,20 @@ namespace
     fastuidraw::GlyphRenderData *m_glyph_data;
   };
 
+  /* GlyphDataPrivate objects made by a cache are allocated
+   * slab_size at a time so that they are contiguous in memory.
+   */
+  class GlyphDataSlab:fastuidraw::noncopyable
+  {
+  public:
+    enum
+      {
+        slab_size = 256
+      };
+
+    GlyphDataPrivate m_entries[slab_size];
+  };
+
   class GlyphSource
   {
   public:
@@ -85,17 +123,290 @@ namespace
       m_render(r)
     {}
 
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
+    uint32_t m_glyph_code;
+    fastuidraw::GlyphRender m_render;
+  };
+
+  /* Hashing of a (font, glyph_code, renderer) triple is split
+   * into a seed computed from the font and renderer and a
+   * final mix with the glyph code so that a batch of lookups
+   * against the same font and renderer computes the seed once.
+   */
+  inline
+  uint64_t
+  mix_bits(uint64_t h)
+  {
+    h ^= h >> 33u;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33u;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33u;
+    return h;
+  }
+
+  inline
+  uint64_t
+  hash_seed(const fastuidraw::FontBase *font, fastuidraw::GlyphRender render)
+  {
+    uint64_t v;
+
+    v = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(font));
+    v ^= static_cast<uint64_t>(render.m_type) << 56u;
+    if (!fastuidraw::GlyphRender::scalable(render.m_type))
+      {
+        v ^= static_cast<uint64_t>(static_cast<uint32_t>(render.m_pixel_size)) << 24u;
+      }
+    return mix_bits(v);
+  }
+
+  inline
+  uint32_t
+  hash_glyph(uint64_t seed, uint32_t glyph_code)
+  {
+    return static_cast<uint32_t>(mix_bits(seed + glyph_code));
+  }
+
+  /* Open addressing hash table with linear probing; a slot is
+   * empty exactly when its m_glyph is nullptr. Removal uses
+   * backward-shift deletion so no tombstones are needed and
+   * a probe sequence always ends at the first empty slot.
+   */
+  class GlyphHashTable:fastuidraw::noncopyable
+  {
+  public:
+    GlyphHashTable(void):
+      m_slots(initial_capacity),
+      m_size(0)
+    {}
+
+    GlyphDataPrivate*
+    find(const fastuidraw::FontBase *font, uint32_t glyph_code,
+         fastuidraw::GlyphRender render, uint32_t hash) const
+    {
+      unsigned int mask(m_slots.size() - 1u);
+      for(unsigned int i = hash & mask; m_slots[i].m_glyph; i = (i + 1u) & mask)
+        {
+          const slot &S(m_slots[i]);
+          if (S.m_hash == hash
+              && S.m_key.m_glyph_code == glyph_code
+              && S.m_key.m_font.get() == font
+              && S.m_key.m_render == render)
+            {
+              return S.m_glyph;
+            }
+        }
+      return nullptr;
+    }
+
+    /* the key must not already be in the table */
+    void
+    insert(const GlyphSource &key, uint32_t hash, GlyphDataPrivate *G)
+    {
+      FASTUIDRAWassert(G);
+      FASTUIDRAWassert(!find(key.m_font.get(), key.m_glyph_code, key.m_render, hash));
+      if (2u * (m_size + 1u) > m_slots.size())
+        {
+          grow();
+        }
+      insert_no_grow(key, hash, G);
+    }
+
+    void
+    erase(const fastuidraw::FontBase *font, uint32_t glyph_code,
+          fastuidraw::GlyphRender render, uint32_t hash)
+    {
+      unsigned int mask(m_slots.size() - 1u), i;
+
+      for(i = hash & mask; m_slots[i].m_glyph; i = (i + 1u) & mask)
+        {
+          const slot &S(m_slots[i]);
+          if (S.m_hash == hash
+              && S.m_key.m_glyph_code == glyph_code
+              && S.m_key.m_font.get() == font
+              && S.m_key.m_render == render)
+            {
+              break;
+            }
+        }
+
+      if (!m_slots[i].m_glyph)
+        {
+          return;
+        }
+
+      /* shift back following entries of the cluster whose
+       * home slot is not in the cyclic range (i, j].
+       */
+      for(unsigned int j = (i + 1u) & mask; m_slots[j].m_glyph; j = (j + 1u) & mask)
+        {
+          unsigned int home(m_slots[j].m_hash & mask);
+          bool movable;
+
+          movable = (i <= j) ?
+            (home <= i || home > j) :
+            (home <= i && home > j);
+
+          if (movable)
+            {
+              m_slots[i] = m_slots[j];
+              i = j;
+            }
+        }
+      m_slots[i] = slot();
+      --m_size;
+    }
+
+    void
+    clear(void)
+    {
+      std::vector<slot> tmp(initial_capacity);
+      m_slots.swap(tmp);
+      m_size = 0;
+    }
+
+  private:
+    enum
+      {
+        initial_capacity = 256
+      };
+
+    class slot
+    {
+    public:
+      slot(void):
+        m_hash(0),
+        m_glyph(nullptr)
+      {}
+
+      GlyphSource m_key;
+      uint32_t m_hash;
+      GlyphDataPrivate *m_glyph;
+    };
+
+    void
+    insert_no_grow(const GlyphSource &key, uint32_t hash, GlyphDataPrivate *G)
+    {
+      unsigned int mask(m_slots.size() - 1u), i;
+      for(i = hash & mask; m_slots[i].m_glyph; i = (i + 1u) & mask)
+        {}
+      m_slots[i].m_key = key;
+      m_slots[i].m_hash = hash;
+      m_slots[i].m_glyph = G;
+      ++m_size;
+    }
+
+    void
+    grow(void)
+    {
+      std::vector<slot> old(2u * m_slots.size());
+
+      old.swap(m_slots);
+      m_size = 0;
+      for(const slot &S : old)
+        {
+          if (S.m_glyph)
+            {
+              insert_no_grow(S.m_key, S.m_hash, S.m_glyph);
+            }
+        }
+    }
+
+    std::vector<slot> m_slots;
+    unsigned int m_size;
+  };
+
+  /* A PrefetchRequest is a set of glyphs, all from the same font
+   * and with the same renderer, whose rendering data is generated
+   * by the threads of PrefetchWorkers. Only the thread that calls
+   * into the GlyphCache places the results into the cache.
+   */
+  class PrefetchRequest:fastuidraw::noncopyable
+  {
+  public:
+    PrefetchRequest(unsigned int ticket, fastuidraw::GlyphRender render,
+                    const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> &font,
+                    std::vector<uint32_t> &glyph_codes):
+      m_ticket(ticket),
+      m_render(render),
+      m_font(font),
+      m_results(glyph_codes.size(), nullptr),
+      m_remaining(glyph_codes.size())
+    {
+      m_glyph_codes.swap(glyph_codes);
+    }
+
+    ~PrefetchRequest()
+    {
+      for(GlyphDataPrivate *G : m_results)
+        {
+          if (G)
+            {
+              G->clear();
+              FASTUIDRAWdelete(G);
+            }
+        }
+    }
+
+    void
+    compute(unsigned int I)
+    {
+      GlyphDataPrivate *G;
+
+      G = FASTUIDRAWnew GlyphDataPrivate();
+      G->m_render = m_render;
+      G->m_glyph_data = m_font->compute_rendering_data(G->m_render, m_glyph_codes[I],
+                                                       G->m_layout, G->m_path);
+      m_results[I] = G;
+    }
+
     bool
-    operator<(const GlyphSource &rhs) const
+    complete(void) const
     {
-      return (m_font != rhs.m_font) ? m_font < rhs.m_font :
-        (m_glyph_code != rhs.m_glyph_code) ? m_glyph_code < rhs.m_glyph_code :
-        m_render < rhs.m_render;
+      return m_remaining.load(std::memory_order_acquire) == 0;
     }
 
-    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
-    uint32_t m_glyph_code;
+    unsigned int m_ticket;
     fastuidraw::GlyphRender m_render;
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
+    std::vector<uint32_t> m_glyph_codes;
+    std::vector<GlyphDataPrivate*> m_results;
+
+    /* number of elements of m_glyph_codes not yet computed */
+    std::atomic<unsigned int> m_remaining;
+  };
+
+  /* Generates the glyphs of PrefetchRequest objects on the
+   * threads of a WorkerPool, one job per glyph so that a single
+   * large request is spread across all threads.
+   */
+  class PrefetchWorkers:fastuidraw::noncopyable
+  {
+  public:
+    explicit
+    PrefetchWorkers(unsigned int num_threads);
+
+    void
+    add(PrefetchRequest *R);
+
+    /* block until R is complete */
+    void
+    wait(PrefetchRequest *R);
+
+    /* incremented each time a request becomes complete */
+    std::atomic<unsigned int> m_num_completed;
+
+  private:
+    void
+    compute(PrefetchRequest *R, unsigned int I);
+
+    std::mutex m_mutex;
+    std::condition_variable m_done_cv;
+
+    /* declared last so that its threads are
+     * joined before the above are destroyed.
+     */
+    fastuidraw::detail::WorkerPool m_pool;
   };
 
   class GlyphCachePrivate
@@ -107,42 +418,84 @@ namespace
 
     ~GlyphCachePrivate();
 
-    /* When the atlas is full, we will clear the atlas, but save
-     *  the values in m_glyphs but mark them as not having been
-     *  uploaded, this way returned values are safe and we do
-     *  not have to regenerate data either.
+    /* When the atlas is full, we release the atlas room of
+     * the least recently used glyphs that were not used in
+     * the current frame, but keep their values in m_glyphs
+     * marked as not having been uploaded; this way returned
+     * values are safe and we do not have to regenerate data
+     * either. Returns the number of glyphs evicted.
      */
+    unsigned int
+    evict_cold_glyphs(void);
+
+    GlyphDataPrivate*
+    fetch_glyph(fastuidraw::GlyphRender render,
+                const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> &font,
+                uint32_t glyph_code, uint32_t hash);
 
     GlyphDataPrivate*
-    fetch_or_allocate_glyph(GlyphSource src);
+    allocate_glyph(void);
+
+    /* place G, which is not on any cache, into the cache
+     * unless the cache already has a glyph with the same
+     * key; returns false if G was not placed.
+     */
+    bool
+    adopt_glyph(GlyphDataPrivate *G);
+
+    void
+    merge_prefetch(PrefetchRequest *R);
+
+    void
+    merge_completed_prefetches(void)
+    {
+      if (m_prefetch_workers
+          && m_prefetch_workers->m_num_completed.load(std::memory_order_acquire) != m_num_merged)
+        {
+          merge_completed_prefetches_implement();
+        }
+    }
+
+    void
+    merge_completed_prefetches_implement(void);
 
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> m_atlas;
-    std::map<GlyphSource, GlyphDataPrivate*> m_glyph_map;
+    GlyphHashTable m_glyph_map;
     std::vector<GlyphDataPrivate*> m_glyphs;
     std::vector<unsigned int> m_free_slots;
+
+    /* m_slab_used is how many of the last slab are in use */
+    std::vector<GlyphDataSlab*> m_slabs;
+    unsigned int m_slab_used;
+
+    uint64_t m_frame;
+    fastuidraw::vecN<unsigned int, fastuidraw::GlyphCache::number_counters> m_counters;
+    std::vector<GlyphDataPrivate*> m_eviction_candidates;
+
+    /* m_prefetch_workers is created on the first prefetch;
+     * m_pending_prefetches are the requests not yet merged
+     * into the cache, in the order of their tickets.
+     */
+    unsigned int m_num_prefetch_threads;
+    PrefetchWorkers *m_prefetch_workers;
+    std::vector<PrefetchRequest*> m_pending_prefetches;
+    unsigned int m_num_merged, m_next_ticket;
     fastuidraw::GlyphCache *m_p;
   };
 }
 
 /////////////////////////////////////////////////////////
 // GlyphDataPrivate methods
-GlyphDataPrivate::
-GlyphDataPrivate(GlyphCachePrivate *c, unsigned int I):
-  m_cache(c),
-  m_cache_location(I),
-  m_geometry_offset(-1),
-  m_geometry_length(0),
-  m_uploaded_to_atlas(false),
-  m_glyph_data(nullptr)
-{}
-
 GlyphDataPrivate::
 GlyphDataPrivate(void):
   m_cache(nullptr),
   m_cache_location(~0u),
+  m_slab_allocated(false),
   m_geometry_offset(-1),
   m_geometry_length(0),
   m_uploaded_to_atlas(false),
+  m_last_used_frame(0),
+  m_pin_count(0),
   m_glyph_data(nullptr)
 {}
 
@@ -153,6 +506,20 @@ clear(void)
   m_render = fastuidraw::GlyphRender();
   FASTUIDRAWassert(!m_render.valid());
 
+  release_atlas_storage();
+  if (m_glyph_data)
+    {
+      FASTUIDRAWdelete(m_glyph_data);
+      m_glyph_data = nullptr;
+    }
+  m_path.clear();
+  m_pin_count = 0;
+}
+
+void
+GlyphDataPrivate::
+release_atlas_storage(void)
+{
   if (m_cache)
     {
       if (m_atlas_location[0].valid())
@@ -174,14 +541,7 @@ clear(void)
           m_geometry_length = 0;
         }
     }
-
   m_uploaded_to_atlas = false;
-  if (m_glyph_data)
-    {
-      FASTUIDRAWdelete(m_glyph_data);
-      m_glyph_data = nullptr;
-    }
-  m_path.clear();
 }
 
 enum fastuidraw::return_code
@@ -196,22 +556,29 @@ upload_to_atlas(void)
    */
   enum fastuidraw::return_code return_value;
 
+  if (!m_cache)
+    {
+      return fastuidraw::routine_fail;
+    }
+
+  m_last_used_frame = m_cache->m_frame;
   if (m_uploaded_to_atlas)
     {
       return fastuidraw::routine_success;
     }
 
-  if (!m_cache)
+  FASTUIDRAWassert(m_glyph_data);
+  do
     {
-      return fastuidraw::routine_fail;
+      return_value = m_glyph_data->upload_to_atlas(m_cache->m_atlas,
+                                                   m_atlas_location[0],
+                                                   m_atlas_location[1],
+                                                   m_geometry_offset,
+                                                   m_geometry_length);
     }
+  while (return_value != fastuidraw::routine_success
+         && m_cache->evict_cold_glyphs() > 0);
 
-  FASTUIDRAWassert(m_glyph_data);
-  return_value = m_glyph_data->upload_to_atlas(m_cache->m_atlas,
-                                               m_atlas_location[0],
-                                               m_atlas_location[1],
-                                               m_geometry_offset,
-                                               m_geometry_length);
   if (return_value == fastuidraw::routine_success)
     {
       m_uploaded_to_atlas = true;
@@ -222,54 +589,253 @@ upload_to_atlas(void)
 
 
 
+/////////////////////////////////////////////////
+// PrefetchWorkers methods
+PrefetchWorkers::
+PrefetchWorkers(unsigned int num_threads):
+  m_num_completed(0),
+  m_pool(num_threads)
+{
+}
+
+void
+PrefetchWorkers::
+add(PrefetchRequest *R)
+{
+  for(unsigned int I = 0, endI = R->m_glyph_codes.size(); I < endI; ++I)
+    {
+      m_pool.add(R, [this, R, I] { compute(R, I); });
+    }
+}
+
+void
+PrefetchWorkers::
+wait(PrefetchRequest *R)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock, [R] { return R->complete(); });
+}
+
+void
+PrefetchWorkers::
+compute(PrefetchRequest *R, unsigned int I)
+{
+  R->compute(I);
+  if (R->m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_num_completed.fetch_add(1, std::memory_order_release);
+      }
+      m_done_cv.notify_all();
+    }
+}
+
 /////////////////////////////////////////////////
 // GlyphCachePrivate methods
 GlyphCachePrivate::
 GlyphCachePrivate(fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> patlas,
                   fastuidraw::GlyphCache *p):
   m_atlas(patlas),
+  m_slab_used(GlyphDataSlab::slab_size),
+  m_frame(0),
+  m_counters(0),
+  m_num_prefetch_threads(0),
+  m_prefetch_workers(nullptr),
+  m_num_merged(0),
+  m_next_ticket(0),
   m_p(p)
 {}
 
 GlyphCachePrivate::
 ~GlyphCachePrivate()
 {
+  if (m_prefetch_workers)
+    {
+      FASTUIDRAWdelete(m_prefetch_workers);
+    }
+
+  for(PrefetchRequest *R : m_pending_prefetches)
+    {
+      FASTUIDRAWdelete(R);
+    }
+
   for(unsigned int i = 0, endi = m_glyphs.size(); i < endi; ++i)
     {
       m_glyphs[i]->clear();
-      FASTUIDRAWdelete(m_glyphs[i]);
+      if (!m_glyphs[i]->m_slab_allocated)
+        {
+          FASTUIDRAWdelete(m_glyphs[i]);
+        }
+    }
+
+  for(GlyphDataSlab *slab : m_slabs)
+    {
+      FASTUIDRAWdelete(slab);
     }
 }
 
 
-GlyphDataPrivate*
+unsigned int
 GlyphCachePrivate::
-fetch_or_allocate_glyph(GlyphSource src)
+evict_cold_glyphs(void)
 {
-  std::map<GlyphSource, GlyphDataPrivate*>::iterator iter;
-  GlyphDataPrivate *G;
+  /* Evict in batches of a quarter of the candidates so that
+   * an upload that fails repeatedly (for example because of
+   * fragmentation of the atlas) does not sort the candidates
+   * once per evicted glyph.
+   */
+  unsigned int num_evict;
+
+  m_eviction_candidates.clear();
+  for(GlyphDataPrivate *G : m_glyphs)
+    {
+      if (G->m_uploaded_to_atlas && G->m_last_used_frame < m_frame && G->m_pin_count == 0)
+        {
+          m_eviction_candidates.push_back(G);
+        }
+    }
 
-  iter = m_glyph_map.find(src);
-  if (iter != m_glyph_map.end())
+  if (m_eviction_candidates.empty())
     {
-      return iter->second;
+      return 0;
     }
 
+  num_evict = std::max(1u, static_cast<unsigned int>(m_eviction_candidates.size() / 4u));
+  std::nth_element(m_eviction_candidates.begin(),
+                   m_eviction_candidates.begin() + (num_evict - 1u),
+                   m_eviction_candidates.end(),
+                   [](const GlyphDataPrivate *lhs, const GlyphDataPrivate *rhs)
+                   {
+                     return lhs->m_last_used_frame < rhs->m_last_used_frame;
+                   });
 
-  if (m_free_slots.empty())
+  for(unsigned int i = 0; i < num_evict; ++i)
     {
-      G = FASTUIDRAWnew GlyphDataPrivate(this, m_glyphs.size());
-      m_glyphs.push_back(G);
-      FASTUIDRAWassert(!G->m_render.valid());
+      m_eviction_candidates[i]->release_atlas_storage();
+    }
+  m_counters[fastuidraw::GlyphCache::eviction_counter] += num_evict;
+
+  return num_evict;
+}
+
+bool
+GlyphCachePrivate::
+adopt_glyph(GlyphDataPrivate *g)
+{
+  uint32_t hash;
+
+  hash = hash_glyph(hash_seed(g->m_layout.m_font.get(), g->m_render), g->m_layout.m_glyph_code);
+  if (m_glyph_map.find(g->m_layout.m_font.get(), g->m_layout.m_glyph_code, g->m_render, hash))
+    {
+      return false;
+    }
+
+  GlyphSource src(g->m_layout.m_font,
+                  g->m_layout.m_glyph_code,
+                  g->m_render);
+
+  m_glyph_map.insert(src, hash, g);
+  g->m_cache = this;
+  g->m_last_used_frame = m_frame;
+  g->m_cache_location = m_glyphs.size();
+  m_glyphs.push_back(g);
+  return true;
+}
+
+void
+GlyphCachePrivate::
+merge_prefetch(PrefetchRequest *R)
+{
+  FASTUIDRAWassert(R->complete());
+  for(GlyphDataPrivate *&G : R->m_results)
+    {
+      /* the glyph may have been fetched while it
+       * was being generated by the workers.
+       */
+      if (G->m_render.valid() && adopt_glyph(G))
+        {
+          G = nullptr;
+        }
     }
-  else
+  ++m_num_merged;
+  FASTUIDRAWdelete(R);
+}
+
+void
+GlyphCachePrivate::
+merge_completed_prefetches_implement(void)
+{
+  unsigned int dst(0);
+
+  for(PrefetchRequest *R : m_pending_prefetches)
+    {
+      if (R->complete())
+        {
+          merge_prefetch(R);
+        }
+      else
+        {
+          m_pending_prefetches[dst++] = R;
+        }
+    }
+  m_pending_prefetches.resize(dst);
+}
+
+GlyphDataPrivate*
+GlyphCachePrivate::
+allocate_glyph(void)
+{
+  GlyphDataPrivate *G;
+
+  if (!m_free_slots.empty())
     {
       unsigned int v(m_free_slots.back());
       m_free_slots.pop_back();
       G = m_glyphs[v];
       FASTUIDRAWassert(!G->m_render.valid());
+      return G;
+    }
+
+  if (m_slab_used == GlyphDataSlab::slab_size)
+    {
+      m_slabs.push_back(FASTUIDRAWnew GlyphDataSlab());
+      m_slab_used = 0;
+    }
+
+  G = &m_slabs.back()->m_entries[m_slab_used++];
+  G->m_cache = this;
+  G->m_cache_location = m_glyphs.size();
+  G->m_slab_allocated = true;
+  m_glyphs.push_back(G);
+  FASTUIDRAWassert(!G->m_render.valid());
+  return G;
+}
+
+GlyphDataPrivate*
+GlyphCachePrivate::
+fetch_glyph(fastuidraw::GlyphRender render,
+            const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> &font,
+            uint32_t glyph_code, uint32_t hash)
+{
+  GlyphDataPrivate *G;
+
+  G = m_glyph_map.find(font.get(), glyph_code, render, hash);
+  if (G)
+    {
+      G->m_last_used_frame = m_frame;
+      ++m_counters[fastuidraw::GlyphCache::hit_counter];
+      return G;
     }
-  m_glyph_map[src] = G;
+
+  ++m_counters[fastuidraw::GlyphCache::miss_counter];
+  G = allocate_glyph();
+  m_glyph_map.insert(GlyphSource(font, glyph_code, render), hash, G);
+
+  G->m_render = render;
+  G->m_last_used_frame = m_frame;
+  FASTUIDRAWassert(!G->m_glyph_data);
+  G->m_glyph_data = font->compute_rendering_data(G->m_render, glyph_code, G->m_layout, G->m_path);
   return G;
 }
 
@@ -365,6 +931,32 @@ upload_to_atlas(void) const
   return p->upload_to_atlas();
 }
 
+void
+fastuidraw::Glyph::
+pin(void) const
+{
+  GlyphDataPrivate *p;
+  p = static_cast<GlyphDataPrivate*>(m_opaque);
+  FASTUIDRAWassert(p != nullptr && p->m_render.valid());
+  ++p->m_pin_count;
+}
+
+void
+fastuidraw::Glyph::
+unpin(void) const
+{
+  GlyphDataPrivate *p;
+  p = static_cast<GlyphDataPrivate*>(m_opaque);
+  FASTUIDRAWassert(p != nullptr);
+  /* the pins of a glyph are dropped when the glyph is
+   * removed by GlyphCache::clear_cache() or delete_glyph().
+   */
+  if (p->m_pin_count > 0)
+    {
+      --p->m_pin_count;
+    }
+}
+
 const fastuidraw::Path&
 fastuidraw::Glyph::
 path(void) const
@@ -406,9 +998,16 @@ delete_glyph(Glyph G)
 //////////////////////////////////////////////////////////
 // fastuidraw::GlyphCache methods
 fastuidraw::GlyphCache::
-GlyphCache(reference_counted_ptr<GlyphAtlas> patlas)
+GlyphCache(reference_counted_ptr<GlyphAtlas> patlas,
+           unsigned int num_prefetch_threads)
 {
-  m_d = FASTUIDRAWnew GlyphCachePrivate(patlas, this);
+  GlyphCachePrivate *d;
+
+  d = FASTUIDRAWnew GlyphCachePrivate(patlas, this);
+  d->m_num_prefetch_threads = (num_prefetch_threads != 0) ?
+    num_prefetch_threads :
+    std::max(1u, std::thread::hardware_concurrency());
+  m_d = d;
 }
 
 fastuidraw::GlyphCache::
@@ -434,20 +1033,41 @@ fetch_glyph(GlyphRender render,
 
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
+  d->merge_completed_prefetches();
 
   GlyphDataPrivate *q;
-  GlyphSource src(font, glyph_code, render);
-
-  q = d->fetch_or_allocate_glyph(src);
+  q = d->fetch_glyph(render, font, glyph_code,
+                     hash_glyph(hash_seed(font.get(), render), glyph_code));
+  return Glyph(q);
+}
 
-  if (!q->m_render.valid())
+void
+fastuidraw::GlyphCache::
+fetch_glyphs(GlyphRender render,
+             const fastuidraw::reference_counted_ptr<const FontBase> &font,
+             c_array<const uint32_t> glyph_codes,
+             c_array<Glyph> out_glyphs)
+{
+  FASTUIDRAWassert(glyph_codes.size() == out_glyphs.size());
+  if (!font || !font->can_create_rendering_data(render.m_type))
     {
-      q->m_render = render;
-      FASTUIDRAWassert(!q->m_glyph_data);
-      q->m_glyph_data = font->compute_rendering_data(q->m_render, glyph_code, q->m_layout, q->m_path);
+      std::fill(out_glyphs.begin(), out_glyphs.end(), Glyph());
+      return;
     }
 
-  return Glyph(q);
+  GlyphCachePrivate *d;
+  uint64_t seed;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->merge_completed_prefetches();
+  seed = hash_seed(font.get(), render);
+  for(unsigned int i = 0, endi = glyph_codes.size(); i < endi; ++i)
+    {
+      GlyphDataPrivate *q;
+      q = d->fetch_glyph(render, font, glyph_codes[i],
+                         hash_glyph(seed, glyph_codes[i]));
+      out_glyphs[i] = Glyph(q);
+    }
 }
 
 enum fastuidraw::return_code
@@ -462,22 +1082,94 @@ add_glyph(Glyph glyph)
       return routine_fail;
     }
 
-  GlyphSource src(g->m_layout.m_font,
-                  g->m_layout.m_glyph_code,
-                  g->m_render);
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->merge_completed_prefetches();
+
+  return d->adopt_glyph(g) ?
+    routine_success :
+    routine_fail;
+}
 
+unsigned int
+fastuidraw::GlyphCache::
+prefetch(GlyphRender render,
+         const reference_counted_ptr<const FontBase> &font,
+         c_array<const uint32_t> glyph_codes)
+{
   GlyphCachePrivate *d;
+  std::vector<uint32_t> codes;
+  unsigned int ticket;
+  uint64_t seed;
+
   d = static_cast<GlyphCachePrivate*>(m_d);
-  if (d->m_glyph_map.find(src) != d->m_glyph_map.end())
+  ticket = d->m_next_ticket++;
+  if (!font || !font->can_create_rendering_data(render.m_type))
     {
-      return routine_fail;
+      return ticket;
     }
 
-  g->m_cache = d;
-  g->m_cache_location = d->m_glyphs.size();
-  d->m_glyphs.push_back(g);
+  /* only generate the glyphs not already in the cache */
+  d->merge_completed_prefetches();
+  seed = hash_seed(font.get(), render);
+  for(uint32_t glyph_code : glyph_codes)
+    {
+      if (!d->m_glyph_map.find(font.get(), glyph_code, render, hash_glyph(seed, glyph_code)))
+        {
+          codes.push_back(glyph_code);
+        }
+    }
 
-  return routine_success;
+  if (codes.empty())
+    {
+      return ticket;
+    }
+
+  PrefetchRequest *R;
+  R = FASTUIDRAWnew PrefetchRequest(ticket, render, font, codes);
+  if (!d->m_prefetch_workers)
+    {
+      d->m_prefetch_workers = FASTUIDRAWnew PrefetchWorkers(d->m_num_prefetch_threads);
+    }
+  d->m_pending_prefetches.push_back(R);
+  d->m_prefetch_workers->add(R);
+
+  return ticket;
+}
+
+bool
+fastuidraw::GlyphCache::
+prefetch_complete(unsigned int ticket) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  for(const PrefetchRequest *R : d->m_pending_prefetches)
+    {
+      if (R->m_ticket == ticket)
+        {
+          return R->complete();
+        }
+    }
+  return true;
+}
+
+void
+fastuidraw::GlyphCache::
+wait_prefetch(unsigned int ticket)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  for(PrefetchRequest *R : d->m_pending_prefetches)
+    {
+      if (R->m_ticket == ticket)
+        {
+          d->m_prefetch_workers->wait(R);
+          break;
+        }
+    }
+  d->merge_completed_prefetches();
 }
 
 void
@@ -493,8 +1185,9 @@ delete_glyph(Glyph G)
   FASTUIDRAWassert(p->m_cache == d);
   FASTUIDRAWassert(p->m_render.valid());
 
-  GlyphSource src(p->m_layout.m_font, p->m_layout.m_glyph_code, p->m_render);
-  d->m_glyph_map.erase(src);
+  d->m_glyph_map.erase(p->m_layout.m_font.get(), p->m_layout.m_glyph_code, p->m_render,
+                       hash_glyph(hash_seed(p->m_layout.m_font.get(), p->m_render),
+                                  p->m_layout.m_glyph_code));
   p->clear();
   d->m_free_slots.push_back(p->m_cache_location);
 }
@@ -539,3 +1232,30 @@ clear_cache(void)
         }
     }
 }
+
+void
+fastuidraw::GlyphCache::
+begin_frame(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  ++d->m_frame;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+counter(enum counter_t tp) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_counters[tp];
+}
+
+void
+fastuidraw::GlyphCache::
+reset_counters(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->m_counters = vecN<unsigned int, number_counters>(0);
+}
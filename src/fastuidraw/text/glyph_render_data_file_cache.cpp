@@ -0,0 +1,411 @@
+/*!
+ * \file glyph_render_data_file_cache.cpp
+ * \brief file glyph_render_data_file_cache.cpp
+ *
+ * Copyright 2016 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <fastuidraw/text/glyph_render_data_file_cache.hpp>
+#include <fastuidraw/util/data_buffer.hpp>
+#include "../private/util_private.hpp"
+
+namespace
+{
+  /* File layout (native byte order, all offsets in bytes
+   * from the start of the file):
+   *   file_header
+   *   file_index_entry[file_header::m_number_entries]
+   *   data of each entry, each starting at a multiple
+   *   of data_alignment
+   * Bump format_version whenever the layout of the file or
+   * the layout of the data written by a font changes, or
+   * when the generation of glyph rendering data changes.
+   */
+  const char file_magic[8] = { 'F', 'U', 'I', 'D', 'G', 'L', 'Y', 'C' };
+  const uint32_t format_byte_order = 0x01020304u;
+  const uint32_t format_version = 1u;
+  const uint64_t data_alignment = 8u;
+
+  class file_header
+  {
+  public:
+    char m_magic[8];
+    uint32_t m_byte_order;
+    uint32_t m_version;
+    uint64_t m_number_entries;
+  };
+
+  class file_index_entry
+  {
+  public:
+    uint64_t m_font_hash;
+    uint32_t m_face_index;
+    uint32_t m_glyph_code;
+    uint32_t m_glyph_type;
+    uint32_t m_pixel_size;
+    uint32_t m_parameters;
+    uint32_t m_padding;
+    uint64_t m_offset;
+    uint64_t m_size;
+  };
+
+  uint64_t
+  align_data_offset(uint64_t v)
+  {
+    return (v + data_alignment - 1u) & ~(data_alignment - 1u);
+  }
+
+  class GlyphRenderDataFileCachePrivate
+  {
+  public:
+    typedef fastuidraw::GlyphRenderDataFileCache::key key;
+    typedef std::map<key, fastuidraw::c_array<const uint8_t> > map_type;
+
+    GlyphRenderDataFileCachePrivate(fastuidraw::c_string filename,
+                                    const fastuidraw::reference_counted_ptr<const fastuidraw::DataBufferBase> &contents);
+
+    void
+    load(void);
+
+    enum fastuidraw::return_code
+    save(void);
+
+    std::string m_filename;
+
+    /* contents of the file as loaded; entries of
+     * m_entries loaded from the file point into it.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::DataBufferBase> m_contents;
+
+    /* holds the data of entries added by store(); a
+     * std::list so that the data does not move.
+     */
+    std::list<std::vector<uint8_t> > m_stored_data;
+
+    mutable fastuidraw::mutex m_mutex;
+    map_type m_entries;
+    unsigned int m_number_unsaved;
+  };
+}
+
+//////////////////////////////////////////////
+// GlyphRenderDataFileCachePrivate methods
+GlyphRenderDataFileCachePrivate::
+GlyphRenderDataFileCachePrivate(fastuidraw::c_string filename,
+                                const fastuidraw::reference_counted_ptr<const fastuidraw::DataBufferBase> &contents):
+  m_filename(filename),
+  m_contents(contents),
+  m_number_unsaved(0)
+{
+  load();
+}
+
+void
+GlyphRenderDataFileCachePrivate::
+load(void)
+{
+  fastuidraw::c_array<const uint8_t> bytes;
+  file_header header;
+  uint64_t index_end;
+
+  if (!m_contents)
+    {
+      return;
+    }
+
+  bytes = m_contents->data_ro();
+  if (bytes.size() < sizeof(file_header))
+    {
+      return;
+    }
+
+  std::memcpy(&header, bytes.c_ptr(), sizeof(file_header));
+  if (std::memcmp(header.m_magic, file_magic, sizeof(file_magic)) != 0
+      || header.m_byte_order != format_byte_order
+      || header.m_version != format_version
+      || header.m_number_entries > bytes.size() / sizeof(file_index_entry))
+    {
+      return;
+    }
+
+  index_end = sizeof(file_header) + header.m_number_entries * sizeof(file_index_entry);
+  if (index_end > bytes.size())
+    {
+      return;
+    }
+
+  for(uint64_t i = 0; i < header.m_number_entries; ++i)
+    {
+      file_index_entry E;
+      key K;
+
+      std::memcpy(&E, bytes.c_ptr() + sizeof(file_header) + i * sizeof(file_index_entry),
+                  sizeof(file_index_entry));
+      if (E.m_offset < index_end || E.m_offset > bytes.size()
+          || E.m_size > bytes.size() - E.m_offset)
+        {
+          /* a corrupt entry means the file cannot be trusted */
+          m_entries.clear();
+          return;
+        }
+
+      K.m_font_hash = E.m_font_hash;
+      K.m_face_index = E.m_face_index;
+      K.m_glyph_code = E.m_glyph_code;
+      K.m_glyph_type = E.m_glyph_type;
+      K.m_pixel_size = E.m_pixel_size;
+      K.m_parameters = E.m_parameters;
+      m_entries[K] = bytes.sub_array(E.m_offset, E.m_size);
+    }
+}
+
+enum fastuidraw::return_code
+GlyphRenderDataFileCachePrivate::
+save(void)
+{
+  std::string tmp_filename(m_filename + ".tmp");
+  std::vector<file_index_entry> index;
+  file_header header;
+  uint64_t offset;
+
+  /* the entries of the new file may point into the old
+   * file, so the new file is completely written before
+   * it replaces the old one.
+   */
+  std::memcpy(header.m_magic, file_magic, sizeof(file_magic));
+  header.m_byte_order = format_byte_order;
+  header.m_version = format_version;
+  header.m_number_entries = m_entries.size();
+
+  offset = align_data_offset(sizeof(file_header) + m_entries.size() * sizeof(file_index_entry));
+  index.reserve(m_entries.size());
+  for(const auto &e : m_entries)
+    {
+      file_index_entry E;
+
+      E.m_font_hash = e.first.m_font_hash;
+      E.m_face_index = e.first.m_face_index;
+      E.m_glyph_code = e.first.m_glyph_code;
+      E.m_glyph_type = e.first.m_glyph_type;
+      E.m_pixel_size = e.first.m_pixel_size;
+      E.m_parameters = e.first.m_parameters;
+      E.m_padding = 0;
+      E.m_offset = offset;
+      E.m_size = e.second.size();
+      index.push_back(E);
+      offset = align_data_offset(offset + E.m_size);
+    }
+
+  {
+    std::ofstream file(tmp_filename.c_str(), std::ios::binary | std::ios::trunc);
+    const char padding[data_alignment] = { 0 };
+    uint64_t written;
+
+    if (!file)
+      {
+        return fastuidraw::routine_fail;
+      }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(file_header));
+    if (!index.empty())
+      {
+        file.write(reinterpret_cast<const char*>(&index[0]),
+                   index.size() * sizeof(file_index_entry));
+      }
+
+    written = sizeof(file_header) + index.size() * sizeof(file_index_entry);
+    for(const auto &e : m_entries)
+      {
+        file.write(padding, align_data_offset(written) - written);
+        written = align_data_offset(written);
+
+        file.write(reinterpret_cast<const char*>(e.second.c_ptr()), e.second.size());
+        written += e.second.size();
+      }
+
+    if (!file)
+      {
+        file.close();
+        std::remove(tmp_filename.c_str());
+        return fastuidraw::routine_fail;
+      }
+  }
+
+  if (std::rename(tmp_filename.c_str(), m_filename.c_str()) != 0)
+    {
+      std::remove(tmp_filename.c_str());
+      return fastuidraw::routine_fail;
+    }
+
+  m_number_unsaved = 0;
+  return fastuidraw::routine_success;
+}
+
+//////////////////////////////////////////////////////
+// fastuidraw::GlyphRenderDataFileCache::key methods
+bool
+fastuidraw::GlyphRenderDataFileCache::key::
+operator<(const key &rhs) const
+{
+  if (m_font_hash != rhs.m_font_hash)
+    {
+      return m_font_hash < rhs.m_font_hash;
+    }
+
+  if (m_face_index != rhs.m_face_index)
+    {
+      return m_face_index < rhs.m_face_index;
+    }
+
+  if (m_glyph_code != rhs.m_glyph_code)
+    {
+      return m_glyph_code < rhs.m_glyph_code;
+    }
+
+  if (m_glyph_type != rhs.m_glyph_type)
+    {
+      return m_glyph_type < rhs.m_glyph_type;
+    }
+
+  if (m_pixel_size != rhs.m_pixel_size)
+    {
+      return m_pixel_size < rhs.m_pixel_size;
+    }
+
+  return m_parameters < rhs.m_parameters;
+}
+
+//////////////////////////////////////////////////
+// fastuidraw::GlyphRenderDataFileCache methods
+fastuidraw::GlyphRenderDataFileCache::
+GlyphRenderDataFileCache(c_string filename)
+{
+  reference_counted_ptr<const DataBufferBase> contents;
+
+  contents = FASTUIDRAWnew DataBuffer(filename);
+  m_d = FASTUIDRAWnew GlyphRenderDataFileCachePrivate(filename, contents);
+}
+
+fastuidraw::GlyphRenderDataFileCache::
+GlyphRenderDataFileCache(c_string filename,
+                         const reference_counted_ptr<const DataBufferBase> &contents)
+{
+  m_d = FASTUIDRAWnew GlyphRenderDataFileCachePrivate(filename, contents);
+}
+
+fastuidraw::GlyphRenderDataFileCache::
+~GlyphRenderDataFileCache()
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  if (d->m_number_unsaved > 0)
+    {
+      d->save();
+    }
+
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::c_string
+fastuidraw::GlyphRenderDataFileCache::
+filename(void) const
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+  return d->m_filename.c_str();
+}
+
+bool
+fastuidraw::GlyphRenderDataFileCache::
+fetch(const key &K, c_array<const uint8_t> *out_data) const
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  GlyphRenderDataFileCachePrivate::map_type::const_iterator iter;
+
+  iter = d->m_entries.find(K);
+  if (iter == d->m_entries.end())
+    {
+      return false;
+    }
+
+  *out_data = iter->second;
+  return true;
+}
+
+void
+fastuidraw::GlyphRenderDataFileCache::
+store(const key &K, c_array<const uint8_t> data)
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  if (d->m_entries.find(K) != d->m_entries.end())
+    {
+      return;
+    }
+
+  d->m_stored_data.push_back(std::vector<uint8_t>(data.begin(), data.end()));
+  d->m_entries[K] = make_c_array(d->m_stored_data.back());
+  ++d->m_number_unsaved;
+}
+
+unsigned int
+fastuidraw::GlyphRenderDataFileCache::
+number_entries(void) const
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  return d->m_entries.size();
+}
+
+unsigned int
+fastuidraw::GlyphRenderDataFileCache::
+number_unsaved_entries(void) const
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  return d->m_number_unsaved;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataFileCache::
+save(void)
+{
+  GlyphRenderDataFileCachePrivate *d;
+  d = static_cast<GlyphRenderDataFileCachePrivate*>(m_d);
+
+  autolock_mutex m(d->m_mutex);
+  if (d->m_number_unsaved == 0)
+    {
+      return routine_success;
+    }
+  return d->save();
+}
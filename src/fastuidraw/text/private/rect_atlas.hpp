@@ -106,6 +106,8 @@ public:
       m_atlas(p),
       m_minX_minY(0, 0),
       m_size(psize),
+      m_unpadded_minX_minY(0, 0),
+      m_unpadded_size(psize),
       m_tree(nullptr)
     {}
 